@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Microbenchmarks for the a2a3 tensormap_and_ringbuffer runtime primitives:
+ * PTO2TaskAllocator::alloc, TensorMap insert/lookup at varying chain depth,
+ * and the MPMC ready queue under contention. These are the orchestrator and
+ * scheduler hot paths — a regression in any of them shows up directly as
+ * submit or dispatch latency.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "bench_common.h"
+#include "pto_orchestration_api.h"
+// pto_orchestration_api.h (runtime-ops logging) and the runtime headers'
+// unified_log.h both define the LOG_* macros; this TU uses the runtime side.
+#undef LOG_ERROR
+#undef LOG_WARN
+#undef LOG_INFO
+#undef LOG_DEBUG
+#undef LOG_ALWAYS
+#include "pto_ring_buffer.h"
+#include "pto_scheduler.h"
+#include "pto_tensormap.h"
+
+// always_assert backend (normally provided by the platform library)
+[[noreturn]] void assert_impl(const char *cond, const char *file, int line) {
+    fprintf(stderr, "assert failed: %s (%s:%d)\n", cond, file, line);
+    abort();
+}
+
+namespace {
+
+// =============================================================================
+// PTO2TaskAllocator::alloc
+// =============================================================================
+
+/**
+ * Drives the allocator the way the orchestrator does: each op allocates,
+ * fills the descriptor's packed-buffer fields, and retires tasks half a
+ * window behind so the ring never stalls (benchmarking the hot path, not
+ * the back-pressure spin).
+ */
+void bench_task_allocator() {
+    constexpr int32_t kWindow = 1024;
+    constexpr uint64_t kHeapSize = 16ull * 1024 * 1024;
+
+    std::vector<PTO2TaskDescriptor> descriptors(kWindow);
+    void *heap = malloc(kHeapSize);
+    std::atomic<int32_t> current_index{0};
+    std::atomic<int32_t> last_alive{0};
+    std::atomic<int32_t> error_code{0};
+
+    auto run_case = [&](const char *name, int32_t output_size) {
+        memset(descriptors.data(), 0, descriptors.size() * sizeof(PTO2TaskDescriptor));
+        current_index.store(0);
+        last_alive.store(0);
+        PTO2TaskAllocator allocator;
+        allocator.init(
+            descriptors.data(), kWindow, &current_index, &last_alive, heap, kHeapSize, &error_code
+        );
+
+        bench_run(name, 256, 256, [&]() {
+            PTO2TaskAllocResult r = allocator.alloc(output_size);
+            PTO2TaskDescriptor &desc = descriptors[r.slot];
+            desc.task_id = PTO2TaskId::make(0, static_cast<uint32_t>(r.task_id));
+            desc.packed_buffer_base = r.packed_base;
+            desc.packed_buffer_end = r.packed_end;
+            if (r.task_id >= kWindow / 2) {
+                last_alive.store(r.task_id - kWindow / 2, std::memory_order_release);
+            }
+        });
+    };
+
+    run_case("PTO2TaskAllocator::alloc(0)", 0);
+    run_case("PTO2TaskAllocator::alloc(128) inline", 128);
+    run_case("PTO2TaskAllocator::alloc(4096) heap ring", 4096);
+
+    free(heap);
+}
+
+// =============================================================================
+// TensorMap insert / lookup
+// =============================================================================
+
+void bench_tensormap() {
+    auto *map = new PTO2TensorMap();
+    int32_t window_sizes[PTO2_MAX_RING_DEPTH] = {};
+    if (!map->init(PTO2_TENSORMAP_NUM_BUCKETS, PTO2_TENSORMAP_POOL_SIZE, window_sizes)) {
+        printf("TensorMap init failed, skipping\n");
+        delete map;
+        return;
+    }
+
+    const uint32_t shapes[2] = {64, 64};
+
+    // Insert: every op registers a distinct non-overlapping tensor (the
+    // steady-state producer path). Count stays well under the entry pool.
+    {
+        uint64_t next_addr = 0x100000000ull;
+        uint32_t next_id = 0;
+        bench_run("TensorMap::insert (distinct buffers)", 64, 256, [&]() {
+            Tensor t = make_tensor_external(reinterpret_cast<void *>(next_addr), shapes, 2);
+            map->insert(t, PTO2TaskId::make(0, next_id++));
+            next_addr += 64 * 64 * sizeof(float);
+        });
+    }
+
+    // Lookup at varying chain depth: `depth` producers registered on the
+    // same buffer force the bucket chain walk the dependency scan pays for.
+    for (int depth : {1, 4, 16}) {
+        uint64_t addr = 0x200000000ull + static_cast<uint64_t>(depth) * 0x10000000ull;
+        Tensor probe = make_tensor_external(reinterpret_cast<void *>(addr), shapes, 2);
+        for (int i = 0; i < depth; i++) {
+            Tensor producer_view = make_tensor_external(reinterpret_cast<void *>(addr), shapes, 2);
+            map->insert(producer_view, PTO2TaskId::make(0, 100000u + static_cast<uint32_t>(i)));
+        }
+        char name[64];
+        snprintf(name, sizeof(name), "TensorMap::lookup (chain depth %d)", depth);
+        bench_run(name, 64, 256, [&]() {
+            PTO2LookupResult result;
+            map->lookup(probe, result);
+            bench_escape(&result);
+        });
+    }
+
+    map->destroy();
+    delete map;
+}
+
+// =============================================================================
+// Ready queue push/pop
+// =============================================================================
+
+void bench_ready_queue_contended(int num_threads) {
+    PTO2ReadyQueue queue;
+    if (!pto2_ready_queue_init(&queue, 4096)) {
+        printf("ready queue init failed, skipping\n");
+        return;
+    }
+
+    static PTO2TaskSlotState dummy_state;
+    constexpr int kSamples = 128;
+    constexpr int kBatch = 256;
+
+    std::vector<std::vector<double>> per_thread(static_cast<size_t>(num_threads));
+    std::atomic<int> ready{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([&, t]() {
+            auto &samples = per_thread[static_cast<size_t>(t)];
+            samples.reserve(kSamples);
+            ready.fetch_add(1);
+            while (ready.load(std::memory_order_acquire) < num_threads) {
+            }
+            for (int b = 0; b < kSamples; b++) {
+                uint64_t t0 = bench_read_cycles();
+                for (int i = 0; i < kBatch; i++) {
+                    queue.push(&dummy_state);
+                    bench_escape(queue.pop());
+                }
+                uint64_t t1 = bench_read_cycles();
+                samples.push_back(static_cast<double>(t1 - t0) / (2 * kBatch));
+            }
+        });
+    }
+    for (auto &th : threads) {
+        th.join();
+    }
+
+    std::vector<double> merged;
+    for (auto &samples : per_thread) {
+        merged.insert(merged.end(), samples.begin(), samples.end());
+    }
+    char name[64];
+    snprintf(name, sizeof(name), "PTO2ReadyQueue push+pop (%d threads)", num_threads);
+    bench_report(name, merged);
+
+    pto2_ready_queue_destroy(&queue);
+}
+
+}  // namespace
+
+int main() {
+    bench_print_header("a2a3 tensormap_and_ringbuffer primitives");
+    bench_task_allocator();
+    bench_tensormap();
+    bench_ready_queue_contended(1);
+    bench_ready_queue_contended(4);
+    return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Microbenchmark harness for runtime primitives.
+ *
+ * Each benchmark measures batches of operations against the raw cycle
+ * counter and reports the cycles/op distribution across batches
+ * (mean / min / p50 / p90 / p99 / max). Batching keeps the counter-read
+ * overhead off the per-op number; the batch size should be large enough
+ * that one batch takes at least a few hundred cycles.
+ *
+ * The counter is cntvct_el0 on aarch64 (host and AICPU — the AICPU is a
+ * Linux-usermode aarch64 core) and rdtsc on x86_64, so "cycles" are
+ * fixed-frequency counter ticks, comparable across runs on one machine.
+ */
+
+#ifndef BENCH_COMMON_H
+#define BENCH_COMMON_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+static inline uint64_t bench_read_cycles() {
+#if defined(__aarch64__)
+    uint64_t value;
+    __asm__ volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#elif defined(__x86_64__)
+    uint32_t lo, hi;
+    __asm__ volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    return (static_cast<uint64_t>(hi) << 32) | lo;
+#else
+    return 0;
+#endif
+}
+
+/** Keep `ptr` (and everything reachable from it) alive past the optimizer. */
+static inline void bench_escape(const void *ptr) { __asm__ volatile("" : : "r"(ptr) : "memory"); }
+
+static inline void bench_print_header(const char *suite) {
+    printf("\n== %s ==\n", suite);
+    printf(
+        "%-48s %10s %10s %10s %10s %10s %10s\n", "benchmark (cycles/op)", "mean", "min", "p50", "p90", "p99", "max"
+    );
+}
+
+/** Report one benchmark's cycles/op distribution from per-batch samples. */
+static inline void bench_report(const char *name, std::vector<double> &samples) {
+    if (samples.empty()) {
+        printf("%-48s (no samples)\n", name);
+        return;
+    }
+    std::sort(samples.begin(), samples.end());
+    double sum = 0.0;
+    for (double s : samples) {
+        sum += s;
+    }
+    auto pct = [&](double p) { return samples[static_cast<size_t>(p * (samples.size() - 1))]; };
+    printf(
+        "%-48s %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n", name, sum / samples.size(), samples.front(), pct(0.50),
+        pct(0.90), pct(0.99), samples.back()
+    );
+}
+
+/**
+ * Run `op` for `warmup_batches + sample_batches` batches of `batch` calls
+ * and report the per-op cycle distribution over the sampled batches.
+ */
+template <typename Op>
+void bench_run(const char *name, int sample_batches, int batch, Op &&op) {
+    const int warmup_batches = sample_batches / 8 + 1;
+    for (int b = 0; b < warmup_batches; b++) {
+        for (int i = 0; i < batch; i++) {
+            op();
+        }
+    }
+
+    std::vector<double> samples(static_cast<size_t>(sample_batches));
+    for (int b = 0; b < sample_batches; b++) {
+        uint64_t t0 = bench_read_cycles();
+        for (int i = 0; i < batch; i++) {
+            op();
+        }
+        uint64_t t1 = bench_read_cycles();
+        samples[static_cast<size_t>(b)] = static_cast<double>(t1 - t0) / batch;
+    }
+    bench_report(name, samples);
+}
+
+#endif  // BENCH_COMMON_H
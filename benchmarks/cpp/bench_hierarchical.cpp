@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Microbenchmarks for the hierarchical runtime primitives: Ring::alloc
+ * (task-id/slot handout) and ChipStorageTaskArgs copy (the POD the L2 ABI
+ * memcpy's on every chip-level submit).
+ */
+
+#include <cstring>
+
+#include "bench_common.h"
+#include "ring.h"
+#include "task_args.h"
+
+namespace {
+
+void bench_ring_alloc() {
+    // Slot-only allocation: heap disabled, so alloc() exercises the
+    // reserve-then-publish id path without heap back-pressure.
+    Ring ring;
+    ring.init(/*heap_bytes=*/0, /*timeout_ms=*/500);
+    bench_run("Ring::alloc (slot only)", 64, 256, [&]() {
+        auto r = ring.alloc();
+        bench_escape(&r);
+    });
+}
+
+void bench_task_args_copy() {
+    ChipStorageTaskArgs src;
+    ContinuousTensor tensor{};
+    tensor.ndims = 2;
+    tensor.shapes[0] = 64;
+    tensor.shapes[1] = 64;
+    for (int i = 0; i < CHIP_MAX_TENSOR_ARGS; i++) {
+        tensor.data = 0x1000u + static_cast<uint64_t>(i) * 0x1000u;
+        src.add_tensor(tensor);
+    }
+    for (int i = 0; i < 16; i++) {
+        src.add_scalar(static_cast<uint64_t>(i));
+    }
+
+    bench_run("ChipStorageTaskArgs copy (16 tensors)", 64, 256, [&]() {
+        ChipStorageTaskArgs dst = src;
+        bench_escape(&dst);
+    });
+}
+
+}  // namespace
+
+int main() {
+    bench_print_header("hierarchical runtime primitives");
+    bench_ring_alloc();
+    bench_task_args_copy();
+    return 0;
+}
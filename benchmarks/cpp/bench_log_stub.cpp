@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Minimal unified_log backend for the benchmark binaries: errors/warnings go
+ * to stderr, everything else is dropped so log I/O never lands inside a
+ * timed region.
+ */
+
+#include <cstdarg>
+#include <cstdio>
+
+static void bench_vlog(const char *level, const char *func, const char *fmt, va_list args) {
+    fprintf(stderr, "[%s] %s: ", level, func);
+    vfprintf(stderr, fmt, args);
+    fputc('\n', stderr);
+}
+
+extern "C" {
+
+void unified_log_error(const char *func, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    bench_vlog("ERROR", func, fmt, args);
+    va_end(args);
+}
+
+void unified_log_warn(const char *func, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    bench_vlog("WARN", func, fmt, args);
+    va_end(args);
+}
+
+void unified_log_info(const char *, const char *, ...) {}
+void unified_log_debug(const char *, const char *, ...) {}
+
+void unified_log_always(const char *func, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    bench_vlog("LOG", func, fmt, args);
+    va_end(args);
+}
+
+}  // extern "C"
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Contention stress benchmark for the PTO2ReadyQueue (Vyukov MPMC).
+ *
+ * Sweeps producers x consumers x queue depth, reporting sustained
+ * throughput, the per-push enqueue-latency distribution (p99 included),
+ * and sequence-CAS retry overhead. The target compiles with
+ * PTO2_ORCH_PROFILING so the queue's own instrumented push() supplies the
+ * atomic-op and contention-wait accounting — the measured code is the
+ * production path, not a replica. An uncontended push costs exactly 4
+ * atomic ops (pos load, sequence load, CAS, sequence store); anything
+ * above that is retry spin from CAS losses or not-yet-released slots.
+ *
+ * The data feeds the global-queue vs PTO2LocalReadyBuffer trade-off:
+ * compare the contended p99 here against the local buffer's atomic-free
+ * owner path before routing more traffic either way.
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "bench_common.h"
+
+// The instrumented PTO2ReadyQueue::push uses get_sys_cnt_aicpu; on host
+// builds the platform library is absent, so back it with the bench counter.
+#include "aicpu/device_time.h"
+uint64_t get_sys_cnt_aicpu() { return bench_read_cycles(); }
+
+#include "pto_scheduler.h"
+
+// always_assert backend (normally provided by the platform library)
+[[noreturn]] void assert_impl(const char *cond, const char *file, int line) {
+    fprintf(stderr, "assert failed: %s (%s:%d)\n", cond, file, line);
+    abort();
+}
+
+namespace {
+
+constexpr int64_t TOTAL_OPS = 1 << 16;
+
+struct ProducerStats {
+    std::vector<double> latencies;  // cycles per successful push
+    uint64_t atomic_ops = 0;
+    uint64_t wait_cycles = 0;
+    uint64_t pushes = 0;
+    uint64_t full_stalls = 0;  // push() returned false (queue full)
+};
+
+struct ConsumerStats {
+    uint64_t pops = 0;
+    uint64_t empty_polls = 0;
+};
+
+void run_case(int num_producers, int num_consumers, uint64_t depth) {
+    PTO2ReadyQueue queue;
+    if (!pto2_ready_queue_init(&queue, depth)) {
+        printf("ready queue init failed (depth %llu), skipping\n", static_cast<unsigned long long>(depth));
+        return;
+    }
+
+    static PTO2TaskSlotState dummy_state;
+    const int64_t ops_per_producer = TOTAL_OPS / num_producers;
+    const int64_t total_ops = ops_per_producer * num_producers;
+
+    std::vector<ProducerStats> producer_stats(static_cast<size_t>(num_producers));
+    std::vector<ConsumerStats> consumer_stats(static_cast<size_t>(num_consumers));
+    std::atomic<int> ready{0};
+    std::atomic<int> producers_done{0};
+    const int total_threads = num_producers + num_consumers;
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < num_producers; p++) {
+        threads.emplace_back([&, p]() {
+            ProducerStats &stats = producer_stats[static_cast<size_t>(p)];
+            stats.latencies.reserve(static_cast<size_t>(ops_per_producer));
+            ready.fetch_add(1);
+            while (ready.load(std::memory_order_acquire) < total_threads) {
+            }
+            for (int64_t i = 0; i < ops_per_producer; i++) {
+                // Sample latency on the first attempt only: a full queue is
+                // back-pressure (consumer-bound), not enqueue cost, so those
+                // waits are counted as stalls instead of polluting the p99.
+                uint64_t t0 = bench_read_cycles();
+                if (queue.push(&dummy_state, stats.atomic_ops, stats.wait_cycles)) {
+                    stats.latencies.push_back(static_cast<double>(bench_read_cycles() - t0));
+                } else {
+                    stats.full_stalls++;
+                    while (!queue.push(&dummy_state, stats.atomic_ops, stats.wait_cycles)) {
+                    }
+                }
+                stats.pushes++;
+            }
+            producers_done.fetch_add(1, std::memory_order_release);
+        });
+    }
+    for (int c = 0; c < num_consumers; c++) {
+        threads.emplace_back([&, c]() {
+            ConsumerStats &stats = consumer_stats[static_cast<size_t>(c)];
+            ready.fetch_add(1);
+            while (ready.load(std::memory_order_acquire) < total_threads) {
+            }
+            while (true) {
+                if (queue.pop() != nullptr) {
+                    stats.pops++;
+                } else if (producers_done.load(std::memory_order_acquire) == num_producers) {
+                    // Producers finished and the queue reads empty: one more
+                    // pop settles any release still in flight, then exit.
+                    if (queue.pop() != nullptr) {
+                        stats.pops++;
+                    } else {
+                        break;
+                    }
+                } else {
+                    stats.empty_polls++;
+                }
+            }
+        });
+    }
+
+    while (ready.load(std::memory_order_acquire) < total_threads) {
+    }
+    uint64_t wall_start = bench_read_cycles();
+    for (auto &th : threads) {
+        th.join();
+    }
+    uint64_t wall_cycles = bench_read_cycles() - wall_start;
+
+    std::vector<double> merged;
+    uint64_t atomic_ops = 0, wait_cycles = 0, pushes = 0, full_stalls = 0;
+    for (auto &stats : producer_stats) {
+        merged.insert(merged.end(), stats.latencies.begin(), stats.latencies.end());
+        atomic_ops += stats.atomic_ops;
+        wait_cycles += stats.wait_cycles;
+        pushes += stats.pushes;
+        full_stalls += stats.full_stalls;
+    }
+    uint64_t empty_polls = 0;
+    for (auto &stats : consumer_stats) {
+        empty_polls += stats.empty_polls;
+    }
+
+    char name[80];
+    snprintf(
+        name, sizeof(name), "push latency %dp x %dc depth %llu", num_producers, num_consumers,
+        static_cast<unsigned long long>(depth)
+    );
+    bench_report(name, merged);
+    // 4 atomic ops = uncontended push; the excess is sequence-CAS retry spin.
+    double retry_ops_per_push = pushes > 0 ? (static_cast<double>(atomic_ops) - 4.0 * pushes) / pushes : 0.0;
+    double wall_cycles_per_op = total_ops > 0 ? static_cast<double>(wall_cycles) / total_ops : 0.0;
+    printf(
+        "    sustained %.1f wall cycles/op, retry ops/push %.3f, contended wait %.1f cycles/push, "
+        "full stalls %llu, empty polls %llu\n",
+        wall_cycles_per_op, retry_ops_per_push, pushes > 0 ? static_cast<double>(wait_cycles) / pushes : 0.0,
+        static_cast<unsigned long long>(full_stalls), static_cast<unsigned long long>(empty_polls)
+    );
+
+    pto2_ready_queue_destroy(&queue);
+}
+
+}  // namespace
+
+int main() {
+    bench_print_header("PTO2ReadyQueue contention stress");
+    const int producer_counts[] = {1, 2, 4};
+    const int consumer_counts[] = {1, 2, 4};
+    const uint64_t depths[] = {256, 4096};
+    for (uint64_t depth : depths) {
+        for (int p : producer_counts) {
+            for (int c : consumer_counts) {
+                run_case(p, c, depth);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Tile Increment Kernel (Cube Core)
+ *
+ * Computes: out = in + 1.0 (tile_size x tile_size tile) on the AIC scalar
+ * unit. The cube core has no vector pipeline, so this is a plain scalar
+ * loop — the point is not cube throughput but exercising the AIC dispatch
+ * path in the mixed-ratio perf scenes with the same f = a + chain_len
+ * semantics as the AIV kernel.
+ *
+ * Args (Tensor*):
+ *   args[0] = in     (INPUT)
+ *   args[1] = out    (OUTPUT)
+ *   args[2] = config (INPUT) - int64_t[4]: [tile_size, chain_len, fanout, aic_period]
+ */
+
+#include <cstdint>
+
+#include "tensor.h"
+
+#ifndef __gm__
+#define __gm__
+#endif
+
+#ifndef __aicore__
+#define __aicore__ [aicore]
+#endif
+
+extern "C" __aicore__ void kernel_entry(__gm__ int64_t *args) {
+    __gm__ Tensor *in_tensor = reinterpret_cast<__gm__ Tensor *>(args[0]);
+    __gm__ Tensor *out_tensor = reinterpret_cast<__gm__ Tensor *>(args[1]);
+    __gm__ Tensor *config = reinterpret_cast<__gm__ Tensor *>(args[2]);
+
+    __gm__ int64_t *cfg = reinterpret_cast<__gm__ int64_t *>(config->buffer.addr);
+    uint64_t tile_size = static_cast<uint64_t>(cfg[0]);
+    uint64_t tile_elems = tile_size * tile_size;
+
+    __gm__ float *in_ptr = reinterpret_cast<__gm__ float *>(in_tensor->buffer.addr) + in_tensor->start_offset;
+    __gm__ float *out_ptr = reinterpret_cast<__gm__ float *>(out_tensor->buffer.addr) + out_tensor->start_offset;
+
+    for (uint64_t i = 0; i < tile_elems; i++) {
+        out_ptr[i] = in_ptr[i] + 1.0f;
+    }
+}
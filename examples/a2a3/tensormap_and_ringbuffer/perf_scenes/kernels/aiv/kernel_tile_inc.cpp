@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Tile Increment Kernel (Vector Core)
+ *
+ * Computes: out = in + 1.0 (tile_size x tile_size tile)
+ * Uses TADDS instruction
+ *
+ * The deliberately tiny compute keeps kernel time negligible so the perf
+ * scenes measure scheduling latency, not arithmetic throughput. Chaining
+ * this kernel chain_len times gives golden f = a + chain_len.
+ *
+ * Args (Tensor*):
+ *   args[0] = in     (INPUT)
+ *   args[1] = out    (OUTPUT)
+ *   args[2] = config (INPUT) - int64_t[4]: [tile_size, chain_len, fanout, aic_period]
+ */
+
+#include <cstdint>
+#include <pto/pto-inst.hpp>
+#include <pto/common/constants.hpp>
+
+#include "tensor.h"
+
+using namespace pto;
+
+#ifndef __gm__
+#define __gm__
+#endif
+
+#ifndef __aicore__
+#define __aicore__ [aicore]
+#endif
+
+template <int TILE>
+static __aicore__ void tile_inc_impl(__gm__ float *in_ptr, __gm__ float *out_ptr) {
+    using DynShapeDim5 = Shape<1, 1, 1, TILE, TILE>;
+    using DynStridDim5 = Stride<1, 1, 1, TILE, 1>;
+    using GlobalData = GlobalTensor<float, DynShapeDim5, DynStridDim5>;
+    using TileData = Tile<TileType::Vec, float, TILE, TILE, BLayout::RowMajor, -1, -1>;
+
+    TileData inTile(TILE, TILE);
+    TileData outTile(TILE, TILE);
+    TASSIGN(inTile, 0x0);
+    TASSIGN(outTile, 0x10000);
+
+    GlobalData inGlobal(in_ptr);
+    GlobalData outGlobal(out_ptr);
+
+    TLOAD(inTile, inGlobal);
+    set_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+    wait_flag(PIPE_MTE2, PIPE_V, EVENT_ID0);
+    TADDS(outTile, inTile, 1.0f);
+    set_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+    wait_flag(PIPE_V, PIPE_MTE3, EVENT_ID0);
+    TSTORE(outGlobal, outTile);
+
+    set_flag(PIPE_MTE3, PIPE_S, EVENT_ID7);
+    wait_flag(PIPE_MTE3, PIPE_S, EVENT_ID7);
+}
+
+extern "C" __aicore__ void kernel_entry(__gm__ int64_t *args) {
+    __gm__ Tensor *in_tensor = reinterpret_cast<__gm__ Tensor *>(args[0]);
+    __gm__ Tensor *out_tensor = reinterpret_cast<__gm__ Tensor *>(args[1]);
+    __gm__ Tensor *config = reinterpret_cast<__gm__ Tensor *>(args[2]);
+
+    __gm__ int64_t *cfg = reinterpret_cast<__gm__ int64_t *>(config->buffer.addr);
+    uint64_t tile_size = static_cast<uint64_t>(cfg[0]);
+
+    __gm__ float *in_ptr = reinterpret_cast<__gm__ float *>(in_tensor->buffer.addr) + in_tensor->start_offset;
+    __gm__ float *out_ptr = reinterpret_cast<__gm__ float *>(out_tensor->buffer.addr) + out_tensor->start_offset;
+
+    switch (tile_size) {
+    case 16:
+        tile_inc_impl<16>(in_ptr, out_ptr);
+        break;
+    case 32:
+        tile_inc_impl<32>(in_ptr, out_ptr);
+        break;
+    case 64:
+        tile_inc_impl<64>(in_ptr, out_ptr);
+        break;
+    case 128:
+        tile_inc_impl<128>(in_ptr, out_ptr);
+        break;
+    default:
+        break;
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Perf-Scene DAG Orchestration (tensormap_and_ringbuffer Runtime)
+ *
+ * Synthesizes a parameterized task graph whose shape is the benchmark:
+ * `fanout` independent branches, each a serial chain of `chain_len`
+ * increment tasks over one tile_size x tile_size tile. Every task computes
+ * out = in + 1, so golden is simply f = a + chain_len regardless of shape.
+ *
+ * Configuration read from the config tensor:
+ *   - tile_size:  tile dimension (per-task data size)
+ *   - chain_len:  serial dependency depth per branch
+ *   - fanout:     number of independent branches (parallel width)
+ *   - aic_period: submit every aic_period-th task on AIC (0 = AIV only)
+ *
+ * Memory layout:
+ *   a: [fanout, tile_size, tile_size]   (flattened)
+ *   f: [fanout, tile_size, tile_size]   (flattened)
+ *
+ * Arg layout: [a, f, config]
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "pto_orchestration_api.h"  // NOLINT(build/include_subdir)
+
+#define FUNC_TILE_INC_AIV 0
+#define FUNC_TILE_INC_AIC 1
+
+extern "C" {
+
+__attribute__((visibility("default"))) PTO2OrchestrationConfig
+aicpu_orchestration_config(const ChipStorageTaskArgs &orch_args) {
+    (void)orch_args;  // NOLINT(readability/casting)
+    return PTO2OrchestrationConfig{
+        .expected_arg_count = 3,
+    };
+}
+
+__attribute__((visibility("default"))) void aicpu_orchestration_entry(const ChipStorageTaskArgs &orch_args) {
+    Tensor ext_a = from_tensor_arg(orch_args.tensor(0));
+    Tensor ext_f = from_tensor_arg(orch_args.tensor(1));
+    Tensor ext_config = from_tensor_arg(orch_args.tensor(2));
+
+    // Read config from tensor data: [tile_size, chain_len, fanout, aic_period]
+    int64_t *host_config = orch_args.tensor(2).data_as<int64_t>();
+    int tile_size = static_cast<int>(host_config[0]);
+    int chain_len = static_cast<int>(host_config[1]);
+    int fanout = static_cast<int>(host_config[2]);
+    int aic_period = static_cast<int>(host_config[3]);
+    uint64_t tile_elems = static_cast<uint64_t>(tile_size) * tile_size;
+
+    LOG_INFO(
+        "[perf_dag_orch] tile_size: %d, chain_len: %d, fanout: %d, aic_period: %d", tile_size, chain_len, fanout,
+        aic_period
+    );
+
+    uint32_t tile_shapes[1] = {static_cast<uint32_t>(tile_elems)};
+    TensorCreateInfo tile_ci(tile_shapes, 1, DataType::FLOAT32);
+
+    int total_aiv = 0;
+    int total_aic = 0;
+    int task_idx = 0;
+
+    for (int branch = 0; branch < fanout; branch++) {
+        PTO2_SCOPE_GUARD();
+
+        uint32_t branch_offsets[1] = {static_cast<uint32_t>(static_cast<uint64_t>(branch) * tile_elems)};
+        Tensor cur = ext_a.view(tile_shapes, branch_offsets);
+        Tensor f_view = ext_f.view(tile_shapes, branch_offsets);
+
+        for (int stage = 0; stage < chain_len; stage++) {
+            bool on_aic = aic_period > 0 && (task_idx % aic_period) == 0;
+            bool last_stage = stage == chain_len - 1;
+            task_idx++;
+
+            Arg params;
+            params.add_input(cur);
+            if (last_stage) {
+                params.add_output(f_view);
+            } else {
+                params.add_output(tile_ci);
+            }
+            params.add_input(ext_config);
+
+            TaskOutputTensors outs = on_aic ? pto2_rt_submit_aic_task(FUNC_TILE_INC_AIC, params)
+                                            : pto2_rt_submit_aiv_task(FUNC_TILE_INC_AIV, params);
+            if (on_aic) {
+                total_aic++;
+            } else {
+                total_aiv++;
+            }
+            if (!last_stage) {
+                cur = outs.get_ref(0);
+            }
+        }
+    }
+
+    LOG_INFO(
+        "[perf_dag_orch] Submitted %d aiv tasks and %d aic tasks (%d total)", total_aiv, total_aic,
+        total_aiv + total_aic
+    );
+}
+
+}  // extern "C"
@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""Synthetic end-to-end scheduling latency scenes.
+
+Each case materializes a parameterized DAG — ``fanout`` independent branches
+of ``chain_len`` serial tile-increment tasks, optionally interleaving AIC
+tasks every ``aic_period``-th submit — and checks f = a + chain_len. The
+kernels are deliberately trivial so wall time is dominated by submit,
+dependency resolution, and dispatch: the case axes isolate serial depth
+(chain sweep), parallel width (fanout sweep), per-task data size (tile
+sweep), and mixed AIC/AIV dispatch.
+
+Every case carries a ``perf`` block evaluated by the framework after the
+rounds loop (see ``SceneTestCase._check_case_perf``). Baselines start empty,
+so the check is report-only: run with ``--rounds 5`` on a quiet machine,
+read the ``[perf]`` log lines, and record ``baseline_ms`` per platform to
+arm the regression gate.
+"""
+
+import torch
+from simpler.task_interface import ArgDirection as D
+
+from simpler_setup import SceneTestCase, TaskArgsBuilder, Tensor, scene_test
+
+
+def _dag_case(name, chain_len, fanout, tile_size=128, aic_period=0, manual=False, baseline_ms=None):
+    return {
+        "name": name,
+        "manual": manual,
+        "platforms": ["a2a3sim", "a2a3"],
+        "config": {"aicpu_thread_num": 4, "block_dim": 24},
+        "params": {"chain_len": chain_len, "fanout": fanout, "tile_size": tile_size, "aic_period": aic_period},
+        "perf": {"baseline_ms": baseline_ms or {}, "threshold": 0.25, "warmup_rounds": 1},
+    }
+
+
+@scene_test(level=2, runtime="tensormap_and_ringbuffer")
+class TestPerfScenes(SceneTestCase):
+    """f = a + chain_len over a chain_len x fanout increment DAG."""
+
+    CALLABLE = {
+        "orchestration": {
+            "source": "kernels/orchestration/perf_dag_orch.cpp",
+            "function_name": "aicpu_orchestration_entry",
+            "signature": [D.IN, D.OUT, D.IN],
+        },
+        "incores": [
+            {
+                "func_id": 0,
+                "name": "INC_AIV",
+                "source": "kernels/aiv/kernel_tile_inc.cpp",
+                "core_type": "aiv",
+                "signature": [D.IN, D.OUT],
+            },
+            {
+                "func_id": 1,
+                "name": "INC_AIC",
+                "source": "kernels/aic/kernel_tile_inc_scalar.cpp",
+                "core_type": "aic",
+                "signature": [D.IN, D.OUT],
+            },
+        ],
+    }
+
+    CASES = [
+        # Serial depth: latency per dependency hop.
+        _dag_case("chain1_fan8", chain_len=1, fanout=8),
+        _dag_case("chain8_fan8", chain_len=8, fanout=8),
+        _dag_case("chain32_fan8", chain_len=32, fanout=8, manual=True),
+        # Parallel width: scheduler throughput with no serialization.
+        _dag_case("chain4_fan1", chain_len=4, fanout=1),
+        _dag_case("chain4_fan16", chain_len=4, fanout=16),
+        _dag_case("chain4_fan64", chain_len=4, fanout=64, manual=True),
+        # Per-task data size: same DAG shape, smaller/larger tiles.
+        _dag_case("chain8_fan8_tile32", chain_len=8, fanout=8, tile_size=32),
+        _dag_case("chain8_fan8_tile64", chain_len=8, fanout=8, tile_size=64),
+        # Mixed AIC/AIV: every aic_period-th task goes to the cube queue.
+        _dag_case("chain8_fan8_aic2", chain_len=8, fanout=8, aic_period=2),
+        _dag_case("chain8_fan8_aic4", chain_len=8, fanout=8, aic_period=4, manual=True),
+    ]
+
+    def generate_args(self, params):
+        tile_size = params["tile_size"]
+        fanout = params["fanout"]
+        size = fanout * tile_size * tile_size
+        config = torch.tensor(
+            [tile_size, params["chain_len"], fanout, params["aic_period"]], dtype=torch.int64
+        )
+        return TaskArgsBuilder(
+            Tensor("a", torch.randn(size, dtype=torch.float32)),
+            Tensor("f", torch.zeros(size, dtype=torch.float32)),
+            Tensor("config", config),
+        )
+
+    def compute_golden(self, args, params):
+        args.f[:] = args.a + params["chain_len"]
+
+
+if __name__ == "__main__":
+    SceneTestCase.run_module(__name__)
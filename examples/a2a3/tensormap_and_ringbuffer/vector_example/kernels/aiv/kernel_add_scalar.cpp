@@ -36,6 +36,11 @@ using namespace pto;
 #define __aicore__ [aicore]  // NOLINT(whitespace/braces)
 #endif
 
+// Defined by the generated arg stub; empty fallback for standalone builds.
+#ifndef PTO_RESTRICT
+#define PTO_RESTRICT
+#endif
+
 /**
  * Scalar addition kernel implementation
  *
@@ -47,14 +52,11 @@ using namespace pto;
  *              args[3] = size (number of elements)
  */
 extern "C" __aicore__ __attribute__((always_inline)) void kernel_entry(__gm__ int64_t *args) {
-    // Unpack arguments (Tensor* pointers from runtime)
-    __gm__ Tensor *src_tensor = reinterpret_cast<__gm__ Tensor *>(args[0]);
-    __gm__ Tensor *out_tensor = reinterpret_cast<__gm__ Tensor *>(args[1]);
-    __gm__ float *src = reinterpret_cast<__gm__ float *>(src_tensor->buffer.addr) + src_tensor->start_offset;
-    __gm__ float *out = reinterpret_cast<__gm__ float *>(out_tensor->buffer.addr) + out_tensor->start_offset;
-
-    // Convert scalar from uint64_t to float
-    float scalar = from_u64<float>(static_cast<uint64_t>(args[2]));
+    // Unpack arguments via the generated marshalling stub (PTO_ARG_* macros
+    // emitted by kernel_compiler.py from this kernel's "args" schema)
+    __gm__ float *PTO_RESTRICT src = PTO_ARG_SRC(args);
+    __gm__ float *PTO_RESTRICT out = PTO_ARG_OUT(args);
+    float scalar = PTO_ARG_SCALAR(args);
 
     // Configuration: float, 128, 128, 128, 128
     constexpr int kTRows_ = 128;
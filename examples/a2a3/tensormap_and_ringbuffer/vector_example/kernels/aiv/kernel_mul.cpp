@@ -34,6 +34,11 @@ using namespace pto;
 #define __aicore__ [aicore]
 #endif
 
+// Defined by the generated arg stub; empty fallback for standalone builds.
+#ifndef PTO_RESTRICT
+#define PTO_RESTRICT
+#endif
+
 /**
  * Element-wise multiplication kernel implementation
  *
@@ -45,13 +50,11 @@ using namespace pto;
  *              args[3] = size (number of elements)
  */
 extern "C" __aicore__ __attribute__((always_inline)) void kernel_entry(__gm__ int64_t *args) {
-    // Unpack arguments (Tensor* pointers from runtime)
-    __gm__ Tensor *src0_tensor = reinterpret_cast<__gm__ Tensor *>(args[0]);
-    __gm__ Tensor *src1_tensor = reinterpret_cast<__gm__ Tensor *>(args[1]);
-    __gm__ Tensor *out_tensor = reinterpret_cast<__gm__ Tensor *>(args[2]);
-    __gm__ float *src0 = reinterpret_cast<__gm__ float *>(src0_tensor->buffer.addr) + src0_tensor->start_offset;
-    __gm__ float *src1 = reinterpret_cast<__gm__ float *>(src1_tensor->buffer.addr) + src1_tensor->start_offset;
-    __gm__ float *out = reinterpret_cast<__gm__ float *>(out_tensor->buffer.addr) + out_tensor->start_offset;
+    // Unpack arguments via the generated marshalling stub (PTO_ARG_* macros
+    // emitted by kernel_compiler.py from this kernel's "args" schema)
+    __gm__ float *PTO_RESTRICT src0 = PTO_ARG_SRC0(args);
+    __gm__ float *PTO_RESTRICT src1 = PTO_ARG_SRC1(args);
+    __gm__ float *PTO_RESTRICT out = PTO_ARG_OUT(args);
 
     // Configuration: float, 128, 128, 128, 128
     constexpr int kTRows_ = 128;
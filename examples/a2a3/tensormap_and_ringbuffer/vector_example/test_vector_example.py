@@ -26,23 +26,47 @@ class TestVectorExample(SceneTestCase):
             "signature": [D.IN, D.IN, D.OUT],
         },
         "incores": [
+            # "args" drives the generated marshalling stub: the kernel
+            # prologue unpacks via PTO_ARG_* macros emitted per func_id at
+            # compile time instead of hand-written reinterpret_cast chains.
+            # "build_profile" selects per-kernel optimization knobs; the
+            # unified int64_t* entry signature hides aliasing, so these
+            # element-wise kernels opt into restrict-qualified arg pointers.
             {
                 "func_id": 0,
                 "source": "kernels/aiv/kernel_add.cpp",
                 "core_type": "aiv",
                 "signature": [D.IN, D.IN, D.OUT],
+                "args": [
+                    {"name": "src0", "kind": "tensor", "ctype": "float"},
+                    {"name": "src1", "kind": "tensor", "ctype": "float"},
+                    {"name": "out", "kind": "tensor", "ctype": "float"},
+                ],
+                "build_profile": {"restrict_args": True},
             },
             {
                 "func_id": 1,
                 "source": "kernels/aiv/kernel_add_scalar.cpp",
                 "core_type": "aiv",
                 "signature": [D.IN, D.OUT],
+                "args": [
+                    {"name": "src", "kind": "tensor", "ctype": "float"},
+                    {"name": "out", "kind": "tensor", "ctype": "float"},
+                    {"name": "scalar", "kind": "scalar", "ctype": "float"},
+                ],
+                "build_profile": {"restrict_args": True},
             },
             {
                 "func_id": 2,
                 "source": "kernels/aiv/kernel_mul.cpp",
                 "core_type": "aiv",
                 "signature": [D.IN, D.IN, D.OUT],
+                "args": [
+                    {"name": "src0", "kind": "tensor", "ctype": "float"},
+                    {"name": "src1", "kind": "tensor", "ctype": "float"},
+                    {"name": "out", "kind": "tensor", "ctype": "float"},
+                ],
+                "build_profile": {"restrict_args": True},
             },
         ],
     }
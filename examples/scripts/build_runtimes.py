@@ -72,6 +72,7 @@ def build_all(
     lib_dir: Path,
     cache_dir: Path,
     platforms: Optional[list] = None,
+    pgo_mode: Optional[str] = None,
 ) -> None:
     """Build all runtime variants for the given platforms.
 
@@ -79,6 +80,8 @@ def build_all(
         lib_dir: Final binary output directory (lib/).
         cache_dir: Persistent cmake build directory (build/cache/).
         platforms: List of platform strings. None = auto-detect.
+        pgo_mode: Optional PGO step for the AICPU target ("generate" or
+            "use"); see RuntimeBuilder.get_binaries for the pipeline.
     """
     # Override default paths to respect CLI args
     RuntimeBuilder._LIB_DIR = lib_dir
@@ -118,7 +121,7 @@ def build_all(
         for runtime_name in runtimes:
             logger.info(f"  Building {platform}/{runtime_name}...")
             try:
-                builder.get_binaries(runtime_name, build=True)
+                builder.get_binaries(runtime_name, build=True, pgo_mode=pgo_mode)
             except Exception as e:
                 logger.error(f"  Failed to build {platform}/{runtime_name}: {e}")
                 raise
@@ -143,6 +146,13 @@ def main():
         nargs="*",
         help="Platforms to build (default: auto-detect)",
     )
+    parser.add_argument(
+        "--pgo",
+        choices=["generate", "use"],
+        help="PGO pipeline step for the AICPU target: 'generate' builds "
+        "instrumented runtimes, 'use' rebuilds with captured profiles "
+        "(run a representative workload in between)",
+    )
     parser.add_argument(
         "--list",
         action="store_true",
@@ -171,6 +181,7 @@ def main():
         lib_dir=args.lib_dir,
         cache_dir=args.cache_dir,
         platforms=args.platforms,
+        pgo_mode=args.pgo,
     )
 
 
@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""I-cache size report for PTO2_ICACHE_SPLIT builds.
+
+Sums the .text.pto2_hot / .text.pto2_cold code sections across the AICPU
+object files of a build and checks the hot (steady-state scheduler loop)
+footprint against the AICPU L1 I-cache. Run it on the persistent cmake
+cache after building with PTO2_ICACHE_SPLIT=1 in the runtime's
+_COMMON_DEFINES (see src/{arch}/runtime/{runtime}/build_config.py).
+
+The report reads .o files, not the linked .so: the default linker script
+folds .text.pto2_* input sections back into .text, so the split is only
+visible pre-link (the grouping itself survives — same-named input sections
+stay contiguous in the output).
+
+Usage:
+    python examples/scripts/icache_report.py build/cache/a2a3/release/tensormap_and_ringbuffer
+    python examples/scripts/icache_report.py path/to/aicpu_executor.o --icache-kb 32
+"""
+
+import argparse
+import subprocess
+import sys
+from pathlib import Path
+
+# Cortex-A55 L1 instruction cache (per AICPU core).
+DEFAULT_ICACHE_KB = 32
+
+HOT_SECTION = ".text.pto2_hot"
+COLD_SECTION = ".text.pto2_cold"
+
+
+def section_sizes(obj: Path) -> dict[str, int]:
+    """Return {section_name: total_bytes} for the code sections of one object."""
+    result = subprocess.run(
+        ["readelf", "-S", "-W", str(obj)], check=True, capture_output=True, text=True
+    )
+    sizes: dict[str, int] = {}
+    for line in result.stdout.splitlines():
+        # "  [12] .text.pto2_hot  PROGBITS  <addr> <off> <size> ..."
+        fields = line.split("]", 1)[-1].split()
+        if len(fields) < 5 or fields[1] != "PROGBITS":
+            continue
+        name = fields[0]
+        if name == ".text" or name.startswith(".text."):
+            sizes[name] = sizes.get(name, 0) + int(fields[4], 16)
+    return sizes
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument(
+        "path",
+        type=Path,
+        help="Object file, or a build directory searched recursively for *.o",
+    )
+    parser.add_argument(
+        "--icache-kb",
+        type=int,
+        default=DEFAULT_ICACHE_KB,
+        help=f"L1 I-cache budget for the hot section (default {DEFAULT_ICACHE_KB} KB)",
+    )
+    args = parser.parse_args()
+
+    objects = [args.path] if args.path.is_file() else sorted(args.path.rglob("*.o"))
+    if not objects:
+        print(f"No object files found under {args.path}", file=sys.stderr)
+        return 1
+
+    totals: dict[str, int] = {}
+    per_object: list[tuple[Path, int]] = []
+    for obj in objects:
+        sizes = section_sizes(obj)
+        for name, size in sizes.items():
+            totals[name] = totals.get(name, 0) + size
+        if HOT_SECTION in sizes:
+            per_object.append((obj, sizes[HOT_SECTION]))
+
+    hot = totals.get(HOT_SECTION, 0)
+    cold = totals.get(COLD_SECTION, 0)
+    other = sum(s for n, s in totals.items() if n not in (HOT_SECTION, COLD_SECTION))
+
+    if hot == 0 and cold == 0:
+        print(
+            "No .text.pto2_hot/.text.pto2_cold sections found — build with "
+            "PTO2_ICACHE_SPLIT=1 (and pass .o files, not the linked .so)."
+        )
+        return 1
+
+    budget = args.icache_kb * 1024
+    print(f"{HOT_SECTION}:  {hot:8d} B  ({hot / 1024:.1f} KB)")
+    print(f"{COLD_SECTION}: {cold:8d} B  ({cold / 1024:.1f} KB)")
+    print(f"other .text*:     {other:8d} B  ({other / 1024:.1f} KB)")
+    for obj, size in per_object:
+        print(f"  {obj}: hot {size} B")
+    print()
+    if hot <= budget:
+        print(f"OK: steady-state loop fits the {args.icache_kb} KB I-cache ({100.0 * hot / budget:.0f}% used)")
+        return 0
+    print(f"OVER BUDGET: hot section exceeds the {args.icache_kb} KB I-cache by {hot - budget} B")
+    return 2
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Nanobind bindings for the columnar perf query library (PerfRunData).
+ *
+ * Compiled into the same _task_interface extension module as task_interface.cpp.
+ * Call bind_perf_query(m) from the NB_MODULE definition in task_interface.cpp.
+ *
+ * Columns are exposed as zero-copy 1-D numpy views into the loaded run: the
+ * PerfRunData python object is passed as the ndarray owner, so the arrays
+ * keep it alive and no data is copied. filter() results are materialized
+ * index arrays and own their storage.
+ */
+
+#pragma once
+
+#include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
+#include <nanobind/stl/string.h>
+#include <nanobind/stl/vector.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "host/perf_query.h"
+
+namespace nb = nanobind;
+
+namespace perf_query_bind_detail {
+
+/** Zero-copy 1-D view of a loaded column; `owner` keeps the run alive. */
+template <typename T>
+nb::ndarray<nb::numpy, const T, nb::ndim<1>> column_view(const std::vector<T> &column, nb::handle owner) {
+    return nb::ndarray<nb::numpy, const T, nb::ndim<1>>(column.data(), {column.size()}, owner);
+}
+
+/** Hand a freshly computed vector to numpy, transferring ownership. */
+template <typename T>
+nb::ndarray<nb::numpy, T, nb::ndim<1>> owned_array(std::vector<T> &&values) {
+    auto *vec = new std::vector<T>(std::move(values));
+    nb::capsule owner(vec, [](void *p) noexcept { delete static_cast<std::vector<T> *>(p); });
+    return nb::ndarray<nb::numpy, T, nb::ndim<1>>(vec->data(), {vec->size()}, owner);
+}
+
+}  // namespace perf_query_bind_detail
+
+inline void bind_perf_query(nb::module_ &m) {
+    using perf_query_bind_detail::column_view;
+    using perf_query_bind_detail::owned_array;
+
+    nb::class_<PerfGroupStats>(m, "PerfGroupStats")
+        .def_ro("key", &PerfGroupStats::key)
+        .def_ro("count", &PerfGroupStats::count)
+        .def_ro("total_duration", &PerfGroupStats::total_duration)
+        .def_ro("min_duration", &PerfGroupStats::min_duration)
+        .def_ro("max_duration", &PerfGroupStats::max_duration)
+        .def("__repr__", [](const PerfGroupStats &s) {
+            return "PerfGroupStats(key=" + std::to_string(s.key) + ", count=" + std::to_string(s.count) +
+                   ", total=" + std::to_string(s.total_duration) + ")";
+        });
+
+    nb::class_<PerfRunData>(m, "PerfRunData")
+        .def(nb::init<>())
+        .def(
+            "load",
+            [](PerfRunData &self, const std::string &path) {
+                if (self.load(path) != 0) {
+                    throw std::runtime_error("PerfRunData: cannot load record stream: " + path);
+                }
+            },
+            nb::arg("path"), "Load a finalized SIMPLER_PERF_MMAP_STREAM record stream file.")
+        .def("__len__", &PerfRunData::size)
+        .def_prop_ro("task_id",
+                     [](nb::handle_t<PerfRunData> self) {
+                         return column_view(nb::cast<PerfRunData &>(self).task_id(), self);
+                     })
+        .def_prop_ro("start_time",
+                     [](nb::handle_t<PerfRunData> self) {
+                         return column_view(nb::cast<PerfRunData &>(self).start_time(), self);
+                     })
+        .def_prop_ro("end_time",
+                     [](nb::handle_t<PerfRunData> self) {
+                         return column_view(nb::cast<PerfRunData &>(self).end_time(), self);
+                     })
+        .def_prop_ro("duration",
+                     [](nb::handle_t<PerfRunData> self) {
+                         return column_view(nb::cast<PerfRunData &>(self).duration(), self);
+                     })
+        .def_prop_ro("dispatch_time",
+                     [](nb::handle_t<PerfRunData> self) {
+                         return column_view(nb::cast<PerfRunData &>(self).dispatch_time(), self);
+                     })
+        .def_prop_ro("finish_time",
+                     [](nb::handle_t<PerfRunData> self) {
+                         return column_view(nb::cast<PerfRunData &>(self).finish_time(), self);
+                     })
+        .def_prop_ro("func_id",
+                     [](nb::handle_t<PerfRunData> self) {
+                         return column_view(nb::cast<PerfRunData &>(self).func_id(), self);
+                     })
+        .def_prop_ro("core_id",
+                     [](nb::handle_t<PerfRunData> self) {
+                         return column_view(nb::cast<PerfRunData &>(self).core_id(), self);
+                     })
+        .def_prop_ro("core_type",
+                     [](nb::handle_t<PerfRunData> self) {
+                         return column_view(nb::cast<PerfRunData &>(self).core_type(), self);
+                     })
+        .def_prop_ro("pmu_cache_miss",
+                     [](nb::handle_t<PerfRunData> self) {
+                         return column_view(nb::cast<PerfRunData &>(self).pmu_cache_miss(), self);
+                     })
+        .def_prop_ro("pmu_bus_access",
+                     [](nb::handle_t<PerfRunData> self) {
+                         return column_view(nb::cast<PerfRunData &>(self).pmu_bus_access(), self);
+                     })
+        .def_prop_ro("fanout_count",
+                     [](nb::handle_t<PerfRunData> self) {
+                         return column_view(nb::cast<PerfRunData &>(self).fanout_count(), self);
+                     })
+        .def(
+            "filter",
+            [](const PerfRunData &self, int64_t func_id, int64_t core_id, int64_t core_type,
+               uint64_t start_after, uint64_t end_before) {
+                return owned_array(self.filter_indices(func_id, core_id, core_type, start_after, end_before));
+            },
+            nb::arg("func_id") = -1, nb::arg("core_id") = -1, nb::arg("core_type") = -1,
+            nb::arg("start_after") = 0, nb::arg("end_before") = 0,
+            "Row indices matching the given predicates (-1/0 = no bound), in start_time order.")
+        .def("group_by_func", &PerfRunData::group_by_func,
+             "Per-kernel duration stats, sorted by descending total_duration.")
+        .def("group_by_core", &PerfRunData::group_by_core, "Per-core duration stats, sorted by core index.")
+        .def(
+            "percentile",
+            [](const PerfRunData &self, double q) { return self.duration_percentile(q); }, nb::arg("q"),
+            "Duration percentile over all rows (nearest-rank).")
+        .def(
+            "percentile",
+            [](const PerfRunData &self, double q,
+               nb::ndarray<const uint64_t, nb::ndim<1>, nb::c_contig> rows) {
+                std::vector<uint64_t> selection(rows.data(), rows.data() + rows.shape(0));
+                return self.duration_percentile(q, selection);
+            },
+            nb::arg("q"), nb::arg("rows"), "Duration percentile over a row selection from filter().");
+}
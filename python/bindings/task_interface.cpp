@@ -18,6 +18,7 @@
  */
 
 #include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/tuple.h>
 #include <nanobind/stl/vector.h>
@@ -32,13 +33,110 @@
 #include "arg_direction.h"
 #include "callable.h"
 #include "chip_worker.h"
+#include "pto_runtime_c_api.h"
 #include "data_type.h"
+#include "ipc_session.h"
+#include "multi_chip_worker.h"
+#include "step_graph_runner.h"
+#include "perf_query_bind.h"
 #include "worker_bind.h"
 #include "task_args.h"
+#include "task_args_schema.h"
 #include "tensor_arg.h"
 
 namespace nb = nanobind;
 
+// ============================================================================
+// Zero-copy array ingestion
+// ============================================================================
+
+namespace {
+
+/// Any CPU-resident, C-contiguous buffer reachable through the buffer
+/// protocol or dlpack (numpy, torch CPU tensors, ...). Read-only arrays are
+/// accepted: the runtime only sees a raw pointer either way, so writability
+/// of OUTPUT buffers is the caller's responsibility, same as make(data=ptr).
+using CpuArray = nb::ndarray<nb::ro, nb::c_contig, nb::device::cpu>;
+
+DataType dtype_from_dlpack(nb::dlpack::dtype dt) {
+    if (dt.lanes == 1) {
+        switch (static_cast<nb::dlpack::dtype_code>(dt.code)) {
+            case nb::dlpack::dtype_code::Float:
+                if (dt.bits == 32) return DataType::FLOAT32;
+                if (dt.bits == 16) return DataType::FLOAT16;
+                break;
+            case nb::dlpack::dtype_code::Bfloat:
+                if (dt.bits == 16) return DataType::BFLOAT16;
+                break;
+            case nb::dlpack::dtype_code::Int:
+                if (dt.bits == 64) return DataType::INT64;
+                if (dt.bits == 32) return DataType::INT32;
+                if (dt.bits == 16) return DataType::INT16;
+                if (dt.bits == 8) return DataType::INT8;
+                break;
+            case nb::dlpack::dtype_code::UInt:
+                if (dt.bits == 64) return DataType::UINT64;
+                if (dt.bits == 8) return DataType::UINT8;
+                break;
+            default:
+                break;
+        }
+    }
+    throw std::invalid_argument(
+        "array dtype has no DataType equivalent (code=" + std::to_string(dt.code) +
+        ", bits=" + std::to_string(dt.bits) + ", lanes=" + std::to_string(dt.lanes) + ")"
+    );
+}
+
+nb::dlpack::dtype dlpack_from_dtype(DataType dt) {
+    auto make = [](nb::dlpack::dtype_code code, uint8_t bits) {
+        nb::dlpack::dtype out;
+        out.code = static_cast<uint8_t>(code);
+        out.bits = bits;
+        out.lanes = 1;
+        return out;
+    };
+    switch (dt) {
+        case DataType::FLOAT32:
+            return make(nb::dlpack::dtype_code::Float, 32);
+        case DataType::FLOAT16:
+            return make(nb::dlpack::dtype_code::Float, 16);
+        case DataType::BFLOAT16:
+            return make(nb::dlpack::dtype_code::Bfloat, 16);
+        case DataType::INT64:
+            return make(nb::dlpack::dtype_code::Int, 64);
+        case DataType::INT32:
+            return make(nb::dlpack::dtype_code::Int, 32);
+        case DataType::INT16:
+            return make(nb::dlpack::dtype_code::Int, 16);
+        case DataType::INT8:
+            return make(nb::dlpack::dtype_code::Int, 8);
+        case DataType::UINT8:
+            return make(nb::dlpack::dtype_code::UInt, 8);
+        case DataType::UINT64:
+            return make(nb::dlpack::dtype_code::UInt, 64);
+    }
+    throw std::invalid_argument("DataType has no dlpack equivalent");
+}
+
+/// Build a ContinuousTensor view on the array's buffer without copying.
+/// The caller must keep the array alive while the view is in flight.
+ContinuousTensor tensor_from_array(const CpuArray &array) {
+    if (array.ndim() > CONTINUOUS_TENSOR_MAX_DIMS)
+        throw std::invalid_argument(
+            "array ndim exceeds CONTINUOUS_TENSOR_MAX_DIMS (" + std::to_string(CONTINUOUS_TENSOR_MAX_DIMS) + ")"
+        );
+    ContinuousTensor arg{};
+    arg.data = reinterpret_cast<uint64_t>(array.data());
+    arg.dtype = dtype_from_dlpack(array.dtype());
+    arg.ndims = static_cast<uint32_t>(array.ndim());
+    for (size_t i = 0; i < array.ndim(); ++i)
+        arg.shapes[i] = static_cast<uint32_t>(array.shape(i));
+    return arg;
+}
+
+}  // namespace
+
 // ============================================================================
 // Module definition
 // ============================================================================
@@ -99,6 +197,51 @@ NB_MODULE(_task_interface, m) {
             "allocated by the child process (skips H2D copy in init_runtime_impl)."
         )
 
+        .def_static(
+            "from_array",
+            [](const CpuArray &array) -> ContinuousTensor {
+                return tensor_from_array(array);
+            },
+            nb::arg("array"),
+            "Create a zero-copy view on a CPU array (numpy/dlpack, C-contiguous). "
+            "Shape and dtype are translated; the buffer is referenced, not copied — "
+            "keep the array alive while the tensor is in flight."
+        )
+
+        .def(
+            "to_array",
+            [](nb::handle_t<ContinuousTensor> self_h) {
+                const ContinuousTensor &self = nb::cast<const ContinuousTensor &>(self_h);
+                if (self.dtype == DataType::BFLOAT16)
+                    throw std::invalid_argument("numpy has no bfloat16; use to_dlpack() instead");
+                size_t shape[CONTINUOUS_TENSOR_MAX_DIMS] = {};
+                for (uint32_t i = 0; i < self.ndims; ++i) shape[i] = self.shapes[i];
+                return nb::ndarray<nb::numpy>(
+                    reinterpret_cast<void *>(self.data), self.ndims, shape, self_h, nullptr,
+                    dlpack_from_dtype(self.dtype)
+                );
+            },
+            "Zero-copy numpy view over the tensor's memory. Only valid for "
+            "host-mappable buffers (Orchestrator.alloc / MAP_SHARED heaps); the "
+            "memory must stay alive while the array is in use."
+        )
+
+        .def(
+            "to_dlpack",
+            [](nb::handle_t<ContinuousTensor> self_h) {
+                const ContinuousTensor &self = nb::cast<const ContinuousTensor &>(self_h);
+                size_t shape[CONTINUOUS_TENSOR_MAX_DIMS] = {};
+                for (uint32_t i = 0; i < self.ndims; ++i) shape[i] = self.shapes[i];
+                return nb::ndarray<>(
+                    reinterpret_cast<void *>(self.data), self.ndims, shape, self_h, nullptr,
+                    dlpack_from_dtype(self.dtype)
+                );
+            },
+            "Zero-copy dlpack export (object with __dlpack__, e.g. for "
+            "torch.from_dlpack); supports bfloat16. Only valid for host-mappable "
+            "buffers — consumers read the memory in place, no host staging copy."
+        )
+
         .def_prop_rw(
             "data",
             [](const ContinuousTensor &self) -> uint64_t {
@@ -267,6 +410,17 @@ NB_MODULE(_task_interface, m) {
             "Add a ContinuousTensor with an optional TensorArgType tag (default INPUT)."
         )
 
+        .def(
+            "add_array",
+            [](TaskArgs &self, const CpuArray &array, TensorArgType tag) {
+                self.add_tensor(tensor_from_array(array), tag);
+            },
+            nb::arg("array"), nb::arg("tag") = TensorArgType::INPUT,
+            "Add a CPU array (numpy/dlpack, C-contiguous) as a zero-copy tensor view. "
+            "Equivalent to add_tensor(ContinuousTensor.from_array(array), tag) without "
+            "the intermediate Python object; the caller keeps the array alive."
+        )
+
         .def(
             "add_scalar", &TaskArgs::add_scalar, nb::arg("s"),
             "Add a uint64_t scalar. After this, add_tensor() is no longer allowed."
@@ -321,6 +475,64 @@ NB_MODULE(_task_interface, m) {
             "Return total number of arguments (tensors + scalars)."
         );
 
+    // --- TaskArgsSchema (precompiled arg layout for repeated identical calls) ---
+    nb::class_<TaskArgsSchema>(m, "TaskArgsSchema")
+        .def(
+            nb::init<const TaskArgs &>(), nb::arg("prototype"),
+            "Compile shapes, dtypes, tags, and scalars once from a prototype TaskArgs. "
+            "Fast-path calls then only overwrite data pointers / scalar values."
+        )
+
+        .def(
+            "set_data", &TaskArgsSchema::set_tensor_data, nb::arg("i"), nb::arg("data"),
+            "Overwrite tensor i's data pointer in the prebuilt blocks. No layout "
+            "check — the buffer must match the compiled shape and dtype."
+        )
+
+        .def(
+            "set_array",
+            [](TaskArgsSchema &self, int32_t i, const CpuArray &array) {
+                if (i < 0 || i >= self.tensor_count())
+                    throw std::out_of_range("TaskArgsSchema: tensor index " + std::to_string(i) + " out of range");
+                ContinuousTensor t = tensor_from_array(array);
+                const ContinuousTensor &proto = self.args().tensor(i);
+                bool matches = t.dtype == proto.dtype && t.ndims == proto.ndims;
+                for (uint32_t d = 0; matches && d < t.ndims; ++d) matches = t.shapes[d] == proto.shapes[d];
+                if (!matches)
+                    throw std::invalid_argument(
+                        "TaskArgsSchema: array layout differs from compiled tensor " + std::to_string(i)
+                    );
+                self.set_tensor_data(i, t.data);
+            },
+            nb::arg("i"), nb::arg("array"),
+            "Checked variant of set_data: verify the CPU array matches the compiled "
+            "shape/dtype for tensor i, then write its data pointer (zero-copy)."
+        )
+
+        .def(
+            "set_scalar", &TaskArgsSchema::set_scalar, nb::arg("i"), nb::arg("value"),
+            "Overwrite scalar i in the prebuilt blocks."
+        )
+
+        .def("tensor_count", &TaskArgsSchema::tensor_count)
+        .def("scalar_count", &TaskArgsSchema::scalar_count)
+
+        .def_prop_ro(
+            "args",
+            [](const TaskArgsSchema &self) -> const TaskArgs & {
+                return self.args();
+            },
+            nb::rv_policy::reference_internal, "Prebuilt TaskArgs for Orchestrator.submit_* calls."
+        )
+
+        .def(
+            "storage_ptr",
+            [](const TaskArgsSchema &self) -> uint64_t {
+                return reinterpret_cast<uint64_t>(&self.chip_storage());
+            },
+            "Address of the prebuilt ChipStorageTaskArgs POD; pass to _ChipWorker.run_raw."
+        );
+
     // --- ArgDirection enum ---
     nb::enum_<ArgDirection>(m, "ArgDirection")
         .value("SCALAR", ArgDirection::SCALAR)
@@ -568,19 +780,96 @@ NB_MODULE(_task_interface, m) {
     nb::class_<ChipWorker>(m, "_ChipWorker")
         .def(nb::init<>())
         .def(
-            "init", &ChipWorker::init, nb::arg("host_lib_path"), nb::arg("aicpu_path"), nb::arg("aicore_path"),
-            nb::arg("sim_context_lib_path") = ""
+            "init", &ChipWorker::init, nb::call_guard<nb::gil_scoped_release>(), nb::arg("host_lib_path"),
+            nb::arg("aicpu_path"), nb::arg("aicore_path"), nb::arg("sim_context_lib_path") = "",
+            nb::arg("enable_launch_trace") = false
+        )
+        .def(
+            "set_device", &ChipWorker::set_device, nb::call_guard<nb::gil_scoped_release>(), nb::arg("device_id")
         )
-        .def("set_device", &ChipWorker::set_device, nb::arg("device_id"))
-        .def("reset_device", &ChipWorker::reset_device)
-        .def("finalize", &ChipWorker::finalize)
+        .def("reset_device", &ChipWorker::reset_device, nb::call_guard<nb::gil_scoped_release>())
+        .def("finalize", &ChipWorker::finalize, nb::call_guard<nb::gil_scoped_release>())
         .def(
             "run",
             [](ChipWorker &self, const PyChipCallable &callable, ChipStorageTaskArgs &args,
                const ChipCallConfig &config) {
                 self.run(callable.buffer_.data(), &args, config);
             },
-            nb::arg("callable"), nb::arg("args"), nb::arg("config")
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("callable"), nb::arg("args"), nb::arg("config"),
+            "Run synchronously (releases GIL for the duration of the device call)."
+        )
+        .def(
+            "run_async",
+            [](ChipWorker &self, const PyChipCallable &callable, ChipStorageTaskArgs &args,
+               const ChipCallConfig &config) { return self.run_async(callable.buffer_.data(), &args, config); },
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("callable"), nb::arg("args"), nb::arg("config"),
+            "Enqueue a run on the submit pipeline and return a completion handle. "
+            "The callable must stay alive until the handle completes. Blocks when "
+            "the pipeline is full."
+        )
+        .def(
+            "wait", &ChipWorker::wait, nb::call_guard<nb::gil_scoped_release>(), nb::arg("handle"),
+            "Wait for a run_async handle; raises if that run failed."
+        )
+        .def(
+            "wait_all", &ChipWorker::wait_all, nb::call_guard<nb::gil_scoped_release>(),
+            "Wait for all outstanding run_async handles."
+        )
+        .def(
+            "set_completion_callback",
+            [](ChipWorker &self, nb::object cb) {
+                if (cb.is_none()) {
+                    self.set_completion_callback(nullptr);
+                    return;
+                }
+                self.set_completion_callback([cb_stored = nb::object(cb)](uint64_t handle, bool success) {
+                    nb::gil_scoped_acquire gil;
+                    cb_stored(handle, success);
+                });
+            },
+            nb::arg("callback").none(),
+            "Register callback(handle, success) invoked on the submit thread (with "
+            "the GIL acquired) after each run_async completes; the handle is already "
+            "waitable at that point. asyncio frontends should hop back to their loop "
+            "via loop.call_soon_threadsafe. Set before the first run_async and do "
+            "not change while runs are in flight; None clears it."
+        )
+        .def(
+            "warm_up", &ChipWorker::warm_up, nb::call_guard<nb::gil_scoped_release>(),
+            "Pre-pay cold-start costs (page faults, streams, pipeline flush) so the "
+            "first run performs like steady state. Returns False when the runtime SO "
+            "does not support warm-up; runs work either way."
+        )
+        .def(
+            "health_snapshot",
+            [](ChipWorker &self) -> nb::object {
+                PtoHealthMetrics m = {};
+                bool ok;
+                {
+                    nb::gil_scoped_release release;
+                    ok = self.health_snapshot(m);
+                }
+                if (!ok) {
+                    return nb::none();
+                }
+                nb::dict d;
+                d["publish_count"] = m.publish_count;
+                d["alloc_stall_samples"] = m.alloc_stall_samples;
+                d["publish_sys_cnt"] = m.publish_sys_cnt;
+                d["sys_cnt_freq_hz"] = m.sys_cnt_freq_hz;
+                d["tasks_completed"] = m.tasks_completed;
+                d["tasks_per_sec"] = m.tasks_per_sec;
+                d["dispatch_latency_ewma_ticks"] = m.dispatch_latency_ewma_ticks;
+                d["ring_tasks_live"] = m.ring_tasks_live;
+                d["heap_bytes_live"] = m.heap_bytes_live;
+                d["orch_error_code"] = m.orch_error_code;
+                d["sched_error_code"] = m.sched_error_code;
+                return d;
+            },
+            "Snapshot the scheduler's always-on health block (tasks/sec, dispatch "
+            "latency EWMA, ring occupancy, stall samples, error codes) as a dict. "
+            "Safe from any thread while a run is in flight; returns None when no "
+            "run is active or the runtime SO publishes no health metrics."
         )
         .def(
             "run_raw",
@@ -592,8 +881,9 @@ NB_MODULE(_task_interface, m) {
                 config.enable_profiling = enable_profiling;
                 self.run(reinterpret_cast<const void *>(callable), reinterpret_cast<const void *>(args), config);
             },
-            nb::arg("callable"), nb::arg("args"), nb::arg("block_dim") = 1, nb::arg("aicpu_thread_num") = 3,
-            nb::arg("enable_profiling") = false, "Run with a raw ChipStorageTaskArgs POD pointer."
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("callable"), nb::arg("args"), nb::arg("block_dim") = 1,
+            nb::arg("aicpu_thread_num") = 3, nb::arg("enable_profiling") = false,
+            "Run with a raw ChipStorageTaskArgs POD pointer."
         )
         .def(
             "run_from_blob",
@@ -606,8 +896,8 @@ NB_MODULE(_task_interface, m) {
                 TaskArgsView view = read_blob(reinterpret_cast<const uint8_t *>(blob_ptr));
                 self.run(callable, view, config);
             },
-            nb::arg("callable"), nb::arg("blob_ptr"), nb::arg("block_dim") = 1, nb::arg("aicpu_thread_num") = 3,
-            nb::arg("enable_profiling") = false,
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("callable"), nb::arg("blob_ptr"),
+            nb::arg("block_dim") = 1, nb::arg("aicpu_thread_num") = 3, nb::arg("enable_profiling") = false,
             "Decode a length-prefixed TaskArgs blob ([T][S][tensors][scalars]) at "
             "blob_ptr and dispatch to the runtime. Used from forked chip processes "
             "reading the WorkerThread mailbox."
@@ -615,10 +905,184 @@ NB_MODULE(_task_interface, m) {
         .def_prop_ro("device_id", &ChipWorker::device_id)
         .def_prop_ro("initialized", &ChipWorker::initialized)
         .def_prop_ro("device_set", &ChipWorker::device_set)
-        .def("malloc", &ChipWorker::malloc, nb::arg("size"))
-        .def("free", &ChipWorker::free, nb::arg("ptr"))
-        .def("copy_to", &ChipWorker::copy_to, nb::arg("dst"), nb::arg("src"), nb::arg("size"))
-        .def("copy_from", &ChipWorker::copy_from, nb::arg("dst"), nb::arg("src"), nb::arg("size"));
+        .def("malloc", &ChipWorker::malloc, nb::call_guard<nb::gil_scoped_release>(), nb::arg("size"))
+        .def(
+            "free", &ChipWorker::free, nb::call_guard<nb::gil_scoped_release>(), nb::arg("ptr"),
+            nb::arg("reuse") = false,
+            "Free device memory. reuse=True parks the buffer for the next "
+            "malloc of the identical size (no driver round-trip)."
+        )
+        .def(
+            "malloc_many", &ChipWorker::malloc_many, nb::call_guard<nb::gil_scoped_release>(), nb::arg("sizes"),
+            "Allocate N buffers from one driver reservation; free them via "
+            "free/free_many (last carve releases the slab)."
+        )
+        .def(
+            "free_many", &ChipWorker::free_many, nb::call_guard<nb::gil_scoped_release>(), nb::arg("ptrs"),
+            "Free a batch of buffers; slab carves coalesce into one driver "
+            "release per exhausted slab."
+        )
+        .def(
+            "copy_to", &ChipWorker::copy_to, nb::call_guard<nb::gil_scoped_release>(), nb::arg("dst"), nb::arg("src"),
+            nb::arg("size")
+        )
+        .def(
+            "copy_from", &ChipWorker::copy_from, nb::call_guard<nb::gil_scoped_release>(), nb::arg("dst"),
+            nb::arg("src"), nb::arg("size")
+        );
+
+    // --- MultiChipWorker ---
+    nb::class_<MultiChipWorker>(m, "_MultiChipWorker")
+        .def(nb::init<>())
+        .def(
+            "init", &MultiChipWorker::init, nb::call_guard<nb::gil_scoped_release>(), nb::arg("host_lib_path"),
+            nb::arg("aicpu_path"), nb::arg("aicore_path"), nb::arg("device_ids"), nb::arg("sim_context_lib_path") = "",
+            "Bind the runtime and claim one ChipWorker per device id."
+        )
+        .def("finalize", &MultiChipWorker::finalize, nb::call_guard<nb::gil_scoped_release>())
+        .def(
+            "run",
+            [](MultiChipWorker &self, const PyChipCallable &callable, std::vector<ChipStorageTaskArgs *> &args,
+               const ChipCallConfig &config) {
+                std::vector<const void *> slices(args.begin(), args.end());
+                self.run(callable.buffer_.data(), slices.data(), slices.size(), config);
+            },
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("callable"), nb::arg("args"), nb::arg("config"),
+            "Broadcast one callable with per-device arg slices (one per device). "
+            "Returns once every device has the run queued; call drain() to join."
+        )
+        .def(
+            "drain", &MultiChipWorker::drain, nb::call_guard<nb::gil_scoped_release>(),
+            "Wait for all broadcast runs on all devices; raises with every failed device."
+        )
+        .def_prop_ro("device_count", &MultiChipWorker::device_count)
+        .def_prop_ro("initialized", &MultiChipWorker::initialized)
+        .def(
+            "malloc", [](MultiChipWorker &self, size_t index, size_t size) { return self.worker(index).malloc(size); },
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("index"), nb::arg("size"),
+            "Allocate device memory on device `index`."
+        )
+        .def(
+            "free", [](MultiChipWorker &self, size_t index, uint64_t ptr) { self.worker(index).free(ptr); },
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("index"), nb::arg("ptr")
+        )
+        .def(
+            "copy_to",
+            [](MultiChipWorker &self, size_t index, uint64_t dst, uint64_t src, size_t size) {
+                self.worker(index).copy_to(dst, src, size);
+            },
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("index"), nb::arg("dst"), nb::arg("src"), nb::arg("size")
+        )
+        .def(
+            "copy_from",
+            [](MultiChipWorker &self, size_t index, uint64_t dst, uint64_t src, size_t size) {
+                self.worker(index).copy_from(dst, src, size);
+            },
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("index"), nb::arg("dst"), nb::arg("src"), nb::arg("size")
+        );
+
+    // --- StepGraphRunner (native loop over a declared step graph) ---
+    nb::class_<StepGraphRunner>(m, "_StepGraphRunner")
+        .def(
+            nb::init<ChipWorker *>(), nb::arg("worker"), nb::keep_alive<1, 2>(),
+            "Native executor: declare (callable, TaskArgsSchema, config) steps once, "
+            "then run(n) executes all iterations in C++ with per-iteration patches."
+        )
+        .def(
+            "add_step",
+            [](StepGraphRunner &self, const PyChipCallable &callable, TaskArgsSchema &schema,
+               const ChipCallConfig &config) -> int32_t {
+                return self.add_step(callable.buffer_.data(), &schema, config);
+            },
+            nb::arg("callable"), nb::arg("schema"), nb::arg("config"), nb::keep_alive<1, 2>(), nb::keep_alive<1, 3>(),
+            "Append a step (executed in declaration order each iteration); returns "
+            "the step index for patch rules. The callable and schema are pinned to "
+            "the runner's lifetime."
+        )
+        .def(
+            "add_tensor_patch", &StepGraphRunner::add_tensor_patch, nb::arg("step"), nb::arg("tensor_index"),
+            nb::arg("base"), nb::arg("stride"),
+            "Each iteration i, write base + i*stride into the tensor's data pointer "
+            "(stride 0 = bind once)."
+        )
+        .def(
+            "add_scalar_patch", &StepGraphRunner::add_scalar_patch, nb::arg("step"), nb::arg("scalar_index"),
+            nb::arg("base"), nb::arg("stride"),
+            "Each iteration i, write base + i*stride into the scalar slot."
+        )
+        .def(
+            "run", &StepGraphRunner::run, nb::call_guard<nb::gil_scoped_release>(), nb::arg("iterations"),
+            "Execute all iterations without touching Python between steps; runs go "
+            "through the ChipWorker submit pipeline and are joined before returning."
+        )
+        .def("step_count", &StepGraphRunner::step_count)
+        .def_prop_ro("steps_executed", &StepGraphRunner::steps_executed);
+
+    // --- IPC session (share one device session across Python processes) ---
+    nb::class_<IpcSessionBroker>(m, "_IpcSessionBroker")
+        .def(nb::init<>())
+        .def(
+            "start",
+            [](IpcSessionBroker &self, const std::string &name, ChipWorker &worker) {
+                self.start(name, &worker);
+            },
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("name"), nb::arg("worker"), nb::keep_alive<1, 3>(),
+            "Create shm segment `name` and serve client requests against `worker` "
+            "on a background thread. The worker stays owned by this process."
+        )
+        .def(
+            "stop", &IpcSessionBroker::stop, nb::call_guard<nb::gil_scoped_release>(),
+            "Fail pending client waits, stop serving, and unlink the segment."
+        )
+        .def_prop_ro("running", &IpcSessionBroker::is_running)
+        .def_prop_ro("served_count", &IpcSessionBroker::served_count);
+
+    nb::class_<IpcSessionClient>(m, "_IpcSessionClient")
+        .def(nb::init<>())
+        .def(
+            "connect", &IpcSessionClient::connect, nb::call_guard<nb::gil_scoped_release>(), nb::arg("name"),
+            "Attach to a broker's segment; raises when it is missing or dead."
+        )
+        .def("close", &IpcSessionClient::close)
+        .def_prop_ro("connected", &IpcSessionClient::connected)
+        .def(
+            "ping", &IpcSessionClient::ping, nb::call_guard<nb::gil_scoped_release>(),
+            "Round trip through the broker without touching the device."
+        )
+        .def(
+            "register_callable",
+            [](IpcSessionClient &self, const PyChipCallable &callable) -> uint64_t {
+                return self.register_callable(callable.buffer_.data(), callable.buffer_.size());
+            },
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("callable"),
+            "Upload a ChipCallable to the broker; returns the id to pass to run()."
+        )
+        .def(
+            "run",
+            [](IpcSessionClient &self, uint64_t callable_id, const TaskArgs &args, const ChipCallConfig &config) {
+                self.run(callable_id, args, config);
+            },
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("callable_id"), nb::arg("args"), nb::arg("config"),
+            "Run on the broker's device session and wait for completion."
+        )
+        .def("malloc", &IpcSessionClient::malloc, nb::call_guard<nb::gil_scoped_release>(), nb::arg("size"))
+        .def("free", &IpcSessionClient::free, nb::call_guard<nb::gil_scoped_release>(), nb::arg("ptr"))
+        .def(
+            "copy_to",
+            [](IpcSessionClient &self, uint64_t dst, uint64_t src, size_t size) {
+                self.copy_to(dst, reinterpret_cast<const void *>(src), size);
+            },
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("dst"), nb::arg("src"), nb::arg("size"),
+            "Copy host src bytes to broker device dst (chunked through the ring)."
+        )
+        .def(
+            "copy_from",
+            [](IpcSessionClient &self, uint64_t dst, uint64_t src, size_t size) {
+                self.copy_from(reinterpret_cast<void *>(dst), src, size);
+            },
+            nb::call_guard<nb::gil_scoped_release>(), nb::arg("dst"), nb::arg("src"), nb::arg("size"),
+            "Copy broker device src bytes to host dst (chunked through the ring)."
+        );
 
     // --- Standalone blob helpers ---
     m.def(
@@ -640,4 +1104,5 @@ NB_MODULE(_task_interface, m) {
     );
 
     bind_worker(m);
+    bind_perf_query(m);
 }
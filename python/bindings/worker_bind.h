@@ -96,6 +96,68 @@ inline void bind_worker(nb::module_ &m) {
             nb::arg("callable_id"), nb::arg("args_list"),
             "Submit a group of SUB tasks: N args -> N workers, 1 DAG node."
         )
+        .def(
+            "submit_next_level_batch",
+            [](Orchestrator &self, uint64_t callable, nb::sequence args_list, const ChipCallConfig &config,
+               int8_t worker) {
+                std::vector<const TaskArgs *> items;
+                items.reserve(nb::len(args_list));
+                for (nb::handle h : args_list) items.push_back(nb::cast<const TaskArgs *>(h));
+                std::vector<SubmitResult> results;
+                results.reserve(items.size());
+                nb::gil_scoped_release release;
+                for (const TaskArgs *args : items) results.push_back(self.submit_next_level(callable, *args, config, worker));
+                return results;
+            },
+            nb::arg("callable"), nb::arg("args_list"), nb::arg("config"), nb::arg("worker") = int8_t(-1),
+            "Submit N independent NEXT_LEVEL tasks in one call. Unlike "
+            "submit_next_level_group (1 DAG node), each args gets its own node; the "
+            "list is converted once and the GIL is released for the submit loop."
+        )
+        .def(
+            "submit_sub_batch",
+            [](Orchestrator &self, int32_t callable_id, nb::sequence args_list) {
+                std::vector<const TaskArgs *> items;
+                items.reserve(nb::len(args_list));
+                for (nb::handle h : args_list) items.push_back(nb::cast<const TaskArgs *>(h));
+                std::vector<SubmitResult> results;
+                results.reserve(items.size());
+                nb::gil_scoped_release release;
+                for (const TaskArgs *args : items) results.push_back(self.submit_sub(callable_id, *args));
+                return results;
+            },
+            nb::arg("callable_id"), nb::arg("args_list"),
+            "Submit N independent SUB tasks in one call. Unlike submit_sub_group "
+            "(1 DAG node), each args gets its own node; the list is converted once "
+            "and the GIL is released for the submit loop."
+        )
+        .def(
+            "register_callable",
+            [](Orchestrator &self, uint64_t callable, const ChipCallConfig &config) {
+                return self.register_callable(callable, config);
+            },
+            nb::arg("callable"), nb::arg("config") = ChipCallConfig{},
+            "Register a NEXT_LEVEL callable (+config) once; returns a dense id "
+            "for submit_registered. Ids survive drain()."
+        )
+        .def(
+            "submit_registered",
+            [](Orchestrator &self, int32_t id, const TaskArgs &args, int8_t worker) {
+                return self.submit_registered(id, args, worker);
+            },
+            nb::arg("id"), nb::arg("args"), nb::arg("worker") = int8_t(-1),
+            "Submit a NEXT_LEVEL task by registered callable id; the pointer and "
+            "config come from the registry entry."
+        )
+        .def(
+            "submit_registered_group",
+            [](Orchestrator &self, int32_t id, const std::vector<TaskArgs> &args_list,
+               const std::vector<int8_t> &workers) {
+                return self.submit_registered_group(id, args_list, workers);
+            },
+            nb::arg("id"), nb::arg("args_list"), nb::arg("workers") = std::vector<int8_t>{},
+            "Submit a group of NEXT_LEVEL tasks by registered callable id."
+        )
         .def(
             "malloc",
             [](Orchestrator &self, int worker_id, size_t size) {
@@ -124,6 +186,23 @@ inline void bind_worker(nb::module_ &m) {
             },
             nb::arg("worker_id"), nb::arg("dst"), nb::arg("src"), nb::arg("size"), "Copy worker src to host dst."
         )
+        .def(
+            "copy_between",
+            [](Orchestrator &self, int dst_worker_id, uint64_t dst, int src_worker_id, uint64_t src, size_t size) {
+                self.copy_between(dst_worker_id, dst, src_worker_id, src, size);
+            },
+            nb::arg("dst_worker_id"), nb::arg("dst"), nb::arg("src_worker_id"), nb::arg("src"), nb::arg("size"),
+            "Copy between two workers' memories: direct device-to-device when the "
+            "platform supports it, staged through host otherwise."
+        )
+        .def(
+            "transfer_stats",
+            [](Orchestrator &self) {
+                const TransferStats &s = self.transfer_stats();
+                return std::make_tuple(s.d2d_transfers, s.d2d_bytes, s.staged_transfers, s.staged_bytes);
+            },
+            "copy_between() counters: (d2d_transfers, d2d_bytes, staged_transfers, staged_bytes)."
+        )
         .def(
             "alloc",
             [](Orchestrator &self, const std::vector<uint32_t> &shape, DataType dtype) {
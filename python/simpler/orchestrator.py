@@ -93,6 +93,37 @@ class Orchestrator:
         w = [int(x) for x in workers] if workers else []
         return self._o.submit_next_level_group(_resolve_callable_ptr(callable_), args_list, cfg, w)
 
+    def submit_next_level_batch(
+        self, callable_: Any, args_list: list, config: Optional[ChipCallConfig] = None, *, worker: int = -1
+    ):
+        """Submit N independent NEXT_LEVEL tasks with one GIL crossing.
+
+        Unlike :meth:`submit_next_level_group` (1 DAG node), each args gets
+        its own DAG node — same semantics as a Python loop of
+        ``submit_next_level``, minus the per-call marshalling.
+        """
+        cfg = config if config is not None else ChipCallConfig()
+        return self._o.submit_next_level_batch(_resolve_callable_ptr(callable_), args_list, cfg, int(worker))
+
+    def register_callable(self, callable_: Any, config: Optional[ChipCallConfig] = None) -> int:
+        """Register a NEXT_LEVEL callable (+config) once; returns a dense id.
+
+        ``submit_registered`` then submits by id — the pointer and config
+        live in the C++ registry, so steady-state loops pass one integer
+        per call. Ids survive ``drain``/``Worker.run`` boundaries.
+        """
+        cfg = config if config is not None else ChipCallConfig()
+        return int(self._o.register_callable(_resolve_callable_ptr(callable_), cfg))
+
+    def submit_registered(self, id: int, args: TaskArgs, *, worker: int = -1):
+        """Submit a NEXT_LEVEL task by id from :meth:`register_callable`."""
+        return self._o.submit_registered(int(id), args, int(worker))
+
+    def submit_registered_group(self, id: int, args_list: list, *, workers: Optional[list] = None):
+        """Submit a group of NEXT_LEVEL tasks by registered callable id."""
+        w = [int(x) for x in workers] if workers else []
+        return self._o.submit_registered_group(int(id), args_list, w)
+
     def submit_sub(self, callable_id: int, args: Optional[TaskArgs] = None):
         """Submit a SUB task by registered callable id.
 
@@ -106,6 +137,15 @@ class Orchestrator:
         """Submit a group of SUB tasks (N TaskArgs → N workers, 1 DAG node)."""
         return self._o.submit_sub_group(int(callable_id), args_list)
 
+    def submit_sub_batch(self, callable_id: int, args_list: list):
+        """Submit N independent SUB tasks with one GIL crossing.
+
+        Unlike :meth:`submit_sub_group` (1 DAG node), each args gets its own
+        DAG node — same semantics as a Python loop of ``submit_sub``, minus
+        the per-call marshalling.
+        """
+        return self._o.submit_sub_batch(int(callable_id), args_list)
+
     # ------------------------------------------------------------------
     # Nested scope (Strict-1 per-scope rings)
     # ------------------------------------------------------------------
@@ -28,11 +28,15 @@ from _task_interface import (  # pyright: ignore[reportMissingImports]
     DataType,
     SubmitResult,
     TaskArgs,
+    TaskArgsSchema,
     TaskState,
     TensorArgType,
     WorkerType,
     _ChipWorker,
+    _IpcSessionBroker,
+    _IpcSessionClient,
     _Orchestrator,
+    _StepGraphRunner,
     _Worker,
     arg_direction_name,
     get_dtype_name,
@@ -49,6 +53,7 @@ __all__ = [
     "ChipStorageTaskArgs",
     "TensorArgType",
     "TaskArgs",
+    "TaskArgsSchema",
     "ArgDirection",
     "CoreCallable",
     "ChipCallable",
@@ -64,6 +69,9 @@ __all__ = [
     "_Orchestrator",
     "SubmitResult",
     "_Worker",
+    "_IpcSessionBroker",
+    "_IpcSessionClient",
+    "_StepGraphRunner",
     "MAILBOX_SIZE",
     "read_args_from_blob",
 ]
@@ -101,11 +109,17 @@ def torch_dtype_to_datatype(dt) -> DataType:
 
 
 def make_tensor_arg(tensor) -> ContinuousTensor:
-    """Create a ``ContinuousTensor`` from a torch.Tensor.
+    """Create a ``ContinuousTensor`` from a torch.Tensor (or any CPU array).
 
-    The tensor must be CPU-contiguous. Its ``data_ptr()``, shape, and dtype
-    are read and stored in the returned ``ContinuousTensor``.
+    The tensor must be CPU-contiguous. The fast path hands the object to
+    ``ContinuousTensor.from_array`` (zero-copy, one dlpack exchange instead of
+    per-field Python attribute access); objects dlpack can't ingest fall back
+    to reading ``data_ptr()``, shape, and dtype individually.
     """
+    try:
+        return ContinuousTensor.from_array(tensor)
+    except TypeError:
+        pass
     _ensure_torch_map()
     dt = _TORCH_DTYPE_MAP.get(tensor.dtype)  # pyright: ignore[reportOptionalMemberAccess]
     if dt is None:
@@ -213,9 +227,25 @@ class ChipWorker:
         """Allocate memory. Returns a pointer (uint64)."""
         return int(self._impl.malloc(int(size)))
 
-    def free(self, ptr):
-        """Free memory allocated by ``malloc()``."""
-        self._impl.free(int(ptr))
+    def free(self, ptr, reuse=False):
+        """Free memory allocated by ``malloc()``.
+
+        ``reuse=True`` parks the buffer for the next ``malloc()`` of the
+        identical size, skipping the driver round-trip.
+        """
+        self._impl.free(int(ptr), bool(reuse))
+
+    def malloc_many(self, sizes):
+        """Allocate N buffers from one driver reservation.
+
+        Returns a list of pointers. Free them with ``free()``/``free_many()``;
+        the backing reservation is released when the last one is freed.
+        """
+        return [int(p) for p in self._impl.malloc_many([int(s) for s in sizes])]
+
+    def free_many(self, ptrs):
+        """Free a batch of buffers in one call (slab-aware)."""
+        self._impl.free_many([int(p) for p in ptrs])
 
     def copy_to(self, dst, src, size):
         """Copy *size* bytes from host *src* to worker *dst*."""
@@ -94,6 +94,26 @@ class KernelCompiler:
             str(self.platform_dir / "include"),  # For common headers like core_type.h
         ]
 
+    def get_incore_include_dirs(self) -> list[str]:
+        """
+        Get include directories for AICore kernel compilation.
+
+        Kernels may include platform AICore headers such as
+        aicore/performance_collector_aicore.h (intra-kernel phase markers),
+        which in turn pull in the variant-specific inner_kernel.h for the
+        get_sys_cnt_aicore() timestamp source. The variant directory
+        (onboard/ on hardware, sim/ on simulation) is selected here so
+        kernel sources stay platform-agnostic.
+
+        Returns:
+            List of include directory paths
+        """
+        variant = "sim" if self.platform.endswith("sim") else "onboard"
+        return [
+            str(self.platform_dir / "include"),
+            str(self.platform_dir / variant / "aicore"),
+        ]
+
     def get_orchestration_include_dirs(self, runtime_name: str) -> list[str]:
         """
         Get all include directories needed for orchestration compilation.
@@ -118,21 +138,23 @@ class KernelCompiler:
         runtime_dir = str(self.project_root / "src" / arch / "runtime" / runtime_name / "runtime")
         runtime_common_dir = str(self.project_root / "src" / arch / "runtime" / runtime_name / "common")
         common_dir = str(self.project_root / "src" / "common" / "task_interface")
-        return [runtime_dir, runtime_common_dir, common_dir] + self.get_platform_include_dirs()
+        runtime_core_dir = str(self.project_root / "src" / "common" / "runtime_core")
+        return [runtime_dir, runtime_common_dir, common_dir, runtime_core_dir] + self.get_platform_include_dirs()
 
-    def _get_orchestration_config(self, runtime_name: str) -> tuple[list[str], list[str]]:
+    def _get_orchestration_config(self, runtime_name: str) -> tuple[list[str], list[str], list[str]]:
         """
         Load the optional "orchestration" section from a runtime's build_config.py.
 
         If the runtime has an "orchestration" key in its BUILD_CONFIG, returns
-        the resolved include dirs and discovered source files.  Otherwise returns
-        empty lists (backward-compatible for runtimes without the section).
+        the resolved include dirs, discovered source files, and compile defines.
+        Otherwise returns empty lists (backward-compatible for runtimes without
+        the section).
 
         Args:
             runtime_name: Name of the runtime (e.g., "tensormap_and_ringbuffer")
 
         Returns:
-            (include_dirs, source_files) — both as absolute paths, or ([], [])
+            (include_dirs, source_files, defines) — paths absolute, or ([], [], [])
         """
         # Map platform to runtime architecture
         if self.platform in ("a2a3", "a2a3sim"):
@@ -144,18 +166,18 @@ class KernelCompiler:
 
         config_path = self.project_root / "src" / arch / "runtime" / runtime_name / "build_config.py"
         if not config_path.is_file():
-            return [], []
+            return [], [], []
 
         spec = importlib.util.spec_from_file_location("build_config", str(config_path))
         if spec is None or spec.loader is None:
-            return [], []
+            return [], [], []
         mod = importlib.util.module_from_spec(spec)
         spec.loader.exec_module(mod)
         build_config = getattr(mod, "BUILD_CONFIG", {})
 
         orch_cfg = build_config.get("orchestration")
         if orch_cfg is None:
-            return [], []
+            return [], [], []
 
         config_dir = config_path.parent
 
@@ -169,7 +191,9 @@ class KernelCompiler:
                     if f.suffix in (".cpp", ".c") and f.is_file():
                         source_files.append(str(f))
 
-        return include_dirs, source_files
+        defines = list(orch_cfg.get("defines", []))
+
+        return include_dirs, source_files, defines
 
     def _run_subprocess(
         self, cmd: list[str], label: str, error_hint: str = "Compiler not found"
@@ -255,6 +279,112 @@ class KernelCompiler:
         os.close(fd)
         return path
 
+    _ARG_STUB_INTEGRAL_CTYPES = frozenset(
+        {"int8_t", "uint8_t", "int16_t", "uint16_t", "int32_t", "uint32_t", "int64_t", "uint64_t", "int", "bool"}
+    )
+
+    _BUILD_PROFILE_KEYS = frozenset({"fast_math", "restrict_args", "unroll_loops"})
+
+    @classmethod
+    def _profile_compile_flags(cls, build_profile: Optional[dict]) -> list[str]:
+        """Translate a per-kernel build profile into extra compiler flags.
+
+        All keys are opt-in booleans, defaulting to off (today's flag set):
+        - fast_math: compile with -ffast-math. Only for kernels whose golden
+          tolerance absorbs reassociation/FMA contraction differences.
+        - unroll_loops: compile with -funroll-loops.
+        - restrict_args: no compiler flag; handled in _generate_arg_stub by
+          __restrict__-qualifying the generated arg pointer casts (the unified
+          __gm__ int64_t* signature otherwise defeats alias analysis).
+
+        Raises:
+            ValueError: If the profile contains unknown keys
+        """
+        if not build_profile:
+            return []
+        unknown = set(build_profile) - cls._BUILD_PROFILE_KEYS
+        if unknown:
+            raise ValueError(
+                f"Unknown build_profile keys: {sorted(unknown)} (expected subset of {sorted(cls._BUILD_PROFILE_KEYS)})"
+            )
+        flags = []
+        if build_profile.get("fast_math"):
+            flags.append("-ffast-math")
+        if build_profile.get("unroll_loops"):
+            flags.append("-funroll-loops")
+        return flags
+
+    def _generate_arg_stub(
+        self, arg_schema: list[dict], source_path: str, build_dir: Optional[str], restrict_args: bool = False
+    ) -> str:
+        """
+        Emit the per-func_id argument marshalling stub for one kernel.
+
+        Each declared argument becomes a PTO_ARG_<NAME>(args) macro performing
+        a typed load at its fixed args[] offset — tensor args additionally
+        resolve buffer.addr + start_offset to the typed data pointer — so the
+        kernel prologue is generated straight-line code instead of hand-written
+        reinterpret_cast chains that must be kept in sync with the submit site.
+
+        The stub is pure macros (no includes): names like Tensor, __gm__, and
+        from_u64 resolve at expansion inside the kernel, which already includes
+        tensor.h, so the stub can be force-included (-include) ahead of any
+        source on every toolchain.
+
+        Schema entries: {"name": <C identifier>, "kind": "tensor" | "scalar",
+        "ctype": <element/value type, default float/int64_t>}.
+
+        When restrict_args is set (build_profile {"restrict_args": True}),
+        tensor casts target __restrict__-qualified pointer types and the stub
+        defines PTO_RESTRICT as __restrict__ so kernel locals can carry the
+        qualifier too; otherwise PTO_RESTRICT expands to nothing, keeping
+        kernel sources profile-agnostic.
+
+        Returns:
+            Path to the generated header.
+        """
+        restrict_kw = "__restrict__" if restrict_args else ""
+        lines = [
+            f"/* Generated by kernel_compiler.py for {os.path.basename(source_path)}. Do not edit. */",
+            "#pragma once",
+            "",
+            f"#define PTO_RESTRICT {restrict_kw}".rstrip(),
+            "",
+        ]
+        for idx, arg in enumerate(arg_schema):
+            name = arg["name"]
+            if not name.isidentifier():
+                raise ValueError(f"arg_schema[{idx}]: invalid argument name {name!r}")
+            kind = arg.get("kind", "tensor")
+            macro = f"PTO_ARG_{name.upper()}"
+            if kind == "tensor":
+                ctype = arg.get("ctype", "float")
+                lines.append(f"/* args[{idx}]: tensor {name} ({ctype}) */")
+                lines.append(f"#define {macro}_TENSOR(args) (reinterpret_cast<__gm__ Tensor *>((args)[{idx}]))")
+                lines.append(
+                    f"#define {macro}(args) \\\n"
+                    f"    (reinterpret_cast<__gm__ {ctype} *PTO_RESTRICT>({macro}_TENSOR(args)->buffer.addr) + "
+                    f"{macro}_TENSOR(args)->start_offset)"
+                )
+            elif kind == "scalar":
+                ctype = arg.get("ctype", "int64_t")
+                lines.append(f"/* args[{idx}]: scalar {name} ({ctype}) */")
+                if ctype in self._ARG_STUB_INTEGRAL_CTYPES:
+                    lines.append(f"#define {macro}(args) (static_cast<{ctype}>((args)[{idx}]))")
+                else:
+                    # Non-integral scalars travel as raw bits in the int64 slot.
+                    lines.append(f"#define {macro}(args) (from_u64<{ctype}>(static_cast<uint64_t>((args)[{idx}])))")
+            else:
+                raise ValueError(f"arg_schema[{idx}]: unknown kind {kind!r} (expected 'tensor' or 'scalar')")
+            lines.append("")
+
+        stub_path = self._make_temp_path(
+            prefix=f"{os.path.basename(source_path)}.args_", suffix=".h", build_dir=build_dir
+        )
+        with open(stub_path, "w") as f:
+            f.write("\n".join(lines))
+        return stub_path
+
     def compile_incore(
         self,
         source_path: str,
@@ -262,6 +392,8 @@ class KernelCompiler:
         pto_isa_root: Optional[str] = None,
         extra_include_dirs: Optional[list[str]] = None,
         build_dir: Optional[str] = None,
+        arg_schema: Optional[list[dict]] = None,
+        build_profile: Optional[dict] = None,
     ) -> bytes:
         """
         Compile a kernel source file. Dispatches based on platform:
@@ -273,15 +405,26 @@ class KernelCompiler:
             core_type: Core type: "aic" (cube) or "aiv" (vector). Default: "aiv"
             pto_isa_root: Path to PTO-ISA root directory. Required for a2a3.
             extra_include_dirs: Additional include directories
+            arg_schema: Optional argument schema; when given, a generated
+                marshalling stub (PTO_ARG_* macros, see _generate_arg_stub)
+                is force-included ahead of the kernel source
+            build_profile: Optional per-kernel optimization profile
+                (see _profile_compile_flags); restrict_args requires arg_schema
 
         Returns:
             Binary contents of the compiled .o file
 
         Raises:
             FileNotFoundError: If source file or PTO-ISA headers not found
-            ValueError: If pto_isa_root is not provided (for a2a3) or core_type is invalid
+            ValueError: If pto_isa_root is not provided (for a2a3), core_type
+                is invalid, or build_profile is malformed
             RuntimeError: If compilation fails
         """
+        profile_flags = self._profile_compile_flags(build_profile)
+        restrict_args = bool(build_profile and build_profile.get("restrict_args"))
+        if restrict_args and not arg_schema:
+            raise ValueError("build_profile restrict_args requires an arg_schema (it qualifies the generated stub)")
+
         incore_toolchain = self._get_toolchain(
             {
                 "a2a3": ToolchainType.CCEC,
@@ -299,6 +442,8 @@ class KernelCompiler:
                 pto_isa_root=pto_isa_root,
                 extra_include_dirs=extra_include_dirs,
                 build_dir=build_dir,
+                arg_schema=arg_schema,
+                build_profile=build_profile,
             )
 
         # TOOLCHAIN_CCEC: continue with ccec compilation
@@ -319,13 +464,20 @@ class KernelCompiler:
         )
 
         # Build command from toolchain
-        cmd = [self.ccec.cxx_path] + self.ccec.get_compile_flags(core_type=core_type)
+        cmd = [self.ccec.cxx_path] + self.ccec.get_compile_flags(core_type=core_type) + profile_flags
         cmd.extend([f"-I{pto_include}", f"-I{pto_pto_include}"])
 
+        for inc_dir in self.get_incore_include_dirs():
+            cmd.append(f"-I{inc_dir}")
         if extra_include_dirs:
             for inc_dir in extra_include_dirs:
                 cmd.append(f"-I{os.path.abspath(inc_dir)}")
 
+        stub_path = None
+        if arg_schema:
+            stub_path = self._generate_arg_stub(arg_schema, source_path, build_dir, restrict_args=restrict_args)
+            cmd.extend(["-include", stub_path])
+
         cmd.extend(["-o", output_path, source_path])
 
         # Execute compilation
@@ -333,13 +485,17 @@ class KernelCompiler:
         logger.info(f"[Incore] Compiling ({core_type_name}): {source_path}")
         logger.debug(f"  Command: {' '.join(cmd)}")
 
-        return self._compile_to_bytes(
-            cmd,
-            output_path,
-            "Incore",
-            error_hint=f"ccec compiler not found at {self.ccec.cxx_path}",
-            delete_output=build_dir is None,
-        )
+        try:
+            return self._compile_to_bytes(
+                cmd,
+                output_path,
+                "Incore",
+                error_hint=f"ccec compiler not found at {self.ccec.cxx_path}",
+                delete_output=build_dir is None,
+            )
+        finally:
+            if stub_path is not None and build_dir is None:
+                os.unlink(stub_path)
 
     def compile_orchestration(
         self,
@@ -372,8 +528,8 @@ class KernelCompiler:
         if extra_include_dirs:
             include_dirs = include_dirs + list(extra_include_dirs)
 
-        # Load optional orchestration config for extra sources/includes
-        orch_includes, orch_sources = self._get_orchestration_config(runtime_name)
+        # Load optional orchestration config for extra sources/includes/defines
+        orch_includes, orch_sources, orch_defines = self._get_orchestration_config(runtime_name)
         if orch_includes:
             include_dirs = include_dirs + orch_includes
 
@@ -401,6 +557,7 @@ class KernelCompiler:
             toolchain,
             extra_include_dirs=include_dirs,
             extra_sources=orch_sources or None,
+            extra_defines=orch_defines or None,
             build_dir=build_dir,
         )
 
@@ -410,6 +567,7 @@ class KernelCompiler:
         toolchain: Union[GxxToolchain, Aarch64GxxToolchain],
         extra_include_dirs: Optional[list[str]] = None,
         extra_sources: Optional[list[str]] = None,
+        extra_defines: Optional[list[str]] = None,
         build_dir: Optional[str] = None,
     ) -> bytes:
         """Compile an orchestration function to a shared library (.so).
@@ -421,6 +579,8 @@ class KernelCompiler:
             toolchain: Resolved toolchain object (GxxToolchain or Aarch64GxxToolchain)
             extra_include_dirs: Additional include directories
             extra_sources: Additional source files to compile into the SO
+            extra_defines: "NAME=VALUE" compile definitions from build_config.py
+                           (must match the runtime targets' defines)
 
         Returns:
             Binary contents of the compiled .so file
@@ -453,6 +613,11 @@ class KernelCompiler:
             for inc_dir in extra_include_dirs:
                 cmd.append(f"-I{os.path.abspath(inc_dir)}")
 
+        # Add compile definitions (runtime variant selection)
+        if extra_defines:
+            for define in extra_defines:
+                cmd.append(f"-D{define}")
+
         # Output and input
         cmd.extend(["-o", output_path, source_path])
 
@@ -476,6 +641,8 @@ class KernelCompiler:
         pto_isa_root: Optional[str] = None,
         extra_include_dirs: Optional[list[str]] = None,
         build_dir: Optional[str] = None,
+        arg_schema: Optional[list[dict]] = None,
+        build_profile: Optional[dict] = None,
     ) -> bytes:
         """
         Compile a simulation kernel to .so/.dylib using g++-15.
@@ -485,6 +652,10 @@ class KernelCompiler:
             core_type: Core type: "aic" (cube) or "aiv" (vector).
             pto_isa_root: Path to PTO-ISA root directory (for PTO ISA headers)
             extra_include_dirs: Additional include directories
+            arg_schema: Optional argument schema for the generated marshalling
+                stub (see _generate_arg_stub)
+            build_profile: Optional per-kernel optimization profile
+                (see _profile_compile_flags)
 
         Returns:
             Binary contents of the compiled .so/.dylib file
@@ -505,6 +676,7 @@ class KernelCompiler:
 
         # Build command from toolchain
         cmd = [self.gxx15.cxx_path] + self.gxx15.get_compile_flags(core_type=core_type)
+        cmd.extend(self._profile_compile_flags(build_profile))
 
         # Add PTO ISA header paths if provided
         if pto_isa_root:
@@ -512,21 +684,34 @@ class KernelCompiler:
             pto_pto_include = os.path.join(pto_isa_root, "include", "pto")
             cmd.extend([f"-I{pto_include}", f"-I{pto_pto_include}"])
 
+        for inc_dir in self.get_incore_include_dirs():
+            cmd.append(f"-I{inc_dir}")
+
         # Add extra include directories if provided
         if extra_include_dirs:
             for inc_dir in extra_include_dirs:
                 cmd.append(f"-I{os.path.abspath(inc_dir)}")
 
+        stub_path = None
+        if arg_schema:
+            restrict_args = bool(build_profile and build_profile.get("restrict_args"))
+            stub_path = self._generate_arg_stub(arg_schema, source_path, build_dir, restrict_args=restrict_args)
+            cmd.extend(["-include", stub_path])
+
         cmd.extend(["-o", output_path, source_path])
 
         # Log compilation command
         logger.info(f"[SimKernel] Compiling: {source_path}")
         logger.debug(f"  Command: {' '.join(cmd)}")
 
-        return self._compile_to_bytes(
-            cmd,
-            output_path,
-            "SimKernel",
-            error_hint=f"{self.gxx15.cxx_path} not found. Please install g++-15.",
-            delete_output=build_dir is None,
-        )
+        try:
+            return self._compile_to_bytes(
+                cmd,
+                output_path,
+                "SimKernel",
+                error_hint=f"{self.gxx15.cxx_path} not found. Please install g++-15.",
+                delete_output=build_dir is None,
+            )
+        finally:
+            if stub_path is not None and build_dir is None:
+                os.unlink(stub_path)
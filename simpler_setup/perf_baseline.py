@@ -0,0 +1,125 @@
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""Performance regression baseline store.
+
+Holds recorded wall-time baselines for perf-gated scene cases (cases with a
+``perf`` block, see ``SceneTestCase._check_case_perf``) in one JSON file so
+regressions fail in review instead of shipping. Layout is arch/platform-first
+(mirroring ``platform_info`` discovery) with one entry per case label::
+
+    {
+      "a2a3": {
+        "a2a3sim": {
+          "TestPerfScenes::chain8_fan8": {
+            "baseline_ms": 12.4,
+            "threshold": 0.25,
+            "recorded": "2026-08-31",
+            "rounds": 5
+          }
+        }
+      }
+    }
+
+``threshold`` is the allowed fractional regression over ``baseline_ms``; when
+absent the case's own (or the framework default) threshold applies.
+
+The default store is ``tests/st/perf_baselines.json`` (checked in, reviewed
+like any other test expectation). Override with ``SIMPLER_PERF_BASELINE_FILE``.
+Set ``SIMPLER_PERF_BASELINE_UPDATE=1`` to re-record baselines from the current
+run's measurements — do this on quiet, representative hardware and commit the
+diff.
+"""
+
+from __future__ import annotations
+
+import json
+import logging
+import os
+from datetime import date
+from pathlib import Path
+
+from .environment import PROJECT_ROOT
+from .platform_info import parse_platform
+
+logger = logging.getLogger(__name__)
+
+DEFAULT_BASELINE_FILE = PROJECT_ROOT / "tests" / "st" / "perf_baselines.json"
+
+
+def baseline_file() -> Path:
+    override = os.environ.get("SIMPLER_PERF_BASELINE_FILE")
+    return Path(override) if override else DEFAULT_BASELINE_FILE
+
+
+def update_mode() -> bool:
+    return os.environ.get("SIMPLER_PERF_BASELINE_UPDATE", "0") not in ("0", "")
+
+
+def _load(path: Path) -> dict:
+    if not path.exists():
+        return {}
+    try:
+        with open(path, encoding="utf-8") as f:
+            return json.load(f)
+    except (OSError, json.JSONDecodeError) as e:
+        logger.warning(f"[perf] Cannot read baseline file {path}: {e}")
+        return {}
+
+
+def lookup(label: str, platform: str) -> dict | None:
+    """Return the stored baseline entry for ``label`` on ``platform``, or None."""
+    try:
+        arch, _variant = parse_platform(platform)
+    except ValueError:
+        return None
+    store = _load(baseline_file())
+    entry = store.get(arch, {}).get(platform, {}).get(label)
+    if entry is not None and "baseline_ms" not in entry:
+        logger.warning(f"[perf] Baseline entry for {label} on {platform} has no baseline_ms; ignoring")
+        return None
+    return entry
+
+
+def record(label: str, platform: str, best_ms: float, rounds: int, threshold: float | None = None) -> None:
+    """Write (or overwrite) the baseline for ``label`` on ``platform``."""
+    arch, _variant = parse_platform(platform)
+    path = baseline_file()
+    store = _load(path)
+    entry = store.setdefault(arch, {}).setdefault(platform, {}).setdefault(label, {})
+    entry["baseline_ms"] = round(best_ms, 4)
+    entry["recorded"] = date.today().isoformat()
+    entry["rounds"] = rounds
+    if threshold is not None:
+        entry["threshold"] = threshold
+    path.parent.mkdir(parents=True, exist_ok=True)
+    with open(path, "w", encoding="utf-8") as f:
+        json.dump(store, f, indent=2, sort_keys=True)
+        f.write("\n")
+    logger.info(f"[perf] Recorded baseline for {label} on {platform}: {best_ms:.3f} ms -> {path}")
+
+
+def compare(label: str, platform: str, best_ms: float, default_threshold: float) -> tuple[bool, str]:
+    """Compare a measurement against the stored baseline.
+
+    Returns ``(ok, message)``: ``ok`` is False only when a stored baseline
+    exists and ``best_ms`` exceeds it by more than the applicable threshold.
+    With no stored baseline the run passes in report-only mode.
+    """
+    entry = lookup(label, platform)
+    if entry is None:
+        return True, f"no stored baseline for {label} on {platform}; report-only"
+    baseline_ms = entry["baseline_ms"]
+    threshold = entry.get("threshold", default_threshold)
+    limit_ms = baseline_ms * (1.0 + threshold)
+    delta_pct = (best_ms - baseline_ms) * 100.0 / baseline_ms if baseline_ms > 0 else 0.0
+    detail = (
+        f"{best_ms:.3f} ms vs baseline {baseline_ms:.3f} ms ({delta_pct:+.1f}%, "
+        f"limit {limit_ms:.3f} ms, recorded {entry.get('recorded', '?')})"
+    )
+    return best_ms <= limit_ms, detail
@@ -90,11 +90,12 @@ class RuntimeBuilder:
             )
 
     def _resolve_target_dirs(self, config_dir: Path, build_config: dict, target: str):
-        """Resolve include and source dirs for a target from build_config."""
+        """Resolve include dirs, source dirs, and compile defines for a target from build_config."""
         cfg = build_config[target]
         include_dirs = [str((config_dir / p).resolve()) for p in cfg["include_dirs"]]
         source_dirs = [str((config_dir / p).resolve()) for p in cfg["source_dirs"]]
-        return include_dirs, source_dirs
+        defines = list(cfg.get("defines", []))
+        return include_dirs, source_dirs, defines
 
     def _lookup_binaries(self, name: str, output_dir: Path) -> RuntimeBinaries:
         """Look up pre-built binaries from output_dir.
@@ -138,28 +139,62 @@ class RuntimeBuilder:
             sim_context_path=sim_context_path,
         )
 
-    def get_binaries(self, name: str, build: bool = False) -> RuntimeBinaries:
+    def get_binaries(self, name: str, build: bool = False, pgo_mode: Optional[str] = None) -> RuntimeBinaries:
         """Return paths to compiled runtime binaries.
 
         By default, looks up pre-built binaries from build/lib/. When
         build=True, runs cmake configure + make using persistent build
         directories under build/cache/ for incremental compilation.
 
+        Profile-guided optimization of the AICPU scheduler (the dispatch loop
+        is branch-heavy, which is where PGO pays off) is a three-step
+        pipeline driven through pgo_mode:
+
+        1. ``get_binaries(name, build=True, pgo_mode="generate")`` — the
+           instrumented AICPU runtime lands in build/lib/ as usual; raw
+           profiles are written to build/cache/{arch}/{variant}/{name}/pgo/.
+        2. Run a representative workload against the instrumented build —
+           e.g. replay a captured submit stream (pto2_submit_trace_replay)
+           or the perf scene tests.
+        3. ``get_binaries(name, build=True, pgo_mode="use")`` — final build
+           optimized with the captured profiles, cached per runtime in
+           build/cache/{arch}/{variant}/{name}/pgo_use/.
+
         Args:
             name: Name of the runtime implementation (e.g. 'host_build_graph')
             build: If True, compile the runtime before returning paths.
                 If False (default), return pre-built binary paths.
+            pgo_mode: Optional PGO pipeline step for the AICPU target:
+                "generate" (instrumented build) or "use" (profile-optimized
+                build). Requires build=True.
 
         Returns:
             RuntimeBinaries with paths to host, aicpu, and aicore binaries.
 
         Raises:
-            FileNotFoundError: If build=False and pre-built binaries are missing.
+            FileNotFoundError: If build=False and pre-built binaries are
+                missing, or pgo_mode="use" without captured profiles.
         """
         self._validate_runtime(name)
 
         arch, variant = self._arch, self._variant
         output_dir = self._LIB_DIR / arch / variant / name
+        profile_dir = self._CACHE_DIR / arch / variant / name / "pgo"
+
+        if pgo_mode is not None:
+            if not build:
+                raise ValueError("pgo_mode requires build=True")
+            if pgo_mode == "generate":
+                profile_dir.mkdir(parents=True, exist_ok=True)
+            elif pgo_mode == "use":
+                if not any(profile_dir.rglob("*.gcda")):
+                    raise FileNotFoundError(
+                        f"No PGO profiles found under {profile_dir}.\n"
+                        "Build with pgo_mode='generate' and run a representative "
+                        "workload (e.g. a submit-stream replay) first."
+                    )
+            else:
+                raise ValueError(f"Invalid pgo_mode: {pgo_mode}. Must be 'generate' or 'use'.")
 
         if not build:
             return self._lookup_binaries(name, output_dir)
@@ -171,9 +206,16 @@ class RuntimeBuilder:
         compiler = self._runtime_compiler
 
         def _compile_target(target: str) -> Path:
-            include_dirs, source_dirs = self._resolve_target_dirs(config_dir, build_config, target)
+            include_dirs, source_dirs, defines = self._resolve_target_dirs(config_dir, build_config, target)
             # compile() adds a {target}/ subdirectory inside build_dir
             cache_dir = self._CACHE_DIR / arch / variant / name
+            # Only the AICPU scheduler is PGO-built. Each PGO step gets its
+            # own cmake cache dir so the plain incremental cache never
+            # inherits stale instrumentation flags (cmake cache entries
+            # persist across configures).
+            pgo = pgo_mode if target == "aicpu" else None
+            if pgo is not None:
+                cache_dir = cache_dir / f"pgo_{pgo}"
             cache_dir.mkdir(parents=True, exist_ok=True)
 
             # File lock to prevent concurrent cmake runs in the same build dir.
@@ -188,6 +230,9 @@ class RuntimeBuilder:
                     source_dirs,
                     build_dir=str(cache_dir),
                     output_dir=output_dir,
+                    defines=defines,
+                    pgo_mode=pgo,
+                    pgo_dir=str(profile_dir) if pgo else None,
                 )
 
         logger.info("Compiling AICore, AICPU, Host in parallel...")
@@ -40,7 +40,14 @@ class BuildTarget:
     def get_binary_name(self) -> str:
         return self._binary_name
 
-    def gen_cmake_args(self, include_dirs: list[str], source_dirs: list[str]) -> list[str]:
+    def gen_cmake_args(
+        self,
+        include_dirs: list[str],
+        source_dirs: list[str],
+        defines: Optional[list[str]] = None,
+        pgo_mode: Optional[str] = None,
+        pgo_dir: Optional[str] = None,
+    ) -> list[str]:
         """Generate CMake arguments list from toolchain args + custom directories."""
         inc = ";".join(os.path.abspath(d) for d in include_dirs)
         src = ";".join(os.path.abspath(d) for d in source_dirs)
@@ -48,6 +55,11 @@ class BuildTarget:
             f"-DCUSTOM_INCLUDE_DIRS={inc}",
             f"-DCUSTOM_SOURCE_DIRS={src}",
         ]
+        if defines:
+            args.append(f"-DCUSTOM_COMPILE_DEFINITIONS={';'.join(defines)}")
+        if pgo_mode:
+            args.append(f"-DCUSTOM_PGO_MODE={pgo_mode}")
+            args.append(f"-DCUSTOM_PGO_DIR={os.path.abspath(pgo_dir)}")
         if logger.isEnabledFor(logging.DEBUG):
             args.append("--log-level=VERBOSE")
         return args
@@ -187,6 +199,9 @@ class RuntimeCompiler:
         source_dirs: list[str],
         build_dir: Optional[str] = None,
         output_dir: Optional[Union[str, Path]] = None,
+        defines: Optional[list[str]] = None,
+        pgo_mode: Optional[str] = None,
+        pgo_dir: Optional[str] = None,
     ) -> Union[bytes, Path]:
         """
         Compile binary for the specified target platform.
@@ -198,6 +213,11 @@ class RuntimeCompiler:
             build_dir: The directory path for compiling. When None, use a temporal path.
             output_dir: Directory to copy the final binary into. When set, returns Path.
                         When None, returns bytes (backward-compatible).
+            defines: Optional "NAME=VALUE" compile definitions from the runtime's
+                     build_config.py (variant selection macros).
+            pgo_mode: Optional profile-guided optimization mode: "generate"
+                      (instrumented build) or "use" (optimize with profiles).
+            pgo_dir: Directory for raw profiles; required when pgo_mode is set.
 
         Returns:
             If output_dir is set: Path to the compiled binary in output_dir.
@@ -217,7 +237,13 @@ class RuntimeCompiler:
         else:
             raise ValueError(f"Invalid target platform: {target_platform}. Must be 'aicore', 'aicpu', or 'host'.")
 
-        cmake_args = target.gen_cmake_args(include_dirs, source_dirs)
+        if pgo_mode is not None:
+            if pgo_mode not in ("generate", "use"):
+                raise ValueError(f"Invalid pgo_mode: {pgo_mode}. Must be 'generate' or 'use'.")
+            if pgo_dir is None:
+                raise ValueError("pgo_dir must be set when pgo_mode is given")
+
+        cmake_args = target.gen_cmake_args(include_dirs, source_dirs, defines, pgo_mode=pgo_mode, pgo_dir=pgo_dir)
         cmake_source_dir = target.get_root_dir()
         binary_name = target.get_binary_name()
         platform = target_platform.upper()
@@ -641,34 +641,44 @@ def run_class_cases(  # noqa: PLR0913 -- shared layer-5 entry; kwargs mirror CLI
     """Execute a pre-filtered list of cases for one class (layers 5-6).
 
     Caller is responsible for platform/selector/manual filtering. Profiling
-    snapshots wrap each case. Validation failures propagate; caller decides
-    fail-fast vs collect semantics.
+    snapshots wrap each case. Setup/run failures propagate immediately;
+    golden verification is pipelined (see _GoldenPipeline), so mismatches
+    surface after the last case, labelled with the case that produced them.
     """
     cls_name = type(cls_inst).__name__
     callable_spec = getattr(type(cls_inst), "CALLABLE", None)
-    for case in cases:
-        before_perf = _snapshot_perf_files() if enable_profiling else set()
-        before_device = _snapshot_device_logs(primary_device_id) if enable_profiling and is_hardware else None
-        try:
-            cls_inst._run_and_validate(
-                worker,
-                callable_obj,
-                case,
-                sub_ids=sub_ids,
-                rounds=rounds,
-                skip_golden=skip_golden,
-                enable_profiling=enable_profiling,
-                enable_dump_tensor=enable_dump_tensor,
-            )
-        finally:
-            if enable_profiling:
-                _convert_case_swimlane(
-                    f"{cls_name}_{case['name']}",
-                    primary_device_id,
-                    before_perf,
-                    before_device,
-                    callable_spec=callable_spec,
+    try:
+        for case in cases:
+            before_perf = _snapshot_perf_files() if enable_profiling else set()
+            before_device = _snapshot_device_logs(primary_device_id) if enable_profiling and is_hardware else None
+            try:
+                cls_inst._run_and_validate(
+                    worker,
+                    callable_obj,
+                    case,
+                    sub_ids=sub_ids,
+                    rounds=rounds,
+                    skip_golden=skip_golden,
+                    enable_profiling=enable_profiling,
+                    enable_dump_tensor=enable_dump_tensor,
                 )
+            finally:
+                if enable_profiling:
+                    _convert_case_swimlane(
+                        f"{cls_name}_{case['name']}",
+                        primary_device_id,
+                        before_perf,
+                        before_device,
+                        callable_spec=callable_spec,
+                    )
+    except BaseException:
+        # The run itself failed: join the pipeline without letting a deferred
+        # mismatch mask the primary error (it is still logged).
+        _golden_pipeline.drain(raise_errors=False)
+        raise
+    # All cases ran: deferred verification failures surface here, labelled
+    # with the case (and round) that produced them.
+    _golden_pipeline.drain()
 
 
 def _compare_outputs(test_args, golden_args, output_names, rtol, atol):
@@ -683,6 +693,141 @@ def _compare_outputs(test_args, golden_args, output_names, rtol, atol):
             raise AssertionError(f"Golden mismatch on '{name}': max_diff={diff}, rtol={rtol}, atol={atol}")
 
 
+# ---------------------------------------------------------------------------
+# Golden pipeline — cached, overlapped golden computation and verification
+# ---------------------------------------------------------------------------
+
+_GOLDEN_CACHE_VERSION = 1
+
+
+def _golden_cache_path(cls_name, case_name, params, test_args):
+    """Content-addressed cache location for one case's golden outputs.
+
+    The key hashes the generated inputs themselves (tensor bytes, scalar
+    values) alongside the class, case, and params, so a hit is valid by
+    construction: identical inputs produce identical goldens. Cases whose
+    generate_args is nondeterministic simply never hit and recompute.
+    """
+    import hashlib  # noqa: PLC0415
+
+    import torch  # noqa: PLC0415
+
+    from .environment import PROJECT_ROOT  # noqa: PLC0415
+
+    h = hashlib.sha256()
+    h.update(f"v{_GOLDEN_CACHE_VERSION}:{cls_name}:{case_name}:{sorted(params.items())!r}".encode())
+    for spec in test_args.specs:
+        h.update(spec.name.encode())
+        value = spec.value
+        if isinstance(value, torch.Tensor):
+            h.update(str(value.dtype).encode())
+            h.update(str(tuple(value.shape)).encode())
+            h.update(value.contiguous().cpu().numpy().tobytes())
+        else:
+            h.update(repr(value).encode())
+    return PROJECT_ROOT / "build" / "cache" / "goldens" / cls_name / f"{h.hexdigest()}.pt"
+
+
+class _GoldenPipeline:
+    """Overlaps golden computation and verification with device execution.
+
+    compute() is called before the device run and returns a future, so the
+    numpy/torch reference runs on a host thread while the device executes
+    (worker.run releases the GIL); goldens cached under build/cache/goldens/
+    short-circuit the computation entirely. verify() defers the comparison
+    the same way, snapshotting the outputs first so the next round or case
+    can reuse the buffers; drain() joins everything and raises the first
+    failure with its case label, which is how a mismatch detected during a
+    later case's device window is still attributed to the case that
+    produced it. Per-case wall time (and therefore the perf check) covers
+    the device window only.
+
+    A single worker thread keeps compute/verify FIFO and avoids
+    oversubscribing hosts that also run simulator threads.
+    """
+
+    def __init__(self):
+        self._executor = None
+        self._pending: list[tuple[str, Any]] = []
+
+    def _ensure_executor(self):
+        if self._executor is None:
+            from concurrent.futures import ThreadPoolExecutor  # noqa: PLC0415
+
+            self._executor = ThreadPoolExecutor(max_workers=1, thread_name_prefix="golden")
+        return self._executor
+
+    def compute(self, test_case, test_args, params, case, verify_names):
+        """Start golden computation; returns a future of {name: tensor}.
+
+        The inputs are cloned on the calling thread, before the device run
+        can mutate the output tensors they share memory with.
+        """
+        cls_name = type(test_case).__name__
+        try:
+            cache_path = _golden_cache_path(cls_name, case["name"], params, test_args)
+        except Exception:  # unhashable params/specs: recompute every time
+            cache_path = None
+        golden_args = test_args.clone()
+
+        def _compute():
+            import torch  # noqa: PLC0415
+
+            if cache_path is not None and cache_path.exists():
+                try:
+                    return torch.load(cache_path, weights_only=True)
+                except Exception as exc:
+                    logger.warning(f"[golden] discarding unreadable cache entry {cache_path.name}: {exc}")
+                    cache_path.unlink(missing_ok=True)
+            test_case.compute_golden(golden_args, params)
+            golden = {name: getattr(golden_args, name) for name in verify_names}
+            if cache_path is not None:
+                try:
+                    cache_path.parent.mkdir(parents=True, exist_ok=True)
+                    tmp = cache_path.with_suffix(f".tmp{os.getpid()}")
+                    torch.save(golden, tmp)
+                    tmp.replace(cache_path)
+                except Exception as exc:  # cache is best-effort
+                    logger.warning(f"[golden] could not write cache entry {cache_path.name}: {exc}")
+            return golden
+
+        return self._ensure_executor().submit(_compute)
+
+    def verify(self, label, test_args, golden_future, verify_names, rtol, atol):
+        """Defer output comparison against a compute() future."""
+        from types import SimpleNamespace  # noqa: PLC0415
+
+        outputs = {name: getattr(test_args, name).clone() for name in verify_names}
+
+        def _verify():
+            golden = golden_future.result()
+            _compare_outputs(SimpleNamespace(**outputs), SimpleNamespace(**golden), verify_names, rtol, atol)
+
+        self._pending.append((label, self._ensure_executor().submit(_verify)))
+
+    def drain(self, raise_errors=True):
+        """Join all deferred verifications; raise (or log) the failures."""
+        pending, self._pending = self._pending, []
+        errors = []
+        for label, future in pending:
+            try:
+                future.result()
+            except Exception as exc:
+                errors.append((label, exc))
+        if not errors:
+            return
+        if not raise_errors:
+            for label, exc in errors:
+                logger.warning(f"[golden] deferred verification failed for {label}: {exc}")
+            return
+        label, exc = errors[0]
+        detail = f" (+{len(errors) - 1} more)" if len(errors) > 1 else ""
+        raise AssertionError(f"[golden] deferred verification failed for {label}{detail}: {exc}") from exc
+
+
+_golden_pipeline = _GoldenPipeline()
+
+
 def _compile_chip_callable_from_spec(spec, platform, runtime, cache_key):
     """Compile a chip entry spec (orchestration + incores) -> ChipCallable. Session-cached."""
     if cache_key in _compile_cache:
@@ -707,7 +852,12 @@ def _compile_chip_callable_from_spec(spec, platform, runtime, cache_key):
     kernel_binaries = []
     for k in incores:
         incore = kc.compile_incore(
-            k["source"], core_type=k["core_type"], pto_isa_root=pto_isa_root, extra_include_dirs=inc_dirs
+            k["source"],
+            core_type=k["core_type"],
+            pto_isa_root=pto_isa_root,
+            extra_include_dirs=inc_dirs,
+            arg_schema=k.get("args"),
+            build_profile=k.get("build_profile"),
         )
         if not is_sim:
             incore = extract_text_section(incore)
@@ -829,6 +979,7 @@ class SceneTestCase:
         L2: returns ChipCallable.
         L3: returns dict of {name: ChipCallable, name_sig: signature}.
         """
+        self._st_active_platform = platform
         if self._st_level == 2:
             return self.compile_chip_callable(platform)
         elif self._st_level == 3:
@@ -898,6 +1049,8 @@ class SceneTestCase:
     def _run_and_validate_l2(
         self, worker, callable_obj, case, rounds=1, skip_golden=False, enable_profiling=False, enable_dump_tensor=False
     ):
+        import time  # noqa: PLC0415
+
         params = case.get("params", {})
         config_dict = case.get("config", {})
         orch_sig = self.CALLABLE.get("orchestration", {}).get("signature", [])
@@ -906,11 +1059,11 @@ class SceneTestCase:
         test_args = self.generate_args(params)
         chip_args, output_names = _build_chip_task_args(test_args, orch_sig)
 
-        # Compute golden (unless skip_golden)
-        golden_args = None
+        # Kick off golden computation on the pipeline thread (unless
+        # skip_golden); it overlaps the device rounds below.
+        golden_future = None
         if not skip_golden:
-            golden_args = test_args.clone()
-            self.compute_golden(golden_args, params)
+            golden_future = _golden_pipeline.compute(self, test_args, params, case, output_names)
 
         # Save initial output tensor values for reset between rounds
         initial_outputs = {}
@@ -919,6 +1072,7 @@ class SceneTestCase:
                 initial_outputs[name] = getattr(test_args, name).clone()
 
         # Execute rounds
+        round_times_ms = []
         for round_idx in range(rounds):
             if round_idx > 0:
                 for name, initial in initial_outputs.items():
@@ -931,10 +1085,76 @@ class SceneTestCase:
             )
 
             with _temporary_env(self._resolve_env()):
+                t_start = time.perf_counter()
                 worker.run(callable_obj, chip_args, config=config)
+                round_times_ms.append((time.perf_counter() - t_start) * 1000.0)
 
             if not skip_golden:
-                _compare_outputs(test_args, golden_args, output_names, self.RTOL, self.ATOL)
+                label = f"{type(self).__name__}::{case['name']}" + (f"#round{round_idx}" if rounds > 1 else "")
+                _golden_pipeline.verify(label, test_args, golden_future, output_names, self.RTOL, self.ATOL)
+
+        self._check_case_perf(case, round_times_ms)
+
+    def _check_case_perf(self, case, round_times_ms):
+        """Evaluate a case's optional ``perf`` block against measured wall time.
+
+        ``perf`` schema (all keys optional)::
+
+            "perf": {
+                "baseline_ms": {"a2a3": 12.0, "a2a3sim": None, ...},
+                "threshold": 0.25,     # allowed regression over baseline
+                "warmup_rounds": 1,    # leading rounds excluded from the check
+            }
+
+        The best (minimum) post-warmup round is compared against a baseline:
+        an inline ``baseline_ms[platform]`` takes precedence; otherwise the
+        shared store (``simpler_setup.perf_baseline``, default
+        ``tests/st/perf_baselines.json``) is consulted. Platforms with no
+        baseline anywhere run in report-only mode: the measurement is logged
+        so a baseline can be recorded from a quiet machine, but nothing
+        fails. With ``SIMPLER_PERF_BASELINE_UPDATE=1`` the measurement is
+        written to the store instead of checked. Wall time includes the full
+        ``worker.run`` — orchestration, scheduling, and kernel execution —
+        which is exactly the end-to-end latency perf scenes exist to pin
+        down.
+        """
+        perf = case.get("perf")
+        if not perf or not round_times_ms:
+            return
+
+        from . import perf_baseline  # noqa: PLC0415
+
+        warmup = min(perf.get("warmup_rounds", 1), len(round_times_ms) - 1)
+        measured = round_times_ms[warmup:]
+        best_ms = min(measured)
+        label = f"{type(self).__name__}::{case['name']}"
+        platform = getattr(self, "_st_active_platform", None)
+        threshold = perf.get("threshold", 0.25)
+        logger.info(
+            f"[perf] {label}: best {best_ms:.3f} ms over {len(measured)} measured round(s) "
+            f"({warmup} warmup) on {platform}"
+        )
+        if platform is None:
+            return
+
+        if perf_baseline.update_mode():
+            perf_baseline.record(label, platform, best_ms, rounds=len(measured), threshold=perf.get("threshold"))
+            return
+
+        baseline_ms = (perf.get("baseline_ms") or {}).get(platform)
+        if baseline_ms is not None:
+            limit_ms = baseline_ms * (1.0 + threshold)
+            if best_ms > limit_ms:
+                raise AssertionError(
+                    f"[perf] {label}: best round {best_ms:.3f} ms exceeds inline baseline "
+                    f"{baseline_ms:.3f} ms + {threshold:.0%} (limit {limit_ms:.3f} ms) on {platform}"
+                )
+            return
+
+        ok, detail = perf_baseline.compare(label, platform, best_ms, default_threshold=threshold)
+        logger.info(f"[perf] {label}: {detail}")
+        if not ok:
+            raise AssertionError(f"[perf] {label}: regression on {platform}: {detail}")
 
     def _run_and_validate_l3(
         self,
@@ -964,15 +1184,15 @@ class SceneTestCase:
 
         # Build args
         test_args = self.generate_args(params)
+        all_tensor_names = test_args.tensor_names()
 
-        # Compute golden (unless skip_golden)
-        golden_args = None
+        # Kick off golden computation on the pipeline thread (unless
+        # skip_golden); it overlaps the device rounds below.
+        golden_future = None
         if not skip_golden:
-            golden_args = test_args.clone()
-            self.compute_golden(golden_args, params)
+            golden_future = _golden_pipeline.compute(self, test_args, params, case, all_tensor_names)
 
         # Save initial tensor values for reset between rounds
-        all_tensor_names = test_args.tensor_names()
         initial_tensors = {}
         if rounds > 1:
             for name in all_tensor_names:
@@ -1005,7 +1225,8 @@ class SceneTestCase:
                 worker.run(task_orch)
 
             if not skip_golden:
-                _compare_outputs(test_args, golden_args, all_tensor_names, self.RTOL, self.ATOL)
+                label = f"{type(self).__name__}::{case['name']}" + (f"#round{round_idx}" if rounds > 1 else "")
+                _golden_pipeline.verify(label, test_args, golden_future, all_tensor_names, self.RTOL, self.ATOL)
 
     # ------------------------------------------------------------------
     # pytest auto test method
@@ -31,6 +31,38 @@
 
 // ============= Public Interface =============
 
+/**
+ * Drop an intra-kernel phase marker into the current task's WIP record
+ *
+ * Lets a kernel split its own runtime into named phases (e.g. MTE-in /
+ * compute / MTE-out) without a simulator run: each call stamps the current
+ * sys_cnt together with a caller-chosen phase id into the next free
+ * phase_markers[] slot. The markers ride the task's PerfRecord through the
+ * normal commit path, so host tooling sees them correlated with the task's
+ * start/end/dispatch times for free.
+ *
+ * Cost is one timestamp read plus two GM stores — no cache maintenance
+ * here; perf_aicore_record_task() flushes the marker lines once at task end.
+ * Calls beyond PERF_PHASE_MARKER_SLOTS are silently dropped.
+ *
+ * @param record_addr WIP PerfRecord address from get_perf_record(args);
+ *                    0 (profiling disabled) makes the call a no-op
+ * @param phase_id Caller-defined phase identifier (kernel-local namespace)
+ */
+__aicore__ __attribute__((always_inline)) static inline void
+perf_aicore_phase_marker(uint64_t record_addr, uint8_t phase_id) {
+    if (record_addr == 0) {
+        return;
+    }
+    __gm__ PerfRecord *record = reinterpret_cast<__gm__ PerfRecord *>(record_addr);
+    int32_t slot = record->phase_count;
+    if (slot < 0 || slot >= static_cast<int32_t>(PERF_PHASE_MARKER_SLOTS)) {
+        return;
+    }
+    record->phase_markers[slot] = perf_phase_marker_pack(phase_id, get_sys_cnt_aicore());
+    record->phase_count = slot + 1;
+}
+
 /**
  * Record task execution performance data
  *
@@ -55,8 +87,16 @@ perf_aicore_record_task(__gm__ PerfBuffer *perf_buf, uint32_t task_id, uint64_t
     record->end_time = end_time;
     record->task_id = static_cast<uint64_t>(task_id);
 
-    // Flush cache to make data visible to AICPU
+    // Flush cache to make data visible to AICPU. The phase_count line is
+    // flushed unconditionally: the executor's pre-launch zeroing must reach
+    // AICPU even when the kernel dropped no markers, or a stale count from
+    // the slot's previous occupant would be folded into this record.
     dcci(record, SINGLE_CACHE_LINE, CACHELINE_OUT);
+    dcci(&record->phase_count, SINGLE_CACHE_LINE, CACHELINE_OUT);
+    // Markers [0..5] share the phase_count line; [6..7] spill onto the next.
+    if (record->phase_count > 6) {
+        dcci(&record->phase_markers[PERF_PHASE_MARKER_SLOTS - 1], SINGLE_CACHE_LINE, CACHELINE_OUT);
+    }
     dsb((mem_dsb_t)0);
 }
 
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * @file signal_aicore.h
+ * @brief Mid-kernel AICore-to-AICPU signal publication
+ *
+ * A plain GM store from an AICore kernel sits in the core's data cache until
+ * the next whole-cache writeback — invisible to the AICPU while the kernel
+ * runs. Signals the AICPU must observe mid-kernel (e.g. the early-input-
+ * release slot from get_input_release_slot()) therefore need the same
+ * store + dcci writeback sequence the executor uses for the completion
+ * doorbell. This helper packages that sequence for kernel code.
+ */
+
+#ifndef PLATFORM_AICORE_SIGNAL_AICORE_H_
+#define PLATFORM_AICORE_SIGNAL_AICORE_H_
+
+#include "aicore/aicore.h"
+
+// Include platform-specific cache maintenance implementation
+// Build system selects the correct inner_kernel.h based on platform:
+// - src/a2a3/platform/onboard/aicore/inner_kernel.h (real hardware)
+// - src/a2a3/platform/sim/aicore/inner_kernel.h (simulation)
+#include "inner_kernel.h"
+
+/**
+ * Publish a one-word signal so the AICPU can observe it while the kernel
+ * is still executing.
+ *
+ * Writes `value` to the GM word at `slot_addr`, then flushes the containing
+ * cache line and drains the writeback so the value reaches memory before
+ * any subsequent store. A slot_addr of 0 makes the call a no-op, so kernels
+ * need no branch around accessors that may return 0.
+ *
+ * Cost is one GM store plus one line writeback — call it once per signal,
+ * not in a loop.
+ *
+ * @param slot_addr GM address of the signal word (e.g. from
+ *                  get_input_release_slot(args)); 0 = no-op
+ * @param value     Value to publish (readers treat non-zero as "signalled")
+ */
+__aicore__ __attribute__((always_inline)) static inline void aicore_signal_publish(uint64_t slot_addr, uint64_t value) {
+    if (slot_addr == 0) {
+        return;
+    }
+    __gm__ uint64_t *slot = reinterpret_cast<__gm__ uint64_t *>(slot_addr);
+    *reinterpret_cast<__gm__ volatile uint64_t *>(slot) = value;
+    dcci(slot, SINGLE_CACHE_LINE, CACHELINE_OUT);
+    dsb((mem_dsb_t)0);
+}
+
+#endif  // PLATFORM_AICORE_SIGNAL_AICORE_H_
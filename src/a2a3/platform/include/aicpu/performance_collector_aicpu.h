@@ -29,6 +29,11 @@
 
 // ============= Public Interface =============
 
+// Strict no-instrumentation builds (PTO_INSTRUMENTATION=0) replace every
+// entry point with an inline no-op below, so call sites fold away and the
+// collector translation unit compiles to nothing.
+#if PTO_INSTRUMENTATION
+
 /**
  * Initialize performance profiling
  *
@@ -45,7 +50,13 @@ void perf_aicpu_init_profiling(Runtime *runtime);
  * and fills all AICPU-side fields. Callers must pre-extract fanout into a
  * plain uint64_t array (platform layer cannot depend on runtime linked-list types).
  *
+ * Also folds the task's cycle metrics (dispatch gap, queue wait, kernel
+ * duration) into the per-core histograms in PerfDataHeader. When the host
+ * set hist_only, the record commit is skipped and only the histogram adds
+ * remain — the low-overhead production telemetry mode.
+ *
  * @param perf_buf              PerfBuffer pointer (from handshake perf_records_addr)
+ * @param core_id               Core index for per-core histogram accumulation
  * @param expected_reg_task_id  Register dispatch token (low 32 bits) to validate
  * @param task_id               Task identifier to write (PTO2 encoding or plain id)
  * @param func_id               Kernel function identifier
@@ -54,10 +65,13 @@ void perf_aicpu_init_profiling(Runtime *runtime);
  * @param finish_time           AICPU timestamp when task completion was observed
  * @param fanout                Pre-extracted successor task ID array (nullptr if none)
  * @param fanout_count          Number of entries in fanout array (0 if none)
+ * @param pmu_cache_miss        PMU cache-refill delta over the task (0 = not sampled)
+ * @param pmu_bus_access        PMU bus-access delta over the task (0 = not sampled)
  */
 int perf_aicpu_complete_record(
-    PerfBuffer *perf_buf, uint32_t expected_reg_task_id, uint64_t task_id, uint32_t func_id, CoreType core_type,
-    uint64_t dispatch_time, uint64_t finish_time, const uint64_t *fanout, int32_t fanout_count
+    PerfBuffer *perf_buf, int core_id, uint32_t expected_reg_task_id, uint64_t task_id, uint32_t func_id,
+    CoreType core_type, uint64_t dispatch_time, uint64_t finish_time, const uint64_t *fanout, int32_t fanout_count,
+    uint64_t pmu_cache_miss = 0, uint64_t pmu_bus_access = 0
 );
 
 /**
@@ -94,6 +108,16 @@ void perf_aicpu_flush_buffers(Runtime *runtime, int thread_idx, const int *cur_t
  */
 void perf_aicpu_update_total_tasks(Runtime *runtime, uint32_t total_tasks);
 
+/**
+ * Get the host-configured PMU sampling interval
+ *
+ * Executors sample the core's PMU registers around 1-in-N dispatches and pass
+ * the deltas to perf_aicpu_complete_record().
+ *
+ * @return Sample interval N from PerfDataHeader (0 = PMU sampling disabled)
+ */
+uint32_t perf_aicpu_pmu_sample_interval();
+
 /**
  * Initialize AICPU phase profiling
  *
@@ -135,6 +159,18 @@ void perf_aicpu_record_phase(
  */
 void perf_aicpu_write_orch_summary(const AicpuOrchSummary *src);
 
+/**
+ * Write a scheduler thread's cumulative cycle summary
+ *
+ * Republishes the scheduler loop's run-to-date phase cycle counters to shared
+ * memory. Called periodically from the scheduler loop (cold path) and once at
+ * shutdown, so the host ingests the breakdown without log parsing.
+ *
+ * @param thread_idx Scheduler thread index
+ * @param src Pointer to populated AicpuSchedSummary (magic/publish_seq are set internally)
+ */
+void perf_aicpu_write_sched_summary(int thread_idx, const AicpuSchedSummary *src);
+
 /**
  * Set orchestrator thread index for per-task phase recording
  *
@@ -189,4 +225,30 @@ void perf_aicpu_write_core_assignments(
  */
 void perf_aicpu_flush_phase_buffers(int thread_idx);
 
+#else  // !PTO_INSTRUMENTATION
+
+inline void perf_aicpu_init_profiling(Runtime *) {}
+inline int perf_aicpu_complete_record(
+    PerfBuffer *, int, uint32_t, uint64_t, uint32_t, CoreType, uint64_t, uint64_t, const uint64_t *, int32_t,
+    uint64_t = 0, uint64_t = 0
+) {
+    return 0;
+}
+inline void perf_aicpu_switch_buffer(Runtime *, int, int) {}
+inline void perf_aicpu_flush_buffers(Runtime *, int, const int *, int) {}
+inline void perf_aicpu_update_total_tasks(Runtime *, uint32_t) {}
+inline uint32_t perf_aicpu_pmu_sample_interval() { return 0; }
+inline void perf_aicpu_init_phase_profiling(Runtime *, int) {}
+inline void perf_aicpu_record_phase(int, AicpuPhaseId, uint64_t, uint64_t, uint32_t, uint64_t) {}
+inline void perf_aicpu_write_orch_summary(const AicpuOrchSummary *) {}
+inline void perf_aicpu_write_sched_summary(int, const AicpuSchedSummary *) {}
+inline void perf_aicpu_set_orch_thread_idx(int) {}
+inline void perf_aicpu_record_orch_phase(AicpuPhaseId, uint64_t, uint64_t, uint32_t, uint64_t) {}
+inline void perf_aicpu_write_core_assignments(
+    const int[][PLATFORM_MAX_CORES_PER_THREAD], const int *, int, int
+) {}
+inline void perf_aicpu_flush_phase_buffers(int) {}
+
+#endif  // PTO_INSTRUMENTATION
+
 #endif  // PLATFORM_AICPU_PERFORMANCE_COLLECTOR_AICPU_H_
@@ -35,6 +35,11 @@
 extern "C" {
 #endif
 
+// Strict no-instrumentation builds (PTO_INSTRUMENTATION=0) replace every
+// entry point with an inline no-op, so runtime-checked dump hooks fold away
+// and tensor_dump_aicpu.cpp compiles to nothing. Types stay visible.
+#if PTO_INSTRUMENTATION
+
 /**
  * Set the tensor dump shared-memory base address.
  * Called by the platform layer before AICPU execution starts.
@@ -65,11 +70,102 @@ void set_enable_dump_tensor(bool enable);
  */
 bool get_enable_dump_tensor();
 
+#else  // !PTO_INSTRUMENTATION
+
+static inline void set_platform_dump_base(uint64_t) {}
+static inline uint64_t get_platform_dump_base() { return 0; }
+static inline void set_enable_dump_tensor(bool) {}
+static inline bool get_enable_dump_tensor() { return false; }
+
+#endif  // PTO_INSTRUMENTATION
+
 #ifdef __cplusplus
 }
 #endif
 
 #ifdef __cplusplus
+
+// =============================================================================
+// TensorDumpTrigger - Watchpoint condition gating a dump point
+// =============================================================================
+
+/**
+ * Condition a dump point must satisfy before anything is recorded. Evaluated
+ * device-side in the same traversal that computes summary stats, so an
+ * untriggered iteration pays only the check — no arena copy, no record.
+ */
+enum class TensorDumpTrigger : uint8_t {
+    ALWAYS = 0,     // Unconditional dump (default)
+    NAN_INF = 1,    // Dump only when the view contains a NaN or Inf
+    ABS_MAX = 2,    // Dump only when max|x| over the view exceeds the bound
+    USER_FLAG = 3,  // Dump only while DumpDataHeader::user_trigger_flag is set
+};
+
+// =============================================================================
+// TensorDumpFilterSpec - Per-dump-point payload reduction
+// =============================================================================
+
+/**
+ * One parsed entry of the PTO2_DUMP_FILTER environment variable.
+ *
+ * Spec syntax (semicolon-separated entries, comma-separated key:value pairs):
+ *
+ *     PTO2_DUMP_FILTER="func:2,arg:0,mode:rows,stride:8;mode:summary"
+ *
+ * Keys:
+ * - func:N or func:*   Kernel func_id this entry applies to (default: any)
+ * - arg:N or arg:*     Payload arg_index this entry applies to (default: any)
+ * - mode:full|rows|box|summary   Filter mode (default: full)
+ * - stride:N           rows mode: keep every Nth outer-dimension index
+ * - box:b-e/b-e/...    box mode: per-dimension [begin, end) window, outermost
+ *                      first; end 0 means "to end of dim"; trailing dims full
+ * - cast:fp16          Store FLOAT32 payloads as FLOAT16 (full/rows/box modes)
+ * - trig:nan|absmax|flag   Watchpoint trigger (see TensorDumpTrigger);
+ *                      without one the dump point dumps unconditionally
+ * - bound:X            absmax trigger threshold, fires when max|x| > X
+ *
+ * The most specific matching entry wins: (func, arg) over (func, *) over
+ * (*, arg) over (*, *). Dump points without a match dump the full tensor.
+ *
+ * Triggers inspect the view being dumped (box window applied); for rows mode
+ * the check covers every row, including those the stride would skip. nan and
+ * absmax need a FLOAT32/FLOAT16 view — other dtypes warn once and dump
+ * unconditionally rather than go silent.
+ */
+struct TensorDumpFilterSpec {
+    uint32_t func_id;    // UINT32_MAX = any func_id
+    int32_t arg_index;   // -1 = any arg_index
+    TensorDumpFilterMode mode;
+    bool downcast_fp16;  // FLOAT32 payload stored as FLOAT16 bits
+    uint32_t row_stride; // ROW_STRIDE mode, >= 1
+    uint32_t box_begin[PLATFORM_DUMP_MAX_DIMS];
+    uint32_t box_end[PLATFORM_DUMP_MAX_DIMS];  // 0 = to end of dimension
+    TensorDumpTrigger trigger;
+    float trigger_bound;  // ABS_MAX: dump when max|x| > trigger_bound
+};
+
+#if PTO_INSTRUMENTATION
+
+/**
+ * Parse a PTO2_DUMP_FILTER spec string and install the filter table.
+ *
+ * Replaces any previously installed filters. A null or empty spec clears the
+ * table (all dump points revert to full dumps).
+ *
+ * @param spec Filter spec string (see TensorDumpFilterSpec)
+ * @return Number of installed filters, or -1 on parse error (table cleared)
+ */
+int dump_tensor_configure_filters(const char *spec);
+
+/**
+ * Find the most specific filter for a dump point, or nullptr for full dumps.
+ *
+ * @param func_id Kernel function identifier
+ * @param arg_index Position in the task payload
+ * @return Matching filter spec, or nullptr when no filter applies
+ */
+const TensorDumpFilterSpec *dump_tensor_match_filter(uint32_t func_id, uint32_t arg_index);
+
 bool get_tensor_dump_role_from_direction(ArgDirection dir, TensorDumpRole *role);
 int32_t count_callable_tensor_args(const CoreCallable &callable);
 bool should_dump_tensor_at_stage(TensorDumpRole role, TensorDumpStage stage);
@@ -233,13 +329,38 @@ inline void dump_tensors_for_task(
         tensor_arg_index++;
     }
 }
+
+#else  // !PTO_INSTRUMENTATION
+
+inline int dump_tensor_configure_filters(const char *) { return 0; }
+inline const TensorDumpFilterSpec *dump_tensor_match_filter(uint32_t, uint32_t) { return nullptr; }
+inline bool get_tensor_dump_role_from_direction(ArgDirection, TensorDumpRole *) { return false; }
+inline int32_t count_callable_tensor_args(const CoreCallable &) { return 0; }
+inline bool should_dump_tensor_at_stage(TensorDumpRole, TensorDumpStage) { return false; }
+inline bool try_log_tensor_dump_layout_mismatch() { return false; }
+inline int dump_tensor_record(int, const TensorDumpInfo &) { return 0; }
+
+template <int MaxSubtaskSlots, typename SlotStateT, typename IsSubtaskActiveFn, typename GetFunctionBinAddrFn>
+inline void dump_tensors_for_task(int32_t, const SlotStateT &, TensorDumpStage, IsSubtaskActiveFn, GetFunctionBinAddrFn) {
+}
+
+template <typename TensorInfoT>
+inline void dump_tensors_for_task(
+    int32_t, uint64_t, uint8_t, int32_t, int32_t, const CoreCallable &, const TensorInfoT *, int32_t,
+    const uint64_t *, int32_t, TensorDumpStage
+) {}
+
+#endif  // PTO_INSTRUMENTATION
 #endif
 
+#if PTO_INSTRUMENTATION
+
 /**
  * Initialize tensor dump.
  *
- * Sets up per-thread DumpBufferState pointers and pops initial
- * metadata buffers from each thread's free_queue.
+ * Sets up per-thread DumpBufferState pointers, pops initial metadata
+ * buffers from each thread's free_queue, and installs dump filters from
+ * the PTO2_DUMP_FILTER environment variable (see TensorDumpFilterSpec).
  *
  * @param num_dump_threads Number of scheduling threads that will dump tensors
  */
@@ -252,6 +373,10 @@ void dump_tensor_init(int num_dump_threads);
  * TensorDumpRecord to the current metadata buffer. Switches
  * buffers when full via the SPSC free_queue.
  *
+ * When a dump filter matches (func_id, arg_index) the payload is reduced
+ * on device first: sliced (rows/box), downcast to FLOAT16, or replaced by
+ * a TensorDumpSummary. The applied mode is recorded in the record.
+ *
  * When metadata buffers are temporarily exhausted, old dump metadata may be
  * overwritten so execution can continue without losing the active buffer.
  *
@@ -271,4 +396,11 @@ int dump_tensor_record(int thread_idx, const TensorDumpInfo &info);
  */
 void dump_tensor_flush(int thread_idx);
 
+#else  // !PTO_INSTRUMENTATION
+
+inline void dump_tensor_init(int) {}
+inline void dump_tensor_flush(int) {}
+
+#endif  // PTO_INSTRUMENTATION
+
 #endif  // PLATFORM_AICPU_TENSOR_DUMP_AICPU_H_
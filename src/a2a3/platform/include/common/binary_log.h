@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * @file binary_log.h
+ * @brief Binary logging records with deferred formatting
+ *
+ * Hot-path logging normally pays a vsnprintf at the call site; on the AICPU
+ * a single enabled log line in the dispatch loop costs microseconds. In
+ * binary mode the producer instead captures a (format-pointer, args) tuple
+ * into a per-thread ring, and the text is rendered later — at collection
+ * time, off the hot path — by re-walking the format string against the
+ * stored argument words.
+ *
+ * Formats are referenced by pointer, not copied: log format strings are
+ * string literals, so the pointer stays valid until the ring is drained.
+ * The same holds for %s arguments — only literals or buffers that outlive
+ * the drain may be logged through a %s in binary mode (the capture cannot
+ * detect a stack buffer). Unsupported conversions (%n, * width/precision)
+ * make binlog_capture() refuse the record so the caller can fall back to
+ * eager formatting.
+ */
+
+#ifndef PLATFORM_COMMON_BINARY_LOG_H_
+#define PLATFORM_COMMON_BINARY_LOG_H_
+
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+/**
+ * Log level of a binary record, mapped back to the matching eager sink
+ * (dev_log_error/warn/info/debug/always) when the record is rendered.
+ */
+enum class BinaryLogLevel : uint8_t {
+    ERROR = 0,
+    WARN = 1,
+    INFO = 2,
+    DEBUG = 3,
+    ALWAYS = 4,
+};
+
+// Argument words captured per record; records needing more fall back to
+// eager formatting. The LOG_* macros consume two (file literal + line).
+constexpr int BINLOG_MAX_ARGS = 8;
+
+// Records per ring. One ring per producer thread; when full, new records
+// are dropped and counted (matching the phase-profiling drop policy).
+constexpr uint32_t BINLOG_RING_CAPACITY = 4096;  // pow2, masked indexing
+
+/**
+ * One captured log call: 96 bytes, no formatting performed.
+ * Argument words hold the raw va_arg values — integers zero/sign-extended
+ * to 64 bits, doubles bit-cast, pointers as-is. The conversion specifiers
+ * in fmt tell the renderer how to interpret each word.
+ */
+struct BinaryLogRecord {
+    uint64_t timestamp;              // sys_cnt at capture
+    const char *fmt;                 // format string literal (not copied)
+    const char *func;                // __FUNCTION__ of the call site
+    BinaryLogLevel level;            // sink to render into
+    uint8_t arg_count;               // captured argument words
+    uint16_t pad0;
+    uint32_t pad1;
+    uint64_t args[BINLOG_MAX_ARGS];  // raw argument words
+};
+
+static_assert(sizeof(BinaryLogRecord) == 96, "BinaryLogRecord layout drifted");
+
+/**
+ * Single-producer ring of captured records. The producer is the owning
+ * thread; the consumer is whoever drains at collection time. tail is
+ * published with release ordering after the record write (plain fields,
+ * single writer), so an acquire read of tail sees complete records.
+ */
+struct BinaryLogRing {
+    BinaryLogRecord records[BINLOG_RING_CAPACITY];
+    volatile uint32_t tail;   // producer write position (monotonic)
+    uint32_t head;            // consumer read position (drain only)
+    uint64_t dropped;         // records lost to a full ring
+};
+
+// Capture rings per device process. Threads beyond this log eagerly.
+constexpr int BINLOG_MAX_RINGS = 32;
+
+/**
+ * Shared-memory placement of the capture rings for zero-copy host tailing.
+ *
+ * When the host passes a host-visible region to set_platform_binlog_base(),
+ * producer threads claim slots from this array instead of allocating heap
+ * rings, and the host renders records straight out of the mapped rings —
+ * only the per-ring head cursor moves, no buffer is copied. A producer
+ * never overwrites unread records (a full ring drops and counts), so a
+ * slow consumer surfaces as a drop count rather than silent wraparound
+ * loss. ring_count is bumped with an atomic fetch-add by each claiming
+ * thread; the consumer releases all slots once producers have exited.
+ */
+struct BinaryLogShm {
+    volatile uint32_t ring_count;  // slots claimed by producer threads
+    uint32_t pad;
+    BinaryLogRing rings[BINLOG_MAX_RINGS];
+};
+
+/**
+ * Conversion specifier classification shared by capture and render.
+ * Parses one specifier starting at the '%' and reports how the matching
+ * va_arg / stored word must be typed.
+ */
+enum class BinlogArgKind : uint8_t {
+    NONE = 0,     // %% — no argument consumed
+    INT32 = 1,    // d/i/u/o/x/X/c with no length modifier (or h/hh)
+    INT64 = 2,    // l/ll/z/j length modifiers
+    DOUBLE = 3,   // f/F/e/E/g/G
+    POINTER = 4,  // p
+    STRING = 5,   // s
+    BAD = 6,      // unsupported (%n, '*', malformed) — refuse the record
+};
+
+/**
+ * Parse one conversion specifier. spec[0] must be '%'.
+ *
+ * @param spec     Position of the '%' in the format string
+ * @param spec_len Out: total specifier length including the '%'
+ * @return Argument classification (BAD means do not capture this call)
+ */
+inline BinlogArgKind binlog_parse_spec(const char *spec, int *spec_len) {
+    int n = 1;  // skip '%'
+    // Flags and fixed width/precision digits
+    while (spec[n] == '-' || spec[n] == '+' || spec[n] == ' ' || spec[n] == '#' || spec[n] == '0') n++;
+    while (spec[n] >= '0' && spec[n] <= '9') n++;
+    if (spec[n] == '.') {
+        n++;
+        while (spec[n] >= '0' && spec[n] <= '9') n++;
+    }
+    // Length modifiers
+    bool wide = false;
+    if (spec[n] == 'l') {
+        wide = true;
+        n++;
+        if (spec[n] == 'l') n++;
+    } else if (spec[n] == 'z' || spec[n] == 'j' || spec[n] == 't') {
+        wide = true;
+        n++;
+    } else if (spec[n] == 'h') {
+        n++;
+        if (spec[n] == 'h') n++;
+    }
+    *spec_len = n + 1;
+    switch (spec[n]) {
+    case '%':
+        return n == 1 ? BinlogArgKind::NONE : BinlogArgKind::BAD;
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+    case 'c':
+        return wide ? BinlogArgKind::INT64 : BinlogArgKind::INT32;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+        return BinlogArgKind::DOUBLE;
+    case 'p':
+        return BinlogArgKind::POINTER;
+    case 's':
+        return BinlogArgKind::STRING;
+    default:
+        return BinlogArgKind::BAD;  // %n, '*', or malformed
+    }
+}
+
+/**
+ * Capture one log call into rec without formatting.
+ *
+ * @return true on success; false if the format uses an unsupported
+ *         conversion or more than BINLOG_MAX_ARGS arguments (caller should
+ *         format eagerly instead).
+ */
+inline bool binlog_capture(
+    BinaryLogRecord *rec, BinaryLogLevel level, uint64_t timestamp, const char *func, const char *fmt, va_list ap
+) {
+    rec->timestamp = timestamp;
+    rec->fmt = fmt;
+    rec->func = func;
+    rec->level = level;
+    rec->pad0 = 0;
+    rec->pad1 = 0;
+    int argc = 0;
+    for (const char *p = fmt; *p != '\0'; p++) {
+        if (*p != '%') continue;
+        int spec_len = 0;
+        BinlogArgKind kind = binlog_parse_spec(p, &spec_len);
+        if (kind == BinlogArgKind::BAD) return false;
+        if (kind != BinlogArgKind::NONE) {
+            if (argc >= BINLOG_MAX_ARGS) return false;
+            switch (kind) {
+            case BinlogArgKind::INT32:
+                rec->args[argc] = static_cast<uint64_t>(static_cast<int64_t>(va_arg(ap, int)));
+                break;
+            case BinlogArgKind::INT64:
+                rec->args[argc] = va_arg(ap, uint64_t);
+                break;
+            case BinlogArgKind::DOUBLE: {
+                double d = va_arg(ap, double);
+                memcpy(&rec->args[argc], &d, sizeof(d));
+                break;
+            }
+            default:  // POINTER, STRING
+                rec->args[argc] = reinterpret_cast<uint64_t>(va_arg(ap, void *));
+                break;
+            }
+            argc++;
+        }
+        p += spec_len - 1;
+    }
+    rec->arg_count = static_cast<uint8_t>(argc);
+    return true;
+}
+
+/**
+ * Render a captured record back into text by re-walking its format string
+ * against the stored argument words.
+ *
+ * @param out Output buffer (NUL-terminated on return)
+ * @param cap Output buffer capacity
+ * @return Number of characters written (excluding the NUL)
+ */
+inline int binlog_render(char *out, size_t cap, const BinaryLogRecord *rec) {
+    size_t w = 0;
+    int argi = 0;
+    const char *p = rec->fmt;
+    while (*p != '\0' && w + 1 < cap) {
+        if (*p != '%') {
+            out[w++] = *p++;
+            continue;
+        }
+        int spec_len = 0;
+        BinlogArgKind kind = binlog_parse_spec(p, &spec_len);
+        char spec[32];
+        if (spec_len >= static_cast<int>(sizeof(spec)) ||
+            (kind != BinlogArgKind::NONE && argi >= rec->arg_count)) {
+            // Should not happen for records binlog_capture accepted.
+            out[w++] = *p++;
+            continue;
+        }
+        memcpy(spec, p, static_cast<size_t>(spec_len));
+        spec[spec_len] = '\0';
+        int n = 0;
+        switch (kind) {
+        case BinlogArgKind::NONE:
+            n = snprintf(out + w, cap - w, "%%");
+            break;
+        case BinlogArgKind::INT32:
+            n = snprintf(out + w, cap - w, spec, static_cast<int>(static_cast<int64_t>(rec->args[argi++])));
+            break;
+        case BinlogArgKind::INT64:
+            n = snprintf(out + w, cap - w, spec, rec->args[argi++]);
+            break;
+        case BinlogArgKind::DOUBLE: {
+            double d;
+            memcpy(&d, &rec->args[argi++], sizeof(d));
+            n = snprintf(out + w, cap - w, spec, d);
+            break;
+        }
+        case BinlogArgKind::POINTER:
+            n = snprintf(out + w, cap - w, spec, reinterpret_cast<void *>(rec->args[argi++]));
+            break;
+        case BinlogArgKind::STRING:
+            n = snprintf(out + w, cap - w, spec, reinterpret_cast<const char *>(rec->args[argi++]));
+            break;
+        default:
+            break;
+        }
+        if (n < 0) break;
+        w += static_cast<size_t>(n) < cap - w ? static_cast<size_t>(n) : cap - w - 1;
+        p += spec_len;
+    }
+    out[w] = '\0';
+    return static_cast<int>(w);
+}
+
+#endif  // PLATFORM_COMMON_BINARY_LOG_H_
@@ -73,6 +73,30 @@ struct KernelArgs {
     uint64_t regs{0};                                       // Per-core register base address array (platform-specific)
     uint64_t ffts_base_addr{0};                             // FFTS base address for AICore
     uint64_t dump_data_base{0};  // Dump shared memory base address; use explicit flags to detect enablement
+    uint64_t session_ctrl{0};    // SessionControl device address; zero for single-run (non-session) launches
+};
+
+/**
+ * Persistent-session control block shared between Host and AICPU
+ *
+ * Lives in host-visible device memory (rtMalloc + halHostRegister). When
+ * KernelArgs::session_ctrl is non-zero, AICPU threads do not return after
+ * one execution round: they park on run_seq and re-enter aicpu_execute()
+ * each time the host publishes a new round, so the per-run setup (SO load,
+ * thread launch, affinity gate) is paid once per session.
+ *
+ * Protocol:
+ * - Host stages the round's Runtime into the persistent runtime_args buffer,
+ *   then bumps run_seq (the doorbell).
+ * - Each surviving AICPU thread runs the round and increments done_count;
+ *   the host waits for done_count == run_seq * sche_cpu_num.
+ * - shutdown releases the parked threads and ends the kernel.
+ */
+struct SessionControl {
+    volatile uint64_t run_seq;       // Host-incremented doorbell; round N is published as run_seq == N
+    volatile uint64_t done_count;    // Incremented once per surviving AICPU thread per completed round
+    volatile uint32_t shutdown;      // Host sets non-zero to unpark threads and end the session
+    volatile uint32_t sche_cpu_num;  // Threads kept past the affinity gate (runtime_args is not yet valid at parking)
 };
 
 #ifdef __cplusplus
@@ -54,6 +54,7 @@
 #ifndef SRC_A2A3_PLATFORM_INCLUDE_COMMON_PERF_PROFILING_H_
 #define SRC_A2A3_PLATFORM_INCLUDE_COMMON_PERF_PROFILING_H_
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -65,6 +66,32 @@
 #define RUNTIME_MAX_FANOUT 128
 #endif
 
+// =============================================================================
+// Phase Markers - Intra-Kernel Timestamps (AICore micro-profiling)
+// =============================================================================
+
+// Kernels may drop up to this many phase markers per task via
+// perf_aicore_phase_marker(). Deliberately small: markers live in the WIP
+// staging slot, so the budget is bounded by what one extra record line pair
+// can hold, and a kernel worth phase-profiling rarely has more phases.
+constexpr uint32_t PERF_PHASE_MARKER_SLOTS = 8;
+
+// Marker encoding: (phase_id << PERF_PHASE_ID_SHIFT) | (timestamp & PERF_PHASE_TS_MASK).
+// 56 timestamp bits wrap after ~45 years of 50MHz sys_cnt — effectively never.
+constexpr uint32_t PERF_PHASE_ID_SHIFT = 56;
+constexpr uint64_t PERF_PHASE_TS_MASK = (1ULL << PERF_PHASE_ID_SHIFT) - 1;
+
+/** Pack a phase id and a sys_cnt timestamp into one marker word. */
+inline uint64_t perf_phase_marker_pack(uint8_t phase_id, uint64_t timestamp) {
+    return (static_cast<uint64_t>(phase_id) << PERF_PHASE_ID_SHIFT) | (timestamp & PERF_PHASE_TS_MASK);
+}
+
+/** Phase id of a marker word. */
+inline uint8_t perf_phase_marker_id(uint64_t marker) { return static_cast<uint8_t>(marker >> PERF_PHASE_ID_SHIFT); }
+
+/** Timestamp of a marker word (56 bits, same clock as PerfRecord.start_time). */
+inline uint64_t perf_phase_marker_time(uint64_t marker) { return marker & PERF_PHASE_TS_MASK; }
+
 // =============================================================================
 // PerfRecord - Single Task Execution Record
 // =============================================================================
@@ -90,30 +117,238 @@ struct PerfRecord {
     uint32_t func_id;    // Kernel function identifier
     CoreType core_type;  // Core type (AIC/AIV)
 
+    // PMU counter deltas over the task's execution (AICPU reads the core's
+    // PMU registers at dispatch and completion). Only populated for the
+    // 1-in-N tasks selected by PerfDataHeader::pmu_sample_interval; zero
+    // for unsampled tasks and on platforms without backing PMU registers.
+    uint64_t pmu_cache_miss;  // L2 cache refill events during the task
+    uint64_t pmu_bus_access;  // Bus access events during the task
+
+    // Intra-kernel phase markers, written by the kernel itself through
+    // perf_aicore_phase_marker(). The executor zeroes phase_count in the WIP
+    // slot before each kernel launch, so a count of 0 means "no markers",
+    // never "stale slot". Markers are packed (id << 56) | timestamp words in
+    // call order; timestamps share the sys_cnt clock with start_time.
+    int32_t phase_count;   // Markers recorded by this task [0, PERF_PHASE_MARKER_SLOTS]
+    uint32_t phase_pad;    // Keep phase_markers[] 8-byte aligned
+    uint64_t phase_markers[PERF_PHASE_MARKER_SLOTS];
+
     // Dependency relationship (fanout only)
     uint64_t fanout[RUNTIME_MAX_FANOUT];  // Successor task task_id array
     int32_t fanout_count;                 // Number of successor tasks
 } __attribute__((aligned(64)));
 
 static_assert(sizeof(PerfRecord) % 64 == 0, "PerfRecord must be 64-byte aligned for optimal cache performance");
+// perf_aicore_record_task() flushes the phase fields as two fixed cache
+// lines: phase_count + markers[0..5] on one, markers[6..7] on the next.
+static_assert(
+    offsetof(PerfRecord, phase_count) / 64 == offsetof(PerfRecord, phase_markers[5]) / 64,
+    "phase_count and markers[0..5] must share one cache line"
+);
+static_assert(
+    offsetof(PerfRecord, phase_markers[6]) / 64 == offsetof(PerfRecord, phase_count) / 64 + 1,
+    "markers[6..7] must sit on the line after phase_count"
+);
 
 // =============================================================================
-// PerfBuffer - Fixed-Size Record Buffer with WIP Staging Slots
+// Varint Delta Codec - Compressed Committed-Record Stream
 // =============================================================================
 
 /**
- * Fixed-size performance record buffer
+ * Committed records are stored as a byte stream of varint-encoded deltas
+ * rather than raw PerfRecord structs: a raw record is dominated by the
+ * mostly-empty fanout[RUNTIME_MAX_FANOUT] array, and per-core timestamps and
+ * task ids are near-monotonic, so deltas fit in a few bytes. This cuts the
+ * per-buffer copyback volume over the host link by ~4x.
+ *
+ * Encoding per record (all varints, signed fields zigzag-encoded):
+ *   start_time    delta vs previous record's start_time
+ *   end_time      delta vs this record's start_time
+ *   dispatch_time delta vs previous record's dispatch_time
+ *   finish_time   delta vs this record's dispatch_time
+ *   task_id       delta vs previous record's task_id
+ *   func_id       raw varint
+ *   core_type     1 byte
+ *   pmu counters  2 raw varints (cache_miss, bus_access; 1 byte each when unsampled)
+ *   fanout_count  raw varint, then fanout[i] deltas vs this record's task_id
+ *   phase_count   raw varint, then per marker: 1 raw id byte + timestamp
+ *                 delta vs this record's start_time (56-bit arithmetic)
+ *
+ * The first record of a buffer is encoded against a zero base, so every
+ * buffer decodes standalone regardless of collection order.
+ */
+
+/** Absolute fields of the previous record that the next record's deltas are taken against. */
+struct PerfDeltaBase {
+    uint64_t start_time;
+    uint64_t dispatch_time;
+    uint64_t task_id;
+};
+
+/** Worst-case encoded record size (full 10-byte varints everywhere). */
+constexpr uint32_t PERF_RECORD_ENCODED_MAX = 85 + 10u * RUNTIME_MAX_FANOUT + 11u * PERF_PHASE_MARKER_SLOTS;
+
+inline uint64_t perf_zigzag(int64_t v) { return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63); }
+
+inline int64_t perf_unzigzag(uint64_t v) { return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1); }
+
+inline uint32_t perf_varint_write(uint8_t *dst, uint64_t v) {
+    uint32_t n = 0;
+    while (v >= 0x80) {
+        dst[n++] = static_cast<uint8_t>(v) | 0x80;
+        v >>= 7;
+    }
+    dst[n++] = static_cast<uint8_t>(v);
+    return n;
+}
+
+/** @return bytes consumed, or 0 on truncated/overlong input */
+inline uint32_t perf_varint_read(const uint8_t *src, const uint8_t *end, uint64_t *out) {
+    uint64_t v = 0;
+    uint32_t shift = 0;
+    uint32_t n = 0;
+    while (src + n < end && shift < 64) {
+        uint8_t b = src[n++];
+        v |= static_cast<uint64_t>(b & 0x7F) << shift;
+        if ((b & 0x80) == 0) {
+            *out = v;
+            return n;
+        }
+        shift += 7;
+    }
+    return 0;
+}
+
+/**
+ * Encode one record into the delta stream and advance the base.
+ *
+ * @param dst Destination with at least PERF_RECORD_ENCODED_MAX bytes free
+ * @param rec Record to encode (duration is derived, not stored)
+ * @param base Delta base, zero-initialized at buffer start; updated in place
+ * @return Encoded size in bytes
+ */
+inline uint32_t perf_record_encode(uint8_t *dst, const PerfRecord *rec, PerfDeltaBase *base) {
+    uint32_t n = 0;
+    n += perf_varint_write(dst + n, perf_zigzag(static_cast<int64_t>(rec->start_time - base->start_time)));
+    n += perf_varint_write(dst + n, perf_zigzag(static_cast<int64_t>(rec->end_time - rec->start_time)));
+    n += perf_varint_write(dst + n, perf_zigzag(static_cast<int64_t>(rec->dispatch_time - base->dispatch_time)));
+    n += perf_varint_write(dst + n, perf_zigzag(static_cast<int64_t>(rec->finish_time - rec->dispatch_time)));
+    n += perf_varint_write(dst + n, perf_zigzag(static_cast<int64_t>(rec->task_id - base->task_id)));
+    n += perf_varint_write(dst + n, rec->func_id);
+    dst[n++] = static_cast<uint8_t>(rec->core_type);
+    n += perf_varint_write(dst + n, rec->pmu_cache_miss);
+    n += perf_varint_write(dst + n, rec->pmu_bus_access);
+    int32_t fc = rec->fanout_count;
+    if (fc < 0) fc = 0;
+    if (fc > RUNTIME_MAX_FANOUT) fc = RUNTIME_MAX_FANOUT;
+    n += perf_varint_write(dst + n, static_cast<uint64_t>(fc));
+    for (int32_t i = 0; i < fc; i++) {
+        n += perf_varint_write(dst + n, perf_zigzag(static_cast<int64_t>(rec->fanout[i] - rec->task_id)));
+    }
+    int32_t pc = rec->phase_count;
+    if (pc < 0) pc = 0;
+    if (pc > static_cast<int32_t>(PERF_PHASE_MARKER_SLOTS)) pc = static_cast<int32_t>(PERF_PHASE_MARKER_SLOTS);
+    n += perf_varint_write(dst + n, static_cast<uint64_t>(pc));
+    for (int32_t i = 0; i < pc; i++) {
+        dst[n++] = perf_phase_marker_id(rec->phase_markers[i]);
+        int64_t ts_delta =
+            static_cast<int64_t>(perf_phase_marker_time(rec->phase_markers[i]) - (rec->start_time & PERF_PHASE_TS_MASK));
+        n += perf_varint_write(dst + n, perf_zigzag(ts_delta));
+    }
+    base->start_time = rec->start_time;
+    base->dispatch_time = rec->dispatch_time;
+    base->task_id = rec->task_id;
+    return n;
+}
+
+/**
+ * Decode one record from the delta stream and advance the base.
  *
- * Capacity: PLATFORM_PROF_BUFFER_SIZE (defined in platform_config.h)
+ * @param src Stream position
+ * @param end One past the last committed stream byte
+ * @param rec Output record (duration reconstructed as end - start)
+ * @param base Delta base, zero-initialized at buffer start; updated in place
+ * @return Bytes consumed, or 0 on malformed/truncated input
+ */
+inline uint32_t perf_record_decode(const uint8_t *src, const uint8_t *end, PerfRecord *rec, PerfDeltaBase *base) {
+    uint64_t v = 0;
+    uint32_t n = 0;
+    uint32_t f = 0;
+
+    if ((f = perf_varint_read(src + n, end, &v)) == 0) return 0;
+    n += f;
+    rec->start_time = base->start_time + static_cast<uint64_t>(perf_unzigzag(v));
+    if ((f = perf_varint_read(src + n, end, &v)) == 0) return 0;
+    n += f;
+    rec->end_time = rec->start_time + static_cast<uint64_t>(perf_unzigzag(v));
+    rec->duration = rec->end_time - rec->start_time;
+    if ((f = perf_varint_read(src + n, end, &v)) == 0) return 0;
+    n += f;
+    rec->dispatch_time = base->dispatch_time + static_cast<uint64_t>(perf_unzigzag(v));
+    if ((f = perf_varint_read(src + n, end, &v)) == 0) return 0;
+    n += f;
+    rec->finish_time = rec->dispatch_time + static_cast<uint64_t>(perf_unzigzag(v));
+    if ((f = perf_varint_read(src + n, end, &v)) == 0) return 0;
+    n += f;
+    rec->task_id = base->task_id + static_cast<uint64_t>(perf_unzigzag(v));
+    if ((f = perf_varint_read(src + n, end, &v)) == 0) return 0;
+    n += f;
+    rec->func_id = static_cast<uint32_t>(v);
+    if (src + n >= end) return 0;
+    rec->core_type = static_cast<CoreType>(src[n]);
+    n += 1;
+    if ((f = perf_varint_read(src + n, end, &v)) == 0) return 0;
+    n += f;
+    rec->pmu_cache_miss = v;
+    if ((f = perf_varint_read(src + n, end, &v)) == 0) return 0;
+    n += f;
+    rec->pmu_bus_access = v;
+    if ((f = perf_varint_read(src + n, end, &v)) == 0 || v > static_cast<uint64_t>(RUNTIME_MAX_FANOUT)) return 0;
+    n += f;
+    rec->fanout_count = static_cast<int32_t>(v);
+    for (int32_t i = 0; i < rec->fanout_count; i++) {
+        if ((f = perf_varint_read(src + n, end, &v)) == 0) return 0;
+        n += f;
+        rec->fanout[i] = rec->task_id + static_cast<uint64_t>(perf_unzigzag(v));
+    }
+    if ((f = perf_varint_read(src + n, end, &v)) == 0 || v > static_cast<uint64_t>(PERF_PHASE_MARKER_SLOTS)) return 0;
+    n += f;
+    rec->phase_count = static_cast<int32_t>(v);
+    for (int32_t i = 0; i < rec->phase_count; i++) {
+        if (src + n >= end) return 0;
+        uint8_t phase_id = src[n];
+        n += 1;
+        if ((f = perf_varint_read(src + n, end, &v)) == 0) return 0;
+        n += f;
+        uint64_t ts = (rec->start_time + static_cast<uint64_t>(perf_unzigzag(v))) & PERF_PHASE_TS_MASK;
+        rec->phase_markers[i] = perf_phase_marker_pack(phase_id, ts);
+    }
+
+    base->start_time = rec->start_time;
+    base->dispatch_time = rec->dispatch_time;
+    base->task_id = rec->task_id;
+    return n;
+}
+
+// =============================================================================
+// PerfBuffer - Record Buffer with WIP Staging Slots and Encoded Stream
+// =============================================================================
+
+/**
+ * Performance record buffer
+ *
+ * Capacity: PLATFORM_PROF_BUFFER_SIZE records or PLATFORM_PROF_DATA_BYTES
+ * encoded bytes, whichever fills first (defined in platform_config.h).
  * Allocated dynamically by Host, pushed into per-core free_queue.
  *
- * WIP protocol: AICore writes timing to wip[reg_task_id & 1], AICPU copies
- * it into records[count] at completion. Dual-slot parity ensures no overlap.
+ * WIP protocol: AICore writes timing to wip[reg_task_id & 1], AICPU folds it
+ * into the encoded stream at completion. Dual-slot parity ensures no overlap.
  */
 struct PerfBuffer {
-    PerfRecord wip[2];                              // AICore WIP staging slots (index = reg_task_id & 1)
-    PerfRecord records[PLATFORM_PROF_BUFFER_SIZE];  // Committed records (AICPU writes)
-    volatile uint32_t count;                        // Current committed record count
+    PerfRecord wip[2];                       // AICore WIP staging slots (index = reg_task_id & 1)
+    uint8_t data[PLATFORM_PROF_DATA_BYTES];  // Committed records: varint delta stream (AICPU writes)
+    volatile uint32_t bytes_used;            // Committed stream length in bytes
+    volatile uint32_t count;                 // Current committed record count
 } __attribute__((aligned(64)));
 
 // =============================================================================
@@ -178,6 +413,39 @@ static_assert(sizeof(PerfBufferState) == 192, "PerfBufferState must be 192 bytes
 // Type alias for semantic clarity in Phase profiling context
 using PhaseBufferState = PerfBufferState;  // Per-thread Phase profiling
 
+// =============================================================================
+// PerfCycleHist - Per-Core Cycle Histograms (low-overhead sampling mode)
+// =============================================================================
+
+// Power-of-two cycle buckets: bucket 0 counts zero-cycle samples, bucket k
+// (k >= 1) counts samples in [2^(k-1), 2^k). 32 buckets cover the full
+// 32-bit cycle range.
+constexpr int PERF_HIST_BUCKETS = 32;
+
+/**
+ * Per-core fixed-bucket cycle histograms, accumulated by the AICPU task
+ * completion path at a cost of a few adds per task. Unlike PerfRecord
+ * collection there is no buffer pipeline to drain: the host reads the
+ * accumulated totals once after execution. With PerfDataHeader::hist_only
+ * set, per-task PerfRecord commits are skipped entirely and the histograms
+ * become the only — continuously affordable — latency telemetry.
+ */
+struct PerfCycleHist {
+    uint64_t dispatch_gap[PERF_HIST_BUCKETS];   // Previous task finish → this task dispatch (core idle)
+    uint64_t queue_wait[PERF_HIST_BUCKETS];     // Dispatch → kernel start (handshake latency)
+    uint64_t kernel_cycles[PERF_HIST_BUCKETS];  // Kernel start → end (execution duration)
+    uint64_t task_count;                        // Tasks folded into this histogram
+} __attribute__((aligned(64)));
+
+/**
+ * Map a cycle count to its histogram bucket.
+ */
+inline int perf_hist_bucket(uint64_t cycles) {
+    if (cycles == 0) return 0;
+    int bucket = 64 - __builtin_clzll(cycles);  // floor(log2) + 1
+    return bucket < PERF_HIST_BUCKETS ? bucket : PERF_HIST_BUCKETS - 1;
+}
+
 // =============================================================================
 // ReadyQueueEntry - Queue Entry for Ready Buffers
 // =============================================================================
@@ -230,6 +498,19 @@ struct PerfDataHeader {
     // Metadata (Host initializes, Device read-only)
     uint32_t num_cores;             // Actual number of cores launched
     volatile uint32_t total_tasks;  // Total tasks (AICPU writes after orchestration)
+
+    // Low-overhead telemetry mode (Host sets from PERF_HIST_ONLY=1): device
+    // accumulates cycle histograms but skips per-task PerfRecord commits,
+    // leaving the buffer pipeline idle.
+    uint32_t hist_only;
+
+    // PMU sampling interval (Host sets from SIMPLER_PERF_PMU_INTERVAL):
+    // AICPU reads the core's PMU registers around 1-in-N idle-core dispatches
+    // and attaches the counter deltas to the task's PerfRecord. 0 = disabled.
+    uint32_t pmu_sample_interval;
+
+    // Per-core cycle histograms, always accumulated while profiling is on.
+    PerfCycleHist cycle_hist[PLATFORM_MAX_CORES];
 } __attribute__((aligned(64)));
 
 // =============================================================================
@@ -241,6 +522,7 @@ struct PerfDataHeader {
  *
  * Scheduler phases (0-3): four phases in each scheduler loop iteration.
  * Orchestrator phases (16-24): sub-steps within each pto2_submit_task() call.
+ * Telemetry records (32+): not time slices — field reuse documented per id.
  */
 enum class AicpuPhaseId : uint32_t {
     // Scheduler phases (0-3)
@@ -250,15 +532,22 @@ enum class AicpuPhaseId : uint32_t {
     SCHED_IDLE_WAIT = 3,    // Idle/spinning (no progress)
     SCHED_PHASE_COUNT = 4,  // Sentinel: number of scheduler phases
     // Orchestrator phases (16-24)
-    ORCH_SYNC = 16,      // tensormap sync
-    ORCH_ALLOC = 17,     // task_ring_alloc
-    ORCH_PARAMS = 18,    // param copy
-    ORCH_LOOKUP = 19,    // tensormap lookup + dep
-    ORCH_HEAP = 20,      // heap alloc
-    ORCH_INSERT = 21,    // tensormap insert
-    ORCH_FANIN = 22,     // fanin + early-ready
-    ORCH_FINALIZE = 23,  // scheduler init + SM
-    ORCH_SCOPE_END = 24  // scope_end
+    ORCH_SYNC = 16,       // tensormap sync
+    ORCH_ALLOC = 17,      // task_ring_alloc
+    ORCH_PARAMS = 18,     // param copy
+    ORCH_LOOKUP = 19,     // tensormap lookup + dep
+    ORCH_HEAP = 20,       // heap alloc
+    ORCH_INSERT = 21,     // tensormap insert
+    ORCH_FANIN = 22,      // fanin + early-ready
+    ORCH_FINALIZE = 23,   // scheduler init + SM
+    ORCH_SCOPE_END = 24,  // scope_end
+    // Telemetry records (32+)
+    OCC_RING_SAMPLE = 32,       // Ring-occupancy snapshot: start_time = sample timestamp,
+                                // end_time = heap bytes live (all rings),
+                                // task_id = (tasks_live << 32) | (fanin_pool_used << 16) | dep_pool_used
+    CALIB_DISPATCH_SAMPLE = 33  // Dispatch calibration summary (PTO2_DISPATCH_CALIBRATION):
+                                // start/end = calibration window, loop_iter = no-op round trips,
+                                // task_id = (avg round-trip cycles << 32) | doorbell-scan cycles per core
 };
 
 /**
@@ -297,6 +586,15 @@ struct AicpuOrchSummary {
     uint64_t fanin_cycle;      // fanin+ready phase
     uint64_t scope_end_cycle;  // scope_end phase
     int64_t submit_count;      // Total tasks submitted
+    // Ring high-water telemetry (for right-sizing window_size / heap_size)
+    int32_t peak_live_tasks;     // Peak concurrent live tasks in any ring window
+    int32_t task_window_size;    // Per-ring task window capacity
+    uint64_t peak_heap_used;     // Peak heap ring occupancy in bytes (any ring)
+    uint64_t heap_capacity;      // Per-ring heap ring capacity in bytes
+    uint64_t alloc_task_stalls;  // Allocations that blocked on a full task window
+    uint64_t alloc_heap_stalls;  // Allocations that blocked on heap exhaustion
+    uint64_t heap_spill_count;   // Allocations served from the emergency spill segment
+    uint64_t inline_alloc_count; // Small outputs served from descriptor inline storage
     uint32_t magic;            // Validation magic (AICPU_PHASE_MAGIC)
     uint32_t padding;          // Alignment padding
 } __attribute__((aligned(64)));
@@ -315,6 +613,66 @@ struct PhaseBuffer {
     volatile uint32_t count;
 } __attribute__((aligned(64)));
 
+/**
+ * Cause attributed to an idle core interval
+ *
+ * Tagged by the scheduler at the moment a core transitions to idle, from
+ * state already visible to it (drain flags, per-ring flow control, global
+ * completion count). The interval closes on the next dispatch to that core.
+ */
+enum class PerfIdleCause : uint8_t {
+    NO_READY_TASK = 0,  // No live work upstream: orchestrator running but everything submitted has completed
+    WAITING_FANIN = 1,  // Live tasks exist but none was dispatchable (blocked on dependencies / wiring)
+    ALLOC_STALL = 2,    // Task window full: orchestrator alloc() spinning on reclaim (upstream back-pressure)
+    DRAIN = 3,          // sync_start drain or end-of-run tail (no new work will arrive)
+};
+constexpr uint32_t PERF_IDLE_CAUSE_COUNT = 4;
+
+/**
+ * Per-thread scheduler self-profiling summary (PTO2_SCHED_PROFILING)
+ *
+ * Run-to-date cycle attribution for the scheduler loop, republished from the
+ * device every publish interval so the host reads the counters directly from
+ * shared memory instead of parsing device log text. Loop-phase totals and
+ * idle-cause attribution come from the executor's SchedProfilingCounters and
+ * are published once at end of run in any profiling build; the otc_* fields
+ * are the on_mixed_task_complete sub-phase accumulators behind
+ * PTO2_SCHED_CYCLE_START/LAP and stay zero unless PTO2_SCHED_PROFILING is
+ * enabled (which also turns on periodic republishing). magic is set on first
+ * publish.
+ */
+struct AicpuSchedSummary {
+    // Scheduler loop phase cycle totals
+    uint64_t complete_cycle;  // Completion scan + task completion handling
+    uint64_t dispatch_cycle;  // Ready-queue pop + dispatch setup
+    uint64_t scan_cycle;      // Tensormap / ring maintenance scan
+    uint64_t wiring_cycle;    // Wiring queue drain (thread 0 only)
+    uint64_t idle_cycle;      // Idle back-off
+    uint64_t loop_count;      // Scheduler loop iterations
+
+    // on_mixed_task_complete sub-phase cycles
+    uint64_t lock_cycle;           // fanout_lock + state store + unlock
+    uint64_t fanout_cycle;         // Fanout traversal
+    uint64_t fanin_cycle;          // Fanin traversal
+    uint64_t self_consumed_cycle;  // Self check_and_handle_consumed
+
+    // Contention
+    uint64_t lock_wait_cycle;  // Spin-wait in fanout_lock
+    uint64_t push_wait_cycle;  // CAS contention in ready-queue push
+    uint64_t pop_wait_cycle;   // CAS contention in ready-queue pop
+    uint64_t atomic_count;     // Total atomic ops across sub-phases
+
+    int64_t complete_count;  // Tasks completed by this thread
+
+    // Idle-interval attribution for cores owned by this thread
+    // (indexed by PerfIdleCause; cycle total and interval count per cause)
+    uint64_t idle_cause_cycle[PERF_IDLE_CAUSE_COUNT];
+    uint64_t idle_cause_count[PERF_IDLE_CAUSE_COUNT];
+
+    uint32_t publish_seq;  // Incremented per publish (host sees progress)
+    uint32_t magic;        // Validation magic (AICPU_PHASE_MAGIC)
+} __attribute__((aligned(64)));
+
 /**
  * AICPU phase profiling header
  *
@@ -328,6 +686,7 @@ struct AicpuPhaseHeader {
     uint32_t num_cores;                         // Total number of cores with valid assignments
     int8_t core_to_thread[PLATFORM_MAX_CORES];  // core_id → scheduler thread index (-1 = unassigned)
     AicpuOrchSummary orch_summary;              // Orchestrator cumulative data
+    AicpuSchedSummary sched_summary[PLATFORM_MAX_AICPU_THREADS];  // Per-thread scheduler counters
 } __attribute__((aligned(64)));
 
 // =============================================================================
@@ -93,6 +93,14 @@ constexpr int PLATFORM_MAX_CORES = PLATFORM_MAX_BLOCKDIM * PLATFORM_CORES_PER_BL
  */
 constexpr int PLATFORM_PROF_BUFFER_SIZE = 1000;
 
+/**
+ * Byte capacity of the encoded committed-record stream per PerfBuffer.
+ * Committed records are stored as varint deltas (see perf_profiling.h), not
+ * raw PerfRecord structs; 288 bytes/record average is ~4x below the raw
+ * struct size and comfortably above typical encoded sizes (~30-80 bytes).
+ */
+constexpr uint32_t PLATFORM_PROF_DATA_BYTES = PLATFORM_PROF_BUFFER_SIZE * 288u;
+
 /**
  * Number of buffer slots per core/thread for dynamic profiling
  * Host dynamically allocates buffers and writes addresses into these slots.
@@ -184,6 +192,26 @@ constexpr uint64_t PLATFORM_DUMP_AVG_TENSOR_BYTES = 65536;
  */
 constexpr int PLATFORM_DUMP_MAX_DIMS = 5;
 
+/**
+ * Per-thread capacity of the per-dump-point drop counter table.
+ * Dump points beyond this count fold into an unattributed overflow counter.
+ */
+constexpr int PLATFORM_DUMP_DROP_STATS_ENTRIES = 32;
+
+/**
+ * Per-thread capacity of the dump-point content-hash cache used by
+ * PTO2_DUMP_DEDUP. One entry per dump point (func_id, arg_index); repeat
+ * hashes skip the payload copy entirely.
+ */
+constexpr int PLATFORM_DUMP_DEDUP_CACHE_ENTRIES = 32;
+
+/**
+ * Maximum number of dump filter specs parsed from PTO2_DUMP_FILTER.
+ * Each spec selects a dump point (func_id and/or arg_index) and the
+ * on-device reduction applied before the payload reaches the arena.
+ */
+constexpr int PLATFORM_DUMP_MAX_FILTERS = 16;
+
 /**
  * Ready queue capacity for dump data.
  * Sized to hold all dump buffers across all threads.
@@ -204,6 +232,12 @@ constexpr uint32_t REG_SPR_DATA_MAIN_BASE_OFFSET = 0xA0;  // Task dispatch (AICP
 constexpr uint32_t REG_SPR_COND_OFFSET = 0x4C8;           // Status (AICore→AICPU): 0=IDLE, 1=BUSY
 constexpr uint32_t REG_SPR_FAST_PATH_ENABLE_OFFSET = 0x18;
 
+// PMU event counters exposed in the per-core register block (free-running,
+// 32-bit, wrap-around). Sim platforms back these with zeroed host memory,
+// so sampled deltas read as 0 there.
+constexpr uint32_t REG_SPR_PMU_CACHE_MISS_OFFSET = 0x4D0;  // L2 cache refill (miss) event count
+constexpr uint32_t REG_SPR_PMU_BUS_ACCESS_OFFSET = 0x4D4;  // Bus access (HBM bandwidth) event count
+
 // Fast path control values
 constexpr uint32_t REG_SPR_FAST_PATH_OPEN = 0xE;
 constexpr uint32_t REG_SPR_FAST_PATH_CLOSE = 0xF;
@@ -221,6 +255,8 @@ enum class RegId : uint8_t {
     DATA_MAIN_BASE = 0,    // Task dispatch (AICPU→AICore)
     COND = 1,              // Status (AICore→AICPU)
     FAST_PATH_ENABLE = 2,  // Fast path control
+    PMU_CACHE_MISS = 3,    // PMU: L2 cache refill counter (read-only)
+    PMU_BUS_ACCESS = 4,    // PMU: bus access counter (read-only)
 };
 
 /**
@@ -234,6 +270,10 @@ constexpr uint32_t reg_offset(RegId reg) {
         return REG_SPR_COND_OFFSET;
     case RegId::FAST_PATH_ENABLE:
         return REG_SPR_FAST_PATH_ENABLE_OFFSET;
+    case RegId::PMU_CACHE_MISS:
+        return REG_SPR_PMU_CACHE_MISS_OFFSET;
+    case RegId::PMU_BUS_ACCESS:
+        return REG_SPR_PMU_BUS_ACCESS_OFFSET;
     }
     return 0;  // unreachable: all RegId cases handled above
 }
@@ -300,4 +340,27 @@ enum : uint32_t {
  */
 constexpr int AICPU_TASK_INVALID = -1;
 
+// =============================================================================
+// Instrumentation Build Profile
+// =============================================================================
+
+/**
+ * Master switch for device-side instrumentation (performance collector and
+ * tensor dump).
+ *
+ * 1 (default): runtime-togglable variant. Collector and dump entry points are
+ * compiled in and gated at runtime by host-set flags (enable_profiling, the
+ * tensor dump enable, the profiling gate).
+ *
+ * 0: strict variant. Every collector/dump entry point collapses to an inline
+ * no-op in the headers and the collector translation units compile to
+ * nothing, so runtime-checked hooks on the dispatch path fold away entirely.
+ * Verify with nm: the AICPU .so carries no perf_aicpu_* / dump_tensor_*
+ * symbols. Select via build_config.py defines; profiling macros
+ * (PTO2_PROFILING etc.) must also be 0 in a strict build.
+ */
+#ifndef PTO_INSTRUMENTATION
+#define PTO_INSTRUMENTATION 1
+#endif
+
 #endif  // SRC_A2A3_PLATFORM_INCLUDE_COMMON_PLATFORM_CONFIG_H_
@@ -70,6 +70,41 @@ enum class TensorDumpStage : uint8_t {
     AFTER_COMPLETION = 1,
 };
 
+// =============================================================================
+// TensorDumpFilterMode - On-device payload reduction applied at a dump point
+// =============================================================================
+
+/**
+ * Selects what is copied into the arena for a dump point. Everything except
+ * FULL trades payload fidelity for link bandwidth; the choice is recorded in
+ * TensorDumpRecord::filter_mode so the host collector can decode the payload.
+ */
+enum class TensorDumpFilterMode : uint8_t {
+    FULL = 0,          // Entire logical view (legacy behavior)
+    ROW_STRIDE = 1,    // Every Nth index of the outermost dimension
+    BOUNDING_BOX = 2,  // Per-dimension [begin, end) window of the logical view
+    SUMMARY = 3,       // TensorDumpSummary only (min/max/mean/NaN count)
+};
+
+// =============================================================================
+// TensorDumpSummary - Summary-only payload (SUMMARY filter mode)
+// =============================================================================
+
+/**
+ * Device-computed statistics written to the arena instead of tensor data.
+ * NaN elements are counted but excluded from min/max/mean. Cheap enough to
+ * leave enabled as a production NaN watch.
+ */
+struct TensorDumpSummary {
+    float min_val;       // Minimum over non-NaN elements (0 when all NaN/empty)
+    float max_val;       // Maximum over non-NaN elements (0 when all NaN/empty)
+    float mean;          // Mean over non-NaN elements (0 when all NaN/empty)
+    uint32_t nan_count;  // Number of NaN elements encountered
+    uint64_t elements;   // Logical elements inspected
+};
+
+static_assert(sizeof(TensorDumpSummary) == 24, "TensorDumpSummary layout is part of the dump payload format");
+
 // =============================================================================
 // TensorDumpRecord - Single Tensor Dump Entry (128B = 2 cache lines)
 // =============================================================================
@@ -95,11 +130,17 @@ struct alignas(64) TensorDumpRecord {
     uint8_t pad0_align;       // Explicit alignment before 64-bit payload offsets
     uint64_t payload_offset;  // Monotonic byte offset into thread arena
     uint64_t payload_size;    // Bytes actually copied (may be < full tensor bytes)
-    uint8_t pad0[24];         // Preserve 64B cache-line layout
+    uint8_t filter_mode;      // TensorDumpFilterMode applied on device
+    uint8_t payload_dtype;    // DataType of arena payload (== dtype unless downcast)
+    uint8_t pad_filter[2];    // Alignment before row_stride
+    uint32_t row_stride;      // ROW_STRIDE: outer-dimension stride, 0 otherwise
+    uint64_t content_hash;    // FNV-1a of logical payload bytes (0 = not hashed)
+    uint8_t dedup_ref;        // 1 = payload skipped, identical bytes shipped earlier
+    uint8_t pad0[7];          // Preserve 64B cache-line layout
 
     // === Cache line 2 (64B) ===
-    uint32_t shapes[PLATFORM_DUMP_MAX_DIMS];      // Current view shape
-    uint32_t offsets[PLATFORM_DUMP_MAX_DIMS];     // Multi-dimensional offsets
+    uint32_t shapes[PLATFORM_DUMP_MAX_DIMS];      // Dumped view shape (window/stride-reduced when filtered)
+    uint32_t offsets[PLATFORM_DUMP_MAX_DIMS];     // Multi-dimensional offsets (window begin folded in)
     uint32_t raw_shapes[PLATFORM_DUMP_MAX_DIMS];  // Underlying source layout shape
     uint8_t pad1[4];                              // Pad to 128 bytes
 } __attribute__((aligned(64)));
@@ -169,6 +210,35 @@ struct DumpBufferState {
 
 static_assert(sizeof(DumpBufferState) == 256, "DumpBufferState must be 256 bytes");
 
+// =============================================================================
+// DumpDropStats - Per-Thread, Per-Dump-Point Drop Counters
+// =============================================================================
+
+/**
+ * One dropped-record counter for a dump point (func_id, arg_index).
+ * A slot is occupied once dropped > 0; func_id/arg_index are valid only then.
+ * Single writer (the owning AICPU thread), host reads after execution.
+ */
+struct DumpDropStatEntry {
+    volatile uint32_t func_id;
+    volatile uint32_t arg_index;
+    volatile uint32_t dropped;  // Saturates at UINT32_MAX
+    uint32_t pad;
+};
+
+/**
+ * Per-thread drop accounting for the never-block dump policy. When the host
+ * falls behind, the device drops its oldest un-shipped records instead of
+ * stalling the kernel stream, and records here exactly what was lost.
+ */
+struct DumpDropStats {
+    DumpDropStatEntry entries[PLATFORM_DUMP_DROP_STATS_ENTRIES];
+    volatile uint32_t overflow_dropped;  // Drops from dump points beyond table capacity
+    uint32_t pad[15];                    // Pad to a 64B multiple
+} __attribute__((aligned(64)));
+
+static_assert(sizeof(DumpDropStats) % 64 == 0, "DumpDropStats must be cache-line padded");
+
 // =============================================================================
 // DumpReadyQueueEntry - Ready Queue Entry
 // =============================================================================
@@ -214,7 +284,11 @@ struct DumpDataHeader {
     uint32_t records_per_buffer;
     uint64_t arena_size_per_thread;
     uint32_t magic;
-    uint32_t pad;
+
+    // Watchpoint flag for trig:flag dump triggers (see TensorDumpFilterSpec).
+    // Host writes (TensorDumpCollector::set_user_trigger_flag), device reads
+    // at each triggered dump point; 0 = dump points stay silent.
+    volatile uint32_t user_trigger_flag;
 } __attribute__((aligned(64)));
 
 // =============================================================================
@@ -249,13 +323,13 @@ extern "C" {
 #endif
 
 /**
- * Calculate total memory size for dump header + buffer states.
+ * Calculate total memory size for dump header + buffer states + drop stats.
  *
  * @param num_dump_threads Number of AICPU scheduling threads
- * @return Total bytes for DumpDataHeader + DumpBufferState array
+ * @return Total bytes for DumpDataHeader + DumpBufferState + DumpDropStats arrays
  */
 inline size_t calc_dump_data_size(int num_dump_threads) {
-    return sizeof(DumpDataHeader) + num_dump_threads * sizeof(DumpBufferState);
+    return sizeof(DumpDataHeader) + num_dump_threads * (sizeof(DumpBufferState) + sizeof(DumpDropStats));
 }
 
 /**
@@ -297,6 +371,20 @@ inline DumpBufferState *get_dump_buffer_state(void *base_ptr, int thread_idx) {
     return &get_dump_buffer_states(base_ptr)[thread_idx];
 }
 
+/**
+ * Get DumpDropStats for specified thread (after the DumpBufferState array).
+ *
+ * @param base_ptr Dump shared memory base address
+ * @param num_dump_threads Number of AICPU scheduling threads
+ * @param thread_idx Thread index (0 ~ num_dump_threads-1)
+ * @return DumpDropStats pointer
+ */
+inline DumpDropStats *get_dump_drop_stats(void *base_ptr, int num_dump_threads, int thread_idx) {
+    char *region = reinterpret_cast<char *>(base_ptr) + sizeof(DumpDataHeader) +
+                   num_dump_threads * sizeof(DumpBufferState);
+    return &reinterpret_cast<DumpDropStats *>(region)[thread_idx];
+}
+
 #ifdef __cplusplus
 }
 #endif
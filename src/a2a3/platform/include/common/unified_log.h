@@ -34,6 +34,13 @@ void unified_log_info(const char *func, const char *fmt, ...);
 void unified_log_debug(const char *func, const char *fmt, ...);
 void unified_log_always(const char *func, const char *fmt, ...);
 
+// Render and emit all pending binary log records (see common/binary_log.h).
+// On the device, SIMPLER_LOG_BINARY=1 makes the functions above capture
+// (format-pointer, args) tuples into per-thread rings instead of formatting
+// at the call site; this drains them at collection time. No-op on the host
+// and when binary mode is off.
+void unified_log_flush_binary(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * @file binlog_tailer.h
+ * @brief Zero-copy host tailing of device binary log rings
+ *
+ * When the device places its SIMPLER_LOG_BINARY capture rings in a
+ * host-visible BinaryLogShm region (set_platform_binlog_base), the host
+ * tails them in place: records are rendered straight out of the mapped
+ * rings and only the per-ring read cursor advances — no bulk buffer
+ * copies, no device-side drain. Producers never overwrite unread records
+ * (a full ring drops and counts), so a stalled tailer surfaces as a drop
+ * count, never as silent wraparound loss.
+ *
+ * Rendering dereferences the captured format / function-name pointers, so
+ * the tailer requires those pointers to be valid in the host address
+ * space. That holds in simulation, where the AICPU .so is dlopen'd into
+ * the host process; on hardware the format literals live in device-side
+ * text and cannot be rendered here.
+ */
+
+#ifndef PLATFORM_HOST_BINLOG_TAILER_H_
+#define PLATFORM_HOST_BINLOG_TAILER_H_
+
+#include <cstdint>
+
+#include "common/binary_log.h"
+
+class BinlogTailer {
+public:
+    /**
+     * Attach to a BinaryLogShm region and zero it for a fresh run.
+     * Call before the device claims any ring (i.e. before thread launch).
+     */
+    void attach(void *shm_host_base);
+
+    void detach() { shm_ = nullptr; }
+
+    bool is_attached() const { return shm_ != nullptr; }
+
+    /**
+     * Render and emit all records currently published, advancing each
+     * ring's read cursor in place.
+     *
+     * @return true if any record was emitted (callers poll faster while
+     *         the rings are hot)
+     */
+    bool poll();
+
+    /**
+     * Final drain after all producer threads have exited: emits remaining
+     * records, reports per-ring drop counts, and releases the ring slots
+     * so the next run claims from a clean region. Must not run
+     * concurrently with producers.
+     */
+    void drain();
+
+    uint64_t records_emitted() const { return records_emitted_; }
+
+private:
+    BinaryLogShm *shm_{nullptr};
+    uint64_t records_emitted_{0};
+    uint64_t dropped_reported_[BINLOG_MAX_RINGS] = {};
+};
+
+#endif  // PLATFORM_HOST_BINLOG_TAILER_H_
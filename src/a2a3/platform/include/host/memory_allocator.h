@@ -10,16 +10,21 @@
  */
 /**
  * @file memory_allocator.h
- * @brief Memory Allocator - Centralized Memory Management
+ * @brief Memory Allocator - Centralized Memory Management with Size-Class Pooling
  *
  * This module provides centralized management of memory allocations with
- * automatic tracking and cleanup to prevent memory leaks.
+ * automatic tracking and cleanup to prevent memory leaks, plus a caching
+ * size-class pool so short-lived device buffers are recycled instead of
+ * round-tripping through the driver on every alloc/free.
  *
  * Platform Support:
  * - a2a3: Device memory management using CANN runtime API (rtMalloc/rtFree)
  * - a2a3sim: Host memory management using standard malloc/free
  *
  * Key Features:
+ * - Size-class freelists (powers of two, 512B..64MB) retained across steps
+ * - Bulk driver reservation: small classes carve a multi-block slab per miss
+ * - O(1) alloc/free on the pool hit path; stats for hit rate / retained bytes
  * - Automatic tracking of all allocated memory
  * - Safe deallocation with existence checking
  * - Automatic cleanup via destructor (RAII pattern)
@@ -30,8 +35,10 @@
 #define PLATFORM_MEMORY_ALLOCATOR_H_
 
 #include <cstddef>
+#include <cstdint>
 #include <mutex>
-#include <set>
+#include <unordered_map>
+#include <vector>
 
 /**
  * MemoryAllocator class for managing memory allocations
@@ -40,6 +47,13 @@
  * - a2a3: Wraps CANN runtime memory allocation APIs (rtMalloc/rtFree)
  * - a2a3sim: Wraps standard malloc/free
  *
+ * Requests are rounded up to a power-of-two size class and served from a
+ * per-class freelist when possible; only pool misses reach the driver.
+ * Small classes (<= 1MB blocks) amortize the driver call further by
+ * reserving a slab of several blocks at once. Freed blocks return to
+ * their freelist until the retained-bytes cap is reached, after which
+ * individually-allocated blocks are handed back to the driver.
+ *
  * Both implementations provide automatic tracking of allocations to
  * prevent memory leaks. Uses RAII pattern for automatic cleanup.
  */
@@ -55,9 +69,10 @@ public:
     /**
      * Allocate memory and track the pointer
      *
-     * Platform-specific behavior:
-     * - a2a3: Allocates device memory using rtMalloc
-     * - a2a3sim: Allocates host memory using malloc
+     * Served from the size-class pool when a cached block is available;
+     * otherwise forwards to the driver (one slab per miss for small
+     * classes). Requests larger than the biggest size class bypass the
+     * pool entirely.
      *
      * @param size  Size in bytes to allocate
      * @return Memory pointer on success, nullptr on failure
@@ -67,13 +82,9 @@ public:
     /**
      * Free memory if tracked
      *
-     * Checks if the pointer exists in the tracking set. If found, frees the
-     * memory and removes it from the set. Safe to call with nullptr or
-     * untracked pointers.
-     *
-     * Platform-specific behavior:
-     * - a2a3: Frees device memory using rtFree
-     * - a2a3sim: Frees host memory using free
+     * Returns the block to its size-class freelist (or to the driver if
+     * the block bypassed the pool or the retained-bytes cap is reached).
+     * Safe to call with nullptr, untracked, or already-freed pointers.
      *
      * @param ptr  Memory pointer to free
      * @return 0 on success, error code on failure, 0 if ptr not tracked
@@ -81,29 +92,78 @@ public:
     int free(void *ptr);
 
     /**
-     * Free all remaining tracked allocations
-     *
-     * Iterates through all tracked pointers, frees them, and clears the
-     * tracking set. Can be called explicitly for error checking, or
-     * automatically via destructor. Idempotent - safe to call multiple times.
+     * Release everything back to the driver: live allocations, pooled
+     * freelist blocks, and slab reservations. Can be called explicitly
+     * for error checking, or automatically via destructor. Idempotent -
+     * safe to call multiple times.
      *
      * @return 0 on success, error code if any frees failed
      */
     int finalize();
 
     /**
-     * Get number of tracked allocations
+     * Get number of live (allocated, not yet freed) blocks
      *
-     * @return Number of currently tracked pointers
+     * @return Number of currently live allocations
      */
     size_t get_allocation_count() const {
         std::lock_guard<std::mutex> lk(mu_);
-        return ptr_set_.size();
+        return live_count_;
+    }
+
+    /** Pool counters for observing hit rate and retained memory. */
+    struct PoolStats {
+        uint64_t pool_hits;    /**< Allocations served from a freelist */
+        uint64_t pool_misses;  /**< Allocations that reached the driver */
+        size_t retained_bytes; /**< Bytes currently parked in freelists */
+    };
+
+    PoolStats get_pool_stats() const {
+        std::lock_guard<std::mutex> lk(mu_);
+        return PoolStats{pool_hits_, pool_misses_, retained_bytes_};
+    }
+
+    /**
+     * Cap on bytes retained in freelists. Once reached, new slabs are not
+     * reserved and individually-allocated blocks are driver-freed instead
+     * of cached. Blocks carved from an existing slab always return to
+     * their freelist (only the slab base can be handed back to the driver).
+     */
+    void set_pool_cap_bytes(size_t cap) {
+        std::lock_guard<std::mutex> lk(mu_);
+        pool_cap_bytes_ = cap;
     }
 
 private:
+    // Size classes: 512B << c for c in [0, NUM_SIZE_CLASSES), i.e. 512B..64MB.
+    static constexpr int32_t NUM_SIZE_CLASSES = 18;
+    static constexpr size_t MIN_CLASS_SIZE = 512;
+    static constexpr size_t DEFAULT_POOL_CAP_BYTES = 256u << 20;
+
+    struct BlockInfo {
+        int32_t class_idx; /**< Size class, or -1 for pool-bypass allocations */
+        bool from_slab;    /**< Carved from a bulk slab (not individually freeable) */
+        bool live;         /**< Currently handed out to a caller */
+    };
+
+    /** Smallest class whose block size holds `size`, or -1 for pool bypass. */
+    static int32_t class_index(size_t size);
+    static size_t class_block_size(int32_t class_idx) { return MIN_CLASS_SIZE << class_idx; }
+
+    // Platform hooks: one raw driver allocation / release (a2a3: rtMalloc/rtFree,
+    // a2a3sim: malloc/free). Implemented in the platform's memory_allocator.cpp.
+    void *driver_alloc(size_t size);
+    int driver_free(void *ptr);
+
     mutable std::mutex mu_;
-    std::set<void *> ptr_set_;
+    std::unordered_map<void *, BlockInfo> blocks_;      // Every pool block until driver-freed
+    std::vector<void *> free_lists_[NUM_SIZE_CLASSES];  // Cached blocks per size class
+    std::vector<void *> slabs_;                         // Slab base pointers (freed at finalize)
+    size_t retained_bytes_{0};
+    size_t pool_cap_bytes_{DEFAULT_POOL_CAP_BYTES};
+    size_t live_count_{0};
+    uint64_t pool_hits_{0};
+    uint64_t pool_misses_{0};
 };
 
 #endif  // PLATFORM_MEMORY_ALLOCATOR_H_
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file mmap_record_writer.h
+ * @brief Memory-mapped, chunked on-disk record stream for host collectors
+ *
+ * Collectors that retain every record on the heap until the run ends pay
+ * gigabytes of host RSS on long runs plus a serialization stall at
+ * shutdown. MmapRecordWriter instead appends records into fixed-size
+ * file-backed chunks mapped one at a time: a sealed chunk is msync'd
+ * asynchronously and unmapped, so the kernel writes it back and reclaims
+ * the pages while the run continues. finalize() only flushes the active
+ * chunk and appends an index footer — O(chunks), not O(records).
+ *
+ * On-disk layout (little-endian, host-native structs):
+ *
+ *   [chunk 0][chunk 1]...[chunk N-1][used_bytes[N]][MmapStreamFooter]
+ *
+ * Each chunk holds back-to-back entries of MmapRecordEntryHeader followed
+ * by the payload, padded to 8-byte alignment. Entries never straddle a
+ * chunk boundary; the per-chunk used_bytes array in the footer tells the
+ * reader where each chunk's tail padding begins.
+ */
+
+#ifndef SRC_A2A3_PLATFORM_INCLUDE_HOST_MMAP_RECORD_WRITER_H_
+#define SRC_A2A3_PLATFORM_INCLUDE_HOST_MMAP_RECORD_WRITER_H_
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+constexpr uint64_t MMAP_STREAM_MAGIC = 0x53524D50'4F545950ULL;  // "PYTO" "PMRS"
+constexpr uint32_t MMAP_STREAM_VERSION = 1;
+constexpr uint64_t MMAP_STREAM_DEFAULT_CHUNK_BYTES = 16ULL << 20;
+
+/**
+ * Per-entry header preceding each appended payload inside a chunk
+ */
+struct MmapRecordEntryHeader {
+    uint32_t stream_id;  // Caller-defined stream (e.g. core index)
+    uint32_t bytes;      // Payload bytes following this header
+};
+
+/**
+ * Fixed-size trailer at the very end of a finalized stream file
+ */
+struct MmapStreamFooter {
+    uint64_t magic;          // MMAP_STREAM_MAGIC
+    uint32_t version;        // MMAP_STREAM_VERSION
+    uint32_t chunk_count;    // Number of data chunks preceding the index
+    uint64_t chunk_bytes;    // Size of every data chunk
+    uint64_t total_entries;  // Total appended entries across all chunks
+};
+
+/**
+ * Append-only chunked mmap writer. Single-writer, not thread-safe.
+ */
+class MmapRecordWriter {
+public:
+    MmapRecordWriter() = default;
+    ~MmapRecordWriter();
+
+    MmapRecordWriter(const MmapRecordWriter &) = delete;
+    MmapRecordWriter &operator=(const MmapRecordWriter &) = delete;
+
+    /**
+     * Create (truncate) the stream file and map the first chunk.
+     *
+     * @param path Output file path (parent directory must exist)
+     * @param chunk_bytes Data chunk size, must exceed the largest single append
+     * @return 0 on success, -1 on failure
+     */
+    int open(const std::string &path, uint64_t chunk_bytes = MMAP_STREAM_DEFAULT_CHUNK_BYTES);
+
+    /**
+     * Append one entry. Seals and unmaps the active chunk when full.
+     *
+     * @param stream_id Caller-defined stream tag
+     * @param data Payload bytes
+     * @param bytes Payload size; header + padded payload must fit in a chunk
+     * @return 0 on success, -1 on failure
+     */
+    int append(uint32_t stream_id, const void *data, uint64_t bytes);
+
+    /**
+     * Seal the active chunk, write the index footer, and close the file.
+     * The writer is unusable afterwards. Idempotent.
+     *
+     * @return 0 on success, -1 on failure
+     */
+    int finalize();
+
+    bool is_open() const { return fd_ >= 0; }
+    uint64_t total_entries() const { return total_entries_; }
+    const std::string &path() const { return path_; }
+
+private:
+    int map_next_chunk();
+    void seal_active_chunk();
+
+    std::string path_;
+    int fd_{-1};
+    uint64_t chunk_bytes_{0};
+    void *active_chunk_{nullptr};
+    uint64_t active_used_{0};
+    std::vector<uint64_t> chunk_used_;  // Sealed-chunk fill levels (index footer)
+    uint64_t total_entries_{0};
+};
+
+/**
+ * Read-only companion: maps a finalized stream file and iterates entries.
+ */
+class MmapRecordReader {
+public:
+    MmapRecordReader() = default;
+    ~MmapRecordReader();
+
+    MmapRecordReader(const MmapRecordReader &) = delete;
+    MmapRecordReader &operator=(const MmapRecordReader &) = delete;
+
+    /**
+     * Map a finalized stream file and validate its footer.
+     *
+     * @return 0 on success, -1 on missing file or bad footer
+     */
+    int open(const std::string &path);
+
+    /**
+     * Visit every entry in append order.
+     *
+     * @param visit Callback receiving (stream_id, payload, bytes)
+     */
+    void for_each(const std::function<void(uint32_t, const void *, uint64_t)> &visit) const;
+
+    void close();
+
+    bool is_open() const { return base_ != nullptr; }
+    uint64_t total_entries() const { return footer_.total_entries; }
+
+private:
+    void *base_{nullptr};
+    uint64_t file_size_{0};
+    MmapStreamFooter footer_{};
+    const uint64_t *chunk_used_{nullptr};
+};
+
+#endif  // SRC_A2A3_PLATFORM_INCLUDE_HOST_MMAP_RECORD_WRITER_H_
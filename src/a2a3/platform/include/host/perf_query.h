@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * @file perf_query.h
+ * @brief Columnar in-memory view of a collected perf run for post-run analysis
+ *
+ * Loads a finalized SIMPLER_PERF_MMAP_STREAM file (raw PerfRecord batches
+ * appended by PerformanceCollector, one stream id per core) into
+ * structure-of-arrays columns and answers filter/groupby/percentile queries
+ * natively. One record becomes one row across all columns, so a column can
+ * be handed to numpy as a zero-copy 1-D view; the per-record fanout array is
+ * reduced to its count, which is what the analysis scripts consume.
+ *
+ * Row order is the stream append order (per-core batches interleaved by
+ * collection), not global time order; queries that need time ordering sort
+ * the selection they return.
+ */
+
+#ifndef SRC_A2A3_PLATFORM_INCLUDE_HOST_PERF_QUERY_H_
+#define SRC_A2A3_PLATFORM_INCLUDE_HOST_PERF_QUERY_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Aggregate over one group-by bucket (a func_id or a core index)
+ */
+struct PerfGroupStats {
+    uint32_t key;
+    uint64_t count;
+    uint64_t total_duration;
+    uint64_t min_duration;
+    uint64_t max_duration;
+};
+
+/**
+ * Columnar perf run. Load once, query many times; all columns share row
+ * indices. Not thread-safe during load; queries are const and may run
+ * concurrently afterwards.
+ */
+class PerfRunData {
+public:
+    /**
+     * Load a finalized record stream file.
+     *
+     * Rows from a previous load are replaced. Entries whose payload is not
+     * a whole number of PerfRecord structs are rejected.
+     *
+     * @param path Stream file written via SIMPLER_PERF_MMAP_STREAM
+     * @return 0 on success, -1 on missing/corrupt file
+     */
+    int load(const std::string &path);
+
+    size_t size() const { return task_id_.size(); }
+
+    // Column views (valid until the next load)
+    const std::vector<uint64_t> &task_id() const { return task_id_; }
+    const std::vector<uint64_t> &start_time() const { return start_time_; }
+    const std::vector<uint64_t> &end_time() const { return end_time_; }
+    const std::vector<uint64_t> &duration() const { return duration_; }
+    const std::vector<uint64_t> &dispatch_time() const { return dispatch_time_; }
+    const std::vector<uint64_t> &finish_time() const { return finish_time_; }
+    const std::vector<uint32_t> &func_id() const { return func_id_; }
+    const std::vector<uint32_t> &core_id() const { return core_id_; }
+    const std::vector<uint8_t> &core_type() const { return core_type_; }
+    const std::vector<uint64_t> &pmu_cache_miss() const { return pmu_cache_miss_; }
+    const std::vector<uint64_t> &pmu_bus_access() const { return pmu_bus_access_; }
+    const std::vector<int32_t> &fanout_count() const { return fanout_count_; }
+
+    /**
+     * Row indices matching all given predicates, in start_time order.
+     *
+     * @param func_id Match this kernel, or -1 for any
+     * @param core_id Match this core index, or -1 for any
+     * @param core_type Match this CoreType value, or -1 for any
+     * @param start_after Keep rows with start_time >= this (0 = no bound)
+     * @param end_before Keep rows with end_time <= this (0 = no bound)
+     */
+    std::vector<uint64_t> filter_indices(int64_t func_id, int64_t core_id, int64_t core_type,
+                                         uint64_t start_after, uint64_t end_before) const;
+
+    /** Per-kernel duration stats, sorted by descending total_duration. */
+    std::vector<PerfGroupStats> group_by_func() const;
+
+    /** Per-core duration stats, sorted by core index. */
+    std::vector<PerfGroupStats> group_by_core() const;
+
+    /**
+     * Duration percentile over all rows (nearest-rank, no full sort).
+     *
+     * @param q Percentile in [0, 100]
+     * @return 0 when the run is empty
+     */
+    uint64_t duration_percentile(double q) const;
+
+    /** Duration percentile over a row selection from filter_indices(). */
+    uint64_t duration_percentile(double q, const std::vector<uint64_t> &rows) const;
+
+private:
+    void clear();
+    void append_records(uint32_t core_index, const void *data, uint64_t bytes);
+    std::vector<PerfGroupStats> group_durations(const std::vector<uint32_t> &keys) const;
+
+    std::vector<uint64_t> task_id_;
+    std::vector<uint64_t> start_time_;
+    std::vector<uint64_t> end_time_;
+    std::vector<uint64_t> duration_;
+    std::vector<uint64_t> dispatch_time_;
+    std::vector<uint64_t> finish_time_;
+    std::vector<uint32_t> func_id_;
+    std::vector<uint32_t> core_id_;
+    std::vector<uint8_t> core_type_;
+    std::vector<uint64_t> pmu_cache_miss_;
+    std::vector<uint64_t> pmu_bus_access_;
+    std::vector<int32_t> fanout_count_;
+};
+
+#endif  // SRC_A2A3_PLATFORM_INCLUDE_HOST_PERF_QUERY_H_
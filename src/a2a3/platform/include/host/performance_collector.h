@@ -26,10 +26,8 @@
 #define SRC_A2A3_PLATFORM_INCLUDE_HOST_PERFORMANCE_COLLECTOR_H_
 
 #include <atomic>
-#include <condition_variable>
 #include <functional>
-#include <mutex>
-#include <queue>
+#include <memory>
 #include <string>
 #include <thread>
 #include <unordered_map>
@@ -37,6 +35,7 @@
 
 #include "common/perf_profiling.h"
 #include "common/platform_config.h"
+#include "host/mmap_record_writer.h"
 #include "runtime.h"
 
 /**
@@ -115,6 +114,62 @@ struct CopyDoneInfo {
     ProfBufferType type;   // Buffer type (for recycling)
 };
 
+/**
+ * Capacity of the host-side handoff rings (ready buffers / copy-done).
+ *
+ * Buffers circulate in a closed loop (pre-allocated pools + rare alloc
+ * fallback), so the number of entries in flight is bounded by the total
+ * pre-allocation count. Sized above that bound, rounded to a power of two.
+ */
+constexpr uint32_t PROF_HOST_RING_CAPACITY = 1024;
+static_assert(
+    PROF_HOST_RING_CAPACITY >= PLATFORM_PROF_READYQUEUE_SIZE, "handoff ring must cover all pre-allocated buffers"
+);
+
+/**
+ * Lock-free single-producer/single-consumer ring for the mgmt-thread <->
+ * collector-thread buffer handoff.
+ *
+ * The previous mutex+condvar queues serialized the collector against the
+ * management thread on every buffer exchange; under heavy profiling the
+ * resulting contention delayed buffer recycling enough to stall the device.
+ * Here the producer only writes tail_, the consumer only writes head_, and
+ * acquire/release ordering publishes the slot contents.
+ */
+template <typename T, uint32_t Capacity>
+class SpscRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    bool try_push(const T &item) {
+        uint32_t tail = tail_.load(std::memory_order_relaxed);
+        uint32_t head = head_.load(std::memory_order_acquire);
+        if (tail - head >= Capacity) {
+            return false;
+        }
+        slots_[tail & (Capacity - 1)] = item;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool try_pop(T &item) {
+        uint32_t head = head_.load(std::memory_order_relaxed);
+        uint32_t tail = tail_.load(std::memory_order_acquire);
+        if (head == tail) {
+            return false;
+        }
+        item = slots_[head & (Capacity - 1)];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    T slots_[Capacity];
+    // Separate cache lines so producer and consumer indices don't false-share
+    alignas(64) std::atomic<uint32_t> head_{0};
+    alignas(64) std::atomic<uint32_t> tail_{0};
+};
+
 /**
  * Dynamic profiling buffer memory manager
  *
@@ -205,14 +260,11 @@ private:
     PerfFreeCallback free_cb_{nullptr};
     int device_id_{-1};
 
-    // Management thread → main thread (ready buffers)
-    std::mutex ready_mutex_;
-    std::condition_variable ready_cv_;
-    std::queue<ReadyBufferInfo> ready_queue_;
+    // Management thread → main thread (ready buffers), lock-free SPSC
+    SpscRing<ReadyBufferInfo, PROF_HOST_RING_CAPACITY> ready_ring_;
 
-    // Main thread → management thread (buffers to free)
-    std::mutex done_mutex_;
-    std::queue<CopyDoneInfo> done_queue_;
+    // Main thread → management thread (buffers to free), lock-free SPSC
+    SpscRing<CopyDoneInfo, PROF_HOST_RING_CAPACITY> done_ring_;
 
     // Device-to-host pointer mapping (populated during alloc_and_register)
     std::unordered_map<void *, void *> dev_to_host_;
@@ -221,6 +273,9 @@ private:
     std::vector<void *> recycled_perf_buffers_;
     std::vector<void *> recycled_phase_buffers_;
 
+    // Low-watermark alarm state for the recycled perf-buffer pool
+    bool recycled_low_warned_{false};
+
     // Management thread main loop
     void mgmt_loop();
 
@@ -304,13 +359,26 @@ public:
     void poll_and_collect(int expected_tasks = 0);
 
     /**
-     * Export performance data to Chrome Trace Event Format
+     * Export performance data to the swimlane JSON format
      *
      * @param output_path Output directory path
      * @return 0 on success, error code on failure
      */
     int export_swimlane_json(const std::string &output_path = "outputs");
 
+    /**
+     * Export a merged timeline in Chrome Trace Event Format (Perfetto-loadable)
+     *
+     * Merges AICore task records, AICPU scheduler/orchestrator phase records,
+     * and the orchestrator summary onto the shared device clock: one process
+     * per event source, one track per core or AICPU thread. Open the file in
+     * the Perfetto UI or chrome://tracing.
+     *
+     * @param output_path Output directory path (SIMPLER_PERF_OUTPUT_DIR overrides)
+     * @return 0 on success, error code on failure
+     */
+    int export_chrome_trace(const std::string &output_path = "outputs");
+
     /**
      * Stop the memory management thread and clean up remaining data
      *
@@ -396,6 +464,8 @@ private:
     // AICPU phase profiling data (per-thread, mixed sched + orch records)
     std::vector<std::vector<AicpuPhaseRecord>> collected_phase_records_;
     AicpuOrchSummary collected_orch_summary_{};
+    // Per-thread scheduler cycle summaries (entries with magic == AICPU_PHASE_MAGIC are valid)
+    std::vector<AicpuSchedSummary> collected_sched_summaries_;
     bool has_phase_data_{false};
 
     // Core-to-thread mapping (core_id → scheduler thread index, -1 = unassigned)
@@ -404,8 +474,30 @@ private:
     // Signal from device_runner that execution is complete
     std::atomic<bool> execution_complete_{false};
 
+    // Streaming record sink (SIMPLER_PERF_MMAP_STREAM): perf records are
+    // appended to a chunked mmap-backed file during collection instead of
+    // accumulating in collected_perf_records_, keeping host RSS flat on
+    // long runs. Exports load them back from the file on demand.
+    std::unique_ptr<MmapRecordWriter> record_stream_;
+    std::vector<PerfRecord> stream_scratch_;  // Per-buffer decode staging
+    bool stream_loaded_{false};               // Streamed records re-materialized
+
+    // Open the streaming sink if SIMPLER_PERF_MMAP_STREAM is set
+    void open_record_stream();
+
+    // Decode one PerfBuffer into the streaming sink or the heap vectors
+    uint32_t ingest_perf_buffer(uint32_t core_index, const PerfBuffer *buf);
+
+    // Re-materialize streamed records into collected_perf_records_ for export
+    void load_streamed_records();
+
     // Allocate a single buffer (PerfBuffer or PhaseBuffer) and register it
     void *alloc_single_buffer(size_t size, void **host_ptr_out);
+
+    // Aggregate per-core cycle histograms from PerfDataHeader and log a
+    // per-metric summary (count, p50/p99/max bucket bounds). Called from
+    // finalize() while the shared-memory mapping is still valid.
+    void report_cycle_histograms(const PerfDataHeader *header);
 };
 
 #endif  // SRC_A2A3_PLATFORM_INCLUDE_HOST_PERFORMANCE_COLLECTOR_H_
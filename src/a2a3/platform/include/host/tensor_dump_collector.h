@@ -189,6 +189,13 @@ struct DumpedTensor {
     bool is_contiguous;
     bool truncated;
     bool overwritten;
+    uint8_t filter_mode;    // TensorDumpFilterMode applied on device
+    uint8_t payload_dtype;  // DataType of payload bytes (== dtype unless downcast)
+    uint32_t row_stride;    // ROW_STRIDE filter: outer-dimension stride, 0 otherwise
+    bool has_summary;       // SUMMARY filter: summary decoded, no bin payload
+    TensorDumpSummary summary;
+    uint64_t content_hash;  // FNV-1a of payload source bytes (0 = not hashed)
+    bool dedup_ref;         // Payload identical to an earlier dump; bin_offset points there
     uint64_t payload_size;  // original payload size (bytes may be cleared after writing)
     uint64_t bin_offset;    // byte offset into tensors.bin
     std::vector<uint8_t> bytes;
@@ -229,6 +236,13 @@ public:
 
     void *get_dump_shm_device_ptr() const { return dump_shared_mem_dev_; }
 
+    /**
+     * Arm or disarm trig:flag dump points (DumpDataHeader::user_trigger_flag).
+     * Safe to flip while the device is executing; takes effect at the next
+     * dump point evaluation.
+     */
+    void set_user_trigger_flag(bool armed);
+
 private:
     void *dump_shared_mem_dev_{nullptr};
     void *dump_shared_mem_host_{nullptr};
@@ -264,6 +278,30 @@ private:
     uint32_t total_dropped_record_count_{0};
     uint32_t total_truncated_count_{0};
     uint32_t total_overwrite_count_{0};
+    uint32_t total_summary_count_{0};
+    uint32_t total_nan_summary_count_{0};  // Summary records with nan_count > 0
+
+    // Per-dump-point drop attribution aggregated across threads
+    struct DumpPointDrops {
+        uint32_t func_id;
+        uint32_t arg_index;
+        uint64_t dropped;
+    };
+    std::vector<DumpPointDrops> dropped_by_point_;
+    uint64_t dropped_unattributed_{0};  // Drops past the per-thread attribution table
+
+    // PTO2_DUMP_DEDUP: payload location of each content hash already written
+    // to tensors.bin, so dedup records (and host-detected repeats) can point
+    // at the existing bytes instead of storing them again.
+    struct DedupPayloadRef {
+        uint64_t bin_offset;
+        uint64_t payload_size;
+        uint8_t payload_dtype;
+    };
+    std::unordered_map<uint64_t, DedupPayloadRef> dedup_payloads_;
+    uint32_t total_dedup_count_{0};
+    uint64_t dedup_saved_bytes_{0};
+    uint64_t dedup_unresolved_{0};  // dedup_ref records whose hash was never seen with bytes
 
     void *alloc_single_buffer(size_t size, void **host_ptr_out);
     void process_dump_buffer(const DumpReadyBufferInfo &info);
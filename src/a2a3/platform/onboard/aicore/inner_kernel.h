@@ -35,6 +35,9 @@
 // SPIN_WAIT_HINT - no-op on real hardware (AICore has dedicated polling support)
 #define SPIN_WAIT_HINT() ((void)0)
 
+// SIM_CHARGE_TASK_COST - no-op on real hardware (sim-only kernel cost model)
+#define SIM_CHARGE_TASK_COST(fn_addr) ((void)0)
+
 // OUT_OF_ORDER_STORE_BARRIER - no-op on real hardware (dcci handles cache coherency)
 #define OUT_OF_ORDER_STORE_BARRIER() ((void)0)
 
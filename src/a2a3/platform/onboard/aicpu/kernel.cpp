@@ -12,6 +12,7 @@
 
 #include "common/unified_log.h"
 #include "common/kernel_args.h"
+#include "common/memory_barrier.h"
 #include "common/platform_config.h"
 #include "aicpu/device_log.h"
 #include "aicpu/platform_regs.h"
@@ -22,6 +23,46 @@
 // Forward declaration of aicpu_execute (implemented in aicpu_executor.cpp)
 extern "C" int aicpu_execute(Runtime *arg);
 
+/**
+ * Persistent-session loop for one surviving AICPU thread
+ *
+ * Parks on SessionControl::run_seq and runs one execution round per host
+ * doorbell until shutdown. The executor already supports repeated rounds
+ * (its deinit leaves the Runtime ready for the next round's Host DMA), so
+ * each round is a plain aicpu_execute() call on the refreshed runtime_args.
+ *
+ * @param session  Session control block (host-visible device memory)
+ * @param runtime  Persistent runtime buffer, re-staged by the host per round
+ * @return 0 on clean shutdown, first failing round's error code otherwise
+ */
+static int session_loop(SessionControl *session, Runtime *runtime) {
+    uint64_t last_seq = 0;
+    int rc = 0;
+    for (;;) {
+        while (session->run_seq == last_seq && session->shutdown == 0) {
+            // Parked spin; yielding to the OS scheduler is forbidden on the AICPU.
+        }
+        if (session->shutdown != 0) {
+            break;
+        }
+        last_seq = session->run_seq;
+        rmb();  // Runtime staging (Host DMA) precedes the doorbell
+
+        int round_rc = aicpu_execute(runtime);
+        if (round_rc != 0) {
+            LOG_ERROR("session round %lu: aicpu_execute failed with rc=%d", last_seq, round_rc);
+            if (rc == 0) {
+                rc = round_rc;
+            }
+        }
+        // ACQ_REL publishes this round's runtime writes before the host
+        // observes the completion count.
+        __atomic_fetch_add(const_cast<uint64_t *>(&session->done_count), 1, __ATOMIC_ACQ_REL);
+    }
+    LOG_INFO("session_loop: shutdown after %lu rounds", last_seq);
+    return rc;
+}
+
 extern "C" __attribute__((visibility("default"))) int StaticTileFwkBackendKernelServer(void *arg) {
     if (arg == nullptr) {
         LOG_ERROR("%s", "Invalid kernel arguments: null pointer");
@@ -79,19 +120,34 @@ extern "C" __attribute__((visibility("default"))) int DynTileFwkBackendKernelSer
         return -1;
     }
 
+    auto *session = reinterpret_cast<SessionControl *>(k_args->session_ctrl);
+
     // Store platform regs before calling aicpu_execute
     // Dump enable is an execution control flag propagated via handshake.
     // The dump base address is only the backing storage location.
     set_platform_regs(k_args->regs);
     set_platform_dump_base(k_args->dump_data_base);
-    set_enable_dump_tensor(GET_PROFILING_FLAG(runtime->workers[0].enable_profiling_flag, PROFILING_FLAG_DUMP_TENSOR));
+    // In session mode the runtime buffer is not staged until the first
+    // doorbell, so its flags cannot be read here; tensor dump is a
+    // single-run feature and stays off for session launches.
+    bool enable_dump =
+        session == nullptr &&
+        GET_PROFILING_FLAG(runtime->workers[0].enable_profiling_flag, PROFILING_FLAG_DUMP_TENSOR);
+    set_enable_dump_tensor(enable_dump);
 
-    // Affinity gate: drop excess threads before entering runtime
-    if (!platform_aicpu_affinity_gate(runtime->sche_cpu_num, PLATFORM_MAX_AICPU_THREADS_JUST_FOR_LAUNCH)) {
+    // Affinity gate: drop excess threads before entering runtime. Session
+    // launches carry the thread count in SessionControl for the same reason.
+    uint32_t sche_cpu_num = session != nullptr ? session->sche_cpu_num : runtime->sche_cpu_num;
+    if (!platform_aicpu_affinity_gate(sche_cpu_num, PLATFORM_MAX_AICPU_THREADS_JUST_FOR_LAUNCH)) {
         LOG_INFO("Thread dropped by cluster affinity");
         return 0;
     }
 
+    if (session != nullptr) {
+        LOG_INFO("%s", "DynTileFwkBackendKernelServer: Entering persistent session loop");
+        return session_loop(session, runtime);
+    }
+
     LOG_INFO("%s", "DynTileFwkBackendKernelServer: Calling aicpu_execute with Runtime");
     int rc = aicpu_execute(runtime);
     if (rc != 0) {
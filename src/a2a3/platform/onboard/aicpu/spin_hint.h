@@ -9,6 +9,33 @@
 #ifndef PLATFORM_A2A3_AICPU_SPIN_HINT_H_
 #define PLATFORM_A2A3_AICPU_SPIN_HINT_H_
 
+#include <stdint.h>
+
 #define SPIN_WAIT_HINT() ((void)0)
 
+/**
+ * Bare architectural pause for idle back-off bursts: takes the polling loop
+ * off the memory system for a few cycles without descheduling.
+ */
+#if defined(__aarch64__)
+#define SPIN_PAUSE_HINT() __asm__ volatile("yield" ::: "memory")
+#else
+#define SPIN_PAUSE_HINT() ((void)0)
+#endif
+
+/**
+ * Deep-idle wait: arm the exclusive monitor on the given cacheline and sleep
+ * until a store to it — or the periodic WFE event stream — wakes the core.
+ * A bounded-latency nap; the core never deschedules.
+ */
+#if defined(__aarch64__)
+#define SPIN_MONITOR_WAIT(addr)                                                                 \
+    do {                                                                                        \
+        uint32_t monitor_tmp_;                                                                  \
+        __asm__ volatile("ldaxr %w0, [%1]\n\twfe" : "=&r"(monitor_tmp_) : "r"(addr) : "memory"); \
+    } while (0)
+#else
+#define SPIN_MONITOR_WAIT(addr) ((void)(addr))
+#endif
+
 #endif  // PLATFORM_A2A3_AICPU_SPIN_HINT_H_
@@ -18,8 +18,10 @@
 #include "device_runner.h"
 
 #include <dlfcn.h>
+#include <unistd.h>
 
 #include <cassert>
+#include <cstdlib>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -29,6 +31,7 @@
 #include "callable.h"
 #include "host/host_regs.h"  // Register address retrieval
 #include "host/raii_scope_guard.h"
+#include "launch_trace.h"
 
 // =============================================================================
 // Lazy-loaded HAL (ascend_hal) for profiling host-register only
@@ -65,6 +68,16 @@ HalHostUnregisterFn get_halHostUnregister() {
     return reinterpret_cast<HalHostUnregisterFn>(dlsym(g_hal_handle, "halHostUnregister"));
 }
 
+// FNV-1a content hash for the kernel binary cache.
+uint64_t fnv1a_hash(const uint8_t *data, size_t size) {
+    uint64_t h = 0xCBF29CE484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        h ^= data[i];
+        h *= 0x100000001B3ULL;
+    }
+    return h;
+}
+
 }  // namespace
 
 // =============================================================================
@@ -108,6 +121,7 @@ int KernelArgsHelper::finalize_device_args() {
 int KernelArgsHelper::init_runtime_args(const Runtime &host_runtime, MemoryAllocator &allocator) {
     allocator_ = &allocator;
 
+    bool fresh_buffer = false;
     if (args.runtime_args == nullptr) {
         uint64_t runtime_size = sizeof(Runtime);
         void *runtime_dev = allocator_->alloc(runtime_size);
@@ -116,7 +130,65 @@ int KernelArgsHelper::init_runtime_args(const Runtime &host_runtime, MemoryAlloc
             return -1;
         }
         args.runtime_args = reinterpret_cast<Runtime *>(runtime_dev);
+        fresh_buffer = true;
+    }
+
+    const uint8_t *image = reinterpret_cast<const uint8_t *>(&host_runtime);
+
+    // Delta path: the device buffer survived from a previous upload, so only
+    // changed chunks need to travel; each rtMemcpy patches the device image in
+    // place at its offset. The header up to the task array holds the worker
+    // handshake buffers, which the device writes during execution — the shadow
+    // cannot vouch for those bytes, so that region re-uploads every round.
+    // Spent fanin counters inside tasks[] are the other device-side mutation;
+    // the AICPU rebuilds those from the fanout lists during init
+    // (AicpuExecutor::restore_task_fanins), so task chunks diff cleanly.
+    if (!fresh_buffer && runtime_shadow_.size() == sizeof(Runtime)) {
+        uint8_t *dev_bytes = reinterpret_cast<uint8_t *>(args.runtime_args);
+        size_t header_bytes =
+            static_cast<size_t>(reinterpret_cast<const uint8_t *>(&host_runtime.tasks[0]) - image);
+        size_t copied_bytes = 0;
+        size_t copy_count = 0;
+        size_t offset = 0;
+        while (offset < sizeof(Runtime)) {
+            size_t chunk = sizeof(Runtime) - offset;
+            if (chunk > RUNTIME_DELTA_CHUNK_BYTES) {
+                chunk = RUNTIME_DELTA_CHUNK_BYTES;
+            }
+            if (offset >= header_bytes && memcmp(runtime_shadow_.data() + offset, image + offset, chunk) == 0) {
+                offset += chunk;
+                continue;
+            }
+            // Extend the dirty run through every consecutive dirty chunk
+            size_t run_end = offset + chunk;
+            while (run_end < sizeof(Runtime)) {
+                size_t next = sizeof(Runtime) - run_end;
+                if (next > RUNTIME_DELTA_CHUNK_BYTES) {
+                    next = RUNTIME_DELTA_CHUNK_BYTES;
+                }
+                if (memcmp(runtime_shadow_.data() + run_end, image + run_end, next) == 0) {
+                    break;
+                }
+                run_end += next;
+            }
+            size_t run_size = run_end - offset;
+            int rc = rtMemcpy(dev_bytes + offset, run_size, image + offset, run_size, RT_MEMCPY_HOST_TO_DEVICE);
+            if (rc != 0) {
+                LOG_ERROR("rtMemcpy for runtime delta failed: %d", rc);
+                runtime_shadow_.clear();  // Shadow no longer matches the device image
+                return rc;
+            }
+            memcpy(runtime_shadow_.data() + offset, image + offset, run_size);
+            copied_bytes += run_size;
+            copy_count++;
+            offset = run_end;
+        }
+        LOG_DEBUG(
+            "Runtime delta upload: %zu bytes in %zu range(s) of %zu total", copied_bytes, copy_count, sizeof(Runtime)
+        );
+        return 0;
     }
+
     int rc = rtMemcpy(args.runtime_args, sizeof(Runtime), &host_runtime, sizeof(Runtime), RT_MEMCPY_HOST_TO_DEVICE);
     if (rc != 0) {
         LOG_ERROR("rtMemcpy for runtime failed: %d", rc);
@@ -124,10 +196,13 @@ int KernelArgsHelper::init_runtime_args(const Runtime &host_runtime, MemoryAlloc
         args.runtime_args = nullptr;
         return rc;
     }
+    runtime_shadow_.assign(image, image + sizeof(Runtime));
     return 0;
 }
 
 int KernelArgsHelper::finalize_runtime_args() {
+    runtime_shadow_.clear();
+    runtime_shadow_.shrink_to_fit();
     if (args.runtime_args != nullptr && allocator_ != nullptr) {
         int rc = allocator_->free(args.runtime_args);
         args.runtime_args = nullptr;
@@ -302,6 +377,9 @@ int DeviceRunner::prepare_run_context(int device_id) {
 }
 
 void DeviceRunner::release_run_context() {
+    // Pending async uploads must land before their stream is destroyed
+    flush_kernel_uploads();
+
     // Destroy streams (they belong to the current thread's CANN context)
     if (stream_aicpu_ != nullptr) {
         rtStreamDestroy(stream_aicpu_);
@@ -311,6 +389,10 @@ void DeviceRunner::release_run_context() {
         rtStreamDestroy(stream_aicore_);
         stream_aicore_ = nullptr;
     }
+    if (stream_copy_ != nullptr) {
+        rtStreamDestroy(stream_copy_);
+        stream_copy_ = nullptr;
+    }
 }
 
 int DeviceRunner::ensure_binaries_loaded(
@@ -371,6 +453,178 @@ int DeviceRunner::copy_from_device(void *host_ptr, const void *dev_ptr, size_t b
     return rtMemcpy(host_ptr, bytes, dev_ptr, bytes, RT_MEMCPY_DEVICE_TO_HOST);
 }
 
+int DeviceRunner::copy_between_device(void *dst_dev, const void *src_dev, size_t bytes) {
+    return rtMemcpy(dst_dev, bytes, src_dev, bytes, RT_MEMCPY_DEVICE_TO_DEVICE);
+}
+
+int DeviceRunner::copy_to_device_async(void *dev_ptr, const void *host_ptr, size_t bytes) {
+    if (stream_copy_ == nullptr) {
+        int rc = rtStreamCreate(&stream_copy_, 0);
+        if (rc != 0) {
+            LOG_WARN("rtStreamCreate (copy) failed: %d, async uploads degrade to direct copies", rc);
+            stream_copy_ = nullptr;
+        }
+    }
+    if (stream_copy_ == nullptr) {
+        return copy_to_device(dev_ptr, host_ptr, bytes);
+    }
+    int rc = rtMemcpyAsync(dev_ptr, bytes, host_ptr, bytes, RT_MEMCPY_HOST_TO_DEVICE, stream_copy_);
+    if (rc != 0) {
+        LOG_ERROR("rtMemcpyAsync (%zu bytes) failed: %d", bytes, rc);
+        return rc;
+    }
+    async_copies_in_flight_ = true;
+    return 0;
+}
+
+int DeviceRunner::copy_sync() {
+    if (!async_copies_in_flight_) {
+        return 0;
+    }
+    async_copies_in_flight_ = false;
+    int rc = rtStreamSynchronize(stream_copy_);
+    if (rc != 0) {
+        LOG_ERROR("rtStreamSynchronize (copy) failed: %d", rc);
+    }
+    return rc;
+}
+
+int DeviceRunner::warm_up(int device_id) {
+    int rc = prepare_run_context(device_id);
+    if (rc != 0) {
+        return rc;
+    }
+
+    // Pre-fault the host staging pages; these first-touch faults would
+    // otherwise land inside the first run's upload path.
+    std::vector<uint8_t> host_scratch(WARM_UP_BYTES);
+    const size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    for (size_t off = 0; off < host_scratch.size(); off += page) {
+        host_scratch[off] = 0;
+    }
+
+    // Device scratch from the allocator pool: faults the device pages now
+    // and parks the block in its freelist afterwards, so the first real
+    // allocations (shared-memory window, GM heap ring) are pool hits on
+    // warm memory.
+    void *dev_scratch = mem_alloc_.alloc(WARM_UP_BYTES);
+    if (dev_scratch == nullptr) {
+        LOG_ERROR("warm_up: device scratch allocation (%zu bytes) failed", WARM_UP_BYTES);
+        return -1;
+    }
+
+    // No-op pipeline flush: one round trip through the async copy stream
+    // and the synchronous read-back path primes stream setup and the DMA
+    // descriptor caches.
+    rc = copy_to_device_async(dev_scratch, host_scratch.data(), host_scratch.size());
+    if (rc == 0) {
+        rc = copy_sync();
+    }
+    if (rc == 0) {
+        rc = copy_from_device(host_scratch.data(), dev_scratch, host_scratch.size());
+    }
+
+    mem_alloc_.free(dev_scratch);
+    if (rc != 0) {
+        LOG_ERROR("warm_up: pipeline flush failed: %d", rc);
+        return rc;
+    }
+
+    LOG_INFO("DeviceRunner: warm-up complete (device %d, %zu bytes)", device_id, WARM_UP_BYTES);
+    return 0;
+}
+
+int DeviceRunner::copy_to_device_batch(
+    void *const *dev_ptrs, const void *const *host_ptrs, const size_t *sizes, int count
+) {
+    if (count <= 0) {
+        return 0;
+    }
+
+    // Measure the packed slab: only small regions participate, larger ones
+    // are bandwidth-bound already and would just bloat the staging copy.
+    size_t packed_bytes = 0;
+    int packed_count = 0;
+    for (int i = 0; i < count; i++) {
+        if (sizes[i] > 0 && sizes[i] <= BATCH_COPY_SMALL_MAX) {
+            packed_bytes += (sizes[i] + BATCH_COPY_ALIGN - 1) & ~(BATCH_COPY_ALIGN - 1);
+            packed_count++;
+        }
+    }
+
+    // The gather pays a fixed cost (pack + slab transfer + stream sync); it
+    // only wins once several small regions amortize it.
+    void *staging = nullptr;
+    if (packed_count >= 4) {
+        if (stream_copy_ == nullptr) {
+            int rc = rtStreamCreate(&stream_copy_, 0);
+            if (rc != 0) {
+                LOG_WARN("rtStreamCreate (copy) failed: %d, batched uploads degrade to direct copies", rc);
+                stream_copy_ = nullptr;
+            }
+        }
+        if (stream_copy_ != nullptr) {
+            staging = mem_alloc_.alloc(packed_bytes);
+        }
+    }
+
+    if (staging == nullptr) {
+        // Degraded path: one driver copy per region, same semantics.
+        for (int i = 0; i < count; i++) {
+            if (sizes[i] == 0) continue;
+            int rc = rtMemcpy(dev_ptrs[i], sizes[i], host_ptrs[i], sizes[i], RT_MEMCPY_HOST_TO_DEVICE);
+            if (rc != 0) {
+                LOG_ERROR("rtMemcpy (batch fallback, region %d) failed: %d", i, rc);
+                return rc;
+            }
+        }
+        return 0;
+    }
+
+    // Pack all small regions into one host buffer and push it with a single
+    // host->device transfer.
+    std::vector<uint8_t> host_pack(packed_bytes);
+    size_t off = 0;
+    for (int i = 0; i < count; i++) {
+        if (sizes[i] == 0 || sizes[i] > BATCH_COPY_SMALL_MAX) continue;
+        std::memcpy(host_pack.data() + off, host_ptrs[i], sizes[i]);
+        off += (sizes[i] + BATCH_COPY_ALIGN - 1) & ~(BATCH_COPY_ALIGN - 1);
+    }
+    int rc = rtMemcpy(staging, packed_bytes, host_pack.data(), packed_bytes, RT_MEMCPY_HOST_TO_DEVICE);
+    if (rc != 0) {
+        LOG_ERROR("rtMemcpy (batch staging slab, %zu bytes) failed: %d", packed_bytes, rc);
+        mem_alloc_.free(staging);
+        return rc;
+    }
+
+    // Scatter inside device memory: async D2D DMA per region on the copy
+    // stream, one synchronize for the whole batch. Large regions go direct
+    // in the same pass.
+    off = 0;
+    for (int i = 0; i < count && rc == 0; i++) {
+        if (sizes[i] == 0) continue;
+        if (sizes[i] <= BATCH_COPY_SMALL_MAX) {
+            rc = rtMemcpyAsync(
+                dev_ptrs[i], sizes[i], static_cast<uint8_t *>(staging) + off, sizes[i], RT_MEMCPY_DEVICE_TO_DEVICE,
+                stream_copy_
+            );
+            off += (sizes[i] + BATCH_COPY_ALIGN - 1) & ~(BATCH_COPY_ALIGN - 1);
+        } else {
+            rc = rtMemcpy(dev_ptrs[i], sizes[i], host_ptrs[i], sizes[i], RT_MEMCPY_HOST_TO_DEVICE);
+        }
+        if (rc != 0) {
+            LOG_ERROR("batch scatter (region %d, %zu bytes) failed: %d", i, sizes[i], rc);
+        }
+    }
+    int sync_rc = rtStreamSynchronize(stream_copy_);
+    if (sync_rc != 0) {
+        LOG_ERROR("rtStreamSynchronize (copy) failed: %d", sync_rc);
+        if (rc == 0) rc = sync_rc;
+    }
+    mem_alloc_.free(staging);
+    return rc;
+}
+
 int DeviceRunner::run(
     Runtime &runtime, int block_dim, int device_id, const std::vector<uint8_t> &aicpu_so_binary,
     const std::vector<uint8_t> &aicore_kernel_binary, int launch_aicpu_num, bool enable_dump_tensor
@@ -412,12 +666,20 @@ int DeviceRunner::run(
     }
 
     // Ensure device is initialized (lazy initialization)
+    uint64_t trace_begin = LaunchTraceRecorder::now_ns();
     int rc = ensure_device_initialized(device_id, aicpu_so_binary, aicore_kernel_binary);
     if (rc != 0) {
         LOG_ERROR("ensure_device_initialized failed: %d", rc);
         return rc;
     }
 
+    // In-flight kernel uploads must land before dispatch can reach them
+    rc = flush_kernel_uploads();
+    if (rc != 0) {
+        return rc;
+    }
+    LaunchTraceRecorder::instance().add("device.init", trace_begin);
+
     // Calculate execution parameters
     block_dim_ = block_dim;
 
@@ -517,6 +779,7 @@ int DeviceRunner::run(
 
     std::cout << "\n=== Initialize runtime args ===" << '\n';
     // Initialize runtime args
+    trace_begin = LaunchTraceRecorder::now_ns();
     rc = kernel_args_.init_runtime_args(runtime, mem_alloc_);
     if (rc != 0) {
         LOG_ERROR("init_runtime_args failed: %d", rc);
@@ -535,9 +798,11 @@ int DeviceRunner::run(
         LOG_ERROR("init_device_kernel_args failed: %d", rc);
         return rc;
     }
+    LaunchTraceRecorder::instance().add("device.runtime_args", trace_begin);
 
     std::cout << "\n=== launch_aicpu_kernel DynTileFwkKernelServerInit===" << '\n';
     // Launch AICPU init kernel
+    trace_begin = LaunchTraceRecorder::now_ns();
     rc = launch_aicpu_kernel(stream_aicpu_, &kernel_args_.args, "DynTileFwkKernelServerInit", 1);
     if (rc != 0) {
         LOG_ERROR("launch_aicpu_kernel (init) failed: %d", rc);
@@ -553,15 +818,19 @@ int DeviceRunner::run(
         LOG_ERROR("launch_aicpu_kernel (main) failed: %d", rc);
         return rc;
     }
+    LaunchTraceRecorder::instance().add("device.aicpu_launch", trace_begin);
 
     std::cout << "\n=== launch_aicore_kernel===" << '\n';
     // Launch AICore kernel (pass device copy of KernelArgs)
+    trace_begin = LaunchTraceRecorder::now_ns();
     rc = launch_aicore_kernel(stream_aicore_, kernel_args_.device_k_args_);
     if (rc != 0) {
         LOG_ERROR("launch_aicore_kernel failed: %d", rc);
         return rc;
     }
+    LaunchTraceRecorder::instance().add("device.aicore_launch", trace_begin);
 
+    trace_begin = LaunchTraceRecorder::now_ns();
     {
         // Poll and collect performance data in a separate collector thread
         std::thread collector_thread;
@@ -611,6 +880,7 @@ int DeviceRunner::run(
             return rc;
         }
     }
+    LaunchTraceRecorder::instance().add("device.execute", trace_begin);
 
     // Stop memory management, drain remaining buffers, collect phase data, export
     if (runtime.enable_profiling) {
@@ -619,6 +889,7 @@ int DeviceRunner::run(
         perf_collector_.scan_remaining_perf_buffers();
         perf_collector_.collect_phase_data();
         export_swimlane_json();
+        perf_collector_.export_chrome_trace();
     }
 
     if (enable_dump_tensor) {
@@ -653,6 +924,235 @@ void DeviceRunner::print_handshake_results() {
     }
 }
 
+int DeviceRunner::session_begin(
+    int block_dim, int device_id, const std::vector<uint8_t> &aicpu_so_binary,
+    const std::vector<uint8_t> &aicore_kernel_binary, int launch_aicpu_num
+) {
+    if (session_active_) {
+        LOG_ERROR("session_begin: session already active on device %d", device_id_);
+        return -1;
+    }
+
+    if (launch_aicpu_num < 1 || launch_aicpu_num > PLATFORM_MAX_AICPU_THREADS) {
+        LOG_ERROR("launch_aicpu_num (%d) must be in range [1, %d]", launch_aicpu_num, PLATFORM_MAX_AICPU_THREADS);
+        return -1;
+    }
+    if (block_dim < 1 || block_dim > PLATFORM_MAX_BLOCKDIM) {
+        LOG_ERROR("block_dim (%d) must be in range [1, %d]", block_dim, PLATFORM_MAX_BLOCKDIM);
+        return -1;
+    }
+    int num_aicore = block_dim * cores_per_blockdim_;
+    if (num_aicore > RUNTIME_MAX_WORKER) {
+        LOG_ERROR("block_dim (%d) exceeds RUNTIME_MAX_WORKER (%d)", block_dim, RUNTIME_MAX_WORKER);
+        return -1;
+    }
+
+    int rc = ensure_device_initialized(device_id, aicpu_so_binary, aicore_kernel_binary);
+    if (rc != 0) {
+        LOG_ERROR("ensure_device_initialized failed: %d", rc);
+        return rc;
+    }
+
+    block_dim_ = block_dim;
+    worker_count_ = num_aicore;
+    session_aicpu_num_ = launch_aicpu_num;
+
+    rc = init_aicore_register_addresses(&kernel_args_.args.regs, static_cast<uint64_t>(device_id), mem_alloc_);
+    if (rc != 0) {
+        LOG_ERROR("init_aicore_register_addresses failed: %d", rc);
+        return rc;
+    }
+
+    // Persistent runtime buffer: allocated once here so its device address
+    // can be baked into the AICore KernelArgs copy; session_run() re-stages
+    // its contents in place every round.
+    if (kernel_args_.args.runtime_args == nullptr) {
+        void *runtime_dev = mem_alloc_.alloc(sizeof(Runtime));
+        if (runtime_dev == nullptr) {
+            LOG_ERROR("Alloc for session runtime_args failed");
+            return -1;
+        }
+        kernel_args_.allocator_ = &mem_alloc_;
+        kernel_args_.args.runtime_args = reinterpret_cast<Runtime *>(runtime_dev);
+    }
+
+    rc = kernel_args_.init_ffts_base_addr();
+    if (rc != 0) {
+        LOG_ERROR("init_ffts_base_addr failed: %d", rc);
+        return rc;
+    }
+
+    // SessionControl lives in host-visible device memory so the doorbell and
+    // completion count need no driver round-trips (same mapping as profiling).
+    rc = rtMalloc(&session_ctrl_dev_, sizeof(SessionControl), RT_MEMORY_HBM, 0);
+    if (rc != 0) {
+        LOG_ERROR("rtMalloc for SessionControl failed: %d", rc);
+        return rc;
+    }
+    if (load_hal_if_needed() != 0) {
+        LOG_ERROR("Failed to load ascend_hal for session control: %s", dlerror());
+        rtFree(session_ctrl_dev_);
+        session_ctrl_dev_ = nullptr;
+        return -1;
+    }
+    HalHostRegisterFn register_fn = get_halHostRegister();
+    void *host_ptr = nullptr;
+    if (register_fn == nullptr ||
+        register_fn(session_ctrl_dev_, sizeof(SessionControl), DEV_SVM_MAP_HOST, device_id, &host_ptr) != 0) {
+        LOG_ERROR("halHostRegister for SessionControl failed");
+        rtFree(session_ctrl_dev_);
+        session_ctrl_dev_ = nullptr;
+        return -1;
+    }
+    session_ctrl_host_ = static_cast<SessionControl *>(host_ptr);
+    session_ctrl_host_->run_seq = 0;
+    session_ctrl_host_->done_count = 0;
+    session_ctrl_host_->shutdown = 0;
+    session_ctrl_host_->sche_cpu_num = static_cast<uint32_t>(launch_aicpu_num);
+    wmb();
+
+    kernel_args_.args.session_ctrl = reinterpret_cast<uint64_t>(session_ctrl_dev_);
+
+    // AICore KernelArgs copy: every field is session-constant (the runtime
+    // pointer is the persistent buffer), so one upload serves all rounds.
+    rc = kernel_args_.init_device_kernel_args(mem_alloc_);
+    if (rc != 0) {
+        LOG_ERROR("init_device_kernel_args failed: %d", rc);
+        return rc;
+    }
+
+    // Launch the AICPU kernel once; threads pass the affinity gate and park
+    // on the doorbell until the first session_run().
+    rc = launch_aicpu_kernel(stream_aicpu_, &kernel_args_.args, "DynTileFwkKernelServerInit", 1);
+    if (rc != 0) {
+        LOG_ERROR("launch_aicpu_kernel (init) failed: %d", rc);
+        return rc;
+    }
+    rc = launch_aicpu_kernel(
+        stream_aicpu_, &kernel_args_.args, "DynTileFwkKernelServer", PLATFORM_MAX_AICPU_THREADS_JUST_FOR_LAUNCH
+    );
+    if (rc != 0) {
+        LOG_ERROR("launch_aicpu_kernel (main) failed: %d", rc);
+        return rc;
+    }
+
+    session_run_seq_ = 0;
+    session_active_ = true;
+    LOG_INFO("DeviceRunner: session active (block_dim=%d, aicpu_num=%d)", block_dim, launch_aicpu_num);
+    return 0;
+}
+
+int DeviceRunner::session_run(Runtime &runtime) {
+    if (!session_active_) {
+        LOG_ERROR("session_run called without an active session");
+        return -1;
+    }
+
+    if (runtime.enable_profiling) {
+        LOG_WARN("Performance profiling is not collected in session mode; disabling for this round");
+        runtime.enable_profiling = false;
+    }
+
+    // In-flight kernel uploads must land before dispatch can reach them
+    int flush_rc = flush_kernel_uploads();
+    if (flush_rc != 0) {
+        return flush_rc;
+    }
+
+    int num_aicore = block_dim_ * cores_per_blockdim_;
+    int num_aic = block_dim_;
+    runtime.worker_count = num_aicore;
+    runtime.sche_cpu_num = session_aicpu_num_;
+    for (int i = 0; i < num_aicore; i++) {
+        runtime.workers[i].aicpu_ready = 0;
+        runtime.workers[i].aicore_done = 0;
+        runtime.workers[i].control = 0;
+        runtime.workers[i].task = 0;
+        runtime.workers[i].task_status = 0;
+        runtime.workers[i].core_type = (i < num_aic) ? CoreType::AIC : CoreType::AIV;
+        runtime.workers[i].enable_profiling_flag = PROFILING_FLAG_NONE;
+        runtime.workers[i].perf_records_addr = static_cast<uint64_t>(0);
+        runtime.workers[i].perf_buffer_status = 0;
+    }
+
+    for (int i = 0; i < runtime.get_task_count(); i++) {
+        Task *task = runtime.get_task(i);
+        if (task != nullptr) {
+            uint64_t callable_addr = runtime.get_function_bin_addr(task->func_id);
+            task->function_bin_addr = callable_addr + CoreCallable::binary_data_offset();
+        }
+    }
+
+    // Stage the round into the persistent buffer (synchronous DMA), then
+    // ring the doorbell through the host mapping.
+    int rc = kernel_args_.init_runtime_args(runtime, mem_alloc_);
+    if (rc != 0) {
+        LOG_ERROR("init_runtime_args failed: %d", rc);
+        return rc;
+    }
+    session_run_seq_++;
+    wmb();
+    session_ctrl_host_->run_seq = session_run_seq_;
+
+    // Cores shut down at the end of every round, so the AICore kernel is
+    // relaunched per round; this launch bounds the turnaround.
+    rc = launch_aicore_kernel(stream_aicore_, kernel_args_.device_k_args_);
+    if (rc != 0) {
+        LOG_ERROR("launch_aicore_kernel failed: %d", rc);
+        return rc;
+    }
+
+    // Every surviving AICPU thread reports once per round.
+    uint64_t target = session_run_seq_ * static_cast<uint64_t>(session_aicpu_num_);
+    while (session_ctrl_host_->done_count < target) {
+    }
+    rmb();
+
+    rc = rtStreamSynchronize(stream_aicore_);
+    if (rc != 0) {
+        LOG_ERROR("rtStreamSynchronize (AICore) failed: %d", rc);
+        return rc;
+    }
+    return 0;
+}
+
+int DeviceRunner::session_end() {
+    if (!session_active_) {
+        return 0;
+    }
+
+    session_ctrl_host_->shutdown = 1;
+    wmb();
+
+    int rc = rtStreamSynchronize(stream_aicpu_);
+    if (rc != 0) {
+        LOG_ERROR("rtStreamSynchronize (AICPU) failed: %d", rc);
+    }
+
+    kernel_args_.args.session_ctrl = 0;
+    if (session_ctrl_dev_ != nullptr) {
+        HalHostUnregisterFn unregister_fn = get_halHostUnregister();
+        if (unregister_fn != nullptr && session_ctrl_host_ != nullptr) {
+            unregister_fn(session_ctrl_host_, device_id_);
+        }
+        rtFree(session_ctrl_dev_);
+        session_ctrl_dev_ = nullptr;
+        session_ctrl_host_ = nullptr;
+    }
+    if (kernel_args_.args.regs != 0) {
+        mem_alloc_.free(reinterpret_cast<void *>(kernel_args_.args.regs));
+        kernel_args_.args.regs = 0;
+    }
+    kernel_args_.finalize_device_kernel_args();
+    kernel_args_.finalize_runtime_args();
+
+    session_run_seq_ = 0;
+    session_aicpu_num_ = 0;
+    session_active_ = false;
+    LOG_INFO("%s", "DeviceRunner: session ended");
+    return rc;
+}
+
 int DeviceRunner::finalize() {
     if (device_id_ == -1) {
         return 0;
@@ -664,6 +1164,9 @@ int DeviceRunner::finalize() {
         return rc;
     }
 
+    // Safety net: an active session must be shut down before streams die.
+    session_end();
+
     release_run_context();
 
     // Cleanup kernel args (deviceArgs)
@@ -672,17 +1175,33 @@ int DeviceRunner::finalize() {
     // Cleanup AICPU SO
     so_info_.finalize();
 
-    // Kernel binaries should have been removed by validate_runtime_impl()
+    // Kernel binaries should have been unmapped by validate_runtime_impl();
+    // their device copies are owned by the content hash cache either way.
     if (!func_id_to_addr_.empty()) {
-        LOG_ERROR("finalize() called with %zu kernel binaries still cached (memory leak)", func_id_to_addr_.size());
-        // Cleanup leaked binaries to prevent memory leaks
-        for (const auto &pair : func_id_to_addr_) {
-            void *gm_addr = reinterpret_cast<void *>(pair.second);
-            mem_alloc_.free(gm_addr);
-            LOG_DEBUG("Freed leaked kernel binary: func_id=%d, addr=0x%lx", pair.first, pair.second);
-        }
+        LOG_ERROR("finalize() called with %zu kernel binaries still mapped", func_id_to_addr_.size());
     }
     func_id_to_addr_.clear();
+
+    // Free the content-addressed kernel cache (one device copy per distinct
+    // binary). Resident pack slots are interior to the pool block and are
+    // released with it below.
+    for (const auto &pair : bin_hash_to_addr_) {
+        if (is_resident_addr(pair.second)) {
+            continue;
+        }
+        mem_alloc_.free(reinterpret_cast<void *>(pair.second));
+        LOG_DEBUG("Freed cached kernel binary: hash=0x%lx, addr=0x%lx", pair.first, pair.second);
+    }
+    bin_hash_to_addr_.clear();
+    if (resident_pool_dev_ != nullptr) {
+        mem_alloc_.free(resident_pool_dev_);
+        resident_pool_dev_ = nullptr;
+    }
+    resident_slot_addrs_.clear();
+    resident_pool_used_ = 0;
+    resident_header_dirty_ = false;
+    resident_env_parsed_ = false;
+    resident_func_ids_.clear();
     binaries_loaded_ = false;
 
     // Cleanup performance profiling
@@ -828,10 +1347,35 @@ uint64_t DeviceRunner::upload_kernel_binary(int func_id, const uint8_t *bin_data
         return it->second;
     }
 
+    // Content hash with resolved_addr_ normalized to zero: the field is
+    // patched to the device address below, so the same kernel must hash
+    // identically whether the buffer was patched by an earlier upload or not.
+    CoreCallable *host_callable = reinterpret_cast<CoreCallable *>(const_cast<uint8_t *>(bin_data));
+    host_callable->set_resolved_addr(0);
+    uint64_t bin_hash = fnv1a_hash(bin_data, bin_size);
+
+    // Cache hit: an identical binary is already on the device (possibly from
+    // a previous case or session); share its copy instead of re-uploading.
+    auto cached = bin_hash_to_addr_.find(bin_hash);
+    if (cached != bin_hash_to_addr_.end()) {
+        uint64_t cached_addr = cached->second;
+        host_callable->set_resolved_addr(cached_addr + CoreCallable::binary_data_offset());
+        func_id_to_addr_[func_id] = cached_addr;
+        LOG_DEBUG("Kernel func_id=%d matched cached binary (hash=0x%lx), skipping upload", func_id, bin_hash);
+        return cached_addr;
+    }
+
     LOG_DEBUG("Uploading kernel binary: func_id=%d, size=%zu bytes", func_id, bin_size);
 
-    // Allocate device GM memory for kernel binary
-    void *gm_addr = mem_alloc_.alloc(bin_size);
+    // Designated hot kernels are packed into the contiguous resident pool so
+    // their instruction footprint stays within one compact GM span; everyone
+    // else gets a scattered allocation as before.
+    size_t resident_prev_used = resident_pool_used_;
+    void *gm_addr = alloc_resident_slot(func_id, bin_size);
+    bool resident = gm_addr != nullptr;
+    if (gm_addr == nullptr) {
+        gm_addr = mem_alloc_.alloc(bin_size);
+    }
     if (gm_addr == nullptr) {
         LOG_ERROR("Failed to allocate device GM memory for kernel func_id=%d", func_id);
         return 0;
@@ -843,37 +1387,212 @@ uint64_t DeviceRunner::upload_kernel_binary(int func_id, const uint8_t *bin_data
     assert((callable_addr & (CALLABLE_ALIGN - 1)) == 0 && "device alloc must be CALLABLE_ALIGN-byte aligned");
     uint64_t binary_code_addr = callable_addr + CoreCallable::binary_data_offset();
     // Write resolved_addr_ into the host-side buffer (the field lives at a fixed offset)
-    CoreCallable *host_callable = reinterpret_cast<CoreCallable *>(const_cast<uint8_t *>(bin_data));
     host_callable->set_resolved_addr(binary_code_addr);
 
-    // Copy the full CoreCallable (header + binary) to device
-    int rc = rtMemcpy(gm_addr, bin_size, bin_data, bin_size, RT_MEMCPY_HOST_TO_DEVICE);
+    // Resident slots are CoreFunctionBin records: an 8-byte size word sits
+    // directly ahead of the callable, so assemble the record host-side and
+    // land both with one copy.
+    const uint8_t *copy_src = bin_data;
+    void *copy_dst = gm_addr;
+    size_t copy_size = bin_size;
+    std::vector<uint8_t> resident_record;
+    if (resident) {
+        uint64_t record_size = bin_size;
+        resident_record.resize(sizeof(record_size) + bin_size);
+        std::memcpy(resident_record.data(), &record_size, sizeof(record_size));
+        std::memcpy(resident_record.data() + sizeof(record_size), bin_data, bin_size);
+        copy_src = resident_record.data();
+        copy_dst = reinterpret_cast<uint8_t *>(gm_addr) - sizeof(record_size);
+        copy_size = resident_record.size();
+    }
+
+    // Copy the full CoreCallable (header + binary) to device. The copy is
+    // issued asynchronously on the copy stream from an owned staging buffer,
+    // so successive uploads pipeline their DMA behind the hashing/allocation
+    // of the next binary; flush_kernel_uploads() fences them before launch.
+    int rc;
+    if (stream_copy_ == nullptr) {
+        rc = rtStreamCreate(&stream_copy_, 0);
+        if (rc != 0) {
+            LOG_WARN("rtStreamCreate (copy) failed: %d, kernel uploads degrade to synchronous copies", rc);
+            stream_copy_ = nullptr;
+        }
+    }
+    if (stream_copy_ != nullptr) {
+        upload_staging_.emplace_back(copy_src, copy_src + copy_size);
+        rc = rtMemcpyAsync(
+            copy_dst, copy_size, upload_staging_.back().data(), copy_size, RT_MEMCPY_HOST_TO_DEVICE, stream_copy_
+        );
+        if (rc == 0) {
+            uploads_in_flight_ = true;
+        } else {
+            upload_staging_.pop_back();
+        }
+    } else {
+        rc = rtMemcpy(copy_dst, copy_size, copy_src, copy_size, RT_MEMCPY_HOST_TO_DEVICE);
+    }
     if (rc != 0) {
-        LOG_ERROR("rtMemcpy to device failed: %d", rc);
-        mem_alloc_.free(gm_addr);
+        LOG_ERROR("kernel binary copy to device failed: %d", rc);
+        if (resident) {
+            // Roll the bump pointer back so the dead slot is not published.
+            resident_pool_used_ = resident_prev_used;
+            resident_slot_addrs_.pop_back();
+        } else {
+            mem_alloc_.free(gm_addr);
+        }
         return 0;
     }
 
     func_id_to_addr_[func_id] = callable_addr;
+    bin_hash_to_addr_[bin_hash] = callable_addr;
 
     LOG_DEBUG("  func_id=%d -> callable_addr=0x%lx, binary_code_addr=0x%lx", func_id, callable_addr, binary_code_addr);
 
     return callable_addr;
 }
 
+int DeviceRunner::flush_kernel_uploads() {
+    int rc = 0;
+    if (uploads_in_flight_) {
+        rc = rtStreamSynchronize(stream_copy_);
+        if (rc != 0) {
+            LOG_ERROR("rtStreamSynchronize (kernel uploads) failed: %d", rc);
+        }
+        upload_staging_.clear();
+        uploads_in_flight_ = false;
+    }
+    if (rc == 0) {
+        rc = flush_resident_header();
+    }
+    return rc;
+}
+
+void *DeviceRunner::alloc_resident_slot(int func_id, size_t bin_size) {
+    if (!resident_env_parsed_) {
+        resident_env_parsed_ = true;
+        const char *list = std::getenv("PTO2_RESIDENT_KERNELS");
+        if (list != nullptr) {
+            for (const char *p = list; *p != '\0';) {
+                char *end = nullptr;
+                long id = std::strtol(p, &end, 10);
+                if (end == p) {
+                    break;  // no digits consumed; stop on malformed tail
+                }
+                if (id >= 0) {
+                    resident_func_ids_.insert(static_cast<int>(id));
+                }
+                p = (*end == ',') ? end + 1 : end;
+            }
+        }
+        const char *cap = std::getenv("PTO2_RESIDENT_POOL_SIZE");
+        if (cap != nullptr) {
+            uint64_t v = std::strtoull(cap, nullptr, 10);
+            if (v > 0) {
+                resident_pool_capacity_ = v;
+            }
+        }
+        if (!resident_func_ids_.empty()) {
+            LOG_INFO(
+                "Resident kernel pack enabled: %zu designated func_ids, pool capacity %zu bytes",
+                resident_func_ids_.size(), resident_pool_capacity_
+            );
+        }
+    }
+
+    if (resident_func_ids_.count(func_id) == 0) {
+        return nullptr;
+    }
+    if (resident_slot_addrs_.size() >= RESIDENT_MAX_KERNELS) {
+        LOG_WARN("Resident kernel pack offset table full (max=%lu), func_id=%d falls back", RESIDENT_MAX_KERNELS,
+                 func_id);
+        return nullptr;
+    }
+
+    if (resident_pool_dev_ == nullptr) {
+        resident_pool_dev_ = mem_alloc_.alloc(resident_pool_capacity_);
+        if (resident_pool_dev_ == nullptr) {
+            LOG_WARN("Resident kernel pool allocation failed (%zu bytes), resident pack disabled",
+                     resident_pool_capacity_);
+            resident_func_ids_.clear();
+            return nullptr;
+        }
+        // Reserve the header plus a full offset table up front; records start
+        // past it so the reader-side data start (header + num_kernels words)
+        // always precedes the first record.
+        size_t table_bytes = sizeof(CoreFunctionBinCache) + RESIDENT_MAX_KERNELS * sizeof(uint64_t);
+        resident_pool_used_ = (table_bytes + CALLABLE_ALIGN - 1) & ~(static_cast<size_t>(CALLABLE_ALIGN) - 1);
+    }
+
+    // Place the callable on a CALLABLE_ALIGN boundary with room for the
+    // record's 8-byte size word directly ahead of it.
+    size_t callable_offset = (resident_pool_used_ + sizeof(uint64_t) + CALLABLE_ALIGN - 1) &
+                             ~(static_cast<size_t>(CALLABLE_ALIGN) - 1);
+    if (callable_offset + bin_size > resident_pool_capacity_) {
+        LOG_WARN("Resident kernel pool exhausted (used=%zu, need=%zu, cap=%zu), func_id=%d falls back",
+                 resident_pool_used_, bin_size, resident_pool_capacity_, func_id);
+        return nullptr;
+    }
+
+    uint64_t callable_addr = reinterpret_cast<uint64_t>(resident_pool_dev_) + callable_offset;
+    resident_pool_used_ = callable_offset + bin_size;
+    resident_slot_addrs_.push_back(callable_addr);
+    resident_header_dirty_ = true;
+    LOG_DEBUG("  func_id=%d packed into resident pool: slot=%zu, addr=0x%lx", func_id,
+              resident_slot_addrs_.size() - 1, callable_addr);
+    return reinterpret_cast<void *>(callable_addr);
+}
+
+int DeviceRunner::flush_resident_header() {
+    if (!resident_header_dirty_ || resident_pool_dev_ == nullptr) {
+        return 0;
+    }
+
+    uint64_t num = resident_slot_addrs_.size();
+    std::vector<uint8_t> staging(sizeof(CoreFunctionBinCache) + num * sizeof(uint64_t));
+    auto *cache = reinterpret_cast<CoreFunctionBinCache *>(staging.data());
+    uint64_t base = reinterpret_cast<uint64_t>(resident_pool_dev_);
+    uint64_t data_start = base + sizeof(CoreFunctionBinCache) + num * sizeof(uint64_t);
+    cache->num_kernels = num;
+    cache->data_size = (base + resident_pool_used_) - data_start;
+    uint64_t *offsets = reinterpret_cast<uint64_t *>(staging.data() + sizeof(CoreFunctionBinCache));
+    for (uint64_t i = 0; i < num; i++) {
+        // Offsets address the CoreFunctionBin record (size word), which sits
+        // 8 bytes ahead of the aligned callable.
+        offsets[i] = (resident_slot_addrs_[i] - sizeof(uint64_t)) - data_start;
+    }
+
+    int rc = rtMemcpy(resident_pool_dev_, staging.size(), staging.data(), staging.size(), RT_MEMCPY_HOST_TO_DEVICE);
+    if (rc != 0) {
+        LOG_ERROR("Resident kernel pack header copy failed: %d", rc);
+        return rc;
+    }
+    resident_header_dirty_ = false;
+    LOG_DEBUG("Resident kernel pack flushed: %lu kernels, %zu bytes used", num, resident_pool_used_);
+    return 0;
+}
+
+bool DeviceRunner::is_resident_addr(uint64_t addr) const {
+    if (resident_pool_dev_ == nullptr) {
+        return false;
+    }
+    uint64_t base = reinterpret_cast<uint64_t>(resident_pool_dev_);
+    return addr >= base && addr < base + resident_pool_capacity_;
+}
+
 void DeviceRunner::remove_kernel_binary(int func_id) {
     auto it = func_id_to_addr_.find(func_id);
     if (it == func_id_to_addr_.end()) {
         return;
     }
 
+    // The device copy is owned by the content hash cache and intentionally
+    // retained so the next case/session reusing the same binary skips the
+    // upload; only the func_id mapping is dropped here. The cache is freed
+    // in finalize().
     uint64_t function_bin_addr = it->second;
-    void *gm_addr = reinterpret_cast<void *>(function_bin_addr);
-
-    mem_alloc_.free(gm_addr);
     func_id_to_addr_.erase(it);
 
-    LOG_DEBUG("Removed kernel binary: func_id=%d, addr=0x%lx", func_id, function_bin_addr);
+    LOG_DEBUG("Unmapped kernel binary: func_id=%d, addr=0x%lx (device copy cached)", func_id, function_bin_addr);
 }
 
 int DeviceRunner::init_performance_profiling(Runtime &runtime, int num_aicore, int device_id) {
@@ -31,6 +31,8 @@
 #include <functional>
 #include <iostream>
 #include <map>
+#include <mutex>
+#include <set>
 #include <string>
 #include <thread>
 #include <vector>
@@ -71,9 +73,15 @@ struct DeviceArgs {
  * with runtime APIs.
  */
 struct KernelArgsHelper {
+    // Delta-upload granularity for the persistent runtime image. Chunks whose
+    // bytes match the previously uploaded image are skipped; adjacent dirty
+    // chunks coalesce into one rtMemcpy.
+    static constexpr size_t RUNTIME_DELTA_CHUNK_BYTES = 4u << 10;
+
     KernelArgs args;
     MemoryAllocator *allocator_{nullptr};
     KernelArgs *device_k_args_{nullptr};  // Device copy of KernelArgs for AICore
+    std::vector<uint8_t> runtime_shadow_;  // Host copy of the last uploaded runtime image
 
     /**
      * Initialize device arguments by allocating device memory and copying data
@@ -94,6 +102,11 @@ struct KernelArgsHelper {
     /**
      * Initialize runtime arguments by allocating device memory and copying data
      *
+     * When the device buffer persists across calls (session mode), only the
+     * chunks that changed since the previous upload are transferred; the
+     * device image is patched in place at those offsets. A freshly allocated
+     * buffer always gets a full upload.
+     *
      * @param host_runtime  Host-side runtime to copy to device
      * @param allocator  Memory allocator to use
      * @return 0 on success, error code on failure
@@ -228,6 +241,77 @@ public:
      */
     int copy_from_device(void *host_ptr, const void *dev_ptr, size_t bytes);
 
+    /**
+     * Copy data between two device addresses without a host bounce
+     *
+     * Both pointers may live on different devices; the transfer then relies
+     * on driver peer access and fails with the runtime's error code where
+     * peer access is unavailable — callers fall back to staged host copies.
+     *
+     * @param dst_dev  Destination device pointer
+     * @param src_dev  Source device pointer
+     * @param bytes    Number of bytes to copy
+     * @return 0 on success, error code on failure
+     */
+    int copy_between_device(void *dst_dev, const void *src_dev, size_t bytes);
+
+    /**
+     * Queue an asynchronous host-to-device copy on the copy stream
+     *
+     * The copy may complete any time before the next copy_sync() returns;
+     * the host buffer must stay valid until then. Degrades to a synchronous
+     * copy when the copy stream cannot be created.
+     *
+     * @param dev_ptr   Device pointer
+     * @param host_ptr  Host pointer (caller keeps it valid until copy_sync)
+     * @param bytes    Number of bytes to copy
+     * @return 0 on success, error code on failure
+     */
+    int copy_to_device_async(void *dev_ptr, const void *host_ptr, size_t bytes);
+
+    /**
+     * Wait for all queued asynchronous copies to complete
+     *
+     * @return 0 on success, error code on failure
+     */
+    int copy_sync();
+
+    /**
+     * Pre-pay cold-start costs so the first run performs like steady state
+     *
+     * A cold first run pays first-touch page faults on freshly mapped
+     * regions plus one-time driver setup (streams, DMA descriptors). This
+     * call front-loads those costs behind one API:
+     * - attaches the thread and creates the run-scoped streams
+     * - pre-faults a host staging buffer page by page
+     * - draws a device scratch block from the allocator pool and rounds one
+     *   copy through the async copy stream and back (no-op pipeline flush)
+     * The scratch returns to its freelist afterwards, so the first real
+     * allocations (shared-memory window, GM heap ring) are pool hits on
+     * already-faulted device memory. Entirely optional — callers that do
+     * not care about cold-start latency never need to call it.
+     *
+     * @param device_id  Device ID (0-15)
+     * @return 0 on success, error code on failure
+     */
+    int warm_up(int device_id);
+
+    /**
+     * Gather-upload: copy many scattered host regions to the device in one
+     * batch. Regions up to BATCH_COPY_SMALL_MAX bytes are packed into a
+     * single host->device staging transfer and then scattered to their
+     * destinations with async device-to-device DMA on the copy stream, so
+     * per-copy driver latency is paid twice instead of once per region.
+     * Larger regions (bandwidth-bound already) are copied directly.
+     *
+     * @param dev_ptrs   Device destination pointers (count entries)
+     * @param host_ptrs  Host source pointers (count entries)
+     * @param sizes     Per-region byte counts (count entries)
+     * @param count     Number of regions
+     * @return 0 on success, error code of the first failed copy otherwise
+     */
+    int copy_to_device_batch(void *const *dev_ptrs, const void *const *host_ptrs, const size_t *sizes, int count);
+
     /**
      * Execute a runtime
      *
@@ -254,6 +338,58 @@ public:
     run(Runtime &runtime, int block_dim, int device_id, const std::vector<uint8_t> &aicpu_so_binary,
         const std::vector<uint8_t> &aicore_kernel_binary, int launch_aicpu_num = 1, bool enable_dump_tensor = false);
 
+    /**
+     * Begin a persistent execution session
+     *
+     * Performs the one-time setup a single run() would pay every call —
+     * device attach, stream creation, AICPU SO load, register addresses,
+     * persistent runtime/KernelArgs device buffers — and launches the AICPU
+     * kernel once in a parked state (see SessionControl in kernel_args.h).
+     * Subsequent session_run() calls only stage the round's Runtime and ring
+     * the doorbell, giving run-to-run turnaround bounded by the AICore
+     * kernel launch rather than full setup.
+     *
+     * block_dim and launch_aicpu_num are fixed for the session. Performance
+     * profiling and tensor dump are single-run features and are not
+     * available inside a session.
+     *
+     * @param block_dim            Number of blocks (1 block = 1 AIC + 2 AIV)
+     * @param device_id            Device ID (0-15)
+     * @param aicpu_so_binary       Binary data of AICPU shared object
+     * @param aicore_kernel_binary  Binary data of AICore kernel
+     * @param launch_aicpu_num      Number of AICPU instances (default: 1)
+     * @return 0 on success, error code on failure
+     */
+    int session_begin(
+        int block_dim, int device_id, const std::vector<uint8_t> &aicpu_so_binary,
+        const std::vector<uint8_t> &aicore_kernel_binary, int launch_aicpu_num = 1
+    );
+
+    /**
+     * Execute one round inside an active session
+     *
+     * Stages the runtime into the persistent device buffer, publishes the
+     * round to the parked AICPU threads, relaunches the AICore kernel (the
+     * executor shuts cores down at the end of every round), and waits for
+     * all AICPU threads to report completion.
+     *
+     * @param runtime  Runtime to execute (worker handshakes and task
+     *                 function_bin_addr are initialized in place, as in run())
+     * @return 0 on success, error code on failure
+     */
+    int session_run(Runtime &runtime);
+
+    /**
+     * End an active session
+     *
+     * Signals shutdown to the parked AICPU threads, synchronizes the AICPU
+     * stream, and releases session-scoped device resources. No-op when no
+     * session is active; also invoked by finalize() as a safety net.
+     *
+     * @return 0 on success, error code on failure
+     */
+    int session_end();
+
     /**
      * Print handshake results from device
      *
@@ -335,6 +471,11 @@ public:
      * If the kernel is already uploaded (same func_id), returns the
      * cached address without re-uploading.
      *
+     * Func_ids designated via PTO2_RESIDENT_KERNELS are placed in the
+     * contiguous resident pack (see alloc_resident_slot) rather than a
+     * scattered allocation; the returned address points into the pack and
+     * dispatch payloads reference that resident copy.
+     *
      * @param func_id   Function identifier (0, 1, 2, ...) for caching
      * @param bin_data  Kernel .text section binary data
      * @param bin_size  Size of binary data in bytes
@@ -383,6 +524,21 @@ public:
      */
     void release_run_context();
 
+    /**
+     * Stash (or clear, with nullptr) the Runtime currently executing on
+     * this context. Set by the C API layer around a run so monitoring
+     * entry points arriving on other threads can reach the live Runtime.
+     * Readers hold active_runtime_mutex() for the duration of the access;
+     * the run thread clears under the same lock before destructing the
+     * Runtime, so a snapshot can never outlive it.
+     */
+    void set_active_runtime(void *rt) {
+        std::lock_guard<std::mutex> lock(active_runtime_mu_);
+        active_runtime_ = rt;
+    }
+    std::mutex &active_runtime_mutex() { return active_runtime_mu_; }
+    void *active_runtime() const { return active_runtime_; }
+
 private:
     // Internal state
     int device_id_{-1};
@@ -391,12 +547,28 @@ private:
     int worker_count_{0};  // Stored for print_handshake_results in destructor
     std::vector<uint8_t> aicore_kernel_binary_;
 
+    // Runtime of the in-flight run, for cross-thread monitoring reads
+    // (see set_active_runtime)
+    std::mutex active_runtime_mu_;
+    void *active_runtime_{nullptr};
+
     // Memory management
     MemoryAllocator mem_alloc_;
 
+    // Batched gather-upload: regions at most this size are packed into the
+    // staging slab; pack offsets are aligned so scatter DMA sources do not
+    // straddle cachelines.
+    static constexpr size_t BATCH_COPY_SMALL_MAX = 4u << 10;
+    static constexpr size_t BATCH_COPY_ALIGN = 64;
+
+    // Warm-up scratch size: large enough to fault a representative span of
+    // host and device pages and park a useful block in the allocator pool.
+    static constexpr size_t WARM_UP_BYTES = 8u << 20;
+
     // Device resources
     rtStream_t stream_aicpu_{nullptr};
     rtStream_t stream_aicore_{nullptr};
+    rtStream_t stream_copy_{nullptr};  // lazily created by copy_to_device_batch
     AicpuSoInfo so_info_;
     KernelArgsHelper kernel_args_;
     DeviceArgs device_args_;
@@ -405,12 +577,51 @@ private:
     bool binaries_loaded_{false};              // true after AICPU SO loaded
     std::map<int, uint64_t> func_id_to_addr_;  // func_id -> function_bin_addr (device GM)
 
+    // Content-addressed kernel cache: the device copy of each binary is owned
+    // by its content hash, so identical binaries are uploaded once, shared
+    // across func_ids, and retained through per-case remove_kernel_binary()
+    // cleanup so later cases/sessions skip the upload. Freed in finalize().
+    std::map<uint64_t, uint64_t> bin_hash_to_addr_;  // FNV-1a(binary) -> callable device addr
+
+    // Resident kernel pack: func_ids listed in PTO2_RESIDENT_KERNELS
+    // (comma-separated) are bump-packed into one contiguous GM block laid out
+    // as a CoreFunctionBinCache instead of receiving scattered allocations,
+    // so the hottest kernels' instruction fetches stay within a single
+    // compact span. Each record is a CoreFunctionBin whose data[] holds the
+    // CoreCallable, placed so the callable lands on a CALLABLE_ALIGN
+    // boundary. The header and offset table are pushed to the device by
+    // flush_kernel_uploads(). Pool capacity defaults to
+    // RESIDENT_POOL_DEFAULT_BYTES (PTO2_RESIDENT_POOL_SIZE overrides).
+    static constexpr size_t RESIDENT_POOL_DEFAULT_BYTES = 4u << 20;
+    static constexpr uint64_t RESIDENT_MAX_KERNELS = 64;
+    bool resident_env_parsed_{false};
+    std::set<int> resident_func_ids_;          // designated hot func_ids
+    void *resident_pool_dev_{nullptr};         // device block (header + offsets + records)
+    size_t resident_pool_capacity_{RESIDENT_POOL_DEFAULT_BYTES};
+    size_t resident_pool_used_{0};             // bytes consumed, from pool base
+    std::vector<uint64_t> resident_slot_addrs_;  // device addr of each resident callable
+    bool resident_header_dirty_{false};
+
+    // Pipelined uploads: copies are issued asynchronously on the copy stream
+    // from owned staging buffers and fenced by flush_kernel_uploads() before
+    // anything on the device can dereference them.
+    std::vector<std::vector<uint8_t>> upload_staging_;
+    bool uploads_in_flight_{false};
+    bool async_copies_in_flight_{false};  // pending copy_to_device_async transfers
+
     // Performance profiling
     PerformanceCollector perf_collector_;
 
     // Tensor dump (independent shared memory + memory manager)
     TensorDumpCollector dump_collector_;
 
+    // Persistent session state (session_begin/session_run/session_end)
+    bool session_active_{false};
+    void *session_ctrl_dev_{nullptr};              // SessionControl device allocation
+    SessionControl *session_ctrl_host_{nullptr};   // Host mapping of the same block
+    uint64_t session_run_seq_{0};                  // Host copy of the doorbell
+    int session_aicpu_num_{0};                     // launch_aicpu_num fixed at session_begin
+
     /**
      * Ensure device is initialized (lazy initialization)
      *
@@ -444,6 +655,52 @@ private:
         const std::vector<uint8_t> &aicpu_so_binary, const std::vector<uint8_t> &aicore_kernel_binary
     );
 
+    /**
+     * Wait for in-flight kernel binary uploads to land on the device
+     *
+     * upload_kernel_binary() issues its copies asynchronously on the copy
+     * stream; this synchronizes the stream and releases the staging buffers.
+     * Called before kernels are launched (run / session_run) and before the
+     * copy stream is destroyed.
+     *
+     * @return 0 on success, error code on failure
+     */
+    int flush_kernel_uploads();
+
+    /**
+     * Reserve a slot in the resident kernel pack for a designated hot kernel
+     *
+     * Lazily parses PTO2_RESIDENT_KERNELS / PTO2_RESIDENT_POOL_SIZE and
+     * allocates the pool on first use. Returns the device address the
+     * CoreCallable must be copied to (CALLABLE_ALIGN-aligned, preceded by
+     * the record's CoreFunctionBin size word), or nullptr when func_id is
+     * not designated or the pool/table is exhausted — the caller then falls
+     * back to a scattered allocation.
+     *
+     * @param func_id   Function identifier being uploaded
+     * @param bin_size  Size of the CoreCallable buffer in bytes
+     * @return Device address for the callable, or nullptr for fallback
+     */
+    void *alloc_resident_slot(int func_id, size_t bin_size);
+
+    /**
+     * Push the resident pack's CoreFunctionBinCache header to the device
+     *
+     * Writes data_size, num_kernels and the offset table reflecting the
+     * slots reserved so far. No-op when the pack is unused or unchanged.
+     *
+     * @return 0 on success, error code on failure
+     */
+    int flush_resident_header();
+
+    /**
+     * Check whether a device address lies inside the resident kernel pool
+     *
+     * @param addr  Device address to test
+     * @return true when addr is interior to the pool block
+     */
+    bool is_resident_addr(uint64_t addr) const;
+
     /**
      * Initialize performance profiling shared memory
      *
@@ -9,10 +9,10 @@
  * -----------------------------------------------------------------------------------------------------------
  */
 /**
- * Memory Allocator Implementation
+ * Memory Allocator Driver Hooks (a2a3)
  *
- * This file implements centralized device memory management using the
- * Ascend CANN runtime API with RAII pattern.
+ * Raw device memory allocation via the Ascend CANN runtime API. The
+ * size-class pool layer on top lives in src/host/memory_allocator_pool.cpp.
  */
 
 #include "host/memory_allocator.h"
@@ -21,52 +21,20 @@
 
 #include "common/unified_log.h"
 
-MemoryAllocator::~MemoryAllocator() { finalize(); }
-
-void *MemoryAllocator::alloc(size_t size) {
+void *MemoryAllocator::driver_alloc(size_t size) {
     void *ptr = nullptr;
     int rc = rtMalloc(&ptr, size, RT_MEMORY_HBM, 0);
     if (rc != 0) {
         LOG_ERROR("rtMalloc failed: %d (size=%zu)", rc, size);
         return nullptr;
     }
-
-    std::lock_guard<std::mutex> lk(mu_);
-    ptr_set_.insert(ptr);
     return ptr;
 }
 
-int MemoryAllocator::free(void *ptr) {
-    if (ptr == nullptr) {
-        return 0;
-    }
-
-    std::lock_guard<std::mutex> lk(mu_);
-    auto it = ptr_set_.find(ptr);
-    if (it == ptr_set_.end()) {
-        return 0;
-    }
-
+int MemoryAllocator::driver_free(void *ptr) {
     int rc = rtFree(ptr);
     if (rc != 0) {
         LOG_ERROR("rtFree failed: %d", rc);
-        return rc;
-    }
-
-    ptr_set_.erase(it);
-    return 0;
-}
-
-int MemoryAllocator::finalize() {
-    std::lock_guard<std::mutex> lk(mu_);
-    int last_error = 0;
-    for (void *ptr : ptr_set_) {
-        int rc = rtFree(ptr);
-        if (rc != 0) {
-            LOG_ERROR("rtFree failed during Finalize: %d", rc);
-            last_error = rc;
-        }
     }
-    ptr_set_.clear();
-    return last_error;
+    return rc;
 }
@@ -21,11 +21,13 @@
 #include "task_args.h"
 
 #include <pthread.h>
+#include <runtime/rt.h>
 #include <vector>
 
 #include "common/unified_log.h"
 #include "device_runner.h"
 #include "host/raii_scope_guard.h"
+#include "launch_trace.h"
 #include "runtime.h"
 
 extern "C" {
@@ -35,6 +37,7 @@ extern "C" {
  * =========================================================================== */
 int init_runtime_impl(Runtime *runtime, const ChipCallable *callable, const ChipStorageTaskArgs *orch_args);
 int validate_runtime_impl(Runtime *runtime);
+int read_health_metrics_impl(Runtime *runtime, PtoHealthCopyFn copy_fn, void *copy_ctx, PtoHealthMetrics *out);
 
 /* ===========================================================================
  * Per-thread DeviceRunner binding (set by run_runtime, read by HostApi wrappers)
@@ -74,6 +77,24 @@ static int copy_to_device(void *dev_ptr, const void *host_ptr, size_t size) {
     }
 }
 
+
+static int copy_to_device_async(void *dev_ptr, const void *host_ptr, size_t size) {
+    if (dev_ptr == NULL || host_ptr == NULL) return -1;
+    try {
+        return current_runner()->copy_to_device_async(dev_ptr, host_ptr, size);
+    } catch (...) {
+        return -1;
+    }
+}
+
+static int copy_sync(void) {
+    try {
+        return current_runner()->copy_sync();
+    } catch (...) {
+        return -1;
+    }
+}
+
 static int copy_from_device(void *host_ptr, const void *dev_ptr, size_t size) {
     if (host_ptr == NULL || dev_ptr == NULL) return -1;
     try {
@@ -144,6 +165,47 @@ int copy_to_device_ctx(DeviceContextHandle ctx, void *dev_ptr, const void *host_
     }
 }
 
+int copy_to_device_batch_ctx(
+    DeviceContextHandle ctx, void *const *dev_ptrs, const void *const *host_ptrs, const size_t *sizes, int count
+) {
+    if (ctx == NULL || dev_ptrs == NULL || host_ptrs == NULL || sizes == NULL || count < 0) return -1;
+    try {
+        return static_cast<DeviceRunner *>(ctx)->copy_to_device_batch(dev_ptrs, host_ptrs, sizes, count);
+    } catch (...) {
+        return -1;
+    }
+}
+
+void *host_pinned_alloc_ctx(DeviceContextHandle ctx, size_t size) {
+    (void)ctx;
+    void *ptr = NULL;
+    int rc = rtMallocHost(&ptr, size);
+    if (rc != 0) {
+        LOG_ERROR("rtMallocHost failed: %d (size=%zu)", rc, size);
+        return NULL;
+    }
+    return ptr;
+}
+
+void host_pinned_free_ctx(DeviceContextHandle ctx, void *host_ptr) {
+    (void)ctx;
+    if (host_ptr == NULL) return;
+    int rc = rtFreeHost(host_ptr);
+    if (rc != 0) {
+        LOG_ERROR("rtFreeHost failed: %d", rc);
+    }
+}
+
+
+int copy_between_device_ctx(DeviceContextHandle ctx, void *dst_dev, const void *src_dev, size_t size) {
+    if (ctx == NULL || dst_dev == NULL || src_dev == NULL) return -1;
+    try {
+        return static_cast<DeviceRunner *>(ctx)->copy_between_device(dst_dev, src_dev, size);
+    } catch (...) {
+        return -1;
+    }
+}
+
 int copy_from_device_ctx(DeviceContextHandle ctx, void *host_ptr, const void *dev_ptr, size_t size) {
     if (ctx == NULL || host_ptr == NULL || dev_ptr == NULL) return -1;
     try {
@@ -153,6 +215,46 @@ int copy_from_device_ctx(DeviceContextHandle ctx, void *host_ptr, const void *de
     }
 }
 
+int warm_up_ctx(DeviceContextHandle ctx, int device_id) {
+    if (ctx == NULL || device_id < 0) return -1;
+    try {
+        return static_cast<DeviceRunner *>(ctx)->warm_up(device_id);
+    } catch (...) {
+        return -1;
+    }
+}
+
+void launch_trace_enable_ctx(DeviceContextHandle ctx, int enable) {
+    (void)ctx;  // Recording is process-wide; see pto_runtime_c_api.h.
+    LaunchTraceRecorder::instance().set_enabled(enable != 0);
+}
+
+int launch_trace_get_ctx(DeviceContextHandle ctx, PtoLaunchSpan *spans, int max_spans) {
+    if (ctx == NULL || spans == NULL) return -1;
+    return LaunchTraceRecorder::instance().snapshot(spans, max_spans);
+}
+
+// Health snapshots arrive on monitoring threads with no HostApi binding,
+// so the runtime-side reader is handed this explicit transport.
+static int health_copy_from_device(void *copy_ctx, void *host_dst, const void *dev_src, size_t size) {
+    try {
+        return static_cast<DeviceRunner *>(copy_ctx)->copy_from_device(host_dst, dev_src, size);
+    } catch (...) {
+        return -1;
+    }
+}
+
+int health_metrics_get_ctx(DeviceContextHandle ctx, PtoHealthMetrics *out) {
+    if (ctx == NULL || out == NULL) return -1;
+    DeviceRunner *runner = static_cast<DeviceRunner *>(ctx);
+    // Hold the lock for the whole read so the run thread cannot destruct
+    // the Runtime mid-snapshot (it clears the stash under the same lock).
+    std::lock_guard<std::mutex> lock(runner->active_runtime_mutex());
+    Runtime *r = static_cast<Runtime *>(runner->active_runtime());
+    if (r == NULL) return -1;  // No run in flight: nothing to read
+    return read_health_metrics_impl(r, health_copy_from_device, runner, out);
+}
+
 int run_runtime(
     DeviceContextHandle ctx, RuntimeHandle runtime, const void *callable, const void *args, int block_dim,
     int aicpu_thread_num, int device_id, const uint8_t *aicpu_binary, size_t aicpu_size, const uint8_t *aicore_binary,
@@ -170,7 +272,9 @@ int run_runtime(
     });
 
     try {
+        uint64_t trace_begin = LaunchTraceRecorder::now_ns();
         int rc = runner->prepare_run_context(device_id);
+        LaunchTraceRecorder::instance().add("runtime.prepare_ctx", trace_begin);
         if (rc != 0) return rc;
         auto run_context_guard = RAIIScopeGuard([runner]() {
             runner->release_run_context();
@@ -181,13 +285,17 @@ int run_runtime(
         r->host_api.device_free = device_free;
         r->host_api.copy_to_device = copy_to_device;
         r->host_api.copy_from_device = copy_from_device;
+        r->host_api.copy_to_device_async = copy_to_device_async;
+        r->host_api.copy_sync = copy_sync;
         r->host_api.upload_kernel_binary = upload_kernel_binary_wrapper;
         r->host_api.remove_kernel_binary = remove_kernel_binary_wrapper;
 
         LOG_DEBUG("About to call init_runtime_impl, r=%p", (void *)r);
+        trace_begin = LaunchTraceRecorder::now_ns();
         rc = init_runtime_impl(
             r, reinterpret_cast<const ChipCallable *>(callable), reinterpret_cast<const ChipStorageTaskArgs *>(args)
         );
+        LaunchTraceRecorder::instance().add("runtime.build_graph", trace_begin);
         LOG_DEBUG("init_runtime_impl returned: %d", rc);
         if (rc != 0) {
             r->set_pto2_gm_sm_ptr(nullptr);
@@ -200,16 +308,27 @@ int run_runtime(
             r->enable_profiling = true;
         }
 
+        // Expose the Runtime to health_metrics_get_ctx for the duration of
+        // the run; cleared (under the runner's lock) before destruction.
+        runner->set_active_runtime(r);
+        auto active_runtime_guard = RAIIScopeGuard([runner]() {
+            runner->set_active_runtime(nullptr);
+        });
+
         std::vector<uint8_t> aicpu_vec(aicpu_binary, aicpu_binary + aicpu_size);
         std::vector<uint8_t> aicore_vec(aicore_binary, aicore_binary + aicore_size);
         rc = runner->run(*r, block_dim, device_id, aicpu_vec, aicore_vec, aicpu_thread_num, enable_dump_tensor != 0);
         if (rc != 0) {
+            runner->set_active_runtime(nullptr);
             validate_runtime_impl(r);
             r->~Runtime();
             return rc;
         }
 
+        trace_begin = LaunchTraceRecorder::now_ns();
         rc = validate_runtime_impl(r);
+        LaunchTraceRecorder::instance().add("runtime.copy_back", trace_begin);
+        runner->set_active_runtime(nullptr);
         r->~Runtime();
         return rc;
     } catch (...) {
@@ -61,28 +61,23 @@ typedef int mem_dsb_t;
 #define PIPE_ALL 0
 #define pipe_barrier(pipe) __sync_synchronize()
 
-// SPIN_WAIT_HINT - CPU pause hint + OS yield for idle polling loops in simulation.
-// In simulation, all AICore/AICPU threads share a small number of host CPU cores.
-// The CPU hint (pause/yield) reduces pipeline waste, and sched_yield() lets the OS
-// scheduler give time slices to threads doing real work (e.g., kernel execution),
-// preventing starvation-induced timeouts on resource-constrained CI runners.
+// SPIN_WAIT_HINT - one idle poll, routed through sim_core_spin_wait_dispatch()
+// (kernel.cpp). Wall-clock mode pauses and yields the time slice so idle cores
+// don't starve threads doing real work on resource-constrained CI runners;
+// virtual-time mode (PTO_SIM_VIRTUAL_TIME=1) charges the logical clock and
+// blocks until it advances.
 #include <sched.h>
 
-#if defined(__aarch64__)
-#define SPIN_WAIT_HINT()                        \
-    do {                                        \
-        __asm__ volatile("yield" ::: "memory"); \
-        sched_yield();                          \
-    } while (0)
-#elif defined(__x86_64__)
-#define SPIN_WAIT_HINT()        \
-    do {                        \
-        __builtin_ia32_pause(); \
-        sched_yield();          \
-    } while (0)
-#else
-#define SPIN_WAIT_HINT() sched_yield()
-#endif
+extern "C" void sim_core_spin_wait_dispatch(void);
+
+#define SPIN_WAIT_HINT() sim_core_spin_wait_dispatch()
+
+// SIM_CHARGE_TASK_COST - charge the modeled cycle cost of the executed kernel
+// to the virtual clock (kernel.cpp; no-op in wall-clock mode). On hardware the
+// counter measures real execution, so the onboard platform defines this empty.
+void sim_charge_task_cost(uint64_t function_bin_addr);
+
+#define SIM_CHARGE_TASK_COST(fn_addr) sim_charge_task_cost(fn_addr)
 
 // OUT_OF_ORDER_STORE_BARRIER - store-store barrier preventing store reordering.
 // Ensures stores preceding the barrier are visible before stores following it.
@@ -117,12 +112,25 @@ typedef int mem_dsb_t;
 // System Counter Simulation
 // =============================================================================
 
+/**
+ * Virtual-clock state (kernel.cpp). Active when DeviceRunner has injected
+ * the logical-clock hooks (PTO_SIM_VIRTUAL_TIME=1).
+ */
+bool sim_vclock_active();
+uint64_t sim_vclock_now_ticks();
+
 /**
  * Get simulated AICore system counter
  *
+ * Virtual-time mode returns the logical clock; otherwise derives ticks from
+ * the host wall clock.
+ *
  * @return Simulated counter value (ticks)
  */
 inline uint64_t get_sys_cnt_aicore() {
+    if (sim_vclock_active()) {
+        return sim_vclock_now_ticks();
+    }
     auto now = std::chrono::high_resolution_clock::now();
     uint64_t elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
 
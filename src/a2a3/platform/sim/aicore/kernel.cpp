@@ -56,6 +56,54 @@ extern "C" void set_sim_core_identity_helpers(void *set_subblock_id, void *set_c
     g_set_cluster_id_fn = reinterpret_cast<SimSetUint32Fn>(set_cluster_id);
 }
 
+// Virtual-clock hooks — injected by DeviceRunner after dlopen when
+// PTO_SIM_VIRTUAL_TIME=1. When unset, get_sys_cnt_aicore falls back to
+// wall clock and spin-waits yield to the OS.
+using SimVclockNowFn = uint64_t (*)();
+using SimVclockSpinFn = void (*)();
+
+static SimVclockNowFn g_vclock_now_fn = nullptr;
+static SimVclockSpinFn g_vclock_spin_fn = nullptr;
+
+extern "C" void set_sim_virtual_clock_hooks(void *now_fn, void *spin_fn) {
+    g_vclock_now_fn = reinterpret_cast<SimVclockNowFn>(now_fn);
+    g_vclock_spin_fn = reinterpret_cast<SimVclockSpinFn>(spin_fn);
+}
+
+// Cost-model hook — charges the modeled cycle cost of a kernel to the
+// virtual clock after each task executes. Injected alongside the clock
+// hooks; stays null (no charge) in wall-clock mode.
+using SimChargeCostFn = void (*)(uint64_t);
+
+static SimChargeCostFn g_charge_cost_fn = nullptr;
+
+extern "C" void set_sim_cost_model_hook(void *charge_fn) {
+    g_charge_cost_fn = reinterpret_cast<SimChargeCostFn>(charge_fn);
+}
+
+void sim_charge_task_cost(uint64_t function_bin_addr) {
+    if (g_charge_cost_fn != nullptr) {
+        g_charge_cost_fn(function_bin_addr);
+    }
+}
+
+bool sim_vclock_active() { return g_vclock_now_fn != nullptr; }
+
+uint64_t sim_vclock_now_ticks() { return (g_vclock_now_fn != nullptr) ? g_vclock_now_fn() : 0; }
+
+extern "C" void sim_core_spin_wait_dispatch(void) {
+    if (g_vclock_spin_fn != nullptr) {
+        g_vclock_spin_fn();
+        return;
+    }
+#if defined(__aarch64__)
+    __asm__ volatile("yield" ::: "memory");
+#elif defined(__x86_64__)
+    __builtin_ia32_pause();
+#endif
+    sched_yield();
+}
+
 // Declare the original function (defined in aicore_executor.cpp with weak linkage)
 void aicore_execute(__gm__ Runtime *runtime, int block_idx, CoreType core_type);
 
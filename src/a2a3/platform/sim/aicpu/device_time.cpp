@@ -11,10 +11,28 @@
 #include "aicpu/device_time.h"
 
 #include <chrono>
+#include <sched.h>
 
 #include "common/platform_config.h"
 
+// Virtual-clock hooks — injected by DeviceRunner after dlopen when
+// PTO_SIM_VIRTUAL_TIME=1 (same injection pattern as set_platform_regs).
+// When unset, time falls back to wall clock and spin-waits yield to the OS.
+using SimVclockNowFn = uint64_t (*)();
+using SimVclockSpinFn = void (*)();
+
+static SimVclockNowFn g_vclock_now_fn = nullptr;
+static SimVclockSpinFn g_vclock_spin_fn = nullptr;
+
+extern "C" void set_sim_virtual_clock_hooks(void *now_fn, void *spin_fn) {
+    g_vclock_now_fn = reinterpret_cast<SimVclockNowFn>(now_fn);
+    g_vclock_spin_fn = reinterpret_cast<SimVclockSpinFn>(spin_fn);
+}
+
 uint64_t get_sys_cnt_aicpu() {
+    if (g_vclock_now_fn != nullptr) {
+        return g_vclock_now_fn();
+    }
     auto now = std::chrono::high_resolution_clock::now();
     uint64_t elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch()).count();
     constexpr uint64_t kNsPerSec = std::nano::den;
@@ -23,3 +41,16 @@ uint64_t get_sys_cnt_aicpu() {
     uint64_t ticks = seconds * PLATFORM_PROF_SYS_CNT_FREQ + (remaining_ns * PLATFORM_PROF_SYS_CNT_FREQ) / kNsPerSec;
     return ticks;
 }
+
+extern "C" void sim_spin_wait_dispatch(void) {
+    if (g_vclock_spin_fn != nullptr) {
+        g_vclock_spin_fn();
+        return;
+    }
+#if defined(__aarch64__)
+    __asm__ volatile("yield" ::: "memory");
+#elif defined(__x86_64__)
+    __builtin_ia32_pause();
+#endif
+    sched_yield();
+}
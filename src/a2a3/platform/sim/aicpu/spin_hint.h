@@ -28,20 +28,36 @@
 
 #include <sched.h>
 
+/**
+ * One idle poll, routed through sim_spin_wait_dispatch() (device_time.cpp).
+ * Wall-clock mode pauses and yields the time slice as before; virtual-time
+ * mode (PTO_SIM_VIRTUAL_TIME=1) charges the logical clock and blocks until
+ * it advances.
+ */
+extern "C" void sim_spin_wait_dispatch(void);
+
+#define SPIN_WAIT_HINT() sim_spin_wait_dispatch()
+
+/**
+ * Bare architectural pause for idle back-off bursts — pipeline hint only,
+ * no descheduling (the burst already follows a SPIN_WAIT_HINT that yielded).
+ */
 #if defined(__aarch64__)
-#define SPIN_WAIT_HINT()                        \
-    do {                                        \
-        __asm__ volatile("yield" ::: "memory"); \
-        sched_yield();                          \
-    } while (0)
+#define SPIN_PAUSE_HINT() __asm__ volatile("yield" ::: "memory")
 #elif defined(__x86_64__)
-#define SPIN_WAIT_HINT()        \
-    do {                        \
-        __builtin_ia32_pause(); \
-        sched_yield();          \
-    } while (0)
+#define SPIN_PAUSE_HINT() __builtin_ia32_pause()
 #else
-#define SPIN_WAIT_HINT() sched_yield()
+#define SPIN_PAUSE_HINT() ((void)0)
 #endif
 
+/**
+ * Deep-idle wait: simulation shares host cores with AICore threads, so the
+ * most effective "monitor" is simply giving up the time slice again.
+ */
+#define SPIN_MONITOR_WAIT(addr) \
+    do {                        \
+        (void)(addr);           \
+        SPIN_WAIT_HINT();       \
+    } while (0)
+
 #endif  // PLATFORM_A2A3SIM_AICPU_SPIN_HINT_H_
@@ -30,6 +30,7 @@
 #include <sys/stat.h>
 
 #include <atomic>
+#include <chrono>
 #include <cstdio>
 #include <string>
 #include <vector>
@@ -38,6 +39,7 @@
 #include "callable.h"
 #include "cpu_sim_context.h"
 #include "host/raii_scope_guard.h"
+#include "launch_trace.h"
 
 // Function pointer types for dynamically loaded executors
 typedef int (*aicpu_execute_func_t)(Runtime *runtime);
@@ -47,6 +49,7 @@ typedef void (*aicore_execute_func_t)(
 typedef void (*set_platform_regs_func_t)(uint64_t regs);
 typedef void (*set_platform_dump_base_func_t)(uint64_t dump_data_base);
 typedef void (*set_enable_dump_tensor_func_t)(bool enable);
+typedef void (*set_platform_binlog_base_func_t)(uint64_t binlog_base);
 
 namespace {
 
@@ -159,6 +162,22 @@ int DeviceRunner::ensure_binaries_loaded(
             LOG_ERROR("dlsym failed for set_enable_dump_tensor: %s", dlerror());
             return -1;
         }
+        set_platform_binlog_base_func_ =
+            reinterpret_cast<void (*)(uint64_t)>(dlsym(aicpu_so_handle_, "set_platform_binlog_base"));
+        if (set_platform_binlog_base_func_ == nullptr) {
+            LOG_ERROR("dlsym failed for set_platform_binlog_base: %s", dlerror());
+            return -1;
+        }
+
+        // Inject virtual-clock hooks when virtual-time mode is enabled; the
+        // SO falls back to wall clock + sched_yield when they stay unset.
+        auto set_aicpu_vclock =
+            reinterpret_cast<void (*)(void *, void *)>(dlsym(aicpu_so_handle_, "set_sim_virtual_clock_hooks"));
+        if (set_aicpu_vclock != nullptr && pto_sim_vclock_enabled()) {
+            set_aicpu_vclock(
+                reinterpret_cast<void *>(pto_sim_vclock_now), reinterpret_cast<void *>(pto_sim_vclock_spin_wait)
+            );
+        }
 
         LOG_INFO("DeviceRunner(sim): Loaded aicpu_execute from %s", aicpu_so_path_.c_str());
     }
@@ -197,6 +216,20 @@ int DeviceRunner::ensure_binaries_loaded(
                 reinterpret_cast<void *>(sim_context_set_cluster_id)
             );
         }
+
+        auto set_aicore_vclock =
+            reinterpret_cast<void (*)(void *, void *)>(dlsym(aicore_so_handle_, "set_sim_virtual_clock_hooks"));
+        if (set_aicore_vclock != nullptr && pto_sim_vclock_enabled()) {
+            set_aicore_vclock(
+                reinterpret_cast<void *>(pto_sim_vclock_now), reinterpret_cast<void *>(pto_sim_vclock_spin_wait)
+            );
+        }
+
+        auto set_cost_model =
+            reinterpret_cast<void (*)(void *)>(dlsym(aicore_so_handle_, "set_sim_cost_model_hook"));
+        if (set_cost_model != nullptr && pto_sim_vclock_enabled()) {
+            set_cost_model(reinterpret_cast<void *>(pto_sim_cost_model_charge));
+        }
     }
 
     return 0;
@@ -216,12 +249,38 @@ int DeviceRunner::copy_to_device(void *dev_ptr, const void *host_ptr, size_t byt
     return 0;
 }
 
+int DeviceRunner::copy_between_device(void *dst_dev, const void *src_dev, size_t bytes) {
+    // In simulation, this is just a memcpy
+    std::memcpy(dst_dev, src_dev, bytes);
+    return 0;
+}
+
+int DeviceRunner::copy_to_device_async(void *dev_ptr, const void *host_ptr, size_t bytes) {
+    // No DMA engine to overlap with in simulation; copy completes inline
+    return copy_to_device(dev_ptr, host_ptr, bytes);
+}
+
+int DeviceRunner::copy_sync() { return 0; }
+
 int DeviceRunner::copy_from_device(void *host_ptr, const void *dev_ptr, size_t bytes) {
     // In simulation, this is just a memcpy
     std::memcpy(host_ptr, dev_ptr, bytes);
     return 0;
 }
 
+int DeviceRunner::warm_up(int device_id) {
+    (void)device_id;
+    // No streams or driver state to prime in simulation; pre-faulting a
+    // scratch block still makes the first run's allocations pool hits.
+    void *scratch = mem_alloc_.alloc(WARM_UP_BYTES);
+    if (scratch == nullptr) {
+        return -1;
+    }
+    std::memset(scratch, 0, WARM_UP_BYTES);
+    mem_alloc_.free(scratch);
+    return 0;
+}
+
 int DeviceRunner::run(
     Runtime &runtime, int block_dim, int device_id, const std::vector<uint8_t> &aicpu_so_binary,
     const std::vector<uint8_t> &aicore_kernel_binary, int launch_aicpu_num, bool enable_dump_tensor
@@ -264,11 +323,13 @@ int DeviceRunner::run(
     }
 
     // Ensure device is initialized
+    uint64_t trace_begin = LaunchTraceRecorder::now_ns();
     int rc = ensure_device_initialized(device_id, aicpu_so_binary, aicore_kernel_binary);
     if (rc != 0) {
         LOG_ERROR("ensure_device_initialized failed: %d", rc);
         return rc;
     }
+    LaunchTraceRecorder::instance().add("device.init", trace_begin);
 
     // Calculate execution parameters
     block_dim_ = block_dim;
@@ -393,7 +454,44 @@ int DeviceRunner::run(
     set_platform_dump_base_func_(kernel_args_.dump_data_base);
     set_enable_dump_tensor_func_(enable_dump_tensor);
 
+    // Binary log mode: place the capture rings in shared memory so the host
+    // tails them in place during the run instead of the device draining at
+    // deinit (sim shares the address space, so format pointers are valid).
+    const char *binlog_env = getenv("SIMPLER_LOG_BINARY");
+    bool binlog_tail = (binlog_env != nullptr && atoi(binlog_env) != 0);
+    if (binlog_tail) {
+        if (binlog_shm_ == nullptr) {
+            binlog_shm_ = mem_alloc_.alloc(sizeof(BinaryLogShm));
+            if (binlog_shm_ == nullptr) {
+                LOG_WARN("Failed to allocate binary log ring region; device drains its own rings");
+            }
+        }
+        if (binlog_shm_ != nullptr) {
+            binlog_tailer_.attach(binlog_shm_);
+        }
+    }
+    set_platform_binlog_base_func_(binlog_tail ? reinterpret_cast<uint64_t>(binlog_shm_) : 0);
+
+    std::atomic<bool> binlog_stop{false};
+    std::thread binlog_thread;
+    if (binlog_tail && binlog_tailer_.is_attached()) {
+        binlog_thread = std::thread([this, &binlog_stop]() {
+            while (!binlog_stop.load(std::memory_order_acquire)) {
+                if (!binlog_tailer_.poll()) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+            }
+        });
+    }
+
+    // Register run actors with the virtual clock so the idle-leap protocol
+    // knows when every participant is blocked in a spin-wait.
+    if (pto_sim_vclock_enabled()) {
+        pto_sim_vclock_set_actor_count(launch_aicpu_num + num_aicore);
+    }
+
     // Launch AICPU threads (over-launch for affinity gate)
+    trace_begin = LaunchTraceRecorder::now_ns();
     constexpr int over_launch = PLATFORM_MAX_AICPU_THREADS_JUST_FOR_LAUNCH;
     LOG_INFO("Launching %d AICPU threads (logical=%d)", over_launch, launch_aicpu_num);
     std::vector<std::thread> aicpu_threads;
@@ -412,15 +510,18 @@ int DeviceRunner::run(
         }));
     }
 
-    // Launch AICore threads
-    LOG_INFO("Launching %d AICore thread(s)", num_aicore);
-    std::vector<std::thread> aicore_threads;
+    // Dispatch AICore execution onto the persistent per-device core pool.
+    // One pool thread per simulated core, reused across runs, so back-to-back
+    // runs skip thread creation and the shared-memory handshake runs with the
+    // same per-core concurrency as onboard.
+    LOG_INFO("Dispatching %d AICore job(s) onto the sim core pool", num_aicore);
+    sim_core_pool_resize(device_id_, num_aicore);
     for (int i = 0; i < num_aicore; i++) {
         CoreType core_type = runtime.workers[i].core_type;
         uint32_t physical_core_id = static_cast<uint32_t>(i);
-        aicore_threads.push_back(create_thread([this, &runtime, i, core_type, physical_core_id]() {
+        sim_core_pool_dispatch(device_id_, i, [this, &runtime, i, core_type, physical_core_id]() {
             aicore_execute_func_(&runtime, i, core_type, physical_core_id, kernel_args_.regs);
-        }));
+        });
     }
 
     // Poll and collect performance data during execution (if enabled)
@@ -442,9 +543,7 @@ int DeviceRunner::run(
         for (auto &t : aicpu_threads) {
             t.join();
         }
-        for (auto &t : aicore_threads) {
-            t.join();
-        }
+        sim_core_pool_wait_idle(device_id_);
 
         // Signal collector that device execution is complete
         if (runtime.enable_profiling) {
@@ -465,9 +564,7 @@ int DeviceRunner::run(
         for (auto &t : aicpu_threads) {
             t.join();
         }
-        for (auto &t : aicore_threads) {
-            t.join();
-        }
+        sim_core_pool_wait_idle(device_id_);
 
         // Signal collector that device execution is complete
         if (runtime.enable_profiling) {
@@ -481,6 +578,21 @@ int DeviceRunner::run(
     }
 
     LOG_INFO("All threads completed");
+    LaunchTraceRecorder::instance().add("device.execute", trace_begin);
+
+    // Producers are gone: stop the tailer and final-drain before the AICPU
+    // .so (and its format literals) is unloaded below.
+    if (binlog_thread.joinable()) {
+        binlog_stop.store(true, std::memory_order_release);
+        binlog_thread.join();
+    }
+    if (binlog_tail && binlog_tailer_.is_attached()) {
+        binlog_tailer_.drain();
+    }
+
+    if (pto_sim_vclock_enabled()) {
+        pto_sim_vclock_set_actor_count(0);
+    }
 
     int runtime_rc = aicpu_rc.load(std::memory_order_acquire);
     if (runtime_rc != 0) {
@@ -495,6 +607,7 @@ int DeviceRunner::run(
         perf_collector_.scan_remaining_perf_buffers();
         perf_collector_.collect_phase_data();
         export_swimlane_json();
+        perf_collector_.export_chrome_trace();
     }
 
     if (enable_dump_tensor) {
@@ -538,6 +651,7 @@ void DeviceRunner::unload_executor_binaries() {
         set_platform_regs_func_ = nullptr;
         set_platform_dump_base_func_ = nullptr;
         set_enable_dump_tensor_func_ = nullptr;
+        set_platform_binlog_base_func_ = nullptr;
     }
     if (!aicpu_so_path_.empty()) {
         std::remove(aicpu_so_path_.c_str());
@@ -599,6 +713,12 @@ int DeviceRunner::finalize() {
     // Close executor .so files (typically already closed by run(), this is a safety net)
     unload_executor_binaries();
 
+    if (binlog_shm_ != nullptr) {
+        binlog_tailer_.detach();
+        mem_alloc_.free(binlog_shm_);
+        binlog_shm_ = nullptr;
+    }
+
     // Free all remaining allocations
     mem_alloc_.finalize();
     clear_cpu_sim_shared_storage();
@@ -680,7 +800,10 @@ uint64_t DeviceRunner::upload_kernel_binary(int func_id, const uint8_t *bin_data
     CoreCallable *callable_copy = reinterpret_cast<CoreCallable *>(copy);
     callable_copy->set_resolved_addr(reinterpret_cast<uint64_t>(func));
 
-    // 7. Store mapping info for cleanup
+    // 7. Register the kernel's modeled cycle cost (virtual-time mode only)
+    register_cost_model_entry(func_id, reinterpret_cast<uint64_t>(func));
+
+    // 8. Store mapping info for cleanup
     MappedKernel kernel;
     kernel.dl_handle = handle;
     kernel.callable_buf = copy;
@@ -694,6 +817,44 @@ uint64_t DeviceRunner::upload_kernel_binary(int func_id, const uint8_t *bin_data
     return reinterpret_cast<uint64_t>(copy);
 }
 
+void DeviceRunner::register_cost_model_entry(int func_id, uint64_t fn_addr) {
+    if (pto_sim_vclock_enabled() == 0) {
+        return;
+    }
+
+    // Lazy-load the measured cost table: one "func_id cycles" pair per line,
+    // '#' starts a comment. Missing file or unlisted kernels fall back to
+    // PTO_SIM_COST_DEFAULT_TICKS inside the sim context.
+    if (!cost_model_table_loaded_) {
+        cost_model_table_loaded_ = true;
+        const char *path = getenv("PTO_SIM_COST_MODEL");
+        if (path != nullptr) {
+            std::ifstream table(path);
+            if (!table.is_open()) {
+                LOG_WARN("PTO_SIM_COST_MODEL set but unreadable: %s", path);
+            }
+            std::string line;
+            while (std::getline(table, line)) {
+                size_t comment = line.find('#');
+                if (comment != std::string::npos) {
+                    line.erase(comment);
+                }
+                int table_func_id;
+                uint64_t cycles;
+                if (sscanf(line.c_str(), "%d %lu", &table_func_id, &cycles) == 2) {
+                    cost_model_table_[table_func_id] = cycles;
+                }
+            }
+            LOG_INFO("Loaded %zu cost model entries from %s", cost_model_table_.size(), path);
+        }
+    }
+
+    auto it = cost_model_table_.find(func_id);
+    if (it != cost_model_table_.end()) {
+        pto_sim_cost_model_register(fn_addr, it->second);
+    }
+}
+
 void DeviceRunner::remove_kernel_binary(int func_id) {
     auto it = func_id_to_addr_.find(func_id);
     if (it == func_id_to_addr_.end()) {
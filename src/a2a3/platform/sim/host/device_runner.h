@@ -37,6 +37,7 @@
 #include <functional>
 #include <iostream>
 #include <map>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -49,6 +50,7 @@
 #include "common/unified_log.h"
 #include "host/function_cache.h"
 #include "host/memory_allocator.h"
+#include "host/binlog_tailer.h"
 #include "host/performance_collector.h"
 #include "host/tensor_dump_collector.h"
 #include "runtime.h"
@@ -113,6 +115,33 @@ public:
      */
     int copy_to_device(void *dev_ptr, const void *host_ptr, size_t bytes);
 
+    /**
+     * Copy data between two device addresses (memcpy in simulation)
+     *
+     * @param dst_dev  Destination pointer
+     * @param src_dev  Source pointer
+     * @param bytes    Number of bytes to copy
+     * @return 0 on success
+     */
+    int copy_between_device(void *dst_dev, const void *src_dev, size_t bytes);
+
+    /**
+     * Queue an asynchronous copy (completes immediately in simulation)
+     *
+     * @param dev_ptr   Destination pointer
+     * @param host_ptr  Source pointer
+     * @param bytes     Number of bytes to copy
+     * @return 0 on success
+     */
+    int copy_to_device_async(void *dev_ptr, const void *host_ptr, size_t bytes);
+
+    /**
+     * Wait for queued asynchronous copies (no-op in simulation)
+     *
+     * @return 0 on success
+     */
+    int copy_sync();
+
     /**
      * Copy data (memcpy in simulation)
      *
@@ -123,6 +152,18 @@ public:
      */
     int copy_from_device(void *host_ptr, const void *dev_ptr, size_t bytes);
 
+    /**
+     * Pre-pay cold-start costs (allocator pool warm-up in simulation)
+     *
+     * There are no streams or driver state to prime in simulation; this
+     * pre-faults a scratch block through the allocator pool so the first
+     * run's allocations are pool hits on already-touched memory.
+     *
+     * @param device_id  Device ID (ignored in simulation)
+     * @return 0 on success
+     */
+    int warm_up(int device_id);
+
     /**
      * Execute a runtime using threads
      *
@@ -209,6 +250,21 @@ public:
      */
     void remove_kernel_binary(int func_id);
 
+    /**
+     * Stash (or clear, with nullptr) the Runtime currently executing on
+     * this context. Set by the C API layer around a run so monitoring
+     * entry points arriving on other threads can reach the live Runtime.
+     * Readers hold active_runtime_mutex() for the duration of the access;
+     * the run thread clears under the same lock before destructing the
+     * Runtime, so a snapshot can never outlive it.
+     */
+    void set_active_runtime(void *rt) {
+        std::lock_guard<std::mutex> lock(active_runtime_mu_);
+        active_runtime_ = rt;
+    }
+    std::mutex &active_runtime_mutex() { return active_runtime_mu_; }
+    void *active_runtime() const { return active_runtime_; }
+
 private:
     // Configuration
     int device_id_{-1};
@@ -219,15 +275,28 @@ private:
     // Memory management
     MemoryAllocator mem_alloc_;
 
+    // Warm-up scratch size (matches the onboard runner)
+    static constexpr size_t WARM_UP_BYTES = 8u << 20;
+
     // Simulation state (no actual device resources)
     KernelArgs kernel_args_;
 
     // Kernel binary mapping (func_id -> executable memory)
     std::map<int, MappedKernel> func_id_to_addr_;
 
+    // Measured cycle costs (func_id -> cycles) from PTO_SIM_COST_MODEL,
+    // registered with the sim context per resolved kernel address at upload
+    std::map<int, uint64_t> cost_model_table_;
+    bool cost_model_table_loaded_{false};
+
     // Runtime pointer for print_handshake_results
     Runtime *last_runtime_{nullptr};
 
+    // Runtime of the in-flight run, for cross-thread monitoring reads
+    // (see set_active_runtime)
+    std::mutex active_runtime_mu_;
+    void *active_runtime_{nullptr};
+
     // Dynamically loaded executor libraries and function pointers
     void *aicpu_so_handle_{nullptr};
     void *aicore_so_handle_{nullptr};
@@ -236,6 +305,7 @@ private:
     void (*set_platform_regs_func_)(uint64_t){nullptr};
     void (*set_platform_dump_base_func_)(uint64_t){nullptr};
     void (*set_enable_dump_tensor_func_)(bool){nullptr};
+    void (*set_platform_binlog_base_func_)(uint64_t){nullptr};
     std::string aicpu_so_path_;
     std::string aicore_so_path_;
 
@@ -245,6 +315,11 @@ private:
     // Tensor dump (independent shared memory + memory manager)
     TensorDumpCollector dump_collector_;
 
+    // Zero-copy host tailing of the device binary log rings
+    // (SIMPLER_LOG_BINARY=1); the ring region is reused across runs
+    BinlogTailer binlog_tailer_;
+    void *binlog_shm_{nullptr};
+
     // Private helper methods
     int ensure_device_initialized(
         int device_id, const std::vector<uint8_t> &aicpu_so_binary, const std::vector<uint8_t> &aicore_kernel_binary
@@ -267,6 +342,18 @@ private:
     int init_performance_profiling(Runtime &runtime, int num_aicore, int device_id);
 
     int init_tensor_dump(Runtime &runtime, int num_aicore, int device_id);
+
+    /**
+     * Register a kernel's modeled cycle cost with the sim context.
+     *
+     * Virtual-time mode only: lazily loads the PTO_SIM_COST_MODEL table
+     * (func_id -> cycles) and keys the entry by the resolved kernel entry
+     * address, which is what the dispatch payload carries at execution time.
+     *
+     * @param func_id  Function identifier (table key)
+     * @param fn_addr  Resolved kernel entry address (charge key)
+     */
+    void register_cost_model_entry(int func_id, uint64_t fn_addr);
 };
 
 #endif  // SRC_A2A3_PLATFORM_SIM_HOST_DEVICE_RUNNER_H_
@@ -9,51 +9,27 @@
  * -----------------------------------------------------------------------------------------------------------
  */
 /**
- * Memory Allocator Implementation (Simulation)
+ * Memory Allocator Driver Hooks (Simulation)
  *
- * Uses standard malloc/free to simulate device memory operations.
+ * Uses standard malloc/free to simulate device memory operations. The
+ * size-class pool layer on top lives in src/host/memory_allocator_pool.cpp.
  */
 
 #include "host/memory_allocator.h"
 
 #include <cstdlib>
-#include "common/unified_log.h"
 
-MemoryAllocator::~MemoryAllocator() { finalize(); }
+#include "common/unified_log.h"
 
-void *MemoryAllocator::alloc(size_t size) {
+void *MemoryAllocator::driver_alloc(size_t size) {
     void *ptr = std::malloc(size);
     if (ptr == nullptr) {
         LOG_ERROR("malloc failed (size=%zu)", size);
-        return nullptr;
     }
-
-    std::lock_guard<std::mutex> lk(mu_);
-    ptr_set_.insert(ptr);
     return ptr;
 }
 
-int MemoryAllocator::free(void *ptr) {
-    if (ptr == nullptr) {
-        return 0;
-    }
-
-    std::lock_guard<std::mutex> lk(mu_);
-    auto it = ptr_set_.find(ptr);
-    if (it == ptr_set_.end()) {
-        return 0;
-    }
-
+int MemoryAllocator::driver_free(void *ptr) {
     std::free(ptr);
-    ptr_set_.erase(it);
-    return 0;
-}
-
-int MemoryAllocator::finalize() {
-    std::lock_guard<std::mutex> lk(mu_);
-    for (void *ptr : ptr_set_) {
-        std::free(ptr);
-    }
-    ptr_set_.clear();
     return 0;
 }
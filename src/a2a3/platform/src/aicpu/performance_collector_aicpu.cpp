@@ -28,6 +28,8 @@
 #include "common/platform_config.h"
 #include "common/unified_log.h"
 
+#if PTO_INSTRUMENTATION
+
 // Cached pointers for hot-path access (set during init)
 static AicpuPhaseHeader *s_phase_header = nullptr;
 static PerfDataHeader *s_perf_header = nullptr;
@@ -41,6 +43,15 @@ static PhaseBuffer *s_current_phase_buf[PLATFORM_MAX_AICPU_THREADS] = {};
 
 static int s_orch_thread_idx = -1;
 
+// Per-core finish timestamp of the previous task (for dispatch-gap histogram)
+static uint64_t s_hist_prev_finish[PLATFORM_MAX_CORES] = {};
+
+// Per-core delta-encoding base for the committed record stream.
+// Re-zeroed whenever a buffer starts empty (count == 0) so each buffer
+// decodes standalone; safe because each core's commits are serialized on
+// its owning scheduler thread.
+static PerfDeltaBase s_delta_base[PLATFORM_MAX_CORES] = {};
+
 /**
  * Enqueue ready buffer to per-thread queue
  *
@@ -83,6 +94,7 @@ void perf_aicpu_init_profiling(Runtime *runtime) {
     }
 
     s_perf_header = get_perf_header(perf_base);
+    memset(s_hist_prev_finish, 0, sizeof(s_hist_prev_finish));
 
     int32_t task_count = runtime->get_task_count();
     s_perf_header->total_tasks = static_cast<uint32_t>(task_count);
@@ -110,6 +122,7 @@ void perf_aicpu_init_profiling(Runtime *runtime) {
             wmb();
 
             PerfBuffer *buf = reinterpret_cast<PerfBuffer *>(buf_ptr);
+            buf->bytes_used = 0;
             buf->count = 0;
             h->perf_records_addr = buf_ptr;
 
@@ -127,42 +140,94 @@ void perf_aicpu_init_profiling(Runtime *runtime) {
 }
 
 int perf_aicpu_complete_record(
-    PerfBuffer *perf_buf, uint32_t expected_reg_task_id, uint64_t task_id, uint32_t func_id, CoreType core_type,
-    uint64_t dispatch_time, uint64_t finish_time, const uint64_t *fanout, int32_t fanout_count
+    PerfBuffer *perf_buf, int core_id, uint32_t expected_reg_task_id, uint64_t task_id, uint32_t func_id,
+    CoreType core_type, uint64_t dispatch_time, uint64_t finish_time, const uint64_t *fanout, int32_t fanout_count,
+    uint64_t pmu_cache_miss, uint64_t pmu_bus_access
 ) {
     rmb();
+    bool hist_only = s_perf_header != nullptr && s_perf_header->hist_only != 0;
     uint32_t count = perf_buf->count;
-    if (count >= PLATFORM_PROF_BUFFER_SIZE) return -1;
+    uint32_t bytes_used = perf_buf->bytes_used;
+    if (!hist_only &&
+        (count >= PLATFORM_PROF_BUFFER_SIZE || bytes_used + PERF_RECORD_ENCODED_MAX > PLATFORM_PROF_DATA_BYTES)) {
+        return -1;
+    }
 
     // Read from WIP staging slot (AICore writes here, parity = reg_task_id & 1)
     PerfRecord *wip = &perf_buf->wip[expected_reg_task_id & 1u];
-    // One PoC cache line: matches AICore perf_aicore_record_task() dcci(..., SINGLE_CACHE_LINE, ...)
-    // and aicpu/cache_ops.cpp step size; wip timing fields live in the first line.
-    cache_invalidate_range(wip, 64);
+    // PoC cache lines matching the AICore perf_aicore_record_task() dcci set
+    // and the aicpu/cache_ops.cpp step size: timing fields on the first line,
+    // phase_count + markers[0..5] on the second. markers[6..7] live on a
+    // third line that both sides touch only when the kernel filled past six.
+    cache_invalidate_range(wip, 128);
     if (static_cast<uint32_t>(wip->task_id) != expected_reg_task_id) return -1;
+    int32_t phase_count = wip->phase_count;
+    if (phase_count < 0) phase_count = 0;
+    if (phase_count > static_cast<int32_t>(PERF_PHASE_MARKER_SLOTS)) {
+        phase_count = static_cast<int32_t>(PERF_PHASE_MARKER_SLOTS);
+    }
+    if (phase_count > 6) {
+        cache_invalidate_range(&wip->phase_markers[6], 64);
+    }
 
-    // Copy AICore timing to committed record slot
-    PerfRecord *record = &perf_buf->records[count];
-    record->start_time = wip->start_time;
-    record->end_time = wip->end_time;
+    // Cycle histograms: a few adds per task, no buffer traffic. sys_cnt is a
+    // shared system counter, so AICPU (dispatch/finish) and AICore
+    // (start/end) timestamps are directly comparable.
+    if (s_perf_header != nullptr && core_id >= 0 && core_id < PLATFORM_MAX_CORES) {
+        PerfCycleHist &hist = s_perf_header->cycle_hist[core_id];
+        uint64_t prev_finish = s_hist_prev_finish[core_id];
+        if (prev_finish != 0 && dispatch_time > prev_finish) {
+            hist.dispatch_gap[perf_hist_bucket(dispatch_time - prev_finish)]++;
+        }
+        if (wip->start_time > dispatch_time) {
+            hist.queue_wait[perf_hist_bucket(wip->start_time - dispatch_time)]++;
+        }
+        if (wip->end_time > wip->start_time) {
+            hist.kernel_cycles[perf_hist_bucket(wip->end_time - wip->start_time)]++;
+        }
+        hist.task_count++;
+        s_hist_prev_finish[core_id] = finish_time;
+    }
 
-    // Fill AICPU-owned fields
-    record->task_id = task_id;
-    record->func_id = func_id;
-    record->core_type = core_type;
-    record->dispatch_time = dispatch_time;
-    record->finish_time = finish_time;
+    if (hist_only) return 0;
+
+    // Assemble the record and append it to the encoded stream
+    PerfRecord record;
+    record.start_time = wip->start_time;
+    record.end_time = wip->end_time;
+    record.task_id = task_id;
+    record.func_id = func_id;
+    record.core_type = core_type;
+    record.dispatch_time = dispatch_time;
+    record.finish_time = finish_time;
+    record.pmu_cache_miss = pmu_cache_miss;
+    record.pmu_bus_access = pmu_bus_access;
+
+    // Intra-kernel phase markers ride along from the WIP slot; the executor
+    // zeroed phase_count before the kernel ran, so the count is trustworthy.
+    record.phase_count = phase_count;
+    for (int32_t i = 0; i < phase_count; i++) {
+        record.phase_markers[i] = wip->phase_markers[i];
+    }
 
     if (fanout != nullptr && fanout_count > 0) {
         int32_t n = (fanout_count > RUNTIME_MAX_FANOUT) ? RUNTIME_MAX_FANOUT : fanout_count;
         for (int32_t i = 0; i < n; i++) {
-            record->fanout[i] = fanout[i];
+            record.fanout[i] = fanout[i];
         }
-        record->fanout_count = n;
+        record.fanout_count = n;
     } else {
-        record->fanout_count = 0;
+        record.fanout_count = 0;
+    }
+
+    if (count == 0 && core_id >= 0 && core_id < PLATFORM_MAX_CORES) {
+        s_delta_base[core_id] = PerfDeltaBase{};
     }
+    PerfDeltaBase local_base{};
+    PerfDeltaBase *base = (core_id >= 0 && core_id < PLATFORM_MAX_CORES) ? &s_delta_base[core_id] : &local_base;
+    uint32_t encoded = perf_record_encode(&perf_buf->data[bytes_used], &record, base);
 
+    perf_buf->bytes_used = bytes_used + encoded;
     perf_buf->count = count + 1;
     wmb();
     return 0;
@@ -194,6 +259,7 @@ void perf_aicpu_switch_buffer(Runtime *runtime, int core_id, int thread_idx) {
     if (head == tail) {
         // No replacement buffer available — overwrite current buffer to keep AICore alive
         LOG_WARN("Thread %d: Core %d no free buffer, overwriting current buffer (data lost)", thread_idx, core_id);
+        full_buf->bytes_used = 0;
         full_buf->count = 0;
         wmb();
         return;
@@ -205,6 +271,7 @@ void perf_aicpu_switch_buffer(Runtime *runtime, int core_id, int thread_idx) {
     if (rc != 0) {
         LOG_ERROR("Thread %d: Core %d failed to enqueue buffer (queue full), data lost!", thread_idx, core_id);
         // Revert: discard data and keep writing
+        full_buf->bytes_used = 0;
         full_buf->count = 0;
         wmb();
         return;
@@ -219,6 +286,7 @@ void perf_aicpu_switch_buffer(Runtime *runtime, int core_id, int thread_idx) {
     wmb();
 
     PerfBuffer *new_buf = reinterpret_cast<PerfBuffer *>(new_buf_ptr);
+    new_buf->bytes_used = 0;
     new_buf->count = 0;
 
     // Update handshake for AICore
@@ -290,6 +358,10 @@ void perf_aicpu_update_total_tasks(Runtime *runtime, uint32_t total_tasks) {
     wmb();
 }
 
+uint32_t perf_aicpu_pmu_sample_interval() {
+    return s_perf_header != nullptr ? s_perf_header->pmu_sample_interval : 0;
+}
+
 void perf_aicpu_init_phase_profiling(Runtime *runtime, int num_sched_threads) {
     void *perf_base = reinterpret_cast<void *>(runtime->perf_data_base);
     if (perf_base == nullptr) {
@@ -489,6 +561,21 @@ void perf_aicpu_write_orch_summary(const AicpuOrchSummary *src) {
     );
 }
 
+void perf_aicpu_write_sched_summary(int thread_idx, const AicpuSchedSummary *src) {
+    if (s_phase_header == nullptr || thread_idx < 0 || thread_idx >= static_cast<int>(PLATFORM_MAX_AICPU_THREADS)) {
+        return;
+    }
+
+    AicpuSchedSummary *dst = &s_phase_header->sched_summary[thread_idx];
+
+    uint32_t seq = dst->publish_seq;
+    memcpy(dst, src, sizeof(AicpuSchedSummary));
+    dst->publish_seq = seq + 1;
+    dst->magic = AICPU_PHASE_MAGIC;
+
+    wmb();
+}
+
 void perf_aicpu_set_orch_thread_idx(int thread_idx) { s_orch_thread_idx = thread_idx; }
 
 void perf_aicpu_record_orch_phase(
@@ -556,3 +643,5 @@ void perf_aicpu_write_core_assignments(
 
     LOG_INFO("Core-to-thread mapping written: %d cores, %d threads", total_cores, num_threads);
 }
+
+#endif  // PTO_INSTRUMENTATION
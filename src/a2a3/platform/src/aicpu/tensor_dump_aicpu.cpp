@@ -21,22 +21,43 @@
 
 #include "aicpu/tensor_dump_aicpu.h"
 
+#include <cfloat>
+#include <cstdlib>
 #include <cstring>
 
 #include "common/memory_barrier.h"
 #include "common/platform_config.h"
 #include "common/unified_log.h"
 
+#if PTO_INSTRUMENTATION
+
 // Cached pointers for hot-path access (set during init)
 static uint64_t g_platform_dump_base = 0;
 static DumpDataHeader *s_dump_header = nullptr;
 static DumpBufferState *s_dump_states[PLATFORM_MAX_AICPU_THREADS] = {};
 static DumpMetaBuffer *s_current_dump_buf[PLATFORM_MAX_AICPU_THREADS] = {};
+static DumpDropStats *s_drop_stats[PLATFORM_MAX_AICPU_THREADS] = {};
+
+// In-flight cap: full buffers a thread may have awaiting host collection
+// before new records displace old ones (PTO2_DUMP_MAX_INFLIGHT)
+static uint32_t s_dump_max_inflight = PLATFORM_DUMP_READYQUEUE_SIZE - 1;
+
+// Content-hash dedup (PTO2_DUMP_DEDUP): per-thread cache of the last payload
+// hash seen at each dump point. A repeat hash skips the arena copy entirely.
+struct DumpDedupEntry {
+    uint32_t func_id;
+    uint32_t arg_index;
+    uint64_t hash;
+    bool valid;
+};
+static bool s_dump_dedup_enabled = false;
+static DumpDedupEntry s_dedup_cache[PLATFORM_MAX_AICPU_THREADS][PLATFORM_DUMP_DEDUP_CACHE_ENTRIES] = {};
 
 static bool s_logged_ready_queue_full[PLATFORM_MAX_AICPU_THREADS] = {};
 static bool s_logged_no_free_meta_buffer[PLATFORM_MAX_AICPU_THREADS] = {};
 static bool s_logged_dump_layout_mismatch = false;
 static uint32_t s_records_written[PLATFORM_MAX_AICPU_THREADS] = {};
+static uint32_t s_records_trigger_skipped[PLATFORM_MAX_AICPU_THREADS] = {};
 static uint32_t s_buffers_switched[PLATFORM_MAX_AICPU_THREADS] = {};
 static uint32_t s_buffers_flushed[PLATFORM_MAX_AICPU_THREADS] = {};
 
@@ -49,6 +70,47 @@ static inline void account_dropped_records(DumpBufferState *state, uint32_t drop
     state->dropped_record_count = (next < prev) ? UINT32_MAX : next;
 }
 
+/**
+ * Attribute dropped records to their dump point (func_id, arg_index) so the
+ * host can report exactly what was missed. Single writer per thread.
+ */
+static void account_dropped_point(int thread_idx, uint32_t func_id, uint32_t arg_index, uint32_t dropped) {
+    DumpDropStats *stats = s_drop_stats[thread_idx];
+    if (stats == nullptr || dropped == 0) {
+        return;
+    }
+    for (int i = 0; i < PLATFORM_DUMP_DROP_STATS_ENTRIES; i++) {
+        DumpDropStatEntry &entry = stats->entries[i];
+        if (entry.dropped != 0 && (entry.func_id != func_id || entry.arg_index != arg_index)) {
+            continue;
+        }
+        if (entry.dropped == 0) {
+            entry.func_id = func_id;
+            entry.arg_index = arg_index;
+        }
+        uint32_t next = entry.dropped + dropped;
+        entry.dropped = (next < entry.dropped) ? UINT32_MAX : next;
+        return;
+    }
+    uint32_t next = stats->overflow_dropped + dropped;
+    stats->overflow_dropped = (next < stats->overflow_dropped) ? UINT32_MAX : next;
+}
+
+/**
+ * Account every record in a buffer that is about to be overwritten,
+ * both in the aggregate counter and per dump point.
+ */
+static void account_dropped_buffer(int thread_idx, DumpBufferState *state, DumpMetaBuffer *buf) {
+    uint32_t count = buf->count;
+    if (count > PLATFORM_DUMP_RECORDS_PER_BUFFER) {
+        count = PLATFORM_DUMP_RECORDS_PER_BUFFER;
+    }
+    account_dropped_records(state, count);
+    for (uint32_t i = 0; i < count; i++) {
+        account_dropped_point(thread_idx, buf->records[i].func_id, buf->records[i].arg_index, 1);
+    }
+}
+
 extern "C" void set_platform_dump_base(uint64_t dump_data_base) { g_platform_dump_base = dump_data_base; }
 
 extern "C" uint64_t get_platform_dump_base() { return g_platform_dump_base; }
@@ -59,6 +121,251 @@ extern "C" void set_enable_dump_tensor(bool enable) { g_enable_dump_tensor = ena
 
 extern "C" bool get_enable_dump_tensor() { return g_enable_dump_tensor; }
 
+// =============================================================================
+// Dump Filters - On-device payload reduction (PTO2_DUMP_FILTER)
+// =============================================================================
+
+static TensorDumpFilterSpec s_dump_filters[PLATFORM_DUMP_MAX_FILTERS] = {};
+static int s_dump_filter_count = 0;
+static bool s_logged_summary_dtype_unsupported = false;
+static bool s_logged_trigger_dtype_unsupported = false;
+
+/**
+ * Parse one `key:value,key:value,...` entry of the filter spec.
+ * The entry is a substring of the env value, delimited by [entry, entry_end).
+ */
+static bool parse_dump_filter_entry(const char *entry, const char *entry_end, TensorDumpFilterSpec *spec) {
+    spec->func_id = UINT32_MAX;
+    spec->arg_index = -1;
+    spec->mode = TensorDumpFilterMode::FULL;
+    spec->downcast_fp16 = false;
+    spec->row_stride = 1;
+    memset(spec->box_begin, 0, sizeof(spec->box_begin));
+    memset(spec->box_end, 0, sizeof(spec->box_end));
+    spec->trigger = TensorDumpTrigger::ALWAYS;
+    spec->trigger_bound = 0.0f;
+
+    const char *p = entry;
+    while (p < entry_end) {
+        const char *pair_end = p;
+        while (pair_end < entry_end && *pair_end != ',') {
+            pair_end++;
+        }
+        const char *colon = p;
+        while (colon < pair_end && *colon != ':') {
+            colon++;
+        }
+        if (colon == pair_end || colon + 1 == pair_end) {
+            return false;
+        }
+        size_t key_len = static_cast<size_t>(colon - p);
+        const char *val = colon + 1;
+        size_t val_len = static_cast<size_t>(pair_end - val);
+        char *num_end = nullptr;
+
+        if (key_len == 4 && strncmp(p, "func", 4) == 0) {
+            if (!(val_len == 1 && *val == '*')) {
+                unsigned long v = strtoul(val, &num_end, 10);
+                if (num_end != pair_end) {
+                    return false;
+                }
+                spec->func_id = static_cast<uint32_t>(v);
+            }
+        } else if (key_len == 3 && strncmp(p, "arg", 3) == 0) {
+            if (!(val_len == 1 && *val == '*')) {
+                unsigned long v = strtoul(val, &num_end, 10);
+                if (num_end != pair_end) {
+                    return false;
+                }
+                spec->arg_index = static_cast<int32_t>(v);
+            }
+        } else if (key_len == 4 && strncmp(p, "mode", 4) == 0) {
+            if (val_len == 4 && strncmp(val, "full", 4) == 0) {
+                spec->mode = TensorDumpFilterMode::FULL;
+            } else if (val_len == 4 && strncmp(val, "rows", 4) == 0) {
+                spec->mode = TensorDumpFilterMode::ROW_STRIDE;
+            } else if (val_len == 3 && strncmp(val, "box", 3) == 0) {
+                spec->mode = TensorDumpFilterMode::BOUNDING_BOX;
+            } else if (val_len == 7 && strncmp(val, "summary", 7) == 0) {
+                spec->mode = TensorDumpFilterMode::SUMMARY;
+            } else {
+                return false;
+            }
+        } else if (key_len == 6 && strncmp(p, "stride", 6) == 0) {
+            unsigned long v = strtoul(val, &num_end, 10);
+            if (num_end != pair_end || v == 0) {
+                return false;
+            }
+            spec->row_stride = static_cast<uint32_t>(v);
+        } else if (key_len == 4 && strncmp(p, "cast", 4) == 0) {
+            if (val_len != 4 || strncmp(val, "fp16", 4) != 0) {
+                return false;
+            }
+            spec->downcast_fp16 = true;
+        } else if (key_len == 4 && strncmp(p, "trig", 4) == 0) {
+            if (val_len == 3 && strncmp(val, "nan", 3) == 0) {
+                spec->trigger = TensorDumpTrigger::NAN_INF;
+            } else if (val_len == 6 && strncmp(val, "absmax", 6) == 0) {
+                spec->trigger = TensorDumpTrigger::ABS_MAX;
+            } else if (val_len == 4 && strncmp(val, "flag", 4) == 0) {
+                spec->trigger = TensorDumpTrigger::USER_FLAG;
+            } else {
+                return false;
+            }
+        } else if (key_len == 5 && strncmp(p, "bound", 5) == 0) {
+            float v = strtof(val, &num_end);
+            if (num_end != pair_end || !(v >= 0.0f)) {
+                return false;
+            }
+            spec->trigger_bound = v;
+        } else if (key_len == 3 && strncmp(p, "box", 3) == 0) {
+            // Slash-separated begin-end pairs, outermost dimension first
+            const char *q = val;
+            for (int d = 0; d < PLATFORM_DUMP_MAX_DIMS && q < pair_end; d++) {
+                unsigned long begin = strtoul(q, &num_end, 10);
+                if (num_end == q || num_end >= pair_end || *num_end != '-') {
+                    return false;
+                }
+                q = num_end + 1;
+                unsigned long end = strtoul(q, &num_end, 10);
+                if (num_end == q) {
+                    return false;
+                }
+                spec->box_begin[d] = static_cast<uint32_t>(begin);
+                spec->box_end[d] = static_cast<uint32_t>(end);
+                q = num_end;
+                if (q < pair_end) {
+                    if (*q != '/') {
+                        return false;
+                    }
+                    q++;
+                }
+            }
+            if (q != pair_end) {
+                return false;
+            }
+        } else {
+            return false;
+        }
+
+        p = (pair_end < entry_end) ? pair_end + 1 : entry_end;
+    }
+    return true;
+}
+
+int dump_tensor_configure_filters(const char *spec) {
+    s_dump_filter_count = 0;
+    if (spec == nullptr || *spec == '\0') {
+        return 0;
+    }
+    const char *spec_end = spec + strlen(spec);
+    const char *p = spec;
+    while (p < spec_end) {
+        const char *entry_end = p;
+        while (entry_end < spec_end && *entry_end != ';') {
+            entry_end++;
+        }
+        if (entry_end > p) {
+            if (s_dump_filter_count >= PLATFORM_DUMP_MAX_FILTERS) {
+                LOG_WARN(
+                    "PTO2_DUMP_FILTER has more than %d entries, ignoring the rest", PLATFORM_DUMP_MAX_FILTERS
+                );
+                break;
+            }
+            if (!parse_dump_filter_entry(p, entry_end, &s_dump_filters[s_dump_filter_count])) {
+                LOG_ERROR(
+                    "Invalid PTO2_DUMP_FILTER entry '%.*s', disabling dump filters",
+                    static_cast<int>(entry_end - p), p
+                );
+                s_dump_filter_count = 0;
+                return -1;
+            }
+            s_dump_filter_count++;
+        }
+        p = entry_end + 1;
+    }
+    return s_dump_filter_count;
+}
+
+const TensorDumpFilterSpec *dump_tensor_match_filter(uint32_t func_id, uint32_t arg_index) {
+    const TensorDumpFilterSpec *best = nullptr;
+    int best_score = -1;
+    for (int i = 0; i < s_dump_filter_count; i++) {
+        const TensorDumpFilterSpec &f = s_dump_filters[i];
+        if (f.func_id != UINT32_MAX && f.func_id != func_id) {
+            continue;
+        }
+        if (f.arg_index >= 0 && static_cast<uint32_t>(f.arg_index) != arg_index) {
+            continue;
+        }
+        int score = (f.func_id != UINT32_MAX ? 2 : 0) + (f.arg_index >= 0 ? 1 : 0);
+        if (score > best_score) {
+            best_score = score;
+            best = &f;
+        }
+    }
+    return best;
+}
+
+// =============================================================================
+// FLOAT32 <-> FLOAT16 bit conversion (software, round-to-nearest-even)
+// =============================================================================
+
+static inline uint16_t dump_fp32_to_fp16_bits(float f) {
+    uint32_t bits;
+    memcpy(&bits, &f, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000u;
+    uint32_t exp = (bits >> 23) & 0xFFu;
+    uint32_t mant = bits & 0x7FFFFFu;
+    if (exp == 0xFFu) {
+        return static_cast<uint16_t>(sign | 0x7C00u | (mant != 0 ? 0x200u : 0));  // Inf / NaN
+    }
+    int32_t e = static_cast<int32_t>(exp) - 127 + 15;
+    if (e >= 0x1F) {
+        return static_cast<uint16_t>(sign | 0x7C00u);  // Overflow to Inf
+    }
+    if (e <= 0) {
+        if (e < -10) {
+            return static_cast<uint16_t>(sign);  // Underflow to signed zero
+        }
+        mant |= 0x800000u;
+        uint32_t shift = static_cast<uint32_t>(14 - e);
+        uint32_t half = mant >> shift;
+        uint32_t rem = mant & ((1u << shift) - 1u);
+        uint32_t halfway = 1u << (shift - 1);
+        if (rem > halfway || (rem == halfway && (half & 1u))) {
+            half++;
+        }
+        return static_cast<uint16_t>(sign | half);
+    }
+    uint32_t half = (static_cast<uint32_t>(e) << 10) | (mant >> 13);
+    uint32_t rem = mant & 0x1FFFu;
+    // Rounding may carry into the exponent, which yields the correct result
+    if (rem > 0x1000u || (rem == 0x1000u && (half & 1u))) {
+        half++;
+    }
+    return static_cast<uint16_t>(sign | half);
+}
+
+static inline float dump_fp16_bits_to_fp32(uint16_t h) {
+    uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+    uint32_t exp = (h >> 10) & 0x1Fu;
+    uint32_t mant = h & 0x3FFu;
+    uint32_t bits;
+    if (exp == 0x1Fu) {
+        bits = sign | 0x7F800000u | (mant << 13);  // Inf / NaN
+    } else if (exp != 0) {
+        bits = sign | ((exp + 112u) << 23) | (mant << 13);
+    } else {
+        // Subnormal half: mant * 2^-24, exact in float
+        float f = static_cast<float>(mant) * (1.0f / 16777216.0f);
+        return (sign != 0) ? -f : f;
+    }
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
 bool get_tensor_dump_role_from_direction(ArgDirection dir, TensorDumpRole *role) {
     switch (dir) {
     case ArgDirection::IN:
@@ -129,15 +436,14 @@ static int enqueue_dump_ready_buffer(int thread_idx, uint64_t buffer_ptr, uint32
     return 0;
 }
 
-/**
- * Maximum spin-wait iterations when free_queue or ready_queue is exhausted.
- * Gives host mgmt_loop time to replenish before falling back to buffer overwrite.
- */
-static constexpr uint32_t DUMP_SPIN_WAIT_LIMIT = 1000000;
-
 /**
  * Switch metadata buffer: enqueue the full buffer, pop a new one.
- * Spin-waits briefly for host to replenish before falling back to overwrite.
+ *
+ * Never blocks. When the host has fallen behind — free queue empty, ready
+ * queue full, or the PTO2_DUMP_MAX_INFLIGHT cap reached — the current
+ * buffer's records (the oldest un-shipped data) are dropped and the buffer
+ * is reused, with every drop attributed per dump point. A profiling run
+ * must not distort the schedule it is observing.
  */
 static int switch_dump_meta_buffer(int thread_idx) {
     if (thread_idx < 0 || thread_idx >= PLATFORM_MAX_AICPU_THREADS) {
@@ -149,59 +455,43 @@ static int switch_dump_meta_buffer(int thread_idx) {
         return -1;
     }
 
-    // Spin-wait for a free buffer, giving host mgmt_loop time to replenish
     rmb();
+    uint32_t q_head = s_dump_header->queue_heads[thread_idx];
+    uint32_t q_tail = s_dump_header->queue_tails[thread_idx];
+    uint32_t inflight = (q_tail + PLATFORM_DUMP_READYQUEUE_SIZE - q_head) % PLATFORM_DUMP_READYQUEUE_SIZE;
     uint32_t head = state->free_queue.head;
     uint32_t tail = state->free_queue.tail;
-    if (head == tail) {
-        for (uint32_t spin = 0; spin < DUMP_SPIN_WAIT_LIMIT; spin++) {
-            rmb();
-            head = state->free_queue.head;
-            tail = state->free_queue.tail;
-            if (head != tail) {
-                break;
-            }
-        }
-    }
-    if (head == tail) {
-        // Still empty after spin — overwrite current buffer
-        account_dropped_records(state, cur->count);
+
+    if (inflight >= s_dump_max_inflight || head == tail) {
+        // Host is behind — drop the oldest un-shipped records and reuse the buffer
+        account_dropped_buffer(thread_idx, state, cur);
         cur->count = 0;
         wmb();
         if (!s_logged_no_free_meta_buffer[thread_idx]) {
             s_logged_no_free_meta_buffer[thread_idx] = true;
             LOG_WARN(
-                "Tensor dump ran out of free metadata buffers on thread %d after spin-wait, "
-                "overwriting current buffer. Increase PLATFORM_DUMP_BUFFERS_PER_THREAD.",
-                thread_idx
+                "Tensor dump host collection is behind on thread %d (in-flight %u, cap %u), "
+                "dropping oldest un-shipped records. Raise PTO2_DUMP_MAX_INFLIGHT or "
+                "PLATFORM_DUMP_BUFFERS_PER_THREAD.",
+                thread_idx, inflight, s_dump_max_inflight
             );
         }
         return 0;
     }
 
-    // Enqueue the full buffer (spin-wait if ready queue is full)
+    // Enqueue the full buffer
     uint64_t buf_addr = reinterpret_cast<uint64_t>(cur);
     uint32_t seq = state->current_buf_seq;
-    int rc = enqueue_dump_ready_buffer(thread_idx, buf_addr, seq);
-    if (rc != 0) {
-        for (uint32_t spin = 0; spin < DUMP_SPIN_WAIT_LIMIT; spin++) {
-            rmb();
-            rc = enqueue_dump_ready_buffer(thread_idx, buf_addr, seq);
-            if (rc == 0) {
-                break;
-            }
-        }
-    }
-    if (rc != 0) {
-        // Still full after spin — overwrite current buffer
-        account_dropped_records(state, cur->count);
+    if (enqueue_dump_ready_buffer(thread_idx, buf_addr, seq) != 0) {
+        // Ready queue full — same drop-and-reuse policy, never block
+        account_dropped_buffer(thread_idx, state, cur);
         cur->count = 0;
         wmb();
         if (!s_logged_ready_queue_full[thread_idx]) {
             s_logged_ready_queue_full[thread_idx] = true;
             LOG_WARN(
-                "Tensor dump ready queue full on thread %d after spin-wait, "
-                "overwriting current buffer. Increase PLATFORM_DUMP_READYQUEUE_SIZE.",
+                "Tensor dump ready queue full on thread %d, dropping oldest un-shipped records. "
+                "Increase PLATFORM_DUMP_READYQUEUE_SIZE.",
                 thread_idx
             );
         }
@@ -230,8 +520,9 @@ struct CircularArenaWriter {
     uint64_t arena_size;
     uint64_t base_offset;
     uint64_t bytes_written;
+    bool downcast_fp16;
 
-    void write(const void *src, uint64_t size) {
+    void write_raw(const void *src, uint64_t size) {
         if (size == 0) {
             return;
         }
@@ -245,6 +536,30 @@ struct CircularArenaWriter {
         }
         bytes_written += size;
     }
+
+    // size is in source bytes; with downcast_fp16 set the FLOAT32 source is
+    // stored as FLOAT16 bits, halving the arena footprint.
+    void write(const void *src, uint64_t size) {
+        if (!downcast_fp16) {
+            write_raw(src, size);
+            return;
+        }
+        const float *values = reinterpret_cast<const float *>(src);
+        uint64_t count = size / sizeof(float);
+        uint16_t chunk[256];
+        uint64_t done = 0;
+        while (done < count) {
+            uint64_t n = count - done;
+            if (n > 256) {
+                n = 256;
+            }
+            for (uint64_t i = 0; i < n; i++) {
+                chunk[i] = dump_fp32_to_fp16_bits(values[done + i]);
+            }
+            write_raw(chunk, n * sizeof(uint16_t));
+            done += n;
+        }
+    }
 };
 
 static inline uint64_t get_tensor_dump_num_elements(const TensorDumpInfo &info) {
@@ -327,6 +642,168 @@ static inline void write_tensor_dump_logical_prefix(
     gather_tensor_dump_dim(writer, info, elem_sz, 0, 0, &remaining_bytes);
 }
 
+// =============================================================================
+// Summary-only dumps (TensorDumpFilterMode::SUMMARY)
+// =============================================================================
+
+struct DumpSummaryAccum {
+    float min_val;
+    float max_val;
+    double sum;
+    uint64_t valid_count;
+    uint64_t nan_count;
+};
+
+static void dump_summary_accumulate(DumpSummaryAccum *acc, const char *src, uint64_t count, DataType dtype) {
+    for (uint64_t i = 0; i < count; i++) {
+        float v;
+        if (dtype == DataType::FLOAT32) {
+            v = reinterpret_cast<const float *>(src)[i];
+        } else {
+            v = dump_fp16_bits_to_fp32(reinterpret_cast<const uint16_t *>(src)[i]);
+        }
+        if (v != v) {
+            acc->nan_count++;
+            continue;
+        }
+        if (acc->valid_count == 0) {
+            acc->min_val = v;
+            acc->max_val = v;
+        } else {
+            acc->min_val = (v < acc->min_val) ? v : acc->min_val;
+            acc->max_val = (v > acc->max_val) ? v : acc->max_val;
+        }
+        acc->sum += v;
+        acc->valid_count++;
+    }
+}
+
+static void summarize_tensor_dump_dim(
+    const TensorDumpInfo &info, uint64_t elem_sz, uint32_t dim, uint64_t base_element_index, DumpSummaryAccum *acc
+) {
+    if (dim >= PLATFORM_DUMP_MAX_DIMS) {
+        return;
+    }
+    if (dim + 1 >= info.ndims) {
+        uint64_t row_start = base_element_index + info.offsets[dim];
+        const char *src = reinterpret_cast<const char *>(info.buffer_addr) + row_start * elem_sz;
+        dump_summary_accumulate(acc, src, info.shapes[dim], static_cast<DataType>(info.dtype));
+        return;
+    }
+    uint64_t inner_stride = 1;
+    for (uint32_t d = dim + 1; d < info.ndims && d < PLATFORM_DUMP_MAX_DIMS; d++) {
+        inner_stride *= info.raw_shapes[d];
+    }
+    for (uint32_t i = 0; i < info.shapes[dim]; i++) {
+        uint64_t next_base = base_element_index + (static_cast<uint64_t>(info.offsets[dim]) + i) * inner_stride;
+        summarize_tensor_dump_dim(info, elem_sz, dim + 1, next_base, acc);
+    }
+}
+
+static TensorDumpSummary compute_tensor_dump_summary(const TensorDumpInfo &info, uint64_t elem_sz) {
+    DumpSummaryAccum acc = {0.0f, 0.0f, 0.0, 0, 0};
+    const char *base = reinterpret_cast<const char *>(info.buffer_addr);
+    if (info.ndims == 0) {
+        dump_summary_accumulate(&acc, base, 1, static_cast<DataType>(info.dtype));
+    } else if (tensor_dump_is_contiguous(info)) {
+        uint64_t start_offset = tensor_dump_start_offset_elements(info);
+        dump_summary_accumulate(
+            &acc, base + start_offset * elem_sz, get_tensor_dump_num_elements(info),
+            static_cast<DataType>(info.dtype)
+        );
+    } else {
+        summarize_tensor_dump_dim(info, elem_sz, 0, 0, &acc);
+    }
+
+    TensorDumpSummary summary = {};
+    summary.min_val = acc.min_val;
+    summary.max_val = acc.max_val;
+    summary.mean = (acc.valid_count > 0) ? static_cast<float>(acc.sum / static_cast<double>(acc.valid_count)) : 0.0f;
+    summary.nan_count = (acc.nan_count > UINT32_MAX) ? UINT32_MAX : static_cast<uint32_t>(acc.nan_count);
+    summary.elements = acc.valid_count + acc.nan_count;
+    return summary;
+}
+
+// =============================================================================
+// Content-hash dedup (PTO2_DUMP_DEDUP)
+// =============================================================================
+
+constexpr uint64_t DUMP_FNV1A_SEED = 0xCBF29CE484222325ULL;
+constexpr uint64_t DUMP_FNV1A_PRIME = 0x100000001B3ULL;
+
+static inline uint64_t dump_fnv1a64(const void *data, uint64_t len, uint64_t hash) {
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    for (uint64_t i = 0; i < len; i++) {
+        hash = (hash ^ p[i]) * DUMP_FNV1A_PRIME;
+    }
+    return hash;
+}
+
+static void hash_tensor_dump_dim(
+    const TensorDumpInfo &info, uint64_t elem_sz, uint32_t dim, uint64_t base_element_index, uint64_t *hash
+) {
+    if (dim >= PLATFORM_DUMP_MAX_DIMS) {
+        return;
+    }
+    if (dim + 1 >= info.ndims) {
+        uint64_t row_start = base_element_index + info.offsets[dim];
+        const char *src = reinterpret_cast<const char *>(info.buffer_addr) + row_start * elem_sz;
+        *hash = dump_fnv1a64(src, static_cast<uint64_t>(info.shapes[dim]) * elem_sz, *hash);
+        return;
+    }
+    uint64_t inner_stride = 1;
+    for (uint32_t d = dim + 1; d < info.ndims && d < PLATFORM_DUMP_MAX_DIMS; d++) {
+        inner_stride *= info.raw_shapes[d];
+    }
+    for (uint32_t i = 0; i < info.shapes[dim]; i++) {
+        uint64_t next_base = base_element_index + (static_cast<uint64_t>(info.offsets[dim]) + i) * inner_stride;
+        hash_tensor_dump_dim(info, elem_sz, dim + 1, next_base, hash);
+    }
+}
+
+// Chain-hash the logical view's source bytes (same traversal order as the
+// arena copy, pre-downcast)
+static uint64_t hash_tensor_dump_view(const TensorDumpInfo &info, uint64_t elem_sz, uint64_t hash) {
+    const char *base = reinterpret_cast<const char *>(info.buffer_addr);
+    if (info.ndims == 0) {
+        return dump_fnv1a64(base, elem_sz, hash);
+    }
+    if (tensor_dump_is_contiguous(info)) {
+        uint64_t start_offset = tensor_dump_start_offset_elements(info);
+        return dump_fnv1a64(base + start_offset * elem_sz, get_tensor_dump_num_elements(info) * elem_sz, hash);
+    }
+    hash_tensor_dump_dim(info, elem_sz, 0, 0, &hash);
+    return hash;
+}
+
+/**
+ * Check whether this dump point's payload hash matches its previous dump,
+ * updating the cached hash either way. Returns false (dump in full) when
+ * the per-thread cache has no room for a new dump point.
+ */
+static bool dump_dedup_check_and_update(int thread_idx, uint32_t func_id, uint32_t arg_index, uint64_t hash) {
+    DumpDedupEntry *cache = s_dedup_cache[thread_idx];
+    for (int i = 0; i < PLATFORM_DUMP_DEDUP_CACHE_ENTRIES; i++) {
+        if (cache[i].valid && cache[i].func_id == func_id && cache[i].arg_index == arg_index) {
+            if (cache[i].hash == hash) {
+                return true;
+            }
+            cache[i].hash = hash;
+            return false;
+        }
+    }
+    for (int i = 0; i < PLATFORM_DUMP_DEDUP_CACHE_ENTRIES; i++) {
+        if (!cache[i].valid) {
+            cache[i].func_id = func_id;
+            cache[i].arg_index = arg_index;
+            cache[i].hash = hash;
+            cache[i].valid = true;
+            return false;
+        }
+    }
+    return false;
+}
+
 void dump_tensor_init(int num_dump_threads) {
     void *dump_base = reinterpret_cast<void *>(get_platform_dump_base());
     if (dump_base == nullptr) {
@@ -338,10 +815,39 @@ void dump_tensor_init(int num_dump_threads) {
 
     LOG_INFO("Initializing tensor dump for %d threads", num_dump_threads);
 
+    int filter_count = dump_tensor_configure_filters(getenv("PTO2_DUMP_FILTER"));
+    if (filter_count > 0) {
+        LOG_INFO("Installed %d tensor dump filter(s) from PTO2_DUMP_FILTER", filter_count);
+    }
+
+    const char *dedup_env = getenv("PTO2_DUMP_DEDUP");
+    s_dump_dedup_enabled = (dedup_env != nullptr && dedup_env[0] == '1' && dedup_env[1] == '\0');
+    memset(s_dedup_cache, 0, sizeof(s_dedup_cache));
+    if (s_dump_dedup_enabled) {
+        LOG_INFO("Tensor dump content-hash dedup enabled via PTO2_DUMP_DEDUP");
+    }
+
+    s_dump_max_inflight = PLATFORM_DUMP_READYQUEUE_SIZE - 1;
+    const char *inflight_env = getenv("PTO2_DUMP_MAX_INFLIGHT");
+    if (inflight_env != nullptr && inflight_env[0] != '\0') {
+        char *end = nullptr;
+        unsigned long parsed = strtoul(inflight_env, &end, 10);
+        if (end == inflight_env || *end != '\0' || parsed < 1 || parsed > PLATFORM_DUMP_READYQUEUE_SIZE - 1) {
+            LOG_WARN(
+                "Ignoring PTO2_DUMP_MAX_INFLIGHT='%s' (valid range 1..%d)", inflight_env,
+                PLATFORM_DUMP_READYQUEUE_SIZE - 1
+            );
+        } else {
+            s_dump_max_inflight = static_cast<uint32_t>(parsed);
+            LOG_INFO("Tensor dump in-flight cap set to %u buffers via PTO2_DUMP_MAX_INFLIGHT", s_dump_max_inflight);
+        }
+    }
+
     // Pop initial metadata buffer from free_queue for each thread
     for (int t = 0; t < num_dump_threads; t++) {
         DumpBufferState *state = get_dump_buffer_state(dump_base, t);
         s_dump_states[t] = state;
+        s_drop_stats[t] = get_dump_drop_stats(dump_base, num_dump_threads, t);
 
         rmb();
         uint32_t head = state->free_queue.head;
@@ -368,7 +874,10 @@ void dump_tensor_init(int num_dump_threads) {
 
     memset(s_logged_ready_queue_full, 0, sizeof(s_logged_ready_queue_full));
     memset(s_logged_no_free_meta_buffer, 0, sizeof(s_logged_no_free_meta_buffer));
+    s_logged_summary_dtype_unsupported = false;
+    s_logged_trigger_dtype_unsupported = false;
     memset(s_records_written, 0, sizeof(s_records_written));
+    memset(s_records_trigger_skipped, 0, sizeof(s_records_trigger_skipped));
     memset(s_buffers_switched, 0, sizeof(s_buffers_switched));
     memset(s_buffers_flushed, 0, sizeof(s_buffers_flushed));
 }
@@ -384,43 +893,190 @@ int dump_tensor_record(int thread_idx, const TensorDumpInfo &info) {
     DumpBufferState *state = s_dump_states[thread_idx];
     DumpMetaBuffer *buf = s_current_dump_buf[thread_idx];
     if (buf == nullptr) {
+        account_dropped_records(state, 1);
+        account_dropped_point(thread_idx, info.func_id, info.arg_index, 1);
         return -1;
     }
 
     // Switch metadata buffer if full
     if (buf->count >= PLATFORM_DUMP_RECORDS_PER_BUFFER) {
         if (switch_dump_meta_buffer(thread_idx) != 0) {
-            return -1;  // No free buffer
+            account_dropped_records(state, 1);
+            account_dropped_point(thread_idx, info.func_id, info.arg_index, 1);
+            return -1;
         }
         buf = s_current_dump_buf[thread_idx];
         if (buf == nullptr) {
+            account_dropped_records(state, 1);
+            account_dropped_point(thread_idx, info.func_id, info.arg_index, 1);
             return -1;
         }
     }
 
-    // Reserve space in arena
-    // Compute actual tensor data size from shape (not buffer.size which may include padding)
-    uint64_t actual_elements = get_tensor_dump_num_elements(info);
-    uint64_t elem_sz = get_element_size(static_cast<DataType>(info.dtype));
-    uint64_t bytes = actual_elements * elem_sz;
-    uint64_t copy_bytes = bytes;
-    bool truncated = false;
-    bool is_contiguous = tensor_dump_is_contiguous(info);
+    // Resolve the dump filter for this dump point and build the view to copy
+    const TensorDumpFilterSpec *filter = dump_tensor_match_filter(info.func_id, info.arg_index);
+    TensorDumpFilterMode mode = (filter != nullptr) ? filter->mode : TensorDumpFilterMode::FULL;
+    DataType dtype = static_cast<DataType>(info.dtype);
+    uint64_t elem_sz = get_element_size(dtype);
+
+    if (mode == TensorDumpFilterMode::SUMMARY && dtype != DataType::FLOAT32 && dtype != DataType::FLOAT16) {
+        if (!s_logged_summary_dtype_unsupported) {
+            s_logged_summary_dtype_unsupported = true;
+            LOG_WARN(
+                "Summary dump only supports FLOAT32/FLOAT16, dumping dtype %u in full", static_cast<uint32_t>(dtype)
+            );
+        }
+        mode = TensorDumpFilterMode::FULL;
+    }
+    bool downcast =
+        (filter != nullptr && filter->downcast_fp16 && dtype == DataType::FLOAT32 &&
+         mode != TensorDumpFilterMode::SUMMARY);
 
-    if (bytes > state->arena_size) {
-        // Tensor larger than entire arena — copy a partial sample
-        copy_bytes = state->arena_size / 2;
+    TensorDumpInfo view = info;
+    uint32_t row_stride = 0;
+    if (mode == TensorDumpFilterMode::BOUNDING_BOX) {
+        for (uint32_t d = 0; d < view.ndims && d < PLATFORM_DUMP_MAX_DIMS; d++) {
+            uint32_t begin = (filter->box_begin[d] < view.shapes[d]) ? filter->box_begin[d] : view.shapes[d];
+            uint32_t end = (filter->box_end[d] == 0 || filter->box_end[d] > view.shapes[d]) ? view.shapes[d]
+                                                                                            : filter->box_end[d];
+            if (end < begin) {
+                end = begin;
+            }
+            view.offsets[d] += begin;
+            view.shapes[d] = end - begin;
+        }
+    } else if (mode == TensorDumpFilterMode::ROW_STRIDE) {
+        if (info.ndims == 0 || filter->row_stride <= 1) {
+            mode = TensorDumpFilterMode::FULL;
+        } else {
+            row_stride = filter->row_stride;
+        }
+    }
+
+    // Evaluate the watchpoint trigger before touching the arena. NaN/absmax
+    // share the summary traversal, so a SUMMARY-mode dump point reuses the
+    // stats it would compute anyway; an untriggered iteration does the single
+    // read pass and records nothing.
+    TensorDumpTrigger trigger = (filter != nullptr) ? filter->trigger : TensorDumpTrigger::ALWAYS;
+    TensorDumpSummary summary = {};
+    bool have_summary = false;
+    if (trigger == TensorDumpTrigger::USER_FLAG) {
+        if (s_dump_header->user_trigger_flag == 0) {
+            s_records_trigger_skipped[thread_idx]++;
+            return 0;
+        }
+    } else if (trigger == TensorDumpTrigger::NAN_INF || trigger == TensorDumpTrigger::ABS_MAX) {
+        if (dtype != DataType::FLOAT32 && dtype != DataType::FLOAT16) {
+            // Fail open: a silent dump point would hide exactly the data the
+            // watchpoint was installed for
+            if (!s_logged_trigger_dtype_unsupported) {
+                s_logged_trigger_dtype_unsupported = true;
+                LOG_WARN(
+                    "Dump trigger only supports FLOAT32/FLOAT16, dumping dtype %u unconditionally",
+                    static_cast<uint32_t>(dtype)
+                );
+            }
+        } else {
+            summary = compute_tensor_dump_summary(view, elem_sz);
+            have_summary = true;
+            bool fires;
+            if (trigger == TensorDumpTrigger::NAN_INF) {
+                fires = summary.nan_count > 0 || summary.max_val > FLT_MAX || summary.min_val < -FLT_MAX;
+            } else {
+                float abs_max = (summary.max_val > -summary.min_val) ? summary.max_val : -summary.min_val;
+                fires = abs_max > filter->trigger_bound;
+            }
+            if (!fires) {
+                s_records_trigger_skipped[thread_idx]++;
+                return 0;
+            }
+        }
+    }
+
+    uint64_t kept_rows = 0;
+    uint64_t src_bytes = 0;
+    uint64_t payload_bytes = 0;
+    if (mode == TensorDumpFilterMode::SUMMARY) {
+        payload_bytes = sizeof(TensorDumpSummary);
+    } else if (mode == TensorDumpFilterMode::ROW_STRIDE) {
+        kept_rows = (view.shapes[0] + row_stride - 1) / row_stride;
+        uint64_t inner_elements = 1;
+        for (uint32_t d = 1; d < view.ndims && d < PLATFORM_DUMP_MAX_DIMS; d++) {
+            inner_elements *= view.shapes[d];
+        }
+        src_bytes = kept_rows * inner_elements * elem_sz;
+        payload_bytes = downcast ? src_bytes / 2 : src_bytes;
+    } else {
+        src_bytes = get_tensor_dump_num_elements(view) * elem_sz;
+        payload_bytes = downcast ? src_bytes / 2 : src_bytes;
+    }
+
+    bool truncated = false;
+    bool is_contiguous = (mode == TensorDumpFilterMode::ROW_STRIDE) ? false : tensor_dump_is_contiguous(view);
+    if (payload_bytes > state->arena_size) {
+        // Payload larger than entire arena — copy a partial sample
+        payload_bytes = state->arena_size / 2;
+        src_bytes = downcast ? payload_bytes * 2 : payload_bytes;
         truncated = true;
     }
 
+    // Hash the view's source bytes; a repeat hash at the same dump point
+    // means the payload was already shipped (e.g. unchanged weights), so
+    // only the record goes out. Truncated payloads are never deduplicated
+    // (the hash covers bytes the arena copy would omit).
+    uint64_t content_hash = 0;
+    bool dedup_skip = false;
+    if (s_dump_dedup_enabled && mode != TensorDumpFilterMode::SUMMARY && !truncated) {
+        uint64_t h = DUMP_FNV1A_SEED;
+        if (mode == TensorDumpFilterMode::ROW_STRIDE) {
+            TensorDumpInfo hash_row = view;
+            hash_row.shapes[0] = 1;
+            for (uint64_t r = 0; r < kept_rows; r++) {
+                hash_row.offsets[0] = view.offsets[0] + static_cast<uint32_t>(r * row_stride);
+                h = hash_tensor_dump_view(hash_row, elem_sz, h);
+            }
+        } else {
+            h = hash_tensor_dump_view(view, elem_sz, h);
+        }
+        content_hash = (h == 0) ? 1 : h;  // 0 is the "not hashed" sentinel
+        dedup_skip = dump_dedup_check_and_update(thread_idx, info.func_id, info.arg_index, content_hash);
+        if (dedup_skip) {
+            payload_bytes = 0;
+        }
+    }
+
     uint64_t offset = state->arena_write_offset;
-    state->arena_write_offset = offset + copy_bytes;
+    state->arena_write_offset = offset + payload_bytes;
 
     // Copy tensor data into arena (circular wraparound)
     char *arena = reinterpret_cast<char *>(state->arena_base);
     uint64_t arena_sz = state->arena_size;
-    CircularArenaWriter writer = {arena, arena_sz, offset, 0};
-    write_tensor_dump_logical_prefix(&writer, info, elem_sz, copy_bytes);
+    CircularArenaWriter writer = {arena, arena_sz, offset, 0, downcast};
+    if (dedup_skip) {
+        // Payload already shipped — record only
+    } else if (mode == TensorDumpFilterMode::SUMMARY) {
+        if (!have_summary) {
+            summary = compute_tensor_dump_summary(view, elem_sz);
+        }
+        writer.write_raw(&summary, sizeof(summary));
+    } else if (mode == TensorDumpFilterMode::ROW_STRIDE) {
+        TensorDumpInfo row = view;
+        row.shapes[0] = 1;
+        uint64_t inner_elements = 1;
+        for (uint32_t d = 1; d < view.ndims && d < PLATFORM_DUMP_MAX_DIMS; d++) {
+            inner_elements *= view.shapes[d];
+        }
+        uint64_t row_src_bytes = inner_elements * elem_sz;
+        uint64_t remaining_src = src_bytes;
+        for (uint64_t r = 0; r < kept_rows && remaining_src > 0; r++) {
+            row.offsets[0] = view.offsets[0] + static_cast<uint32_t>(r * row_stride);
+            uint64_t n = (row_src_bytes < remaining_src) ? row_src_bytes : remaining_src;
+            write_tensor_dump_logical_prefix(&writer, row, elem_sz, n);
+            remaining_src -= n;
+        }
+    } else {
+        write_tensor_dump_logical_prefix(&writer, view, elem_sz, src_bytes);
+    }
     wmb();
 
     // Append metadata record
@@ -437,11 +1093,19 @@ int dump_tensor_record(int thread_idx, const TensorDumpInfo &info) {
     rec->dtype = info.dtype;
     rec->truncated = truncated ? 1 : 0;
     rec->payload_offset = offset;
-    rec->payload_size = copy_bytes;
+    rec->payload_size = payload_bytes;
+    rec->filter_mode = static_cast<uint8_t>(mode);
+    rec->payload_dtype = downcast ? static_cast<uint8_t>(DataType::FLOAT16) : info.dtype;
+    rec->row_stride = row_stride;
+    rec->content_hash = content_hash;
+    rec->dedup_ref = dedup_skip ? 1 : 0;
     for (int d = 0; d < info.ndims && d < PLATFORM_DUMP_MAX_DIMS; d++) {
         rec->raw_shapes[d] = info.raw_shapes[d];
-        rec->shapes[d] = info.shapes[d];
-        rec->offsets[d] = info.offsets[d];
+        rec->shapes[d] = view.shapes[d];
+        rec->offsets[d] = view.offsets[d];
+    }
+    if (mode == TensorDumpFilterMode::ROW_STRIDE) {
+        rec->shapes[0] = static_cast<uint32_t>(kept_rows);
     }
     buf->count = idx + 1;
     wmb();
@@ -464,7 +1128,7 @@ void dump_tensor_flush(int thread_idx) {
         uint64_t buf_addr = reinterpret_cast<uint64_t>(buf);
         uint32_t seq = s_dump_states[thread_idx]->current_buf_seq;
         if (enqueue_dump_ready_buffer(thread_idx, buf_addr, seq) != 0) {
-            account_dropped_records(s_dump_states[thread_idx], buf->count);
+            account_dropped_buffer(thread_idx, s_dump_states[thread_idx], buf);
             buf->count = 0;
             wmb();
             if (!s_logged_ready_queue_full[thread_idx]) {
@@ -483,7 +1147,10 @@ void dump_tensor_flush(int thread_idx) {
     s_buffers_flushed[thread_idx]++;
     uint32_t dropped = s_dump_states[thread_idx] ? s_dump_states[thread_idx]->dropped_record_count : 0;
     LOG_INFO(
-        "Thread %d: dump_tensor_flush (records=%u, buf_switches=%u, flushes=%u, dropped=%u)", thread_idx,
-        s_records_written[thread_idx], s_buffers_switched[thread_idx], s_buffers_flushed[thread_idx], dropped
+        "Thread %d: dump_tensor_flush (records=%u, buf_switches=%u, flushes=%u, dropped=%u, trigger_skipped=%u)",
+        thread_idx, s_records_written[thread_idx], s_buffers_switched[thread_idx], s_buffers_flushed[thread_idx],
+        dropped, s_records_trigger_skipped[thread_idx]
     );
 }
+
+#endif  // PTO_INSTRUMENTATION
@@ -11,12 +11,155 @@
 /**
  * @file unified_log_device.cpp
  * @brief Unified logging - Device implementation
+ *
+ * Two modes:
+ * - Eager (default): vsnprintf at the call site, emitted via dev_log_*.
+ * - Binary (SIMPLER_LOG_BINARY=1): the call site captures a
+ *   (format-pointer, args) tuple into the calling thread's ring; text is
+ *   rendered later by unified_log_flush_binary() at collection time. Calls
+ *   whose formats the binary codec cannot represent fall back to eager
+ *   formatting, so no records are silently malformed.
  */
 
 #include "common/unified_log.h"
+#include "common/binary_log.h"
 #include "aicpu/device_log.h"
+#include "aicpu/device_time.h"
 
+#include <atomic>
 #include <cstdarg>
+#include <cstdlib>
+
+namespace {
+
+// Per-thread capture rings, registered on each thread's first log call so
+// the flush can walk every ring. Rings are never freed: threads may log
+// until process exit and the flush may run from another thread.
+BinaryLogRing *g_binlog_rings[BINLOG_MAX_RINGS] = {};
+std::atomic<int> g_binlog_ring_count{0};
+
+// Host-visible ring region (set_platform_binlog_base). When set, threads
+// claim rings here instead of the heap and the HOST is the consumer: it
+// tails the rings in place, so unified_log_flush_binary must not touch
+// them (it only drains the heap rings above).
+std::atomic<BinaryLogShm *> g_binlog_shm{nullptr};
+
+bool binlog_enabled() {
+    static const bool enabled = [] {
+        const char *env = getenv("SIMPLER_LOG_BINARY");
+        return env != nullptr && atoi(env) != 0;
+    }();
+    return enabled;
+}
+
+BinaryLogRing *binlog_thread_ring() {
+    thread_local BinaryLogRing *ring = [] () -> BinaryLogRing * {
+        BinaryLogShm *shm = g_binlog_shm.load(std::memory_order_acquire);
+        if (shm != nullptr) {
+            uint32_t slot = __atomic_fetch_add(&shm->ring_count, 1u, __ATOMIC_ACQ_REL);
+            if (slot < static_cast<uint32_t>(BINLOG_MAX_RINGS)) {
+                return &shm->rings[slot];
+            }
+            return nullptr;  // over-subscribed: this thread logs eagerly
+        }
+        int idx = g_binlog_ring_count.fetch_add(1, std::memory_order_relaxed);
+        if (idx >= BINLOG_MAX_RINGS) {
+            return nullptr;  // over-subscribed: this thread logs eagerly
+        }
+        BinaryLogRing *r = new BinaryLogRing();
+        g_binlog_rings[idx] = r;
+        return r;
+    }();
+    return ring;
+}
+
+/**
+ * Capture one log call into the calling thread's ring.
+ *
+ * @return true if the call is fully handled (captured, or dropped on a full
+ *         ring); false if the caller must format eagerly.
+ */
+bool binlog_try_capture(BinaryLogLevel level, const char *func, const char *fmt, va_list ap) {
+    BinaryLogRing *ring = binlog_thread_ring();
+    if (ring == nullptr) {
+        return false;
+    }
+    uint32_t tail = ring->tail;
+    // head may be advanced by a host tailer; load it explicitly
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    if (tail - head >= BINLOG_RING_CAPACITY) {
+        // Full ring: drop and count rather than paying for eager formatting
+        // (back-pressure from logging is exactly what binary mode avoids).
+        ring->dropped++;
+        return true;
+    }
+    BinaryLogRecord *slot = &ring->records[tail & (BINLOG_RING_CAPACITY - 1)];
+    if (!binlog_capture(slot, level, get_sys_cnt_aicpu(), func, fmt, ap)) {
+        return false;
+    }
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+void binlog_emit(const BinaryLogRecord *rec, const char *text) {
+    switch (rec->level) {
+    case BinaryLogLevel::ERROR:
+        dev_log_error(rec->func, "%s", text);
+        break;
+    case BinaryLogLevel::WARN:
+        dev_log_warn(rec->func, "%s", text);
+        break;
+    case BinaryLogLevel::INFO:
+        dev_log_info(rec->func, "%s", text);
+        break;
+    case BinaryLogLevel::DEBUG:
+        dev_log_debug(rec->func, "%s", text);
+        break;
+    case BinaryLogLevel::ALWAYS:
+        dev_log_always(rec->func, "%s", text);
+        break;
+    }
+}
+
+}  // namespace
+
+/**
+ * Place the binary log capture rings in host-visible shared memory.
+ *
+ * The host allocates and zeroes a BinaryLogShm region, passes its device
+ * address here before launching AICPU threads, and tails the rings in
+ * place (see host/binlog_tailer.h). Zero restores heap rings drained by
+ * unified_log_flush_binary(). Must not change while producer threads are
+ * running: rings are claimed once per thread.
+ */
+extern "C" void set_platform_binlog_base(uint64_t binlog_base) {
+    g_binlog_shm.store(reinterpret_cast<BinaryLogShm *>(binlog_base), std::memory_order_release);
+}
+
+void unified_log_flush_binary(void) {
+    int ring_count = g_binlog_ring_count.load(std::memory_order_relaxed);
+    if (ring_count > BINLOG_MAX_RINGS) {
+        ring_count = BINLOG_MAX_RINGS;
+    }
+    for (int i = 0; i < ring_count; i++) {
+        BinaryLogRing *ring = g_binlog_rings[i];
+        if (ring == nullptr) {
+            continue;
+        }
+        uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+        char text[2048];
+        while (ring->head != tail) {
+            const BinaryLogRecord *rec = &ring->records[ring->head & (BINLOG_RING_CAPACITY - 1)];
+            binlog_render(text, sizeof(text), rec);
+            binlog_emit(rec, text);
+            ring->head++;
+        }
+        if (ring->dropped > 0) {
+            dev_log_warn(__FUNCTION__, "binary log ring %d dropped %lu records", i, (unsigned long)ring->dropped);
+            ring->dropped = 0;
+        }
+    }
+}
 
 void unified_log_error(const char *func, const char *fmt, ...) {
     if (!is_log_enable_error()) {
@@ -24,6 +167,12 @@ void unified_log_error(const char *func, const char *fmt, ...) {
     }
     va_list args;
     va_start(args, fmt);
+    if (binlog_enabled() && binlog_try_capture(BinaryLogLevel::ERROR, func, fmt, args)) {
+        va_end(args);
+        return;
+    }
+    va_end(args);
+    va_start(args, fmt);
     char buffer[2048];
     vsnprintf(buffer, sizeof(buffer), fmt, args);
     va_end(args);
@@ -37,6 +186,12 @@ void unified_log_warn(const char *func, const char *fmt, ...) {
 
     va_list args;
     va_start(args, fmt);
+    if (binlog_enabled() && binlog_try_capture(BinaryLogLevel::WARN, func, fmt, args)) {
+        va_end(args);
+        return;
+    }
+    va_end(args);
+    va_start(args, fmt);
 
     char buffer[2048];
     vsnprintf(buffer, sizeof(buffer), fmt, args);
@@ -52,6 +207,12 @@ void unified_log_info(const char *func, const char *fmt, ...) {
 
     va_list args;
     va_start(args, fmt);
+    if (binlog_enabled() && binlog_try_capture(BinaryLogLevel::INFO, func, fmt, args)) {
+        va_end(args);
+        return;
+    }
+    va_end(args);
+    va_start(args, fmt);
 
     char buffer[2048];
     vsnprintf(buffer, sizeof(buffer), fmt, args);
@@ -67,6 +228,12 @@ void unified_log_debug(const char *func, const char *fmt, ...) {
 
     va_list args;
     va_start(args, fmt);
+    if (binlog_enabled() && binlog_try_capture(BinaryLogLevel::DEBUG, func, fmt, args)) {
+        va_end(args);
+        return;
+    }
+    va_end(args);
+    va_start(args, fmt);
 
     char buffer[2048];
     vsnprintf(buffer, sizeof(buffer), fmt, args);
@@ -78,6 +245,12 @@ void unified_log_debug(const char *func, const char *fmt, ...) {
 void unified_log_always(const char *func, const char *fmt, ...) {
     va_list args;
     va_start(args, fmt);
+    if (binlog_enabled() && binlog_try_capture(BinaryLogLevel::ALWAYS, func, fmt, args)) {
+        va_end(args);
+        return;
+    }
+    va_end(args);
+    va_start(args, fmt);
     char buffer[2048];
     vsnprintf(buffer, sizeof(buffer), fmt, args);
     va_end(args);
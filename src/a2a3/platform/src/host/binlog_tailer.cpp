@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * @file binlog_tailer.cpp
+ * @brief Zero-copy host tailing of device binary log rings
+ */
+
+#include "host/binlog_tailer.h"
+#include "host_log.h"
+
+#include <cstring>
+
+namespace {
+
+HostLogLevel binlog_to_host_level(BinaryLogLevel level) {
+    switch (level) {
+    case BinaryLogLevel::ERROR:
+        return HostLogLevel::ERROR;
+    case BinaryLogLevel::WARN:
+        return HostLogLevel::WARN;
+    case BinaryLogLevel::INFO:
+        return HostLogLevel::INFO;
+    case BinaryLogLevel::DEBUG:
+        return HostLogLevel::DEBUG;
+    case BinaryLogLevel::ALWAYS:
+        return HostLogLevel::ALWAYS;
+    }
+    return HostLogLevel::INFO;
+}
+
+}  // namespace
+
+void BinlogTailer::attach(void *shm_host_base) {
+    memset(shm_host_base, 0, sizeof(BinaryLogShm));
+    shm_ = reinterpret_cast<BinaryLogShm *>(shm_host_base);
+    records_emitted_ = 0;
+    memset(dropped_reported_, 0, sizeof(dropped_reported_));
+}
+
+bool BinlogTailer::poll() {
+    if (shm_ == nullptr) {
+        return false;
+    }
+    bool emitted = false;
+    uint32_t ring_count = __atomic_load_n(&shm_->ring_count, __ATOMIC_ACQUIRE);
+    if (ring_count > static_cast<uint32_t>(BINLOG_MAX_RINGS)) {
+        ring_count = BINLOG_MAX_RINGS;
+    }
+    char text[2048];
+    for (uint32_t i = 0; i < ring_count; i++) {
+        BinaryLogRing *ring = &shm_->rings[i];
+        uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+        uint32_t head = ring->head;  // tailer is the only head writer
+        while (head != tail) {
+            const BinaryLogRecord *rec = &ring->records[head & (BINLOG_RING_CAPACITY - 1)];
+            binlog_render(text, sizeof(text), rec);
+            HostLogger::get_instance().log(binlog_to_host_level(rec->level), "[device] %s: %s", rec->func, text);
+            head++;
+            // Publish only after the record is fully read: the producer may
+            // reuse the slot as soon as head moves past it.
+            __atomic_store_n(&ring->head, head, __ATOMIC_RELEASE);
+            records_emitted_++;
+            emitted = true;
+        }
+    }
+    return emitted;
+}
+
+void BinlogTailer::drain() {
+    if (shm_ == nullptr) {
+        return;
+    }
+    poll();
+    uint32_t ring_count = __atomic_load_n(&shm_->ring_count, __ATOMIC_ACQUIRE);
+    if (ring_count > static_cast<uint32_t>(BINLOG_MAX_RINGS)) {
+        ring_count = BINLOG_MAX_RINGS;
+    }
+    for (uint32_t i = 0; i < ring_count; i++) {
+        uint64_t dropped = shm_->rings[i].dropped;
+        if (dropped > dropped_reported_[i]) {
+            HostLogger::get_instance().log(
+                HostLogLevel::WARN, "device binary log ring %u dropped %lu records (host tailer fell behind)", i,
+                static_cast<unsigned long>(dropped - dropped_reported_[i])
+            );
+            dropped_reported_[i] = dropped;
+        }
+    }
+    // Producers are gone; release the slots for the next run's threads.
+    __atomic_store_n(&shm_->ring_count, 0u, __ATOMIC_RELEASE);
+}
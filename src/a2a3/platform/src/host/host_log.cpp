@@ -11,14 +11,34 @@
 /**
  * @file host_log.cpp
  * @brief Implementation of Unified Host Logging System
+ *
+ * Producers claim staging slots with a bounded-queue CAS ticket (Vyukov
+ * scheme) and publish via the slot sequence number; the single drain thread
+ * consumes in ticket order. The mutex only guards sink configuration — the
+ * log() hot path never takes it.
  */
 
 #include "host_log.h"
 
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
 
+namespace {
+
+// How long a producer waits for the drain thread to free a slot before the
+// record is dropped. The ring only stays full when the sink is much slower
+// than the producers, and blocking them would put logging right back on the
+// critical path.
+constexpr int FULL_RETRY_COUNT = 200;
+constexpr auto FULL_RETRY_PAUSE = std::chrono::microseconds(10);
+
+// Drain thread poll interval when the ring is empty
+constexpr auto DRAIN_IDLE_PAUSE = std::chrono::microseconds(100);
+
+}  // namespace
+
 // =============================================================================
 // HostLogger Implementation
 // =============================================================================
@@ -33,10 +53,23 @@ HostLogger::HostLogger() :
     log_file_path_(""),
     log_file_handle_(nullptr),
     initialized_(false) {
+    for (uint32_t i = 0; i < RING_CAPACITY; i++) {
+        ring_[i].seq.store(i, std::memory_order_relaxed);
+    }
     init_from_env();
+    drain_thread_ = std::thread([this] { drain_loop(); });
 }
 
 HostLogger::~HostLogger() {
+    stop_.store(true, std::memory_order_release);
+    if (drain_thread_.joinable()) {
+        drain_thread_.join();
+    }
+    // Producers are gone by singleton destruction; write out what's left
+    while (drain_one()) {
+    }
+    report_drops();
+
     std::lock_guard<std::mutex> lock(mutex_);
     if (log_file_handle_ != nullptr && log_file_handle_ != stdout && log_file_handle_ != stderr) {
         fclose(log_file_handle_);
@@ -99,6 +132,8 @@ void HostLogger::init_from_env() {
 }
 
 void HostLogger::reinitialize() {
+    // Drain first so pending records go to the sink they were logged against
+    flush();
     initialized_ = false;
     init_from_env();
 }
@@ -144,28 +179,133 @@ void HostLogger::log(HostLogLevel level, const char *format, ...) {
         return;
     }
 
-    std::lock_guard<std::mutex> lock(mutex_);
+    // Format at the call site: %s arguments may point at temporaries, so
+    // deferring the vsnprintf to the drain thread would read freed memory.
+    char text[RECORD_TEXT_MAX];
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (written < 0) {
+        return;
+    }
+    uint32_t len = written < static_cast<int>(sizeof(text)) ? static_cast<uint32_t>(written) : sizeof(text) - 1;
+    // The drain thread owns the newline policy
+    while (len > 0 && text[len - 1] == '\n') {
+        len--;
+    }
+
+    if (stop_.load(std::memory_order_acquire)) {
+        // Shutdown path (drain thread gone): write synchronously
+        std::lock_guard<std::mutex> lock(mutex_);
+        emit(level, text, len);
+        return;
+    }
+    enqueue(level, text, len);
+}
+
+void HostLogger::enqueue(HostLogLevel level, const char *text, uint32_t len) {
+    int retries = 0;
+    uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+    Record *rec;
+    for (;;) {
+        rec = &ring_[pos & (RING_CAPACITY - 1)];
+        uint64_t seq = rec->seq.load(std::memory_order_acquire);
+        int64_t dif = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+        if (dif == 0) {
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (dif < 0) {
+            // Ring full: give the drain thread a grace period, then drop
+            if (++retries > FULL_RETRY_COUNT) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            std::this_thread::sleep_for(FULL_RETRY_PAUSE);
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        } else {
+            // Another producer took this ticket; reload and retry
+            pos = enqueue_pos_.load(std::memory_order_relaxed);
+        }
+    }
+
+    rec->level = level;
+    rec->len = static_cast<uint16_t>(len);
+    memcpy(rec->text, text, len);
+    rec->seq.store(pos + 1, std::memory_order_release);
+}
 
-    // Get output file
+bool HostLogger::drain_one() {
+    Record *rec = &ring_[dequeue_pos_ & (RING_CAPACITY - 1)];
+    uint64_t seq = rec->seq.load(std::memory_order_acquire);
+    if (seq != dequeue_pos_ + 1) {
+        return false;  // Next slot not published yet (or ring empty)
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        emit(rec->level, rec->text, rec->len);
+    }
+
+    // Hand the slot back to producers, one lap ahead
+    rec->seq.store(dequeue_pos_ + RING_CAPACITY, std::memory_order_release);
+    dequeue_pos_++;
+    return true;
+}
+
+void HostLogger::emit(HostLogLevel level, const char *text, uint32_t len) {
     FILE *output = get_output_file(level);
     if (output == nullptr) {
         return;
     }
 
-    // Print log level prefix (matching Python format)
+    // Level prefix + message + newline (matching Python format)
     fprintf(output, "[%s] ", get_level_name(level));
+    fwrite(text, 1, len, output);
+    fputc('\n', output);
 
-    // Print formatted message
-    va_list args;
-    va_start(args, format);
-    vfprintf(output, format, args);
-    va_end(args);
+    // Flush to ensure immediate output
+    fflush(output);
+}
 
-    // Add newline if not already present
-    if (format[strlen(format) - 1] != '\n') {
-        fprintf(output, "\n");
+void HostLogger::report_drops() {
+    uint64_t dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped > dropped_reported_) {
+        char msg[96];
+        int len = snprintf(msg, sizeof(msg), "host log ring overflow: %llu record(s) dropped",
+                           static_cast<unsigned long long>(dropped - dropped_reported_));
+        std::lock_guard<std::mutex> lock(mutex_);
+        emit(HostLogLevel::WARN, msg, static_cast<uint32_t>(len));
+        dropped_reported_ = dropped;
     }
+}
 
-    // Flush to ensure immediate output
-    fflush(output);
+void HostLogger::drain_loop() {
+    while (!stop_.load(std::memory_order_acquire)) {
+        if (!drain_one()) {
+            // Idle: surface any ring-overflow drops on the output stream
+            report_drops();
+            std::this_thread::sleep_for(DRAIN_IDLE_PAUSE);
+        }
+    }
+}
+
+void HostLogger::flush() {
+    uint64_t target = enqueue_pos_.load(std::memory_order_acquire);
+    if (target == 0) {
+        return;
+    }
+    if (stop_.load(std::memory_order_acquire)) {
+        while (drain_one()) {
+        }
+        return;
+    }
+    // dequeue_pos_ belongs to the drain thread; observe its progress through
+    // the last claimed slot's sequence, which jumps one lap ahead once the
+    // record has been written out.
+    Record *rec = &ring_[(target - 1) & (RING_CAPACITY - 1)];
+    while (rec->seq.load(std::memory_order_acquire) < target + RING_CAPACITY - 1) {
+        std::this_thread::sleep_for(DRAIN_IDLE_PAUSE);
+    }
 }
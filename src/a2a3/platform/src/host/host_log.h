@@ -15,6 +15,15 @@
  * Provides thread-safe logging interface for Host-side C++ code.
  * Integrates with Python logging system via environment variables.
  *
+ * Producers never take a lock and never touch the output stream: log()
+ * formats the message into a slot of a lock-free MPSC staging ring and a
+ * dedicated drain thread does the level prefixing, newline policy and all
+ * I/O (including the per-line flush). Slot claims are ticket-ordered, so
+ * each producer's messages appear in the order it logged them. If the ring
+ * stays full past a short grace period the record is dropped and counted;
+ * the drop total is reported on the output stream, so back-pressure from a
+ * slow sink shows up in the log instead of in producer profiles.
+ *
  * Environment Variables:
  * - PTO_LOG_LEVEL: error/warn/info/debug (default: info)
  * - PTO_LOG_FILE: Optional log file path (default: stdout/stderr)
@@ -29,11 +38,13 @@
 #ifndef PLATFORM_HOST_LOG_H_
 #define PLATFORM_HOST_LOG_H_
 
+#include <atomic>
 #include <cstdarg>
+#include <cstdint>
 #include <cstdio>
-#include <fstream>
 #include <mutex>
 #include <string>
+#include <thread>
 
 // =============================================================================
 // Log Level Enum
@@ -53,19 +64,41 @@ enum class HostLogLevel {
 
 class HostLogger {
 public:
+    // Staging ring geometry. Messages longer than the slot text are
+    // truncated; the drain thread appends the newline, so the text max is
+    // the full usable message length.
+    static constexpr uint32_t RING_CAPACITY = 1024;  // Power of two
+    static constexpr uint32_t RECORD_TEXT_MAX = 480;
+
     // Get singleton instance
     static HostLogger &get_instance();
 
-    // Log a message with specified level
+    // Log a message with specified level (formats into the staging ring)
     void log(HostLogLevel level, const char *format, ...);
 
     // Check if a log level is enabled
     bool is_enabled(HostLogLevel level) const;
 
-    // Reinitialize from environment (useful if env vars change)
+    // Block until every record logged before the call has been written out
+    void flush();
+
+    // Records dropped because the ring stayed full (cumulative)
+    uint64_t dropped_count() const { return dropped_.load(std::memory_order_relaxed); }
+
+    // Reinitialize from environment (useful if env vars change).
+    // Flushes the ring first so pending records go to the old sink.
     void reinitialize();
 
 private:
+    // One staging slot. `seq` is the Vyukov-style sequence number that
+    // hands the slot back and forth between producers and the drain thread.
+    struct alignas(64) Record {
+        std::atomic<uint64_t> seq;
+        HostLogLevel level;
+        uint16_t len;
+        char text[RECORD_TEXT_MAX];
+    };
+
     HostLogger();
     ~HostLogger();
 
@@ -84,12 +117,37 @@ private:
     // Get output file handle (FILE* for stdout/stderr or file)
     FILE *get_output_file(HostLogLevel level);
 
-    // Member variables
+    // Claim a slot, copy the formatted text in, publish it (lock-free)
+    void enqueue(HostLogLevel level, const char *text, uint32_t len);
+
+    // Drain-thread side: write out one pending record, if any
+    bool drain_one();
+
+    // Write a record to its sink (drain thread and shutdown path only)
+    void emit(HostLogLevel level, const char *text, uint32_t len);
+
+    // Write a WARN line for any drops since the last report
+    void report_drops();
+
+    void drain_loop();
+
+    // Configuration (guarded by mutex_; read-mostly)
     HostLogLevel current_level_;
     std::string log_file_path_;
     FILE *log_file_handle_;
-    std::mutex mutex_;
+    std::mutex mutex_;  // Config + sink only; never taken by log()
     bool initialized_;
+
+    // Staging ring
+    Record ring_[RING_CAPACITY];
+    std::atomic<uint64_t> enqueue_pos_{0};
+    uint64_t dequeue_pos_{0};  // Drain thread only
+    std::atomic<uint64_t> dropped_{0};
+    uint64_t dropped_reported_{0};  // Drain thread only
+
+    // Drain thread lifecycle
+    std::thread drain_thread_;
+    std::atomic<bool> stop_{false};
 };
 
 // =============================================================================
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Memory Allocator - Size-Class Pool (platform independent)
+ *
+ * Implements the caching pool layer of MemoryAllocator on top of the
+ * per-platform driver_alloc()/driver_free() hooks (a2a3: rtMalloc/rtFree,
+ * a2a3sim: malloc/free).
+ *
+ * Allocation requests round up to a power-of-two size class. Each class
+ * keeps a freelist of blocks retained across steps, so the steady state
+ * serves alloc/free in O(1) without touching the driver. Pool misses on
+ * small classes reserve a slab of SLAB_BLOCKS blocks in one driver call
+ * and carve it; carved blocks can only be handed back to the driver via
+ * their slab base at finalize(), so they always recycle through the
+ * freelist. Large-class blocks are allocated individually and may be
+ * driver-freed early once the retained-bytes cap is reached.
+ */
+
+#include "host/memory_allocator.h"
+
+namespace {
+// Slab carving applies to classes up to this block size; one driver call
+// reserves SLAB_BLOCKS blocks (first is returned, the rest are cached).
+constexpr size_t SLAB_CARVE_MAX = 1u << 20;
+constexpr int32_t SLAB_BLOCKS = 8;
+}  // namespace
+
+MemoryAllocator::~MemoryAllocator() { finalize(); }
+
+int32_t MemoryAllocator::class_index(size_t size) {
+    size_t block = MIN_CLASS_SIZE;
+    for (int32_t c = 0; c < NUM_SIZE_CLASSES; c++, block <<= 1) {
+        if (size <= block) {
+            return c;
+        }
+    }
+    return -1;
+}
+
+void *MemoryAllocator::alloc(size_t size) {
+    std::lock_guard<std::mutex> lk(mu_);
+    int32_t c = class_index(size);
+    if (c < 0) {
+        // Larger than the biggest class: bypass the pool entirely.
+        void *ptr = driver_alloc(size);
+        if (ptr == nullptr) {
+            return nullptr;
+        }
+        pool_misses_++;
+        blocks_.emplace(ptr, BlockInfo{-1, false, true});
+        live_count_++;
+        return ptr;
+    }
+
+    auto &fl = free_lists_[c];
+    if (!fl.empty()) {
+        void *ptr = fl.back();
+        fl.pop_back();
+        retained_bytes_ -= class_block_size(c);
+        blocks_[ptr].live = true;
+        live_count_++;
+        pool_hits_++;
+        return ptr;
+    }
+
+    pool_misses_++;
+    size_t block = class_block_size(c);
+
+    // Bulk reservation: one driver call carves a slab, pre-filling the
+    // freelist for the next SLAB_BLOCKS - 1 allocations of this class.
+    if (block <= SLAB_CARVE_MAX && retained_bytes_ + (SLAB_BLOCKS - 1) * block <= pool_cap_bytes_) {
+        void *slab = driver_alloc(block * SLAB_BLOCKS);
+        if (slab != nullptr) {
+            slabs_.push_back(slab);
+            char *base = static_cast<char *>(slab);
+            for (int32_t i = 1; i < SLAB_BLOCKS; i++) {
+                void *carved = base + static_cast<size_t>(i) * block;
+                blocks_.emplace(carved, BlockInfo{c, true, false});
+                fl.push_back(carved);
+            }
+            retained_bytes_ += (SLAB_BLOCKS - 1) * block;
+            blocks_.emplace(slab, BlockInfo{c, true, true});
+            live_count_++;
+            return slab;
+        }
+        // Slab reservation failed: fall through to a single-block allocation.
+    }
+
+    void *ptr = driver_alloc(block);
+    if (ptr == nullptr) {
+        return nullptr;
+    }
+    blocks_.emplace(ptr, BlockInfo{c, false, true});
+    live_count_++;
+    return ptr;
+}
+
+int MemoryAllocator::free(void *ptr) {
+    if (ptr == nullptr) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lk(mu_);
+    auto it = blocks_.find(ptr);
+    if (it == blocks_.end() || !it->second.live) {
+        return 0;
+    }
+    BlockInfo &info = it->second;
+    info.live = false;
+    live_count_--;
+
+    if (info.class_idx < 0) {
+        int rc = driver_free(ptr);
+        blocks_.erase(it);
+        return rc;
+    }
+
+    size_t block = class_block_size(info.class_idx);
+    if (!info.from_slab && retained_bytes_ + block > pool_cap_bytes_) {
+        // Pool is at its cap and this block is individually freeable.
+        int rc = driver_free(ptr);
+        blocks_.erase(it);
+        return rc;
+    }
+
+    // Slab-carved blocks always recycle: only the slab base can be handed
+    // back to the driver, and that happens at finalize().
+    free_lists_[info.class_idx].push_back(ptr);
+    retained_bytes_ += block;
+    return 0;
+}
+
+int MemoryAllocator::finalize() {
+    std::lock_guard<std::mutex> lk(mu_);
+    int last_error = 0;
+    for (void *slab : slabs_) {
+        int rc = driver_free(slab);
+        if (rc != 0) {
+            last_error = rc;
+        }
+    }
+    slabs_.clear();
+    for (const auto &entry : blocks_) {
+        if (entry.second.from_slab) {
+            continue;  // Covered by the slab base free above
+        }
+        int rc = driver_free(entry.first);
+        if (rc != 0) {
+            last_error = rc;
+        }
+    }
+    blocks_.clear();
+    for (auto &fl : free_lists_) {
+        fl.clear();
+    }
+    retained_bytes_ = 0;
+    live_count_ = 0;
+    return last_error;
+}
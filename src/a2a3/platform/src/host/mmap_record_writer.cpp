@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file mmap_record_writer.cpp
+ * @brief Chunked mmap record stream implementation
+ */
+
+#include "host/mmap_record_writer.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "common/unified_log.h"
+
+static constexpr uint64_t ENTRY_ALIGN = 8;
+
+static uint64_t align_up(uint64_t v) { return (v + ENTRY_ALIGN - 1) & ~(ENTRY_ALIGN - 1); }
+
+// =============================================================================
+// MmapRecordWriter
+// =============================================================================
+
+MmapRecordWriter::~MmapRecordWriter() {
+    if (is_open()) {
+        finalize();
+    }
+}
+
+int MmapRecordWriter::open(const std::string &path, uint64_t chunk_bytes) {
+    if (is_open()) {
+        LOG_ERROR("MmapRecordWriter: already open (%s)", path_.c_str());
+        return -1;
+    }
+    if (chunk_bytes < sizeof(MmapRecordEntryHeader) + ENTRY_ALIGN) {
+        LOG_ERROR("MmapRecordWriter: chunk size %lu too small", chunk_bytes);
+        return -1;
+    }
+
+    fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd_ < 0) {
+        LOG_ERROR("MmapRecordWriter: cannot create %s: %s", path.c_str(), strerror(errno));
+        return -1;
+    }
+
+    path_ = path;
+    chunk_bytes_ = chunk_bytes;
+    active_used_ = 0;
+    total_entries_ = 0;
+    chunk_used_.clear();
+
+    if (map_next_chunk() != 0) {
+        ::close(fd_);
+        fd_ = -1;
+        return -1;
+    }
+    return 0;
+}
+
+int MmapRecordWriter::map_next_chunk() {
+    uint64_t chunk_index = chunk_used_.size();
+    uint64_t new_size = (chunk_index + 1) * chunk_bytes_;
+    if (ftruncate(fd_, static_cast<off_t>(new_size)) != 0) {
+        LOG_ERROR("MmapRecordWriter: ftruncate to %lu failed: %s", new_size, strerror(errno));
+        return -1;
+    }
+
+    void *mapped = mmap(
+        nullptr, chunk_bytes_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_,
+        static_cast<off_t>(chunk_index * chunk_bytes_)
+    );
+    if (mapped == MAP_FAILED) {
+        LOG_ERROR("MmapRecordWriter: mmap chunk %lu failed: %s", chunk_index, strerror(errno));
+        return -1;
+    }
+
+    active_chunk_ = mapped;
+    active_used_ = 0;
+    return 0;
+}
+
+void MmapRecordWriter::seal_active_chunk() {
+    if (active_chunk_ == nullptr) {
+        return;
+    }
+    // Kick off writeback and drop the mapping so the kernel can reclaim
+    // the pages — this is what keeps RSS flat on long runs.
+    msync(active_chunk_, chunk_bytes_, MS_ASYNC);
+    munmap(active_chunk_, chunk_bytes_);
+    chunk_used_.push_back(active_used_);
+    active_chunk_ = nullptr;
+    active_used_ = 0;
+}
+
+int MmapRecordWriter::append(uint32_t stream_id, const void *data, uint64_t bytes) {
+    if (!is_open() || active_chunk_ == nullptr) {
+        return -1;
+    }
+    uint64_t entry_bytes = align_up(sizeof(MmapRecordEntryHeader) + bytes);
+    if (entry_bytes > chunk_bytes_) {
+        LOG_ERROR("MmapRecordWriter: entry of %lu bytes exceeds chunk size %lu", bytes, chunk_bytes_);
+        return -1;
+    }
+
+    if (active_used_ + entry_bytes > chunk_bytes_) {
+        seal_active_chunk();
+        if (map_next_chunk() != 0) {
+            return -1;
+        }
+    }
+
+    char *dst = static_cast<char *>(active_chunk_) + active_used_;
+    MmapRecordEntryHeader header = {stream_id, static_cast<uint32_t>(bytes)};
+    memcpy(dst, &header, sizeof(header));
+    memcpy(dst + sizeof(header), data, bytes);
+    active_used_ += entry_bytes;
+    total_entries_++;
+    return 0;
+}
+
+int MmapRecordWriter::finalize() {
+    if (!is_open()) {
+        return 0;
+    }
+    seal_active_chunk();
+
+    uint32_t chunk_count = static_cast<uint32_t>(chunk_used_.size());
+    uint64_t index_offset = static_cast<uint64_t>(chunk_count) * chunk_bytes_;
+
+    MmapStreamFooter footer = {};
+    footer.magic = MMAP_STREAM_MAGIC;
+    footer.version = MMAP_STREAM_VERSION;
+    footer.chunk_count = chunk_count;
+    footer.chunk_bytes = chunk_bytes_;
+    footer.total_entries = total_entries_;
+
+    int rc = 0;
+    uint64_t index_bytes = chunk_count * sizeof(uint64_t);
+    if (pwrite(fd_, chunk_used_.data(), index_bytes, static_cast<off_t>(index_offset)) !=
+            static_cast<ssize_t>(index_bytes) ||
+        pwrite(fd_, &footer, sizeof(footer), static_cast<off_t>(index_offset + index_bytes)) !=
+            static_cast<ssize_t>(sizeof(footer))) {
+        LOG_ERROR("MmapRecordWriter: footer write failed for %s: %s", path_.c_str(), strerror(errno));
+        rc = -1;
+    }
+
+    ::close(fd_);
+    fd_ = -1;
+    LOG_INFO(
+        "MmapRecordWriter: finalized %s (%lu entries, %u chunks of %lu MB)", path_.c_str(), total_entries_, chunk_count,
+        chunk_bytes_ >> 20
+    );
+    return rc;
+}
+
+// =============================================================================
+// MmapRecordReader
+// =============================================================================
+
+MmapRecordReader::~MmapRecordReader() { close(); }
+
+int MmapRecordReader::open(const std::string &path) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        LOG_ERROR("MmapRecordReader: cannot open %s: %s", path.c_str(), strerror(errno));
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<uint64_t>(st.st_size) < sizeof(MmapStreamFooter)) {
+        LOG_ERROR("MmapRecordReader: %s is missing or too small for a footer", path.c_str());
+        ::close(fd);
+        return -1;
+    }
+    file_size_ = static_cast<uint64_t>(st.st_size);
+
+    void *mapped = mmap(nullptr, file_size_, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);  // Mapping keeps the file alive
+    if (mapped == MAP_FAILED) {
+        LOG_ERROR("MmapRecordReader: mmap of %s failed: %s", path.c_str(), strerror(errno));
+        return -1;
+    }
+
+    const char *end = static_cast<const char *>(mapped) + file_size_;
+    memcpy(&footer_, end - sizeof(MmapStreamFooter), sizeof(MmapStreamFooter));
+    uint64_t index_bytes = static_cast<uint64_t>(footer_.chunk_count) * sizeof(uint64_t);
+    uint64_t expected_size =
+        static_cast<uint64_t>(footer_.chunk_count) * footer_.chunk_bytes + index_bytes + sizeof(MmapStreamFooter);
+    if (footer_.magic != MMAP_STREAM_MAGIC || footer_.version != MMAP_STREAM_VERSION || expected_size != file_size_) {
+        LOG_ERROR("MmapRecordReader: %s has an invalid or truncated footer", path.c_str());
+        munmap(mapped, file_size_);
+        return -1;
+    }
+
+    base_ = mapped;
+    chunk_used_ = reinterpret_cast<const uint64_t *>(end - sizeof(MmapStreamFooter) - index_bytes);
+    return 0;
+}
+
+void MmapRecordReader::for_each(const std::function<void(uint32_t, const void *, uint64_t)> &visit) const {
+    if (!is_open()) {
+        return;
+    }
+    for (uint32_t c = 0; c < footer_.chunk_count; c++) {
+        const char *chunk = static_cast<const char *>(base_) + static_cast<uint64_t>(c) * footer_.chunk_bytes;
+        uint64_t used = chunk_used_[c];
+        if (used > footer_.chunk_bytes) {
+            used = footer_.chunk_bytes;
+        }
+        uint64_t pos = 0;
+        while (pos + sizeof(MmapRecordEntryHeader) <= used) {
+            MmapRecordEntryHeader header;
+            memcpy(&header, chunk + pos, sizeof(header));
+            if (pos + sizeof(header) + header.bytes > used) {
+                LOG_ERROR("MmapRecordReader: truncated entry in chunk %u at offset %lu", c, pos);
+                break;
+            }
+            visit(header.stream_id, chunk + pos + sizeof(header), header.bytes);
+            pos += align_up(sizeof(header) + header.bytes);
+        }
+    }
+}
+
+void MmapRecordReader::close() {
+    if (base_ != nullptr) {
+        munmap(base_, file_size_);
+        base_ = nullptr;
+    }
+    file_size_ = 0;
+    footer_ = {};
+    chunk_used_ = nullptr;
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * @file perf_query.cpp
+ * @brief Implementation of the columnar perf run query library
+ */
+
+#include "host/perf_query.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include "common/perf_profiling.h"
+#include "common/unified_log.h"
+#include "host/mmap_record_writer.h"
+
+void PerfRunData::clear() {
+    task_id_.clear();
+    start_time_.clear();
+    end_time_.clear();
+    duration_.clear();
+    dispatch_time_.clear();
+    finish_time_.clear();
+    func_id_.clear();
+    core_id_.clear();
+    core_type_.clear();
+    pmu_cache_miss_.clear();
+    pmu_bus_access_.clear();
+    fanout_count_.clear();
+}
+
+void PerfRunData::append_records(uint32_t core_index, const void *data, uint64_t bytes) {
+    const PerfRecord *records = static_cast<const PerfRecord *>(data);
+    uint64_t count = bytes / sizeof(PerfRecord);
+    for (uint64_t i = 0; i < count; i++) {
+        const PerfRecord &rec = records[i];
+        task_id_.push_back(rec.task_id);
+        start_time_.push_back(rec.start_time);
+        end_time_.push_back(rec.end_time);
+        duration_.push_back(rec.duration);
+        dispatch_time_.push_back(rec.dispatch_time);
+        finish_time_.push_back(rec.finish_time);
+        func_id_.push_back(rec.func_id);
+        core_id_.push_back(core_index);
+        core_type_.push_back(static_cast<uint8_t>(rec.core_type));
+        pmu_cache_miss_.push_back(rec.pmu_cache_miss);
+        pmu_bus_access_.push_back(rec.pmu_bus_access);
+        fanout_count_.push_back(rec.fanout_count);
+    }
+}
+
+int PerfRunData::load(const std::string &path) {
+    MmapRecordReader reader;
+    if (reader.open(path) != 0) {
+        LOG_ERROR("PerfRunData: cannot open record stream %s", path.c_str());
+        return -1;
+    }
+
+    clear();
+
+    bool malformed = false;
+    reader.for_each([&](uint32_t stream_id, const void *data, uint64_t bytes) {
+        if (bytes % sizeof(PerfRecord) != 0) {
+            malformed = true;
+            return;
+        }
+        append_records(stream_id, data, bytes);
+    });
+    reader.close();
+
+    if (malformed) {
+        LOG_ERROR("PerfRunData: %s has entries that are not whole PerfRecords", path.c_str());
+        clear();
+        return -1;
+    }
+    return 0;
+}
+
+std::vector<uint64_t> PerfRunData::filter_indices(int64_t func_id, int64_t core_id, int64_t core_type,
+                                                  uint64_t start_after, uint64_t end_before) const {
+    std::vector<uint64_t> rows;
+    size_t n = size();
+    for (size_t i = 0; i < n; i++) {
+        if (func_id >= 0 && func_id_[i] != static_cast<uint32_t>(func_id)) continue;
+        if (core_id >= 0 && core_id_[i] != static_cast<uint32_t>(core_id)) continue;
+        if (core_type >= 0 && core_type_[i] != static_cast<uint8_t>(core_type)) continue;
+        if (start_after != 0 && start_time_[i] < start_after) continue;
+        if (end_before != 0 && end_time_[i] > end_before) continue;
+        rows.push_back(i);
+    }
+    std::sort(rows.begin(), rows.end(),
+              [this](uint64_t a, uint64_t b) { return start_time_[a] < start_time_[b]; });
+    return rows;
+}
+
+std::vector<PerfGroupStats> PerfRunData::group_durations(const std::vector<uint32_t> &keys) const {
+    std::unordered_map<uint32_t, PerfGroupStats> buckets;
+    size_t n = size();
+    for (size_t i = 0; i < n; i++) {
+        auto it = buckets.find(keys[i]);
+        if (it == buckets.end()) {
+            it = buckets.emplace(keys[i], PerfGroupStats{keys[i], 0, 0, UINT64_MAX, 0}).first;
+        }
+        PerfGroupStats &stats = it->second;
+        uint64_t d = duration_[i];
+        stats.count++;
+        stats.total_duration += d;
+        stats.min_duration = std::min(stats.min_duration, d);
+        stats.max_duration = std::max(stats.max_duration, d);
+    }
+
+    std::vector<PerfGroupStats> result;
+    result.reserve(buckets.size());
+    for (const auto &entry : buckets) {
+        result.push_back(entry.second);
+    }
+    return result;
+}
+
+std::vector<PerfGroupStats> PerfRunData::group_by_func() const {
+    std::vector<PerfGroupStats> result = group_durations(func_id_);
+    std::sort(result.begin(), result.end(), [](const PerfGroupStats &a, const PerfGroupStats &b) {
+        return a.total_duration > b.total_duration;
+    });
+    return result;
+}
+
+std::vector<PerfGroupStats> PerfRunData::group_by_core() const {
+    std::vector<PerfGroupStats> result = group_durations(core_id_);
+    std::sort(result.begin(), result.end(),
+              [](const PerfGroupStats &a, const PerfGroupStats &b) { return a.key < b.key; });
+    return result;
+}
+
+uint64_t PerfRunData::duration_percentile(double q) const {
+    if (duration_.empty()) {
+        return 0;
+    }
+    std::vector<uint64_t> scratch(duration_);
+    if (q < 0.0) q = 0.0;
+    if (q > 100.0) q = 100.0;
+    size_t rank = static_cast<size_t>((q / 100.0) * static_cast<double>(scratch.size() - 1) + 0.5);
+    std::nth_element(scratch.begin(), scratch.begin() + rank, scratch.end());
+    return scratch[rank];
+}
+
+uint64_t PerfRunData::duration_percentile(double q, const std::vector<uint64_t> &rows) const {
+    if (rows.empty()) {
+        return 0;
+    }
+    std::vector<uint64_t> scratch;
+    scratch.reserve(rows.size());
+    for (uint64_t row : rows) {
+        scratch.push_back(duration_[row]);
+    }
+    if (q < 0.0) q = 0.0;
+    if (q > 100.0) q = 100.0;
+    size_t rank = static_cast<size_t>((q / 100.0) * static_cast<double>(scratch.size() - 1) + 0.5);
+    std::nth_element(scratch.begin(), scratch.begin() + rank, scratch.end());
+    return scratch[rank];
+}
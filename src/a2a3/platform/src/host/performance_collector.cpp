@@ -76,12 +76,10 @@ void ProfMemoryManager::stop() {
         mgmt_thread_.join();
     }
 
-    // Drain remaining done_queue and free buffers
+    // Drain remaining done ring and free buffers
     {
-        std::scoped_lock<std::mutex> lock(done_mutex_);
-        while (!done_queue_.empty()) {
-            CopyDoneInfo info = done_queue_.front();
-            done_queue_.pop();
+        CopyDoneInfo info;
+        while (done_ring_.try_pop(info)) {
             free_buffer(info.dev_buffer_ptr);
         }
     }
@@ -99,31 +97,30 @@ void ProfMemoryManager::stop() {
     LOG_INFO("ProfMemoryManager stopped");
 }
 
-bool ProfMemoryManager::try_pop_ready(ReadyBufferInfo &info) {
-    std::scoped_lock<std::mutex> lock(ready_mutex_);
-    if (ready_queue_.empty()) {
-        return false;
-    }
-    info = ready_queue_.front();
-    ready_queue_.pop();
-    return true;
-}
+bool ProfMemoryManager::try_pop_ready(ReadyBufferInfo &info) { return ready_ring_.try_pop(info); }
 
 bool ProfMemoryManager::wait_pop_ready(ReadyBufferInfo &info, std::chrono::milliseconds timeout) {
-    std::unique_lock<std::mutex> lock(ready_mutex_);
-    if (ready_cv_.wait_for(lock, timeout, [this] {
-            return !ready_queue_.empty();
-        })) {
-        info = ready_queue_.front();
-        ready_queue_.pop();
-        return true;
-    }
-    return false;
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!ready_ring_.try_pop(info)) {
+        if (std::chrono::steady_clock::now() >= deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return true;
 }
 
 void ProfMemoryManager::notify_copy_done(const CopyDoneInfo &info) {
-    std::scoped_lock<std::mutex> lock(done_mutex_);
-    done_queue_.push(info);
+    // The ring holds more entries than buffers that can be in flight, so a
+    // full ring indicates a leak. Retry briefly, then drop with an error
+    // (the buffer leaks rather than corrupting the ring).
+    for (int attempt = 0; attempt < 1000; attempt++) {
+        if (done_ring_.try_push(info)) {
+            return;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(10));
+    }
+    LOG_ERROR("notify_copy_done: done ring full, leaking buffer %p", info.dev_buffer_ptr);
 }
 
 void *ProfMemoryManager::alloc_and_register(size_t size, void **host_ptr_out) {
@@ -211,10 +208,8 @@ void ProfMemoryManager::process_ready_entry(
                 host_ptr = resolve_host_ptr(new_dev_ptr);
             }
             if (new_dev_ptr == nullptr) {
-                std::scoped_lock<std::mutex> lock(done_mutex_);
-                while (!done_queue_.empty()) {
-                    CopyDoneInfo dinfo = done_queue_.front();
-                    done_queue_.pop();
+                CopyDoneInfo dinfo;
+                while (done_ring_.try_pop(dinfo)) {
                     if (dinfo.type == ProfBufferType::PERF_RECORD)
                         recycled_perf_buffers_.push_back(dinfo.dev_buffer_ptr);
                     else recycled_phase_buffers_.push_back(dinfo.dev_buffer_ptr);
@@ -258,11 +253,16 @@ void ProfMemoryManager::process_ready_entry(
         info.host_buffer_ptr = old_host_ptr;
         info.buffer_seq = seq;
 
-        {
-            std::scoped_lock<std::mutex> lock(ready_mutex_);
-            ready_queue_.push(info);
+        if (!ready_ring_.try_push(info)) {
+            // Ring capacity exceeds buffers in flight, so this is a leak
+            // upstream; recycle the buffer directly and lose its records.
+            LOG_ERROR("process_ready_entry: ready ring full, dropping buffer for index %u", info.index);
+            if (info.type == ProfBufferType::PERF_RECORD) {
+                recycled_perf_buffers_.push_back(info.dev_buffer_ptr);
+            } else {
+                recycled_phase_buffers_.push_back(info.dev_buffer_ptr);
+            }
         }
-        ready_cv_.notify_one();
 
     } else {
         uint32_t core_index = entry.core_index;
@@ -290,10 +290,8 @@ void ProfMemoryManager::process_ready_entry(
                 host_ptr = resolve_host_ptr(new_dev_ptr);
             }
             if (new_dev_ptr == nullptr) {
-                std::scoped_lock<std::mutex> lock(done_mutex_);
-                while (!done_queue_.empty()) {
-                    CopyDoneInfo dinfo = done_queue_.front();
-                    done_queue_.pop();
+                CopyDoneInfo dinfo;
+                while (done_ring_.try_pop(dinfo)) {
                     if (dinfo.type == ProfBufferType::PERF_RECORD)
                         recycled_perf_buffers_.push_back(dinfo.dev_buffer_ptr);
                     else recycled_phase_buffers_.push_back(dinfo.dev_buffer_ptr);
@@ -309,7 +307,8 @@ void ProfMemoryManager::process_ready_entry(
             }
             if (new_dev_ptr == nullptr) break;
 
-            reinterpret_cast<PerfBuffer *>(host_ptr)->count = 0;
+            reinterpret_cast<PerfBuffer *>(host_ptr)->bytes_used = 0;
+                        reinterpret_cast<PerfBuffer *>(host_ptr)->count = 0;
             uint32_t cur_tail = tail + p;
             state->free_queue.buffer_ptrs[cur_tail % PLATFORM_PROF_SLOT_COUNT] =
                 reinterpret_cast<uint64_t>(new_dev_ptr);
@@ -335,11 +334,16 @@ void ProfMemoryManager::process_ready_entry(
         info.host_buffer_ptr = old_host_ptr;
         info.buffer_seq = seq;
 
-        {
-            std::scoped_lock<std::mutex> lock(ready_mutex_);
-            ready_queue_.push(info);
+        if (!ready_ring_.try_push(info)) {
+            // Ring capacity exceeds buffers in flight, so this is a leak
+            // upstream; recycle the buffer directly and lose its records.
+            LOG_ERROR("process_ready_entry: ready ring full, dropping buffer for index %u", info.index);
+            if (info.type == ProfBufferType::PERF_RECORD) {
+                recycled_perf_buffers_.push_back(info.dev_buffer_ptr);
+            } else {
+                recycled_phase_buffers_.push_back(info.dev_buffer_ptr);
+            }
         }
-        ready_cv_.notify_one();
     }
 }
 
@@ -347,12 +351,10 @@ void ProfMemoryManager::mgmt_loop() {
     PerfDataHeader *header = get_perf_header(shared_mem_host_);
 
     while (running_.load()) {
-        // 1. Recycle done queue: move completed buffers to recycled pools for reuse
+        // 1. Recycle done ring: move completed buffers to recycled pools for reuse
         {
-            std::scoped_lock<std::mutex> lock(done_mutex_);
-            while (!done_queue_.empty()) {
-                CopyDoneInfo info = done_queue_.front();
-                done_queue_.pop();
+            CopyDoneInfo info;
+            while (done_ring_.try_pop(info)) {
                 if (info.type == ProfBufferType::PERF_RECORD) {
                     recycled_perf_buffers_.push_back(info.dev_buffer_ptr);
                 } else {
@@ -361,6 +363,21 @@ void ProfMemoryManager::mgmt_loop() {
             }
         }
 
+        // Low-watermark alarm: a near-empty recycled pool means the collector
+        // is not draining ready buffers fast enough and the device is about to
+        // stall waiting for free slots.
+        size_t low_watermark = static_cast<size_t>(num_cores_);
+        if (!recycled_low_warned_ && recycled_perf_buffers_.size() < low_watermark) {
+            LOG_WARN(
+                "recycled perf-buffer pool low (%zu < %zu): collector falling behind; "
+                "consider raising PLATFORM_PROF_BUFFERS_PER_CORE",
+                recycled_perf_buffers_.size(), low_watermark
+            );
+            recycled_low_warned_ = true;
+        } else if (recycled_low_warned_ && recycled_perf_buffers_.size() >= 2 * low_watermark) {
+            recycled_low_warned_ = false;
+        }
+
         // 2. Poll ReadyQueues from all AICPU threads
         bool found_any = false;
         for (int t = 0; t < PLATFORM_MAX_AICPU_THREADS; t++) {
@@ -410,6 +427,7 @@ void ProfMemoryManager::mgmt_loop() {
                     recycled_perf_buffers_.pop_back();
                     void *host_ptr = resolve_host_ptr(dev_ptr);
                     if (host_ptr != nullptr) {
+                        reinterpret_cast<PerfBuffer *>(host_ptr)->bytes_used = 0;
                         reinterpret_cast<PerfBuffer *>(host_ptr)->count = 0;
                         uint32_t t_val = state->free_queue.tail;
                         state->free_queue.buffer_ptrs[t_val % PLATFORM_PROF_SLOT_COUNT] =
@@ -450,7 +468,8 @@ void ProfMemoryManager::mgmt_loop() {
                     void *host_ptr = nullptr;
                     void *dev_ptr = alloc_and_register(sizeof(PerfBuffer), &host_ptr);
                     if (dev_ptr == nullptr) break;  // HBM exhausted, stop trying
-                    reinterpret_cast<PerfBuffer *>(host_ptr)->count = 0;
+                    reinterpret_cast<PerfBuffer *>(host_ptr)->bytes_used = 0;
+                        reinterpret_cast<PerfBuffer *>(host_ptr)->count = 0;
                     uint32_t t_val = state->free_queue.tail;
                     state->free_queue.buffer_ptrs[t_val % PLATFORM_PROF_SLOT_COUNT] =
                         reinterpret_cast<uint64_t>(dev_ptr);
@@ -503,10 +522,167 @@ void ProfMemoryManager::mgmt_loop() {
  * Scheduler phases: SCHED_COMPLETE(0), SCHED_DISPATCH(1), SCHED_SCAN(2), SCHED_IDLE_WAIT(3)
  * Orchestrator phases: ORCH_SYNC(16) through ORCH_SCOPE_END(24)
  */
+/**
+ * Decode a PerfBuffer's varint delta stream into PerfRecord structs.
+ *
+ * @param buf Host-mapped buffer (rmb() already issued by caller)
+ * @param out Destination vector, records are appended
+ * @return Number of records decoded (may be short of buf->count on corruption)
+ */
+static uint32_t decode_perf_buffer(const PerfBuffer *buf, std::vector<PerfRecord> &out) {
+    uint32_t count = buf->count;
+    if (count > PLATFORM_PROF_BUFFER_SIZE) {
+        count = PLATFORM_PROF_BUFFER_SIZE;
+    }
+    uint32_t bytes = buf->bytes_used;
+    if (bytes > PLATFORM_PROF_DATA_BYTES) {
+        LOG_ERROR("decode_perf_buffer: invalid bytes_used=%u (max=%u)", bytes, PLATFORM_PROF_DATA_BYTES);
+        return 0;
+    }
+
+    const uint8_t *p = buf->data;
+    const uint8_t *end = buf->data + bytes;
+    PerfDeltaBase base = {};
+    for (uint32_t i = 0; i < count; i++) {
+        PerfRecord rec;
+        uint32_t n = perf_record_decode(p, end, &rec, &base);
+        if (n == 0) {
+            LOG_ERROR("decode_perf_buffer: stream truncated at record %u/%u", i, count);
+            return i;
+        }
+        p += n;
+        out.push_back(rec);
+    }
+    return count;
+}
+
+void PerformanceCollector::open_record_stream() {
+    record_stream_.reset();
+    stream_loaded_ = false;
+
+    const char *env_path = std::getenv("SIMPLER_PERF_MMAP_STREAM");
+    if (env_path == nullptr || env_path[0] == '\0') {
+        return;
+    }
+
+    // Create the parent directory if the path has one (mirrors export behavior)
+    std::string path(env_path);
+    size_t slash = path.find_last_of('/');
+    if (slash != std::string::npos && slash > 0) {
+        std::string dir = path.substr(0, slash);
+        struct stat st;
+        if (stat(dir.c_str(), &st) == -1 && mkdir(dir.c_str(), 0755) != 0) {
+            LOG_ERROR("SIMPLER_PERF_MMAP_STREAM: cannot create directory %s, streaming disabled", dir.c_str());
+            return;
+        }
+    }
+
+    auto writer = std::make_unique<MmapRecordWriter>();
+    if (writer->open(path) != 0) {
+        LOG_ERROR("SIMPLER_PERF_MMAP_STREAM: cannot open %s, falling back to heap collection", path.c_str());
+        return;
+    }
+    record_stream_ = std::move(writer);
+    LOG_INFO("Streaming perf records to mmap-backed file %s", path.c_str());
+}
+
+uint32_t PerformanceCollector::ingest_perf_buffer(uint32_t core_index, const PerfBuffer *buf) {
+    if (record_stream_ == nullptr || !record_stream_->is_open()) {
+        return decode_perf_buffer(buf, collected_perf_records_[core_index]);
+    }
+
+    stream_scratch_.clear();
+    uint32_t count = decode_perf_buffer(buf, stream_scratch_);
+    if (count > 0 &&
+        record_stream_->append(core_index, stream_scratch_.data(), count * sizeof(PerfRecord)) != 0) {
+        // Sink failed (e.g. disk full) — keep the batch and stop streaming
+        LOG_ERROR("Perf record stream append failed, reverting to heap collection");
+        collected_perf_records_[core_index].insert(
+            collected_perf_records_[core_index].end(), stream_scratch_.begin(), stream_scratch_.end()
+        );
+        load_streamed_records();
+    }
+    return count;
+}
+
+void PerformanceCollector::load_streamed_records() {
+    if (record_stream_ == nullptr || stream_loaded_) {
+        return;
+    }
+    stream_loaded_ = true;
+
+    std::string path = record_stream_->path();
+    record_stream_->finalize();
+
+    MmapRecordReader reader;
+    if (reader.open(path) != 0) {
+        LOG_ERROR("Cannot read back streamed perf records from %s", path.c_str());
+        return;
+    }
+
+    uint64_t loaded = 0;
+    reader.for_each([&](uint32_t stream_id, const void *data, uint64_t bytes) {
+        if (stream_id >= static_cast<uint32_t>(num_aicore_) || bytes % sizeof(PerfRecord) != 0) {
+            return;
+        }
+        const PerfRecord *records = static_cast<const PerfRecord *>(data);
+        uint64_t count = bytes / sizeof(PerfRecord);
+        collected_perf_records_[stream_id].insert(
+            collected_perf_records_[stream_id].end(), records, records + count
+        );
+        loaded += count;
+    });
+    LOG_INFO("Loaded %lu streamed perf records from %s for export", loaded, path.c_str());
+}
+
 static bool is_scheduler_phase(AicpuPhaseId id) {
     return static_cast<uint32_t>(id) < static_cast<uint32_t>(AicpuPhaseId::SCHED_PHASE_COUNT);
 }
 
+// Telemetry records share the phase stream but are not time slices
+// (see AicpuPhaseId field-reuse docs); exclude them from slice lanes.
+static bool is_occupancy_sample(AicpuPhaseId id) { return id == AicpuPhaseId::OCC_RING_SAMPLE; }
+
+static const char *sched_phase_name(AicpuPhaseId id) {
+    switch (id) {
+    case AicpuPhaseId::SCHED_COMPLETE:
+        return "complete";
+    case AicpuPhaseId::SCHED_DISPATCH:
+        return "dispatch";
+    case AicpuPhaseId::SCHED_SCAN:
+        return "scan";
+    case AicpuPhaseId::SCHED_IDLE_WAIT:
+        return "idle";
+    default:
+        return "unknown";
+    }
+}
+
+static const char *orch_phase_name(AicpuPhaseId id) {
+    switch (id) {
+    case AicpuPhaseId::ORCH_SYNC:
+        return "orch_sync";
+    case AicpuPhaseId::ORCH_ALLOC:
+        return "orch_alloc";
+    case AicpuPhaseId::ORCH_PARAMS:
+        return "orch_params";
+    case AicpuPhaseId::ORCH_LOOKUP:
+        return "orch_lookup";
+    case AicpuPhaseId::ORCH_HEAP:
+        return "orch_heap";
+    case AicpuPhaseId::ORCH_INSERT:
+        return "orch_insert";
+    case AicpuPhaseId::ORCH_FANIN:
+        return "orch_fanin";
+    case AicpuPhaseId::ORCH_FINALIZE:
+        return "orch_finalize";
+    case AicpuPhaseId::ORCH_SCOPE_END:
+        return "orch_scope_end";
+    default:
+        return "unknown";
+    }
+}
+
 PerformanceCollector::~PerformanceCollector() {
     if (perf_shared_mem_host_ != nullptr) {
         LOG_WARN("PerformanceCollector destroyed without finalize()");
@@ -611,6 +787,23 @@ int PerformanceCollector::initialize(
     header->num_cores = num_aicore;
     header->total_tasks = 0;
 
+    memset(header->cycle_hist, 0, sizeof(header->cycle_hist));
+    const char *hist_only_env = std::getenv("SIMPLER_PERF_HIST_ONLY");
+    header->hist_only = (hist_only_env != nullptr && atoi(hist_only_env) != 0) ? 1 : 0;
+    if (header->hist_only != 0) {
+        LOG_INFO("Histogram-only profiling enabled (SIMPLER_PERF_HIST_ONLY): per-task records are skipped");
+    }
+
+    const char *pmu_interval_env = std::getenv("SIMPLER_PERF_PMU_INTERVAL");
+    int pmu_interval = (pmu_interval_env != nullptr) ? atoi(pmu_interval_env) : 0;
+    header->pmu_sample_interval = pmu_interval > 0 ? static_cast<uint32_t>(pmu_interval) : 0;
+    if (header->pmu_sample_interval != 0) {
+        LOG_INFO(
+            "PMU sampling enabled (SIMPLER_PERF_PMU_INTERVAL): counters attached to 1-in-%u dispatches",
+            header->pmu_sample_interval
+        );
+    }
+
     LOG_DEBUG("Initialized PerfDataHeader:");
     LOG_DEBUG("  num_cores:        %d", header->num_cores);
     LOG_DEBUG("  buffer_capacity:  %d", PLATFORM_PROF_BUFFER_SIZE);
@@ -744,6 +937,8 @@ void PerformanceCollector::poll_and_collect(int expected_tasks) {
     collected_phase_records_.clear();
     collected_phase_records_.resize(PLATFORM_MAX_AICPU_THREADS);
 
+    open_record_stream();
+
     if (expected_tasks <= 0) {
         LOG_INFO("Waiting for AICPU to write total_tasks in PerfDataHeader...");
         idle_start = std::chrono::steady_clock::now();
@@ -773,16 +968,9 @@ void PerformanceCollector::poll_and_collect(int expected_tasks) {
                 if (info.type == ProfBufferType::PERF_RECORD) {
                     PerfBuffer *buf = reinterpret_cast<PerfBuffer *>(info.host_buffer_ptr);
                     rmb();
-                    uint32_t count = buf->count;
-                    if (count > PLATFORM_PROF_BUFFER_SIZE) {
-                        count = PLATFORM_PROF_BUFFER_SIZE;
-                    }
                     uint32_t core_index = info.index;
                     if (core_index < static_cast<uint32_t>(num_aicore_)) {
-                        for (uint32_t i = 0; i < count; i++) {
-                            collected_perf_records_[core_index].push_back(buf->records[i]);
-                        }
-                        total_records_collected += count;
+                        total_records_collected += ingest_perf_buffer(core_index, buf);
                     }
                 } else {
                     PhaseBuffer *buf = reinterpret_cast<PhaseBuffer *>(info.host_buffer_ptr);
@@ -836,16 +1024,10 @@ void PerformanceCollector::poll_and_collect(int expected_tasks) {
             if (info.type == ProfBufferType::PERF_RECORD) {
                 PerfBuffer *buf = reinterpret_cast<PerfBuffer *>(info.host_buffer_ptr);
                 rmb();
-                uint32_t count = buf->count;
-                if (count > PLATFORM_PROF_BUFFER_SIZE) {
-                    count = PLATFORM_PROF_BUFFER_SIZE;
-                }
-
+                uint32_t count = 0;
                 uint32_t core_index = info.index;
                 if (core_index < static_cast<uint32_t>(num_aicore_)) {
-                    for (uint32_t i = 0; i < count; i++) {
-                        collected_perf_records_[core_index].push_back(buf->records[i]);
-                    }
+                    count = ingest_perf_buffer(core_index, buf);
                     total_records_collected += count;
                 }
 
@@ -883,14 +1065,9 @@ void PerformanceCollector::poll_and_collect(int expected_tasks) {
                     if (drain_info.type == ProfBufferType::PERF_RECORD) {
                         PerfBuffer *buf = reinterpret_cast<PerfBuffer *>(drain_info.host_buffer_ptr);
                         rmb();
-                        uint32_t count = buf->count;
-                        if (count > PLATFORM_PROF_BUFFER_SIZE) count = PLATFORM_PROF_BUFFER_SIZE;
                         uint32_t ci = drain_info.index;
                         if (ci < static_cast<uint32_t>(num_aicore_)) {
-                            for (uint32_t i = 0; i < count; i++) {
-                                collected_perf_records_[ci].push_back(buf->records[i]);
-                            }
-                            total_records_collected += count;
+                            total_records_collected += ingest_perf_buffer(ci, buf);
                         }
                     } else {
                         PhaseBuffer *buf = reinterpret_cast<PhaseBuffer *>(drain_info.host_buffer_ptr);
@@ -961,16 +1138,9 @@ void PerformanceCollector::drain_remaining_buffers() {
         if (info.type == ProfBufferType::PERF_RECORD) {
             PerfBuffer *buf = reinterpret_cast<PerfBuffer *>(info.host_buffer_ptr);
             rmb();
-            uint32_t count = buf->count;
-            if (count > PLATFORM_PROF_BUFFER_SIZE) {
-                count = PLATFORM_PROF_BUFFER_SIZE;
-            }
             uint32_t core_index = info.index;
             if (core_index < static_cast<uint32_t>(num_aicore_)) {
-                for (uint32_t i = 0; i < count; i++) {
-                    collected_perf_records_[core_index].push_back(buf->records[i]);
-                }
-                drained_perf += count;
+                drained_perf += ingest_perf_buffer(core_index, buf);
             }
         } else {
             PhaseBuffer *buf = reinterpret_cast<PhaseBuffer *>(info.host_buffer_ptr);
@@ -1026,18 +1196,11 @@ void PerformanceCollector::scan_remaining_perf_buffers() {
         }
 
         PerfBuffer *buf = reinterpret_cast<PerfBuffer *>(host_ptr);
-        uint32_t count = buf->count;
-        if (count == 0) {
+        if (buf->count == 0) {
             continue;
         }
-        if (count > PLATFORM_PROF_BUFFER_SIZE) {
-            count = PLATFORM_PROF_BUFFER_SIZE;
-        }
 
-        for (uint32_t i = 0; i < count; i++) {
-            collected_perf_records_[core_index].push_back(buf->records[i]);
-        }
-        total_recovered += count;
+        total_recovered += ingest_perf_buffer(static_cast<uint32_t>(core_index), buf);
     }
 
     if (total_recovered > 0) {
@@ -1110,14 +1273,15 @@ void PerformanceCollector::collect_phase_data() {
     // Log per-thread totals
     for (size_t t = 0; t < collected_phase_records_.size(); t++) {
         if (!collected_phase_records_[t].empty()) {
-            size_t sched_count = 0, orch_count = 0;
+            size_t sched_count = 0, orch_count = 0, occ_count = 0;
             for (const auto &r : collected_phase_records_[t]) {
-                if (is_scheduler_phase(r.phase_id)) sched_count++;
+                if (is_occupancy_sample(r.phase_id)) occ_count++;
+                else if (is_scheduler_phase(r.phase_id)) sched_count++;
                 else orch_count++;
             }
             LOG_INFO(
-                "  Thread %zu: %zu records (sched=%zu, orch=%zu)", t, collected_phase_records_[t].size(), sched_count,
-                orch_count
+                "  Thread %zu: %zu records (sched=%zu, orch=%zu, occ=%zu)", t, collected_phase_records_[t].size(),
+                sched_count, orch_count, occ_count
             );
         }
     }
@@ -1131,10 +1295,61 @@ void PerformanceCollector::collect_phase_data() {
             "  Orchestrator: %" PRId64 " tasks, %.3fus", static_cast<int64_t>(collected_orch_summary_.submit_count),
             cycles_to_us(collected_orch_summary_.end_time - collected_orch_summary_.start_time)
         );
+        if (collected_orch_summary_.task_window_size > 0) {
+            LOG_INFO(
+                "  Ring high-water: tasks=%d/%d, heap=%" PRIu64 "/%" PRIu64 ", stalls(task=%" PRIu64 ", heap=%" PRIu64
+                "), spills=%" PRIu64 ", inline=%" PRIu64,
+                collected_orch_summary_.peak_live_tasks, collected_orch_summary_.task_window_size,
+                collected_orch_summary_.peak_heap_used, collected_orch_summary_.heap_capacity,
+                collected_orch_summary_.alloc_task_stalls, collected_orch_summary_.alloc_heap_stalls,
+                collected_orch_summary_.heap_spill_count, collected_orch_summary_.inline_alloc_count
+            );
+        }
     } else {
         LOG_INFO("  Orchestrator: no summary data");
     }
 
+    // Read per-thread scheduler cycle summaries (published when the runtime is
+    // built with PTO2_SCHED_PROFILING; absent entries keep magic == 0)
+    collected_sched_summaries_.assign(
+        phase_header->sched_summary, phase_header->sched_summary + PLATFORM_MAX_AICPU_THREADS
+    );
+    for (size_t t = 0; t < collected_sched_summaries_.size(); t++) {
+        const AicpuSchedSummary &ss = collected_sched_summaries_[t];
+        if (ss.magic != AICPU_PHASE_MAGIC) {
+            continue;
+        }
+        uint64_t loop_total =
+            ss.complete_cycle + ss.dispatch_cycle + ss.scan_cycle + ss.wiring_cycle + ss.idle_cycle;
+        if (loop_total == 0) loop_total = 1;
+        LOG_INFO(
+            "  Sched thread %zu: loops=%" PRIu64 ", complete=%.3fus (%.1f%%), dispatch=%.3fus (%.1f%%), "
+            "scan=%.3fus, wiring=%.3fus, idle=%.3fus, tasks=%" PRId64,
+            t, ss.loop_count, cycles_to_us(ss.complete_cycle), ss.complete_cycle * 100.0 / loop_total,
+            cycles_to_us(ss.dispatch_cycle), ss.dispatch_cycle * 100.0 / loop_total, cycles_to_us(ss.scan_cycle),
+            cycles_to_us(ss.wiring_cycle), cycles_to_us(ss.idle_cycle), static_cast<int64_t>(ss.complete_count)
+        );
+        LOG_INFO(
+            "    contention: lock_wait=%.3fus, push_wait=%.3fus, pop_wait=%.3fus, atomics=%" PRIu64
+            " (publish_seq=%u)",
+            cycles_to_us(ss.lock_wait_cycle), cycles_to_us(ss.push_wait_cycle), cycles_to_us(ss.pop_wait_cycle),
+            ss.atomic_count, ss.publish_seq
+        );
+        uint64_t idle_attr_count = 0;
+        for (uint32_t c = 0; c < PERF_IDLE_CAUSE_COUNT; c++) {
+            idle_attr_count += ss.idle_cause_count[c];
+        }
+        if (idle_attr_count > 0) {
+            LOG_INFO(
+                "    idle causes: no_ready=%.3fus (n=%" PRIu64 "), fanin_wait=%.3fus (n=%" PRIu64
+                "), alloc_stall=%.3fus (n=%" PRIu64 "), drain=%.3fus (n=%" PRIu64 ")",
+                cycles_to_us(ss.idle_cause_cycle[0]), ss.idle_cause_count[0], cycles_to_us(ss.idle_cause_cycle[1]),
+                ss.idle_cause_count[1], cycles_to_us(ss.idle_cause_cycle[2]), ss.idle_cause_count[2],
+                cycles_to_us(ss.idle_cause_cycle[3]), ss.idle_cause_count[3]
+            );
+        }
+    }
+
     // Check if drain_remaining_buffers() already accumulated some Phase records
     bool has_accumulated = has_phase_data_;
     if (!has_accumulated) {
@@ -1169,6 +1384,8 @@ int PerformanceCollector::export_swimlane_json(const std::string &output_path_ar
     const char *env_dir = std::getenv("SIMPLER_PERF_OUTPUT_DIR");
     const std::string output_path = (env_dir != nullptr && env_dir[0] != '\0') ? std::string(env_dir) : output_path_arg;
 
+    load_streamed_records();
+
     // Step 1: Validate collected data
     bool has_any_records = false;
     for (const auto &core_records : collected_perf_records_) {
@@ -1283,6 +1500,29 @@ int PerformanceCollector::export_swimlane_json(const std::string &output_path_ar
         outfile << "      \"duration_us\": " << std::fixed << std::setprecision(3) << duration_us << ",\n";
         outfile << "      \"dispatch_time_us\": " << std::fixed << std::setprecision(3) << dispatch_us << ",\n";
         outfile << "      \"finish_time_us\": " << std::fixed << std::setprecision(3) << finish_us << ",\n";
+        if (record.pmu_cache_miss != 0 || record.pmu_bus_access != 0) {
+            outfile << "      \"pmu_cache_miss\": " << record.pmu_cache_miss << ",\n";
+            outfile << "      \"pmu_bus_access\": " << record.pmu_bus_access << ",\n";
+        }
+        // Intra-kernel phase markers (perf_aicore_phase_marker): emitted as
+        // [id, time_us] pairs relative to the same base as start_time_us.
+        int safe_phase_count =
+            (record.phase_count >= 0 && record.phase_count <= static_cast<int32_t>(PERF_PHASE_MARKER_SLOTS))
+                ? record.phase_count
+                : 0;
+        if (safe_phase_count > 0) {
+            outfile << "      \"phases\": [";
+            for (int j = 0; j < safe_phase_count; ++j) {
+                uint64_t marker = record.phase_markers[j];
+                double phase_us = cycles_to_us((perf_phase_marker_time(marker) - base_time_cycles) & PERF_PHASE_TS_MASK);
+                outfile << "[" << static_cast<int>(perf_phase_marker_id(marker)) << ", " << std::fixed
+                        << std::setprecision(3) << phase_us << "]";
+                if (j < safe_phase_count - 1) {
+                    outfile << ", ";
+                }
+            }
+            outfile << "],\n";
+        }
         outfile << "      \"fanout\": [";
         int safe_fanout_count =
             (record.fanout_count >= 0 && record.fanout_count <= RUNTIME_MAX_FANOUT) ? record.fanout_count : 0;
@@ -1304,46 +1544,6 @@ int PerformanceCollector::export_swimlane_json(const std::string &output_path_ar
 
     // Step 8: Write phase profiling data (version 2)
     if (has_phase_data_) {
-        auto sched_phase_name = [](AicpuPhaseId id) -> const char * {
-            switch (id) {
-            case AicpuPhaseId::SCHED_COMPLETE:
-                return "complete";
-            case AicpuPhaseId::SCHED_DISPATCH:
-                return "dispatch";
-            case AicpuPhaseId::SCHED_SCAN:
-                return "scan";
-            case AicpuPhaseId::SCHED_IDLE_WAIT:
-                return "idle";
-            default:
-                return "unknown";
-            }
-        };
-
-        auto orch_phase_name = [](AicpuPhaseId id) -> const char * {
-            switch (id) {
-            case AicpuPhaseId::ORCH_SYNC:
-                return "orch_sync";
-            case AicpuPhaseId::ORCH_ALLOC:
-                return "orch_alloc";
-            case AicpuPhaseId::ORCH_PARAMS:
-                return "orch_params";
-            case AicpuPhaseId::ORCH_LOOKUP:
-                return "orch_lookup";
-            case AicpuPhaseId::ORCH_HEAP:
-                return "orch_heap";
-            case AicpuPhaseId::ORCH_INSERT:
-                return "orch_insert";
-            case AicpuPhaseId::ORCH_FANIN:
-                return "orch_fanin";
-            case AicpuPhaseId::ORCH_FINALIZE:
-                return "orch_finalize";
-            case AicpuPhaseId::ORCH_SCOPE_END:
-                return "orch_scope_end";
-            default:
-                return "unknown";
-            }
-        };
-
         // AICPU scheduler phases (filtered from unified collected_phase_records_)
         outfile << ",\n  \"aicpu_scheduler_phases\": [\n";
         for (size_t t = 0; t < collected_phase_records_.size(); t++) {
@@ -1394,15 +1594,89 @@ int PerformanceCollector::export_swimlane_json(const std::string &output_path_ar
                     << cycles_to_us(collected_orch_summary_.fanin_cycle) << ",\n";
             outfile << "      \"scope_end\": " << std::fixed << std::setprecision(3)
                     << cycles_to_us(collected_orch_summary_.scope_end_cycle) << "\n";
+            outfile << "    },\n";
+            outfile << "    \"ring_high_water\": {\n";
+            outfile << "      \"peak_live_tasks\": " << collected_orch_summary_.peak_live_tasks << ",\n";
+            outfile << "      \"task_window_size\": " << collected_orch_summary_.task_window_size << ",\n";
+            outfile << "      \"peak_heap_used\": " << collected_orch_summary_.peak_heap_used << ",\n";
+            outfile << "      \"heap_capacity\": " << collected_orch_summary_.heap_capacity << ",\n";
+            outfile << "      \"alloc_task_stalls\": " << collected_orch_summary_.alloc_task_stalls << ",\n";
+            outfile << "      \"alloc_heap_stalls\": " << collected_orch_summary_.alloc_heap_stalls << ",\n";
+            outfile << "      \"heap_spill_count\": " << collected_orch_summary_.heap_spill_count << ",\n";
+            outfile << "      \"inline_alloc_count\": " << collected_orch_summary_.inline_alloc_count << "\n";
             outfile << "    }\n";
             outfile << "  }";
         }
 
+        // Per-thread scheduler cycle counters (PTO2_SCHED_PROFILING builds only)
+        bool has_sched_summaries = false;
+        for (const auto &ss : collected_sched_summaries_) {
+            if (ss.magic == AICPU_PHASE_MAGIC) {
+                has_sched_summaries = true;
+                break;
+            }
+        }
+        if (has_sched_summaries) {
+            outfile << ",\n  \"aicpu_scheduler_counters\": [\n";
+            bool first = true;
+            for (size_t t = 0; t < collected_sched_summaries_.size(); t++) {
+                const AicpuSchedSummary &ss = collected_sched_summaries_[t];
+                if (ss.magic != AICPU_PHASE_MAGIC) continue;
+                if (!first) outfile << ",\n";
+                outfile << "    {\"thread\": " << t << ", \"loop_count\": " << ss.loop_count << ",\n";
+                outfile << "     \"phase_us\": {\n";
+                outfile << "       \"complete\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(ss.complete_cycle) << ",\n";
+                outfile << "       \"dispatch\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(ss.dispatch_cycle) << ",\n";
+                outfile << "       \"scan\": " << std::fixed << std::setprecision(3) << cycles_to_us(ss.scan_cycle)
+                        << ",\n";
+                outfile << "       \"wiring\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(ss.wiring_cycle) << ",\n";
+                outfile << "       \"idle\": " << std::fixed << std::setprecision(3) << cycles_to_us(ss.idle_cycle)
+                        << ",\n";
+                outfile << "       \"otc_lock\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(ss.lock_cycle) << ",\n";
+                outfile << "       \"otc_fanout\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(ss.fanout_cycle) << ",\n";
+                outfile << "       \"otc_fanin\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(ss.fanin_cycle) << ",\n";
+                outfile << "       \"otc_self\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(ss.self_consumed_cycle) << "\n";
+                outfile << "     },\n";
+                outfile << "     \"wait_us\": {\n";
+                outfile << "       \"lock\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(ss.lock_wait_cycle) << ",\n";
+                outfile << "       \"push\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(ss.push_wait_cycle) << ",\n";
+                outfile << "       \"pop\": " << std::fixed << std::setprecision(3) << cycles_to_us(ss.pop_wait_cycle)
+                        << "\n";
+                outfile << "     },\n";
+                outfile << "     \"idle_cause_us\": {\n";
+                outfile << "       \"no_ready_task\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(ss.idle_cause_cycle[0]) << ",\n";
+                outfile << "       \"waiting_fanin\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(ss.idle_cause_cycle[1]) << ",\n";
+                outfile << "       \"alloc_stall\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(ss.idle_cause_cycle[2]) << ",\n";
+                outfile << "       \"drain\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(ss.idle_cause_cycle[3]) << "\n";
+                outfile << "     },\n";
+                outfile << "     \"idle_cause_count\": [" << ss.idle_cause_count[0] << ", " << ss.idle_cause_count[1]
+                        << ", " << ss.idle_cause_count[2] << ", " << ss.idle_cause_count[3] << "],\n";
+                outfile << "     \"atomic_count\": " << ss.atomic_count
+                        << ", \"complete_count\": " << ss.complete_count << ", \"publish_seq\": " << ss.publish_seq
+                        << "}";
+                first = false;
+            }
+            outfile << "\n  ]";
+        }
+
         // Per-task orchestrator phase records (filtered from unified collected_phase_records_)
         bool has_orch_phases = false;
         for (const auto &v : collected_phase_records_) {
             for (const auto &r : v) {
-                if (!is_scheduler_phase(r.phase_id)) {
+                if (!is_scheduler_phase(r.phase_id) && !is_occupancy_sample(r.phase_id)) {
                     has_orch_phases = true;
                     break;
                 }
@@ -1415,7 +1689,7 @@ int PerformanceCollector::export_swimlane_json(const std::string &output_path_ar
                 outfile << "    [\n";
                 bool first = true;
                 for (const auto &pr : collected_phase_records_[t]) {
-                    if (is_scheduler_phase(pr.phase_id)) continue;
+                    if (is_scheduler_phase(pr.phase_id) || is_occupancy_sample(pr.phase_id)) continue;
                     double start_us = cycles_to_us(pr.start_time - base_time_cycles);
                     double end_us = cycles_to_us(pr.end_time - base_time_cycles);
                     if (!first) outfile << ",\n";
@@ -1432,6 +1706,38 @@ int PerformanceCollector::export_swimlane_json(const std::string &output_path_ar
             }
             outfile << "  ]";
         }
+
+        // Ring-occupancy time-series (OCC_RING_SAMPLE telemetry records)
+        bool has_occ_samples = false;
+        for (const auto &v : collected_phase_records_) {
+            for (const auto &r : v) {
+                if (is_occupancy_sample(r.phase_id)) {
+                    has_occ_samples = true;
+                    break;
+                }
+            }
+            if (has_occ_samples) break;
+        }
+        if (has_occ_samples) {
+            outfile << ",\n  \"ring_occupancy\": [\n";
+            bool first = true;
+            for (const auto &thread_records : collected_phase_records_) {
+                for (const auto &pr : thread_records) {
+                    if (!is_occupancy_sample(pr.phase_id)) continue;
+                    double time_us = cycles_to_us(pr.start_time - base_time_cycles);
+                    uint64_t tasks_live = pr.task_id >> 32;
+                    uint64_t fanin_used = (pr.task_id >> 16) & 0xFFFF;
+                    uint64_t dep_used = pr.task_id & 0xFFFF;
+                    if (!first) outfile << ",\n";
+                    outfile << "    {\"time_us\": " << std::fixed << std::setprecision(3) << time_us
+                            << ", \"tasks_live\": " << tasks_live << ", \"heap_bytes_live\": " << pr.end_time
+                            << ", \"fanin_pool_used\": " << fanin_used << ", \"dep_pool_used\": " << dep_used
+                            << ", \"loop_iter\": " << pr.loop_iter << "}";
+                    first = false;
+                }
+            }
+            outfile << "\n  ]";
+        }
     }
 
     // Core-to-thread mapping
@@ -1457,6 +1763,257 @@ int PerformanceCollector::export_swimlane_json(const std::string &output_path_ar
     return 0;
 }
 
+int PerformanceCollector::export_chrome_trace(const std::string &output_path_arg) {
+    // Same SIMPLER_PERF_OUTPUT_DIR override as export_swimlane_json
+    const char *env_dir = std::getenv("SIMPLER_PERF_OUTPUT_DIR");
+    const std::string output_path = (env_dir != nullptr && env_dir[0] != '\0') ? std::string(env_dir) : output_path_arg;
+
+    load_streamed_records();
+
+    bool has_any_records = false;
+    for (const auto &core_records : collected_perf_records_) {
+        if (!core_records.empty()) {
+            has_any_records = true;
+            break;
+        }
+    }
+    if (!has_any_records && !has_phase_data_) {
+        LOG_WARN("Warning: No performance data to export.");
+        return -1;
+    }
+
+    struct stat st;
+    if (stat(output_path.c_str(), &st) == -1) {
+        if (mkdir(output_path.c_str(), 0755) != 0) {
+            LOG_ERROR("Error: Failed to create output directory.");
+            return -1;
+        }
+    }
+
+    // All event sources share the device clock (get_sys_cnt), so one common
+    // base timestamp puts every track on the same time axis.
+    uint64_t base_time_cycles = UINT64_MAX;
+    for (const auto &core_records : collected_perf_records_) {
+        for (const auto &record : core_records) {
+            if (record.start_time < base_time_cycles) base_time_cycles = record.start_time;
+            if (record.dispatch_time > 0 && record.dispatch_time < base_time_cycles)
+                base_time_cycles = record.dispatch_time;
+        }
+    }
+    for (const auto &thread_records : collected_phase_records_) {
+        for (const auto &pr : thread_records) {
+            if (pr.start_time > 0 && pr.start_time < base_time_cycles) base_time_cycles = pr.start_time;
+        }
+    }
+    bool orch_valid = (collected_orch_summary_.magic == AICPU_PHASE_MAGIC);
+    if (orch_valid && collected_orch_summary_.start_time > 0 && collected_orch_summary_.start_time < base_time_cycles) {
+        base_time_cycles = collected_orch_summary_.start_time;
+    }
+    if (base_time_cycles == UINT64_MAX) base_time_cycles = 0;
+
+    std::time_t now = time(nullptr);
+    std::tm *timeinfo = std::localtime(&now);
+    char time_buffer[32];
+    std::strftime(time_buffer, sizeof(time_buffer), "%Y%m%d_%H%M%S", timeinfo);
+    std::string filepath = output_path + "/perf_trace_" + std::string(time_buffer) + ".json";
+
+    std::ofstream outfile(filepath);
+    if (!outfile.is_open()) {
+        LOG_ERROR("Error: Failed to open file: %s", filepath.c_str());
+        return -1;
+    }
+
+    // Chrome trace event JSON array; loads in Perfetto UI and chrome://tracing
+    constexpr int PID_AICORE = 1;
+    constexpr int PID_AICPU = 2;
+    bool first_event = true;
+    size_t event_count = 0;
+
+    auto emit_prefix = [&]() {
+        if (!first_event) outfile << ",\n";
+        first_event = false;
+        event_count++;
+    };
+    auto emit_meta = [&](int pid, int tid, const char *what, const std::string &name) {
+        emit_prefix();
+        outfile << "  {\"ph\": \"M\", \"pid\": " << pid << ", \"tid\": " << tid << ", \"name\": \"" << what
+                << "\", \"args\": {\"name\": \"" << name << "\"}}";
+    };
+    auto emit_slice = [&](int pid, int tid, const std::string &name, uint64_t start, uint64_t end,
+                          const std::string &args_json) {
+        emit_prefix();
+        outfile << "  {\"ph\": \"X\", \"pid\": " << pid << ", \"tid\": " << tid << ", \"name\": \"" << name << "\""
+                << ", \"ts\": " << std::fixed << std::setprecision(3) << cycles_to_us(start - base_time_cycles)
+                << ", \"dur\": " << std::fixed << std::setprecision(3) << cycles_to_us(end - start);
+        if (!args_json.empty()) outfile << ", \"args\": {" << args_json << "}";
+        outfile << "}";
+    };
+
+    outfile << "[\n";
+    emit_meta(PID_AICORE, 0, "process_name", "AICore");
+    emit_meta(PID_AICPU, 0, "process_name", "AICPU");
+
+    // Per-core tracks: a wait slice (dispatch -> kernel start) followed by the
+    // kernel slice, so dispatch bubbles are visible directly on the timeline
+    for (size_t core_idx = 0; core_idx < collected_perf_records_.size(); core_idx++) {
+        const auto &core_records = collected_perf_records_[core_idx];
+        if (core_records.empty()) continue;
+
+        int tid = static_cast<int>(core_idx);
+        const char *core_type_str = (core_records.front().core_type == CoreType::AIC) ? "aic" : "aiv";
+        emit_meta(PID_AICORE, tid, "thread_name", "core " + std::to_string(core_idx) + " (" + core_type_str + ")");
+
+        for (const auto &record : core_records) {
+            std::string args = "\"task_id\": " + std::to_string(record.task_id) +
+                               ", \"ring_id\": " + std::to_string(static_cast<int>(record.task_id >> 32)) +
+                               ", \"func_id\": " + std::to_string(record.func_id);
+            if (record.pmu_cache_miss != 0 || record.pmu_bus_access != 0) {
+                args += ", \"pmu_cache_miss\": " + std::to_string(record.pmu_cache_miss) +
+                        ", \"pmu_bus_access\": " + std::to_string(record.pmu_bus_access);
+            }
+            if (record.dispatch_time > 0 && record.start_time > record.dispatch_time) {
+                emit_slice(PID_AICORE, tid, "wait", record.dispatch_time, record.start_time, args);
+            }
+            if (record.end_time > record.start_time) {
+                emit_slice(PID_AICORE, tid, "func_" + std::to_string(record.func_id), record.start_time,
+                           record.end_time, args);
+            }
+        }
+    }
+
+    // AICPU threads: scheduler phases and per-task orchestrator phases share
+    // collected_phase_records_; the orchestrator occupies its own thread slot
+    for (size_t t = 0; t < collected_phase_records_.size(); t++) {
+        const auto &thread_records = collected_phase_records_[t];
+        if (thread_records.empty()) continue;
+
+        int tid = static_cast<int>(t);
+        bool is_orch_thread = false;
+        for (const auto &pr : thread_records) {
+            if (!is_scheduler_phase(pr.phase_id) && !is_occupancy_sample(pr.phase_id)) {
+                is_orch_thread = true;
+                break;
+            }
+        }
+        emit_meta(
+            PID_AICPU, tid, "thread_name",
+            is_orch_thread ? "orchestrator" : "sched thread " + std::to_string(t)
+        );
+
+        for (const auto &pr : thread_records) {
+            if (is_occupancy_sample(pr.phase_id)) {
+                // Telemetry record, not a time slice: emit counter tracks so
+                // occupancy ramps render as graphs above the slice lanes
+                emit_prefix();
+                outfile << "  {\"ph\": \"C\", \"pid\": " << PID_AICPU << ", \"tid\": " << tid
+                        << ", \"name\": \"ring occupancy\", \"ts\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(pr.start_time - base_time_cycles) << ", \"args\": {\"tasks_live\": "
+                        << (pr.task_id >> 32) << ", \"fanin_pool_used\": " << ((pr.task_id >> 16) & 0xFFFF)
+                        << ", \"dep_pool_used\": " << (pr.task_id & 0xFFFF) << "}}";
+                emit_prefix();
+                outfile << "  {\"ph\": \"C\", \"pid\": " << PID_AICPU << ", \"tid\": " << tid
+                        << ", \"name\": \"heap bytes live\", \"ts\": " << std::fixed << std::setprecision(3)
+                        << cycles_to_us(pr.start_time - base_time_cycles) << ", \"args\": {\"heap_bytes_live\": "
+                        << pr.end_time << "}}";
+                continue;
+            }
+            if (pr.end_time <= pr.start_time || pr.start_time == 0) continue;
+            bool sched = is_scheduler_phase(pr.phase_id);
+            std::string args = sched ? "\"loop_iter\": " + std::to_string(pr.loop_iter) +
+                                           ", \"tasks_processed\": " + std::to_string(pr.tasks_processed)
+                                     : "\"submit_idx\": " + std::to_string(pr.loop_iter) +
+                                           ", \"task_id\": " + std::to_string(pr.task_id);
+            emit_slice(
+                PID_AICPU, tid, sched ? sched_phase_name(pr.phase_id) : orch_phase_name(pr.phase_id), pr.start_time,
+                pr.end_time, args
+            );
+        }
+    }
+
+    // Orchestrator summary span (covers the whole submission window)
+    if (orch_valid && collected_orch_summary_.end_time > collected_orch_summary_.start_time) {
+        int tid = static_cast<int>(collected_phase_records_.size());
+        emit_meta(PID_AICPU, tid, "thread_name", "orchestration total");
+        emit_slice(
+            PID_AICPU, tid, "orchestration", collected_orch_summary_.start_time, collected_orch_summary_.end_time,
+            "\"submit_count\": " + std::to_string(collected_orch_summary_.submit_count)
+        );
+    }
+
+    outfile << "\n]\n";
+    outfile.close();
+
+    LOG_INFO("=== Chrome Trace Export Complete ===");
+    LOG_INFO("File: %s", filepath.c_str());
+    LOG_INFO("Events: %zu", event_count);
+
+    return 0;
+}
+
+void PerformanceCollector::report_cycle_histograms(const PerfDataHeader *header) {
+    uint64_t dispatch_gap[PERF_HIST_BUCKETS] = {};
+    uint64_t queue_wait[PERF_HIST_BUCKETS] = {};
+    uint64_t kernel_cycles[PERF_HIST_BUCKETS] = {};
+    uint64_t total_tasks = 0;
+
+    for (int i = 0; i < num_aicore_; i++) {
+        const PerfCycleHist &h = header->cycle_hist[i];
+        total_tasks += h.task_count;
+        for (int b = 0; b < PERF_HIST_BUCKETS; b++) {
+            dispatch_gap[b] += h.dispatch_gap[b];
+            queue_wait[b] += h.queue_wait[b];
+            kernel_cycles[b] += h.kernel_cycles[b];
+        }
+    }
+    if (total_tasks == 0) {
+        return;
+    }
+
+    struct Metric {
+        const char *name;
+        const uint64_t *buckets;
+    };
+    const Metric metrics[] = {
+        {"dispatch_gap", dispatch_gap},
+        {"queue_wait", queue_wait},
+        {"kernel_cycles", kernel_cycles},
+    };
+
+    LOG_INFO("=== Cycle Histogram Summary (%" PRIu64 " tasks, %d cores) ===", total_tasks, num_aicore_);
+    for (const Metric &m : metrics) {
+        uint64_t count = 0;
+        int max_bucket = 0;
+        for (int b = 0; b < PERF_HIST_BUCKETS; b++) {
+            count += m.buckets[b];
+            if (m.buckets[b] != 0) {
+                max_bucket = b;
+            }
+        }
+        if (count == 0) {
+            continue;
+        }
+        // Percentile = smallest bucket whose cumulative count reaches the rank;
+        // the reported value is that bucket's upper bound (2^b cycles).
+        uint64_t cum = 0;
+        int p50_bucket = 0;
+        int p99_bucket = 0;
+        for (int b = 0; b < PERF_HIST_BUCKETS; b++) {
+            cum += m.buckets[b];
+            if (p50_bucket == 0 && cum * 2 >= count) {
+                p50_bucket = b;
+            }
+            if (p99_bucket == 0 && cum * 100 >= count * 99) {
+                p99_bucket = b;
+                break;
+            }
+        }
+        LOG_INFO(
+            "  %-13s samples=%" PRIu64 " p50<%" PRIu64 " p99<%" PRIu64 " max<%" PRIu64 " cycles", m.name, count,
+            uint64_t(1) << p50_bucket, uint64_t(1) << p99_bucket, uint64_t(1) << max_bucket
+        );
+    }
+}
+
 int PerformanceCollector::finalize(PerfUnregisterCallback unregister_cb, PerfFreeCallback free_cb) {
     if (perf_shared_mem_host_ == nullptr) {
         return 0;
@@ -1465,6 +2022,8 @@ int PerformanceCollector::finalize(PerfUnregisterCallback unregister_cb, PerfFre
     // Stop memory manager if still running
     stop_memory_manager();
 
+    report_cycle_histograms(get_perf_header(perf_shared_mem_host_));
+
     LOG_DEBUG("Cleaning up performance profiling resources");
 
     // Free initial buffers that are still in the slot arrays
@@ -1538,6 +2097,14 @@ int PerformanceCollector::finalize(PerfUnregisterCallback unregister_cb, PerfFre
         LOG_DEBUG("Shared memory freed");
     }
 
+    // Finalize the streaming sink (writes the index footer) if still open
+    if (record_stream_ != nullptr) {
+        record_stream_->finalize();
+        record_stream_.reset();
+    }
+    stream_scratch_.clear();
+    stream_loaded_ = false;
+
     perf_shared_mem_dev_ = nullptr;
     perf_shared_mem_host_ = nullptr;
     was_registered_ = false;
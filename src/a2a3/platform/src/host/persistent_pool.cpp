@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Persistent tensor pool (platform independent)
+ *
+ * Implements the persistent_pool_* functions of the C API on top of one
+ * device_malloc_ctx() region. Persistent tensors (KV caches and other
+ * long-lived residents) sit here instead of inside the ring-managed heap,
+ * so the heap window is sized for transient traffic only.
+ *
+ * Bookkeeping lives entirely on the host: a first-fit free list keyed by
+ * offset into the device region, with eager coalescing of adjacent spans
+ * on free. Tensors are never moved — a device pointer handed out by
+ * persistent_pool_alloc_ctx() stays valid until the matching free — so
+ * persistent_pool_compact_ctx() can only merge free neighbours, not
+ * defragment across a live block.
+ */
+
+#include "pto_runtime_c_api.h"
+
+#include <map>
+#include <mutex>
+#include <new>
+
+#include "common/unified_log.h"
+
+namespace {
+
+// Device-side tensors want cacheline/DMA-friendly bases; 512 matches the
+// alignment the driver allocator already guarantees for whole regions.
+constexpr size_t POOL_ALIGNMENT = 512;
+
+struct PersistentPool {
+    void *base = nullptr;
+    size_t size = 0;
+    std::mutex mu;
+    std::map<uint64_t, size_t> free_spans;  // offset -> bytes, coalesced on free
+    std::map<uint64_t, size_t> live_spans;  // offset -> bytes
+};
+
+}  // namespace
+
+extern "C" {
+
+PersistentPoolHandle persistent_pool_create_ctx(DeviceContextHandle ctx, size_t size) {
+    if (ctx == NULL || size == 0) return NULL;
+    void *base = device_malloc_ctx(ctx, size);
+    if (base == NULL) {
+        LOG_ERROR("persistent_pool_create_ctx: device_malloc_ctx(%zu) failed", size);
+        return NULL;
+    }
+    PersistentPool *pool = new (std::nothrow) PersistentPool();
+    if (pool == nullptr) {
+        device_free_ctx(ctx, base);
+        return NULL;
+    }
+    pool->base = base;
+    pool->size = size;
+    pool->free_spans.emplace(0, size);
+    return static_cast<PersistentPoolHandle>(pool);
+}
+
+void persistent_pool_destroy_ctx(DeviceContextHandle ctx, PersistentPoolHandle pool) {
+    if (pool == NULL) return;
+    PersistentPool *p = static_cast<PersistentPool *>(pool);
+    if (!p->live_spans.empty()) {
+        LOG_WARN("persistent_pool_destroy_ctx: %zu tensor(s) still allocated", p->live_spans.size());
+    }
+    device_free_ctx(ctx, p->base);
+    delete p;
+}
+
+void *persistent_pool_alloc_ctx(PersistentPoolHandle pool, size_t size) {
+    if (pool == NULL || size == 0) return NULL;
+    PersistentPool *p = static_cast<PersistentPool *>(pool);
+    size_t span = (size + POOL_ALIGNMENT - 1) & ~(POOL_ALIGNMENT - 1);
+
+    std::lock_guard<std::mutex> lk(p->mu);
+    for (auto it = p->free_spans.begin(); it != p->free_spans.end(); ++it) {
+        if (it->second < span) continue;
+        uint64_t off = it->first;
+        size_t remain = it->second - span;
+        p->free_spans.erase(it);
+        if (remain > 0) {
+            p->free_spans.emplace(off + span, remain);
+        }
+        p->live_spans.emplace(off, span);
+        return static_cast<uint8_t *>(p->base) + off;
+    }
+    LOG_ERROR("persistent_pool_alloc_ctx: no free span >= %zu bytes (pool size %zu)", span, p->size);
+    return NULL;
+}
+
+void persistent_pool_free_ctx(PersistentPoolHandle pool, void *dev_ptr) {
+    if (pool == NULL || dev_ptr == NULL) return;
+    PersistentPool *p = static_cast<PersistentPool *>(pool);
+
+    std::lock_guard<std::mutex> lk(p->mu);
+    uint64_t off = static_cast<uint64_t>(static_cast<uint8_t *>(dev_ptr) - static_cast<uint8_t *>(p->base));
+    auto live = p->live_spans.find(off);
+    if (live == p->live_spans.end()) {
+        LOG_ERROR("persistent_pool_free_ctx: %p is not a live pool tensor", dev_ptr);
+        return;
+    }
+    size_t span = live->second;
+    p->live_spans.erase(live);
+
+    // Insert, then merge with the right and left neighbours if adjacent.
+    auto it = p->free_spans.emplace(off, span).first;
+    auto next = std::next(it);
+    if (next != p->free_spans.end() && it->first + it->second == next->first) {
+        it->second += next->second;
+        p->free_spans.erase(next);
+    }
+    if (it != p->free_spans.begin()) {
+        auto prev = std::prev(it);
+        if (prev->first + prev->second == it->first) {
+            prev->second += it->second;
+            p->free_spans.erase(it);
+        }
+    }
+}
+
+size_t persistent_pool_compact_ctx(PersistentPoolHandle pool) {
+    if (pool == NULL) return 0;
+    PersistentPool *p = static_cast<PersistentPool *>(pool);
+
+    std::lock_guard<std::mutex> lk(p->mu);
+    // free() coalesces eagerly, so this pass normally finds nothing to
+    // merge; it is kept as a defensive sweep before reporting the answer.
+    for (auto it = p->free_spans.begin(); it != p->free_spans.end();) {
+        auto next = std::next(it);
+        if (next != p->free_spans.end() && it->first + it->second == next->first) {
+            it->second += next->second;
+            p->free_spans.erase(next);
+        } else {
+            it = next;
+        }
+    }
+    size_t largest = 0;
+    for (const auto &fs : p->free_spans) {
+        if (fs.second > largest) largest = fs.second;
+    }
+    return largest;
+}
+
+}  // extern "C"
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstring>
 #include <filesystem>
 #include <fstream>
@@ -431,6 +432,13 @@ void TensorDumpCollector::process_dump_buffer(const DumpReadyBufferInfo &info) {
         dt.is_contiguous = (rec.is_contiguous != 0);
         dt.truncated = (rec.truncated != 0);
         dt.overwritten = false;
+        dt.filter_mode = rec.filter_mode;
+        dt.payload_dtype = rec.payload_dtype;
+        dt.row_stride = rec.row_stride;
+        dt.content_hash = rec.content_hash;
+        dt.dedup_ref = (rec.dedup_ref != 0);
+        dt.has_summary = false;
+        dt.summary = {};
         if (dt.truncated && ++total_truncated_count_ == 1) {
             LOG_WARN("Tensor dump truncation detected. Increase PLATFORM_DUMP_AVG_TENSOR_BYTES.");
         }
@@ -479,12 +487,63 @@ void TensorDumpCollector::process_dump_buffer(const DumpReadyBufferInfo &info) {
             }
         }
 
+        // Summary-only payloads are decoded in place instead of hitting the bin file
+        if (static_cast<TensorDumpFilterMode>(dt.filter_mode) == TensorDumpFilterMode::SUMMARY && !dt.overwritten &&
+            dt.bytes.size() == sizeof(TensorDumpSummary)) {
+            memcpy(&dt.summary, dt.bytes.data(), sizeof(TensorDumpSummary));
+            dt.has_summary = true;
+            dt.bytes.clear();
+            total_summary_count_++;
+            if (dt.summary.nan_count > 0 && ++total_nan_summary_count_ == 1) {
+                LOG_WARN(
+                    "Tensor dump summary reports NaN: task 0x%lx func %u arg %u (%u NaN of %lu elements)", dt.task_id,
+                    dt.func_id, dt.arg_index, dt.summary.nan_count, dt.summary.elements
+                );
+            }
+        }
+
         dt.payload_size = dt.bytes.size();
 
         bool has_payload = !dt.overwritten && !dt.bytes.empty();
-        dt.bin_offset = has_payload ? next_bin_offset_ : 0;
+        bool resolved_dedup = false;
+        if (dt.dedup_ref) {
+            // Device skipped the copy: point at the bytes shipped for this hash earlier
+            auto it = dedup_payloads_.find(dt.content_hash);
+            if (it != dedup_payloads_.end() && it->second.payload_dtype == dt.payload_dtype) {
+                dt.bin_offset = it->second.bin_offset;
+                dt.payload_size = it->second.payload_size;
+                resolved_dedup = true;
+                total_dedup_count_++;
+                dedup_saved_bytes_ += it->second.payload_size;
+            } else if (++dedup_unresolved_ == 1) {
+                LOG_WARN(
+                    "Tensor dump dedup record has no stored payload for hash 0x%lx (task 0x%lx func %u arg %u)",
+                    dt.content_hash, dt.task_id, dt.func_id, dt.arg_index
+                );
+            }
+        } else if (has_payload && dt.content_hash != 0 && !dt.truncated) {
+            // Cross-thread / cross-dump-point repeat the device cache missed
+            auto it = dedup_payloads_.find(dt.content_hash);
+            if (it != dedup_payloads_.end() && it->second.payload_size == dt.payload_size &&
+                it->second.payload_dtype == dt.payload_dtype) {
+                dt.dedup_ref = true;
+                dt.bin_offset = it->second.bin_offset;
+                dt.bytes.clear();
+                has_payload = false;
+                resolved_dedup = true;
+                total_dedup_count_++;
+                dedup_saved_bytes_ += dt.payload_size;
+            }
+        }
+
+        if (!resolved_dedup) {
+            dt.bin_offset = has_payload ? next_bin_offset_ : 0;
+        }
         if (has_payload) {
             next_bin_offset_ += dt.payload_size;
+            if (dt.content_hash != 0 && !dt.truncated) {
+                dedup_payloads_[dt.content_hash] = {dt.bin_offset, dt.payload_size, dt.payload_dtype};
+            }
         }
 
         // Store metadata-only copy in collected_ (no payload bytes)
@@ -518,6 +577,30 @@ static const char *tensor_dump_role_name(TensorDumpRole role) {
     return "unknown";
 }
 
+static const char *tensor_dump_filter_name(TensorDumpFilterMode mode) {
+    switch (mode) {
+    case TensorDumpFilterMode::FULL:
+        return "full";
+    case TensorDumpFilterMode::ROW_STRIDE:
+        return "row_stride";
+    case TensorDumpFilterMode::BOUNDING_BOX:
+        return "bounding_box";
+    case TensorDumpFilterMode::SUMMARY:
+        return "summary";
+    }
+    return "unknown";
+}
+
+// JSON has no Inf literal, so non-finite summary values are emitted as strings
+static std::string json_float(float value) {
+    if (!std::isfinite(value)) {
+        return std::string("\"") + (value > 0 ? "inf" : (value < 0 ? "-inf" : "nan")) + "\"";
+    }
+    std::ostringstream ss;
+    ss << value;
+    return ss.str();
+}
+
 static const char *tensor_dump_stage_name(TensorDumpStage stage) {
     switch (stage) {
     case TensorDumpStage::BEFORE_DISPATCH:
@@ -650,6 +733,15 @@ void TensorDumpCollector::poll_and_collect() {
 
 void TensorDumpCollector::signal_execution_complete() { execution_complete_.store(true); }
 
+void TensorDumpCollector::set_user_trigger_flag(bool armed) {
+    if (dump_shared_mem_host_ == nullptr) {
+        return;
+    }
+    DumpDataHeader *header = get_dump_header(dump_shared_mem_host_);
+    header->user_trigger_flag = armed ? 1 : 0;
+    wmb();
+}
+
 void TensorDumpCollector::stop_memory_manager() { memory_manager_.stop(); }
 
 void TensorDumpCollector::drain_remaining_buffers() {
@@ -670,6 +762,27 @@ void TensorDumpCollector::scan_remaining_dump_buffers() {
         total_dropped_record_count_ += state->dropped_record_count;
         dropped_total += state->dropped_record_count;
 
+        // Merge this thread's per-dump-point drop attribution
+        DumpDropStats *drop_stats = get_dump_drop_stats(dump_shared_mem_host_, num_dump_threads_, t);
+        for (int i = 0; i < PLATFORM_DUMP_DROP_STATS_ENTRIES; i++) {
+            const DumpDropStatEntry &entry = drop_stats->entries[i];
+            if (entry.dropped == 0) {
+                continue;
+            }
+            bool merged = false;
+            for (auto &point : dropped_by_point_) {
+                if (point.func_id == entry.func_id && point.arg_index == entry.arg_index) {
+                    point.dropped += entry.dropped;
+                    merged = true;
+                    break;
+                }
+            }
+            if (!merged) {
+                dropped_by_point_.push_back({entry.func_id, entry.arg_index, entry.dropped});
+            }
+        }
+        dropped_unattributed_ += drop_stats->overflow_dropped;
+
         uint64_t cur_ptr = state->current_buf_ptr;
         if (cur_ptr == 0) {
             continue;
@@ -691,9 +804,21 @@ void TensorDumpCollector::scan_remaining_dump_buffers() {
     if (dropped_total > 0) {
         LOG_WARN(
             "Dump collector: %u records dropped on device side. "
-            "Increase PLATFORM_DUMP_BUFFERS_PER_THREAD or PLATFORM_DUMP_READYQUEUE_SIZE.",
+            "Raise PTO2_DUMP_MAX_INFLIGHT or PLATFORM_DUMP_BUFFERS_PER_THREAD.",
             dropped_total
         );
+        for (const auto &point : dropped_by_point_) {
+            LOG_WARN(
+                "Dump collector: dropped %lu record(s) for func %u arg %u", point.dropped, point.func_id,
+                point.arg_index
+            );
+        }
+        if (dropped_unattributed_ > 0) {
+            LOG_WARN(
+                "Dump collector: %lu dropped record(s) unattributed (more than %d distinct dump points per thread)",
+                dropped_unattributed_, PLATFORM_DUMP_DROP_STATS_ENTRIES
+            );
+        }
     }
 }
 
@@ -792,8 +917,20 @@ int TensorDumpCollector::export_dump_files(const std::string & /*output_path*/)
     json << "  \"output_tensors\": " << num_output_tensors << ",\n";
     json << "  \"inout_tensors\": " << num_inout_tensors << ",\n";
     json << "  \"truncated_tensors\": " << total_truncated_count_ << ",\n";
+    json << "  \"summary_tensors\": " << total_summary_count_ << ",\n";
+    json << "  \"nan_summaries\": " << total_nan_summary_count_ << ",\n";
+    json << "  \"dedup_tensors\": " << total_dedup_count_ << ",\n";
+    json << "  \"dedup_saved_bytes\": " << dedup_saved_bytes_ << ",\n";
     json << "  \"dropped_records\": " << total_dropped_record_count_ << ",\n";
     json << "  \"dropped_overwrite\": " << total_overwrite_count_ << ",\n";
+    json << "  \"dropped_unattributed\": " << dropped_unattributed_ << ",\n";
+    json << "  \"dropped_by_dump_point\": [";
+    for (size_t i = 0; i < dropped_by_point_.size(); i++) {
+        if (i > 0) json << ", ";
+        json << "{\"func_id\": " << dropped_by_point_[i].func_id << ", \"arg_index\": " << dropped_by_point_[i].arg_index
+             << ", \"dropped\": " << dropped_by_point_[i].dropped << "}";
+    }
+    json << "],\n";
     json << "  \"bin_file\": \"" << base_name << ".bin\",\n";
     json << "  \"tensors\": [\n";
 
@@ -811,14 +948,34 @@ int TensorDumpCollector::export_dump_files(const std::string & /*output_path*/)
         if (!first_entry) json << ",\n";
         first_entry = false;
 
+        TensorDumpFilterMode filter_mode = static_cast<TensorDumpFilterMode>(dt.filter_mode);
+
         json << "    {\"task_id\": \"0x" << std::hex << std::setfill('0') << std::setw(16) << dt.task_id << std::dec
              << "\", \"subtask_id\": " << static_cast<uint32_t>(dt.subtask_id) << ", \"func_id\": " << dt.func_id
              << ", \"role\": \"" << tensor_dump_role_name(dt.role) << "\", \"stage\": \""
              << tensor_dump_stage_name(dt.stage) << "\", \"arg_index\": " << dt.arg_index << ", \"dtype\": \""
              << dtype_name << "\", \"is_contiguous\": " << (dt.is_contiguous ? "true" : "false")
              << ", \"shape\": " << shape_str << ", \"raw_shape\": " << raw_shape_str << ", \"offsets\": " << offsets_str
-             << ", \"numel\": " << numel << ", \"bin_offset\": " << dt.bin_offset
-             << ", \"bin_size\": " << dt.payload_size << ", \"truncated\": " << (dt.truncated ? "true" : "false")
+             << ", \"numel\": " << numel << ", \"filter\": \"" << tensor_dump_filter_name(filter_mode) << "\"";
+        if (dt.payload_dtype != dt.dtype) {
+            json << ", \"payload_dtype\": \"" << get_dtype_name_from_raw(dt.payload_dtype) << "\"";
+        }
+        if (filter_mode == TensorDumpFilterMode::ROW_STRIDE) {
+            json << ", \"row_stride\": " << dt.row_stride;
+        }
+        if (dt.has_summary) {
+            json << ", \"summary\": {\"min\": " << json_float(dt.summary.min_val)
+                 << ", \"max\": " << json_float(dt.summary.max_val) << ", \"mean\": " << json_float(dt.summary.mean)
+                 << ", \"nan_count\": " << dt.summary.nan_count << ", \"elements\": " << dt.summary.elements << "}";
+        }
+        if (dt.content_hash != 0) {
+            json << ", \"content_hash\": \"0x" << std::hex << dt.content_hash << std::dec << "\"";
+        }
+        if (dt.dedup_ref) {
+            json << ", \"dedup\": true";
+        }
+        json << ", \"bin_offset\": " << dt.bin_offset << ", \"bin_size\": " << dt.payload_size
+             << ", \"truncated\": " << (dt.truncated ? "true" : "false")
              << ", \"overwritten\": " << (dt.overwritten ? "true" : "false") << "}";
     }
 
@@ -842,6 +999,14 @@ int TensorDumpCollector::export_dump_files(const std::string & /*output_path*/)
     total_dropped_record_count_ = 0;
     total_truncated_count_ = 0;
     total_overwrite_count_ = 0;
+    total_summary_count_ = 0;
+    total_nan_summary_count_ = 0;
+    dropped_by_point_.clear();
+    dropped_unattributed_ = 0;
+    dedup_payloads_.clear();
+    total_dedup_count_ = 0;
+    dedup_saved_bytes_ = 0;
+    dedup_unresolved_ = 0;
     for (auto &ai : arenas_) {
         ai.high_water = 0;
     }
@@ -952,6 +1117,14 @@ int TensorDumpCollector::finalize(DumpUnregisterCallback unregister_cb, DumpFree
     total_dropped_record_count_ = 0;
     total_truncated_count_ = 0;
     total_overwrite_count_ = 0;
+    total_summary_count_ = 0;
+    total_nan_summary_count_ = 0;
+    dropped_by_point_.clear();
+    dropped_unattributed_ = 0;
+    dedup_payloads_.clear();
+    total_dedup_count_ = 0;
+    dedup_saved_bytes_ = 0;
+    dedup_unresolved_ = 0;
 
     return 0;
 }
@@ -71,3 +71,7 @@ void unified_log_always(const char *func, const char *fmt, ...) {
     va_end(args);
     HostLogger::get_instance().log(HostLogLevel::ALWAYS, "%s: %s", func, buffer);
 }
+
+// Host logging always formats eagerly; only the device implementation
+// captures binary records, so there is nothing to drain here.
+void unified_log_flush_binary(void) {}
@@ -115,6 +115,18 @@ __aicore__ __attribute__((weak)) void aicore_execute(__gm__ Runtime *runtime, in
 
             write_reg(RegId::COND, MAKE_ACK_VALUE(task_id));
 
+            // Clear any stale phase-marker count in the WIP slot before the
+            // kernel runs: record_task flushes the phase lines uncondition-
+            // ally, and this runtime does not expose the marker API to
+            // kernels, so the committed record must carry a count of 0.
+            __gm__ PerfBuffer *perf_buf = nullptr;
+            if (profiling_enabled) {
+                perf_buf = (__gm__ PerfBuffer *)my_hank->perf_records_addr;
+                if (perf_buf != nullptr) {
+                    perf_buf->wip[task_id & 1u].phase_count = 0;
+                }
+            }
+
             // Performance profiling: record start time
             uint64_t start_time = get_sys_cnt_aicore();
 
@@ -129,7 +141,6 @@ __aicore__ __attribute__((weak)) void aicore_execute(__gm__ Runtime *runtime, in
             // (func_id and core_type are filled by AICPU at completion time)
             if (profiling_enabled) {
                 uint64_t end_time = get_sys_cnt_aicore();
-                __gm__ PerfBuffer *perf_buf = (__gm__ PerfBuffer *)my_hank->perf_records_addr;
                 perf_aicore_record_task(perf_buf, task_id, start_time, end_time);
             }
 
@@ -30,6 +30,7 @@
 #include "spin_hint.h"
 
 // Runtime headers (full struct definition for create/destroy + PTO2_SCOPE)
+#include "pto_request_ring.h"
 #include "pto_runtime2.h"
 #include "pto_runtime2_types.h"
 #include "pto_shared_memory.h"
@@ -170,6 +171,9 @@ struct CoreStateTracker {
 struct AicpuExecutor {
     int32_t sched_thread_num_;
     bool orch_to_sched_{false};
+    // Persistent orchestration: orchestrator thread serves the host request
+    // ring instead of running the orchestration entry once (PTO2_PERSISTENT_ORCH).
+    bool persistent_orch_{false};
 
     // ===== Thread management state =====
     std::atomic<int32_t> thread_idx_{0};
@@ -260,6 +264,7 @@ struct AicpuExecutor {
     void assign_cores_to_threads();
     void reassign_cores_for_all_threads();
     int32_t resolve_and_dispatch_pto2(Runtime *runtime, int32_t thread_idx);
+    void serve_persistent_requests(Runtime *runtime, int32_t thread_idx);
     int32_t shutdown_aicore(Runtime *runtime, int32_t thread_idx, const int32_t *cur_thread_cores, int32_t core_num);
     int32_t run(Runtime *runtime);
     void deinit(Runtime *runtime);
@@ -385,7 +390,7 @@ struct AicpuExecutor {
 
                     int32_t perf_slot_idx = static_cast<int32_t>(executing_subslot_by_core_[core_id]);
                     if (perf_aicpu_complete_record(
-                            perf_buf, static_cast<uint32_t>(expected_reg_task_id), slot_state.task->task_id.raw,
+                            perf_buf, core_id, static_cast<uint32_t>(expected_reg_task_id), slot_state.task->task_id.raw,
                             slot_state.task->kernel_id[perf_slot_idx], CT, dispatch_timestamps_[core_id], finish_ts,
                             fanout_arr, fanout_n
                         ) != 0) {
@@ -815,6 +820,11 @@ int32_t AicpuExecutor::init(Runtime *runtime) {
     if (thread_num_ == 0) thread_num_ = 1;
     sched_thread_num_ = thread_num_ - 1;
     orch_to_sched_ = runtime->orch_to_sched;
+    persistent_orch_ = runtime->persistent_orch;
+    if (persistent_orch_ && orch_to_sched_) {
+        DEV_WARN("Persistent orchestration keeps the orchestrator resident; disabling orch_to_sched");
+        orch_to_sched_ = false;
+    }
 
     if (thread_num_ < 1 || thread_num_ > MAX_AICPU_THREADS) {
         DEV_ERROR("Invalid thread_num: %d", thread_num_);
@@ -1030,9 +1040,12 @@ int32_t AicpuExecutor::resolve_and_dispatch_pto2(Runtime *runtime, int32_t threa
                     break;
                 }
 
-                // Normal exit: all tasks complete
+                // Normal exit: all tasks complete. Persistent orchestration publishes
+                // orchestrator_done_ only after the serving loop exits, and may
+                // legitimately stop with zero tasks (no request ever served).
                 task_count = total_tasks_;
-                if (task_count > 0 && completed_tasks_.load(std::memory_order_relaxed) >= task_count) {
+                if ((task_count > 0 || persistent_orch_) &&
+                    completed_tasks_.load(std::memory_order_relaxed) >= task_count) {
                     completed_.store(true, std::memory_order_release);
                     DEV_INFO(
                         "Thread %d: PTO2 completed tasks %d/%d", thread_idx,
@@ -1492,8 +1505,15 @@ int32_t AicpuExecutor::resolve_and_dispatch_pto2(Runtime *runtime, int32_t threa
                 }
             }
             if (idle_iterations > MAX_IDLE_ITERATIONS) {
-                DEV_ERROR("Thread %d: PTO2 timeout after %d idle iterations", thread_idx, idle_iterations);
-                return -1;
+                if (persistent_orch_ && !orchestrator_done_) {
+                    // Persistent serving: the gap until the host's next request is
+                    // unbounded, so the idle timeout only arms once the serving loop
+                    // has exited and published the final totals.
+                    idle_iterations = 0;
+                } else {
+                    DEV_ERROR("Thread %d: PTO2 timeout after %d idle iterations", thread_idx, idle_iterations);
+                    return -1;
+                }
             } else {
                 SPIN_WAIT_HINT();
             }
@@ -1659,6 +1679,110 @@ int32_t AicpuExecutor::resolve_and_dispatch_pto2(Runtime *runtime, int32_t threa
     return cur_thread_completed;
 }
 
+/**
+ * Persistent orchestration serving loop (PTO2_PERSISTENT_ORCH).
+ *
+ * Runs on the orchestrator thread after the orchestration SO is loaded and the
+ * PTO2 runtime is created. Blocks on the host-written request ring, runs the
+ * orchestration entry once per slot, and handles the inter-request drain
+ * device-side: a request's tail bump is withheld until every task it submitted
+ * has completed, so slot reuse and host-visible completion both imply a fully
+ * drained graph. The host is off the per-request critical path except for the
+ * ring write.
+ *
+ * orchestrator_done_ stays false while serving; scheduler threads keep polling
+ * their ready queues across requests and only exit through the normal
+ * completion path after this loop returns and run() publishes the final
+ * totals. Ring task counters are cumulative across requests, so per-request
+ * totals compare directly against the cumulative completed_tasks_.
+ */
+void AicpuExecutor::serve_persistent_requests(Runtime *runtime, int32_t thread_idx) {
+    PTO2RequestRing *ring = static_cast<PTO2RequestRing *>(runtime->get_pto2_request_ring_ptr());
+    if (ring == nullptr) {
+        DEV_ERROR("Thread %d: persistent orchestration enabled but request ring is null", thread_idx);
+        return;
+    }
+    PTO2SharedMemoryHeader *sm_header = static_cast<PTO2SharedMemoryHeader *>(runtime->get_pto2_gm_sm_ptr());
+
+    // Host DMA writes bypass the AICPU data cache: invalidate the control line
+    // before every read of host-owned fields (magic/stop/head). DC CIVAC cleans
+    // dirty lines first, so this doubles as the writeback publishing our tail.
+    cache_invalidate_range(ring, offsetof(PTO2RequestRing, slots));
+    if (ring->magic != PTO2_REQUEST_RING_MAGIC) {
+        DEV_ERROR("Thread %d: request ring magic mismatch (0x%x)", thread_idx, ring->magic);
+        return;
+    }
+
+    uint64_t next = ring->tail;
+    int64_t served = 0;
+    DEV_ALWAYS("Thread %d: persistent orchestration serving from seq %" PRIu64, thread_idx, next);
+
+    while (true) {
+        bool fatal = false;
+
+        // Block on the request ring until the host publishes a slot or stops
+        while (true) {
+            cache_invalidate_range(ring, offsetof(PTO2RequestRing, slots));
+            if (ring->head != next || ring->stop != 0) break;
+            if (sm_header->orch_error_code.load(std::memory_order_acquire) != PTO2_ERROR_NONE ||
+                completed_.load(std::memory_order_acquire)) {
+                fatal = true;
+                break;
+            }
+            SPIN_WAIT_HINT();
+        }
+        if (fatal) {
+            DEV_ERROR("Thread %d: fatal error while waiting for requests, stopping", thread_idx);
+            break;
+        }
+        if (ring->head == next) {
+            // stop was set and every published request has drained
+            DEV_ALWAYS("Thread %d: stop requested after %" PRId64 " request(s)", thread_idx, served);
+            break;
+        }
+
+        PTO2RequestSlot *slot = &ring->slots[next % PTO2_REQUEST_RING_DEPTH];
+        cache_invalidate_range(slot, sizeof(*slot));
+
+        PTO2_SCOPE(rt) { orch_func_(rt, slot->args); }
+
+        int32_t submitted = 0;
+        for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+            submitted += sm_header->rings[r].fc.current_task_index.load(std::memory_order_acquire);
+        }
+        total_tasks_ = submitted;
+#if PTO2_PROFILING
+        if (runtime->enable_profiling && submitted > 0) {
+            perf_aicpu_update_total_tasks(runtime, static_cast<uint32_t>(submitted));
+        }
+#endif
+
+        // Device-side drain: the next request may only reuse ring/heap space
+        // (and the host may only observe completion) once this graph is done.
+        while (completed_tasks_.load(std::memory_order_relaxed) < submitted) {
+            if (sm_header->orch_error_code.load(std::memory_order_acquire) != PTO2_ERROR_NONE ||
+                completed_.load(std::memory_order_acquire)) {
+                fatal = true;
+                break;
+            }
+            SPIN_WAIT_HINT();
+        }
+        if (fatal) {
+            DEV_ERROR("Thread %d: fatal error draining request %" PRIu64 ", stopping", thread_idx, next);
+            break;
+        }
+
+        served++;
+        next++;
+        OUT_OF_ORDER_STORE_BARRIER();
+        ring->tail = next;
+        cache_invalidate_range(ring, offsetof(PTO2RequestRing, slots));
+        DEV_INFO("Thread %d: request %" PRIu64 " drained (%d tasks cumulative)", thread_idx, next - 1, submitted);
+    }
+
+    DEV_ALWAYS("Thread %d: persistent orchestration served %" PRId64 " request(s)", thread_idx, served);
+}
+
 int32_t AicpuExecutor::run(Runtime *runtime) {
     int32_t thread_idx = thread_idx_++;
 
@@ -1843,12 +1967,18 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
             }
 #endif
 
-            // Call orchestration function wrapped in an outer scope
+            // Call orchestration function wrapped in an outer scope. Persistent
+            // mode instead serves the request ring, one scope per request; the
+            // epilogue below then publishes the final (cumulative) totals.
             DEV_ALWAYS("Thread %d: Calling aicpu_orchestration_entry from SO", thread_idx);
 #if PTO2_PROFILING
             uint64_t orch_cycle_start = get_sys_cnt_aicpu();
 #endif
-            PTO2_SCOPE(rt) { orch_func_(rt, *orch_args_cached_); }
+            if (persistent_orch_) {
+                serve_persistent_requests(runtime, thread_idx);
+            } else {
+                PTO2_SCOPE(rt) { orch_func_(rt, *orch_args_cached_); }
+            }
 #if PTO2_PROFILING
             uint64_t orch_cycle_end = get_sys_cnt_aicpu();
             DEV_ALWAYS(
@@ -2098,6 +2228,7 @@ void AicpuExecutor::deinit(Runtime *runtime) {
     sched_thread_num_ = 0;
     thread_cores_num_ = 0;
     orch_to_sched_ = false;
+    persistent_orch_ = false;
     memset(trackers_, 0, sizeof(trackers_));
     memset(core_idle_, 0, sizeof(core_idle_));
     memset(core_assignments_, 0, sizeof(core_assignments_));
@@ -35,11 +35,13 @@
 #include <cstdlib>
 #include <cstring>
 
+#include "../runtime/pto_request_ring.h"
 #include "../runtime/pto_shared_memory.h"
 #include "../runtime/runtime.h"
 #include "callable.h"
 #include "common/platform_config.h"
 #include "common/unified_log.h"
+#include "pto_runtime_c_api.h"
 
 // Helper: return current time in milliseconds
 static int64_t _now_ms() {
@@ -217,6 +219,19 @@ extern "C" int init_runtime_impl(Runtime *runtime, const ChipCallable *callable,
         LOG_INFO("Orchestrator-to-scheduler transition: %s", runtime->orch_to_sched ? "enabled" : "disabled");
     }
 
+    // Read persistent orchestration flag from environment
+    {
+        const char *env_val = std::getenv("PTO2_PERSISTENT_ORCH");
+        if (env_val && (env_val[0] == '1' || env_val[0] == 't' || env_val[0] == 'T')) {
+            runtime->persistent_orch = true;
+            if (runtime->orch_to_sched) {
+                LOG_WARN("PTO2_PERSISTENT_ORCH overrides PTO2_ORCH_TO_SCHED; orchestrator stays resident");
+                runtime->orch_to_sched = false;
+            }
+        }
+        LOG_INFO("Persistent orchestration: %s", runtime->persistent_orch ? "enabled" : "disabled");
+    }
+
     // Read ring buffer size overrides from environment
     {
         runtime->pto2_task_window_size = parse_env_uint64("PTO2_RING_TASK_WINDOW", 4, true);
@@ -265,6 +280,32 @@ extern "C" int init_runtime_impl(Runtime *runtime, const ChipCallable *callable,
     runtime->set_pto2_gm_sm_ptr(sm_ptr);
     runtime->record_tensor_pair(nullptr, sm_ptr, static_cast<size_t>(sm_size));
 
+    // Allocate and initialize the request ring for persistent orchestration
+    if (runtime->persistent_orch) {
+        void *ring_dev = runtime->host_api.device_malloc(sizeof(PTO2RequestRing));
+        if (ring_dev == nullptr) {
+            LOG_ERROR("Failed to allocate PTO2 request ring");
+            return -1;
+        }
+        PTO2RequestRing *ring_init = static_cast<PTO2RequestRing *>(calloc(1, sizeof(PTO2RequestRing)));
+        if (ring_init == nullptr) {
+            LOG_ERROR("Failed to allocate request ring init buffer");
+            runtime->host_api.device_free(ring_dev);
+            return -1;
+        }
+        ring_init->magic = PTO2_REQUEST_RING_MAGIC;
+        rc = runtime->host_api.copy_to_device(ring_dev, ring_init, sizeof(PTO2RequestRing));
+        free(ring_init);
+        if (rc != 0) {
+            LOG_ERROR("Failed to initialize PTO2 request ring on device");
+            runtime->host_api.device_free(ring_dev);
+            return -1;
+        }
+        runtime->record_tensor_pair(nullptr, ring_dev, sizeof(PTO2RequestRing));
+        runtime->set_pto2_request_ring_ptr(ring_dev);
+        LOG_INFO("Request ring: %zu bytes, depth=%d", sizeof(PTO2RequestRing), PTO2_REQUEST_RING_DEPTH);
+    }
+
     // Set up device orchestration state
     runtime->set_orch_built_on_host(false);
     runtime->set_orch_args(device_args);
@@ -281,6 +322,107 @@ extern "C" int init_runtime_impl(Runtime *runtime, const ChipCallable *callable,
     return 0;
 }
 
+// =============================================================================
+// Persistent orchestration host API
+// =============================================================================
+//
+// With PTO2_PERSISTENT_ORCH the device orchestration loop stays resident and
+// serves requests from the GM request ring. The host-side per-request path is
+// a slot write plus a head bump (two DMA writes); completion is observed by
+// polling tail. All three helpers are no-ops returning -1 when persistent
+// orchestration was not enabled at init time.
+
+/** Read the ring control line (magic/stop/head/tail) from device memory. */
+static int read_request_ring_control(Runtime *runtime, void *ring_dev, PTO2RequestRing *out) {
+    return runtime->host_api.copy_from_device(out, ring_dev, offsetof(PTO2RequestRing, slots));
+}
+
+/**
+ * Enqueue one orchestration request.
+ *
+ * @param runtime  Runtime with an initialized request ring
+ * @param args     Per-request orchestration args (device tensor pointers)
+ * @return Sequence number (>= 0) to pass to pto2_request_ring_wait,
+ *         or -1 on error / ring full (caller may retry after a wait)
+ */
+extern "C" int64_t pto2_request_ring_submit(Runtime *runtime, const ChipStorageTaskArgs *args) {
+    if (runtime == nullptr || args == nullptr) return -1;
+    void *ring_dev = runtime->get_pto2_request_ring_ptr();
+    if (ring_dev == nullptr) {
+        LOG_ERROR("Request ring not initialized (PTO2_PERSISTENT_ORCH disabled?)");
+        return -1;
+    }
+
+    PTO2RequestRing ctrl;
+    if (read_request_ring_control(runtime, ring_dev, &ctrl) != 0) {
+        LOG_ERROR("Failed to read request ring control");
+        return -1;
+    }
+    if (ctrl.magic != PTO2_REQUEST_RING_MAGIC || ctrl.stop != 0) {
+        LOG_ERROR("Request ring invalid or stopped (magic=0x%x, stop=%u)", ctrl.magic, ctrl.stop);
+        return -1;
+    }
+    if (ctrl.head - ctrl.tail >= static_cast<uint64_t>(PTO2_REQUEST_RING_DEPTH)) {
+        return -1;  // Full: the device has not drained slot head-DEPTH yet
+    }
+
+    uint64_t seq = ctrl.head;
+    PTO2RequestSlot slot;
+    slot.args = *args;
+    char *slot_dev = static_cast<char *>(ring_dev) + offsetof(PTO2RequestRing, slots) +
+                     (seq % PTO2_REQUEST_RING_DEPTH) * sizeof(PTO2RequestSlot);
+    if (runtime->host_api.copy_to_device(slot_dev, &slot, sizeof(slot)) != 0) {
+        LOG_ERROR("Failed to write request slot %" PRIu64, seq);
+        return -1;
+    }
+
+    // Publish: bump head only after the slot contents are in GM
+    uint64_t new_head = seq + 1;
+    char *head_dev = static_cast<char *>(ring_dev) + offsetof(PTO2RequestRing, head);
+    if (runtime->host_api.copy_to_device(head_dev, &new_head, sizeof(new_head)) != 0) {
+        LOG_ERROR("Failed to publish request %" PRIu64, seq);
+        return -1;
+    }
+    return static_cast<int64_t>(seq);
+}
+
+/**
+ * Block until request `seq` has fully drained on device (tail > seq).
+ * Returns 0 on completion, -1 on error.
+ */
+extern "C" int pto2_request_ring_wait(Runtime *runtime, int64_t seq) {
+    if (runtime == nullptr || seq < 0) return -1;
+    void *ring_dev = runtime->get_pto2_request_ring_ptr();
+    if (ring_dev == nullptr) return -1;
+
+    PTO2RequestRing ctrl;
+    while (true) {
+        if (read_request_ring_control(runtime, ring_dev, &ctrl) != 0) {
+            LOG_ERROR("Failed to poll request ring tail");
+            return -1;
+        }
+        if (ctrl.tail > static_cast<uint64_t>(seq)) return 0;
+    }
+}
+
+/**
+ * Request serving-loop shutdown. The device drains every request already
+ * published below head, then exits. Returns 0 on success, -1 on error.
+ */
+extern "C" int pto2_request_ring_stop(Runtime *runtime) {
+    if (runtime == nullptr) return -1;
+    void *ring_dev = runtime->get_pto2_request_ring_ptr();
+    if (ring_dev == nullptr) return -1;
+
+    uint32_t stop = 1;
+    char *stop_dev = static_cast<char *>(ring_dev) + offsetof(PTO2RequestRing, stop);
+    if (runtime->host_api.copy_to_device(stop_dev, &stop, sizeof(stop)) != 0) {
+        LOG_ERROR("Failed to write request ring stop flag");
+        return -1;
+    }
+    return 0;
+}
+
 /**
  * Validate runtime results and cleanup.
  *
@@ -392,3 +534,17 @@ extern "C" int validate_runtime_impl(Runtime *runtime) {
 
     return rc;
 }
+
+/**
+ * This runtime's scheduler does not publish the always-on health block
+ * (see PTO2HealthMetrics in the tensormap_and_ringbuffer runtime); the
+ * platform's optional health_metrics_get_ctx symbol reports "unavailable".
+ */
+extern "C" int
+read_health_metrics_impl(Runtime *runtime, PtoHealthCopyFn copy_fn, void *copy_ctx, PtoHealthMetrics *out) {
+    (void)runtime;
+    (void)copy_fn;
+    (void)copy_ctx;
+    (void)out;
+    return -1;
+}
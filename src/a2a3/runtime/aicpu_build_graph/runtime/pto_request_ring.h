@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * Host -> AICPU Request Ring for Persistent Orchestration
+ *
+ * In persistent orchestration mode the device-side orchestration loop stays
+ * resident between runs instead of being re-launched per request. The host
+ * enqueues one orchestration request per slot (a ChipStorageTaskArgs copy)
+ * and bumps head; the orchestrator thread pops slots, runs the orchestration
+ * entry with the slot's args, waits for the request's graph to fully drain,
+ * and bumps tail. The per-request host critical path is reduced to the slot
+ * write plus the head bump.
+ *
+ * Ownership follows the Handshake convention (single writer per field):
+ * - head / stop: written by host only, read by device
+ * - tail:        written by device only, read by host
+ * - slots[i]:    written by host while i is in [tail, head), read by device
+ *
+ * The ring lives in GM. Host writes arrive via DMA and bypass the AICPU data
+ * cache, so the device invalidates the control line before each poll and the
+ * slot before reading it; the device publishes tail with a clean+invalidate
+ * of the control line (DC CIVAC writes dirty lines back to HBM).
+ */
+
+#ifndef SRC_A2A3_RUNTIME_AICPU_BUILD_GRAPH_RUNTIME_PTO_REQUEST_RING_H_
+#define SRC_A2A3_RUNTIME_AICPU_BUILD_GRAPH_RUNTIME_PTO_REQUEST_RING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "task_args.h"
+
+// Written by the host when the ring is created; the device refuses to serve
+// from a ring whose control line does not carry it (guards against a stale
+// or never-initialized GM allocation).
+constexpr uint32_t PTO2_REQUEST_RING_MAGIC = 0x50515232;  // "PQR2"
+
+// Slots in flight before pto2_request_ring_submit reports the ring full.
+// Requests drain strictly in order, so depth only bounds host-side pipelining.
+constexpr int32_t PTO2_REQUEST_RING_DEPTH = 8;
+
+/**
+ * One pending orchestration request. Cache-line aligned so a host slot write
+ * never shares a line with the control fields or a neighbouring slot the
+ * device may be reading.
+ */
+struct PTO2RequestSlot {
+    ChipStorageTaskArgs args;
+} __attribute__((aligned(64)));
+
+/**
+ * Ring control block followed by the slot array, allocated in GM by the host.
+ *
+ * head and tail are free-running sequence numbers; slot index is seq % DEPTH.
+ * stop=1 tells the device to exit the serving loop once every request below
+ * head has drained.
+ */
+struct PTO2RequestRing {
+    volatile uint32_t magic;  // PTO2_REQUEST_RING_MAGIC when initialized
+    volatile uint32_t stop;   // Host shutdown request: 0=serve, 1=stop after drain
+    volatile uint64_t head;   // Next sequence the host will write
+    volatile uint64_t tail;   // Next sequence the device will serve; seq < tail is fully drained
+    uint8_t pad[40];          // Keep slots off the control cache line
+    PTO2RequestSlot slots[PTO2_REQUEST_RING_DEPTH];
+};
+
+static_assert(offsetof(PTO2RequestRing, slots) == 64, "control block must occupy exactly one cache line");
+static_assert(sizeof(PTO2RequestSlot) % 64 == 0, "slots must not share cache lines");
+
+#endif  // SRC_A2A3_RUNTIME_AICPU_BUILD_GRAPH_RUNTIME_PTO_REQUEST_RING_H_
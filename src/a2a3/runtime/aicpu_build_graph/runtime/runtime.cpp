@@ -38,6 +38,7 @@ Runtime::Runtime() {
     pto2_heap_size = 0;
     pto2_dep_pool_size = 0;
     orch_to_sched = false;
+    persistent_orch = false;
 
     // Initialize tensor pairs
     tensor_pair_count = 0;
@@ -46,6 +47,7 @@ Runtime::Runtime() {
     orch_built_on_host_ = true;
     pto2_gm_sm_ptr_ = nullptr;
     pto2_gm_heap_ptr_ = nullptr;
+    pto2_request_ring_ptr_ = nullptr;
     pto2_slot_states_ptr_ = nullptr;
     orch_args_storage_.clear();
 
@@ -90,10 +92,12 @@ void Runtime::clear_tensor_pairs() { tensor_pair_count = 0; }
 bool Runtime::get_orch_built_on_host() const { return orch_built_on_host_; }
 void *Runtime::get_pto2_gm_sm_ptr() const { return pto2_gm_sm_ptr_; }
 void *Runtime::get_pto2_gm_heap_ptr() const { return pto2_gm_heap_ptr_; }
+void *Runtime::get_pto2_request_ring_ptr() const { return pto2_request_ring_ptr_; }
 const ChipStorageTaskArgs &Runtime::get_orch_args() const { return orch_args_storage_; }
 void Runtime::set_orch_built_on_host(bool v) { orch_built_on_host_ = v; }
 void Runtime::set_pto2_gm_sm_ptr(void *p) { pto2_gm_sm_ptr_ = p; }
 void Runtime::set_pto2_gm_heap(void *p) { pto2_gm_heap_ptr_ = p; }
+void Runtime::set_pto2_request_ring_ptr(void *p) { pto2_request_ring_ptr_ = p; }
 void Runtime::set_pto2_slot_states_ptr(void *p) { pto2_slot_states_ptr_ = p; }
 void Runtime::set_orch_args(const ChipStorageTaskArgs &args) { orch_args_storage_ = args; }
 
@@ -126,6 +126,10 @@ struct HostApi {
     void (*device_free)(void *dev_ptr);
     int (*copy_to_device)(void *dev_ptr, const void *host_ptr, size_t size);
     int (*copy_from_device)(void *host_ptr, const void *dev_ptr, size_t size);
+    // Asynchronous upload: the copy is queued and may complete any time before
+    // the next copy_sync() returns; the host buffer must stay valid until then.
+    int (*copy_to_device_async)(void *dev_ptr, const void *host_ptr, size_t size);
+    int (*copy_sync)(void);
     uint64_t (*upload_kernel_binary)(int func_id, const uint8_t *bin_data, size_t bin_size);
     void (*remove_kernel_binary)(int func_id);
 };
@@ -180,6 +184,13 @@ public:
     // When false (default), orchestrator threads exit after orchestration without dispatching tasks.
     // Controlled via PTO2_ORCH_TO_SCHED environment variable.
     bool orch_to_sched;
+
+    // Persistent orchestration: the device orchestration loop stays resident,
+    // serving requests from the host-written request ring (pto2_request_ring_ptr_)
+    // instead of running the orchestration entry once and tearing down.
+    // Controlled via PTO2_PERSISTENT_ORCH environment variable.
+    // Mutually exclusive with orch_to_sched (the orchestrator thread never converts).
+    bool persistent_orch;
     uint64_t perf_data_base;  // Performance data shared memory base address (device-side)
 
 private:
@@ -195,6 +206,7 @@ private:
     bool orch_built_on_host_;
     void *pto2_gm_sm_ptr_;                   // GM pointer to PTO2 shared memory (device)
     void *pto2_gm_heap_ptr_;                 // GM heap for orchestrator output buffers (device)
+    void *pto2_request_ring_ptr_;            // GM pointer to PTO2RequestRing (persistent orchestration only)
     void *pto2_slot_states_ptr_;             // Pointer to PTO2TaskSlotState array (scheduler-private, for profiling)
     ChipStorageTaskArgs orch_args_storage_;  // Copy of args for device
 
@@ -244,10 +256,12 @@ public:
     bool get_orch_built_on_host() const;
     void *get_pto2_gm_sm_ptr() const;
     void *get_pto2_gm_heap_ptr() const;
+    void *get_pto2_request_ring_ptr() const;
     const ChipStorageTaskArgs &get_orch_args() const;
     void set_orch_built_on_host(bool v);
     void set_pto2_gm_sm_ptr(void *p);
     void set_pto2_gm_heap(void *p);
+    void set_pto2_request_ring_ptr(void *p);
     void set_pto2_slot_states_ptr(void *p);
     void set_orch_args(const ChipStorageTaskArgs &args);
 
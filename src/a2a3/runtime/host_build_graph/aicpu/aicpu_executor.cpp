@@ -106,6 +106,7 @@ struct AicpuExecutor {
     int init(Runtime *runtime);
     int handshake_all_cores(Runtime *runtime);
     void assign_cores_to_threads();
+    void restore_task_fanins(Runtime *runtime);
     void classify_and_distribute_initial_tasks(Runtime *runtime);
     int resolve_and_dispatch(Runtime &runtime, int thread_idx, const int *cur_thread_cores, int core_num);
     int shutdown_aicore(Runtime *runtime, int thread_idx, const int *cur_thread_cores);
@@ -320,6 +321,7 @@ int AicpuExecutor::init(Runtime *runtime) {
     }
 
     assign_cores_to_threads();
+    restore_task_fanins(runtime);
     classify_and_distribute_initial_tasks(runtime);
 
     total_tasks_.store(runtime->get_task_count(), std::memory_order_release);
@@ -508,6 +510,25 @@ void AicpuExecutor::assign_cores_to_threads() {
     }
 }
 
+// Rebuild fanin counters from the fanout lists. Scheduling consumes fanins
+// in place (resolve_task_dependencies decrements them to zero), so in session
+// mode the device image carries spent counters into the next round; the host
+// delta-upload path deliberately skips those bytes when its own image did not
+// change. Recomputing from the edges here restores the pristine values for
+// whatever graph is currently staged — O(edges), no extra DMA.
+void AicpuExecutor::restore_task_fanins(Runtime *runtime) {
+    int task_count = runtime->get_task_count();
+    for (int task_id = 0; task_id < task_count; task_id++) {
+        runtime->get_task(task_id)->fanin.store(0, std::memory_order_relaxed);
+    }
+    for (int task_id = 0; task_id < task_count; task_id++) {
+        Task *task = runtime->get_task(task_id);
+        for (int j = 0; j < task->fanout_count; j++) {
+            runtime->get_task(task->fanout[j])->fanin.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
 // Classify and distribute initial ready tasks to thread-local and shared queues
 void AicpuExecutor::classify_and_distribute_initial_tasks(Runtime *runtime) {
     ready_queue_aic_head_ = 0;
@@ -709,7 +730,7 @@ int AicpuExecutor::resolve_and_dispatch(Runtime &runtime, int thread_idx, const
                             fanout_arr[i] = static_cast<uint64_t>(prev_task->fanout[i]);
                         }
                         if (perf_aicpu_complete_record(
-                                perf_buf, static_cast<uint32_t>(prev_running_id),
+                                perf_buf, core_id, static_cast<uint32_t>(prev_running_id),
                                 static_cast<uint64_t>(prev_running_id), prev_task->func_id, h->core_type,
                                 dispatch_timestamps_[core_id], finish_ts, fanout_arr, prev_task->fanout_count
                             ) != 0) {
@@ -728,7 +749,7 @@ int AicpuExecutor::resolve_and_dispatch(Runtime &runtime, int thread_idx, const
                         fanout_arr[i] = static_cast<uint64_t>(task->fanout[i]);
                     }
                     if (perf_aicpu_complete_record(
-                            perf_buf, static_cast<uint32_t>(completed_task_id),
+                            perf_buf, core_id, static_cast<uint32_t>(completed_task_id),
                             static_cast<uint64_t>(completed_task_id), task->func_id, h->core_type,
                             dispatch_timestamps_[core_id], finish_ts, fanout_arr, task->fanout_count
                         ) != 0) {
@@ -815,7 +836,7 @@ int AicpuExecutor::resolve_and_dispatch(Runtime &runtime, int thread_idx, const
                             fanout_arr[i] = static_cast<uint64_t>(prev_task->fanout[i]);
                         }
                         if (perf_aicpu_complete_record(
-                                perf_buf, static_cast<uint32_t>(prev_running_id),
+                                perf_buf, core_id, static_cast<uint32_t>(prev_running_id),
                                 static_cast<uint64_t>(prev_running_id), prev_task->func_id, h->core_type,
                                 dispatch_timestamps_[core_id], finish_ts, fanout_arr, prev_task->fanout_count
                             ) != 0) {
@@ -859,7 +880,7 @@ int AicpuExecutor::resolve_and_dispatch(Runtime &runtime, int thread_idx, const
                         fanout_arr[i] = static_cast<uint64_t>(task->fanout[i]);
                     }
                     if (perf_aicpu_complete_record(
-                            perf_buf, static_cast<uint32_t>(completed_task_id),
+                            perf_buf, core_id, static_cast<uint32_t>(completed_task_id),
                             static_cast<uint64_t>(completed_task_id), task->func_id, h->core_type,
                             dispatch_timestamps_[core_id], finish_ts, fanout_arr, task->fanout_count
                         ) != 0) {
@@ -33,12 +33,15 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
+#include <mutex>
 #include <string>
 #include <vector>
 
 #include "callable.h"
 #include "orchestration_api.h"
+#include "pto_runtime_c_api.h"
 #include "runtime.h"  // Includes unified_log.h and provides LOG_* macros
 #include "task_args.h"
 
@@ -49,22 +52,72 @@ struct OrchestrationRuntimeImpl {
     Runtime *runtime;
     struct TensorInfoBuilder *tensor_info_builder;
     struct TensorAllocationBuilder *tensor_allocation_builder;
+    struct GraphCacheRecorder *graph_cache_recorder;
+    // Serializes the builder/recorder/device ops so orchestration functions
+    // may build graph partitions from multiple threads. add_task and
+    // add_successor stay lock-free (atomic ID reservation and fanin).
+    std::mutex build_mutex;
 };
 
+/**
+ * Build-phase tensor metadata, stored as SoA columns.
+ *
+ * During graph construction the metadata is append-only and the per-task
+ * entries arrive scattered, so keeping them in flat columns (one contiguous
+ * array per field, plus a per-task range table) avoids one heap allocation
+ * per task and keeps the build-phase working set dense. The 64-byte AoS
+ * TensorInfo the device consumes is materialized only when the final image
+ * is assembled in upload_tensor_info_storage.
+ */
 struct TensorInfoBuilder {
-    std::vector<std::vector<TensorInfo>> tensor_info_by_task;
+    struct TaskRange {
+        uint32_t offset = 0;
+        uint16_t count = 0;
+    };
+
+    std::vector<TaskRange> ranges_by_task;  // Indexed by task_id
+    std::vector<DataType> dtypes;
+    std::vector<uint8_t> ndims;
+    // Per-dim columns, PLATFORM_DUMP_MAX_DIMS slots per entry
+    std::vector<uint32_t> shapes;
+    std::vector<uint32_t> raw_shapes;
+    std::vector<uint32_t> dim_offsets;
 
     int set_tensor_info_to_task(int task_id, const TensorInfo *tensor_info, int tensor_count) {
         if (task_id < 0 || tensor_count < 0 || tensor_count > RUNTIME_MAX_ARGS) {
             return -1;
         }
-        if (static_cast<size_t>(task_id) >= tensor_info_by_task.size()) {
-            tensor_info_by_task.resize(static_cast<size_t>(task_id) + 1);
+        if (static_cast<size_t>(task_id) >= ranges_by_task.size()) {
+            ranges_by_task.resize(static_cast<size_t>(task_id) + 1);
+        }
+        // Re-setting a task appends fresh entries and repoints its range; the
+        // image assembly walks ranges, so superseded entries never upload.
+        ranges_by_task[static_cast<size_t>(task_id)] = {
+            static_cast<uint32_t>(dtypes.size()), static_cast<uint16_t>(tensor_count)
+        };
+        for (int i = 0; i < tensor_count; i++) {
+            const TensorInfo &info = tensor_info[i];
+            dtypes.push_back(info.dtype);
+            ndims.push_back(info.ndims);
+            shapes.insert(shapes.end(), info.shapes, info.shapes + PLATFORM_DUMP_MAX_DIMS);
+            raw_shapes.insert(raw_shapes.end(), info.raw_shapes, info.raw_shapes + PLATFORM_DUMP_MAX_DIMS);
+            dim_offsets.insert(dim_offsets.end(), info.offsets, info.offsets + PLATFORM_DUMP_MAX_DIMS);
         }
-        std::vector<TensorInfo> &task_info = tensor_info_by_task[static_cast<size_t>(task_id)];
-        task_info.assign(tensor_info, tensor_info + tensor_count);
         return 0;
     }
+
+    TensorInfo materialize(size_t entry) const {
+        TensorInfo info = {};
+        info.dtype = dtypes[entry];
+        info.ndims = ndims[entry];
+        size_t base = entry * PLATFORM_DUMP_MAX_DIMS;
+        for (size_t d = 0; d < PLATFORM_DUMP_MAX_DIMS; d++) {
+            info.shapes[d] = shapes[base + d];
+            info.raw_shapes[d] = raw_shapes[base + d];
+            info.offsets[d] = dim_offsets[base + d];
+        }
+        return info;
+    }
 };
 
 struct TensorAllocationBuilder {
@@ -91,6 +144,165 @@ struct TensorAllocationBuilder {
     }
 };
 
+// ---------------------------------------------------------------------------
+// Compiled-graph cache
+//
+// Serving loops often submit the identical topology run after run with only
+// new data pointers. The topology is a pure function of the orchestration
+// binary and the shape of its arguments (tensor dims/dtypes and scalars), so
+// after one full build we snapshot the built task array plus the sequence of
+// device operations the orchestration performed, and on the next run with the
+// same key we replay that sequence directly: re-allocate device buffers,
+// re-copy input data from the new host pointers, and patch the device
+// addresses embedded in task args — no dlopen, no orchestration call, no
+// per-task graph wiring.
+//
+// A build is only cacheable when every copy_to_device source and every
+// recorded tensor-pair host pointer is one of the orchestration's tensor
+// arguments (otherwise the data source cannot be replayed) and no device_free
+// happened mid-build. Anything else falls back to a full rebuild every run.
+// Set PTO_GRAPH_CACHE=0 to disable.
+// ---------------------------------------------------------------------------
+
+struct GraphCacheCopyOp {
+    int32_t alloc_idx;   // Destination: index into the run's allocation sequence
+    uint64_t offset;     // Byte offset from that allocation's base
+    int32_t tensor_idx;  // Source: orchestration tensor argument index
+    uint64_t size;
+};
+
+struct GraphCachePairOp {
+    int32_t tensor_idx;  // Host side: orchestration tensor argument index
+    int32_t alloc_idx;   // Device side: index into the allocation sequence
+    uint64_t offset;
+    uint64_t size;
+};
+
+struct GraphCacheRecorder {
+    const ChipStorageTaskArgs *orch_args = nullptr;
+    bool cacheable = true;
+    std::vector<TensorAllocationInfo> allocs;  // This run's bases/sizes, in malloc order
+    std::vector<GraphCacheCopyOp> copies;
+    std::vector<GraphCachePairOp> pairs;
+
+    int32_t tensor_index_of(const void *host_ptr) const {
+        for (int32_t i = 0; i < orch_args->tensor_count(); i++) {
+            if (orch_args->tensor(i).data == reinterpret_cast<uint64_t>(host_ptr)) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    int32_t alloc_index_of(uint64_t addr) const {
+        for (size_t i = 0; i < allocs.size(); i++) {
+            if (allocs[i].contains(addr)) {
+                return static_cast<int32_t>(i);
+            }
+        }
+        return -1;
+    }
+
+    void on_device_malloc(void *ptr, size_t size) {
+        if (ptr != nullptr && size > 0) {
+            allocs.push_back({reinterpret_cast<uint64_t>(ptr), static_cast<uint64_t>(size)});
+        }
+    }
+
+    // A mid-build free would shift the replayed allocation sequence.
+    void on_device_free(void *) { cacheable = false; }
+
+    void on_copy_to_device(void *dev_ptr, const void *host_ptr, size_t size) {
+        if (!cacheable) {
+            return;
+        }
+        int32_t tensor_idx = tensor_index_of(host_ptr);
+        int32_t alloc_idx = alloc_index_of(reinterpret_cast<uint64_t>(dev_ptr));
+        if (tensor_idx < 0 || alloc_idx < 0) {
+            cacheable = false;  // Source is not a replayable argument tensor
+            return;
+        }
+        copies.push_back(
+            {alloc_idx, reinterpret_cast<uint64_t>(dev_ptr) - allocs[static_cast<size_t>(alloc_idx)].base_addr,
+             tensor_idx, static_cast<uint64_t>(size)}
+        );
+    }
+
+    void on_record_tensor_pair(void *host_ptr, void *dev_ptr, size_t size) {
+        if (!cacheable) {
+            return;
+        }
+        int32_t tensor_idx = tensor_index_of(host_ptr);
+        int32_t alloc_idx = alloc_index_of(reinterpret_cast<uint64_t>(dev_ptr));
+        if (tensor_idx < 0 || alloc_idx < 0) {
+            cacheable = false;
+            return;
+        }
+        pairs.push_back(
+            {tensor_idx, alloc_idx,
+             reinterpret_cast<uint64_t>(dev_ptr) - allocs[static_cast<size_t>(alloc_idx)].base_addr,
+             static_cast<uint64_t>(size)}
+        );
+    }
+};
+
+struct GraphCacheEntry {
+    bool valid = false;
+    uint64_t key = 0;
+    int task_count = 0;
+    std::vector<uint8_t> tasks_image;  // task_count * sizeof(Task), args hold the build run's addresses
+    std::vector<TensorAllocationInfo> allocs;  // The build run's ranges, for address rebasing
+    std::vector<GraphCacheCopyOp> copies;
+    std::vector<GraphCachePairOp> pairs;
+    TensorInfoBuilder tensor_info;  // Flat SoA columns, replayed verbatim
+};
+
+// Single most-recent topology; a serving loop replays one graph, and one
+// entry bounds host memory to a single task-array snapshot.
+std::mutex g_graph_cache_mutex;
+GraphCacheEntry g_graph_cache;
+
+bool graph_cache_enabled() {
+    const char *env = getenv("PTO_GRAPH_CACHE");
+    return env == nullptr || env[0] != '0';
+}
+
+uint64_t fnv1a_accumulate(uint64_t hash, const void *data, size_t size) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * Hash everything that can influence the built topology: the orchestration
+ * binary, its entry name, and the shape of its arguments. Tensor data
+ * pointers are deliberately excluded — they are what replay patches.
+ */
+uint64_t graph_cache_key(const ChipCallable *callable, const ChipStorageTaskArgs *orch_args) {
+    uint64_t hash = 14695981039346656037ULL;
+    hash = fnv1a_accumulate(hash, callable->binary_data(), callable->binary_size());
+    hash = fnv1a_accumulate(hash, callable->func_name(), strlen(callable->func_name()));
+    int32_t tensor_count = orch_args->tensor_count();
+    hash = fnv1a_accumulate(hash, &tensor_count, sizeof(tensor_count));
+    for (int32_t i = 0; i < tensor_count; i++) {
+        const ContinuousTensor &t = orch_args->tensor(i);
+        hash = fnv1a_accumulate(hash, &t.ndims, sizeof(t.ndims));
+        hash = fnv1a_accumulate(hash, &t.dtype, sizeof(t.dtype));
+        hash = fnv1a_accumulate(hash, t.shapes, t.ndims * sizeof(t.shapes[0]));
+    }
+    int32_t scalar_count = orch_args->scalar_count();
+    hash = fnv1a_accumulate(hash, &scalar_count, sizeof(scalar_count));
+    hash = fnv1a_accumulate(hash, orch_args->scalar_data(), static_cast<size_t>(scalar_count) * sizeof(uint64_t));
+    return hash;
+}
+
+OrchestrationRuntimeImpl *unwrap_impl(OrchestrationRuntime *runtime) {
+    return reinterpret_cast<OrchestrationRuntimeImpl *>(runtime);
+}
+
 Runtime *unwrap_runtime(OrchestrationRuntime *runtime) {
     return reinterpret_cast<OrchestrationRuntimeImpl *>(runtime)->runtime;
 }
@@ -122,6 +334,7 @@ int runtime_set_tensor_info_to_task(
         LOG_ERROR("Task %d tensor info pointer is null", task_id);
         return -1;
     }
+    std::lock_guard<std::mutex> lock(unwrap_impl(runtime)->build_mutex);
     return unwrap_tensor_info_builder(runtime)->set_tensor_info_to_task(task_id, tensor_info, tensor_count);
 }
 
@@ -129,7 +342,13 @@ void runtime_add_successor(OrchestrationRuntime *runtime, int from_task, int to_
     unwrap_runtime(runtime)->add_successor(from_task, to_task);
 }
 
+GraphCacheRecorder *unwrap_graph_cache_recorder(OrchestrationRuntime *runtime) {
+    return reinterpret_cast<OrchestrationRuntimeImpl *>(runtime)->graph_cache_recorder;
+}
+
 void runtime_record_tensor_pair(OrchestrationRuntime *runtime, void *host_ptr, void *dev_ptr, size_t size) {
+    std::lock_guard<std::mutex> lock(unwrap_impl(runtime)->build_mutex);
+    unwrap_graph_cache_recorder(runtime)->on_record_tensor_pair(host_ptr, dev_ptr, size);
     unwrap_runtime(runtime)->record_tensor_pair(host_ptr, dev_ptr, size);
 }
 
@@ -138,17 +357,23 @@ int runtime_get_task_count(OrchestrationRuntime *runtime) { return unwrap_runtim
 void runtime_print_runtime(OrchestrationRuntime *runtime) { unwrap_runtime(runtime)->print_runtime(); }
 
 void *runtime_device_malloc(OrchestrationRuntime *runtime, size_t size) {
+    std::lock_guard<std::mutex> lock(unwrap_impl(runtime)->build_mutex);
     void *ptr = unwrap_runtime(runtime)->host_api.device_malloc(size);
     unwrap_tensor_allocation_builder(runtime)->record_allocation(ptr, size);
+    unwrap_graph_cache_recorder(runtime)->on_device_malloc(ptr, size);
     return ptr;
 }
 
 void runtime_device_free(OrchestrationRuntime *runtime, void *ptr) {
+    std::lock_guard<std::mutex> lock(unwrap_impl(runtime)->build_mutex);
     unwrap_tensor_allocation_builder(runtime)->erase_allocation(ptr);
+    unwrap_graph_cache_recorder(runtime)->on_device_free(ptr);
     unwrap_runtime(runtime)->host_api.device_free(ptr);
 }
 
 int runtime_copy_to_device(OrchestrationRuntime *runtime, void *dev_ptr, const void *host_ptr, size_t size) {
+    std::lock_guard<std::mutex> lock(unwrap_impl(runtime)->build_mutex);
+    unwrap_graph_cache_recorder(runtime)->on_copy_to_device(dev_ptr, host_ptr, size);
     return unwrap_runtime(runtime)->host_api.copy_to_device(dev_ptr, host_ptr, size);
 }
 
@@ -206,23 +431,32 @@ int upload_tensor_info_storage(Runtime *runtime, const TensorInfoBuilder &builde
     int task_count = runtime->get_task_count();
     std::vector<TensorInfo> compact_tensor_info;
     for (int task_id = 0; task_id < task_count; task_id++) {
-        const std::vector<TensorInfo> *task_info = nullptr;
-        if (static_cast<size_t>(task_id) < builder.tensor_info_by_task.size()) {
-            task_info = &builder.tensor_info_by_task[static_cast<size_t>(task_id)];
+        TensorInfoBuilder::TaskRange range = {};
+        if (static_cast<size_t>(task_id) < builder.ranges_by_task.size()) {
+            range = builder.ranges_by_task[static_cast<size_t>(task_id)];
         }
         uint32_t offset = static_cast<uint32_t>(compact_tensor_info.size());
-        uint16_t count = 0;
-        if (task_info != nullptr) {
-            count = static_cast<uint16_t>(task_info->size());
-            compact_tensor_info.insert(compact_tensor_info.end(), task_info->begin(), task_info->end());
+        for (uint16_t i = 0; i < range.count; i++) {
+            compact_tensor_info.push_back(builder.materialize(range.offset + i));
         }
-        runtime->set_tensor_info_range(task_id, offset, count);
+        runtime->set_tensor_info_range(task_id, offset, range.count);
     }
 
     if (compact_tensor_info.empty()) {
         return 0;
     }
 
+    // Small blocks ride the Runtime image itself (copied to the device every
+    // run anyway) instead of paying a dedicated device allocation + copy.
+    if (compact_tensor_info.size() <= RUNTIME_INLINE_TENSOR_INFO_ENTRIES) {
+        runtime->set_tensor_info_inline(compact_tensor_info.data(), static_cast<uint32_t>(compact_tensor_info.size()));
+        LOG_INFO(
+            "Embedded %zu tensor info entries inline (%zu bytes)", compact_tensor_info.size(),
+            compact_tensor_info.size() * sizeof(TensorInfo)
+        );
+        return 0;
+    }
+
     size_t tensor_info_bytes = compact_tensor_info.size() * sizeof(TensorInfo);
     void *dev_tensor_info_storage = runtime->host_api.device_malloc(tensor_info_bytes);
     if (dev_tensor_info_storage == nullptr) {
@@ -248,6 +482,17 @@ int upload_tensor_allocation_storage(Runtime *runtime, const TensorAllocationBui
         return 0;
     }
 
+    if (builder.allocations.size() <= RUNTIME_INLINE_TENSOR_ALLOC_ENTRIES) {
+        runtime->set_tensor_allocation_inline(
+            builder.allocations.data(), static_cast<uint32_t>(builder.allocations.size())
+        );
+        LOG_INFO(
+            "Embedded %zu tensor allocation ranges inline (%zu bytes)", builder.allocations.size(),
+            builder.allocations.size() * sizeof(TensorAllocationInfo)
+        );
+        return 0;
+    }
+
     size_t allocation_bytes = builder.allocations.size() * sizeof(TensorAllocationInfo);
     void *dev_allocation_storage = runtime->host_api.device_malloc(allocation_bytes);
     if (dev_allocation_storage == nullptr) {
@@ -269,6 +514,115 @@ int upload_tensor_allocation_storage(Runtime *runtime, const TensorAllocationBui
     return 0;
 }
 
+/**
+ * Snapshot a freshly built graph into the cache. Called only when the
+ * recorder observed a fully replayable build.
+ */
+void graph_cache_store(uint64_t key, Runtime *runtime, const GraphCacheRecorder &recorder,
+                       const TensorInfoBuilder &tensor_info_builder) {
+    int task_count = runtime->get_task_count();
+    std::lock_guard<std::mutex> lock(g_graph_cache_mutex);
+    g_graph_cache.valid = true;
+    g_graph_cache.key = key;
+    g_graph_cache.task_count = task_count;
+    g_graph_cache.tasks_image.resize(static_cast<size_t>(task_count) * sizeof(Task));
+    memcpy(g_graph_cache.tasks_image.data(), runtime->tasks, g_graph_cache.tasks_image.size());
+    g_graph_cache.allocs = recorder.allocs;
+    g_graph_cache.copies = recorder.copies;
+    g_graph_cache.pairs = recorder.pairs;
+    g_graph_cache.tensor_info = tensor_info_builder;
+    LOG_INFO("Graph cache stored: %d tasks, %zu allocations, %zu copies (key=0x%016lx)", task_count,
+             g_graph_cache.allocs.size(), g_graph_cache.copies.size(), static_cast<unsigned long>(key));
+}
+
+/**
+ * Replay a cached graph build: re-allocate device buffers in the recorded
+ * order, re-copy input data from the current (new) host tensor pointers,
+ * restore the task-array snapshot, and rebase every device address embedded
+ * in task args from the build run's allocations to this run's.
+ *
+ * @return 0 on successful replay, 1 on cache miss, negative on device error
+ */
+int graph_cache_replay(Runtime *runtime, uint64_t key, const ChipStorageTaskArgs *orch_args) {
+    std::lock_guard<std::mutex> lock(g_graph_cache_mutex);
+    const GraphCacheEntry &entry = g_graph_cache;
+    if (!entry.valid || entry.key != key) {
+        return 1;
+    }
+
+    // Re-run the recorded allocation sequence; new_bases[i] replaces
+    // entry.allocs[i].base_addr everywhere below.
+    std::vector<uint64_t> new_bases(entry.allocs.size());
+    TensorAllocationBuilder allocation_builder;
+    for (size_t i = 0; i < entry.allocs.size(); i++) {
+        void *ptr = runtime->host_api.device_malloc(entry.allocs[i].size_bytes);
+        if (ptr == nullptr) {
+            LOG_ERROR("Graph cache replay: allocation %zu (%lu bytes) failed",
+                      i, static_cast<unsigned long>(entry.allocs[i].size_bytes));
+            for (size_t j = 0; j < i; j++) {
+                runtime->host_api.device_free(reinterpret_cast<void *>(new_bases[j]));
+            }
+            return -1;
+        }
+        new_bases[i] = reinterpret_cast<uint64_t>(ptr);
+        allocation_builder.record_allocation(ptr, entry.allocs[i].size_bytes);
+    }
+
+    for (const GraphCacheCopyOp &op : entry.copies) {
+        void *dev_ptr = reinterpret_cast<void *>(new_bases[static_cast<size_t>(op.alloc_idx)] + op.offset);
+        const void *host_ptr = reinterpret_cast<const void *>(orch_args->tensor(op.tensor_idx).data);
+        int rc = runtime->host_api.copy_to_device(dev_ptr, host_ptr, op.size);
+        if (rc != 0) {
+            LOG_ERROR("Graph cache replay: input copy (tensor %d, %lu bytes) failed: %d", op.tensor_idx,
+                      static_cast<unsigned long>(op.size), rc);
+            for (uint64_t base : new_bases) {
+                runtime->host_api.device_free(reinterpret_cast<void *>(base));
+            }
+            return rc;
+        }
+    }
+
+    if (runtime->restore_task_snapshot(entry.tasks_image.data(), entry.task_count) != 0) {
+        return -1;
+    }
+
+    // Patch device addresses embedded in task args. Scalar args never fall
+    // inside a recorded allocation range and pass through untouched.
+    for (int task_id = 0; task_id < entry.task_count; task_id++) {
+        Task *task = runtime->get_task(task_id);
+        for (int arg = 0; arg < task->num_args; arg++) {
+            for (size_t i = 0; i < entry.allocs.size(); i++) {
+                if (entry.allocs[i].contains(task->args[arg])) {
+                    task->args[arg] = new_bases[i] + (task->args[arg] - entry.allocs[i].base_addr);
+                    break;
+                }
+            }
+        }
+    }
+
+    runtime->clear_tensor_pairs();
+    for (const GraphCachePairOp &op : entry.pairs) {
+        runtime->record_tensor_pair(
+            reinterpret_cast<void *>(orch_args->tensor(op.tensor_idx).data),
+            reinterpret_cast<void *>(new_bases[static_cast<size_t>(op.alloc_idx)] + op.offset),
+            static_cast<size_t>(op.size)
+        );
+    }
+
+    int rc = upload_tensor_allocation_storage(runtime, allocation_builder);
+    if (rc != 0) {
+        return rc;
+    }
+    rc = upload_tensor_info_storage(runtime, entry.tensor_info);
+    if (rc != 0) {
+        return rc;
+    }
+
+    LOG_INFO("Graph cache hit: replayed %d tasks, %zu allocations, %zu copies (key=0x%016lx)", entry.task_count,
+             entry.allocs.size(), entry.copies.size(), static_cast<unsigned long>(key));
+    return 0;
+}
+
 }  // namespace
 
 #ifdef __cplusplus
@@ -325,6 +679,21 @@ int init_runtime_impl(Runtime *runtime, const ChipCallable *callable, const Chip
         return -1;
     }
 
+    // On a repeated topology, replay the cached graph and skip the
+    // dlopen + orchestration build entirely.
+    uint64_t cache_key = 0;
+    if (graph_cache_enabled()) {
+        cache_key = graph_cache_key(callable, orch_args);
+        int replay_rc = graph_cache_replay(runtime, cache_key, orch_args);
+        if (replay_rc == 0) {
+            LOG_INFO("Runtime initialized from graph cache. Ready for execution from Python.");
+            return 0;
+        }
+        if (replay_rc < 0) {
+            LOG_ERROR("Graph cache replay failed: %d; rebuilding", replay_rc);
+        }
+    }
+
     // Load orchestration SO from binary data via temp file
     std::string fd_path;
     if (!create_temp_so_file(orch_so_binary, orch_so_size, &fd_path)) {
@@ -362,8 +731,11 @@ int init_runtime_impl(Runtime *runtime, const ChipCallable *callable, const Chip
 
     TensorInfoBuilder tensor_info_builder;
     TensorAllocationBuilder tensor_allocation_builder;
+    GraphCacheRecorder graph_cache_recorder;
+    graph_cache_recorder.orch_args = orch_args;
     OrchestrationRuntimeImpl orchestration_runtime = {
-        &k_orchestration_runtime_ops, runtime, &tensor_info_builder, &tensor_allocation_builder
+        &k_orchestration_runtime_ops, runtime, &tensor_info_builder, &tensor_allocation_builder,
+        &graph_cache_recorder
     };
 
     // Call orchestration function to build task graph
@@ -396,6 +768,10 @@ int init_runtime_impl(Runtime *runtime, const ChipCallable *callable, const Chip
         return rc;
     }
 
+    if (graph_cache_enabled() && graph_cache_recorder.cacheable) {
+        graph_cache_store(cache_key, runtime, graph_cache_recorder, tensor_info_builder);
+    }
+
     LOG_INFO("Runtime initialized. Ready for execution from Python.");
 
     // Host orchestration is complete once orch_func returns. The task graph now
@@ -465,12 +841,12 @@ int validate_runtime_impl(Runtime *runtime) {
 
     if (runtime->get_tensor_info_storage() != nullptr) {
         runtime->host_api.device_free(runtime->get_tensor_info_storage());
-        runtime->clear_tensor_info_storage();
     }
+    runtime->clear_tensor_info_storage();
     if (runtime->get_tensor_allocation_storage() != nullptr) {
         runtime->host_api.device_free(runtime->get_tensor_allocation_storage());
-        runtime->clear_tensor_allocation_storage();
     }
+    runtime->clear_tensor_allocation_storage();
 
     // Clear tensor pairs
     runtime->clear_tensor_pairs();
@@ -480,6 +856,20 @@ int validate_runtime_impl(Runtime *runtime) {
     return rc;
 }
 
+/**
+ * Host-built graphs run without a device-side scheduler, so there is no
+ * always-on health block to read (see PTO2HealthMetrics in the
+ * tensormap_and_ringbuffer runtime); the platform's optional
+ * health_metrics_get_ctx symbol reports "unavailable".
+ */
+int read_health_metrics_impl(Runtime *runtime, PtoHealthCopyFn copy_fn, void *copy_ctx, PtoHealthMetrics *out) {
+    (void)runtime;
+    (void)copy_fn;
+    (void)copy_ctx;
+    (void)out;
+    return -1;
+}
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
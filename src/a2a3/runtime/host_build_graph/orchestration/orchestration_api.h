@@ -13,6 +13,16 @@
  *
  * Orchestration sources include only this header and interact with the runtime
  * through the function-pointer table embedded in OrchestrationRuntime.
+ *
+ * Threading: an orchestration function may partition its task list and build
+ * from multiple host threads. add_task and add_successor are lock-free (task
+ * IDs are reserved atomically; the dependency merge rides the atomic fanin
+ * counter), with one ownership rule: all outgoing edges of a given task must
+ * be added from a single thread, which holds naturally when each thread adds
+ * the edges of the tasks it created. Cross-partition edges need no extra
+ * synchronization. The remaining ops (tensor info, tensor pairs, device
+ * memory, copies) are serialized internally and may be called from any
+ * thread. The orchestration function must join its threads before returning.
  */
 
 #ifndef SRC_A2A3_RUNTIME_HOST_BUILD_GRAPH_ORCHESTRATION_ORCHESTRATION_API_H_
@@ -53,6 +53,9 @@ Runtime::Runtime() {
     tensor_allocation_storage_ = nullptr;
     tensor_allocation_storage_bytes_ = 0;
     tensor_allocation_count_ = 0;
+    tensor_info_inline_count_ = 0;
+    memset(tensor_info_inline_, 0, sizeof(tensor_info_inline_));
+    memset(tensor_allocation_inline_, 0, sizeof(tensor_allocation_inline_));
 
     // Initialize kernel binary tracking
     registered_kernel_count_ = 0;
@@ -70,19 +73,19 @@ Runtime::Runtime() {
 // =============================================================================
 
 int Runtime::add_task(uint64_t *args, int num_args, int func_id, CoreType core_type) {
-    // Check bounds
-    if (next_task_id >= RUNTIME_MAX_TASKS) {
-        LOG_ERROR("[Runtime] Task table full (max=%d)", RUNTIME_MAX_TASKS);
-        return -1;
-    }
-
     if (num_args > RUNTIME_MAX_ARGS) {
         LOG_ERROR("[Runtime] Too many args (%d > %d)", num_args, RUNTIME_MAX_ARGS);
         return -1;
     }
 
-    // Allocate task
-    int task_id = next_task_id++;
+    // Reserve a slot; the atomic increment lets orchestration threads build
+    // graph partitions concurrently without handing out the same ID twice.
+    int task_id = next_task_id.fetch_add(1, std::memory_order_relaxed);
+    if (task_id >= RUNTIME_MAX_TASKS) {
+        next_task_id.fetch_sub(1, std::memory_order_relaxed);
+        LOG_ERROR("[Runtime] Task table full (max=%d)", RUNTIME_MAX_TASKS);
+        return -1;
+    }
     Task *task = &tasks[task_id];
 
     // Initialize task fields
@@ -103,12 +106,13 @@ int Runtime::add_task(uint64_t *args, int num_args, int func_id, CoreType core_t
 
 void Runtime::add_successor(int from_task, int to_task) {
     // Validate task IDs
-    if (from_task < 0 || from_task >= next_task_id) {
+    int task_count = next_task_id.load(std::memory_order_relaxed);
+    if (from_task < 0 || from_task >= task_count) {
         LOG_ERROR("[Runtime] Invalid from_task ID %d", from_task);
         return;
     }
 
-    if (to_task < 0 || to_task >= next_task_id) {
+    if (to_task < 0 || to_task >= task_count) {
         LOG_ERROR("[Runtime] Invalid to_task ID %d", to_task);
         return;
     }
@@ -116,7 +120,10 @@ void Runtime::add_successor(int from_task, int to_task) {
     Task *from = &tasks[from_task];
     Task *to = &tasks[to_task];
 
-    // Add to_task to from_task's fanout
+    // Add to_task to from_task's fanout. The fanout list is not synchronized:
+    // under concurrent construction a task's outgoing edges must all be added
+    // by the thread that owns its partition. Cross-partition edges are safe
+    // because the successor side only touches the atomic fanin counter.
     if (from->fanout_count >= RUNTIME_MAX_FANOUT) {
         LOG_ERROR("[Runtime] Fanout overflow for task %d (max=%d)", from_task, RUNTIME_MAX_FANOUT);
         return;
@@ -161,7 +168,7 @@ void Runtime::print_runtime() const {
     LOG_DEBUG("\n================================================================================");
     LOG_DEBUG("[Runtime] Task Runtime Status");
     LOG_DEBUG("========================================================================");
-    LOG_DEBUG("  Total tasks: %d", next_task_id);
+    LOG_DEBUG("  Total tasks: %d", next_task_id.load());
 
     // Print initially ready tasks
     LOG_DEBUG("\nInitially Ready Tasks (fanin==0):");
@@ -72,6 +72,17 @@
 #define RUNTIME_MAX_FUNC_ID 32
 #endif
 
+// Inline metadata embedding: blocks with at most this many entries ride the
+// Runtime image itself (which is DMA'd to the device every run regardless)
+// instead of a separate device allocation + copy per run.
+#ifndef RUNTIME_INLINE_TENSOR_INFO_ENTRIES
+#define RUNTIME_INLINE_TENSOR_INFO_ENTRIES 16
+#endif
+
+#ifndef RUNTIME_INLINE_TENSOR_ALLOC_ENTRIES
+#define RUNTIME_INLINE_TENSOR_ALLOC_ENTRIES 32
+#endif
+
 // =============================================================================
 // Data Structures
 // =============================================================================
@@ -151,6 +162,10 @@ struct HostApi {
     void (*device_free)(void *dev_ptr);
     int (*copy_to_device)(void *dev_ptr, const void *host_ptr, size_t size);
     int (*copy_from_device)(void *host_ptr, const void *dev_ptr, size_t size);
+    // Asynchronous upload: the copy is queued and may complete any time before
+    // the next copy_sync() returns; the host buffer must stay valid until then.
+    int (*copy_to_device_async)(void *dev_ptr, const void *host_ptr, size_t size);
+    int (*copy_sync)(void);
     uint64_t (*upload_kernel_binary)(int func_id, const uint8_t *bin_data, size_t bin_size);
     void (*remove_kernel_binary)(int func_id);
 };
@@ -216,7 +231,7 @@ public:
     Task tasks[RUNTIME_MAX_TASKS];  // Fixed-size task array
 
 private:
-    int next_task_id;  // Next available task ID
+    std::atomic<int> next_task_id;  // Next available task ID (atomic so builder threads can reserve concurrently)
 
     // Initial ready tasks (computed once, read-only after)
     int initial_ready_tasks[RUNTIME_MAX_TASKS];
@@ -244,6 +259,14 @@ private:
     uint64_t tensor_allocation_storage_bytes_;
     uint32_t tensor_allocation_count_;
 
+    // Inline embedding for small metadata blocks: the block travels inside
+    // the Runtime image (copied to the device every run anyway), so no
+    // separate device allocation, copy, or fence is paid for it. A non-zero
+    // inline count is mutually exclusive with the storage pointer above.
+    TensorInfo tensor_info_inline_[RUNTIME_INLINE_TENSOR_INFO_ENTRIES];
+    uint32_t tensor_info_inline_count_;
+    TensorAllocationInfo tensor_allocation_inline_[RUNTIME_INLINE_TENSOR_ALLOC_ENTRIES];
+
 public:
     /**
      * Constructor - zero-initialize all arrays
@@ -322,6 +345,30 @@ public:
      */
     void print_runtime() const;
 
+    /**
+     * Restore a previously captured task array image (graph-cache replay).
+     *
+     * The image must be task_count * sizeof(Task) bytes captured from the
+     * tasks array of a Runtime right after graph build. The caller patches
+     * device addresses inside task args afterwards; everything else in the
+     * image (func_id, fanin/fanout wiring, core types) replays verbatim.
+     *
+     * @param tasks_image  Raw snapshot of the built task array
+     * @param task_count   Number of tasks in the snapshot
+     * @return 0 on success, -1 if task_count is out of range
+     */
+    int restore_task_snapshot(const void *tasks_image, int task_count) {
+        if (tasks_image == nullptr || task_count < 0 || task_count > RUNTIME_MAX_TASKS) {
+            return -1;
+        }
+        // Task holds a std::atomic fanin counter but the whole Runtime image
+        // already travels to the device as raw bytes, so a byte copy is the
+        // established representation; cast to void* to make that explicit.
+        memcpy(static_cast<void *>(tasks), tasks_image, static_cast<size_t>(task_count) * sizeof(Task));
+        next_task_id = task_count;
+        return 0;
+    }
+
     // =========================================================================
     // Tensor Pair Management
     // =========================================================================
@@ -366,6 +413,26 @@ public:
     void clear_tensor_info_storage() {
         tensor_info_storage_ = nullptr;
         tensor_info_storage_bytes_ = 0;
+        tensor_info_inline_count_ = 0;
+    }
+
+    /**
+     * Embed a small tensor info block directly into the Runtime image.
+     * Alternative to set_tensor_info_storage() for blocks of at most
+     * RUNTIME_INLINE_TENSOR_INFO_ENTRIES entries; no device allocation or
+     * copy is needed since the Runtime is copied to the device anyway.
+     */
+    int set_tensor_info_inline(const TensorInfo *entries, uint32_t count) {
+        if (count > RUNTIME_INLINE_TENSOR_INFO_ENTRIES || (count > 0 && entries == nullptr)) {
+            return -1;
+        }
+        if (count > 0) {
+            memcpy(tensor_info_inline_, entries, count * sizeof(TensorInfo));
+        }
+        tensor_info_inline_count_ = count;
+        tensor_info_storage_ = nullptr;
+        tensor_info_storage_bytes_ = 0;
+        return 0;
     }
 
     void set_tensor_info_range(int task_id, uint32_t offset, uint16_t count) {
@@ -378,7 +445,8 @@ public:
         if (count != nullptr) {
             *count = 0;
         }
-        if (task_id < 0 || task_id >= RUNTIME_MAX_TASKS || tensor_info_storage_ == nullptr) {
+        if (task_id < 0 || task_id >= RUNTIME_MAX_TASKS ||
+            (tensor_info_storage_ == nullptr && tensor_info_inline_count_ == 0)) {
             return nullptr;
         }
         uint16_t tensor_info_count = tensor_info_counts_[task_id];
@@ -388,7 +456,9 @@ public:
         if (count != nullptr) {
             *count = static_cast<int>(tensor_info_count);
         }
-        const TensorInfo *base = reinterpret_cast<const TensorInfo *>(tensor_info_storage_);
+        const TensorInfo *base = (tensor_info_inline_count_ > 0)
+                                     ? tensor_info_inline_
+                                     : reinterpret_cast<const TensorInfo *>(tensor_info_storage_);
         return base + tensor_info_offsets_[task_id];
     }
 
@@ -408,12 +478,33 @@ public:
         tensor_allocation_storage_bytes_ = 0;
     }
 
+    /**
+     * Embed a small allocation-range block directly into the Runtime image.
+     * Alternative to set_tensor_allocation_storage() for blocks of at most
+     * RUNTIME_INLINE_TENSOR_ALLOC_ENTRIES ranges; a null storage pointer
+     * with a non-zero count marks the inline variant.
+     */
+    int set_tensor_allocation_inline(const TensorAllocationInfo *ranges, uint32_t count) {
+        if (count > RUNTIME_INLINE_TENSOR_ALLOC_ENTRIES || (count > 0 && ranges == nullptr)) {
+            return -1;
+        }
+        if (count > 0) {
+            memcpy(tensor_allocation_inline_, ranges, count * sizeof(TensorAllocationInfo));
+        }
+        tensor_allocation_count_ = count;
+        tensor_allocation_storage_ = nullptr;
+        tensor_allocation_storage_bytes_ = 0;
+        return 0;
+    }
+
     bool is_tensor_buffer_addr(uint64_t addr) const {
-        if (tensor_allocation_storage_ == nullptr || tensor_allocation_count_ == 0) {
+        if (tensor_allocation_count_ == 0) {
             return false;
         }
         const TensorAllocationInfo *allocations =
-            reinterpret_cast<const TensorAllocationInfo *>(tensor_allocation_storage_);
+            (tensor_allocation_storage_ != nullptr)
+                ? reinterpret_cast<const TensorAllocationInfo *>(tensor_allocation_storage_)
+                : tensor_allocation_inline_;
         for (uint32_t i = 0; i < tensor_allocation_count_; i++) {
             if (allocations[i].contains(addr)) {
                 return true;
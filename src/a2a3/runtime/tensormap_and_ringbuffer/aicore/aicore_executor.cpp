@@ -50,11 +50,21 @@ __aicore__ __attribute__((always_inline)) static void execute_task(__gm__ PTO2Di
  * 3. Cache per-core PTO2DispatchPayload pointer from hank->task
  * 4. Poll DATA_MAIN_BASE register for task dispatch until exit signal
  *
- * AICPU writes &s_pto2_payload_per_core[i] to hank->task before setting
- * aicpu_ready=1. AICore caches this pointer and reads function_bin_addr +
- * args pointer from it on each dispatch. reg_val is a monotonically
+ * AICPU writes &s_pto2_payload_per_core[i][0] to hank->task before setting
+ * aicpu_ready=1; the pointer addresses a two-deep payload slot. AICore
+ * caches this pointer and reads function_bin_addr + args pointer from the
+ * parity-selected buffer on each dispatch. reg_val is a monotonically
  * increasing task ID used only for dispatch signaling and ACK/FIN protocol.
  *
+ * Two-deep pipelining: the dual buffer lets the AICPU stage the NEXT
+ * dispatch while the current kernel runs. After this core ACKs task N
+ * (consuming buffer N & 1), the scheduler builds task N+1's payload into
+ * the other buffer and flips DATA_MAIN_BASE mid-execution (the pending
+ * slot in dispatch_subtask_to_core). On FIN the very next register read
+ * already holds N+1, so the core rolls straight into the prefetched
+ * payload — the idle window between back-to-back tasks is just the FIN
+ * write and one register read, not an AICPU round trip.
+ *
  * @param runtime Pointer to Runtime in global memory
  * @param block_idx Block index (core ID)
  * @param core_type Core type (AIC or AIV)
@@ -62,9 +72,13 @@ __aicore__ __attribute__((always_inline)) static void execute_task(__gm__ PTO2Di
 __aicore__ __attribute__((weak)) void aicore_execute(__gm__ Runtime *runtime, int block_idx, CoreType core_type) {
     __gm__ Handshake *my_hank = (__gm__ Handshake *)(&runtime->workers[block_idx]);
 
-    // Phase 1: Wait for AICPU initialization signal
+    // Phase 1: Wait for AICPU initialization signal. All init-time flags
+    // share the handshake's first cache line, so each poll costs exactly one
+    // line invalidate; the spin hint paces the dcci stream so back-to-back
+    // maintenance ops don't saturate the cache pipeline.
     while (my_hank->aicpu_ready == 0) {
         dcci(my_hank, SINGLE_CACHE_LINE);
+        SPIN_WAIT_HINT();
     }
 
     // Phase 2: Report physical core ID, signal ready
@@ -74,9 +88,12 @@ __aicore__ __attribute__((weak)) void aicore_execute(__gm__ Runtime *runtime, in
     dcci(&my_hank->aicore_regs_ready, SINGLE_CACHE_LINE, CACHELINE_OUT);
     while (my_hank->aicpu_regs_ready == 0) {
         dcci(&my_hank->aicpu_regs_ready, SINGLE_CACHE_LINE);
+        SPIN_WAIT_HINT();
     }
-    // Report initial idle status via register
+    // Report initial idle status via register and doorbell
     write_reg(RegId::COND, AICORE_IDLE_VALUE);
+    my_hank->cond_doorbell = AICORE_IDLE_VALUE;
+    dcci(&my_hank->cond_doorbell, SINGLE_CACHE_LINE, CACHELINE_OUT);
 
     // Phase 3: Report core type, signal ready
     my_hank->core_type = core_type;
@@ -101,6 +118,8 @@ __aicore__ __attribute__((weak)) void aicore_execute(__gm__ Runtime *runtime, in
         if (reg_val == AICORE_EXIT_SIGNAL) {
             // Signal exit acknowledgment to AICPU
             write_reg(RegId::COND, AICORE_EXITED_VALUE);
+            my_hank->cond_doorbell = AICORE_EXITED_VALUE;
+            dcci(&my_hank->cond_doorbell, SINGLE_CACHE_LINE, CACHELINE_OUT);
             break;
         }
 
@@ -113,13 +132,50 @@ __aicore__ __attribute__((weak)) void aicore_execute(__gm__ Runtime *runtime, in
         {
             uint32_t task_id = reg_val;  // Decode: register holds task_id directly
 
-            // Select dual-buffer slot: same bit as AICPU used when writing payload
+            // Select dual-buffer slot: same bit as AICPU used when writing
+            // payload. The other buffer may already carry the next dispatch,
+            // staged by the AICPU while the previous kernel ran; the sentinel
+            // skip in dispatch_subtask_to_core preserves task-id parity so
+            // adjacent dispatches always alternate buffers.
             __gm__ PTO2DispatchPayload *exec_payload = payload + (task_id & 1u);
 
-            // Invalidate payload buffer (AICPU updates its content each dispatch)
+            // Invalidate payload buffer (AICPU updates its content each
+            // dispatch). Deliberately whole-cache, not line-targeted: args[]
+            // carries pointers into the task's PTO2TaskPayload in shared
+            // memory (tensor descriptors, scalars), and those slots are
+            // ring-reused — a stale descriptor line from a prior wrap would
+            // survive a payload-only invalidate. The addresses aren't known
+            // until after the invalidate, so the full sweep is the coherency
+            // point for everything this dispatch scalar-reads.
             dcci(exec_payload, ENTIRE_DATA_CACHE);
 
             write_reg(RegId::COND, MAKE_ACK_VALUE(task_id));
+            // Doorbell publication: the AICPU completion scan reads only this
+            // cacheable word, so every COND value must be published here. The
+            // COND register is still written (the AICPU reads it on the exit
+            // path, during dispatch calibration, and in stall diagnostics)
+            // but the doorbell is what drives task-state transitions.
+            my_hank->cond_doorbell = MAKE_ACK_VALUE(task_id);
+            dcci(&my_hank->cond_doorbell, SINGLE_CACHE_LINE, CACHELINE_OUT);
+
+            // Hand the kernel its WIP perf record so it can drop intra-kernel
+            // phase markers (get_perf_record + perf_aicore_phase_marker).
+            // Zeroing phase_count here — never in record_task, which runs
+            // after the kernel — is what lets AICPU trust the count. The
+            // dirtied payload line is written back by the next dispatch's
+            // whole-cache dcci, which completes before the ACK that permits
+            // the AICPU to republish this slot. perf_buf is read once and
+            // reused for the post-kernel record so markers and timings land
+            // in the same buffer even if the AICPU switches buffers mid-task.
+            __gm__ PerfBuffer *perf_buf = nullptr;
+            if (profiling_enabled) {
+                perf_buf = (__gm__ PerfBuffer *)my_hank->perf_records_addr;
+                if (perf_buf != nullptr) {
+                    __gm__ PerfRecord *wip = &perf_buf->wip[task_id & 1u];
+                    wip->phase_count = 0;
+                    exec_payload->local_context.perf_record = (uint64_t)wip;
+                }
+            }
 
             // Performance profiling: record start time
             uint64_t start_time = get_sys_cnt_aicore();
@@ -127,6 +183,9 @@ __aicore__ __attribute__((weak)) void aicore_execute(__gm__ Runtime *runtime, in
             // Execute the task
             execute_task(exec_payload);
 
+            // Charge the modeled kernel cost to the virtual clock (sim only)
+            SIM_CHARGE_TASK_COST(exec_payload->function_bin_addr);
+
             if (dump_tensor_enabled) {
                 pipe_barrier(PIPE_ALL);
             }
@@ -134,12 +193,13 @@ __aicore__ __attribute__((weak)) void aicore_execute(__gm__ Runtime *runtime, in
             // Performance profiling: record task execution
             if (profiling_enabled) {
                 uint64_t end_time = get_sys_cnt_aicore();
-                __gm__ PerfBuffer *perf_buf = (__gm__ PerfBuffer *)my_hank->perf_records_addr;
                 perf_aicore_record_task(perf_buf, task_id, start_time, end_time);
             }
 
             last_reg_val = reg_val;
             write_reg(RegId::COND, MAKE_FIN_VALUE(task_id));
+            my_hank->cond_doorbell = MAKE_FIN_VALUE(task_id);
+            dcci(&my_hank->cond_doorbell, SINGLE_CACHE_LINE, CACHELINE_OUT);
         }
     }
 
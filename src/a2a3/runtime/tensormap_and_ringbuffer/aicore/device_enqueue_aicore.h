@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * @file device_enqueue_aicore.h
+ * @brief Kernel-side producer for the device child-enqueue ring
+ *
+ * A kernel that discovers parallelizable work mid-execution (sparse blocks,
+ * variable-length segments) can hand it off as child tasks without
+ * finishing first: push the pre-registered child's handle plus scalar
+ * arguments into this core's enqueue ring, and the orchestration thread
+ * materializes the submits while this kernel keeps running.
+ *
+ * The handoff is restricted on purpose: children are identified by a
+ * handle from pto2_rt_register_child() and carry scalar arguments only
+ * (pass GM addresses as scalars for bulk data — the parent's live tensors
+ * are guaranteed valid until it completes).  Fanout is bounded by the ring
+ * depth; a full ring refuses the push so the kernel falls back to doing
+ * the work inline instead of ever stalling on the AICPU.
+ *
+ * Usage (inside a kernel):
+ *   uint64_t ring = get_device_enqueue_ring(args);     // intrinsic.h
+ *   uint64_t child_args[2] = {block_addr, block_rows};
+ *   if (!aicore_child_enqueue(ring, seg_handle, child_args, 2)) {
+ *       process_segment_inline(block_addr, block_rows);  // ring full or feature off
+ *   }
+ */
+
+#ifndef SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_AICORE_DEVICE_ENQUEUE_AICORE_H_
+#define SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_AICORE_DEVICE_ENQUEUE_AICORE_H_
+
+#include "aicore/signal_aicore.h"
+#include "intrinsic.h"
+
+/**
+ * Push one child request into this core's device-enqueue ring.
+ *
+ * Invalidates the cursor lines before reading them (the AICPU advances
+ * `head` concurrently), writes the entry, publishes the entry line, then
+ * publishes the advanced `tail` — the consumer never observes the cursor
+ * ahead of the entry data.  Cost is ~4 cache-line operations per push.
+ *
+ * @param ring_addr     GM ring address from get_device_enqueue_ring(args);
+ *                      0 (feature not enabled) refuses the push
+ * @param child_handle  Handle from pto2_rt_register_child()
+ * @param scalars       Scalar arguments for the child (may be NULL if 0)
+ * @param scalar_count  Number of scalars, <= PTO2_DEVICE_ENQUEUE_MAX_SCALARS
+ * @return true if the request was enqueued; false if the ring is full,
+ *         the feature is off, or scalar_count is out of range — the caller
+ *         must then handle the work itself
+ */
+__aicore__ static inline bool aicore_child_enqueue(
+    uint64_t ring_addr, int32_t child_handle, const uint64_t scalars[], int32_t scalar_count
+) {
+    if (ring_addr == 0 || scalar_count < 0 || scalar_count > PTO2_DEVICE_ENQUEUE_MAX_SCALARS) {
+        return false;
+    }
+    __gm__ PTO2DeviceEnqueueRing *ring = reinterpret_cast<__gm__ PTO2DeviceEnqueueRing *>(ring_addr);
+
+    // Fresh cursor views: head moves under the AICPU, and tail may have been
+    // advanced by a previous kernel on this core before our cache was warm.
+    dcci(&ring->head, SINGLE_CACHE_LINE);
+    dcci(&ring->tail, SINGLE_CACHE_LINE);
+    uint64_t head = ring->head;
+    uint64_t tail = ring->tail;
+    if (tail - head >= static_cast<uint64_t>(PTO2_DEVICE_ENQUEUE_DEPTH)) {
+        return false;  // bounded fanout: caller runs the work inline
+    }
+
+    __gm__ PTO2DeviceEnqueueEntry *entry =
+        &ring->entries[tail & (static_cast<uint64_t>(PTO2_DEVICE_ENQUEUE_DEPTH) - 1)];
+    *reinterpret_cast<__gm__ volatile int32_t *>(&entry->child_handle) = child_handle;
+    *reinterpret_cast<__gm__ volatile int32_t *>(&entry->scalar_count) = scalar_count;
+    for (int32_t i = 0; i < scalar_count; i++) {
+        *reinterpret_cast<__gm__ volatile uint64_t *>(&entry->scalars[i]) = scalars[i];
+    }
+    // Entry line must reach memory before the cursor does.
+    dcci(entry, SINGLE_CACHE_LINE, CACHELINE_OUT);
+    dsb((mem_dsb_t)0);
+    aicore_signal_publish(reinterpret_cast<uint64_t>(&ring->tail), tail + 1);
+    return true;
+}
+
+#endif  // SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_AICORE_DEVICE_ENQUEUE_AICORE_H_
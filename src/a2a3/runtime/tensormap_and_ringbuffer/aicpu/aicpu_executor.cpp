@@ -19,17 +19,22 @@
 #include <cstdlib>
 #include <cstring>
 #ifdef __linux__
+#include <sched.h>
 #include <sys/mman.h>
+#include <sys/syscall.h>
 #endif
 
 #include "aicpu/device_log.h"
 #include "aicpu/device_time.h"
 #include "aicpu/orch_so_file.h"
 #include "pto2_dispatch_payload.h"
+#include "pto_mem_ops.h"
 #include "runtime.h"
 #include "spin_hint.h"
 
 // Runtime headers (full struct definition for create/destroy + PTO2_SCOPE)
+#include "pto_block_autotune.h"
+#include "pto_flight_recorder.h"
 #include "pto_runtime2.h"
 #include "pto_runtime2_types.h"
 #include "pto_shared_memory.h"
@@ -82,7 +87,30 @@ constexpr int32_t MAX_AICPU_THREADS = PLATFORM_MAX_AICPU_THREADS;
 constexpr int32_t MAX_CORES_PER_THREAD = PLATFORM_MAX_CORES_PER_THREAD;
 
 constexpr int32_t MAX_IDLE_ITERATIONS = 800000;       // ~20s idle then scheduler gives up (avoid long hang)
+constexpr int32_t IDLE_TIER_PAUSE_START = 64;         // Idle iterations before pause bursts begin
+constexpr int32_t IDLE_TIER_WAIT_START = 4096;        // Idle iterations before monitor-wait is considered
+constexpr int32_t IDLE_PAUSE_WIDEN_SHIFT = 8;         // Pause burst doubles every 256 idle iterations
+constexpr int32_t IDLE_PAUSE_BURST_MAX_SHIFT = 6;     // Pause burst caps at 64 hints
+constexpr int32_t DISPATCH_LOOKAHEAD = 4;             // Extra ready entries popped per pass for best-fit packing
 constexpr int32_t STALL_LOG_INTERVAL = 50000;         // DEV_ALWAYS every N idle iters to debug hang
+constexpr uint64_t SCHED_SUMMARY_PUBLISH_INTERVAL = 8192;  // Loop iters between sched summary publishes (pow2)
+constexpr uint64_t OCC_SAMPLE_INTERVAL = 1024;             // Loop iters between ring-occupancy samples (pow2)
+constexpr uint64_t HEALTH_PUBLISH_INTERVAL = 4096;         // Loop iters between health-block publishes (pow2)
+constexpr uint32_t HEALTH_LATENCY_EWMA_SHIFT = 3;          // Dispatch-latency EWMA alpha = 1/8 per completion
+
+// Windowed load estimate for steal hysteresis (see ThreadLoadState).
+constexpr uint32_t LOAD_WINDOW_LOOPS = 256;      // Scheduler loop iterations per EWMA update
+constexpr uint32_t LOAD_EWMA_FRAC_BITS = 8;      // Fixed-point fraction bits in dispatch_ewma
+constexpr uint32_t LOAD_EWMA_DECAY_SHIFT = 2;    // EWMA alpha = 1/4 per window
+constexpr uint32_t STEAL_ENGAGE_MARGIN = 2 << LOAD_EWMA_FRAC_BITS;  // Absolute band floor (dispatches/window)
+
+// Elastic scheduler scaling (PTO2_ELASTIC_SCHED): see maybe_elastic_resize.
+constexpr uint32_t ELASTIC_EVAL_WINDOW_LOOPS = 4096;  // Controller loop iterations per scaling evaluation
+constexpr uint64_t ELASTIC_UP_DEPTH_PER_THREAD = 32;  // Ready backlog per active thread that reads as saturation
+constexpr uint64_t ELASTIC_DOWN_DEPTH = 4;            // Total ready backlog below which a thread is removable
+constexpr uint32_t ELASTIC_DOWN_EWMA = 4 << LOAD_EWMA_FRAC_BITS;  // Dispatch-EWMA ceiling for a quiet window
+constexpr int32_t ELASTIC_UP_WINDOWS = 2;    // Consecutive saturated evaluations before adding a thread
+constexpr int32_t ELASTIC_DOWN_WINDOWS = 8;  // Consecutive quiet evaluations before parking a thread
 constexpr int32_t FATAL_ERROR_CHECK_INTERVAL = 1024;  // Check orchestrator error every N idle iters
 constexpr int32_t STALL_DUMP_READY_MAX = 8;
 constexpr int32_t STALL_DUMP_WAIT_MAX = 4;
@@ -91,6 +119,28 @@ constexpr int32_t PROGRESS_VERBOSE_THRESHOLD = 10;  // log every completion for
 constexpr int32_t PROGRESS_LOG_INTERVAL = 250;      // log every N completions after threshold
 constexpr const char *DEFAULT_ORCH_ENTRY_SYMBOL = "aicpu_orchestration_entry";
 constexpr const char *DEFAULT_ORCH_CONFIG_SYMBOL = "aicpu_orchestration_config";
+constexpr int32_t ORCH_SO_CACHE_SLOTS = 4;  // Recently used orchestration SOs kept open (LRU eviction)
+
+// Content hash of the orchestration SO image (word-at-a-time FNV-1a: the
+// image is up to RUNTIME_MAX_ORCH_SO_SIZE and hashed once per round, so
+// byte-wise FNV would be needlessly slow). Content-keyed so a rebuilt model
+// never matches a stale cache entry.
+static uint64_t orch_so_content_hash(const void *data, size_t size) {
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    uint64_t h = 0xCBF29CE484222325ULL;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, p + i, sizeof(word));
+        h ^= word;
+        h *= 0x100000001B3ULL;
+    }
+    for (; i < size; i++) {
+        h ^= p[i];
+        h *= 0x100000001B3ULL;
+    }
+    return h;
+}
 
 // Control flow signal from cold-path helpers back to the main dispatch loop.
 enum class LoopAction : int8_t {
@@ -268,6 +318,17 @@ public:
         return BitStates(0ULL);
     }
 
+    // Cluster identity for affinity matching: the AIC worker id of the cluster
+    // containing the core at `offset` (valid for cluster and per-core offsets).
+    int32_t get_cluster_aic_id(int32_t offset) const { return core_id_map_[offset - offset % 3]; }
+
+    // True when all 3 cores of the cluster containing `offset` are idle —
+    // i.e. the cluster is still whole and could host a MIX task.
+    bool is_cluster_fully_idle(int32_t offset) const {
+        int32_t base = offset - offset % 3;
+        return ((core_states_ >> base) & BitStates(7ULL)).count() == 3;
+    }
+
     int32_t get_aic_core_id(int32_t cluster_offset) const { return core_id_map_[cluster_offset]; }
     int32_t get_aiv0_core_id(int32_t cluster_offset) const { return core_id_map_[cluster_offset + 1]; }
     int32_t get_aiv1_core_id(int32_t cluster_offset) const { return core_id_map_[cluster_offset + 2]; }
@@ -351,6 +412,38 @@ public:
                                                 get_pending_core_offset_states(shape);
     }
 
+    // --- Gang reservation (all-or-nothing) ---
+
+    // Carve exactly `k` core offsets for a cooperative gang out of the
+    // caller's idle snapshot, or leave the snapshot untouched and return an
+    // empty mask when fewer than k cores are available — a gang never
+    // assembles partially. AIV gangs take whole cluster pairs first so
+    // members that synchronize core-to-core share a cluster wherever the
+    // mask allows; AIC and MIX masks carry one bit per cluster, so those
+    // gangs simply take the lowest offsets.
+    BitStates try_reserve_gang(BitStates &cores, PTO2ResourceShape shape, int32_t k) const {
+        if (cores.count() < k) return BitStates(0ULL);
+        BitStates gang;
+        int32_t taken = 0;
+        if (shape == PTO2ResourceShape::AIV) {
+            BitStates scan = cores;
+            for (int32_t off = scan.pop_first(); off >= 0 && taken + 1 < k; off = scan.pop_first()) {
+                BitStates pair = BitStates(6ULL << (off - off % 3));
+                if ((cores & pair).count() == 2 && !(gang & pair).has_value()) {
+                    gang |= pair;
+                    taken += 2;
+                }
+            }
+        }
+        BitStates rest = cores & ~gang;
+        while (taken < k) {
+            gang |= BitStates(1ULL << rest.pop_first());
+            taken++;
+        }
+        cores &= ~gang;
+        return gang;
+    }
+
     // --- Bit offset <-> worker_id mapping ---
 
     int32_t get_core_id_by_offset(int32_t offset) const { return core_id_map_[offset]; }
@@ -378,6 +471,9 @@ struct AicpuExecutor {
     std::atomic<bool> finished_{false};
 
     int32_t thread_num_{0};
+    int32_t calibration_ops_{0};  // No-op dispatches per scheduler thread (PTO2_DISPATCH_CALIBRATION, 0 = off)
+    bool pin_cpus_enabled_{false};                       // Explicit per-thread CPU placement (PTO2_SCHED_CPUS)
+    int32_t pin_cpu_of_thread_[MAX_AICPU_THREADS] = {};  // thread_idx -> CPU id when enabled
     int32_t cores_total_num_{0};
     int32_t thread_cores_num_{0};  // Cores per scheduler thread (0 for orchestrator when thread_num_==4)
     int32_t core_count_per_thread_[MAX_AICPU_THREADS];  // Actual core count per thread
@@ -386,17 +482,141 @@ struct AicpuExecutor {
     // Per-core execution state, indexed by core_id (= worker_id)
     CoreExecState core_exec_states_[RUNTIME_MAX_WORKER];
 
+    // Doorbell value at the last COND transition applied per core (see
+    // check_running_cores_for_completion). Indexed by core_id; each entry is
+    // touched only by the core's owning scheduler thread, and writes occur at
+    // completion rate, so cross-entry false sharing is negligible.
+    uint64_t last_cond_doorbell_[RUNTIME_MAX_WORKER] = {};
+
     // Cluster-ordered worker_id lists for core assignment (init-only)
     int32_t aic_worker_ids_[MAX_CORES_PER_THREAD];
     int32_t aiv_worker_ids_[MAX_CORES_PER_THREAD];
     int32_t aic_count_{0};
     int32_t aiv_count_{0};
 
+    // core_id -> AIC worker id of its cluster, for stamping affinity hints at
+    // completion. Filled once at initial core assignment; the cluster topology
+    // (worker id triples) does not change on reassignment.
+    int32_t cluster_aic_wid_of_core_[RUNTIME_MAX_WORKER] = {};
+
     // Platform register base address array (set via get_platform_regs())
     uint64_t regs_{0};
 
     CoreTracker core_trackers_[MAX_AICPU_THREADS];
 
+    // Local-first dispatch buffers (one per resource shape per scheduling
+    // thread). Class members rather than loop-stack storage so work-stealing
+    // peers can safely probe a registered buffer for the whole run. Slot
+    // storage is inline in the deque (PTO2_LOCAL_READY_CAP entries each).
+    static constexpr int32_t LOCAL_READY_CAP_PER_TYPE = PTO2LocalReadyBuffer::kCapacity;
+    PTO2LocalReadyBuffer local_ready_bufs_[MAX_AICPU_THREADS][PTO2_NUM_RESOURCE_SHAPES];
+
+    // Windowed load estimate driving steal hysteresis.  Work stealing is the
+    // only dynamic load movement between scheduler threads (core ownership is
+    // rebalanced exactly once, when orchestration completes), and stealing on
+    // every empty pop reacts to instantaneous imbalance: a momentarily-ahead
+    // thread drains a peer's local buffer, both lose the warm locality the
+    // buffers exist for, and the tasks ping-pong back the next iteration.
+    // Each thread folds its dispatch count into a fixed-point EWMA once per
+    // LOAD_WINDOW_LOOPS iterations and only steals while engaged: engage when
+    // the busiest peer's EWMA exceeds twice our own plus a margin, disengage
+    // when it falls back under 1.5x.  Starts engaged so the startup ramp
+    // (all EWMAs still zero) behaves like the ungated scheduler.
+    struct alignas(64) ThreadLoadState {
+        std::atomic<uint32_t> dispatch_ewma{0};  // Fixed point (LOAD_EWMA_FRAC_BITS); peers read relaxed
+        uint32_t window_dispatches{0};           // Owner-only accumulator for the current window
+        uint32_t window_loops{0};                // Owner-only loop counter for the current window
+        bool steal_engaged{true};                // Sticky between the two hysteresis bands (owner-only)
+        uint32_t steal_engage_count{0};          // Times steal mode was (re-)engaged (owner-only)
+    };
+    ThreadLoadState thread_load_[MAX_AICPU_THREADS];
+
+    // Always-on dispatch → completion latency estimate feeding the shared
+    // health block. Folded at task completion from the first-dispatch stamp
+    // (autotune_dispatch_cnt); owner-thread plain writes, thread 0 reads the
+    // slots at publish time — a stale word is fine for trend data.
+    struct alignas(64) HealthLatencyState {
+        uint64_t ewma_ticks{0};
+    };
+    HealthLatencyState health_latency_[MAX_AICPU_THREADS];
+
+    // Thread-0 publish state for the shared health block (owner-only).
+    uint64_t health_prev_completed_{0};
+    uint64_t health_prev_sys_cnt_{0};
+    uint32_t health_publish_count_{0};
+    uint32_t health_alloc_stall_samples_{0};
+
+    // Refresh the shared-memory health block from state the scheduler
+    // already tracks: global completion count, per-ring flow control, the
+    // per-thread latency EWMAs, and the header error codes. Always on —
+    // no profiling build or gate required; the hot loop pays one counter
+    // test and everything else lives here, once per HEALTH_PUBLISH_INTERVAL
+    // iterations on thread 0. Seqlock write: the field stores are fenced
+    // between two seq bumps so the host's DMA snapshot can detect a torn
+    // read and retry (see read_health_metrics_impl on the host side).
+    PTO2_COLD_PATH void publish_health_metrics(PTO2SharedMemoryHeader *header) {
+        uint64_t now = get_sys_cnt_aicpu();
+        uint64_t completed = static_cast<uint64_t>(completion_tree_.observe());
+        uint64_t tasks_live = 0;
+        uint64_t heap_live = 0;
+        bool window_full = false;
+        for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+            const auto &ring = header->rings[r];
+            int32_t live = ring.fc.current_task_index.load(std::memory_order_relaxed) -
+                           ring.fc.last_task_alive.load(std::memory_order_relaxed);
+            if (live > 0) tasks_live += static_cast<uint64_t>(live);
+            if (ring.task_window_size > 0 && live + 1 >= static_cast<int32_t>(ring.task_window_size)) {
+                // Full task window at sample time: the orchestrator's alloc()
+                // is (or is about to be) stalled on reclamation.
+                window_full = true;
+            }
+            uint64_t heap_top = ring.fc.heap_top.load(std::memory_order_relaxed);
+            uint64_t heap_tail = ring.fc.heap_tail.load(std::memory_order_relaxed);
+            if (heap_top > heap_tail) heap_live += heap_top - heap_tail;
+        }
+        if (window_full) health_alloc_stall_samples_++;
+
+        // Completion rate over the publish interval (zero until the second
+        // publish — there is no previous stamp to difference against).
+        uint64_t rate = 0;
+        uint64_t dt = now - health_prev_sys_cnt_;
+        if (health_prev_sys_cnt_ != 0 && dt > 0) {
+            rate = (completed - health_prev_completed_) * PLATFORM_PROF_SYS_CNT_FREQ / dt;
+        }
+        health_prev_completed_ = completed;
+        health_prev_sys_cnt_ = now;
+
+        // Average the per-thread latency EWMAs, skipping threads that have
+        // not completed anything yet.
+        uint64_t lat_sum = 0;
+        uint32_t lat_n = 0;
+        for (int32_t t = 0; t < thread_num_; t++) {
+            uint64_t e = health_latency_[t].ewma_ticks;
+            if (e != 0) {
+                lat_sum += e;
+                lat_n++;
+            }
+        }
+
+        auto &h = header->health;
+        uint32_t seq = h.seq.load(std::memory_order_relaxed);
+        h.seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        h.publish_count = ++health_publish_count_;
+        h.publish_sys_cnt = now;
+        h.sys_cnt_freq_hz = PLATFORM_PROF_SYS_CNT_FREQ;
+        h.tasks_completed = completed;
+        h.tasks_per_sec = rate;
+        h.dispatch_latency_ewma = lat_n != 0 ? lat_sum / lat_n : 0;
+        h.ring_tasks_live = tasks_live;
+        h.heap_bytes_live = heap_live;
+        h.alloc_stall_samples = health_alloc_stall_samples_;
+        h.orch_error_code = header->orch_error_code.load(std::memory_order_relaxed);
+        h.sched_error_code = header->sched_error_code.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        h.seq.store(seq + 2, std::memory_order_relaxed);
+    }
+
 #if PTO2_PROFILING
     // Per-thread scheduler profiling counters.
     // Stored as member to avoid passing 20+ counters through function signatures.
@@ -412,6 +632,10 @@ struct AicpuExecutor {
         uint64_t sched_loop_count{0};
         uint32_t phase_complete_count{0};
         uint32_t phase_dispatch_count{0};
+        // Idle-interval attribution for cores owned by this thread
+        // (indexed by PerfIdleCause, tagged at idle transition)
+        uint64_t idle_cause_cycle[PERF_IDLE_CAUSE_COUNT]{};
+        uint64_t idle_cause_count[PERF_IDLE_CAUSE_COUNT]{};
 #if PTO2_SCHED_PROFILING
         uint32_t phase_wiring_count{0};
         uint64_t complete_probe_count{0};
@@ -421,17 +645,169 @@ struct AicpuExecutor {
         uint64_t notify_tasks_enqueued{0};
         uint64_t fanin_edges_total{0};
         int32_t fanin_max_degree{0};
+        uint64_t early_release_count{0};
         uint64_t pop_hit{0};
         uint64_t pop_miss{0};
         uint64_t local_dispatch_count{0};
         uint64_t local_overflow_count{0};
+        uint64_t steal_count{0};
         uint64_t sched_complete_perf_cycle{0};
         uint64_t sched_dispatch_pop_cycle{0};
         uint64_t sched_dispatch_setup_cycle{0};
+        uint64_t idle_tier_cycle[3]{};  // Time spent in idle back-off tiers: spin / pause / wait
 #endif
         void reset() { *this = SchedProfilingCounters{}; }
     };
     SchedProfilingCounters sched_perf_[MAX_AICPU_THREADS];
+
+    // Idle-interval attribution: timestamp and cause captured when a core
+    // transitions to idle, interval closed on the next dispatch to that core.
+    // Each entry is touched only by the core's owning scheduler thread.
+    // since == 0 means no open interval (startup idle is not attributed).
+    uint64_t core_idle_since_[RUNTIME_MAX_WORKER] = {};
+    uint8_t core_idle_cause_[RUNTIME_MAX_WORKER] = {};
+
+    // PMU sampling (host opts in via SIMPLER_PERF_PMU_INTERVAL): baseline
+    // counter values read at dispatch, consumed as deltas at completion.
+    // Armed only on idle-core dispatches — a pipelined pending dispatch would
+    // overlap the running task and pollute attribution. Each entry is touched
+    // only by the core's owning scheduler thread.
+    uint32_t pmu_sample_interval_{0};  // cached from PerfDataHeader; 0 = off
+    uint32_t core_pmu_base_[RUNTIME_MAX_WORKER][2] = {};  // [0] cache miss, [1] bus access
+    uint8_t core_pmu_armed_[RUNTIME_MAX_WORKER] = {};
+
+    // Shared-memory header cached for idle-cause classification (flow-control
+    // reads); set once per run in pto2_dispatch before the scheduler loop.
+    PTO2SharedMemoryHeader *prof_sm_header_{nullptr};
+
+    // Classify why a core has nothing to run at the moment it goes idle,
+    // from state already visible to the scheduler: drain flags, per-ring
+    // flow control, and the global completion count. Live tasks running on
+    // other cores are indistinguishable from dependency-blocked ones here,
+    // so WAITING_FANIN over-approximates (documented in PerfIdleCause).
+    PerfIdleCause classify_idle_cause() const {
+        if (orchestrator_done_ || drain_state_.sync_start_pending.load(std::memory_order_relaxed) != 0) {
+            return PerfIdleCause::DRAIN;
+        }
+        if (prof_sm_header_ == nullptr) {
+            return PerfIdleCause::NO_READY_TASK;
+        }
+        int32_t submitted = 0;
+        for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+            const auto &ring = prof_sm_header_->rings[r];
+            int32_t cur = ring.fc.current_task_index.load(std::memory_order_relaxed);
+            if (ring.task_window_size > 0 &&
+                cur - ring.fc.last_task_alive.load(std::memory_order_relaxed) + 1 >=
+                    static_cast<int32_t>(ring.task_window_size)) {
+                // Full task window: the orchestrator's alloc() is spinning on
+                // last_task_alive — idle caused by upstream back-pressure.
+                return PerfIdleCause::ALLOC_STALL;
+            }
+            submitted += cur;
+        }
+        if (submitted > completion_tree_.observe()) {
+            return PerfIdleCause::WAITING_FANIN;
+        }
+        return PerfIdleCause::NO_READY_TASK;
+    }
+
+    // Snapshot ring occupancy (tasks live, heap bytes live, spill-pool fill)
+    // into an OCC_RING_SAMPLE phase record so occupancy ramps are visible in
+    // the profiling stream before they hit sizing cliffs — today they only
+    // surface post-mortem in diagnose_stuck_state(). Thread 0 only (owner of
+    // dep_pool); fanin_pool counters are single-writer plain ints on the
+    // orchestrator thread, so a sample may be slightly stale, which is fine
+    // for trend data. Cold path: once per OCC_SAMPLE_INTERVAL iterations.
+    PTO2_COLD_PATH void record_ring_occupancy_sample(int32_t thread_idx, uint64_t loop_count) {
+        if (prof_sm_header_ == nullptr || rt == nullptr) {
+            return;
+        }
+        uint64_t now = get_sys_cnt_aicpu();
+        uint64_t tasks_live = 0;
+        uint64_t heap_live = 0;
+        uint32_t fanin_used = 0;
+        uint32_t dep_used = 0;
+        for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+            const auto &fc = prof_sm_header_->rings[r].fc;
+            int32_t live = fc.current_task_index.load(std::memory_order_relaxed) -
+                           fc.last_task_alive.load(std::memory_order_relaxed);
+            if (live > 0) tasks_live += static_cast<uint64_t>(live);
+            uint64_t heap_top = fc.heap_top.load(std::memory_order_relaxed);
+            uint64_t heap_tail = fc.heap_tail.load(std::memory_order_relaxed);
+            if (heap_top > heap_tail) heap_live += heap_top - heap_tail;
+            int32_t fanin = rt->orchestrator.rings[r].fanin_pool.used();
+            if (fanin > 0) fanin_used += static_cast<uint32_t>(fanin);
+            int32_t dep = rt->scheduler.ring_sched_states[r].dep_pool.used();
+            if (dep > 0) dep_used += static_cast<uint32_t>(dep);
+        }
+        if (fanin_used > 0xFFFF) fanin_used = 0xFFFF;
+        if (dep_used > 0xFFFF) dep_used = 0xFFFF;
+        uint64_t packed = (tasks_live << 32) | (static_cast<uint64_t>(fanin_used) << 16) | dep_used;
+        perf_aicpu_record_phase(
+            thread_idx, AicpuPhaseId::OCC_RING_SAMPLE, now, heap_live, static_cast<uint32_t>(loop_count), packed
+        );
+    }
+
+    // Build the loop-phase and idle-attribution portion of the summary from
+    // sched_perf_; PTO2_SCHED_PROFILING layers the fine-grained scheduler
+    // fields on top in publish_sched_profiling.
+    void fill_sched_summary(int32_t thread_idx, AicpuSchedSummary &summary) const {
+        const auto &perf = sched_perf_[thread_idx];
+        summary.complete_cycle = perf.sched_complete_cycle;
+        summary.dispatch_cycle = perf.sched_dispatch_cycle;
+        summary.scan_cycle = perf.sched_scan_cycle;
+        summary.wiring_cycle = perf.sched_wiring_cycle;
+        summary.idle_cycle = perf.sched_idle_cycle;
+        summary.loop_count = perf.sched_loop_count;
+        for (uint32_t c = 0; c < PERF_IDLE_CAUSE_COUNT; c++) {
+            summary.idle_cause_cycle[c] = perf.idle_cause_cycle[c];
+            summary.idle_cause_count[c] = perf.idle_cause_count[c];
+        }
+    }
+
+#if PTO2_SCHED_PROFILING
+    // Run-to-date totals of the scheduler's fine-grained counters.
+    // pto2_scheduler_get_profiling() is a destructive read (exchange to 0),
+    // so the periodic publisher drains into these and both the shared-memory
+    // summary and the end-of-run log report cumulative values.
+    PTO2SchedProfilingData sched_prof_cum_[MAX_AICPU_THREADS] = {};
+
+    // Drain the scheduler's counters into sched_prof_cum_ and republish the
+    // thread's cumulative cycle breakdown to the phase-profiling shared
+    // region. Cold path: once per SCHED_SUMMARY_PUBLISH_INTERVAL loop
+    // iterations and once at shutdown.
+    PTO2_COLD_PATH void publish_sched_profiling(int32_t thread_idx) {
+        PTO2SchedProfilingData sp = pto2_scheduler_get_profiling(thread_idx);
+        PTO2SchedProfilingData &cum = sched_prof_cum_[thread_idx];
+        cum.lock_cycle += sp.lock_cycle;
+        cum.fanout_cycle += sp.fanout_cycle;
+        cum.fanin_cycle += sp.fanin_cycle;
+        cum.self_consumed_cycle += sp.self_consumed_cycle;
+        cum.lock_wait_cycle += sp.lock_wait_cycle;
+        cum.push_wait_cycle += sp.push_wait_cycle;
+        cum.pop_wait_cycle += sp.pop_wait_cycle;
+        cum.lock_atomic_count += sp.lock_atomic_count;
+        cum.fanout_atomic_count += sp.fanout_atomic_count;
+        cum.fanin_atomic_count += sp.fanin_atomic_count;
+        cum.self_atomic_count += sp.self_atomic_count;
+        cum.pop_atomic_count += sp.pop_atomic_count;
+        cum.complete_count += sp.complete_count;
+
+        AicpuSchedSummary summary = {};
+        fill_sched_summary(thread_idx, summary);
+        summary.lock_cycle = cum.lock_cycle;
+        summary.fanout_cycle = cum.fanout_cycle;
+        summary.fanin_cycle = cum.fanin_cycle;
+        summary.self_consumed_cycle = cum.self_consumed_cycle;
+        summary.lock_wait_cycle = cum.lock_wait_cycle;
+        summary.push_wait_cycle = cum.push_wait_cycle;
+        summary.pop_wait_cycle = cum.pop_wait_cycle;
+        summary.atomic_count = cum.lock_atomic_count + cum.fanout_atomic_count + cum.fanin_atomic_count +
+                               cum.self_atomic_count + cum.pop_atomic_count;
+        summary.complete_count = cum.complete_count;
+        perf_aicpu_write_sched_summary(thread_idx, &summary);
+    }
+#endif
 #endif
 
     // ===== sync_start drain coordination =====
@@ -450,8 +826,52 @@ struct AicpuExecutor {
 
     // ===== Task queue state (managed by scheduler ready queues) =====
 
-    // Task execution tracking
-    std::atomic<int32_t> completed_tasks_{0};
+    // Tree-structured completion counting. Each thread owns a padded leaf and
+    // bumps it single-writer; thread 0 folds the leaves and publishes the
+    // root. Convergence checks (all-tasks-done, progress and stall
+    // diagnostics) observe only the root — one cache line with a single
+    // writer — so completion-count coherence traffic stops growing with
+    // aicpu_thread_num, instead of every thread bouncing fetch_add/load on
+    // one shared counter.
+    struct CompletionTree {
+        struct alignas(64) Leaf {
+            std::atomic<int32_t> count{0};
+            int32_t _pad[15];
+        };
+        static_assert(sizeof(Leaf) == 64);
+        Leaf leaves[MAX_AICPU_THREADS];
+        alignas(64) std::atomic<int32_t> root{0};
+
+        void reset() {
+            for (Leaf &leaf : leaves) {
+                leaf.count.store(0, std::memory_order_relaxed);
+            }
+            root.store(0, std::memory_order_release);
+        }
+
+        // Single writer per leaf: plain load + release store, no RMW.
+        void add(int32_t thread_idx, int32_t n) {
+            Leaf &leaf = leaves[thread_idx];
+            leaf.count.store(leaf.count.load(std::memory_order_relaxed) + n, std::memory_order_release);
+        }
+
+        // Fold all leaves and publish the root. Thread 0 only (single root
+        // writer). Fixed leaf count covers parked elastic threads and the
+        // orchestrator thread's inline-completed leaf; an unchanged leaf
+        // stays in this core's cache, so a fold only transfers the lines
+        // that actually counted new completions.
+        int32_t fold() {
+            int32_t total = 0;
+            for (const Leaf &leaf : leaves) {
+                total += leaf.count.load(std::memory_order_acquire);
+            }
+            root.store(total, std::memory_order_release);
+            return total;
+        }
+
+        int32_t observe() const { return root.load(std::memory_order_relaxed); }
+    };
+    CompletionTree completion_tree_;
     int32_t total_tasks_{0};
     std::atomic<int32_t> finished_count_{0};
     // Device orchestration: set by last orchestrator when graph is built; schedulers poll it.
@@ -467,9 +887,43 @@ struct AicpuExecutor {
     std::atomic<bool> reassigned_{false};
     std::atomic<bool> completed_{false};
 
-    // Orchestration SO handle - defer dlclose until all tasks complete
+    // ===== Elastic scheduler scaling state (PTO2_ELASTIC_SCHED) =====
+    bool elastic_sched_{false};               // Env opt-in; scheduler thread 0 is the controller
+    int32_t elastic_max_threads_{0};          // Ceiling = dispatch-thread count when scaling engages (0 = not yet)
+    int32_t elastic_min_threads_{1};          // Floor: every cluster triple must still fit some tracker
+    std::atomic<int32_t> elastic_active_{0};  // Mirror of active_sched_threads_ that parked threads may poll
+    std::atomic<bool> elastic_resize_pending_{false};  // Controller-raised quiesce barrier
+    std::atomic<int32_t> elastic_ack_{0};              // Active peers standing at the barrier
+    // Controller-only evaluation state
+    uint32_t elastic_eval_loops_{0};
+    int32_t elastic_hi_windows_{0};
+    int32_t elastic_lo_windows_{0};
+
+    // Orchestration SO handle for the current round (owned by the cache below)
     void *orch_so_handle_{nullptr};
-    char orch_so_path_[256]{};  // Path to orchestration SO file for cleanup
+
+    // Orchestration SO cache: recently used orchestration libraries kept
+    // open with resolved symbols, keyed by image content hash, so switching
+    // between models costs a table lookup instead of a file write + dlopen
+    // cycle. Entries own their dlopen handle and backing file; both are
+    // released only on LRU eviction (or leaked at process teardown, like the
+    // kernel process itself).
+    struct OrchSoCacheEntry {
+        uint64_t so_hash{0};
+        uint64_t last_used{0};  // LRU tick; 0 = free slot
+        void *handle{nullptr};
+        char so_path[256]{};
+        char entry_symbol[RUNTIME_MAX_ORCH_SYMBOL_NAME]{};
+        char config_symbol[RUNTIME_MAX_ORCH_SYMBOL_NAME]{};
+        DeviceOrchestrationFunc orch_func{nullptr};
+        DeviceOrchestrationConfigFunc config_func{nullptr};
+        DeviceOrchestrationBindRuntimeFunc bind_runtime_func{nullptr};
+    };
+    OrchSoCacheEntry orch_so_cache_[ORCH_SO_CACHE_SLOTS];
+    uint64_t orch_so_cache_tick_{0};
+
+    OrchSoCacheEntry *orch_so_cache_find(uint64_t so_hash);
+    OrchSoCacheEntry *orch_so_cache_insert(const OrchSoCacheEntry &fresh);
 
     // Shared orchestration function pointer (loaded by first orch thread, used by all)
     DeviceOrchestrationFunc orch_func_{nullptr};
@@ -486,8 +940,19 @@ struct AicpuExecutor {
     int32_t init(Runtime *runtime);
     int32_t handshake_all_cores(Runtime *runtime);
     bool assign_cores_to_threads();
-    void reassign_cores_for_all_threads();
-    int32_t resolve_and_dispatch_pto2(Runtime *runtime, int32_t thread_idx);
+    void reassign_cores_for_all_threads(int32_t target_threads);
+    void maybe_elastic_resize();
+    void apply_elastic_resize(int32_t target);
+    LoopAction handle_elastic_scaling(
+        int32_t thread_idx, PTO2TaskSlotState **deferred_release_slot_states, int32_t &deferred_release_count,
+        int32_t &idle_iterations
+    );
+    // Declared inline so its linkage matches the in-class hot helpers: a
+    // named code section cannot mix comdat and plain functions.
+    PTO2_HOT_PATH inline int32_t resolve_and_dispatch_pto2(Runtime *runtime, int32_t thread_idx);
+    void run_dispatch_calibration(Runtime *runtime, int32_t thread_idx);
+    int32_t parse_sched_cpus(const char *spec);
+    int32_t pin_to_configured_cpu(int32_t thread_idx);
     int32_t shutdown_aicore(Runtime *runtime, int32_t thread_idx, const int32_t *cur_thread_cores, int32_t core_num);
     int32_t run(Runtime *runtime);
     void deinit(Runtime *runtime);
@@ -498,7 +963,7 @@ struct AicpuExecutor {
 
     // --- Cold-path helpers for resolve_and_dispatch_pto2 (noinline to reduce hot-loop icache) ---
 
-    __attribute__((noinline, cold)) LoopAction handle_orchestrator_exit(
+    PTO2_COLD_PATH LoopAction handle_orchestrator_exit(
         int32_t thread_idx, PTO2SharedMemoryHeader *header, Runtime *runtime, int32_t &task_count
     ) {
         bool orch_done = orchestrator_done_;
@@ -509,7 +974,7 @@ struct AicpuExecutor {
             DEV_ERROR(
                 "Thread %d: Fatal error (code=%d), sending EXIT_SIGNAL to all cores. "
                 "completed_tasks=%d, total_tasks=%d",
-                thread_idx, orch_err, completed_tasks_.load(std::memory_order_relaxed), total_tasks_
+                thread_idx, orch_err, completion_tree_.observe(), total_tasks_
             );
             emergency_shutdown(runtime);
             completed_.store(true, std::memory_order_release);
@@ -517,18 +982,18 @@ struct AicpuExecutor {
         }
 
         task_count = total_tasks_;
-        if (task_count > 0 && completed_tasks_.load(std::memory_order_relaxed) >= task_count) {
+        // Thread 0 is the fold owner; everyone else observes the published
+        // root, keeping the convergence check off the leaf lines.
+        int32_t completed = (thread_idx == 0) ? completion_tree_.fold() : completion_tree_.observe();
+        if (task_count > 0 && completed >= task_count) {
             completed_.store(true, std::memory_order_release);
-            DEV_INFO(
-                "Thread %d: PTO2 completed tasks %d/%d", thread_idx, completed_tasks_.load(std::memory_order_relaxed),
-                task_count
-            );
+            DEV_INFO("Thread %d: PTO2 completed tasks %d/%d", thread_idx, completed, task_count);
             return LoopAction::BREAK_LOOP;
         }
         return LoopAction::NONE;
     }
 
-    __attribute__((noinline, cold)) LoopAction handle_core_transition(bool &cores_released) {
+    PTO2_COLD_PATH LoopAction handle_core_transition(bool &cores_released) {
         if (!transition_requested_.load(std::memory_order_acquire)) return LoopAction::NONE;
         if (!reassigned_.load(std::memory_order_acquire)) {
             wait_reassign_.fetch_add(1, std::memory_order_release);
@@ -543,7 +1008,7 @@ struct AicpuExecutor {
         return LoopAction::NONE;
     }
 
-    __attribute__((noinline, cold)) LoopAction
+    PTO2_COLD_PATH LoopAction
     check_idle_fatal_error(int32_t thread_idx, PTO2SharedMemoryHeader *header, Runtime *runtime) {
         int32_t orch_err = header->orch_error_code.load(std::memory_order_acquire);
         if (orch_err != PTO2_ERROR_NONE) {
@@ -557,10 +1022,10 @@ struct AicpuExecutor {
         return LoopAction::NONE;
     }
 
-    __attribute__((noinline, cold)) void log_stall_diagnostics(
+    PTO2_COLD_PATH void log_stall_diagnostics(
         int32_t thread_idx, int32_t task_count, int32_t idle_iterations, int32_t last_progress_count, void *sm_base
     ) {
-        int32_t c = completed_tasks_.load(std::memory_order_relaxed);
+        int32_t c = completion_tree_.observe();
         DEV_ALWAYS(
             "PTO2 stall: no progress for %d iterations, completed=%d total=%d (last progress at %d)", idle_iterations,
             c, task_count, last_progress_count
@@ -573,29 +1038,31 @@ struct AicpuExecutor {
             int32_t ring_task_count = sm_header_diag->rings[r].fc.current_task_index.load(std::memory_order_relaxed);
             for (int32_t si = 0; si < ring_task_count; si++) {
                 PTO2TaskSlotState &slot_state = sched->get_slot_state(r, si);
-                PTO2TaskState st = slot_state.task_state.load(std::memory_order_relaxed);
-                int32_t rc = slot_state.fanin_refcount.load(std::memory_order_relaxed);
-                int32_t fi = slot_state.fanin_count;
+                uint64_t word = slot_state.state_word.load(std::memory_order_relaxed);
+                PTO2TaskState st = pto2_task_state_of(word);
+                uint32_t remaining = pto2_fanin_remaining(word);
                 int32_t kid = slot_state.task->kernel_id[0];
                 if (st >= PTO2_TASK_COMPLETED) continue;
-                if (st == PTO2_TASK_READY || st == PTO2_TASK_RUNNING) {
+                if (st == PTO2_TASK_READY) {
                     cnt_inflight++;
                     continue;
                 }
-                if (rc >= fi) {
+                if (remaining == 0) {
                     cnt_ready++;
                     if (cnt_ready <= STALL_DUMP_READY_MAX) {
                         DEV_ALWAYS(
-                            "  STUCK-READY  ring=%d task_id=%" PRId64 " kernel_id=%d refcount=%d fanin=%d state=%d", r,
-                            static_cast<int64_t>(slot_state.task->task_id.raw), kid, rc, fi, static_cast<int32_t>(st)
+                            "  STUCK-READY  ring=%d task_id=%" PRId64 " kernel_id=%d fanin_remaining=%u state=%d", r,
+                            static_cast<int64_t>(slot_state.task->task_id.raw), kid, remaining,
+                            static_cast<int32_t>(st)
                         );
                     }
                 } else {
                     cnt_waiting++;
                     if (cnt_waiting <= STALL_DUMP_WAIT_MAX) {
                         DEV_ALWAYS(
-                            "  STUCK-WAIT   ring=%d task_id=%" PRId64 " kernel_id=%d refcount=%d fanin=%d state=%d", r,
-                            static_cast<int64_t>(slot_state.task->task_id.raw), kid, rc, fi, static_cast<int32_t>(st)
+                            "  STUCK-WAIT   ring=%d task_id=%" PRId64 " kernel_id=%d fanin_remaining=%u state=%d", r,
+                            static_cast<int64_t>(slot_state.task->task_id.raw), kid, remaining,
+                            static_cast<int32_t>(st)
                         );
                     }
                 }
@@ -639,7 +1106,21 @@ struct AicpuExecutor {
         }
     }
 
-    __attribute__((noinline, cold)) int32_t handle_timeout_exit(
+    // Thread-0 progress banner: DEV_ALWAYS formatting (float percentage)
+    // has no business inlined in the completion path, and the interval
+    // arithmetic only runs when something completed.
+    PTO2_COLD_PATH void log_progress(int32_t new_total, int32_t task_count, int32_t completed_this_turn) {
+        int32_t prev = new_total - completed_this_turn;
+        if (new_total <= PROGRESS_VERBOSE_THRESHOLD ||
+            new_total / PROGRESS_LOG_INTERVAL != prev / PROGRESS_LOG_INTERVAL || new_total >= task_count) {
+            DEV_ALWAYS(
+                "PTO2 progress: completed=%d total=%d (%.1f%%)", new_total, task_count,
+                100.0 * new_total / task_count
+            );
+        }
+    }
+
+    PTO2_COLD_PATH int32_t handle_timeout_exit(
         int32_t thread_idx, int32_t idle_iterations
 #if PTO2_PROFILING
         ,
@@ -659,7 +1140,7 @@ struct AicpuExecutor {
     }
 
 #if PTO2_PROFILING
-    __attribute__((noinline, cold)) void log_profiling_summary(int32_t thread_idx, int32_t cur_thread_completed) {
+    PTO2_COLD_PATH void log_profiling_summary(int32_t thread_idx, int32_t cur_thread_completed) {
         auto &perf = sched_perf_[thread_idx];
         uint64_t sched_end_ts = get_sys_cnt_aicpu();
         DEV_ALWAYS(
@@ -674,7 +1155,10 @@ struct AicpuExecutor {
 
 #if PTO2_SCHED_PROFILING
         {
-            PTO2SchedProfilingData sp = pto2_scheduler_get_profiling(thread_idx);
+            // Final drain + publish so the shared-memory summary and this log
+            // both cover the full run.
+            publish_sched_profiling(thread_idx);
+            const PTO2SchedProfilingData &sp = sched_prof_cum_[thread_idx];
             uint64_t otc_total = sp.lock_cycle + sp.fanout_cycle + sp.fanin_cycle + sp.self_consumed_cycle;
             uint64_t complete_poll = (perf.sched_complete_cycle > otc_total + perf.sched_complete_perf_cycle) ?
                                          (perf.sched_complete_cycle - otc_total - perf.sched_complete_perf_cycle) :
@@ -696,10 +1180,11 @@ struct AicpuExecutor {
             DEV_ALWAYS(
                 "Thread %d:   complete       : %.3fus (%.1f%%)  [fanout: edges=%" PRIu64
                 ", max_degree=%d, avg=%.1f]  [fanin: "
-                "edges=%" PRIu64 ", max_degree=%d, avg=%.1f]",
+                "edges=%" PRIu64 ", max_degree=%d, avg=%.1f, early_rel=%" PRIu64 "]",
                 thread_idx, cycles_to_us(perf.sched_complete_cycle), perf.sched_complete_cycle * 100.0 / sched_total,
                 static_cast<uint64_t>(perf.notify_edges_total), perf.notify_max_degree, notify_avg,
-                static_cast<uint64_t>(perf.fanin_edges_total), perf.fanin_max_degree, fanin_avg
+                static_cast<uint64_t>(perf.fanin_edges_total), perf.fanin_max_degree, fanin_avg,
+                static_cast<uint64_t>(perf.early_release_count)
             );
 
             uint64_t c_parent = perf.sched_complete_cycle > 0 ? perf.sched_complete_cycle : 1;
@@ -754,10 +1239,16 @@ struct AicpuExecutor {
             double local_hit_rate = total_dispatched > 0 ? perf.local_dispatch_count * 100.0 / total_dispatched : 0.0;
             DEV_ALWAYS(
                 "Thread %d:     local_disp   : local=%" PRIu64 ", global=%" PRIu64 ", overflow=%" PRIu64
-                ", local_rate=%.1f%%",
+                ", stolen=%" PRIu64 ", local_rate=%.1f%%",
                 thread_idx, static_cast<uint64_t>(perf.local_dispatch_count),
                 static_cast<uint64_t>(global_dispatch_count), static_cast<uint64_t>(perf.local_overflow_count),
-                local_hit_rate
+                static_cast<uint64_t>(perf.steal_count), local_hit_rate
+            );
+            const ThreadLoadState &ls = thread_load_[thread_idx];
+            DEV_ALWAYS(
+                "Thread %d:     steal_gate   : engaged=%d, engage_count=%u, ewma=%.2f disp/window", thread_idx,
+                ls.steal_engaged ? 1 : 0, ls.steal_engage_count,
+                ls.dispatch_ewma.load(std::memory_order_relaxed) / static_cast<double>(1u << LOAD_EWMA_FRAC_BITS)
             );
 
             uint64_t d_parent = perf.sched_dispatch_cycle > 0 ? perf.sched_dispatch_cycle : 1;
@@ -799,6 +1290,11 @@ struct AicpuExecutor {
                 "Thread %d:   idle           : %.3fus (%.1f%%)", thread_idx, cycles_to_us(perf.sched_idle_cycle),
                 perf.sched_idle_cycle * 100.0 / sched_total
             );
+            DEV_ALWAYS(
+                "Thread %d:     tiers        : spin=%.3fus pause=%.3fus wait=%.3fus", thread_idx,
+                cycles_to_us(perf.idle_tier_cycle[0]), cycles_to_us(perf.idle_tier_cycle[1]),
+                cycles_to_us(perf.idle_tier_cycle[2])
+            );
 
             if (cur_thread_completed > 0) {
                 DEV_ALWAYS(
@@ -808,6 +1304,41 @@ struct AicpuExecutor {
             }
         }
 #endif
+        uint64_t idle_attr_total = 0;
+        uint64_t idle_attr_count = 0;
+        for (uint32_t c = 0; c < PERF_IDLE_CAUSE_COUNT; c++) {
+            idle_attr_total += perf.idle_cause_cycle[c];
+            idle_attr_count += perf.idle_cause_count[c];
+        }
+        if (idle_attr_count > 0) {
+            static const char *kIdleCauseNames[PERF_IDLE_CAUSE_COUNT] = {
+                "no_ready_task", "waiting_fanin", "alloc_stall", "drain"
+            };
+            uint64_t denom = idle_attr_total > 0 ? idle_attr_total : 1;
+            DEV_ALWAYS(
+                "Thread %d: === Core Idle Attribution: total=%.3fus, %" PRIu64 " intervals ===", thread_idx,
+                cycles_to_us(idle_attr_total), idle_attr_count
+            );
+            for (uint32_t c = 0; c < PERF_IDLE_CAUSE_COUNT; c++) {
+                DEV_ALWAYS(
+                    "Thread %d:   %-13s : %.3fus (%.1f%%)  n=%" PRIu64, thread_idx, kIdleCauseNames[c],
+                    cycles_to_us(perf.idle_cause_cycle[c]), perf.idle_cause_cycle[c] * 100.0 / denom,
+                    static_cast<uint64_t>(perf.idle_cause_count[c])
+                );
+            }
+        }
+
+#if !PTO2_SCHED_PROFILING
+        // PTO2_SCHED_PROFILING builds publish via publish_sched_profiling
+        // above; plain profiling builds publish the loop-phase and
+        // idle-attribution summary once at end of run.
+        {
+            AicpuSchedSummary summary = {};
+            fill_sched_summary(thread_idx, summary);
+            perf_aicpu_write_sched_summary(thread_idx, &summary);
+        }
+#endif
+
         DEV_ALWAYS(
             "Thread %d: Scheduler summary: total_time=%.3fus, loops=%" PRIu64 ", tasks_scheduled=%d", thread_idx,
             cycles_to_us(sched_total), static_cast<uint64_t>(perf.sched_loop_count), cur_thread_completed
@@ -828,6 +1359,12 @@ struct AicpuExecutor {
     };
 
     // Pure function: read register result → SlotTransition (no side effects).
+    //
+    // Serial slot execution lets one observation settle both slots: a chained
+    // pair that finishes between scans shows only the pending task's FIN, and
+    // Case 1 harvests producer and successor together — the combined
+    // completion record for pre-staged chains (see chain fusion in
+    // RUNTIME_LOGIC.md §8.2), with no per-stage scan round trip.
     static SlotTransition
     decide_slot_transition(int32_t reg_task_id, int32_t reg_state, int32_t running_id, int32_t pending_id) {
         SlotTransition t;
@@ -859,70 +1396,183 @@ struct AicpuExecutor {
         return t;
     }
 
-    // Complete one slot's task: subtask counting, mixed completion, deferred release, profiling.
-    void complete_slot_task(
-        PTO2TaskSlotState &slot_state, int32_t expected_reg_task_id, PTO2SubtaskSlot subslot, int32_t thread_idx,
-        int32_t core_id, Handshake *hank, int32_t &completed_this_turn,
+    // Per-pass harvest of subtask completions: done events for the same mixed
+    // task are collected into a bit word and credited with one atomic add
+    // (popcount) when the scan flushes, rather than one fetch_add per event.
+    struct SubtaskHarvest {
+        PTO2TaskSlotState *slot_state;
+        uint64_t done_word;  // One bit per subtask completion harvested this pass
+        int32_t core_id;     // Last completing core — cluster affinity source
+    };
+    static constexpr int32_t SUBTASK_HARVEST_MAX = 16;
+
+    // Run the completion action for a mixed task whose last subtask credit
+    // just landed: affinity stamp, fanout notification, deferred release.
+    PTO2_HOT_PATH void finalize_mixed_task(
+        PTO2TaskSlotState &slot_state, int32_t thread_idx, int32_t core_id, int32_t &completed_this_turn,
         PTO2TaskSlotState *deferred_release_slot_states[], int32_t &deferred_release_count,
         PTO2LocalReadyBuffer *local_bufs
-#if PTO2_PROFILING
-        ,
-        uint64_t dispatch_ts
-#endif
     ) {
 #if PTO2_PROFILING
         auto &perf = sched_perf_[thread_idx];
-#else
-        (void)hank;
 #endif
-        bool mixed_complete = rt->scheduler.on_subtask_complete(slot_state);
-        if (mixed_complete) {
-#if PTO2_PROFILING
-            if (get_enable_dump_tensor()) {
-                dump_tensors_for_task<PTO2_SUBTASK_SLOT_COUNT>(
-                    thread_idx, slot_state, TensorDumpStage::AFTER_COMPLETION,
-                    [](uint8_t active_mask, uint8_t raw_subtask_id) {
-                        return pto2_subtask_active(active_mask, static_cast<PTO2SubtaskSlot>(raw_subtask_id));
-                    },
-                    [this](int32_t func_id) {
-                        return get_function_bin_addr(func_id);
-                    }
-                );
+        // Record which cluster produced this task's outputs; the fanout
+        // walk propagates it to consumers as a dispatch locality hint.
+        slot_state.affinity_cluster = static_cast<uint8_t>(cluster_aic_wid_of_core_[core_id] + 1);
+
+        // Fold first-dispatch → completion wall cycles into this thread's
+        // health latency EWMA (always-on trend signal for the health block).
+        if (slot_state.task->autotune_dispatch_cnt != 0) {
+            uint64_t elapsed = get_sys_cnt_aicpu() - slot_state.task->autotune_dispatch_cnt;
+            uint64_t &ewma = health_latency_[thread_idx].ewma_ticks;
+            if (ewma == 0) {
+                ewma = elapsed;
+            } else {
+                int64_t delta = static_cast<int64_t>(elapsed) - static_cast<int64_t>(ewma);
+                ewma = static_cast<uint64_t>(static_cast<int64_t>(ewma) + (delta >> HEALTH_LATENCY_EWMA_SHIFT));
             }
+        }
+
+        // block_num auto-tuning: fold first-dispatch → completion wall cycles
+        // into the func's history for the next AUTO submit of this callable.
+        if (slot_state.task->block_num_auto != 0 && slot_state.task->autotune_dispatch_cnt != 0) {
+            int32_t key = pto2_block_autotune_key(
+                slot_state.task->kernel_id[static_cast<int>(PTO2SubtaskSlot::AIC)],
+                slot_state.task->kernel_id[static_cast<int>(PTO2SubtaskSlot::AIV0)],
+                slot_state.task->kernel_id[static_cast<int>(PTO2SubtaskSlot::AIV1)]
+            );
+            pto2_block_autotune_observe(
+                key, slot_state.logical_block_num, get_sys_cnt_aicpu() - slot_state.task->autotune_dispatch_cnt
+            );
+        }
+#if PTO2_PROFILING
+        if (get_enable_dump_tensor()) {
+            dump_tensors_for_task<PTO2_SUBTASK_SLOT_COUNT>(
+                thread_idx, slot_state, TensorDumpStage::AFTER_COMPLETION,
+                [](uint8_t active_mask, uint8_t raw_subtask_id) {
+                    return pto2_subtask_active(active_mask, static_cast<PTO2SubtaskSlot>(raw_subtask_id));
+                },
+                [this](int32_t func_id) {
+                    return get_function_bin_addr(func_id);
+                }
+            );
+        }
 #endif
 #if PTO2_SCHED_PROFILING
-            PTO2CompletionStats cstats = rt->scheduler.on_mixed_task_complete(slot_state, thread_idx, local_bufs);
-            perf.notify_edges_total += cstats.fanout_edges;
-            if (cstats.fanout_edges > perf.notify_max_degree) perf.notify_max_degree = cstats.fanout_edges;
-            perf.notify_tasks_enqueued += cstats.tasks_enqueued;
-            perf.phase_complete_count++;
+        PTO2CompletionStats cstats = rt->scheduler.on_mixed_task_complete(slot_state, thread_idx, local_bufs);
+        perf.notify_edges_total += cstats.fanout_edges;
+        if (cstats.fanout_edges > perf.notify_max_degree) perf.notify_max_degree = cstats.fanout_edges;
+        perf.notify_tasks_enqueued += cstats.tasks_enqueued;
+        perf.phase_complete_count++;
 #else
-            rt->scheduler.on_mixed_task_complete(slot_state, local_bufs);
+        rt->scheduler.on_mixed_task_complete(slot_state, local_bufs);
 #if PTO2_PROFILING
-            perf.phase_complete_count++;
+        perf.phase_complete_count++;
 #endif
 #endif
-            if (deferred_release_count < 256) {
-                deferred_release_slot_states[deferred_release_count++] = &slot_state;
-            } else {
-                DEV_ALWAYS("Thread %d: release", thread_idx);
-                while (deferred_release_count > 0) {
+        if (deferred_release_count < 256) {
+            deferred_release_slot_states[deferred_release_count++] = &slot_state;
+        } else {
+            DEV_ALWAYS("Thread %d: release", thread_idx);
+            while (deferred_release_count > 0) {
 #if PTO2_SCHED_PROFILING
-                    int32_t fe = rt->scheduler.on_task_release(
-                        *deferred_release_slot_states[--deferred_release_count], thread_idx
-                    );
-                    perf.fanin_edges_total += fe;
-                    if (fe > perf.fanin_max_degree) perf.fanin_max_degree = fe;
+                int32_t fe = rt->scheduler.on_task_release(
+                    *deferred_release_slot_states[--deferred_release_count], thread_idx
+                );
+                perf.fanin_edges_total += fe;
+                if (fe > perf.fanin_max_degree) perf.fanin_max_degree = fe;
 #else
-                    rt->scheduler.on_task_release(*deferred_release_slot_states[--deferred_release_count]);
+                rt->scheduler.on_task_release(*deferred_release_slot_states[--deferred_release_count]);
 #endif
+            }
+            deferred_release_slot_states[deferred_release_count++] = &slot_state;
+        }
+        completed_this_turn++;
+    }
+
+    // Credit one harvested done-bit word and run the completion action if it
+    // was the task's last outstanding credit.
+    void flush_harvest_entry(
+        SubtaskHarvest &entry, int32_t thread_idx, int32_t &completed_this_turn,
+        PTO2TaskSlotState *deferred_release_slot_states[], int32_t &deferred_release_count,
+        PTO2LocalReadyBuffer *local_bufs
+    ) {
+        int16_t credits = static_cast<int16_t>(__builtin_popcountll(entry.done_word));
+        if (rt->scheduler.on_subtasks_complete(*entry.slot_state, credits)) {
+            finalize_mixed_task(
+                *entry.slot_state, thread_idx, entry.core_id, completed_this_turn, deferred_release_slot_states,
+                deferred_release_count, local_bufs
+            );
+        }
+    }
+
+    // Harvest one subtask completion event: record per-subtask profiling and
+    // fold the event into the pass-local done word for its mixed task. Held
+    // slot pointers stay valid across the pass — a task cannot reach COMPLETED
+    // (and be recycled) before its harvested credits land in completed_subtasks.
+    void harvest_subtask_completion(
+        PTO2TaskSlotState &slot_state, int32_t expected_reg_task_id, PTO2SubtaskSlot subslot, int32_t thread_idx,
+        int32_t core_id, Handshake *hank, SubtaskHarvest harvest[], int32_t &harvest_count,
+        int32_t &completed_this_turn, PTO2TaskSlotState *deferred_release_slot_states[],
+        int32_t &deferred_release_count, PTO2LocalReadyBuffer *local_bufs
+#if PTO2_PROFILING
+        ,
+        uint64_t dispatch_ts
+#endif
+    ) {
+        pto2_flight_record(
+            PTO2FlightEventType::TASK_COMPLETE, slot_state.task->task_id.raw, core_id, expected_reg_task_id
+        );
+#if PTO2_PROFILING
+        record_subtask_perf(slot_state, expected_reg_task_id, subslot, thread_idx, core_id, hank, dispatch_ts);
+#else
+        (void)hank;
+        (void)subslot;
+#endif
+        SubtaskHarvest *entry = nullptr;
+        for (int32_t i = 0; i < harvest_count; i++) {
+            if (harvest[i].slot_state == &slot_state) {
+                entry = &harvest[i];
+                break;
+            }
+        }
+        if (entry == nullptr) {
+            if (harvest_count < SUBTASK_HARVEST_MAX) {
+                entry = &harvest[harvest_count++];
+                entry->slot_state = &slot_state;
+                entry->done_word = 0;
+            } else {
+                // Harvest table full — credit this event immediately, old style.
+                if (rt->scheduler.on_subtask_complete(slot_state)) {
+                    finalize_mixed_task(
+                        slot_state, thread_idx, core_id, completed_this_turn, deferred_release_slot_states,
+                        deferred_release_count, local_bufs
+                    );
                 }
-                deferred_release_slot_states[deferred_release_count++] = &slot_state;
+                return;
             }
-            completed_this_turn++;
         }
+        if (entry->done_word == UINT64_MAX) {
+            // Word saturated mid-pass — flush it and start a fresh one. This
+            // cannot complete the task: the current event's credit is still
+            // outstanding, so the counter stays below total_required_subtasks.
+            flush_harvest_entry(
+                *entry, thread_idx, completed_this_turn, deferred_release_slot_states, deferred_release_count,
+                local_bufs
+            );
+            entry->done_word = 0;
+        }
+        entry->done_word = (entry->done_word << 1) | 1;
+        entry->core_id = core_id;
+    }
 
 #if PTO2_PROFILING
+    // Emit the per-subtask completion record for the profiling buffer.
+    void record_subtask_perf(
+        PTO2TaskSlotState &slot_state, int32_t expected_reg_task_id, PTO2SubtaskSlot subslot, int32_t thread_idx,
+        int32_t core_id, Handshake *hank, uint64_t dispatch_ts
+    ) {
+        auto &perf = sched_perf_[thread_idx];
         if (perf.profiling_enabled) {
 #if PTO2_SCHED_PROFILING
             uint64_t t_perf_start = get_sys_cnt_aicpu();
@@ -939,11 +1589,24 @@ struct AicpuExecutor {
                 cur = cur->next;
             }
 
+            // Consume the armed PMU baseline: counters are free-running
+            // 32-bit, so the wrap-safe delta is a 32-bit subtraction.
+            uint64_t pmu_cache_miss = 0;
+            uint64_t pmu_bus_access = 0;
+            if (core_pmu_armed_[core_id] != 0) {
+                uint64_t reg_addr = core_exec_states_[core_id].reg_addr;
+                pmu_cache_miss = static_cast<uint32_t>(read_reg(reg_addr, RegId::PMU_CACHE_MISS)) -
+                                 core_pmu_base_[core_id][0];
+                pmu_bus_access = static_cast<uint32_t>(read_reg(reg_addr, RegId::PMU_BUS_ACCESS)) -
+                                 core_pmu_base_[core_id][1];
+                core_pmu_armed_[core_id] = 0;
+            }
+
             int32_t perf_slot_idx = static_cast<int32_t>(subslot);
             if (perf_aicpu_complete_record(
-                    pbuf, static_cast<uint32_t>(expected_reg_task_id), slot_state.task->task_id.raw,
+                    pbuf, core_id, static_cast<uint32_t>(expected_reg_task_id), slot_state.task->task_id.raw,
                     slot_state.task->kernel_id[perf_slot_idx], hank[core_id].core_type, dispatch_ts, finish_ts,
-                    fanout_arr, fanout_n
+                    fanout_arr, fanout_n, pmu_cache_miss, pmu_bus_access
                 ) != 0) {
                 DEV_ERROR(
                     "Core %d: perf_aicpu_complete_record failed for task 0x%" PRIx64, core_id,
@@ -954,8 +1617,8 @@ struct AicpuExecutor {
             perf.sched_complete_perf_cycle += (get_sys_cnt_aicpu() - t_perf_start);
 #endif
         }
-#endif
     }
+#endif
 
     // Promote pending slot data to running slot. Clears pending fields.
     static void promote_pending_to_running(CoreExecState &core) {
@@ -975,7 +1638,36 @@ struct AicpuExecutor {
         core.running_reg_task_id = AICPU_TASK_INVALID;
     }
 
-    void check_running_cores_for_completion(
+    // Early input release: a running kernel that opted in at submit may
+    // publish a non-zero word into its dispatch payload's LocalContext once
+    // it has finished reading every input (get_input_release_slot() +
+    // aicore_signal_publish()). On a quiet doorbell the scan probes that
+    // word and, on the first observation, drops the task's fanin references
+    // immediately — producers retire and the ring heap reclaims their
+    // buffers while the kernel is still computing. The armed flag is set
+    // only for single-core single-block tasks, so the probe, the release,
+    // and the eventual completion all run on the thread that owns this
+    // core; fanin_early_released then keeps on_task_release() from walking
+    // the fanins a second time. Unarmed tasks cost one payload-flag load.
+    PTO2_HOT_PATH void poll_early_input_release(CoreExecState &core, int32_t core_id, int32_t thread_idx) {
+        PTO2TaskSlotState *slot_state = core.running_slot_state;
+        if (slot_state == nullptr) return;
+        PTO2TaskPayload *payload = slot_state->payload;
+        if (payload->early_input_release == 0 || payload->fanin_early_released != 0) return;
+        // Same parity selection as dispatch_subtask_to_core: the running
+        // task's buffer, never the one a pending dispatch may be staged in.
+        PTO2DispatchPayload &dp = s_pto2_payload_per_core[core_id][static_cast<uint32_t>(core.running_reg_task_id) & 1u];
+        if (dp.local_context.input_release == 0) return;
+#if PTO2_SCHED_PROFILING
+        rt->scheduler.on_task_early_release(*slot_state, thread_idx);
+        sched_perf_[thread_idx].early_release_count++;
+#else
+        (void)thread_idx;
+        rt->scheduler.on_task_early_release(*slot_state);
+#endif
+    }
+
+    PTO2_HOT_PATH void check_running_cores_for_completion(
         int32_t thread_idx, Handshake *hank, int32_t &completed_this_turn, int32_t &cur_thread_completed,
         bool &made_progress, PTO2TaskSlotState *deferred_release_slot_states[], int32_t &deferred_release_count,
         PTO2LocalReadyBuffer *local_bufs
@@ -984,16 +1676,37 @@ struct AicpuExecutor {
         auto &perf = sched_perf_[thread_idx];
 #endif
         CoreTracker &tracker = core_trackers_[thread_idx];
+        SubtaskHarvest harvest[SUBTASK_HARVEST_MAX];
+        int32_t harvest_count = 0;
         auto running_core_states = tracker.get_all_running_cores();
         while (running_core_states.has_value()) {
             int32_t bit_pos = running_core_states.pop_first();
             int32_t core_id = tracker.get_core_id_by_offset(bit_pos);
             CoreExecState &core = core_exec_states_[core_id];
 
-            // --- Judgment phase: read register, derive transition ---
-            uint64_t reg_val = read_reg(core.reg_addr, RegId::COND);
-            int32_t reg_task_id = EXTRACT_TASK_ID(reg_val);
-            int32_t reg_state = EXTRACT_TASK_STATE(reg_val);
+            // Completion publication arrives through the handshake doorbell:
+            // the AICore writes the exact COND value (ACK/FIN/idle/exited)
+            // into this cacheable word after every COND register write, so
+            // the doorbell is authoritative for the completion scan — no MMIO
+            // COND read per completion, and a burst of simultaneous finishes
+            // costs one cacheable load per core instead of a serialized
+            // stream of interconnect transactions. The COND register is still
+            // written by the AICore but is only read on the exit path,
+            // dispatch calibration, and stall diagnostics. The doorbell value
+            // is recorded only on a matched transition, so an intermediate
+            // value (e.g. ACK observed after FIN was already handled) is
+            // simply re-probed next scan.
+            uint64_t doorbell = hank[core_id].cond_doorbell;
+            if (doorbell == last_cond_doorbell_[core_id]) {
+                // Still running: check whether the kernel has signalled that
+                // it is done reading its inputs (opt-in, armed at submit).
+                poll_early_input_release(core, core_id, thread_idx);
+                continue;
+            }
+
+            // --- Judgment phase: decode doorbell, derive transition ---
+            int32_t reg_task_id = EXTRACT_TASK_ID(doorbell);
+            int32_t reg_state = EXTRACT_TASK_STATE(doorbell);
 
 #if PTO2_SCHED_PROFILING
             if (perf.profiling_enabled) {
@@ -1005,6 +1718,8 @@ struct AicpuExecutor {
                 decide_slot_transition(reg_task_id, reg_state, core.running_reg_task_id, core.pending_reg_task_id);
             if (!t.matched) continue;
 
+            last_cond_doorbell_[core_id] = doorbell;
+
 #if PTO2_SCHED_PROFILING
             if (perf.profiling_enabled && (t.running_done || t.pending_done)) {
                 perf.complete_hit_count++;
@@ -1013,11 +1728,12 @@ struct AicpuExecutor {
 
             // --- Apply phase: execute actions based on transition ---
 
-            // 1. Complete finished tasks (capture pointers before modifying core state)
+            // 1. Harvest finished tasks (capture pointers before modifying core state)
             if (t.pending_done) {
-                complete_slot_task(
+                harvest_subtask_completion(
                     *core.pending_slot_state, core.pending_reg_task_id, core.pending_subslot, thread_idx, core_id, hank,
-                    completed_this_turn, deferred_release_slot_states, deferred_release_count, local_bufs
+                    harvest, harvest_count, completed_this_turn, deferred_release_slot_states, deferred_release_count,
+                    local_bufs
 #if PTO2_PROFILING
                     ,
                     core.pending_dispatch_timestamp
@@ -1026,9 +1742,10 @@ struct AicpuExecutor {
                 cur_thread_completed++;
             }
             if (t.running_done) {
-                complete_slot_task(
+                harvest_subtask_completion(
                     *core.running_slot_state, core.running_reg_task_id, core.running_subslot, thread_idx, core_id, hank,
-                    completed_this_turn, deferred_release_slot_states, deferred_release_count, local_bufs
+                    harvest, harvest_count, completed_this_turn, deferred_release_slot_states, deferred_release_count,
+                    local_bufs
 #if PTO2_PROFILING
                     ,
                     core.running_dispatch_timestamp
@@ -1058,6 +1775,12 @@ struct AicpuExecutor {
             if (is_idle) {
                 tracker.change_core_state(bit_pos);       // Mark idle
                 tracker.clear_pending_occupied(bit_pos);  // Idle safeguard: no payload to protect
+#if PTO2_PROFILING
+                if (sched_perf_[thread_idx].profiling_enabled) {
+                    core_idle_since_[core_id] = get_sys_cnt_aicpu();
+                    core_idle_cause_[core_id] = static_cast<uint8_t>(classify_idle_cause());
+                }
+#endif
             } else if (t.pending_freed && core.pending_reg_task_id == AICPU_TASK_INVALID) {
                 // Case 4 (running ACK) or Case 2 (pending ACK): clear pending_occupied only
                 // when no pending task is currently held. Otherwise pending slot is occupied
@@ -1070,6 +1793,14 @@ struct AicpuExecutor {
                 made_progress = true;
             }
         }
+
+        // Flush the harvest: one atomic credit per mixed task touched this pass.
+        for (int32_t i = 0; i < harvest_count; i++) {
+            flush_harvest_entry(
+                harvest[i], thread_idx, completed_this_turn, deferred_release_slot_states, deferred_release_count,
+                local_bufs
+            );
+        }
     }
 
     static const char *shape_name(PTO2ResourceShape shape) {
@@ -1089,23 +1820,105 @@ struct AicpuExecutor {
      * Widest shapes first to avoid consuming cluster resources with narrow tasks.
      * Even/odd threads use different fallback orders (AIC-first vs AIV-first)
      * to reduce contention on the same ready queue across adjacent threads.
+     * PTO2_ENABLE_MIX=0 builds drop the MIX lane entirely (order length is
+     * PTO2_NUM_DISPATCH_SHAPES, not PTO2_NUM_RESOURCE_SHAPES).
      */
     static const PTO2ResourceShape *get_dispatch_order(int32_t thread_idx) {
         // Even threads: AIC-first fallback after widest
-        static constexpr PTO2ResourceShape kEvenOrder[PTO2_NUM_RESOURCE_SHAPES] = {
+        static constexpr PTO2ResourceShape kEvenOrder[PTO2_NUM_DISPATCH_SHAPES] = {
+#if PTO2_ENABLE_MIX
             PTO2ResourceShape::MIX,
+#endif
             PTO2ResourceShape::AIC,
             PTO2ResourceShape::AIV,
         };
         // Odd threads: AIV-first fallback after widest
-        static constexpr PTO2ResourceShape kOddOrder[PTO2_NUM_RESOURCE_SHAPES] = {
+        static constexpr PTO2ResourceShape kOddOrder[PTO2_NUM_DISPATCH_SHAPES] = {
+#if PTO2_ENABLE_MIX
             PTO2ResourceShape::MIX,
+#endif
             PTO2ResourceShape::AIV,
             PTO2ResourceShape::AIC,
         };
         return (thread_idx % 2 == 0) ? kEvenOrder : kOddOrder;
     }
 
+    /**
+     * Tiered idle back-off. Tier 0 (spin) keeps full-rate polling for fast
+     * reaction to bursty orchestration phases. Tier 1 issues a widening burst
+     * of bare architectural pause hints to take the polling loop off the
+     * memory system. Tier 2 arms a monitor on the producer cursor of this
+     * thread's widest probe lane and naps until a store — or the periodic WFE event stream —
+     * wakes the core; it is entered only when this thread has no running
+     * cores, so completion doorbells are never left unpolled. Pushes to other
+     * queues rely on the event-stream backstop, which re-runs a full loop
+     * pass. No tier deschedules on hardware; the simulation platform's hint
+     * macros keep their own yield policy.
+     */
+    void idle_backoff(int32_t thread_idx, int32_t idle_iterations) {
+#if PTO2_SCHED_PROFILING
+        uint64_t t0 = get_sys_cnt_aicpu();
+        int32_t tier = 0;
+#endif
+        if (idle_iterations < IDLE_TIER_PAUSE_START) {
+            SPIN_WAIT_HINT();
+        } else if (idle_iterations >= IDLE_TIER_WAIT_START &&
+                   !core_trackers_[thread_idx].get_all_running_cores().has_value()) {
+#if PTO2_SCHED_PROFILING
+            tier = 2;
+#endif
+            SPIN_MONITOR_WAIT(
+                &rt->scheduler.ready_queues[static_cast<int32_t>(get_dispatch_order(thread_idx)[0])].enqueue_pos
+            );
+        } else {
+#if PTO2_SCHED_PROFILING
+            tier = 1;
+#endif
+            int32_t shift = (idle_iterations - IDLE_TIER_PAUSE_START) >> IDLE_PAUSE_WIDEN_SHIFT;
+            if (shift > IDLE_PAUSE_BURST_MAX_SHIFT) shift = IDLE_PAUSE_BURST_MAX_SHIFT;
+            SPIN_WAIT_HINT();
+            for (int32_t i = 1; i < (1 << shift); i++) {
+                SPIN_PAUSE_HINT();
+            }
+        }
+#if PTO2_SCHED_PROFILING
+        sched_perf_[thread_idx].idle_tier_cycle[tier] += get_sys_cnt_aicpu() - t0;
+#endif
+    }
+
+    /**
+     * Fold the current window's dispatch count into the thread's load EWMA
+     * and re-evaluate the steal hysteresis bands.  Called once per scheduler
+     * loop iteration; does real work only every LOAD_WINDOW_LOOPS calls.
+     */
+    void update_load_window(int32_t thread_idx) {
+        ThreadLoadState &ls = thread_load_[thread_idx];
+        if (++ls.window_loops < LOAD_WINDOW_LOOPS) {
+            return;
+        }
+        uint32_t ewma = ls.dispatch_ewma.load(std::memory_order_relaxed);
+        int32_t delta = static_cast<int32_t>(ls.window_dispatches << LOAD_EWMA_FRAC_BITS) - static_cast<int32_t>(ewma);
+        ewma = static_cast<uint32_t>(static_cast<int32_t>(ewma) + (delta >> LOAD_EWMA_DECAY_SHIFT));
+        ls.dispatch_ewma.store(ewma, std::memory_order_relaxed);
+        ls.window_dispatches = 0;
+        ls.window_loops = 0;
+
+        uint32_t peer_max = 0;
+        for (int32_t t = 0; t < thread_num_; t++) {
+            if (t == thread_idx) continue;
+            uint32_t p = thread_load_[t].dispatch_ewma.load(std::memory_order_relaxed);
+            if (p > peer_max) peer_max = p;
+        }
+        if (!ls.steal_engaged) {
+            if (peer_max > 2 * ewma + STEAL_ENGAGE_MARGIN) {
+                ls.steal_engaged = true;
+                ls.steal_engage_count++;
+            }
+        } else if (2 * peer_max <= 3 * ewma + STEAL_ENGAGE_MARGIN) {
+            ls.steal_engaged = false;
+        }
+    }
+
     int pop_ready_tasks_batch(
         PTO2ResourceShape shape, int32_t thread_idx, PTO2LocalReadyBuffer &local_buf, PTO2TaskSlotState **out,
         int max_count
@@ -1118,6 +1931,10 @@ struct AicpuExecutor {
             shape, local_buf, out, max_count, g_sched_pop_atomic_count[thread_idx], g_sched_pop_wait_cycle[thread_idx],
             perf.local_dispatch_count
         );
+        if (count == 0 && thread_load_[thread_idx].steal_engaged) {
+            count = rt->scheduler.steal_ready_tasks(shape, thread_idx, out, max_count);
+            perf.steal_count += count;
+        }
         perf.sched_dispatch_pop_cycle += (get_sys_cnt_aicpu() - t_pop_start);
         if (count > 0) {
             perf.pop_hit += count;
@@ -1125,49 +1942,182 @@ struct AicpuExecutor {
             perf.pop_miss++;
         }
 #else
-        (void)thread_idx;
         int count = rt->scheduler.get_ready_tasks_batch(shape, local_buf, out, max_count);
+        if (count == 0 && thread_load_[thread_idx].steal_engaged) {
+            count = rt->scheduler.steal_ready_tasks(shape, thread_idx, out, max_count);
+        }
 #endif
         return count;
     }
 
+    /**
+     * Publish one 64-byte line from the AICPU-local staging buffer into the
+     * shared GM payload.  The streaming store pair (stnp) writes the full
+     * line in one go without allocating it in the AICPU cache — AICore is
+     * the only reader of the published copy.
+     */
+    static void publish_payload_line(void *dst, const void *src) {
+#if defined(__aarch64__)
+        __asm__ volatile(
+            "ldp q0, q1, [%1]\n\t"
+            "ldp q2, q3, [%1, #32]\n\t"
+            "stnp q0, q1, [%0]\n\t"
+            "stnp q2, q3, [%0, #32]"
+            :
+            : "r"(dst), "r"(src)
+            : "v0", "v1", "v2", "v3", "memory"
+        );
+#else
+        memcpy(dst, src, PTO2_ALIGN_SIZE);
+#endif
+    }
+
     /**
      * Build per-core dispatch payload: copy tensor pointers and scalars into
-     * the per-core args[] array, then populate SPMD local context at the tail.
+     * the per-core args[] array, then populate SPMD local context in the
+     * header line.
+     *
+     * The payload is assembled in an AICPU-local staging copy and published
+     * to the shared GM slot in whole-cacheline streaming stores.  Writing
+     * the GM slot field by field produces a partial write-combine flush per
+     * field over the interconnect; staging collapses them to one flush per
+     * 64B line (header line, used args[] prefix, context-pointer suffix).
      *
      * Reads next_block_idx and block_num directly from the task descriptor
      * to populate LocalContext.  The caller is responsible for incrementing
      * next_block_idx AFTER dispatch.
      *
-     * GlobalContext (sub_block_id) is NOT written here — it is initialized once
-     * at runtime startup by init_global_context().
+     * GlobalContext (sub_block_id) shares the header line, so the per-core
+     * value set by init_global_context() is carried through the staged copy.
+     *
+     * The task-invariant portion (local context + args[] prefix) is staged
+     * by stage_task_args() and the per-core portion (kernel address, global
+     * context, context-pointer suffix) is patched in publish_payload().
+     * MIX dispatch stages once per cluster and publishes the same staging
+     * into all participating cores' slots, instead of re-assembling the
+     * ~1.2KB args[] array per core.
      */
-    void build_payload(PTO2DispatchPayload &dispatch_payload, PTO2TaskSlotState &slot_state, PTO2SubtaskSlot subslot) {
-        int32_t slot_idx = static_cast<int32_t>(subslot);
-        uint64_t callable_addr = get_function_bin_addr(slot_state.task->kernel_id[slot_idx]);
-        const CoreCallable *callable = reinterpret_cast<const CoreCallable *>(callable_addr);
-        dispatch_payload.function_bin_addr = callable->resolved_addr();
+    // Chain-residency hint plumbed into the next staged payload. The two
+    // back-to-back staging paths (chain fusion, speculative pending staging)
+    // bracket their successor dispatch with set/clear; every other dispatch
+    // stages 0 so migrated consumers always take the GM path.
+    uint64_t chain_resident_src_ = 0;
+
+    // GM base of `producer`'s packed output when it is small enough to have
+    // stayed in the core's local buffer, else 0. Inline outputs qualify
+    // unconditionally (<= PTO2_INLINE_OUTPUT_CAP by construction); heap and
+    // spill outputs are sized from the contiguous [base, end) span.
+    static uint64_t chain_resident_hint(const PTO2TaskSlotState &producer) {
+        const PTO2TaskDescriptor &desc = *producer.task;
+        const char *base = static_cast<const char *>(desc.packed_buffer_base);
+        if (base == nullptr) return 0;
+        if (base == reinterpret_cast<const char *>(desc.inline_output)) {
+            return reinterpret_cast<uint64_t>(base);
+        }
+        const char *end = static_cast<const char *>(desc.packed_buffer_end);
+        if (end <= base || end - base > PTO2_CHAIN_RESIDENT_CAP) return 0;
+        return reinterpret_cast<uint64_t>(base);
+    }
+
+    PTO2_HOT_PATH void build_payload(PTO2DispatchPayload &dispatch_payload, PTO2TaskSlotState &slot_state, PTO2SubtaskSlot subslot) {
+        PTO2DispatchPayload staging;
+        int32_t n = stage_task_args(staging, slot_state);
+        publish_payload(dispatch_payload, staging, slot_state, subslot, n);
+    }
+
+    // Fill the task-invariant staging fields: SPMD local context and the
+    // args[] prefix (tensor pointers + scalars).  Returns the number of
+    // used args[] entries.  Shared by all cores of a MIX dispatch.
+    PTO2_HOT_PATH int32_t stage_task_args(PTO2DispatchPayload &staging, PTO2TaskSlotState &slot_state) {
+        // Per-dispatch local context: read block_idx/block_num directly from slot_state.
+        staging.local_context.block_idx = slot_state.next_block_idx;
+        staging.local_context.block_num = slot_state.logical_block_num;
+        // Precompute 2-D block coordinates: one div/mod here replaces the
+        // same chain in every kernel prologue on every core.
+        int32_t block_dim_x = slot_state.task->block_dim_x;
+        if (block_dim_x > 1) {
+            staging.local_context.block_idx_x = slot_state.next_block_idx % block_dim_x;
+            staging.local_context.block_idx_y = slot_state.next_block_idx / block_dim_x;
+        } else {
+            staging.local_context.block_idx_x = slot_state.next_block_idx;
+            staging.local_context.block_idx_y = 0;
+        }
+        // Published as 0; the AICore executor overwrites with the WIP perf
+        // record address before the kernel runs when profiling is enabled.
+        staging.local_context.perf_record = 0;
+        // Non-zero only for back-to-back same-core staging (chain fusion /
+        // speculative pending); see get_chain_resident_src() in intrinsic.h.
+        staging.local_context.chain_src = chain_resident_src_;
+        // Early-input-release writeback slot: published 0, set non-zero by
+        // the kernel mid-execution; see get_input_release_slot() in
+        // intrinsic.h and poll_early_input_release() below.
+        staging.local_context.input_release = 0;
+        // Scalar result mailbox address for opted-in tasks (0 otherwise);
+        // the mailbox line lives in the task descriptor, already emptied at
+        // submit. See get_scalar_mailbox() in intrinsic.h.
+        staging.local_context.scalar_mailbox =
+            slot_state.task->scalar_result != 0
+                ? reinterpret_cast<uint64_t>(const_cast<uint64_t *>(&slot_state.task->scalar_mailbox_flag))
+                : 0;
         auto &payload = *slot_state.payload;
-        int n = 0;
+        int32_t n = 0;
         for (int32_t i = 0; i < payload.tensor_count; i++) {
-            dispatch_payload.args[n++] = reinterpret_cast<uint64_t>(&payload.tensors[i]);
+            staging.args[n++] = reinterpret_cast<uint64_t>(&payload.tensors[i]);
         }
         for (int32_t i = 0; i < payload.scalar_count; i++) {
-            dispatch_payload.args[n++] = payload.scalars[i];
+            staging.args[n++] = payload.scalars[i];
         }
-        // Per-dispatch local context: read block_idx/block_num directly from slot_state.
-        dispatch_payload.local_context.block_idx = slot_state.next_block_idx;
-        dispatch_payload.local_context.block_num = slot_state.logical_block_num;
-        // Store context pointers at fixed suffix positions in args[]
-        // (GlobalContext content is already set by init_global_context, but the
-        //  pointer must be written each dispatch since args[] is rebuilt entirely)
-        dispatch_payload.args[SPMD_LOCAL_CONTEXT_INDEX] = reinterpret_cast<uint64_t>(&dispatch_payload.local_context);
-        dispatch_payload.args[SPMD_GLOBAL_CONTEXT_INDEX] = reinterpret_cast<uint64_t>(&dispatch_payload.global_context);
+        return n;
     }
 
-    void dispatch_subtask_to_core(
+    // Patch the per-core staging fields and stream the payload into one
+    // core's shared GM slot.  The staging copy is reused across cores of a
+    // MIX dispatch, so every per-core field must be (re)written here.
+    PTO2_HOT_PATH void publish_payload(
+        PTO2DispatchPayload &dispatch_payload, PTO2DispatchPayload &staging, PTO2TaskSlotState &slot_state,
+        PTO2SubtaskSlot subslot, int32_t n
+    ) {
+        int32_t slot_idx = static_cast<int32_t>(subslot);
+        uint64_t callable_addr = get_function_bin_addr(slot_state.task->kernel_id[slot_idx]);
+        staging.function_bin_addr = reinterpret_cast<const CoreCallable *>(callable_addr)->resolved_addr();
+        staging.global_context = dispatch_payload.global_context;
+        // Context pointers at fixed suffix positions must reference the shared
+        // GM slot AICore dereferences, not the staging copy.
+        staging.args[SPMD_LOCAL_CONTEXT_INDEX] = reinterpret_cast<uint64_t>(&dispatch_payload.local_context);
+        staging.args[SPMD_GLOBAL_CONTEXT_INDEX] = reinterpret_cast<uint64_t>(&dispatch_payload.global_context);
+        // Device-enqueue ring for the dispatched core (0 = no children
+        // registered, kernels see the feature off). The core index is
+        // recovered from the payload slot address: slots are laid out
+        // [core][2] in s_pto2_payload_per_core.
+        int32_t enqueue_core = static_cast<int32_t>((&dispatch_payload - &s_pto2_payload_per_core[0][0]) / 2);
+        staging.args[SPMD_DEVICE_ENQUEUE_INDEX] =
+            (rt != nullptr && rt->device_enqueue_rings != nullptr)
+                ? reinterpret_cast<uint64_t>(&rt->device_enqueue_rings[enqueue_core])
+                : 0;
+
+        // Publish header line, the used args[] prefix rounded up to whole
+        // lines, then the context-pointer suffix line (args[] is line-aligned,
+        // so the prefix never reaches the suffix line: n <= 144 args = 1152B).
+        publish_payload_line(&dispatch_payload, &staging);
+        char *dst = reinterpret_cast<char *>(dispatch_payload.args);
+        const char *src = reinterpret_cast<const char *>(staging.args);
+        int32_t prefix_bytes = static_cast<int32_t>(PTO2_ALIGN_UP(n * sizeof(uint64_t), PTO2_ALIGN_SIZE));
+        for (int32_t off = 0; off < prefix_bytes; off += PTO2_ALIGN_SIZE) {
+            publish_payload_line(dst + off, src + off);
+        }
+        constexpr int32_t suffix_off = SPMD_LOCAL_CONTEXT_INDEX * static_cast<int32_t>(sizeof(uint64_t));
+        publish_payload_line(dst + suffix_off, src + suffix_off);
+        // Drain the streamed lines before the caller flips DATA_MAIN_BASE.
+        OUT_OF_ORDER_STORE_BARRIER();
+    }
+
+    // shared_staging: MIX cluster fan-out — a staging copy already filled by
+    // stage_task_args() that is published as-is (per-core fields patched),
+    // skipping the per-core args[] re-assembly.  nullptr = stage locally.
+    PTO2_HOT_PATH void dispatch_subtask_to_core(
         Runtime *runtime, int32_t thread_idx, int32_t core_offset, PTO2TaskSlotState &slot_state,
-        PTO2SubtaskSlot subslot, bool to_pending
+        PTO2SubtaskSlot subslot, bool to_pending, PTO2DispatchPayload *shared_staging = nullptr,
+        int32_t shared_args_count = 0
     ) {
         CoreTracker &tracker = core_trackers_[thread_idx];
         auto core_id = tracker.get_core_id_by_offset(core_offset);
@@ -1197,10 +2147,26 @@ struct AicpuExecutor {
             reg_task_id = core_exec_state.dispatch_seq & TASK_ID_MASK;
         }
 
+        pto2_flight_record(
+            PTO2FlightEventType::TASK_DISPATCH, slot_state.task->task_id.raw, core_id,
+            static_cast<int32_t>(reg_task_id)
+        );
+
+        // Stamp the task's first dispatch: completion measures elapsed wall
+        // cycles from it for the health block's latency EWMA (every task)
+        // and the block_num auto-tune history (AUTO submits only).
+        if (slot_state.task->autotune_dispatch_cnt == 0) {
+            slot_state.task->autotune_dispatch_cnt = get_sys_cnt_aicpu();
+        }
+
         // Select dual-buffer slot: adjacent dispatches alternate automatically
         uint32_t buf_idx = reg_task_id & 1u;
         PTO2DispatchPayload &payload = s_pto2_payload_per_core[core_id][buf_idx];
-        build_payload(payload, slot_state, subslot);
+        if (shared_staging != nullptr) {
+            publish_payload(payload, *shared_staging, slot_state, subslot, shared_args_count);
+        } else {
+            build_payload(payload, slot_state, subslot);
+        }
 
         // to_pending is determined by the caller (idle dispatch = false, pending dispatch = true).
         if (to_pending) {
@@ -1218,7 +2184,24 @@ struct AicpuExecutor {
             core_exec_state.running_reg_task_id = static_cast<int32_t>(reg_task_id);
 #if PTO2_PROFILING
             if (perf.profiling_enabled) {
-                core_exec_state.running_dispatch_timestamp = get_sys_cnt_aicpu();
+                uint64_t now = get_sys_cnt_aicpu();
+                core_exec_state.running_dispatch_timestamp = now;
+                // Close the core's open idle interval under its tagged cause
+                if (core_idle_since_[core_id] != 0) {
+                    uint8_t cause = core_idle_cause_[core_id];
+                    perf.idle_cause_cycle[cause] += now - core_idle_since_[core_id];
+                    perf.idle_cause_count[cause]++;
+                    core_idle_since_[core_id] = 0;
+                }
+                // Arm PMU sampling for 1-in-N idle-core dispatches: baseline
+                // read here, delta taken when this task completes.
+                if (pmu_sample_interval_ != 0 && core_exec_state.dispatch_seq % pmu_sample_interval_ == 0) {
+                    core_pmu_base_[core_id][0] =
+                        static_cast<uint32_t>(read_reg(core_exec_state.reg_addr, RegId::PMU_CACHE_MISS));
+                    core_pmu_base_[core_id][1] =
+                        static_cast<uint32_t>(read_reg(core_exec_state.reg_addr, RegId::PMU_BUS_ACCESS));
+                    core_pmu_armed_[core_id] = 1;
+                }
             }
 #endif
             // Mark core as running (was idle)
@@ -1235,6 +2218,7 @@ struct AicpuExecutor {
 #endif
 
         write_reg(core_exec_state.reg_addr, RegId::DATA_MAIN_BASE, static_cast<uint64_t>(reg_task_id));
+        thread_load_[thread_idx].window_dispatches++;
 
         // SET pending_occupied: serves as pre-reservation even on first dispatch
         // (guarantees next dispatch to this core uses pending-slot path until hardware ACKs)
@@ -1243,11 +2227,18 @@ struct AicpuExecutor {
 
     // Dispatch one SPMD block of a MIX task to the cluster at cluster_offset.
     // Reads slot_state.next_block_idx as block_idx; caller increments it afterwards.
-    void dispatch_mix_block_to_cluster(
+    //
+    // Cluster-level fan-out: the block's args[] and local context are staged
+    // once and published into each participating core's slot with only the
+    // per-core fields patched, so the AICPU pays the args assembly once per
+    // cluster instead of once per core.
+    PTO2_HOT_PATH void dispatch_mix_block_to_cluster(
         Runtime *runtime, int32_t thread_idx, int32_t cluster_offset, PTO2TaskSlotState &slot_state, bool to_pending
     ) {
         CoreTracker &tracker = core_trackers_[thread_idx];
         uint8_t core_mask = pto2_core_mask(slot_state.active_mask);
+        PTO2DispatchPayload staging;
+        int32_t args_count = stage_task_args(staging, slot_state);
         // Per-core to_pending: in pending phase, idle cores dispatch to running slot
         // (to_pending=false triggers change_core_state), running cores to pending slot.
         // In idle phase (to_pending=false), all per-core flags stay false — no behavior change.
@@ -1255,21 +2246,21 @@ struct AicpuExecutor {
             bool aic_to_pending = to_pending && !tracker.is_aic_core_idle(cluster_offset);
             dispatch_subtask_to_core(
                 runtime, thread_idx, tracker.get_aic_core_offset(cluster_offset), slot_state, PTO2SubtaskSlot::AIC,
-                aic_to_pending
+                aic_to_pending, &staging, args_count
             );
         }
         if (core_mask & PTO2_SUBTASK_MASK_AIV0) {
             bool aiv0_to_pending = to_pending && !tracker.is_aiv0_core_idle(cluster_offset);
             dispatch_subtask_to_core(
                 runtime, thread_idx, tracker.get_aiv0_core_offset(cluster_offset), slot_state, PTO2SubtaskSlot::AIV0,
-                aiv0_to_pending
+                aiv0_to_pending, &staging, args_count
             );
         }
         if (core_mask & PTO2_SUBTASK_MASK_AIV1) {
             bool aiv1_to_pending = to_pending && !tracker.is_aiv1_core_idle(cluster_offset);
             dispatch_subtask_to_core(
                 runtime, thread_idx, tracker.get_aiv1_core_offset(cluster_offset), slot_state, PTO2SubtaskSlot::AIV1,
-                aiv1_to_pending
+                aiv1_to_pending, &staging, args_count
             );
         }
     }
@@ -1304,7 +2295,7 @@ struct AicpuExecutor {
     // based on shape.  For MIX, core_offset is a cluster offset; for AIC/AIV, it is a
     // per-core bit offset (already resolved by the caller in both idle and pending phases).
     // Caller is responsible for incrementing slot_state.next_block_idx after this returns.
-    void dispatch_block(
+    PTO2_HOT_PATH void dispatch_block(
         Runtime *runtime, int32_t thread_idx, int32_t core_offset, PTO2TaskSlotState &slot_state,
         PTO2ResourceShape shape, bool to_pending
     ) {
@@ -1333,10 +2324,43 @@ struct AicpuExecutor {
 #endif
     }
 
+    // Pop a dispatchable core for `slot_state`, preferring a core in the
+    // producer's cluster (affinity_cluster hint stamped at completion) so
+    // producer-consumer chains stay on one cluster's L2. On an affinity miss,
+    // single-core tasks prefer a core whose cluster is already broken (some
+    // core busy), keeping whole-idle clusters available for MIX tasks rather
+    // than shredding them one narrow dispatch at a time. Falls back to the
+    // lowest set bit.
+    int32_t pop_core_with_affinity(
+        const CoreTracker &tracker, CoreTracker::BitStates &cores, const PTO2TaskSlotState &slot_state,
+        PTO2ResourceShape shape
+    ) {
+        if (slot_state.affinity_cluster != 0) {
+            int32_t preferred_aic_wid = static_cast<int32_t>(slot_state.affinity_cluster) - 1;
+            CoreTracker::BitStates scan = cores;
+            for (int32_t off = scan.pop_first(); off >= 0; off = scan.pop_first()) {
+                if (tracker.get_cluster_aic_id(off) == preferred_aic_wid) {
+                    cores ^= CoreTracker::BitStates(1ULL << off);
+                    return off;
+                }
+            }
+        }
+        if (shape != PTO2ResourceShape::MIX) {
+            CoreTracker::BitStates scan = cores;
+            for (int32_t off = scan.pop_first(); off >= 0; off = scan.pop_first()) {
+                if (!tracker.is_cluster_fully_idle(off)) {
+                    cores ^= CoreTracker::BitStates(1ULL << off);
+                    return off;
+                }
+            }
+        }
+        return cores.pop_first();
+    }
+
     // Dispatch tasks of a given shape during the specified phase (IDLE or PENDING).
     // IDLE: dispatches to idle cores, supports sync_start/drain, multi-block do-while.
     // PENDING: dispatches to pending slots of running cores, skips sync_start tasks.
-    void dispatch_shape(
+    PTO2_HOT_PATH void dispatch_shape(
         Runtime *runtime, int32_t thread_idx, PTO2ResourceShape shape, CoreTracker::DispatchPhase phase,
         PTO2LocalReadyBuffer &local_buf, CoreTracker &tracker, bool &entered_drain, bool &made_progress,
         bool &try_pushed
@@ -1351,11 +2375,37 @@ struct AicpuExecutor {
         if (!cores.has_value()) return;
 
         while (cores.has_value() && !entered_drain) {
-            int want = cores.count();
+            // Pop a lookahead window beyond the free-core count so a wide task
+            // a few entries behind narrow ones is still considered for this
+            // pass's packing; surplus entries are re-enqueued by the batch
+            // guard below once the cores run out.
+            int want = cores.count() + DISPATCH_LOOKAHEAD;
+            if (want > CoreTracker::MAX_CLUSTERS * 3) want = CoreTracker::MAX_CLUSTERS * 3;
             PTO2TaskSlotState *batch[CoreTracker::MAX_CLUSTERS * 3];
             int got = pop_ready_tasks_batch(shape, thread_idx, local_buf, batch, want);
             if (got == 0) break;
 
+            // Best-fit ordering: widest remaining-block count first, so
+            // multi-block tasks pack onto the free-core mask before
+            // single-block ones shred it — a wide sync_start task behind
+            // narrow ones would otherwise find the batch's cores already
+            // consumed and force a drain. High-priority entries stay ahead
+            // of the normal lane regardless of width.
+            for (int bi = 1; bi < got; bi++) {
+                PTO2TaskSlotState *key = batch[bi];
+                int32_t key_rank = (pto2_is_high_priority(key->active_mask) ? (1 << 16) : 0) +
+                                   (key->logical_block_num - key->next_block_idx);
+                int bj = bi - 1;
+                while (bj >= 0) {
+                    int32_t cur_rank = (pto2_is_high_priority(batch[bj]->active_mask) ? (1 << 16) : 0) +
+                                       (batch[bj]->logical_block_num - batch[bj]->next_block_idx);
+                    if (cur_rank >= key_rank) break;
+                    batch[bj + 1] = batch[bj];
+                    bj--;
+                }
+                batch[bj + 1] = key;
+            }
+
             bool dispatched_any = false;
             for (int bi = 0; bi < got; bi++) {
                 PTO2TaskSlotState *slot_state = batch[bi];
@@ -1363,27 +2413,52 @@ struct AicpuExecutor {
                 // sync_start tasks cannot use pending slots — requeue and skip.
                 if (pto2_requires_sync_start(slot_state->active_mask)) {
                     if (is_pending) {
-                        rt->scheduler.ready_queues[static_cast<int32_t>(shape)].push(slot_state);
+                        rt->scheduler.push_ready_global(slot_state);
                         continue;
                     }
-                    // Idle phase: check whether enough local resources exist for atomic dispatch.
-                    int32_t available = cores.count();
-                    if (available < slot_state->logical_block_num) {
+                    // Idle phase: reserve the whole gang from this thread's
+                    // snapshot in one shot, or none of it. An empty mask means
+                    // this tracker alone cannot seat the gang — hand off to
+                    // the global drain protocol.
+                    CoreTracker::BitStates gang =
+                        tracker.try_reserve_gang(cores, shape, slot_state->logical_block_num);
+                    if (!gang.has_value()) {
                         if (!enter_drain_mode(slot_state, slot_state->logical_block_num)) {
-                            rt->scheduler.ready_queues[static_cast<int32_t>(shape)].push(slot_state);
+                            rt->scheduler.push_ready_global(slot_state);
                         }
                         for (int rem = bi + 1; rem < got; rem++) {
-                            rt->scheduler.ready_queues[static_cast<int32_t>(shape)].push(batch[rem]);
+                            rt->scheduler.push_ready_global(batch[rem]);
                         }
                         entered_drain = true;
                         break;
                     }
+                    dispatched_any = true;
+                    try_pushed = true;
+#if PTO2_SCHED_PROFILING
+                    uint64_t t_gang_start = get_sys_cnt_aicpu();
+#endif
+                    for (int32_t off = gang.pop_first(); off >= 0; off = gang.pop_first()) {
+                        dispatch_block(runtime, thread_idx, off, *slot_state, shape, false);
+                        slot_state->next_block_idx++;
+                        DEV_DEBUG(
+                            "Thread %d: Gang-dispatched %s task %" PRId64 " block %d/%d to core_offset %d",
+                            thread_idx, shape_name(shape), static_cast<int64_t>(slot_state->task->task_id.raw),
+                            slot_state->next_block_idx - 1, slot_state->logical_block_num, off
+                        );
+                    }
+                    made_progress = true;
+#if PTO2_SCHED_PROFILING
+                    perf.sched_dispatch_setup_cycle += (get_sys_cnt_aicpu() - t_gang_start);
+#endif
+                    continue;
                 }
 
                 // Guard: a preceding task in this batch may have drained all cores;
                 // re-enqueue the rest of the batch instead of popping an empty mask.
                 if (!cores.has_value()) {
-                    rt->scheduler.ready_queues[static_cast<int32_t>(shape)].push_batch(&batch[bi], got - bi);
+                    for (int rem = bi; rem < got; rem++) {
+                        rt->scheduler.push_ready_global(batch[rem]);
+                    }
                     break;
                 }
 
@@ -1393,8 +2468,9 @@ struct AicpuExecutor {
                 uint64_t t_setup_start = get_sys_cnt_aicpu();
 #endif
                 // Dispatch as many blocks as possible for this task.
+                int32_t core_offset = -1;
                 do {
-                    auto core_offset = cores.pop_first();
+                    core_offset = pop_core_with_affinity(tracker, cores, *slot_state, shape);
                     dispatch_block(runtime, thread_idx, core_offset, *slot_state, shape, is_pending);
                     slot_state->next_block_idx++;
                     DEV_DEBUG(
@@ -1406,7 +2482,30 @@ struct AicpuExecutor {
                 } while (slot_state->next_block_idx < slot_state->logical_block_num && cores.has_value());
 
                 if (slot_state->next_block_idx < slot_state->logical_block_num) {
-                    rt->scheduler.ready_queues[static_cast<int32_t>(shape)].push(slot_state);
+                    rt->scheduler.push_ready_global(slot_state);
+                } else if (!is_pending && shape != PTO2ResourceShape::MIX && slot_state->logical_block_num == 1 &&
+                           slot_state->chain_hint.load(std::memory_order_relaxed) != 0) {
+                    // Chain fusion: submit marked this task as having a single
+                    // dependent successor. Claim it now and stage it into this
+                    // core's pending slot so the hardware flips to it the
+                    // cycle this task's done-bit lands — no completion-scan or
+                    // ready-queue round-trip between the two stages. If the
+                    // successor is not claimable yet (e.g. still unwired), the
+                    // hint stays set for the speculative idle pass.
+                    PTO2TaskSlotState *successor =
+                        rt->scheduler.try_claim_ready_successor(*slot_state, shape, SPECULATIVE_FANOUT_SCAN_MAX);
+                    if (successor != nullptr) {
+                        slot_state->chain_hint.store(0, std::memory_order_relaxed);
+                        chain_resident_src_ = chain_resident_hint(*slot_state);
+                        dispatch_block(runtime, thread_idx, core_offset, *successor, shape, /*to_pending=*/true);
+                        chain_resident_src_ = 0;
+                        successor->next_block_idx++;
+                        DEV_DEBUG(
+                            "Thread %d: Chained %s task %" PRId64 " behind task %" PRId64 " on core_offset %d",
+                            thread_idx, shape_name(shape), static_cast<int64_t>(successor->task->task_id.raw),
+                            static_cast<int64_t>(slot_state->task->task_id.raw), core_offset
+                        );
+                    }
                 }
                 made_progress = true;
 #if PTO2_SCHED_PROFILING
@@ -1425,6 +2524,52 @@ struct AicpuExecutor {
         }
     }
 
+    // Bound on fanout entries examined per producer when looking for a
+    // near-ready successor — keeps the speculation pass O(1) per core.
+    static constexpr int32_t SPECULATIVE_FANOUT_SCAN_MAX = 8;
+
+    // Speculative pending-slot staging: for each running core whose pending
+    // payload slot is still free after the regular PENDING phase, look at the
+    // task currently running on it. If one of its consumers is exactly one
+    // fanin release short of READY, that missing release must come from this
+    // very task (see try_claim_ready_successor), so the consumer is staged
+    // into the core's pending slot now. The hardware flips to it the cycle
+    // the producer's done-bit lands, hiding the AICPU completion-scan and
+    // dispatch latency (3-8us kernel-to-kernel gap otherwise).
+    //
+    // Restricted to single-subtask single-block producers: the consumer's
+    // dependency is on FULL task completion, and the hardware back-to-back
+    // guarantee only covers this core's subtask — the two coincide only when
+    // the producer has nothing running elsewhere.
+    void try_speculative_pending_dispatch(Runtime *runtime, int32_t thread_idx, bool &made_progress, bool &try_pushed) {
+        CoreTracker &tracker = core_trackers_[thread_idx];
+        for (PTO2ResourceShape shape : {PTO2ResourceShape::AIC, PTO2ResourceShape::AIV}) {
+            auto cores = tracker.get_pending_core_offset_states(shape);
+            while (cores.has_value()) {
+                int32_t core_offset = cores.pop_first();
+                CoreExecState &core_exec_state = core_exec_states_[tracker.get_core_id_by_offset(core_offset)];
+                PTO2TaskSlotState *producer = core_exec_state.running_slot_state;
+                if (producer == nullptr) continue;
+                if (producer->logical_block_num > 1) continue;
+                if (__builtin_popcount(pto2_core_mask(producer->active_mask)) != 1) continue;
+                PTO2TaskSlotState *successor =
+                    rt->scheduler.try_claim_ready_successor(*producer, shape, SPECULATIVE_FANOUT_SCAN_MAX);
+                if (successor == nullptr) continue;
+                chain_resident_src_ = chain_resident_hint(*producer);
+                dispatch_block(runtime, thread_idx, core_offset, *successor, shape, /*to_pending=*/true);
+                chain_resident_src_ = 0;
+                successor->next_block_idx++;
+                made_progress = true;
+                try_pushed = true;
+                DEV_DEBUG(
+                    "Thread %d: Speculatively staged %s task %" PRId64 " behind task %" PRId64 " on core_offset %d",
+                    thread_idx, shape_name(shape), static_cast<int64_t>(successor->task->task_id.raw),
+                    static_cast<int64_t>(producer->task->task_id.raw), core_offset
+                );
+            }
+        }
+    }
+
     // Count total available resources across all scheduler threads for a given shape.
     int32_t count_global_available(PTO2ResourceShape shape) {
         int32_t total = 0;
@@ -1680,6 +2825,10 @@ bool AicpuExecutor::assign_cores_to_threads() {
 
         core_trackers_[t].set_cluster(cluster_idx_per_thread[t]++, aic_wid, aiv0_wid, aiv1_wid);
 
+        cluster_aic_wid_of_core_[aic_wid] = aic_wid;
+        cluster_aic_wid_of_core_[aiv0_wid] = aic_wid;
+        cluster_aic_wid_of_core_[aiv1_wid] = aic_wid;
+
         core_assignments_[t][idx++] = aic_wid;
         core_assignments_[t][idx++] = aiv0_wid;
         core_assignments_[t][idx++] = aiv1_wid;
@@ -1696,12 +2845,16 @@ bool AicpuExecutor::assign_cores_to_threads() {
 }
 
 /**
- * Reassign all cores evenly across all threads (schedulers + orchestrators).
- * Called by the last orchestrator thread when orchestration completes.
- * Writes into new_core_assignments_ / new_core_count_per_thread_.
+ * Reassign all cores evenly across the first target_threads threads.
+ * Called by the last orchestrator thread when orchestration completes
+ * (target = thread_num_, schedulers + orchestrators) and by the elastic
+ * scaling controller on every resize (target = new active set size).
+ * Callers must have quiesced every thread that currently owns cores.
  */
-void AicpuExecutor::reassign_cores_for_all_threads() {
-    DEV_INFO("Reassigning cores (cluster-aligned) for %d threads: %d AIC, %d AIV", thread_num_, aic_count_, aiv_count_);
+void AicpuExecutor::reassign_cores_for_all_threads(int32_t target_threads) {
+    DEV_INFO(
+        "Reassigning cores (cluster-aligned) for %d threads: %d AIC, %d AIV", target_threads, aic_count_, aiv_count_
+    );
 
     // Collect running worker_ids from all current trackers
     bool running_cores[MAX_CORES_PER_THREAD] = {};
@@ -1713,14 +2866,15 @@ void AicpuExecutor::reassign_cores_for_all_threads() {
         }
     }
 
-    // Count clusters per thread (round-robin across all threads)
+    // Count clusters per thread (round-robin across the target threads)
     int32_t cluster_count = aic_count_;
     int32_t clusters_per_thread[MAX_AICPU_THREADS] = {};
     for (int32_t ci = 0; ci < cluster_count; ci++) {
-        clusters_per_thread[ci % thread_num_]++;
+        clusters_per_thread[ci % target_threads]++;
     }
 
-    // Re-init all trackers and reset core counts
+    // Re-init all trackers and reset core counts (threads outside the target
+    // set end up with zero clusters and nothing to shut down)
     for (int32_t i = 0; i < thread_num_; i++) {
         core_trackers_[i].init(clusters_per_thread[i]);
         core_count_per_thread_[i] = 0;
@@ -1729,7 +2883,7 @@ void AicpuExecutor::reassign_cores_for_all_threads() {
     // Assign clusters round-robin and restore running state
     int32_t cluster_idx_per_thread[MAX_AICPU_THREADS] = {};
     for (int32_t ci = 0; ci < cluster_count; ci++) {
-        int32_t t = ci % thread_num_;
+        int32_t t = ci % target_threads;
 
         int32_t aic_wid = aic_worker_ids_[ci];
         int32_t aiv0_wid = aiv_worker_ids_[2 * ci];
@@ -1767,7 +2921,145 @@ void AicpuExecutor::reassign_cores_for_all_threads() {
             core_trackers_[t].get_cluster_count(), aic_running, aiv_running
         );
     }
-    active_sched_threads_ = thread_num_;
+    active_sched_threads_ = target_threads;
+}
+
+// ===== Elastic scheduler scaling (PTO2_ELASTIC_SCHED) =====
+//
+// Dispatch-heavy phases want every scheduler thread; dispatch-light phases
+// pay for the idle ones in shared-memory traffic (ready-queue polling, steal
+// probes, EWMA scans). With elastic scaling enabled, scheduler thread 0 acts
+// as controller: once per evaluation window it reads the total ready backlog
+// and the per-thread dispatch EWMAs, and resizes the active set one thread at
+// a time with hysteresis. Threads park from the top index down, so the drain
+// ack mask ((1 << active_sched_threads_) - 1) and the thread-0-only wiring
+// duty keep working unchanged. Core ownership moves through the same
+// quiesce-then-reassign machinery as the orch-to-sched transition: the
+// controller raises a barrier, waits for every active peer to stand still at
+// the loop top, redistributes clusters via reassign_cores_for_all_threads,
+// and releases. A parked thread owns no cores and no ready work (local
+// buffers are flushed each iteration; deferred fanin releases are pushed out
+// before parking), so it can nap on a monitor line until scaled back in.
+
+void AicpuExecutor::maybe_elastic_resize() {
+    if (++elastic_eval_loops_ < ELASTIC_EVAL_WINDOW_LOOPS) return;
+    elastic_eval_loops_ = 0;
+
+    if (elastic_max_threads_ == 0) {
+        // Engage only once the active set is final: after the core transition
+        // for device orchestration with orch_to_sched_, immediately otherwise.
+        if (!orchestrator_done_) return;
+        if (orch_to_sched_ && !reassigned_.load(std::memory_order_acquire)) return;
+        elastic_max_threads_ = active_sched_threads_;
+        int32_t clusters_cap = CoreTracker::MAX_CORE_PER_THREAD / 3;
+        elastic_min_threads_ = (aic_count_ + clusters_cap - 1) / clusters_cap;
+        if (elastic_min_threads_ < 1) elastic_min_threads_ = 1;
+        elastic_active_.store(elastic_max_threads_, std::memory_order_release);
+        DEV_INFO("Elastic scaling engaged: %d..%d scheduler threads", elastic_min_threads_, elastic_max_threads_);
+        return;
+    }
+
+    // Never resize while the sync_start drain protocol is mid-flight: its ack
+    // mask is built from the active set this resize would change.
+    if (drain_state_.sync_start_pending.load(std::memory_order_acquire) != 0) return;
+
+    int32_t active = active_sched_threads_;
+    uint64_t depth = 0;
+    for (int32_t si = 0; si < PTO2_NUM_RESOURCE_SHAPES; si++) {
+        depth += rt->scheduler.ready_queues[si].size();
+        depth += rt->scheduler.ready_queues_high[si].size();
+    }
+    uint32_t ewma_max = 0;
+    for (int32_t t = 0; t < active; t++) {
+        uint32_t e = thread_load_[t].dispatch_ewma.load(std::memory_order_relaxed);
+        if (e > ewma_max) ewma_max = e;
+    }
+
+    bool saturated = depth > ELASTIC_UP_DEPTH_PER_THREAD * static_cast<uint64_t>(active);
+    bool quiet = depth <= ELASTIC_DOWN_DEPTH && ewma_max < ELASTIC_DOWN_EWMA;
+    elastic_hi_windows_ = saturated ? elastic_hi_windows_ + 1 : 0;
+    elastic_lo_windows_ = quiet ? elastic_lo_windows_ + 1 : 0;
+
+    if (elastic_hi_windows_ >= ELASTIC_UP_WINDOWS && active < elastic_max_threads_) {
+        elastic_hi_windows_ = 0;
+        elastic_lo_windows_ = 0;
+        apply_elastic_resize(active + 1);
+    } else if (elastic_lo_windows_ >= ELASTIC_DOWN_WINDOWS && active > elastic_min_threads_) {
+        elastic_lo_windows_ = 0;
+        apply_elastic_resize(active - 1);
+    }
+}
+
+void AicpuExecutor::apply_elastic_resize(int32_t target) {
+    int32_t active = active_sched_threads_;
+    DEV_INFO("Elastic scaling: %d -> %d scheduler threads", active, target);
+
+    elastic_ack_.store(0, std::memory_order_relaxed);
+    elastic_resize_pending_.store(true, std::memory_order_release);
+
+    // Quiesce the other active threads (parked ones are already quiescent and
+    // never ack). Peers sleeping in the tier-2 monitor wait surface within the
+    // WFE event-stream period, so this spin is bounded.
+    while (elastic_ack_.load(std::memory_order_acquire) != active - 1) {
+        if (completed_.load(std::memory_order_acquire)) {
+            // Run is tearing down — abandon the resize and release the peers.
+            elastic_resize_pending_.store(false, std::memory_order_release);
+            return;
+        }
+        SPIN_WAIT_HINT();
+    }
+
+    reassign_cores_for_all_threads(target);
+    elastic_active_.store(target, std::memory_order_release);
+    elastic_resize_pending_.store(false, std::memory_order_release);
+}
+
+LoopAction AicpuExecutor::handle_elastic_scaling(
+    int32_t thread_idx, PTO2TaskSlotState **deferred_release_slot_states, int32_t &deferred_release_count,
+    int32_t &idle_iterations
+) {
+    if (!elastic_resize_pending_.load(std::memory_order_acquire)) return LoopAction::NONE;
+
+    // Parking may follow, so push out deferred fanin releases now — no other
+    // thread will release them while this one sleeps.
+    while (deferred_release_count > 0) {
+#if PTO2_SCHED_PROFILING
+        rt->scheduler.on_task_release(*deferred_release_slot_states[--deferred_release_count], thread_idx);
+#else
+        rt->scheduler.on_task_release(*deferred_release_slot_states[--deferred_release_count]);
+#endif
+    }
+
+    elastic_ack_.fetch_add(1, std::memory_order_acq_rel);
+    while (elastic_resize_pending_.load(std::memory_order_acquire)) {
+        if (completed_.load(std::memory_order_acquire)) return LoopAction::BREAK_LOOP;
+        SPIN_WAIT_HINT();
+    }
+
+    if (thread_idx < elastic_active_.load(std::memory_order_acquire)) return LoopAction::NONE;
+
+    // Scaled out: this thread's clusters now belong to lower-indexed threads.
+    // Freeze its load estimate so peers' steal hysteresis sees it as idle,
+    // then nap until scaled back in. Bounded park: if nothing moves for the
+    // regular idle budget, rejoin the loop and let the normal timeout
+    // diagnostics take over (covers a peer aborting without setting
+    // completed_).
+    ThreadLoadState &ls = thread_load_[thread_idx];
+    ls.dispatch_ewma.store(0, std::memory_order_relaxed);
+    ls.window_dispatches = 0;
+    ls.window_loops = 0;
+    DEV_INFO("Thread %d: parked by elastic scaling", thread_idx);
+
+    int32_t park_spins = 0;
+    while (thread_idx >= elastic_active_.load(std::memory_order_acquire)) {
+        if (completed_.load(std::memory_order_acquire)) return LoopAction::BREAK_LOOP;
+        if (++park_spins > MAX_IDLE_ITERATIONS) return LoopAction::NONE;
+        SPIN_MONITOR_WAIT(&elastic_active_);
+    }
+
+    DEV_INFO("Thread %d: unparked by elastic scaling", thread_idx);
+    idle_iterations = 0;
+    return LoopAction::NONE;
 }
 
 int32_t AicpuExecutor::init(Runtime *runtime) {
@@ -1798,6 +3090,35 @@ int32_t AicpuExecutor::init(Runtime *runtime) {
         return -1;
     }
 
+    // Opt-in dispatch-loop calibration: each scheduler thread runs this many
+    // no-op round trips against its cores before real dispatch begins.
+    const char *calib_env = getenv("PTO2_DISPATCH_CALIBRATION");
+    calibration_ops_ = calib_env != nullptr ? atoi(calib_env) : 0;
+    if (calibration_ops_ < 0) calibration_ops_ = 0;
+    if (calibration_ops_ > 0) {
+        DEV_INFO("Dispatch calibration enabled: %d no-op dispatches per scheduler thread", calibration_ops_);
+    }
+
+    // Opt-in explicit CPU placement: comma-separated CPU id list, one entry
+    // per AICPU thread in thread_idx order (scheduler threads first, the
+    // orchestrator thread last). A bad list is a hard init failure — see
+    // parse_sched_cpus for the rationale.
+    const char *cpus_env = getenv("PTO2_SCHED_CPUS");
+    if (cpus_env != nullptr && cpus_env[0] != '\0') {
+        if (parse_sched_cpus(cpus_env) != 0) {
+            init_failed_.store(true, std::memory_order_release);
+            return -1;
+        }
+    }
+
+    // Opt-in elastic scheduler scaling: park/unpark scheduler threads from
+    // ready-queue pressure instead of running all of them all the time.
+    const char *elastic_env = getenv("PTO2_ELASTIC_SCHED");
+    elastic_sched_ = elastic_env != nullptr && atoi(elastic_env) != 0;
+    if (elastic_sched_) {
+        DEV_INFO("%s", "Elastic scheduler scaling enabled");
+    }
+
     // Zero all per-core execution state before handshake
     memset(core_exec_states_, 0, sizeof(core_exec_states_));
 
@@ -1828,7 +3149,7 @@ int32_t AicpuExecutor::init(Runtime *runtime) {
     } else {
         total_tasks_ = 0;
     }
-    completed_tasks_.store(0, std::memory_order_release);
+    completion_tree_.reset();
     // Host orchestration: graph already built, no wait needed. Device orch: Thread 3 will set this.
     bool orch_on_host = runtime->get_orch_built_on_host();
     DEV_INFO("Init: orch_built_on_host=%d", orch_on_host ? 1 : 0);
@@ -1836,8 +3157,9 @@ int32_t AicpuExecutor::init(Runtime *runtime) {
 
     // Initial ready tasks will be populated via scheduler ready queues
 
-    // Clear per-core dispatch payloads
-    memset(s_pto2_payload_per_core, 0, sizeof(s_pto2_payload_per_core));
+    // Clear per-core dispatch payloads. The slots are published with
+    // streaming stores and read by AICore only, so the clear streams too.
+    pto2_mem_zero_nt(s_pto2_payload_per_core, sizeof(s_pto2_payload_per_core));
 
     // Initialize per-core GlobalContext (sub_block_id) based on cluster position.
     // This is done once at startup and never modified afterwards.
@@ -1887,11 +3209,138 @@ int32_t AicpuExecutor::shutdown_aicore(
     return 0;
 }
 
+/**
+ * Dispatch-loop calibration pass (opt-in via PTO2_DISPATCH_CALIBRATION=<ops>).
+ *
+ * Runs a closed loop of no-op dispatches against this thread's cores before
+ * any real work: the payload's function_bin_addr is left 0, which the AICore
+ * executes as an empty task while still driving the full DATA_MAIN_BASE ->
+ * ACK -> FIN register round trip. Reports raw dispatch throughput, the
+ * register round-trip latency distribution, and the per-core doorbell-scan
+ * floor of the scheduler loop — a hardware/firmware health number per run
+ * that needs no workload. Results go to the log and, when profiling is on,
+ * into the perf stream as a CALIB_DISPATCH_SAMPLE record per thread.
+ *
+ * Safe to run before dispatch: each thread touches only its own cores, the
+ * dispatch_seq counters keep advancing monotonically into real dispatch, and
+ * calibrated cores end idle with last_cond_doorbell_ synced so the leftover
+ * FIN is never re-processed.
+ */
+void AicpuExecutor::run_dispatch_calibration(Runtime *runtime, int32_t thread_idx) {
+    if (calibration_ops_ <= 0) return;
+    const int32_t *cores = core_assignments_[thread_idx];
+    int32_t core_num = core_count_per_thread_[thread_idx];
+    if (core_num <= 0) return;
+    Handshake *hank = reinterpret_cast<Handshake *>(runtime->workers);
+
+    // Completion-scan floor: doorbell sweep over this thread's cores with
+    // nothing in flight — the fixed per-iteration cost the scheduler loop
+    // pays even when no completions arrive.
+    constexpr int32_t SCAN_SWEEPS = 1024;
+    uint64_t doorbell_acc = 0;
+    uint64_t scan_start = get_sys_cnt_aicpu();
+    for (int32_t sweep = 0; sweep < SCAN_SWEEPS; sweep++) {
+        for (int32_t i = 0; i < core_num; i++) {
+            doorbell_acc += hank[cores[i]].cond_doorbell;
+        }
+    }
+    uint64_t scan_end = get_sys_cnt_aicpu();
+    uint64_t scan_cycles_per_core = (scan_end - scan_start) / (static_cast<uint64_t>(SCAN_SWEEPS) * core_num);
+    (void)doorbell_acc;
+
+    // A healthy round trip is microseconds; a core that has not FINed after
+    // this many cycles is stuck and the calibration reports it instead of
+    // hanging the run.
+    constexpr uint64_t ROUND_TRIP_TIMEOUT_CYCLES = 100000000ULL;
+
+    uint64_t rt_total = 0;
+    uint64_t rt_min = UINT64_MAX;
+    uint64_t rt_max = 0;
+    int32_t ops_done = 0;
+    uint64_t window_start = get_sys_cnt_aicpu();
+    for (int32_t op = 0; op < calibration_ops_; op++) {
+        int32_t core_id = cores[op % core_num];
+        CoreExecState &core = core_exec_states_[core_id];
+        if (core.reg_addr == 0) continue;
+
+        // Same sequencing as dispatch_subtask_to_core: monotonic counter,
+        // sentinel-range skip, parity-selected dual buffer.
+        core.dispatch_seq++;
+        uint32_t reg_task_id = core.dispatch_seq & TASK_ID_MASK;
+        if (reg_task_id >= AICORE_EXIT_SIGNAL) {
+            core.dispatch_seq += (TASK_ID_MASK - reg_task_id + 1);
+            reg_task_id = core.dispatch_seq & TASK_ID_MASK;
+        }
+        PTO2DispatchPayload &payload = s_pto2_payload_per_core[core_id][reg_task_id & 1u];
+        payload.function_bin_addr = 0;
+        OUT_OF_ORDER_STORE_BARRIER();
+
+        uint64_t t0 = get_sys_cnt_aicpu();
+        write_reg(core.reg_addr, RegId::DATA_MAIN_BASE, static_cast<uint64_t>(reg_task_id));
+        bool finished = false;
+        while (!finished) {
+            uint64_t reg_val = read_reg(core.reg_addr, RegId::COND);
+            if (EXTRACT_TASK_ID(reg_val) == static_cast<int32_t>(reg_task_id) && EXTRACT_TASK_STATE(reg_val) != 0) {
+                finished = true;
+            } else if (get_sys_cnt_aicpu() - t0 > ROUND_TRIP_TIMEOUT_CYCLES) {
+                DEV_ERROR(
+                    "Thread %d: calibration: core %d never FINed no-op dispatch %u (COND=0x%" PRIx64 ")", thread_idx,
+                    core_id, reg_task_id, reg_val
+                );
+                break;
+            }
+        }
+        if (!finished) break;
+        uint64_t rt = get_sys_cnt_aicpu() - t0;
+        rt_total += rt;
+        if (rt < rt_min) rt_min = rt;
+        if (rt > rt_max) rt_max = rt;
+        ops_done++;
+        // Sync the doorbell so the leftover FIN never looks like a pending
+        // completion to the scheduler loop.
+        last_cond_doorbell_[core_id] = hank[core_id].cond_doorbell;
+    }
+    uint64_t window_end = get_sys_cnt_aicpu();
+
+    if (ops_done == 0) {
+        DEV_ERROR("Thread %d: calibration completed no dispatches (%d cores)", thread_idx, core_num);
+        return;
+    }
+    uint64_t rt_avg = rt_total / static_cast<uint64_t>(ops_done);
+    double window_us = cycles_to_us(window_end - window_start);
+    double dispatches_per_sec = window_us > 0.0 ? ops_done * 1e6 / window_us : 0.0;
+    DEV_ALWAYS(
+        "Thread %d: === Dispatch calibration: %d no-op dispatches over %d cores ===", thread_idx, ops_done, core_num
+    );
+    DEV_ALWAYS(
+        "Thread %d:   throughput     : %.0f dispatches/s (%.3fus/op)", thread_idx, dispatches_per_sec,
+        window_us / ops_done
+    );
+    DEV_ALWAYS(
+        "Thread %d:   round-trip     : avg=%.3fus min=%.3fus max=%.3fus", thread_idx, cycles_to_us(rt_avg),
+        cycles_to_us(rt_min), cycles_to_us(rt_max)
+    );
+    DEV_ALWAYS(
+        "Thread %d:   doorbell scan  : %" PRIu64 " cycles/core (%d-core sweep)", thread_idx, scan_cycles_per_core,
+        core_num
+    );
+#if PTO2_PROFILING
+    if (runtime->enable_profiling) {
+        perf_aicpu_record_phase(
+            thread_idx, AicpuPhaseId::CALIB_DISPATCH_SAMPLE, window_start, window_end,
+            static_cast<uint32_t>(ops_done), (rt_avg << 32) | (scan_cycles_per_core & 0xFFFFFFFFULL)
+        );
+    }
+#endif
+}
+
 int32_t AicpuExecutor::resolve_and_dispatch_pto2(Runtime *runtime, int32_t thread_idx) {
     int32_t &core_num = core_count_per_thread_[thread_idx];
     CoreTracker &tracker = core_trackers_[thread_idx];
     DEV_INFO("Thread %d: resolve_and_dispatch_pto2 entry", thread_idx);
 
+    run_dispatch_calibration(runtime, thread_idx);
+
     void *sm_base = runtime->get_pto2_gm_sm_ptr();
     if (!sm_base) {
         DEV_ERROR("PTO2 dispatch: sm_base is null");
@@ -1900,6 +3349,9 @@ int32_t AicpuExecutor::resolve_and_dispatch_pto2(Runtime *runtime, int32_t threa
     DEV_INFO("Thread %d: sm_base=%p", thread_idx, sm_base);
 
     PTO2SharedMemoryHeader *header = static_cast<PTO2SharedMemoryHeader *>(sm_base);
+#if PTO2_PROFILING
+    prof_sm_header_ = header;  // All threads store the same value; benign race
+#endif
     DEV_INFO(
         "Thread %d: header=%p, task_desc_offset[0]=%lu, window_size=%lu", thread_idx, static_cast<void *>(header),
         static_cast<uint64_t>(header->rings[0].task_descriptors_offset),
@@ -1944,20 +3396,35 @@ int32_t AicpuExecutor::resolve_and_dispatch_pto2(Runtime *runtime, int32_t threa
     int32_t cur_thread_completed = 0;
     int32_t idle_iterations = 0;
     int32_t last_progress_count = 0;
+    uint64_t health_loop_count = 0;  // Always-on publish cadence (thread 0 only advances it)
 #if PTO2_PROFILING
     auto &perf = sched_perf_[thread_idx];
     perf.reset();
     perf.profiling_enabled = runtime->enable_profiling;
+    pmu_sample_interval_ = perf.profiling_enabled ? perf_aicpu_pmu_sample_interval() : 0;
 #endif
 
-    // Local-first dispatch buffers (stack-allocated, one per CoreType per scheduling thread).
-    // Initialized once; must be empty at the start of each iteration.
-    constexpr int LOCAL_READY_CAP_PER_TYPE = 64;
-    PTO2TaskSlotState *local_ptrs[PTO2_NUM_RESOURCE_SHAPES][LOCAL_READY_CAP_PER_TYPE];
-    PTO2LocalReadyBuffer local_bufs[PTO2_NUM_RESOURCE_SHAPES];
+    // First-touch this thread's local dispatch storage from the thread
+    // itself so the kernel's first-touch policy places the pages on the
+    // thread's NUMA node, and log where the scheduler actually landed so a
+    // misplaced thread is visible in the init log.
+    memset(local_ready_bufs_[thread_idx], 0, sizeof(local_ready_bufs_[thread_idx]));
+    {
+        unsigned int cpu = 0;
+        unsigned int node = 0;
+        if (syscall(SYS_getcpu, &cpu, &node, NULL) == 0) {
+            DEV_INFO("Thread %d: scheduler on cpu %u, numa node %u", thread_idx, cpu, node);
+        }
+    }
+
+    // Local-first dispatch buffers (one per CoreType per scheduling thread).
+    // Initialized once; registered with the scheduler so idle peers can
+    // steal ready tasks before this thread's end-of-iteration flush.
+    PTO2LocalReadyBuffer *local_bufs = local_ready_bufs_[thread_idx];
     for (int32_t i = 0; i < PTO2_NUM_RESOURCE_SHAPES; i++) {
-        local_bufs[i].reset(local_ptrs[i], LOCAL_READY_CAP_PER_TYPE);
+        local_bufs[i].reset();
     }
+    rt->scheduler.register_local_bufs(thread_idx, local_bufs);
     PTO2TaskSlotState *deferred_release_slot_states[256];
     int32_t deferred_release_count = 0;
 
@@ -1986,6 +3453,53 @@ int32_t AicpuExecutor::resolve_and_dispatch_pto2(Runtime *runtime, int32_t threa
             if (action == LoopAction::BREAK_LOOP) break;
         }
 
+        // Elastic scaling: thread 0 evaluates ready-queue pressure and
+        // resizes the active set; other threads answer the quiesce barrier
+        // here (and park in it when scaled out).
+        if (elastic_sched_) {
+            if (thread_idx == 0) {
+                maybe_elastic_resize();
+            } else {
+                LoopAction action = handle_elastic_scaling(
+                    thread_idx, deferred_release_slot_states, deferred_release_count, idle_iterations
+                );
+                if (action == LoopAction::BREAK_LOOP) break;
+            }
+        }
+
+        update_load_window(thread_idx);
+
+#if PTO2_PROFILING
+        // Orchestration-controlled gate (pto2_rt_profiling_pause/resume):
+        // folded into the cached flag once per iteration so the per-record
+        // checks stay a plain bool on the dispatch/completion paths.
+        if (runtime->enable_profiling) {
+            perf.profiling_enabled = header->profiling_gate.load(std::memory_order_relaxed) != 0;
+        }
+#endif
+
+#if PTO2_SCHED_PROFILING
+        // Republish the cumulative cycle breakdown so the host can ingest it
+        // mid-run from shared memory; cold and off the common path.
+        if (perf.profiling_enabled && (perf.sched_loop_count & (SCHED_SUMMARY_PUBLISH_INTERVAL - 1)) == 0) {
+            publish_sched_profiling(thread_idx);
+        }
+#endif
+
+#if PTO2_PROFILING
+        if (thread_idx == 0 && perf.profiling_enabled &&
+            (perf.sched_loop_count & (OCC_SAMPLE_INTERVAL - 1)) == 0) {
+            record_ring_occupancy_sample(thread_idx, perf.sched_loop_count);
+        }
+#endif
+
+        // Always-on health publish: thread 0 refreshes the shared health
+        // block so fleet monitors can snapshot it mid-run without a
+        // profiling build (see publish_health_metrics).
+        if (thread_idx == 0 && ((++health_loop_count) & (HEALTH_PUBLISH_INTERVAL - 1)) == 0) {
+            publish_health_metrics(header);
+        }
+
 #if PTO2_PROFILING
         CYCLE_COUNT_LAP(perf.sched_idle_cycle);
 #endif
@@ -2008,17 +3522,14 @@ int32_t AicpuExecutor::resolve_and_dispatch_pto2(Runtime *runtime, int32_t threa
 #if PTO2_SCHED_PROFILING
             rt->scheduler.tasks_completed.fetch_add(completed_this_turn, std::memory_order_relaxed);
 #endif
-            int32_t prev = completed_tasks_.fetch_add(completed_this_turn, std::memory_order_relaxed);
-            int32_t new_total = prev + completed_this_turn;
+            completion_tree_.add(thread_idx, completed_this_turn);
+            // Thread 0 refreshes the root so progress totals stay exact;
+            // other threads read the (possibly slightly stale) published
+            // value — it only feeds their stall diagnostics.
+            int32_t new_total = (thread_idx == 0) ? completion_tree_.fold() : completion_tree_.observe();
             last_progress_count = new_total;
             if (thread_idx == 0 && task_count > 0) {
-                if (new_total <= PROGRESS_VERBOSE_THRESHOLD ||
-                    new_total / PROGRESS_LOG_INTERVAL != prev / PROGRESS_LOG_INTERVAL || new_total >= task_count) {
-                    DEV_ALWAYS(
-                        "PTO2 progress: completed=%d total=%d (%.1f%%)", new_total, task_count,
-                        100.0 * new_total / task_count
-                    );
-                }
+                log_progress(new_total, task_count, completed_this_turn);
             }
         }
 
@@ -2067,7 +3578,7 @@ int32_t AicpuExecutor::resolve_and_dispatch_pto2(Runtime *runtime, int32_t threa
         bool entered_drain = false;
 
         // === Two-phase dispatch: idle then pending ===
-        for (int32_t si = 0; si < PTO2_NUM_RESOURCE_SHAPES && !entered_drain; si++) {
+        for (int32_t si = 0; si < PTO2_NUM_DISPATCH_SHAPES && !entered_drain; si++) {
             PTO2ResourceShape shape = dispatch_order[si];
             for (auto phase : {CoreTracker::DispatchPhase::IDLE, CoreTracker::DispatchPhase::PENDING}) {
                 dispatch_shape(
@@ -2077,17 +3588,41 @@ int32_t AicpuExecutor::resolve_and_dispatch_pto2(Runtime *runtime, int32_t threa
             }
         }
 
+        // Phase 4b: Speculative staging into pending slots left free above.
+        if (!entered_drain) {
+            try_speculative_pending_dispatch(runtime, thread_idx, made_progress, try_pushed);
+        }
+
         // requeue in global ready queue
-        for (int32_t si = 0; si < PTO2_NUM_RESOURCE_SHAPES; si++) {
+        for (int32_t si = 0; si < PTO2_NUM_DISPATCH_SHAPES; si++) {
             PTO2ResourceShape shape = dispatch_order[si];
             auto &local_buf = local_bufs[static_cast<int32_t>(shape)];
-            auto &ready_queue = rt->scheduler.ready_queues[static_cast<int32_t>(shape)];
+            // Partition by lane so a high-priority leftover keeps its lane.
+            PTO2TaskSlotState *flush[LOCAL_READY_CAP_PER_TYPE];
+            PTO2TaskSlotState *flush_high[LOCAL_READY_CAP_PER_TYPE];
+            int32_t flush_count = 0;
+            int32_t flush_high_count = 0;
+            for (PTO2TaskSlotState *s = local_buf.pop(); s != nullptr; s = local_buf.pop()) {
+                if (pto2_is_high_priority(s->active_mask)) {
+                    flush_high[flush_high_count++] = s;
+                } else {
+                    flush[flush_count++] = s;
+                }
+            }
 #if PTO2_SCHED_PROFILING
-            perf.local_overflow_count += local_buf.count;
+            perf.local_overflow_count += flush_count + flush_high_count;
 #endif
-            if (local_buf.count > 0) {
-                ready_queue.push_batch(local_buf.slot_states, local_buf.count);
-                local_buf.count = 0;
+            if (flush_count > 0) {
+                rt->scheduler.ready_queues[static_cast<int32_t>(shape)].push_batch(flush, flush_count);
+                rt->scheduler.ready_shape_occupancy.fetch_or(
+                    PTO2SchedulerState::occupancy_bit(static_cast<int32_t>(shape), false), std::memory_order_relaxed
+                );
+            }
+            if (flush_high_count > 0) {
+                rt->scheduler.ready_queues_high[static_cast<int32_t>(shape)].push_batch(flush_high, flush_high_count);
+                rt->scheduler.ready_shape_occupancy.fetch_or(
+                    PTO2SchedulerState::occupancy_bit(static_cast<int32_t>(shape), true), std::memory_order_relaxed
+                );
             }
         }
 
@@ -2151,7 +3686,7 @@ int32_t AicpuExecutor::resolve_and_dispatch_pto2(Runtime *runtime, int32_t threa
 #endif
                 );
             } else {
-                SPIN_WAIT_HINT();
+                idle_backoff(thread_idx, idle_iterations);
             }
 #if PTO2_PROFILING
             CYCLE_COUNT_LAP(perf.sched_idle_cycle);
@@ -2185,10 +3720,123 @@ int32_t AicpuExecutor::resolve_and_dispatch_pto2(Runtime *runtime, int32_t threa
     return cur_thread_completed;
 }
 
+AicpuExecutor::OrchSoCacheEntry *AicpuExecutor::orch_so_cache_find(uint64_t so_hash) {
+    for (int32_t i = 0; i < ORCH_SO_CACHE_SLOTS; i++) {
+        if (orch_so_cache_[i].last_used != 0 && orch_so_cache_[i].so_hash == so_hash) {
+            orch_so_cache_[i].last_used = ++orch_so_cache_tick_;
+            return &orch_so_cache_[i];
+        }
+    }
+    return nullptr;
+}
+
+AicpuExecutor::OrchSoCacheEntry *AicpuExecutor::orch_so_cache_insert(const OrchSoCacheEntry &fresh) {
+    // Prefer a free slot; otherwise evict the least recently used entry.
+    int32_t victim = 0;
+    for (int32_t i = 1; i < ORCH_SO_CACHE_SLOTS; i++) {
+        if (orch_so_cache_[i].last_used < orch_so_cache_[victim].last_used) {
+            victim = i;
+        }
+    }
+    OrchSoCacheEntry *slot = &orch_so_cache_[victim];
+    if (slot->last_used != 0) {
+        DEV_INFO("Evicting orchestration SO cache entry (hash=0x%lx, path=%s)", slot->so_hash, slot->so_path);
+        dlclose(slot->handle);
+        unlink(slot->so_path);
+    }
+    *slot = fresh;
+    slot->last_used = ++orch_so_cache_tick_;
+    return slot;
+}
+
+// ===== Explicit CPU placement (PTO2_SCHED_CPUS) =====
+//
+// Per-thread hot state (thread_load_, sched_perf_, core_trackers_, the local
+// ready buffers) is alignas(64)-isolated and indexed by thread_idx, so no two
+// threads ever write the same cacheline. That isolation only stays cheap while
+// each thread stays put: when the OS migrates a scheduler thread across a
+// cluster or NUMA boundary, its lines are re-fetched over the interconnect and
+// dispatch latency jumps. PTO2_SCHED_CPUS pins thread_idx i to the i-th CPU in
+// the list so the thread-to-cacheline-home mapping is fixed for the whole run.
+// The list is explicit configuration, not discovery — the executor has no
+// topology view of its container — so any mismatch (wrong entry count, bad or
+// duplicate id, failed or ineffective pin) is a hard failure rather than a
+// silent fallback to OS placement.
+
+int32_t AicpuExecutor::parse_sched_cpus(const char *spec) {
+    long ncpu = sysconf(_SC_NPROCESSORS_CONF);
+    int32_t count = 0;
+    const char *p = spec;
+    while (*p != '\0') {
+        char *end = nullptr;
+        long cpu = strtol(p, &end, 10);
+        if (end == p || (*end != ',' && *end != '\0')) {
+            DEV_ERROR("PTO2_SCHED_CPUS: malformed entry at '%s'", p);
+            return -1;
+        }
+        if (count >= MAX_AICPU_THREADS) {
+            DEV_ERROR("PTO2_SCHED_CPUS: more than %d entries", MAX_AICPU_THREADS);
+            return -1;
+        }
+        if (cpu < 0 || (ncpu > 0 && cpu >= ncpu)) {
+            DEV_ERROR("PTO2_SCHED_CPUS: CPU id %ld out of range (0..%ld)", cpu, ncpu - 1);
+            return -1;
+        }
+        for (int32_t i = 0; i < count; i++) {
+            if (pin_cpu_of_thread_[i] == static_cast<int32_t>(cpu)) {
+                DEV_ERROR("PTO2_SCHED_CPUS: CPU id %ld listed twice", cpu);
+                return -1;
+            }
+        }
+        pin_cpu_of_thread_[count++] = static_cast<int32_t>(cpu);
+        p = (*end == ',') ? end + 1 : end;
+    }
+    if (count != thread_num_) {
+        DEV_ERROR("PTO2_SCHED_CPUS: %d entries for %d threads (need one per thread)", count, thread_num_);
+        return -1;
+    }
+#ifndef __linux__
+    DEV_ERROR("%s", "PTO2_SCHED_CPUS: explicit CPU placement requires Linux");
+    return -1;
+#endif
+    pin_cpus_enabled_ = true;
+    DEV_INFO("Explicit CPU placement enabled for %d threads", count);
+    return 0;
+}
+
+// Each thread pins itself at run() entry — the executor does not create the
+// threads (the platform kernel server calls aicpu_execute once per thread),
+// so entry into run() is the first point where thread_idx is known.
+int32_t AicpuExecutor::pin_to_configured_cpu(int32_t thread_idx) {
+    if (!pin_cpus_enabled_) return 0;
+#ifdef __linux__
+    int32_t cpu = pin_cpu_of_thread_[thread_idx];
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        DEV_ERROR("Thread %d: sched_setaffinity(CPU %d) failed (errno=%d)", thread_idx, cpu, errno);
+        return -1;
+    }
+    // A single-CPU mask means the thread must already be running there;
+    // anything else is a pin that did not take effect (e.g. a container
+    // cpuset silently masking the request).
+    int32_t now = sched_getcpu();
+    if (now >= 0 && now != cpu) {
+        DEV_ERROR("Thread %d: pinned to CPU %d but running on CPU %d", thread_idx, cpu, now);
+        return -1;
+    }
+    DEV_INFO("Thread %d: pinned to CPU %d", thread_idx, cpu);
+#endif
+    return 0;
+}
+
 int32_t AicpuExecutor::run(Runtime *runtime) {
     int32_t thread_idx = thread_idx_++;
     DEV_INFO("Thread %d: Start", thread_idx);
 
+    if (pin_to_configured_cpu(thread_idx) != 0) return -1;
+
     // Orchestrator check
     if (thread_idx >= sched_thread_num_) {
 #if PTO2_PROFILING
@@ -2208,50 +3856,6 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
                 return -1;
             }
 
-            // Try multiple paths that may allow execution on AICPU
-            char so_path[256];
-            bool file_created = false;
-            const char *candidate_dirs[] = {
-                "/usr/lib64/aicpu_kernels/0/aicpu_kernels_device", "/usr/lib64", "/lib64", "/var/tmp", "/tmp"
-            };
-            const int32_t num_candidates = sizeof(candidate_dirs) / sizeof(candidate_dirs[0]);
-
-            for (int32_t i = 0; i < num_candidates && !file_created; i++) {
-                int32_t fd = create_orch_so_file(candidate_dirs[i], so_path, sizeof(so_path));
-                if (fd < 0) {
-                    DEV_INFO(
-                        "Thread %d: Cannot create SO at %s (errno=%d), trying next path", thread_idx, so_path, errno
-                    );
-                    continue;
-                }
-                ssize_t written = write(fd, so_data, so_size);
-                close(fd);
-                if (written != static_cast<ssize_t>(so_size)) {
-                    DEV_INFO(
-                        "Thread %d: Cannot write SO to %s (errno=%d), trying next path", thread_idx, so_path, errno
-                    );
-                    unlink(so_path);
-                    continue;
-                }
-                file_created = true;
-                DEV_INFO("Thread %d: Created SO file at %s (%zu bytes)", thread_idx, so_path, so_size);
-            }
-
-            if (!file_created) {
-                DEV_ERROR("Thread %d: Failed to create SO file in any candidate path", thread_idx);
-                return -1;
-            }
-
-            dlerror();
-            void *handle = dlopen(so_path, RTLD_LAZY | RTLD_LOCAL);
-            const char *dlopen_err = dlerror();
-            if (handle == nullptr) {
-                DEV_ERROR("Thread %d: dlopen failed: %s", thread_idx, dlopen_err ? dlopen_err : "unknown");
-                unlink(so_path);
-                return -1;
-            }
-            DEV_INFO("Thread %d: dlopen succeeded, handle=%p", thread_idx, handle);
-
             const char *entry_symbol = runtime->get_device_orch_func_name();
             if (entry_symbol == nullptr || entry_symbol[0] == '\0') {
                 entry_symbol = DEFAULT_ORCH_ENTRY_SYMBOL;
@@ -2261,44 +3865,149 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
                 config_symbol = DEFAULT_ORCH_CONFIG_SYMBOL;
             }
 
-            dlerror();
-            DeviceOrchestrationFunc orch_func = reinterpret_cast<DeviceOrchestrationFunc>(dlsym(handle, entry_symbol));
-            const char *entry_dlsym_error = dlerror();
-            if (entry_dlsym_error != nullptr) {
-                DEV_ERROR(
-                    "Thread %d: dlsym failed for entry symbol '%s': %s", thread_idx, entry_symbol, entry_dlsym_error
-                );
-                dlclose(handle);
-                unlink(so_path);
-                return -1;
-            }
-            if (orch_func == nullptr) {
-                DEV_ERROR("Thread %d: dlsym returned NULL for entry symbol '%s'", thread_idx, entry_symbol);
-                dlclose(handle);
-                unlink(so_path);
-                return -1;
-            }
+            uint64_t so_hash = orch_so_content_hash(so_data, so_size);
+            OrchSoCacheEntry *cache_entry = orch_so_cache_find(so_hash);
+            void *handle = nullptr;
+            DeviceOrchestrationFunc orch_func = nullptr;
+            DeviceOrchestrationConfigFunc config_func = nullptr;
+            DeviceOrchestrationBindRuntimeFunc bind_runtime_func = nullptr;
 
-            dlerror();
-            auto config_func = reinterpret_cast<DeviceOrchestrationConfigFunc>(dlsym(handle, config_symbol));
-            const char *config_dlsym_error = dlerror();
-            if (config_dlsym_error != nullptr || config_func == nullptr) {
-                DEV_ERROR(
-                    "Thread %d: dlsym failed for config symbol '%s': %s", thread_idx, config_symbol,
-                    config_dlsym_error ? config_dlsym_error : "NULL function pointer"
+            if (cache_entry != nullptr) {
+                DEV_INFO(
+                    "Thread %d: Orchestration SO cache hit (hash=0x%lx), skipping file write and dlopen", thread_idx,
+                    so_hash
                 );
-                config_func = nullptr;
-            }
+                handle = cache_entry->handle;
+
+                // The same image may be run under different symbol names;
+                // re-resolve only on a name change (dlsym on an open handle
+                // is the cheap part of the load cycle).
+                if (strcmp(cache_entry->entry_symbol, entry_symbol) != 0) {
+                    dlerror();
+                    cache_entry->orch_func = reinterpret_cast<DeviceOrchestrationFunc>(dlsym(handle, entry_symbol));
+                    const char *entry_dlsym_error = dlerror();
+                    if (entry_dlsym_error != nullptr || cache_entry->orch_func == nullptr) {
+                        DEV_ERROR(
+                            "Thread %d: dlsym failed for entry symbol '%s': %s", thread_idx, entry_symbol,
+                            entry_dlsym_error ? entry_dlsym_error : "NULL function pointer"
+                        );
+                        cache_entry->entry_symbol[0] = '\0';
+                        return -1;
+                    }
+                    snprintf(cache_entry->entry_symbol, sizeof(cache_entry->entry_symbol), "%s", entry_symbol);
+                }
+                if (strcmp(cache_entry->config_symbol, config_symbol) != 0) {
+                    dlerror();
+                    cache_entry->config_func =
+                        reinterpret_cast<DeviceOrchestrationConfigFunc>(dlsym(handle, config_symbol));
+                    if (dlerror() != nullptr) {
+                        cache_entry->config_func = nullptr;
+                    }
+                    snprintf(cache_entry->config_symbol, sizeof(cache_entry->config_symbol), "%s", config_symbol);
+                }
 
-            dlerror();
-            auto bind_runtime_func =
-                reinterpret_cast<DeviceOrchestrationBindRuntimeFunc>(dlsym(handle, "pto2_framework_bind_runtime"));
-            const char *bind_runtime_error = dlerror();
-            if (bind_runtime_error != nullptr) {
-                DEV_ERROR(
-                    "Thread %d: dlsym failed for pto2_framework_bind_runtime: %s", thread_idx, bind_runtime_error
-                );
-                bind_runtime_func = nullptr;
+                orch_func = cache_entry->orch_func;
+                config_func = cache_entry->config_func;
+                bind_runtime_func = cache_entry->bind_runtime_func;
+            } else {
+                DEV_INFO("Thread %d: Orchestration SO cache miss (hash=0x%lx), loading via dlopen", thread_idx, so_hash);
+
+                // Try multiple paths that may allow execution on AICPU
+                char so_path[256];
+                bool file_created = false;
+                const char *candidate_dirs[] = {
+                    "/usr/lib64/aicpu_kernels/0/aicpu_kernels_device", "/usr/lib64", "/lib64", "/var/tmp", "/tmp"
+                };
+                const int32_t num_candidates = sizeof(candidate_dirs) / sizeof(candidate_dirs[0]);
+
+                for (int32_t i = 0; i < num_candidates && !file_created; i++) {
+                    int32_t fd = create_orch_so_file(candidate_dirs[i], so_path, sizeof(so_path));
+                    if (fd < 0) {
+                        DEV_INFO(
+                            "Thread %d: Cannot create SO at %s (errno=%d), trying next path", thread_idx, so_path, errno
+                        );
+                        continue;
+                    }
+                    ssize_t written = write(fd, so_data, so_size);
+                    close(fd);
+                    if (written != static_cast<ssize_t>(so_size)) {
+                        DEV_INFO(
+                            "Thread %d: Cannot write SO to %s (errno=%d), trying next path", thread_idx, so_path, errno
+                        );
+                        unlink(so_path);
+                        continue;
+                    }
+                    file_created = true;
+                    DEV_INFO("Thread %d: Created SO file at %s (%zu bytes)", thread_idx, so_path, so_size);
+                }
+
+                if (!file_created) {
+                    DEV_ERROR("Thread %d: Failed to create SO file in any candidate path", thread_idx);
+                    return -1;
+                }
+
+                dlerror();
+                handle = dlopen(so_path, RTLD_LAZY | RTLD_LOCAL);
+                const char *dlopen_err = dlerror();
+                if (handle == nullptr) {
+                    DEV_ERROR("Thread %d: dlopen failed: %s", thread_idx, dlopen_err ? dlopen_err : "unknown");
+                    unlink(so_path);
+                    return -1;
+                }
+                DEV_INFO("Thread %d: dlopen succeeded, handle=%p", thread_idx, handle);
+
+                dlerror();
+                orch_func = reinterpret_cast<DeviceOrchestrationFunc>(dlsym(handle, entry_symbol));
+                const char *entry_dlsym_error = dlerror();
+                if (entry_dlsym_error != nullptr) {
+                    DEV_ERROR(
+                        "Thread %d: dlsym failed for entry symbol '%s': %s", thread_idx, entry_symbol, entry_dlsym_error
+                    );
+                    dlclose(handle);
+                    unlink(so_path);
+                    return -1;
+                }
+                if (orch_func == nullptr) {
+                    DEV_ERROR("Thread %d: dlsym returned NULL for entry symbol '%s'", thread_idx, entry_symbol);
+                    dlclose(handle);
+                    unlink(so_path);
+                    return -1;
+                }
+
+                dlerror();
+                config_func = reinterpret_cast<DeviceOrchestrationConfigFunc>(dlsym(handle, config_symbol));
+                const char *config_dlsym_error = dlerror();
+                if (config_dlsym_error != nullptr || config_func == nullptr) {
+                    DEV_ERROR(
+                        "Thread %d: dlsym failed for config symbol '%s': %s", thread_idx, config_symbol,
+                        config_dlsym_error ? config_dlsym_error : "NULL function pointer"
+                    );
+                    config_func = nullptr;
+                }
+
+                dlerror();
+                bind_runtime_func =
+                    reinterpret_cast<DeviceOrchestrationBindRuntimeFunc>(dlsym(handle, "pto2_framework_bind_runtime"));
+                const char *bind_runtime_error = dlerror();
+                if (bind_runtime_error != nullptr) {
+                    DEV_ERROR(
+                        "Thread %d: dlsym failed for pto2_framework_bind_runtime: %s", thread_idx, bind_runtime_error
+                    );
+                    bind_runtime_func = nullptr;
+                }
+
+                // The cache owns the handle and backing file from here on;
+                // they are released only when this entry is evicted.
+                OrchSoCacheEntry fresh;
+                fresh.so_hash = so_hash;
+                fresh.handle = handle;
+                snprintf(fresh.so_path, sizeof(fresh.so_path), "%s", so_path);
+                snprintf(fresh.entry_symbol, sizeof(fresh.entry_symbol), "%s", entry_symbol);
+                snprintf(fresh.config_symbol, sizeof(fresh.config_symbol), "%s", config_symbol);
+                fresh.orch_func = orch_func;
+                fresh.config_func = config_func;
+                fresh.bind_runtime_func = bind_runtime_func;
+                cache_entry = orch_so_cache_insert(fresh);
             }
 
             const ChipStorageTaskArgs &args = runtime->get_orch_args();
@@ -2321,18 +4030,23 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
             uint64_t task_window_size = PTO2_TASK_WINDOW_SIZE;
             uint64_t heap_size = PTO2_HEAP_SIZE;
             int32_t expected_arg_count = 0;
+            bool chain_fusion = false;
             if (config_func) {
                 PTO2OrchestrationConfig cfg = config_func(args);
                 expected_arg_count = cfg.expected_arg_count;
-                DEV_INFO("Thread %d: Config: expected_args=%d", thread_idx, expected_arg_count);
+                chain_fusion = (cfg.enable_chain_fusion != 0);
+                DEV_INFO(
+                    "Thread %d: Config: expected_args=%d chain_fusion=%d", thread_idx, expected_arg_count,
+                    chain_fusion ? 1 : 0
+                );
             } else {
                 DEV_INFO("Thread %d: No config function, using defaults", thread_idx);
             }
 
+            // On the failures below the SO stays open in the cache; a retry
+            // of the same model must not pay the dlopen cycle again.
             if (expected_arg_count > 0 && arg_count < expected_arg_count) {
                 DEV_ERROR("Thread %d: arg_count %d < expected %d", thread_idx, arg_count, expected_arg_count);
-                dlclose(handle);
-                unlink(so_path);
                 return -1;
             }
 
@@ -2359,20 +4073,29 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
                 pto2_sm_create_from_buffer(sm_ptr, sm_size, task_window_size, heap_size);
             if (!sm_handle) {
                 DEV_ERROR("Thread %d: Failed to create shared memory handle", thread_idx);
-                dlclose(handle);
-                unlink(so_path);
                 return -1;
             }
 
+            // Publish host-set tuning knobs before the orchestrator and
+            // scheduler snapshot their spin limits at init (create_from_buffer
+            // just zeroed the block).
+            sm_handle->header->params = runtime->pto2_params;
+
             rt = pto2_runtime_create_from_sm(PTO2_MODE_EXECUTE, sm_handle, gm_heap, heap_size, dep_pool_capacity);
             if (!rt) {
                 DEV_ERROR("Thread %d: Failed to create PTO2Runtime", thread_idx);
                 pto2_sm_destroy(sm_handle);
-                dlclose(handle);
-                unlink(so_path);
                 return -1;
             }
 
+            // One AICPU thread means one scheduler forever (the orch→sched
+            // transition cannot raise active_sched_threads_ past 1), so the
+            // ready queues can drop the MPMC sequence-CAS protocol for plain
+            // wait-free index stores.
+            if (thread_num_ == 1) {
+                pto2_scheduler_set_single_thread(&rt->scheduler, true);
+            }
+
 #if PTO2_PROFILING
             rt->orchestrator.enable_profiling = runtime->enable_profiling;
 #endif
@@ -2380,6 +4103,7 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
             // Total core counts = aic_count_ / aiv_count_ (set once at runtime init).
             rt->orchestrator.total_cluster_count = aic_count_;
             rt->orchestrator.total_aiv_count = aiv_count_;
+            rt->orchestrator.enable_chain_fusion = chain_fusion;
 
             // With multi-ring, slot_states are per-ring inside the scheduler.
             runtime->set_pto2_slot_states_ptr(nullptr);
@@ -2388,7 +4112,6 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
             orch_bind_runtime_ = bind_runtime_func;
             orch_args_cached_ = &args;
             orch_so_handle_ = handle;
-            snprintf(orch_so_path_, sizeof(orch_so_path_), "%s", so_path);
 
             runtime_init_ready_.store(true, std::memory_order_release);
 
@@ -2461,6 +4184,15 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
                 p.submit_count > 0 ? cycles_to_us(total) / p.submit_count : 0.0
             );
 
+            PTO2RingTelemetry ring_tm = pto2_orchestrator_get_ring_telemetry(&rt->orchestrator);
+            DEV_ALWAYS(
+                "Thread %d:   ring high-water: tasks=%d/%d heap=%" PRIu64 "/%" PRIu64 " stalls(task=%" PRIu64
+                ", heap=%" PRIu64 ") spills=%" PRIu64 " inline=%" PRIu64,
+                thread_idx, ring_tm.peak_live_tasks, ring_tm.task_window_size, ring_tm.peak_heap_used,
+                ring_tm.heap_capacity, ring_tm.task_stall_count, ring_tm.heap_stall_count, ring_tm.spill_alloc_count,
+                ring_tm.inline_alloc_count
+            );
+
 #if PTO2_TENSORMAP_PROFILING
             PTO2TensorMapProfilingData tp = pto2_tensormap_get_profiling();
             DEV_ALWAYS("Thread %d: === TensorMap Lookup Stats ===", thread_idx);
@@ -2496,6 +4228,14 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
                 orch_summary.fanin_cycle = p.fanin_cycle;
                 orch_summary.scope_end_cycle = p.scope_end_cycle;
                 orch_summary.submit_count = p.submit_count;
+                orch_summary.peak_live_tasks = ring_tm.peak_live_tasks;
+                orch_summary.task_window_size = ring_tm.task_window_size;
+                orch_summary.peak_heap_used = ring_tm.peak_heap_used;
+                orch_summary.heap_capacity = ring_tm.heap_capacity;
+                orch_summary.alloc_task_stalls = ring_tm.task_stall_count;
+                orch_summary.alloc_heap_stalls = ring_tm.heap_stall_count;
+                orch_summary.heap_spill_count = ring_tm.spill_alloc_count;
+                orch_summary.inline_alloc_count = ring_tm.inline_alloc_count;
                 perf_aicpu_write_orch_summary(&orch_summary);
             }
 #endif
@@ -2532,7 +4272,7 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
             }
             int32_t inline_completed = static_cast<int32_t>(rt->orchestrator.inline_completed_tasks);
             if (inline_completed > 0) {
-                completed_tasks_.fetch_add(inline_completed, std::memory_order_relaxed);
+                completion_tree_.add(thread_idx, inline_completed);
 #if PTO2_SCHED_PROFILING
                 rt->scheduler.tasks_completed.fetch_add(inline_completed, std::memory_order_relaxed);
 #endif
@@ -2583,7 +4323,7 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
                     SPIN_WAIT_HINT();
                 }
                 if (!completed_.load(std::memory_order_acquire)) {
-                    reassign_cores_for_all_threads();
+                    reassign_cores_for_all_threads(thread_num_);
                     reassigned_.store(true, std::memory_order_release);
                 }
             }
@@ -2605,7 +4345,7 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
         if (pto2_submitted_tasks >= 0) {
             DEV_ALWAYS(
                 "PTO2 total submitted tasks = %d, already executed %d tasks", pto2_submitted_tasks,
-                completed_tasks_.load(std::memory_order_acquire)
+                completion_tree_.observe()
             );
         }
 #endif
@@ -2660,6 +4400,10 @@ int32_t AicpuExecutor::run(Runtime *runtime) {
 }
 
 void AicpuExecutor::deinit(Runtime *runtime) {
+    // Drain deferred binary log records (no-op unless SIMPLER_LOG_BINARY=1):
+    // the run is over, so formatting here is off every hot path.
+    unified_log_flush_binary();
+
     // 1. Invalidate AICPU cache for Runtime address range.
     //    Next round's Host DMA (rtMemcpy) writes fresh Runtime to HBM but
     //    bypasses this cache. Invalidating now ensures next round reads from HBM.
@@ -2672,10 +4416,28 @@ void AicpuExecutor::deinit(Runtime *runtime) {
         core_exec_states_[i].pending_reg_task_id = AICPU_TASK_INVALID;
     }
 
-    // Clear per-core dispatch payloads
-    memset(s_pto2_payload_per_core, 0, sizeof(s_pto2_payload_per_core));
+    // Clear per-core dispatch payloads (streamed; see the init-path clear)
+    pto2_mem_zero_nt(s_pto2_payload_per_core, sizeof(s_pto2_payload_per_core));
 
-    completed_tasks_.store(0, std::memory_order_release);
+#if PTO2_PROFILING
+    // Discard open idle intervals so the next run starts unattributed
+    memset(core_idle_since_, 0, sizeof(core_idle_since_));
+    memset(core_pmu_base_, 0, sizeof(core_pmu_base_));
+    memset(core_pmu_armed_, 0, sizeof(core_pmu_armed_));
+    pmu_sample_interval_ = 0;
+    memset(core_idle_cause_, 0, sizeof(core_idle_cause_));
+    prof_sm_header_ = nullptr;
+#endif
+
+    // Health block state restarts with the next run (the shared-memory copy
+    // itself is cleared by pto2_sm_reset / init_header on the host side)
+    memset(health_latency_, 0, sizeof(health_latency_));
+    health_prev_completed_ = 0;
+    health_prev_sys_cnt_ = 0;
+    health_publish_count_ = 0;
+    health_alloc_stall_samples_ = 0;
+
+    completion_tree_.reset();
     total_tasks_ = 0;
     finished_count_.store(0, std::memory_order_release);
     orchestrator_done_ = false;
@@ -2687,6 +4449,17 @@ void AicpuExecutor::deinit(Runtime *runtime) {
     transition_requested_.store(false, std::memory_order_release);
     wait_reassign_.store(0, std::memory_order_release);
     reassigned_.store(false, std::memory_order_release);
+
+    // Reset elastic scaling state
+    elastic_sched_ = false;
+    elastic_max_threads_ = 0;
+    elastic_min_threads_ = 1;
+    elastic_active_.store(0, std::memory_order_release);
+    elastic_resize_pending_.store(false, std::memory_order_release);
+    elastic_ack_.store(0, std::memory_order_release);
+    elastic_eval_loops_ = 0;
+    elastic_hi_windows_ = 0;
+    elastic_lo_windows_ = 0;
     completed_.store(false, std::memory_order_release);
 
     // Reset core discovery and assignment state
@@ -2706,14 +4479,9 @@ void AicpuExecutor::deinit(Runtime *runtime) {
     orch_func_ = nullptr;
     orch_bind_runtime_ = nullptr;
     orch_args_cached_ = nullptr;
-    if (orch_so_handle_ != nullptr) {
-        dlclose(orch_so_handle_);
-    }
-    if (orch_so_path_[0] != '\0') {
-        unlink(orch_so_path_);
-    }
+    // The SO handle and backing file are owned by the orchestration SO cache
+    // and survive the round; they are released only on LRU eviction.
     orch_so_handle_ = nullptr;
-    orch_so_path_[0] = '\0';
 
     // Clear file-scope PTO2Runtime pointer (freed by orchestrator thread before deinit)
     rt = nullptr;
@@ -2731,6 +4499,9 @@ void AicpuExecutor::deinit(Runtime *runtime) {
 
 void AicpuExecutor::emergency_shutdown(Runtime *runtime) {
     DEV_WARN("Emergency shutdown: sending exit signal to all initialized cores");
+    // Persist the event history before tearing the cores down; a no-op if an
+    // earlier abort path (allocator/scope deadlock) already dumped it.
+    pto2_flight_dump("emergency_shutdown");
     Handshake *all_handshakes = reinterpret_cast<Handshake *>(runtime->workers);
     for (int32_t i = 0; i < cores_total_num_; i++) {
         Handshake *hank = &all_handshakes[i];
@@ -2751,15 +4522,23 @@ void AicpuExecutor::diagnose_stuck_state(
     PTO2SchedulerState *sched = &rt->scheduler;
     DEV_ALWAYS("========== DIAGNOSTIC REPORT: Thread %d ==========", thread_idx);
 
-    int32_t completed = completed_tasks_.load(std::memory_order_acquire);
+    // Stuck-state diagnosis: sum the leaves directly — the root may be stale
+    // if thread 0 itself is the stuck thread.
+    int32_t completed = 0;
+    for (const CompletionTree::Leaf &leaf : completion_tree_.leaves) {
+        completed += leaf.count.load(std::memory_order_acquire);
+    }
     int32_t total = total_tasks_;
     DEV_ALWAYS("Progress: %d/%d tasks (%.1f%%)", completed, total, total > 0 ? completed * 100.0 / total : 0.0);
 
     uint64_t aic_ready = 0, aiv_ready = 0, mix_ready = 0;
     if (rt) {
-        aic_ready = sched->ready_queues[static_cast<int32_t>(PTO2ResourceShape::AIC)].size();
-        aiv_ready = sched->ready_queues[static_cast<int32_t>(PTO2ResourceShape::AIV)].size();
-        mix_ready = sched->ready_queues[static_cast<int32_t>(PTO2ResourceShape::MIX)].size();
+        aic_ready = sched->ready_queues[static_cast<int32_t>(PTO2ResourceShape::AIC)].size() +
+                    sched->ready_queues_high[static_cast<int32_t>(PTO2ResourceShape::AIC)].size();
+        aiv_ready = sched->ready_queues[static_cast<int32_t>(PTO2ResourceShape::AIV)].size() +
+                    sched->ready_queues_high[static_cast<int32_t>(PTO2ResourceShape::AIV)].size();
+        mix_ready = sched->ready_queues[static_cast<int32_t>(PTO2ResourceShape::MIX)].size() +
+                    sched->ready_queues_high[static_cast<int32_t>(PTO2ResourceShape::MIX)].size();
     }
     DEV_ALWAYS("Ready Queues: AIC=%lu, AIV=%lu, MIX=%lu", aic_ready, aiv_ready, mix_ready);
 
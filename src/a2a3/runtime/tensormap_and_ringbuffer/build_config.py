@@ -18,9 +18,44 @@
 # runtime targets AND the orchestration .so (e.g., tensor methods needed
 # by the Tensor constructor's validation logic).
 
+# Compile-time variant selection ("NAME=VALUE" entries, passed as -D flags).
+# The same list feeds every target: specialization macros here change
+# shared-memory layout or scheduling behavior, so a per-target mismatch
+# would desync the host/aicpu/orchestration view of shared structs.
+# Defaults live in runtime/pto_runtime2_types.h; uncomment to specialize,
+# e.g. a pure-AIC/AIV single-ring deployment:
+#   _COMMON_DEFINES = ["PTO2_ENABLE_MIX=0", "PTO2_MAX_RING_DEPTH=1"]
+# or the strict zero-instrumentation production profile (collector and tensor
+# dump entry points compile to inline no-ops and their translation units to
+# nothing — verify with nm: no perf_aicpu_*/dump_tensor_* symbols in the
+# AICPU .so; see PTO_INSTRUMENTATION in platform_config.h):
+#   _COMMON_DEFINES = ["PTO_INSTRUMENTATION=0", "PTO2_PROFILING=0"]
+# or the I-cache layout profile for a front-end-bound scheduler (groups the
+# steady-state loop into .text.pto2_hot and outlined diagnostics into
+# .text.pto2_cold; verify the hot footprint against the AICPU L1 I-cache
+# with examples/scripts/icache_report.py on the build's object files):
+#   _COMMON_DEFINES = ["PTO2_ICACHE_SPLIT=1"]
+_COMMON_DEFINES: list = []
+
 BUILD_CONFIG = {
-    "aicore": {"include_dirs": ["runtime", "common"], "source_dirs": ["aicore", "orchestration"]},
-    "aicpu": {"include_dirs": ["runtime", "common"], "source_dirs": ["aicpu", "runtime", "orchestration"]},
-    "host": {"include_dirs": ["runtime", "common"], "source_dirs": ["host", "runtime", "orchestration"]},
-    "orchestration": {"include_dirs": ["runtime", "orchestration", "common"], "source_dirs": ["orchestration"]},
+    "aicore": {
+        "include_dirs": ["runtime", "common"],
+        "source_dirs": ["aicore", "orchestration"],
+        "defines": _COMMON_DEFINES,
+    },
+    "aicpu": {
+        "include_dirs": ["runtime", "common"],
+        "source_dirs": ["aicpu", "runtime", "orchestration"],
+        "defines": _COMMON_DEFINES,
+    },
+    "host": {
+        "include_dirs": ["runtime", "common"],
+        "source_dirs": ["host", "runtime", "orchestration"],
+        "defines": _COMMON_DEFINES,
+    },
+    "orchestration": {
+        "include_dirs": ["runtime", "orchestration", "common"],
+        "source_dirs": ["orchestration"],
+        "defines": _COMMON_DEFINES,
+    },
 }
@@ -60,8 +60,9 @@
 #define __aicore__
 #endif
 
-/** Number of extra pointer slots appended to the args[] tail (LocalContext + GlobalContext). */
-static constexpr int32_t PTO2_EXT_PARAMS_COUNT = 2;
+/** Number of extra slots appended to the args[] tail
+ *  (LocalContext + GlobalContext pointers + device-enqueue ring base). */
+static constexpr int32_t PTO2_EXT_PARAMS_COUNT = 3;
 
 /**
  * Args[] suffix indices for context pointers.
@@ -70,6 +71,7 @@ static constexpr int32_t PTO2_EXT_PARAMS_COUNT = 2;
  */
 static constexpr int32_t SPMD_LOCAL_CONTEXT_INDEX = 144;
 static constexpr int32_t SPMD_GLOBAL_CONTEXT_INDEX = 145;
+static constexpr int32_t SPMD_DEVICE_ENQUEUE_INDEX = 146;
 
 /**
  * Per-core global context, stored in PTO2DispatchPayload.
@@ -95,6 +97,47 @@ struct LocalContext {
                         // Currently fixed to 1 (block_dim > 1 not yet implemented).
                         // NOT the same as RUNTIME_CONFIG.block_dim in kernel_config.py,
                         // which controls how many physical cores the runtime launches.
+
+    // Precomputed 2-D block coordinates, filled by build_payload() from the
+    // task's launch_spec grid width (block_dim_x). When no width was set,
+    // block_idx_x == block_idx and block_idx_y == 0. Reading these instead
+    // of deriving coordinates from block_idx keeps div/mod chains out of
+    // kernel prologues.
+    int32_t block_idx_x;  // block_idx % block_dim_x
+    int32_t block_idx_y;  // block_idx / block_dim_x
+
+    // WIP PerfRecord address for this dispatch, injected by the AICore
+    // executor before the kernel runs (the AICPU stages 0). Non-zero only
+    // while profiling is enabled; kernels pass it to
+    // perf_aicore_phase_marker() to stamp intra-kernel phases.
+    uint64_t perf_record;
+
+    // Chain-residency hint: GM base of the producing task's packed output
+    // when this dispatch was staged back-to-back behind that producer on
+    // the same core (chain fusion / speculative pending staging) and the
+    // output is small enough to have stayed in the core's local buffer
+    // (<= PTO2_CHAIN_RESIDENT_CAP). 0 on every other dispatch — including
+    // any migration to a different core — so the GM path is always the
+    // safe default. See get_chain_resident_src() for the kernel contract.
+    uint64_t chain_src;
+
+    // Early-input-release writeback slot: staged 0 on every dispatch, set
+    // non-zero by the kernel once it has finished reading ALL of its input
+    // tensors. The AICPU completion scan polls this word for running
+    // single-core tasks that opted in via PTO2LaunchSpec and releases the
+    // task's fanin references ahead of completion. Volatile: written by the
+    // AICore mid-kernel, read concurrently by the AICPU.
+    // See get_input_release_slot() for the kernel contract.
+    volatile uint64_t input_release;
+
+    // Scalar result mailbox: GM address of the task's mailbox line when the
+    // submit opted in via PTO2LaunchSpec::set_scalar_result(), 0 on every
+    // other dispatch. The kernel publishes an 8-byte result here
+    // mid-execution; the orchestrator's pto2_rt_read_scalar() spins on that
+    // line only, so a dynamic-shape decision costs a cacheline transfer
+    // instead of a full completion round-trip.
+    // See get_scalar_mailbox() for the kernel contract.
+    uint64_t scalar_mailbox;
 };
 
 /**
@@ -140,3 +183,176 @@ static __aicore__ inline int32_t get_block_num(__gm__ int64_t *args) {
         reinterpret_cast<__gm__ LocalContext *>(static_cast<uint64_t>(args[SPMD_LOCAL_CONTEXT_INDEX]));
     return ctx->block_num;
 }
+
+/**
+ * Return the precomputed X coordinate of the current logical block.
+ * Equals block_idx % block_dim_x when the submit set a grid width via
+ * PTO2LaunchSpec::set_block_dim_x(), else equals get_block_idx().
+ * Precomputed by the dispatcher so prologues avoid the div/mod chain.
+ */
+static __aicore__ inline int32_t get_block_idx_x(__gm__ int64_t *args) {
+    __gm__ LocalContext *ctx =
+        reinterpret_cast<__gm__ LocalContext *>(static_cast<uint64_t>(args[SPMD_LOCAL_CONTEXT_INDEX]));
+    return ctx->block_idx_x;
+}
+
+/**
+ * Return the precomputed Y coordinate of the current logical block.
+ * Equals block_idx / block_dim_x when the submit set a grid width via
+ * PTO2LaunchSpec::set_block_dim_x(), else 0.
+ */
+static __aicore__ inline int32_t get_block_idx_y(__gm__ int64_t *args) {
+    __gm__ LocalContext *ctx =
+        reinterpret_cast<__gm__ LocalContext *>(static_cast<uint64_t>(args[SPMD_LOCAL_CONTEXT_INDEX]));
+    return ctx->block_idx_y;
+}
+
+/**
+ * Return this dispatch's WIP PerfRecord address, or 0 when profiling is off.
+ * Feed the value to perf_aicore_phase_marker() (performance_collector_aicore.h)
+ * to stamp intra-kernel phase timestamps into the task's perf record; a 0
+ * makes the marker call a no-op, so kernels need no profiling-mode branch.
+ */
+static __aicore__ inline uint64_t get_perf_record(__gm__ int64_t *args) {
+    __gm__ LocalContext *ctx =
+        reinterpret_cast<__gm__ LocalContext *>(static_cast<uint64_t>(args[SPMD_LOCAL_CONTEXT_INDEX]));
+    return ctx->perf_record;
+}
+
+/**
+ * Return the GM base of a producer output still resident in this core's
+ * local buffer, or 0.
+ *
+ * Non-zero means: the kernel that wrote this address ran on THIS core
+ * immediately before the current dispatch, nothing executed in between
+ * (the runtime staged the two back-to-back), and the output's packed size
+ * is <= PTO2_CHAIN_RESIDENT_CAP. A cooperating producer kernel that leaves
+ * small outputs in an agreed local-buffer region may then be paired with a
+ * consumer that compares this value against its input tensor's data
+ * pointer and, on a match, reads the local copy instead of round-tripping
+ * through GM.
+ *
+ * The hint is advisory and one-sided: the producer must still write the
+ * output to GM (other consumers, or none staged in time, read it there),
+ * and the consumer must fall back to the GM pointer whenever the value is
+ * 0 or does not match — which is exactly what happens when the scheduler
+ * migrated the consumer to another core. Kernels that do not participate
+ * in a residency pairing can ignore this accessor entirely.
+ */
+static __aicore__ inline uint64_t get_chain_resident_src(__gm__ int64_t *args) {
+    __gm__ LocalContext *ctx =
+        reinterpret_cast<__gm__ LocalContext *>(static_cast<uint64_t>(args[SPMD_LOCAL_CONTEXT_INDEX]));
+    return ctx->chain_src;
+}
+
+/**
+ * Return the GM address of this dispatch's early-input-release writeback slot.
+ *
+ * A kernel that has finished reading every one of its input tensors — and
+ * will not touch them again for the rest of its execution — may publish a
+ * non-zero value to this slot via aicore_signal_publish()
+ * (aicore/signal_aicore.h, which pairs the store with the cache writeback
+ * the AICPU needs to observe it mid-kernel). For tasks submitted with
+ * PTO2LaunchSpec::set_early_input_release(), the AICPU then drops the
+ * task's input references immediately instead of at kernel completion,
+ * letting the ring heap reclaim upstream buffers while the kernel is still
+ * computing.
+ *
+ * The signal is a promise, not a hint: after publishing, the bytes behind
+ * every INPUT tensor may be reused at any moment. Kernels must only signal
+ * once all input reads (including any in-flight data moves from GM) have
+ * completed. Signalling is optional — a kernel that never writes the slot
+ * behaves exactly as before — and is ignored for tasks that did not opt in
+ * at submit time, or that span multiple cores or logical blocks.
+ */
+static __aicore__ inline uint64_t get_input_release_slot(__gm__ int64_t *args) {
+    __gm__ LocalContext *ctx =
+        reinterpret_cast<__gm__ LocalContext *>(static_cast<uint64_t>(args[SPMD_LOCAL_CONTEXT_INDEX]));
+    return reinterpret_cast<uint64_t>(&ctx->input_release);
+}
+
+/**
+ * Return the GM address of this task's scalar result mailbox, or 0.
+ *
+ * Non-zero only for tasks submitted with PTO2LaunchSpec::set_scalar_result().
+ * The mailbox is a dedicated cache line: a flag word at offset 0 (cleared to
+ * 0 at submit) followed by a value word at offset 8. To publish a result
+ * mid-execution, write the value word first, then publish a non-zero flag
+ * via aicore_signal_publish() — both words share the line, so the flag's
+ * writeback carries the value with it:
+ *
+ *   uint64_t mb = get_scalar_mailbox(args);
+ *   if (mb != 0) {
+ *       reinterpret_cast<__gm__ volatile uint64_t *>(mb)[1] = result_bits;
+ *       aicore_signal_publish(mb, 1);  // signal_aicore.h: store + line writeback
+ *   }
+ *
+ * The orchestrator reads the mailbox with pto2_rt_read_scalar(), which
+ * spins on the flag word — the value is observable the moment the line
+ * reaches memory, long before task completion is processed. Exactly one
+ * kernel instance must publish: for MIX or multi-block tasks, gate the
+ * publish on one subtask slot / block_idx 0, or opt in only single-core,
+ * single-block submits. Publishing is mandatory for opted-in tasks — a
+ * reader spins until the flag arrives (or times out fatally).
+ */
+static __aicore__ inline uint64_t get_scalar_mailbox(__gm__ int64_t *args) {
+    __gm__ LocalContext *ctx =
+        reinterpret_cast<__gm__ LocalContext *>(static_cast<uint64_t>(args[SPMD_LOCAL_CONTEXT_INDEX]));
+    return ctx->scalar_mailbox;
+}
+
+// =============================================================================
+// Device-side child enqueue (restricted dynamic parallelism)
+// =============================================================================
+
+/** Max outstanding device-enqueued children per core (power of two). */
+static constexpr int32_t PTO2_DEVICE_ENQUEUE_DEPTH = 16;
+
+/** Max scalar arguments per device-enqueued child (fills one 64B entry). */
+static constexpr int32_t PTO2_DEVICE_ENQUEUE_MAX_SCALARS = 7;
+
+/**
+ * One device-enqueued child request: the handle of a pre-registered child
+ * callable (pto2_rt_register_child) plus its scalar arguments.  Exactly one
+ * cache line, so the producing kernel publishes it with a single writeback.
+ */
+struct alignas(64) PTO2DeviceEnqueueEntry {
+    int32_t child_handle;
+    int32_t scalar_count;
+    uint64_t scalars[PTO2_DEVICE_ENQUEUE_MAX_SCALARS];
+};
+static_assert(sizeof(PTO2DeviceEnqueueEntry) == 64, "device-enqueue entry must fill one cache line");
+
+/**
+ * Per-core SPSC ring for device-side child enqueue.
+ *
+ * Producer is whichever kernel is running on the core (kernels on one core
+ * execute serially, so there is never more than one producer at a time);
+ * consumer is the orchestration thread via pto2_rt_serve_children().  The
+ * cursors are monotonic counters on private cache lines: the core writes
+ * only `tail` (plus entry lines), the AICPU writes only `head`, so neither
+ * side's line writeback can clobber the other's cursor.
+ */
+struct alignas(64) PTO2DeviceEnqueueRing {
+    volatile uint64_t tail;  // total entries pushed (AICore-written)
+    uint8_t tail_pad[56];
+    volatile uint64_t head;  // total entries served (AICPU-written)
+    uint8_t head_pad[56];
+    PTO2DeviceEnqueueEntry entries[PTO2_DEVICE_ENQUEUE_DEPTH];
+};
+static_assert(
+    sizeof(PTO2DeviceEnqueueRing) == 128 + PTO2_DEVICE_ENQUEUE_DEPTH * 64, "enqueue ring layout drifted"
+);
+
+/**
+ * Return the GM address of this core's device-enqueue ring, or 0.
+ *
+ * Non-zero only when the orchestration registered at least one child
+ * callable via pto2_rt_register_child() before this dispatch.  Kernels
+ * push child requests with aicore_child_enqueue()
+ * (aicore/device_enqueue_aicore.h), which handles the cache maintenance
+ * and degrades to a refusal — never a stall — when the ring is full.
+ */
+static __aicore__ inline uint64_t get_device_enqueue_ring(__gm__ int64_t *args) {
+    return static_cast<uint64_t>(args[SPMD_DEVICE_ENQUEUE_INDEX]);
+}
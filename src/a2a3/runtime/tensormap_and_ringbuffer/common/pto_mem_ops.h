@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file pto_mem_ops.h
+ * @brief Bulk memory helpers for runtime-internal init and reset paths
+ *
+ * libc memset/memcpy are tuned for the general case: they re-derive
+ * alignment on every call and store through the cache. Runtime init paths
+ * know more — the shared-memory arena, tensormap entry pools, and per-core
+ * payload slots are at least 64-byte aligned, written once, and not read
+ * back until much later — so pulling megabytes of zeroes through the cache
+ * only evicts the working set the orchestrator and scheduler threads are
+ * about to touch. These helpers make that knowledge explicit:
+ *
+ *   pto2_mem_zero / pto2_mem_copy       cached NEON stores for blocks the
+ *                                       writer re-touches soon (reset of
+ *                                       per-core state between runs)
+ *   pto2_mem_zero_nt / pto2_mem_copy_nt non-temporal cache-line stores
+ *                                       (stnp) for one-shot init of data
+ *                                       nobody reads back promptly; the
+ *                                       destination must be 64-byte aligned
+ *
+ * Sub-block tails fall back to libc, so any size is accepted. The _nt
+ * variants end with `dmb ishst` so the streamed stores are ordered before
+ * any subsequent flag publication — the same contract publish_payload_line
+ * in aicpu_executor.cpp relies on. On non-aarch64 builds every helper is
+ * plain libc.
+ *
+ * Host, AICPU, and orchestration TUs only: AICore kernels compile under
+ * CCEC, which has no <arm_neon.h>.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/** Zero `size` bytes through the cache. `dst` should be 16-byte aligned. */
+static inline void pto2_mem_zero(void *dst, size_t size) {
+#if defined(__aarch64__)
+    uint8_t *p = reinterpret_cast<uint8_t *>(dst);
+    uint8x16_t zero = vdupq_n_u8(0);
+    while (size >= 64) {
+        vst1q_u8(p, zero);
+        vst1q_u8(p + 16, zero);
+        vst1q_u8(p + 32, zero);
+        vst1q_u8(p + 48, zero);
+        p += 64;
+        size -= 64;
+    }
+    while (size >= 16) {
+        vst1q_u8(p, zero);
+        p += 16;
+        size -= 16;
+    }
+    if (size > 0) {
+        memset(p, 0, size);
+    }
+#else
+    memset(dst, 0, size);
+#endif
+}
+
+/** Copy `size` bytes through the cache. Both pointers should be 16-byte
+ *  aligned; the regions must not overlap. */
+static inline void pto2_mem_copy(void *dst, const void *src, size_t size) {
+#if defined(__aarch64__)
+    uint8_t *d = reinterpret_cast<uint8_t *>(dst);
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(src);
+    while (size >= 64) {
+        uint8x16_t b0 = vld1q_u8(s);
+        uint8x16_t b1 = vld1q_u8(s + 16);
+        uint8x16_t b2 = vld1q_u8(s + 32);
+        uint8x16_t b3 = vld1q_u8(s + 48);
+        vst1q_u8(d, b0);
+        vst1q_u8(d + 16, b1);
+        vst1q_u8(d + 32, b2);
+        vst1q_u8(d + 48, b3);
+        d += 64;
+        s += 64;
+        size -= 64;
+    }
+    while (size >= 16) {
+        vst1q_u8(d, vld1q_u8(s));
+        d += 16;
+        s += 16;
+        size -= 16;
+    }
+    if (size > 0) {
+        memcpy(d, s, size);
+    }
+#else
+    memcpy(dst, src, size);
+#endif
+}
+
+/** Zero `size` bytes with non-temporal stores, bypassing cache allocation.
+ *  `dst` must be 64-byte aligned. Use for one-shot init of regions nobody
+ *  reads back promptly (arena zeroing, entry-pool init). */
+static inline void pto2_mem_zero_nt(void *dst, size_t size) {
+#if defined(__aarch64__)
+    uint8_t *p = reinterpret_cast<uint8_t *>(dst);
+    uint8x16_t zero = vdupq_n_u8(0);
+    while (size >= 64) {
+        __asm__ volatile(
+            "stnp %q[z], %q[z], [%[p]]\n\t"
+            "stnp %q[z], %q[z], [%[p], #32]"
+            :
+            : [z] "w"(zero), [p] "r"(p)
+            : "memory"
+        );
+        p += 64;
+        size -= 64;
+    }
+    if (size > 0) {
+        memset(p, 0, size);
+    }
+    // Order the streamed stores before any subsequent flag publication.
+    __asm__ volatile("dmb ishst" ::: "memory");
+#else
+    memset(dst, 0, size);
+#endif
+}
+
+/** Copy `size` bytes with non-temporal stores on the destination side.
+ *  `dst` must be 64-byte aligned; the regions must not overlap. */
+static inline void pto2_mem_copy_nt(void *dst, const void *src, size_t size) {
+#if defined(__aarch64__)
+    uint8_t *d = reinterpret_cast<uint8_t *>(dst);
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(src);
+    while (size >= 64) {
+        __asm__ volatile(
+            "ldp q0, q1, [%[s]]\n\t"
+            "ldp q2, q3, [%[s], #32]\n\t"
+            "stnp q0, q1, [%[d]]\n\t"
+            "stnp q2, q3, [%[d], #32]"
+            :
+            : [d] "r"(d), [s] "r"(s)
+            : "v0", "v1", "v2", "v3", "memory"
+        );
+        d += 64;
+        s += 64;
+        size -= 64;
+    }
+    if (size > 0) {
+        memcpy(d, s, size);
+    }
+    __asm__ volatile("dmb ishst" ::: "memory");
+#else
+    memcpy(dst, src, size);
+#endif
+}
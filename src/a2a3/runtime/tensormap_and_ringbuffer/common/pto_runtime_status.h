@@ -19,6 +19,9 @@
 #define SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_COMMON_PTO_RUNTIME_STATUS_H_
 
 #include <stdint.h>
+#include <stdio.h>
+
+#include <atomic>
 
 // Orchestrator errors (1-99): detected in orchestrator thread
 #define PTO2_ERROR_NONE 0  // Explicitly means "no error"; it is not an "unknown/unspecified" error code.
@@ -31,6 +34,7 @@
 #define PTO2_ERROR_REQUIRE_SYNC_START_INVALID 7
 #define PTO2_ERROR_TENSOR_WAIT_TIMEOUT 8
 #define PTO2_ERROR_EXPLICIT_ORCH_FATAL 9
+#define PTO2_ERROR_MIX_NOT_SUPPORTED 10  // Mixed (full-cluster) task submitted to a PTO2_ENABLE_MIX=0 build
 
 // Scheduler errors (100+): detected in scheduler threads
 #define PTO2_ERROR_SCHEDULER_TIMEOUT 100
@@ -45,4 +49,88 @@ static inline int32_t pto2_runtime_status_from_error_codes(int32_t orch_error_co
     return 0;
 }
 
+// =============================================================================
+// Two-tier status reporting
+// =============================================================================
+//
+// Tier 1: plain codes. Conditions callers only branch on — would-block,
+// transient contention — occur thousands of times per submit burst under
+// back-pressure and must cost nothing to construct. The existing boolean
+// probes (pto2_submit_would_block, try_submit) embody OK/WOULD_BLOCK;
+// status-returning entry points use PTO2Status so the recoverable codes
+// stay distinguishable from fatal ones without any message.
+enum class PTO2Status : int32_t {
+    OK = 0,
+    WOULD_BLOCK = 1,  // resource momentarily unavailable; drain and retry
+    RETRY = 2,        // transient contention; retry immediately
+    FATAL = 3,        // unrecoverable; PTO2_ERROR_* code latched on the orchestrator
+};
+
+static inline bool pto2_status_is_recoverable(PTO2Status s) {
+    return s == PTO2Status::WOULD_BLOCK || s == PTO2Status::RETRY;
+}
+
+// Tier 2: lazy details. A producer that has context worth reporting latches
+// a static format string plus up to three raw integer operands into a slot
+// of a small process-global ring — a handful of stores, no formatting — and
+// hands back a one-word handle. pto2_status_detail_format() materializes
+// the message only when a caller actually reports it (fatal paths, logs).
+// Slots recycle, so a handle held across PTO2_STATUS_DETAIL_SLOTS further
+// latches may describe a newer condition; acceptable for diagnostics that
+// are read promptly on the cold path. Handles are local to the .so that
+// latched them.
+
+#define PTO2_STATUS_DETAIL_SLOTS 64  // power of two
+#define PTO2_STATUS_DETAIL_MAX_ARGS 3
+
+struct PTO2StatusDetail {
+    const char *func;  // producer name (static literal)
+    const char *fmt;   // static literal; conversions must all be %lld, at most 3
+    int64_t args[PTO2_STATUS_DETAIL_MAX_ARGS];
+};
+
+static inline PTO2StatusDetail *pto2_status_detail_pool() {
+    static PTO2StatusDetail pool[PTO2_STATUS_DETAIL_SLOTS];
+    return pool;
+}
+
+/// Latch a detail record; returns a nonzero handle. `fmt` must be a static
+/// literal whose conversions are all %lld (up to three). Wait-free: a
+/// relaxed cursor claims a ring slot, overwriting the oldest record.
+static inline int32_t pto2_status_detail_latch(const char *func, const char *fmt, int64_t a0 = 0, int64_t a1 = 0,
+                                               int64_t a2 = 0) {
+    static std::atomic<uint32_t> cursor{0};
+    uint32_t slot = cursor.fetch_add(1, std::memory_order_relaxed) & (PTO2_STATUS_DETAIL_SLOTS - 1);
+    PTO2StatusDetail &d = pto2_status_detail_pool()[slot];
+    d.func = func;
+    d.fmt = fmt;
+    d.args[0] = a0;
+    d.args[1] = a1;
+    d.args[2] = a2;
+    return static_cast<int32_t>(slot) + 1;  // 0 stays "no detail"
+}
+
+/// Materialize the message for `handle` into `buf`. Returns the snprintf
+/// result, or 0 (empty string written) for the no-detail handle.
+static inline int pto2_status_detail_format(int32_t handle, char *buf, size_t len) {
+    if (handle <= 0 || handle > PTO2_STATUS_DETAIL_SLOTS || len == 0) {
+        if (len > 0) buf[0] = '\0';
+        return 0;
+    }
+    const PTO2StatusDetail &d = pto2_status_detail_pool()[handle - 1];
+    if (d.fmt == nullptr) {
+        buf[0] = '\0';
+        return 0;
+    }
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wformat-nonliteral"
+#endif
+    int n = snprintf(buf, len, d.fmt, (long long)d.args[0], (long long)d.args[1], (long long)d.args[2]);
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+    return n;
+}
+
 #endif  // SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_COMMON_PTO_RUNTIME_STATUS_H_
@@ -41,6 +41,7 @@
 #include "callable.h"
 #include "common/platform_config.h"
 #include "common/unified_log.h"
+#include "pto_runtime_c_api.h"
 
 // Helper: return current time in milliseconds
 static int64_t _now_ms() {
@@ -91,15 +92,73 @@ static int32_t pto2_read_runtime_status(Runtime *runtime, PTO2SharedMemoryHeader
     return pto2_runtime_status_from_error_codes(orch_error_code, sched_error_code);
 }
 
+/**
+ * Snapshot the scheduler's always-on health block (see PTO2HealthMetrics in
+ * pto_shared_memory.h) through a caller-supplied device-copy transport.
+ *
+ * Called from the platform C API's health_metrics_get_ctx, typically on a
+ * monitoring thread while the run thread is blocked in run_runtime — hence
+ * the explicit copy callback instead of Runtime::host_api, whose wrappers
+ * resolve the DeviceRunner through the run thread's TLS binding.
+ *
+ * Seqlock read: retry while the publisher's generation counter is odd or
+ * changed across the block copy, bounded so a stalled device (heartbeat
+ * frozen mid-publish) degrades to an error instead of a spin.
+ */
+extern "C" int
+read_health_metrics_impl(Runtime *runtime, PtoHealthCopyFn copy_fn, void *copy_ctx, PtoHealthMetrics *out) {
+    if (runtime == nullptr || copy_fn == nullptr || out == nullptr) {
+        return -1;
+    }
+    void *pto2_sm = runtime->get_pto2_gm_sm_ptr();
+    if (pto2_sm == nullptr) {
+        return -1;
+    }
+    const char *health_dev = static_cast<const char *>(pto2_sm) + offsetof(PTO2SharedMemoryHeader, health);
+
+    PTO2HealthMetrics snap;
+    for (int attempt = 0; attempt < 4; attempt++) {
+        if (copy_fn(copy_ctx, &snap, health_dev, sizeof(snap)) != 0) {
+            return -1;
+        }
+        uint32_t seq = snap.seq.load(std::memory_order_relaxed);
+        if (seq & 1u) {
+            continue;  // Publish in progress — retry
+        }
+        uint32_t seq_after = 0;
+        if (copy_fn(copy_ctx, &seq_after, health_dev + offsetof(PTO2HealthMetrics, seq), sizeof(seq_after)) != 0) {
+            return -1;
+        }
+        if (seq_after != seq) {
+            continue;  // Publish landed mid-copy — retry
+        }
+        out->publish_count = snap.publish_count;
+        out->alloc_stall_samples = snap.alloc_stall_samples;
+        out->publish_sys_cnt = snap.publish_sys_cnt;
+        out->sys_cnt_freq_hz = snap.sys_cnt_freq_hz;
+        out->tasks_completed = snap.tasks_completed;
+        out->tasks_per_sec = snap.tasks_per_sec;
+        out->dispatch_latency_ewma_ticks = snap.dispatch_latency_ewma;
+        out->ring_tasks_live = snap.ring_tasks_live;
+        out->heap_bytes_live = snap.heap_bytes_live;
+        out->orch_error_code = snap.orch_error_code;
+        out->sched_error_code = snap.sched_error_code;
+        return 0;
+    }
+    return -1;
+}
+
 /**
  * Initialize a pre-allocated runtime for device orchestration.
  *
  * For rt2 runtime, orchestration runs on AICPU thread 3 (device-side).
  * This function:
  * - Copies tensor metadata and replaces host pointers with device pointers
- * - Copies all tensor data to device
+ * - Streams tensor data to the device, overlapped with later construction
  * - Records all tensors for copy-back
- * - Copies orchestration SO to device memory
+ * - Streams the orchestration SO to device memory
+ * - Fences all queued uploads before returning (the AICPU launches only
+ *   after init returns, so the fence is the commit point)
  * - Sets up runtime state for device orchestration
  *
  * @param runtime   Pointer to pre-constructed Runtime
@@ -175,9 +234,13 @@ extern "C" int init_runtime_impl(Runtime *runtime, const ChipCallable *callable,
             return -1;
         }
 
-        int rc = runtime->host_api.copy_to_device(dev_ptr, host_ptr, size);
+        // Queue the upload; construction of the remaining sections overlaps
+        // with the DMA. Everything queued here is fenced by the copy_sync()
+        // commit point before the AICPU can observe the runtime.
+        int rc = runtime->host_api.copy_to_device_async(dev_ptr, host_ptr, size);
         if (rc != 0) {
             LOG_ERROR("Failed to copy tensor %d to device", i);
+            runtime->host_api.copy_sync();
             runtime->host_api.device_free(dev_ptr);
             return -1;
         }
@@ -197,11 +260,13 @@ extern "C" int init_runtime_impl(Runtime *runtime, const ChipCallable *callable,
     void *dev_so = runtime->host_api.device_malloc(orch_so_size);
     if (dev_so == nullptr) {
         LOG_ERROR("Failed to allocate device memory for orchestration SO");
+        runtime->host_api.copy_sync();
         return -1;
     }
-    int rc = runtime->host_api.copy_to_device(dev_so, orch_so_binary, orch_so_size);
+    int rc = runtime->host_api.copy_to_device_async(dev_so, orch_so_binary, orch_so_size);
     if (rc != 0) {
         LOG_ERROR("Failed to copy orchestration SO to device");
+        runtime->host_api.copy_sync();
         runtime->host_api.device_free(dev_so);
         return -1;
     }
@@ -256,6 +321,28 @@ extern "C" int init_runtime_impl(Runtime *runtime, const ChipCallable *callable,
         }
     }
 
+    // Read spin/notify tuning overrides from environment (0 = compile-time
+    // default). Copied into the shared-memory header on the AICPU before the
+    // orchestrator and scheduler initialize, so a parameter sweep needs no
+    // runtime rebuild.
+    {
+        PTO2RuntimeParams &p = runtime->pto2_params;
+        p.block_notify_interval = static_cast<uint32_t>(parse_env_uint64("PTO2_TUNE_BLOCK_NOTIFY_INTERVAL", 1, false));
+        p.alloc_spin_limit = static_cast<uint32_t>(parse_env_uint64("PTO2_TUNE_ALLOC_SPIN_LIMIT", 1, false));
+        p.alloc_tight_spin = static_cast<uint32_t>(parse_env_uint64("PTO2_TUNE_ALLOC_TIGHT_SPIN", 1, false));
+        p.alloc_backoff_max = static_cast<uint32_t>(parse_env_uint64("PTO2_TUNE_ALLOC_BACKOFF_MAX", 1, false));
+        p.alloc_spill_spin = static_cast<uint32_t>(parse_env_uint64("PTO2_TUNE_ALLOC_SPILL_SPIN", 1, false));
+        p.dep_pool_spin_limit = static_cast<uint32_t>(parse_env_uint64("PTO2_TUNE_DEP_POOL_SPIN_LIMIT", 1, false));
+        if (p.block_notify_interval || p.alloc_spin_limit || p.alloc_tight_spin || p.alloc_backoff_max ||
+            p.alloc_spill_spin || p.dep_pool_spin_limit) {
+            LOG_INFO(
+                "Tuning overrides: notify=%u alloc_spin=%u tight_spin=%u backoff_max=%u spill_spin=%u dep_spin=%u",
+                p.block_notify_interval, p.alloc_spin_limit, p.alloc_tight_spin, p.alloc_backoff_max,
+                p.alloc_spill_spin, p.dep_pool_spin_limit
+            );
+        }
+    }
+
     // Resolve effective sizes (env override or compile-time default)
     uint64_t eff_heap_size = runtime->pto2_heap_size ? runtime->pto2_heap_size : PTO2_HEAP_SIZE;
     uint64_t eff_task_window_size =
@@ -268,6 +355,7 @@ extern "C" int init_runtime_impl(Runtime *runtime, const ChipCallable *callable,
     int64_t t_heap_end = _now_ms();
     if (gm_heap == nullptr) {
         LOG_ERROR("Failed to allocate GM heap");
+        runtime->host_api.copy_sync();
         return -1;
     }
     runtime->record_tensor_pair(nullptr, gm_heap, total_heap_size);
@@ -280,6 +368,7 @@ extern "C" int init_runtime_impl(Runtime *runtime, const ChipCallable *callable,
     int64_t t_sm_end = _now_ms();
     if (sm_ptr == nullptr) {
         LOG_ERROR("Failed to allocate PTO2 shared memory");
+        runtime->host_api.copy_sync();
         return -1;
     }
     runtime->set_pto2_gm_sm_ptr(sm_ptr);
@@ -289,11 +378,23 @@ extern "C" int init_runtime_impl(Runtime *runtime, const ChipCallable *callable,
     runtime->set_orch_built_on_host(false);
     runtime->set_orch_args(device_args);
 
+    // Commit point: fence all queued uploads before returning. The AICPU is
+    // only launched after this function returns, so nothing on the device can
+    // observe a partially uploaded tensor or SO image.
+    int64_t t_sync_start = _now_ms();
+    rc = runtime->host_api.copy_sync();
+    int64_t t_sync_end = _now_ms();
+    if (rc != 0) {
+        LOG_ERROR("Failed to synchronize queued device uploads");
+        return -1;
+    }
+
     LOG_INFO("Device orchestration ready: %d tensors + %d scalars", tensor_count, scalar_count);
 
     int64_t t_total_end = _now_ms();
     LOG_INFO("TIMING: args_malloc_copy = %" PRId64 "ms", t_args_end - t_args_start);
     LOG_INFO("TIMING: orch_so_copy = %" PRId64 "ms", t_so_end - t_so_start);
+    LOG_INFO("TIMING: upload_sync = %" PRId64 "ms", t_sync_end - t_sync_start);
     LOG_INFO("TIMING: gm_heap_alloc(1GB) = %" PRId64 "ms", t_heap_end - t_heap_start);
     LOG_INFO("TIMING: shared_mem_alloc = %" PRId64 "ms", t_sm_end - t_sm_start);
     LOG_INFO("TIMING: total_init_runtime_impl = %" PRId64 "ms", t_total_end - t_total_start);
@@ -136,6 +136,35 @@ typedef struct PTO2RuntimeOps {
         PTO2Runtime *rt, const Tensor &tensor, uint32_t ndims, const uint32_t indices[], uint64_t value
     );
     TaskOutputTensors (*alloc_tensors)(PTO2Runtime *rt, const Arg &args);
+
+    // Batch submission (appended to preserve hot-path field offsets)
+    void (*submit_task_batch)(PTO2Runtime *rt, const PTO2TaskBatchEntry entries[], int32_t count);
+
+    // Tensor interning (appended to preserve hot-path field offsets)
+    int32_t (*intern_tensor)(PTO2Runtime *rt, const Tensor &tensor);
+    const Tensor *(*interned_tensor)(PTO2Runtime *rt, int32_t handle);
+
+    // Runtime profiling gate (appended to preserve hot-path field offsets)
+    void (*profiling_set_enabled)(PTO2Runtime *rt, bool enabled);
+
+    // Per-slice tensor versioning (appended to preserve hot-path field offsets)
+    int32_t (*bump_tensor_version)(PTO2Runtime *rt, int32_t handle);
+
+    // Cooperative back-pressure (appended to preserve hot-path field offsets)
+    bool (*submit_would_block)(PTO2Runtime *rt, const Arg &args);
+    bool (*try_submit_task)(
+        PTO2Runtime *rt, const MixedKernels &mixed_kernels, const Arg &args, TaskOutputTensors *outputs
+    );
+
+    // Non-blocking tensor readiness probe (appended to preserve hot-path field offsets)
+    bool (*tensor_data_ready)(PTO2Runtime *rt, const Tensor &tensor);
+
+    // Scalar mailbox fast read (appended to preserve hot-path field offsets)
+    uint64_t (*read_scalar)(PTO2Runtime *rt, const Tensor &result_tensor);
+
+    // Device-side child enqueue (appended to preserve hot-path field offsets)
+    int32_t (*register_child)(PTO2Runtime *rt, const MixedKernels &mixed_kernels);
+    int32_t (*serve_children)(PTO2Runtime *rt, int32_t max_tasks);
 } PTO2RuntimeOps;
 
 /**
@@ -213,6 +242,60 @@ static inline TaskOutputTensors pto2_rt_submit_task(const MixedKernels &mixed_ke
     return rt->ops->submit_task(rt, mixed_kernels, args);
 }
 
+/**
+ * Cheap back-pressure probe: would pto2_rt_submit_task(.., args) have to
+ * spin for a task slot or output buffer right now?
+ *
+ * False guarantees an immediately following submit of the same args
+ * commits without stalling; true is a hint to submit a ready-independent
+ * branch first and come back. Orchestration code with reorderable
+ * branches can use this to turn alloc back-pressure into useful work
+ * instead of a spin-wait.
+ */
+static inline bool pto2_rt_submit_would_block(const Arg &args) {
+    PTO2Runtime *rt = pto2_current_runtime();
+    if (rt->ops->is_fatal(rt)) {
+        return false;
+    }
+    return rt->ops->submit_would_block(rt, args);
+}
+
+/**
+ * Non-spinning submit: returns false (without submitting or touching
+ * outputs) when the submit would have to wait for ring resources;
+ * otherwise behaves exactly like pto2_rt_submit_task and returns true.
+ *
+ *   if (!pto2_rt_try_submit_task(mk, args, &out)) {
+ *       submit_other_branch();          // useful work instead of spinning
+ *       out = pto2_rt_submit_task(mk, args);  // eventually block if needed
+ *   }
+ */
+static inline bool pto2_rt_try_submit_task(const MixedKernels &mixed_kernels, const Arg &args, TaskOutputTensors *outputs) {
+    PTO2Runtime *rt = pto2_current_runtime();
+    if (rt->ops->is_fatal(rt)) {
+        *outputs = TaskOutputTensors{};
+        return true;
+    }
+    return rt->ops->try_submit_task(rt, mixed_kernels, args, outputs);
+}
+
+/**
+ * Submit a batch of tasks with one shared-memory publication.
+ *
+ * Per-entry semantics match pto2_rt_submit_task; the runtime publishes
+ * current_task_index once at the end of the batch instead of per task,
+ * amortizing the publish/fence cost for runs of small tasks.  Each
+ * entry's materialized outputs are stored via its `outputs` pointer
+ * (when non-null).
+ */
+static inline void pto2_rt_submit_task_batch(const PTO2TaskBatchEntry entries[], int32_t count) {
+    PTO2Runtime *rt = pto2_current_runtime();
+    if (rt->ops->is_fatal(rt)) {
+        return;
+    }
+    rt->ops->submit_task_batch(rt, entries, count);
+}
+
 /**
  * Convenience wrapper: submit an AIC-only task.
  */
@@ -239,6 +322,67 @@ static inline TaskOutputTensors pto2_rt_submit_aiv_task(int32_t kernel_id, const
     return rt->ops->submit_task(rt, mk, args);
 }
 
+/**
+ * Register a tensor view once and get a small integer handle.
+ *
+ * The runtime copies the view into a stable intern table and precomputes
+ * its TensorMap hash/range metadata, so submits that reference the interned
+ * view (via pto2_rt_interned_tensor) skip the per-submit derivation.
+ * Intended for views reused across many submits:
+ *
+ *   int32_t h = pto2_rt_intern_tensor(kv_view);       // once
+ *   ...
+ *   args.add_input(*pto2_rt_interned_tensor(h));      // every submit
+ *
+ * @return Handle (>= 0), or -1 on failure (marks the runtime fatal)
+ */
+static inline int32_t pto2_rt_intern_tensor(const Tensor &tensor) {
+    PTO2Runtime *rt = pto2_current_runtime();
+    if (rt->ops->is_fatal(rt)) {
+        return -1;
+    }
+    return rt->ops->intern_tensor(rt, tensor);
+}
+
+/**
+ * Resolve an interned handle to its stable Tensor.
+ *
+ * The returned pointer stays valid for the lifetime of the runtime, so it
+ * can be stored and passed to Arg::add_input/add_inout directly.
+ *
+ * @return Interned view, or nullptr for an invalid handle (marks fatal)
+ */
+static inline const Tensor *pto2_rt_interned_tensor(int32_t handle) {
+    PTO2Runtime *rt = pto2_current_runtime();
+    if (rt->ops->is_fatal(rt)) {
+        return nullptr;
+    }
+    return rt->ops->interned_tensor(rt, handle);
+}
+
+/**
+ * Advance the version of a registered view, starting a new in-place update
+ * of that slice.
+ *
+ * Versions are tracked per registered view, not per base pointer, so
+ * in-place writers to disjoint slices of one tensor do not serialize:
+ * register one view per independently-updated slice (e.g. one per KV head)
+ * and bump only the slice being written. The interned views then carry a
+ * version vector over the base tensor.
+ *
+ *   pto2_rt_bump_tensor_version(h_head0);                // new write epoch
+ *   args.add_inout(*pto2_rt_interned_tensor(h_head0));   // submit against it
+ *
+ * @return New version (> 0), or -1 for an invalid handle (marks fatal)
+ */
+static inline int32_t pto2_rt_bump_tensor_version(int32_t handle) {
+    PTO2Runtime *rt = pto2_current_runtime();
+    if (rt->ops->is_fatal(rt)) {
+        return -1;
+    }
+    return rt->ops->bump_tensor_version(rt, handle);
+}
+
 static inline void pto2_rt_scope_begin() {
     PTO2Runtime *rt = pto2_current_runtime();
     if (rt->ops->is_fatal(rt)) {
@@ -255,6 +399,34 @@ static inline void pto2_rt_scope_end() {
     rt->ops->scope_end(rt);
 }
 
+/**
+ * Pause profiling collection from orchestration code.
+ *
+ * Profiling must still be compiled in (PTO2_PROFILING) and the run launched
+ * with profiling enabled; this only gates data collection at runtime. Call
+ * at a scope boundary so records for in-flight tasks are not cut mid-task.
+ * Typical use — profile only one iteration of a long run at full detail:
+ *
+ *   pto2_rt_profiling_pause();        // before the warm-up loop
+ *   ...
+ *   if (iter == 100) pto2_rt_profiling_resume();
+ *   run_iteration(iter);
+ *   if (iter == 100) pto2_rt_profiling_pause();
+ *
+ * Scheduler threads observe the toggle within one scheduling loop
+ * iteration; the orchestrator's own phase records follow it per submit.
+ */
+static inline void pto2_rt_profiling_pause() {
+    PTO2Runtime *rt = pto2_current_runtime();
+    rt->ops->profiling_set_enabled(rt, false);
+}
+
+/** Re-enable profiling collection after pto2_rt_profiling_pause(). */
+static inline void pto2_rt_profiling_resume() {
+    PTO2Runtime *rt = pto2_current_runtime();
+    rt->ops->profiling_set_enabled(rt, true);
+}
+
 static inline void pto2_rt_orchestration_done() {
     PTO2Runtime *rt = pto2_current_runtime();
     rt->ops->orchestration_done(rt);
@@ -285,6 +457,27 @@ static inline bool pto2_rt_is_fatal() {
 // Cross-Layer Data Access
 // =============================================================================
 
+/**
+ * Non-blocking readiness probe for cross-layer reads.
+ *
+ * True when every producer of `tensor` has completed, i.e. an immediately
+ * following get_tensor_data returns without spinning.  Orchestration code
+ * with reorderable branches can poll this instead of blocking in
+ * get_tensor_data, submitting ready-independent work while a result is
+ * still in flight (see pto_orchestration_async.h for the packaged pattern).
+ *
+ * Also true for unallocated tensors (addr == 0) and on a fatal runtime:
+ * in both cases get_tensor_data fails or returns immediately rather than
+ * waiting, so callers parked on this probe must not be deferred forever.
+ */
+static inline bool pto2_rt_tensor_data_ready(const Tensor &tensor) {
+    PTO2Runtime *rt = pto2_current_runtime();
+    if (rt->ops->is_fatal(rt)) {
+        return true;
+    }
+    return rt->ops->tensor_data_ready(rt, tensor);
+}
+
 /**
  * Read a value from a tensor at the given multi-dimensional indices.
  *
@@ -307,6 +500,95 @@ static inline T get_tensor_data(const Tensor &tensor, uint32_t ndims, const uint
     return from_u64<T>(rt->ops->get_tensor_data(rt, tensor, ndims, indices));
 }
 
+/**
+ * Scalar result fast read: return the 8-byte value the producing kernel
+ * published to its per-task mailbox.
+ *
+ * For tasks submitted with PTO2LaunchSpec::set_scalar_result(), the kernel
+ * publishes an N-byte result to a dedicated mailbox line mid-execution
+ * (see get_scalar_mailbox() in intrinsic.h). This read spins only on that
+ * line, so a data-dependent decision (dynamic sequence length, top-k size)
+ * costs one cacheline transfer instead of the full completion round-trip
+ * that get_tensor_data on a result tensor pays.
+ *
+ * `result_tensor` identifies the producing task — pass any output of the
+ * submit whose kernel publishes (typically the task's result tensor). The
+ * mailbox is valid while the task's window slot is live, same lifetime as
+ * the task's other shared-memory state.
+ *
+ * Blocks until the kernel publishes; times out fatally (like
+ * get_tensor_data) if an opted-in kernel never does. Default T = uint64_t
+ * returns raw bits; specify T for typed results:
+ *
+ *   int32_t n = pto2_rt_read_scalar<int32_t>(outs.tensors[0]);
+ */
+template <typename T = uint64_t>
+static inline T pto2_rt_read_scalar(const Tensor &result_tensor) {
+    PTO2Runtime *rt = pto2_current_runtime();
+    if (rt->ops->is_fatal(rt)) {
+        return from_u64<T>(0);
+    }
+    return from_u64<T>(rt->ops->read_scalar(rt, result_tensor));
+}
+
+/**
+ * Register a child callable kernels on-device may enqueue mid-execution.
+ *
+ * Device-side dynamic parallelism, restricted: a kernel that discovers
+ * parallelizable work (sparse blocks, variable-length segments) pushes
+ * {handle, scalars} into its core's enqueue ring with
+ * aicore_child_enqueue() (aicore/device_enqueue_aicore.h) instead of
+ * finishing, reporting back, and waiting for new submissions.  The
+ * orchestration thread turns those requests into ordinary submits via
+ * pto2_rt_serve_children().
+ *
+ * Children carry up to PTO2_DEVICE_ENQUEUE_MAX_SCALARS scalar arguments
+ * and nothing else — pass GM addresses as scalars for bulk data; the
+ * parent's live tensors remain valid until the parent completes.  Fanout
+ * is bounded by PTO2_DEVICE_ENQUEUE_DEPTH outstanding requests per core;
+ * a full ring refuses the push and the kernel handles the work inline.
+ *
+ * Registration arms the per-core rings: dispatches before the first
+ * register stage a 0 ring address, so kernels built with an enqueue path
+ * degrade cleanly when the feature is unused.
+ *
+ * @return Child handle (>= 0) for kernels to enqueue with, or -1 on a
+ *         full table / no valid kernel ID (marks the runtime fatal)
+ */
+static inline int32_t pto2_rt_register_child(const MixedKernels &mixed_kernels) {
+    PTO2Runtime *rt = pto2_current_runtime();
+    if (rt->ops->is_fatal(rt)) {
+        return -1;
+    }
+    return rt->ops->register_child(rt, mixed_kernels);
+}
+
+/**
+ * Drain the device-enqueue rings: submit up to max_tasks pending child
+ * requests through the normal submit path and return how many were served.
+ *
+ * Non-blocking with respect to kernels (it only consumes what is already
+ * published) but each child submit may block under heap-ring back-pressure
+ * like any other submit.  Call it from the orchestration loop wherever the
+ * thread would otherwise idle — between submit batches, or interleaved
+ * with pto2_rt_tensor_data_ready() polls while waiting on a result:
+ *
+ *   while (!pto2_rt_tensor_data_ready(t)) {
+ *       pto2_rt_serve_children(8);
+ *   }
+ *
+ * Serving order is per-core FIFO but unordered across cores; children of
+ * one parent must be independent of each other.  Dependencies on the
+ * children's outputs flow through the TensorMap as usual once submitted.
+ */
+static inline int32_t pto2_rt_serve_children(int32_t max_tasks = PTO2_DEVICE_ENQUEUE_DEPTH) {
+    PTO2Runtime *rt = pto2_current_runtime();
+    if (rt->ops->is_fatal(rt)) {
+        return 0;
+    }
+    return rt->ops->serve_children(rt, max_tasks);
+}
+
 /**
  * Write a value to a tensor at the given multi-dimensional indices.
  *
@@ -396,6 +678,7 @@ private:
 #define PTO2_ORCHESTRATION_CONFIG_DEFINED
 struct PTO2OrchestrationConfig {
     int expected_arg_count;
+    int enable_chain_fusion;  /**< Nonzero: fuse single-consumer chains onto one core at dispatch */
 };
 #endif
 
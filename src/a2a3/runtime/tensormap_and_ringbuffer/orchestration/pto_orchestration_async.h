@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * PTO Orchestration Async — parked continuations over pto_orchestration_api.h
+ *
+ * Data-dependent orchestration (read back an intermediate result to shape
+ * the next submits) serializes in get_tensor_data: the orchestration thread
+ * spins until the producer completes while ready-independent branches sit
+ * unsubmitted.  This header packages the overlap pattern without hand-rolled
+ * state machines: park the code that needs a result as a continuation keyed
+ * on the result tensor, keep submitting independent branches, and run parked
+ * continuations as their tensors become readable — all multiplexed on the
+ * single orchestration thread, so continuations need no synchronization.
+ *
+ * The orchestration .so is built as C++17 on every platform (aarch64 g++
+ * for device, host g++ for simulation), so a C++20 coroutine layer
+ * (co_await on task handles) is not available here; parked continuations
+ * provide the same control flow with explicit capture.
+ *
+ * Usage:
+ *   PTO2AsyncScheduler<> async;
+ *
+ *   TaskOutputTensors shape = pto2_rt_submit_aiv_task(KID_REDUCE, reduce_args);
+ *   async.when_ready(shape.tensors[0], [&](const Tensor &t) {
+ *       uint32_t idx[] = {0};
+ *       int32_t n = get_tensor_data<int32_t>(t, 1, idx);  // completes without spinning
+ *       submit_shaped_branch(n);
+ *   });
+ *   submit_independent_branch();  // overlaps with the in-flight reduce
+ *   async.drain();                // run remaining continuations as producers finish
+ *
+ * Continuations may submit tasks and park further continuations (chained
+ * data dependencies); drain() runs until the table is empty.  On a fatal
+ * runtime every parked tensor reports ready, so continuations run, hit the
+ * usual fatal short-circuits inside the API wrappers, and drain() returns.
+ */
+#ifndef SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_ORCHESTRATION_PTO_ORCHESTRATION_ASYNC_H_
+#define SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_ORCHESTRATION_PTO_ORCHESTRATION_ASYNC_H_
+
+#include <cstring>
+#include <new>
+
+#include "pto_orchestration_api.h"
+
+/**
+ * Fixed-capacity multiplexer for continuations parked on tensor readiness.
+ *
+ * Capacity is the maximum number of simultaneously parked continuations;
+ * ContStorage bounds the capture size of each continuation (bytes).  Both
+ * are compile-time so the scheduler is a plain stack object with no heap
+ * traffic on the orchestration thread.
+ */
+template <int Capacity = 16, size_t ContStorage = 64>
+class PTO2AsyncScheduler {
+    static_assert(Capacity > 0, "PTO2AsyncScheduler requires a positive capacity");
+
+public:
+    PTO2AsyncScheduler() {
+        for (int i = 0; i < Capacity; i++) {
+            entries_[i].live = false;
+        }
+    }
+
+    /**
+     * Run `fn(tensor)` once `tensor` is readable without spinning.
+     *
+     * If the tensor is ready now, the continuation runs inline before this
+     * returns.  Otherwise it is parked until a later poll()/drain() finds
+     * the producer completed.  When the table is full the continuation also
+     * runs inline — get_tensor_data inside it then blocks as it would have
+     * without this layer, so a too-small Capacity degrades to the
+     * serialized behavior instead of dropping work.
+     *
+     * The callable must fit in ContStorage and capture only trivially
+     * copyable state (references and pointers are fine): parked
+     * continuations are relocated by memcpy when they fire.
+     *
+     * @return true if the continuation ran inline, false if it was parked
+     */
+    template <typename F>
+    bool when_ready(const Tensor &tensor, F &&fn) {
+        static_assert(sizeof(F) <= ContStorage, "continuation capture exceeds ContStorage");
+        static_assert(std::is_trivially_copyable_v<std::decay_t<F>>, "continuation capture must be trivially copyable");
+        static_assert(
+            std::is_trivially_destructible_v<std::decay_t<F>>, "continuation capture must be trivially destructible"
+        );
+
+        if (pto2_rt_tensor_data_ready(tensor)) {
+            fn(tensor);
+            return true;
+        }
+
+        for (int i = 0; i < Capacity; i++) {
+            Entry &e = entries_[i];
+            if (e.live) {
+                continue;
+            }
+            new (e.tensor_buf) Tensor(tensor);
+            new (e.fn_buf) std::decay_t<F>(static_cast<F &&>(fn));
+            e.invoke = [](void *buf, const Tensor &t) { (*std::launder(reinterpret_cast<std::decay_t<F> *>(buf)))(t); };
+            e.live = true;
+            pending_++;
+            return false;
+        }
+
+        // Table full: degrade to the blocking path
+        fn(tensor);
+        return true;
+    }
+
+    /**
+     * Run every parked continuation whose tensor has become readable.
+     *
+     * Single pass over the table; continuations fired during the pass may
+     * park new entries (they are picked up by the next poll).  Non-blocking.
+     *
+     * @return Number of continuations run
+     */
+    int poll() {
+        int fired = 0;
+        for (int i = 0; i < Capacity; i++) {
+            Entry &e = entries_[i];
+            if (!e.live) {
+                continue;
+            }
+            const Tensor &parked = *std::launder(reinterpret_cast<const Tensor *>(e.tensor_buf));
+            if (!pto2_rt_tensor_data_ready(parked)) {
+                continue;
+            }
+            // Relocate to locals and free the slot first, so the
+            // continuation can park into it re-entrantly.
+            Tensor t(parked);
+            unsigned char fn_copy[ContStorage];
+            memcpy(fn_copy, e.fn_buf, ContStorage);
+            void (*invoke)(void *, const Tensor &) = e.invoke;
+            e.live = false;
+            pending_--;
+            invoke(fn_copy, t);
+            fired++;
+        }
+        return fired;
+    }
+
+    /**
+     * Run parked continuations (including ones they park in turn) until the
+     * table is empty, spinning between polls while producers are in flight.
+     */
+    void drain() {
+        while (pending_ > 0) {
+            if (poll() == 0) {
+                SPIN_WAIT_HINT();
+            }
+        }
+    }
+
+    /** Number of continuations currently parked. */
+    int pending() const { return pending_; }
+
+    /** True when no continuation is parked. */
+    bool idle() const { return pending_ == 0; }
+
+private:
+    struct Entry {
+        alignas(alignof(Tensor)) unsigned char tensor_buf[sizeof(Tensor)];
+        alignas(alignof(max_align_t)) unsigned char fn_buf[ContStorage];
+        void (*invoke)(void *fn_buf, const Tensor &t);
+        bool live;
+    };
+
+    Entry entries_[Capacity];
+    int pending_{0};
+};
+
+#endif  // SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_ORCHESTRATION_PTO_ORCHESTRATION_ASYNC_H_
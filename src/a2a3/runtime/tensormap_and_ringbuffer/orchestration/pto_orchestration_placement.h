@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * PTO Orchestration Placement — advisory AIC/AIV core choice per callable
+ *
+ * Orchestration code picks the core type per submit by hand
+ * (pto2_rt_submit_aic_task vs pto2_rt_submit_aiv_task), and misplacing a
+ * callable between the cube and vector cores is a recurring ~2x mistake:
+ * a high-arithmetic-intensity kernel on AIV starves the cube units, a
+ * bandwidth-bound kernel on AIC wastes them.  This header makes the choice
+ * advisory instead of hard-coded for callables compiled for both cores:
+ *
+ * - Seed: a roofline estimate.  Each callable registers its arithmetic
+ *   intensity (flops per byte of global-memory traffic); intensities at or
+ *   above the machine balance point default to AIC, below it to AIV.
+ * - Feedback: measured durations.  Callers feed observed execution cycles
+ *   back per core via record_duration(); once a core has measurements its
+ *   EMA-smoothed cycles override the static estimate, so a wrong intensity
+ *   annotation is corrected by the first few runs.
+ *
+ * Usage:
+ *   PTO2PlacementAdvisor<> advisor;
+ *   int32_t gemv = advisor.add_callable(KID_GEMV_AIC, KID_GEMV_AIV, 2.0f);
+ *
+ *   TaskOutputTensors outs = advisor.submit(gemv, args);   // roofline: AIV
+ *   ...
+ *   advisor.record_duration(gemv, CoreType::AIV, observed_cycles);
+ *
+ * Callables with only one compiled variant pass INVALID_KERNEL_ID for the
+ * other slot and always place on the available core.  The advisor never
+ * overrides an explicit pto2_rt_submit_{aic,aiv}_task call — it is an
+ * opt-in default for submits that would otherwise guess.
+ *
+ * Measured cycles come from outside the advisor on purpose: the runtime
+ * exposes durations through the submit-trace capture and the profiling
+ * summary, and replay-style orchestration can feed either back.  The
+ * advisor only asks that AIC and AIV samples for one callable cover
+ * comparable shapes, since it compares their EMAs directly.
+ */
+#ifndef SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_ORCHESTRATION_PTO_ORCHESTRATION_PLACEMENT_H_
+#define SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_ORCHESTRATION_PTO_ORCHESTRATION_PLACEMENT_H_
+
+#include "common/core_type.h"
+#include "pto_orchestration_api.h"
+
+/**
+ * Machine balance point (flops per byte) separating cube-bound from
+ * vector/bandwidth-bound callables.  Peak cube throughput divided by
+ * sustained HBM bandwidth lands in the low tens for the supported parts;
+ * deployments with different ratios pass their own value to the advisor.
+ */
+inline constexpr float PTO2_PLACEMENT_DEFAULT_BALANCE = 16.0f;
+
+/**
+ * Fixed-capacity advisory placement table.
+ *
+ * Capacity is the maximum number of registered callables; entries are plain
+ * POD so the advisor is a stack object on the orchestration thread.  The
+ * duration EMA uses a 1/8 step (shift 3): heavy enough that one outlier
+ * dispatch does not flip the placement, light enough that a persistent 2x
+ * misplacement corrects within ~8 samples.
+ */
+template <int Capacity = 64>
+class PTO2PlacementAdvisor {
+    static_assert(Capacity > 0, "PTO2PlacementAdvisor requires a positive capacity");
+
+public:
+    explicit PTO2PlacementAdvisor(float balance_flops_per_byte = PTO2_PLACEMENT_DEFAULT_BALANCE) :
+        balance_(balance_flops_per_byte) {}
+
+    /**
+     * Register a callable with its per-core kernel IDs and arithmetic
+     * intensity (flops per byte of global-memory traffic).  Pass
+     * INVALID_KERNEL_ID for a core the callable is not compiled for.
+     *
+     * @return Callable handle (>= 0), or -1 on a full table / no valid
+     *         kernel ID (marks the runtime fatal).
+     */
+    int32_t add_callable(int32_t aic_kernel_id, int32_t aiv_kernel_id, float flops_per_byte) {
+        PTO2Runtime *rt = pto2_current_runtime();
+        if (count_ >= Capacity) {
+            rt->ops->report_fatal(
+                rt, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "placement table full (capacity %d)", Capacity
+            );
+            return -1;
+        }
+        if (aic_kernel_id == INVALID_KERNEL_ID && aiv_kernel_id == INVALID_KERNEL_ID) {
+            rt->ops->report_fatal(
+                rt, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "callable needs at least one valid kernel ID"
+            );
+            return -1;
+        }
+        Entry &e = entries_[count_];
+        e.aic_kernel_id = aic_kernel_id;
+        e.aiv_kernel_id = aiv_kernel_id;
+        e.flops_per_byte = flops_per_byte;
+        e.ema_cycles[0] = 0;
+        e.ema_cycles[1] = 0;
+        return count_++;
+    }
+
+    /**
+     * Current placement for a callable.
+     *
+     * Single-variant callables place on their only core.  With measured
+     * durations on both cores the lower EMA wins; otherwise the roofline
+     * seed decides (intensity >= balance → AIC).  A core with measurements
+     * is never abandoned for one without: until the other side has a
+     * sample there is nothing to compare against.
+     */
+    CoreType choose(int32_t callable) const {
+        const Entry &e = entries_[callable];
+        if (e.aic_kernel_id == INVALID_KERNEL_ID) return CoreType::AIV;
+        if (e.aiv_kernel_id == INVALID_KERNEL_ID) return CoreType::AIC;
+        const uint64_t aic = e.ema_cycles[static_cast<int32_t>(CoreType::AIC)];
+        const uint64_t aiv = e.ema_cycles[static_cast<int32_t>(CoreType::AIV)];
+        if (aic != 0 && aiv != 0) {
+            return aic <= aiv ? CoreType::AIC : CoreType::AIV;
+        }
+        return e.flops_per_byte >= balance_ ? CoreType::AIC : CoreType::AIV;
+    }
+
+    /// MixedKernels with only the chosen core's slot active.
+    MixedKernels kernels_for(int32_t callable) const {
+        const Entry &e = entries_[callable];
+        MixedKernels mk;
+        if (choose(callable) == CoreType::AIC) {
+            mk.aic_kernel_id = e.aic_kernel_id;
+        } else {
+            mk.aiv0_kernel_id = e.aiv_kernel_id;
+        }
+        return mk;
+    }
+
+    /// Submit on the advised core (invalid handles mark the runtime fatal).
+    TaskOutputTensors submit(int32_t callable, const Arg &args) {
+        PTO2Runtime *rt = pto2_current_runtime();
+        if (callable < 0 || callable >= count_) {
+            rt->ops->report_fatal(rt, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "invalid callable handle %d", callable);
+            return TaskOutputTensors{};
+        }
+        return pto2_rt_submit_task(kernels_for(callable), args);
+    }
+
+    /**
+     * Feed one measured execution duration back (cycles on the given core).
+     * First sample seeds the EMA; later samples fold in at 1/8 weight.
+     * Ignores cores the callable is not compiled for and zero samples.
+     */
+    void record_duration(int32_t callable, CoreType core, uint64_t cycles) {
+        if (callable < 0 || callable >= count_ || cycles == 0) {
+            return;
+        }
+        Entry &e = entries_[callable];
+        if ((core == CoreType::AIC && e.aic_kernel_id == INVALID_KERNEL_ID) ||
+            (core == CoreType::AIV && e.aiv_kernel_id == INVALID_KERNEL_ID)) {
+            return;
+        }
+        uint64_t &ema = e.ema_cycles[static_cast<int32_t>(core)];
+        ema = (ema == 0) ? cycles : ema - (ema >> 3) + (cycles >> 3);
+    }
+
+    int32_t size() const { return count_; }
+
+private:
+    struct Entry {
+        int32_t aic_kernel_id;
+        int32_t aiv_kernel_id;
+        float flops_per_byte;
+        uint64_t ema_cycles[2];  // indexed by CoreType (AIC=0, AIV=1)
+    };
+
+    float balance_;
+    int32_t count_{0};
+    Entry entries_[Capacity];
+};
+
+#endif  // SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_ORCHESTRATION_PTO_ORCHESTRATION_PLACEMENT_H_
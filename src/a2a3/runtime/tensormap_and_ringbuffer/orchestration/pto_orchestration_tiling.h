@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * PTO Orchestration Tiling — chunked submission of oversized tensors
+ *
+ * A task whose working set exceeds the heap-ring window cannot be submitted
+ * whole: the output allocation alone overflows the ring and the submit goes
+ * fatal.  The conventional workaround splits the tensor on the host, which
+ * round-trips through host memory and serializes against the device.  This
+ * header keeps the split on the orchestration thread instead: describe the
+ * task once against the full-size tensors, pick a dim-0 tile size, and
+ * submit_tiles() expands it into one task per tile over dim-0 views.
+ *
+ * No new runtime machinery is involved — the expansion leans on two
+ * mechanisms the runtime already has:
+ *
+ * - Dependencies: tile views of the same buffer land in the OverlapMap with
+ *   their real row ranges, so a downstream task consuming a tile (or any
+ *   range overlapping it) picks up exactly the producing tile's edge, not a
+ *   whole-tensor barrier.  Chained elementwise stages pipeline tile-by-tile
+ *   automatically.
+ * - Memory bound: each tile's outputs are allocated at its own submit, and
+ *   submit blocks when the heap ring is full — so peak memory is
+ *   tiles-in-flight × tile size, not the full tensor, and back-pressure
+ *   (not this helper) decides how many tiles are in flight.
+ *
+ * Usage (C = A * B row-block by row-block, weights shared):
+ *   PTO2TiledSubmit tiled(total_rows, rows_per_tile);
+ *   tiled.add_input_tiled(activations);   // sliced along dim 0 per tile
+ *   tiled.add_input_shared(weights);      // same tensor every tile
+ *   tiled.add_output_tiled(out_ci);       // create-info with full-size dim 0
+ *   tiled.submit_tiles(mixed_kernels, [&](const PTO2TileRange &r, TaskOutputTensors &outs) {
+ *       consume_args.add_input(outs.get_ref(0));  // per-tile consumer, exact edge
+ *       pto2_rt_submit_aiv_task(KID_CONSUME, consume_args);
+ *   });
+ *
+ * The per-tile callback sees each tile's materialized outputs as soon as its
+ * submit returns, so streaming consumers are wired while later tiles are
+ * still being submitted.  Kernels receive ordinary view tensors: dim-0 shape
+ * is the tile's row count (the tail tile may be short), other dims are
+ * untouched.  Scalars and the launch spec are replicated to every tile.
+ */
+#ifndef SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_ORCHESTRATION_PTO_ORCHESTRATION_TILING_H_
+#define SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_ORCHESTRATION_PTO_ORCHESTRATION_TILING_H_
+
+#include <cstring>
+#include <new>
+
+#include "pto_orchestration_api.h"
+
+/**
+ * Row range of one tile, passed to the per-tile submit callback.
+ */
+struct PTO2TileRange {
+    int32_t tile;        // tile index, 0-based
+    uint32_t row_begin;  // first dim-0 row of this tile
+    uint32_t rows;       // dim-0 rows in this tile (tail tile may be short)
+};
+
+/**
+ * Builder that expands one task description into per-tile submits.
+ *
+ * Argument slots are fixed-capacity (MAX_TENSOR_ARGS / MAX_SCALAR_ARGS,
+ * matching Arg) so the builder is a plain stack object.  Errors follow the
+ * Arg convention: add-time problems latch an error message, and
+ * submit_tiles() reports it fatally instead of submitting.
+ */
+class PTO2TiledSubmit {
+public:
+    /**
+     * @param total_rows     dim-0 extent every tiled argument must match
+     * @param rows_per_tile  dim-0 rows per tile; the last tile takes the remainder
+     */
+    PTO2TiledSubmit(uint32_t total_rows, uint32_t rows_per_tile) :
+        total_rows_(total_rows), rows_per_tile_(rows_per_tile) {
+        if (total_rows == 0 || rows_per_tile == 0) {
+            set_error("PTO2TiledSubmit requires non-zero total_rows and rows_per_tile");
+        }
+    }
+
+    /// Input sliced along dim 0: tile i reads rows [i*rows_per_tile, ...).
+    void add_input_tiled(const Tensor &tensor) { add_tiled_tensor(tensor, SlotKind::INPUT_TILED); }
+
+    /// Input passed unsliced to every tile (weights, tables, broadcast operands).
+    void add_input_shared(const Tensor &tensor) { add_tensor_slot(tensor, SlotKind::INPUT_SHARED); }
+
+    /// Existing tensor read and written tile-by-tile along dim 0.
+    void add_inout_tiled(const Tensor &tensor) { add_tiled_tensor(tensor, SlotKind::INOUT_TILED); }
+
+    /**
+     * Runtime-allocated output, created per tile.  Pass the create-info with
+     * its full-size dim 0 (== total_rows); each tile's submit re-scopes dim 0
+     * to the tile's row count, so one tile's buffer — not the whole tensor —
+     * is allocated per submit.  The per-tile Tensor comes back through the
+     * submit callback's TaskOutputTensors, in add_output_tiled order.
+     */
+    void add_output_tiled(const TensorCreateInfo &create_info) {
+        if (create_info.ndims < 1 || create_info.raw_shapes[0] != total_rows_) {
+            set_error("add_output_tiled: create-info dim 0 must equal total_rows");
+            return;
+        }
+        if (tensor_count_ >= MAX_TENSOR_ARGS) {
+            set_error("Too many tensor args (exceeds MAX_TENSOR_ARGS=16)");
+            return;
+        }
+        slots_[tensor_count_].kind = SlotKind::OUTPUT_TILED;
+        slots_[tensor_count_].create_info = create_info;
+        tensor_count_++;
+    }
+
+    /// Scalars replicated to every tile (same semantics as Arg::add_scalar).
+    template <typename... Args>
+    void add_scalar(Args... args) {
+        static_assert(sizeof...(Args) >= 1, "add_scalar: at least one argument required");
+        static_assert((is_supported_scalar_arg_v<Args> && ...), "add_scalar: all types must be arithmetic or enum");
+        if (scalar_count_ + sizeof...(Args) > MAX_SCALAR_ARGS) {
+            set_error("Too many scalar args (exceeds MAX_SCALAR_ARGS=128)");
+            return;
+        }
+        ((scalars_[scalar_count_++] = to_u64(args)), ...);
+    }
+
+    /// Launch spec replicated to every tile's Arg (block_num applies per tile).
+    PTO2LaunchSpec launch_spec;
+
+    int32_t num_tiles() const {
+        return static_cast<int32_t>((total_rows_ + rows_per_tile_ - 1) / rows_per_tile_);
+    }
+
+    /**
+     * Submit one task per tile, invoking `on_tile(range, outs)` after each
+     * tile's submit returns.  Submits block under heap-ring back-pressure,
+     * which is what bounds tiles in flight.  Stops early (returning false)
+     * if the builder latched an argument error or the runtime goes fatal.
+     */
+    template <typename OnTile>
+    bool submit_tiles(const MixedKernels &mixed_kernels, OnTile &&on_tile) {
+        PTO2Runtime *rt = pto2_current_runtime();
+        if (has_error_) {
+            rt->ops->report_fatal(
+                rt, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "%s",
+                error_msg_ ? error_msg_ : "submit_tiles called on an invalid PTO2TiledSubmit"
+            );
+            return false;
+        }
+        const int32_t tiles = num_tiles();
+        for (int32_t tile = 0; tile < tiles; tile++) {
+            if (rt->ops->is_fatal(rt)) {
+                return false;
+            }
+            const uint32_t row_begin = static_cast<uint32_t>(tile) * rows_per_tile_;
+            const uint32_t rows =
+                (row_begin + rows_per_tile_ <= total_rows_) ? rows_per_tile_ : total_rows_ - row_begin;
+
+            // Per-tile argument storage.  Arg stores pointers, so the views
+            // and create-info copies must live past this tile's submit.
+            Arg args;
+            args.launch_spec = launch_spec;
+            alignas(alignof(Tensor)) unsigned char view_buf[MAX_TENSOR_ARGS][sizeof(Tensor)];
+            TensorCreateInfo tile_cis[MAX_TENSOR_ARGS];
+
+            for (int32_t i = 0; i < tensor_count_; i++) {
+                switch (slots_[i].kind) {
+                    case SlotKind::INPUT_SHARED:
+                        args.add_input(*slots_[i].tensor);
+                        break;
+                    case SlotKind::INPUT_TILED:
+                        args.add_input(*make_tile_view(*slots_[i].tensor, view_buf[i], row_begin, rows));
+                        break;
+                    case SlotKind::INOUT_TILED:
+                        args.add_inout(*make_tile_view(*slots_[i].tensor, view_buf[i], row_begin, rows));
+                        break;
+                    case SlotKind::OUTPUT_TILED:
+                        tile_cis[i] = slots_[i].create_info;
+                        tile_cis[i].raw_shapes[0] = rows;
+                        args.add_output(tile_cis[i]);
+                        break;
+                }
+            }
+            args.add_scalars(scalars_, scalar_count_);
+            if (args.has_error) {
+                rt->ops->report_fatal(
+                    rt, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "%s",
+                    args.error_msg ? args.error_msg : "submit_tiles failed to build per-tile Arg"
+                );
+                return false;
+            }
+
+            TaskOutputTensors outs = pto2_rt_submit_task(mixed_kernels, args);
+            if (rt->ops->is_fatal(rt)) {
+                return false;
+            }
+            PTO2TileRange range{tile, row_begin, rows};
+            on_tile(range, outs);
+        }
+        return true;
+    }
+
+    /// Submit without a per-tile callback (no runtime-allocated outputs, or
+    /// downstream tasks find the tiles through OverlapMap range overlap).
+    bool submit_tiles(const MixedKernels &mixed_kernels) {
+        return submit_tiles(mixed_kernels, [](const PTO2TileRange &, TaskOutputTensors &) {});
+    }
+
+private:
+    enum class SlotKind : uint8_t { INPUT_TILED = 0, INPUT_SHARED = 1, INOUT_TILED = 2, OUTPUT_TILED = 3 };
+
+    /// One argument slot; `create_info` is active for OUTPUT_TILED, `tensor` otherwise.
+    struct Slot {
+        SlotKind kind{SlotKind::INPUT_TILED};
+        const Tensor *tensor{nullptr};
+        TensorCreateInfo create_info;
+    };
+
+    void set_error(const char *msg) {
+        if (!has_error_) {
+            has_error_ = true;
+            error_msg_ = msg;
+        }
+    }
+
+    void add_tiled_tensor(const Tensor &tensor, SlotKind kind) {
+        if (tensor.ndims < 1 || tensor.shapes[0] != total_rows_) {
+            set_error("tiled tensor dim 0 must equal total_rows");
+            return;
+        }
+        add_tensor_slot(tensor, kind);
+    }
+
+    void add_tensor_slot(const Tensor &tensor, SlotKind kind) {
+        if (tensor_count_ >= MAX_TENSOR_ARGS) {
+            set_error("Too many tensor args (exceeds MAX_TENSOR_ARGS=16)");
+            return;
+        }
+        slots_[tensor_count_].kind = kind;
+        slots_[tensor_count_].tensor = &tensor;
+        tensor_count_++;
+    }
+
+    /// Placement-construct a dim-0 view of `src` in `buf` (Tensor has no
+    /// public default constructor; it is trivially copyable/destructible).
+    static Tensor *make_tile_view(const Tensor &src, unsigned char *buf, uint32_t row_begin, uint32_t rows) {
+        uint32_t view_shapes[RUNTIME_MAX_TENSOR_DIMS];
+        uint32_t view_offsets[RUNTIME_MAX_TENSOR_DIMS] = {};
+        for (uint32_t d = 0; d < src.ndims; d++) {
+            view_shapes[d] = src.shapes[d];
+        }
+        view_shapes[0] = rows;
+        view_offsets[0] = row_begin;
+        return new (buf) Tensor(src.view(view_shapes, view_offsets));
+    }
+
+    uint32_t total_rows_;
+    uint32_t rows_per_tile_;
+    int32_t tensor_count_{0};
+    int32_t scalar_count_{0};
+    bool has_error_{false};
+    const char *error_msg_{nullptr};
+    Slot slots_[MAX_TENSOR_ARGS];
+    uint64_t scalars_[MAX_SCALAR_ARGS];
+};
+
+#endif  // SRC_A2A3_RUNTIME_TENSORMAP_AND_RINGBUFFER_ORCHESTRATION_PTO_ORCHESTRATION_TILING_H_
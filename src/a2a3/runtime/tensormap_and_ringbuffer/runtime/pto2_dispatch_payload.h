@@ -28,12 +28,20 @@
  * it on each dispatch.  The struct is cache-line aligned to avoid false
  * sharing across concurrently dispatched cores.
  *
+ * Layout is organized for whole-cacheline publication: the hot per-dispatch
+ * fields (function_bin_addr + both contexts) share the first 64B line, and
+ * args[] starts on a line boundary so build_payload() can stream each line
+ * from an AICPU-local staging copy with a single 64B store instead of
+ * dirtying the shared lines field by field.  The context-pointer suffix
+ * (args[144..146]) likewise begins a fresh line.
+ *
  * The DATA_MAIN_BASE register protocol is unchanged from the base runtime:
  * a monotonically increasing reg_task_id signals new work to AICore.
  */
 
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "intrinsic.h"
@@ -56,6 +64,11 @@ static_assert(
     (MAX_TENSOR_ARGS + MAX_SCALAR_ARGS + 1) == SPMD_GLOBAL_CONTEXT_INDEX,
     "GLOBAL_CONTEXT_INDEX out of sync with intrinsic.h"
 );
+static_assert(
+    (MAX_TENSOR_ARGS + MAX_SCALAR_ARGS + 2) == SPMD_DEVICE_ENQUEUE_INDEX,
+    "DEVICE_ENQUEUE_INDEX out of sync with intrinsic.h"
+);
+static_assert(PTO2_EXT_PARAMS_COUNT == 3, "args[] suffix slot count drifted from the indices above");
 
 /**
  * Per-core dispatch payload: function address + args[] + SPMD context.
@@ -68,8 +81,7 @@ static_assert(
  * concurrently dispatched cores.
  */
 struct alignas(64) PTO2DispatchPayload {
-    uint64_t function_bin_addr;            /**< Kernel entry address in GM (set by Scheduler) */
-    uint64_t args[PTO2_DISPATCH_MAX_ARGS]; /**< Kernel arguments (GM pointers + scalars + ext params) */
+    uint64_t function_bin_addr; /**< Kernel entry address in GM (set by Scheduler) */
 
     /** Per-dispatch context: block_idx and block_num.
      *  Written by build_payload() before each dispatch.
@@ -81,9 +93,50 @@ struct alignas(64) PTO2DispatchPayload {
      *  args[SPMD_GLOBAL_CONTEXT_INDEX] points here. */
     GlobalContext global_context;
 
+    /** Pad the hot header fields out to one cache line so args[] is
+     *  line-aligned and each published line covers exactly one 64B store. */
+    uint8_t header_pad[64 - sizeof(uint64_t) - sizeof(LocalContext) - sizeof(GlobalContext)];
+
+    uint64_t args[PTO2_DISPATCH_MAX_ARGS]; /**< Kernel arguments (GM pointers + scalars + ext params) */
+
     static_assert(sizeof(args[0]) == 8);
-    static_assert(
-        PTO2_ALIGN_UP((MAX_TENSOR_ARGS + MAX_SCALAR_ARGS) * sizeof(args[0]), 64) ==
-        (MAX_TENSOR_ARGS + MAX_SCALAR_ARGS) * sizeof(args[0])
-    );
 };
+
+// =============================================================================
+// Dispatch payload layout contract
+// =============================================================================
+// This struct is ABI between three independently compiled programs: the AICPU
+// .so (g++/aarch64) builds payloads, AICore kernels (ccec) read them, and
+// generated orchestration stubs index args[]. The same header is the single
+// layout source for all three, and every toolchain that includes it re-checks
+// the contract below at compile time — a field move, a grown context struct,
+// or a packing difference between compilers fails the build instead of
+// silently costing a cache line or corrupting dispatch.
+
+// Hot per-dispatch fields must share the first cache line: AICore reads
+// function_bin_addr and the contexts with one line fill per dispatch.
+static_assert(offsetof(PTO2DispatchPayload, function_bin_addr) == 0, "function address must lead the hot line");
+static_assert(offsetof(PTO2DispatchPayload, local_context) == sizeof(uint64_t), "local context follows the address");
+static_assert(
+    offsetof(PTO2DispatchPayload, global_context) == sizeof(uint64_t) + sizeof(LocalContext),
+    "global context follows local context"
+);
+static_assert(
+    sizeof(uint64_t) + sizeof(LocalContext) + sizeof(GlobalContext) <= 64,
+    "hot header fields must fit the first cache line (header_pad size wraps otherwise)"
+);
+
+// Whole-line publication invariants relied on by build_payload().
+static_assert(offsetof(PTO2DispatchPayload, args) == 64, "args[] must start on a cache line boundary");
+static_assert(
+    (SPMD_LOCAL_CONTEXT_INDEX * sizeof(uint64_t)) % 64 == 0,
+    "Context-pointer suffix must begin a fresh cache line"
+);
+
+// Total footprint: one header line + the args[] region, padded to whole lines.
+// Pins the per-core slot stride in s_pto2_payload_per_core across toolchains.
+static_assert(
+    sizeof(PTO2DispatchPayload) == PTO2_ALIGN_UP(64 + PTO2_DISPATCH_MAX_ARGS * sizeof(uint64_t), 64),
+    "dispatch payload size drifted from the header + args layout"
+);
+static_assert(alignof(PTO2DispatchPayload) == 64, "per-core slots must stay cache-line aligned");
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * PTO Runtime2 - block_num auto-tuning from measured history
+ *
+ * Static per-case block_num values are guesses that rarely get revisited:
+ * too few blocks leave cores idle, too many pay dispatch overhead for
+ * sliver-sized work. Submitting with PTO2LaunchSpec::set_block_num_auto()
+ * lets the runtime pick instead, from what it measured the last time the
+ * same kernel ran.
+ *
+ * Mechanics: the scheduler stamps a task's first dispatch and, at
+ * completion, folds the elapsed wall cycles into a per-func_id EMA here
+ * (achieved parallelism is bounded by min(block_num, machine width), so
+ * elapsed * that bound estimates the kernel's serial work). At the next
+ * AUTO submit of the same func_id the orchestrator splits that serial
+ * estimate into blocks of at least PTO2_AUTOTUNE_MIN_BLOCK_CYCLES each,
+ * capped at the machine width for the task's resource shape — never more
+ * blocks than cores, never blocks smaller than the dispatch round trip
+ * they cost.
+ *
+ * The first AUTO launch of a func_id has no history and uses the full
+ * machine width. History lives in AICPU process memory and resets with
+ * the runtime; entries are direct-mapped by func_id with latest-wins on
+ * collision. Updates race benignly across scheduler threads (relaxed
+ * atomics — a lost EMA sample only delays convergence).
+ *
+ * Submit-trace captures record the AUTO sentinel, not the resolved value,
+ * so a replayed stream re-tunes against the replay machine's history.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "pto_submit_types.h"
+
+/** Direct-mapped history slots (power of two; collisions overwrite). */
+inline constexpr int32_t PTO2_AUTOTUNE_TABLE_SIZE = 256;
+
+/**
+ * Smallest worthwhile block, in cycles: roughly a few register-protocol
+ * dispatch round trips. Splitting finer than this spends more AICPU time
+ * dispatching a block than the core spends running it.
+ */
+inline constexpr uint64_t PTO2_AUTOTUNE_MIN_BLOCK_CYCLES = 8192;
+
+/** One func_id's measured history. */
+struct PTO2BlockAutotuneEntry {
+    std::atomic<int32_t> func_id{INVALID_KERNEL_ID};
+    std::atomic<int16_t> last_block_num{0};
+    std::atomic<uint64_t> ema_elapsed{0};  // EMA of first-dispatch → completion wall cycles
+};
+
+inline PTO2BlockAutotuneEntry g_pto2_block_autotune[PTO2_AUTOTUNE_TABLE_SIZE];
+
+/**
+ * History key for a mixed task: the first active kernel slot. Co-scheduled
+ * cluster kernels complete together, so any active slot identifies the
+ * callable's timing behavior.
+ */
+static inline int32_t pto2_block_autotune_key(int32_t aic_id, int32_t aiv0_id, int32_t aiv1_id) {
+    if (aic_id != INVALID_KERNEL_ID) return aic_id;
+    if (aiv0_id != INVALID_KERNEL_ID) return aiv0_id;
+    return aiv1_id;
+}
+
+/**
+ * Fold one completed task into the func's history (scheduler side).
+ *
+ * @param func_id History key from pto2_block_autotune_key()
+ * @param block_num Logical block count the task ran with
+ * @param elapsed_cycles First block dispatch → task completion, sys_cnt cycles
+ */
+static inline void pto2_block_autotune_observe(int32_t func_id, int16_t block_num, uint64_t elapsed_cycles) {
+    if (func_id == INVALID_KERNEL_ID || block_num < 1 || elapsed_cycles == 0) return;
+    PTO2BlockAutotuneEntry &e = g_pto2_block_autotune[static_cast<uint32_t>(func_id) & (PTO2_AUTOTUNE_TABLE_SIZE - 1)];
+    if (e.func_id.load(std::memory_order_relaxed) != func_id) {
+        // New func or collision eviction: seed the EMA from this sample.
+        e.func_id.store(func_id, std::memory_order_relaxed);
+        e.ema_elapsed.store(elapsed_cycles, std::memory_order_relaxed);
+    } else {
+        uint64_t old = e.ema_elapsed.load(std::memory_order_relaxed);
+        e.ema_elapsed.store(old - old / 4 + elapsed_cycles / 4, std::memory_order_relaxed);
+    }
+    e.last_block_num.store(block_num, std::memory_order_relaxed);
+}
+
+/**
+ * Pick a block_num for an AUTO submit of func_id (orchestrator side).
+ *
+ * @param func_id History key from pto2_block_autotune_key()
+ * @param width Machine parallelism for the task's resource shape
+ *              (total_aiv_count for AIV, total_cluster_count otherwise)
+ * @return Chosen block count in [1, width]
+ */
+static inline int16_t pto2_block_autotune_resolve(int32_t func_id, int32_t width) {
+    if (width < 1) width = 1;
+    if (func_id == INVALID_KERNEL_ID) return static_cast<int16_t>(width);
+    PTO2BlockAutotuneEntry &e = g_pto2_block_autotune[static_cast<uint32_t>(func_id) & (PTO2_AUTOTUNE_TABLE_SIZE - 1)];
+    if (e.func_id.load(std::memory_order_relaxed) != func_id) {
+        return static_cast<int16_t>(width);  // No history yet: start fully spread
+    }
+    uint64_t elapsed = e.ema_elapsed.load(std::memory_order_relaxed);
+    int16_t last = e.last_block_num.load(std::memory_order_relaxed);
+    if (elapsed == 0 || last < 1) {
+        return static_cast<int16_t>(width);
+    }
+    // Serial-work estimate: elapsed wall time times the parallelism the run
+    // could actually achieve. Splitting that into MIN_BLOCK_CYCLES chunks
+    // keeps every block worth its dispatch.
+    uint64_t achieved = (last < width) ? static_cast<uint64_t>(last) : static_cast<uint64_t>(width);
+    uint64_t blocks = (elapsed * achieved) / PTO2_AUTOTUNE_MIN_BLOCK_CYCLES;
+    if (blocks < 1) blocks = 1;
+    if (blocks > static_cast<uint64_t>(width)) blocks = static_cast<uint64_t>(width);
+    return static_cast<int16_t>(blocks);
+}
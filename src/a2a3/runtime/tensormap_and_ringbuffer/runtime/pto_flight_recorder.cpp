@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * PTO Runtime2 - Crash-Dump Flight Recorder (implementation)
+ */
+
+#include "pto_flight_recorder.h"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+
+#include "common/unified_log.h"
+
+// Weak fallback for builds that don't link device_time.cpp (e.g. host).
+// Same pattern as pto_orchestrator.cpp: the strong AICPU symbol wins, and
+// hidden visibility keeps the host .so from exporting the fallback globally.
+__attribute__((weak, visibility("hidden"))) uint64_t get_sys_cnt_aicpu() { return 0; }
+
+namespace {
+
+struct PTO2FlightRing {
+    uint64_t count;  // Monotonic; events[count & (capacity - 1)] is the next slot
+    PTO2FlightEvent events[PTO2_FLIGHT_RING_CAPACITY];
+};
+
+// Static rings: the recorder must stay usable from the abort paths, where
+// the heap and the shared-memory arenas may be part of the problem.
+PTO2FlightRing g_flight_rings[PTO2_FLIGHT_MAX_RINGS];
+std::atomic<uint32_t> g_flight_ring_count{0};
+std::atomic<bool> g_flight_dumped{false};
+
+thread_local PTO2FlightRing *t_flight_ring = nullptr;
+thread_local bool t_flight_oversubscribed = false;
+
+PTO2FlightRing *flight_claim_ring() {
+    uint32_t slot = g_flight_ring_count.fetch_add(1, std::memory_order_acq_rel);
+    if (slot >= PTO2_FLIGHT_MAX_RINGS) {
+        // Keep the counter honest for the dump header; this thread records nothing.
+        g_flight_ring_count.fetch_sub(1, std::memory_order_acq_rel);
+        return nullptr;
+    }
+    return &g_flight_rings[slot];
+}
+
+}  // namespace
+
+void pto2_flight_record(PTO2FlightEventType type, uint64_t task_id, int32_t arg0, int32_t arg1) {
+    PTO2FlightRing *ring = t_flight_ring;
+    if (ring == nullptr) {
+        if (t_flight_oversubscribed) {
+            return;
+        }
+        ring = flight_claim_ring();
+        if (ring == nullptr) {
+            t_flight_oversubscribed = true;
+            return;
+        }
+        t_flight_ring = ring;
+    }
+
+    PTO2FlightEvent &ev = ring->events[ring->count & (PTO2_FLIGHT_RING_CAPACITY - 1)];
+    ev.timestamp = get_sys_cnt_aicpu();
+    ev.task_id = task_id;
+    ev.arg0 = arg0;
+    ev.arg1 = arg1;
+    ev.type = static_cast<uint8_t>(type);
+    ring->count++;
+}
+
+void pto2_flight_dump(const char *reason) {
+    bool expected = false;
+    if (!g_flight_dumped.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+        return;  // Another abort path already persisted the history
+    }
+
+    const char *path = std::getenv("PTO2_FLIGHT_DUMP");
+    if (path == nullptr || path[0] == '\0') {
+        path = "pto2_flight_dump.bin";
+    }
+
+    FILE *file = fopen(path, "wb");
+    if (file == nullptr) {
+        LOG_ERROR("[FlightRecorder] cannot open dump file '%s'", path);
+        return;
+    }
+
+    uint32_t ring_count = g_flight_ring_count.load(std::memory_order_acquire);
+    if (ring_count > PTO2_FLIGHT_MAX_RINGS) {
+        ring_count = PTO2_FLIGHT_MAX_RINGS;
+    }
+
+    PTO2FlightFileHeader header{};
+    header.magic = PTO2_FLIGHT_MAGIC;
+    header.version = PTO2_FLIGHT_VERSION;
+    header.event_size = static_cast<uint16_t>(sizeof(PTO2FlightEvent));
+    header.ring_capacity = PTO2_FLIGHT_RING_CAPACITY;
+    header.ring_count = ring_count;
+    header.dump_cycle = get_sys_cnt_aicpu();
+    strncpy(header.reason, reason != nullptr ? reason : "", sizeof(header.reason) - 1);
+    fwrite(&header, sizeof(header), 1, file);
+
+    uint64_t total_emitted = 0;
+    for (uint32_t r = 0; r < ring_count; r++) {
+        const PTO2FlightRing &ring = g_flight_rings[r];
+        uint64_t count = ring.count;  // Snapshot; the owner may still be appending
+        uint32_t emitted =
+            count < PTO2_FLIGHT_RING_CAPACITY ? static_cast<uint32_t>(count) : PTO2_FLIGHT_RING_CAPACITY;
+
+        PTO2FlightRingHeader ring_header{};
+        ring_header.total_count = count;
+        ring_header.emitted = emitted;
+        fwrite(&ring_header, sizeof(ring_header), 1, file);
+
+        // Oldest first: the window is [count - emitted, count)
+        for (uint64_t i = count - emitted; i < count; i++) {
+            fwrite(&ring.events[i & (PTO2_FLIGHT_RING_CAPACITY - 1)], sizeof(PTO2FlightEvent), 1, file);
+        }
+        total_emitted += emitted;
+    }
+    fclose(file);
+
+    LOG_ERROR(
+        "[FlightRecorder] %s: persisted %" PRIu64 " events from %u threads to '%s' "
+        "(decode with tools/flight_viewer.py)",
+        reason != nullptr ? reason : "abort", total_emitted, ring_count, path
+    );
+}
+
+void pto2_flight_reset() { g_flight_dumped.store(false, std::memory_order_release); }
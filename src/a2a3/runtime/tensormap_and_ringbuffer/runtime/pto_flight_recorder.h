@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * PTO Runtime2 - Crash-Dump Flight Recorder
+ *
+ * Always-on recorder of the most recent scheduler/orchestrator events. Each
+ * participating thread (orchestrator, scheduler threads) owns a small fixed
+ * ring of compact 32-byte records — submit, dispatch, completion, scope
+ * begin/end, allocator stalls — that is overwritten continuously and costs
+ * one function call plus one cache line per event. Nothing is written to
+ * disk on a healthy run.
+ *
+ * When the run dies — allocator deadlock in PTO2TaskAllocator, scope
+ * deadlock, or emergency_shutdown() in the executor — the abort path calls
+ * pto2_flight_dump(), which persists every ring to a binary file so the
+ * event history leading up to the failure survives the crash. Decode with
+ * tools/flight_viewer.py. The dump path is PTO2_FLIGHT_DUMP if set,
+ * otherwise pto2_flight_dump.bin in the working directory.
+ *
+ * The dump is best-effort by design: it runs while other threads may still
+ * be appending, so the newest record of a still-live ring can be torn. All
+ * older records are intact — the ring is only ever appended to in place.
+ */
+
+#ifndef PTO_FLIGHT_RECORDER_H
+#define PTO_FLIGHT_RECORDER_H
+
+#include <stdint.h>
+
+inline constexpr uint32_t PTO2_FLIGHT_MAGIC = 0x50464C54;  // "PFLT"
+inline constexpr uint16_t PTO2_FLIGHT_VERSION = 1;
+
+/** Events kept per thread; oldest are overwritten (power of two). */
+inline constexpr uint32_t PTO2_FLIGHT_RING_CAPACITY = 1024;
+
+/** Per-thread rings available; extra threads fall back to not recording. */
+inline constexpr uint32_t PTO2_FLIGHT_MAX_RINGS = 16;
+
+/** Event kinds; arg0/arg1 meaning depends on the kind (see record sites). */
+enum class PTO2FlightEventType : uint8_t {
+    TASK_SUBMIT = 0,    // task_id, arg0 = aic_kernel_id (-1 for alloc_tensors), arg1 = tensor_count
+    TASK_DISPATCH = 1,  // task_id, arg0 = core_id, arg1 = reg_task_id
+    TASK_COMPLETE = 2,  // task_id, arg0 = core_id, arg1 = reg_task_id
+    SCOPE_BEGIN = 3,    // arg0 = scope depth after begin
+    SCOPE_END = 4,      // arg0 = scope depth before end, arg1 = tasks retired
+    ALLOC_STALL = 5,    // arg0 = requested output size, arg1 = 1 if blocked on heap
+    ABORT = 6,          // arg0 = error code, arg1 = context-specific detail
+};
+
+/** One recorded event; layout is pinned by event_size in the file header. */
+struct PTO2FlightEvent {
+    uint64_t timestamp;  // get_sys_cnt_aicpu() at record time
+    uint64_t task_id;    // Full PTO2 task id (ring_id << 32 | local_id), 0 if n/a
+    int32_t arg0;
+    int32_t arg1;
+    uint8_t type;  // PTO2FlightEventType
+    uint8_t reserved[7];
+};
+static_assert(sizeof(PTO2FlightEvent) == 32, "PTO2FlightEvent must stay one half cache line");
+
+/** Dump file header, followed by ring_count (ring header + events) blocks. */
+struct PTO2FlightFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t event_size;
+    uint32_t ring_capacity;
+    uint32_t ring_count;
+    uint64_t dump_cycle;  // get_sys_cnt_aicpu() when the dump was taken
+    char reason[64];      // NUL-terminated abort reason
+};
+
+/** Per-ring header; emitted events follow, oldest first. */
+struct PTO2FlightRingHeader {
+    uint64_t total_count;  // Events ever recorded on this ring (monotonic)
+    uint32_t emitted;      // min(total_count, ring_capacity) events in the file
+    uint32_t reserved;
+};
+
+/** Append one event to the calling thread's ring (always-on, hot path). */
+void pto2_flight_record(PTO2FlightEventType type, uint64_t task_id, int32_t arg0, int32_t arg1);
+
+/**
+ * Persist all rings to the dump file. One-shot per run: the first abort path
+ * to arrive wins, concurrent or repeated calls are no-ops. Safe to call from
+ * any thread, including while other threads are still recording.
+ */
+void pto2_flight_dump(const char *reason);
+
+/** Re-arm the one-shot dump for a new run (called at orchestrator init). */
+void pto2_flight_reset();
+
+#endif  // PTO_FLIGHT_RECORDER_H
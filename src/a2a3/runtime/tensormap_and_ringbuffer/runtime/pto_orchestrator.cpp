@@ -26,9 +26,15 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <new>
+
 #include "common/unified_log.h"
+#include "pto_block_autotune.h"
+#include "pto_mem_ops.h"
+#include "pto_flight_recorder.h"
 #include "pto_runtime2_types.h"
 #include "pto_shared_memory.h"
+#include "pto_submit_trace.h"
 #include "pto_tensormap.h"
 #include "pto_types.h"
 #include "tensor.h"
@@ -36,6 +42,15 @@
 // =============================================================================
 // Orchestrator Profiling (compile-time toggle)
 // =============================================================================
+#if PTO2_PROFILING
+// Effective collection gate: the run-level switch AND the orchestration-
+// controlled pause/resume gate in shared memory (pto2_rt_profiling_pause).
+static inline bool pto2_prof_active(PTO2OrchestratorState *orch) {
+    return orch->enable_profiling &&
+           orch->sm_handle->header->profiling_gate.load(std::memory_order_relaxed) != 0;
+}
+#endif
+
 #if PTO2_ORCH_PROFILING
 #include "aicpu/device_time.h"
 #include "aicpu/performance_collector_aicpu.h"
@@ -73,19 +88,23 @@ uint64_t g_orch_args_atomic_count = 0;
 uint64_t g_orch_fanin_atomic_count = 0;
 uint64_t g_orch_finalize_atomic_count = 0;
 uint64_t g_orch_scope_end_atomic_count = 0;
-#define CYCLE_COUNT_START() uint64_t _t0 = get_sys_cnt_aicpu(), _t1
+#define CYCLE_COUNT_START()                      \
+    bool _prof_active = pto2_prof_active(orch);  \
+    uint64_t _t0 = get_sys_cnt_aicpu(), _t1
 #define CYCLE_COUNT_LAP(acc)       \
     do {                           \
         _t1 = get_sys_cnt_aicpu(); \
         acc += (_t1 - _t0);        \
         _t0 = _t1;                 \
     } while (0)
-#define CYCLE_COUNT_LAP_RECORD(acc, phase_id, tid)                                    \
-    do {                                                                              \
-        _t1 = get_sys_cnt_aicpu();                                                    \
-        acc += (_t1 - _t0);                                                           \
-        perf_aicpu_record_orch_phase((phase_id), _t0, _t1, g_orch_submit_idx, (tid)); \
-        _t0 = _t1;                                                                    \
+#define CYCLE_COUNT_LAP_RECORD(acc, phase_id, tid)                                        \
+    do {                                                                                  \
+        _t1 = get_sys_cnt_aicpu();                                                        \
+        acc += (_t1 - _t0);                                                               \
+        if (_prof_active) {                                                               \
+            perf_aicpu_record_orch_phase((phase_id), _t0, _t1, g_orch_submit_idx, (tid)); \
+        }                                                                                 \
+        _t0 = _t1;                                                                        \
     } while (0)
 #elif PTO2_PROFILING
 #include "aicpu/device_time.h"
@@ -96,7 +115,7 @@ perf_aicpu_record_orch_phase(AicpuPhaseId, uint64_t, uint64_t, uint32_t, uint64_
 // submit_idx needed for swimlane task_id tagging (no cycle accumulation at this level)
 static uint32_t g_orch_submit_idx = 0;
 #define CYCLE_COUNT_START()                     \
-    bool _prof_active = orch->enable_profiling; \
+    bool _prof_active = pto2_prof_active(orch); \
     uint64_t _t0 = _prof_active ? get_sys_cnt_aicpu() : 0, _t1 = 0
 #define CYCLE_COUNT_LAP(acc) \
     do {                     \
@@ -115,12 +134,112 @@ static uint32_t g_orch_submit_idx = 0;
 #define CYCLE_COUNT_LAP_RECORD(acc, phase_id, tid)
 #endif
 
+#if PTO2_ORCH_PROFILING
+// =============================================================================
+// Per-Callsite Submit Tracing
+// =============================================================================
+// Aggregates submit cost by the return address of each pto2_submit_mixed_task
+// caller so orchestration code (including generated code under examples/) can
+// be mapped back to the regions that dominate submit time. Resolve the logged
+// addresses with addr2line against the orchestration .so. Single writer (the
+// orchestrator thread), so plain counters suffice.
+struct PTO2SubmitCallsiteStats {
+    void *ret_addr;              // caller PC; nullptr marks an empty slot
+    uint64_t call_count;         // submits attributed to this callsite
+    uint64_t total_cycle;        // end-to-end submit cycles
+    uint64_t max_cycle;          // slowest single submit
+    uint64_t alloc_stall_count;  // task-window/heap stalls hit during these submits
+    uint64_t dep_total;          // resolved fanin deps, summed
+    uint32_t dep_max;            // widest single submit
+};
+constexpr int32_t PTO2_SUBMIT_CALLSITE_SLOTS = 64;  // pow2; open addressing
+static PTO2SubmitCallsiteStats g_orch_callsites[PTO2_SUBMIT_CALLSITE_SLOTS] = {};
+static int64_t g_orch_callsite_overflow = 0;  // submits dropped after the table filled
+// Batch submits funnel through pto2_submit_mixed_task, whose return address
+// would collapse every batch entry onto the loop in pto2_submit_task_batch.
+// The batch entry point stashes its own caller here so attribution still
+// reaches the orchestration code.
+static void *g_orch_batch_caller = nullptr;
+
+static void pto2_record_submit_callsite(void *ret_addr, uint64_t cycles, uint64_t stalls, uint32_t dep_count) {
+    uint64_t h = reinterpret_cast<uint64_t>(ret_addr) * 0x9E3779B97F4A7C15ULL;  // Fibonacci hashing
+    uint32_t idx = static_cast<uint32_t>(h >> 32) & (PTO2_SUBMIT_CALLSITE_SLOTS - 1);
+    for (int32_t probe = 0; probe < PTO2_SUBMIT_CALLSITE_SLOTS; probe++) {
+        PTO2SubmitCallsiteStats &s = g_orch_callsites[(idx + probe) & (PTO2_SUBMIT_CALLSITE_SLOTS - 1)];
+        if (s.ret_addr != nullptr && s.ret_addr != ret_addr) {
+            continue;
+        }
+        s.ret_addr = ret_addr;
+        s.call_count++;
+        s.total_cycle += cycles;
+        s.max_cycle = std::max(s.max_cycle, cycles);
+        s.alloc_stall_count += stalls;
+        s.dep_total += dep_count;
+        s.dep_max = std::max(s.dep_max, dep_count);
+        return;
+    }
+    g_orch_callsite_overflow++;
+}
+
+// Allocator stall counters are the per-ring task/heap window stalls already
+// tracked by TaskAllocator; sampling the sum before/after a submit attributes
+// any stall hit inside pto2_prepare_task to the submitting callsite.
+static uint64_t pto2_sum_alloc_stalls(PTO2OrchestratorState *orch) {
+    uint64_t stalls = 0;
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        auto &allocator = orch->rings[r].task_allocator;
+        stalls += allocator.task_stall_count() + allocator.heap_stall_count();
+    }
+    return stalls;
+}
+
+static void pto2_log_submit_callsites() {
+    // Order by total cycles, descending, so the dominating regions lead.
+    PTO2SubmitCallsiteStats *order[PTO2_SUBMIT_CALLSITE_SLOTS];
+    int32_t used = 0;
+    for (int32_t i = 0; i < PTO2_SUBMIT_CALLSITE_SLOTS; i++) {
+        if (g_orch_callsites[i].ret_addr != nullptr) {
+            order[used++] = &g_orch_callsites[i];
+        }
+    }
+    if (used == 0) {
+        return;
+    }
+    for (int32_t i = 1; i < used; i++) {
+        PTO2SubmitCallsiteStats *key = order[i];
+        int32_t j = i - 1;
+        while (j >= 0 && order[j]->total_cycle < key->total_cycle) {
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = key;
+    }
+    LOG_INFO("=== [Orchestrator] submit cost by callsite (%d sites; resolve with addr2line) ===", used);
+    for (int32_t i = 0; i < used; i++) {
+        const PTO2SubmitCallsiteStats &s = *order[i];
+        LOG_INFO(
+            "    %p : calls=%" PRIu64 " total_cycle=%" PRIu64 " avg_cycle=%" PRIu64 " max_cycle=%" PRIu64
+            " alloc_stalls=%" PRIu64 " deps(avg=%.1f max=%u)",
+            s.ret_addr, s.call_count, s.total_cycle, s.total_cycle / s.call_count, s.max_cycle, s.alloc_stall_count,
+            static_cast<double>(s.dep_total) / static_cast<double>(s.call_count), s.dep_max
+        );
+    }
+    if (g_orch_callsite_overflow > 0) {
+        LOG_INFO("    (callsite table full: %" PRId64 " submits unattributed)", g_orch_callsite_overflow);
+    }
+    memset(g_orch_callsites, 0, sizeof(g_orch_callsites));
+    g_orch_callsite_overflow = 0;
+}
+#endif
+
 static void *pto2_aligned_zalloc(size_t size, size_t alignment) {
     void *ptr = nullptr;
     if (posix_memalign(&ptr, alignment, size) != 0) {
         return nullptr;
     }
-    memset(ptr, 0, size);
+    // Callers request cache-line alignment for pools claimed lazily; stream
+    // the zeroes instead of pulling the whole pool through the cache.
+    pto2_mem_zero_nt(ptr, size);
     return ptr;
 }
 
@@ -169,6 +288,16 @@ void pto2_orch_report_fatal(PTO2OrchestratorState *orch, int32_t error_code, con
     va_end(args);
 }
 
+#if PTO2_PROFILING
+// Map a fanin count to its power-of-two histogram bucket (see
+// PTO2_FANIN_HIST_BUCKETS): 0 -> 0, 1 -> 1, 2 -> 2, 3..4 -> 3, 5..8 -> 4, ...
+static inline int32_t pto2_fanin_hist_bucket(int32_t fanin_count) {
+    if (fanin_count <= 0) return 0;
+    int32_t bucket = fanin_count == 1 ? 1 : 2 + (31 - __builtin_clz(fanin_count - 1));
+    return bucket < PTO2_FANIN_HIST_BUCKETS ? bucket : PTO2_FANIN_HIST_BUCKETS - 1;
+}
+#endif
+
 struct PTO2FaninBuilder {
     PTO2TaskSlotState *inline_slots[PTO2_FANIN_INLINE_CAP];
     int32_t count{0};
@@ -241,6 +370,7 @@ static bool pto2_append_fanin_or_fail(
 }
 
 static void scope_tasks_push(PTO2OrchestratorState *orch, PTO2TaskSlotState *task_slot_state);
+static void branch_tasks_push(PTO2OrchBranch *branch, PTO2TaskSlotState *task_slot_state);
 
 struct PTO2OutputLayout {
     uint64_t offsets[MAX_TENSOR_ARGS] = {};
@@ -259,6 +389,24 @@ struct PTO2PreparedTask {
 
 static PTO2OutputLayout pto2_calculate_output_layout(const Arg &args) {
     PTO2OutputLayout layout;
+    // First pass with fine alignment: if the packed total fits the
+    // descriptor's inline area, the allocator serves it from there and the
+    // coarse 1KB per-output padding would only waste inline bytes.
+    for (int32_t i = 0; i < args.tensor_count(); i++) {
+        if (args.tag(i) != TensorArgType::OUTPUT) {
+            continue;
+        }
+        layout.offsets[i] = layout.total_output_size;
+        layout.buffer_sizes[i] =
+            PTO2_ALIGN_UP(args.tensor(i).create_info->buffer_size_bytes(), PTO2_INLINE_OUTPUT_ALIGN);
+        layout.total_output_size += layout.buffer_sizes[i];
+    }
+    if (layout.total_output_size <= PTO2_INLINE_OUTPUT_CAP) {
+        return layout;
+    }
+
+    // Heap-resident: repack with the coarse per-output alignment.
+    layout.total_output_size = 0;
     for (int32_t i = 0; i < args.tensor_count(); i++) {
         if (args.tag(i) != TensorArgType::OUTPUT) {
             continue;
@@ -301,6 +449,8 @@ pto2_check_scope_can_accept_task(PTO2OrchestratorState *orch, PTO2TaskAllocator
     LOG_ERROR("     Runtime env:  PTO2_RING_TASK_WINDOW=<power-of-2>");
     LOG_ERROR("  3. Split work across multiple scopes");
     LOG_ERROR("========================================");
+    pto2_flight_record(PTO2FlightEventType::ABORT, 0, PTO2_ERROR_SCOPE_DEADLOCK, scope_task_count);
+    pto2_flight_dump("scope_deadlock");
     pto2_orch_mark_fatal(orch, PTO2_ERROR_SCOPE_DEADLOCK);
     return false;
 }
@@ -318,13 +468,47 @@ static void pto2_prefetch_payload(PTO2TaskPayload *payload, int32_t tensor_count
     __builtin_prefetch(reinterpret_cast<char *>(payload) + 128, 1, 3);
 }
 
+// Branch counterpart of the scope-deadlock check: every branch task holds a
+// fanout reference until the opening scope ends, so a branch that fills its
+// ring's task window can never reclaim a slot.
+static bool pto2_check_branch_can_accept_task(PTO2OrchBranch *branch, PTO2TaskAllocator &allocator) {
+    if (branch->tasks_size < allocator.window_size() - 1) {
+        return true;
+    }
+    LOG_ERROR("========================================");
+    LOG_ERROR("FATAL: Branch Scope Deadlock Detected! (ring %d)", branch->ring_id);
+    LOG_ERROR("========================================");
+    LOG_ERROR("Tasks in branch (%d) >= task_window_size (%d).", branch->tasks_size, allocator.window_size());
+    LOG_ERROR("Branch tasks are only released when the opening scope ends, so no");
+    LOG_ERROR("slots can be reclaimed -> deadlock. Close and reopen the branch");
+    LOG_ERROR("across scopes, or increase the task window.");
+    pto2_flight_record(PTO2FlightEventType::ABORT, 0, PTO2_ERROR_SCOPE_DEADLOCK, branch->tasks_size);
+    pto2_flight_dump("branch_scope_deadlock");
+    pto2_orch_mark_fatal(branch->orch, PTO2_ERROR_SCOPE_DEADLOCK);
+    return false;
+}
+
 static bool pto2_prepare_task(
-    PTO2OrchestratorState *orch, const Arg &args, int32_t total_output_size, uint8_t active_mask, PTO2PreparedTask *out
+    PTO2OrchestratorState *orch, PTO2OrchBranch *branch, const Arg &args, int32_t total_output_size,
+    uint8_t active_mask, int16_t block_num, PTO2PreparedTask *out
 ) {
-    uint8_t ring_id = orch->current_ring_id();
+    uint8_t ring_id = branch != nullptr ? branch->ring_id : orch->current_ring_id();
     auto &allocator = orch->rings[ring_id].task_allocator;
 
-    if (!pto2_check_scope_can_accept_task(orch, allocator, ring_id)) {
+    if (branch == nullptr) {
+        // The scope-depth ring of a main-thread submit must not collide with
+        // a ring whose allocator is currently owned by an open branch.
+        if (orch->open_branch_count != 0 && orch->ring_claimed[ring_id]) {
+            pto2_orch_report_fatal(
+                orch, PTO2_ERROR_INVALID_ARGS, __FUNCTION__,
+                "main-thread submit targets ring %d which is claimed by an open branch", ring_id
+            );
+            return false;
+        }
+        if (!pto2_check_scope_can_accept_task(orch, allocator, ring_id)) {
+            return false;
+        }
+    } else if (!pto2_check_branch_can_accept_task(branch, allocator)) {
         return false;
     }
 
@@ -347,13 +531,12 @@ static bool pto2_prepare_task(
         PTO2TaskSlotState &slot_state = *out->slot_state;
         slot_state.fanout_head = nullptr;
         slot_state.fanout_lock.store(0, std::memory_order_relaxed);
-        slot_state.fanout_count = 1;
+        slot_state.fanout_count.store(1, std::memory_order_relaxed);
         slot_state.fanout_refcount.store(0, std::memory_order_relaxed);
-        slot_state.fanin_refcount.store(0, std::memory_order_relaxed);
-        slot_state.task_state.store(PTO2_TASK_PENDING, std::memory_order_relaxed);
+        slot_state.state_word.store(0, std::memory_order_relaxed);  // PENDING, fanin counter seeded at wiring
         slot_state.completed_subtasks.store(0, std::memory_order_relaxed);
-        slot_state.subtask_done_mask.store(0, std::memory_order_relaxed);
-        int16_t block_num = args.launch_spec.block_num();
+        slot_state.chain_hint.store(0, std::memory_order_relaxed);
+        slot_state.affinity_cluster = 0;
         slot_state.total_required_subtasks =
             static_cast<int16_t>(block_num * __builtin_popcount(pto2_core_mask(active_mask)));
         slot_state.logical_block_num = block_num;
@@ -362,8 +545,14 @@ static bool pto2_prepare_task(
         slot_state.task = out->task;
         slot_state.active_mask = active_mask;
         slot_state.ring_id = ring_id;
-        // fanin_count is set by scheduler during wiring
-        scope_tasks_push(orch, &slot_state);
+        // remaining-fanin counter is seeded by the scheduler during wiring
+        if (branch != nullptr) {
+            branch_tasks_push(branch, &slot_state);
+        } else {
+            scope_tasks_push(orch, &slot_state);
+        }
+    } else if (branch != nullptr) {
+        branch_tasks_push(branch, nullptr);
     } else {
         scope_tasks_push(orch, nullptr);
     }
@@ -379,7 +568,13 @@ bool pto2_orchestrator_init(
     PTO2OrchestratorState *orch, PTO2SharedMemoryHandle *sm_handle, void *gm_heap, uint64_t heap_size,
     int32_t dep_pool_capacity
 ) {
-    *orch = PTO2OrchestratorState{};
+    // Placement-new instead of assignment: the tensormap shard spinlocks are
+    // std::atomic, which deletes the implicit copy/move assignment.
+    new (orch) PTO2OrchestratorState{};
+
+    pto2_shadow_init_from_env();
+    pto2_submit_trace_init_from_env();
+    pto2_flight_reset();
 
     orch->sm_handle = sm_handle;
     orch->gm_heap_base = gm_heap;
@@ -391,10 +586,13 @@ bool pto2_orchestrator_init(
         void *ring_heap_base = reinterpret_cast<char *>(gm_heap) + r * heap_size;
         auto &fc = sm_handle->header->rings[r].fc;
 
-        // Initialize unified task allocator
+        // Initialize unified task allocator. Ring 0 serves the outermost
+        // scope — the long-lived tensors that pin a rotating ring's tail —
+        // so it runs as a scope arena when PTO2_SCOPE_ARENA is enabled.
         orch->rings[r].task_allocator.init(
             sm_handle->task_descriptors[r], sm_handle->header->rings[r].task_window_size, &fc.current_task_index,
-            &fc.last_task_alive, ring_heap_base, heap_size, &sm_handle->header->orch_error_code
+            &fc.last_task_alive, ring_heap_base, heap_size, &sm_handle->header->orch_error_code, &fc.reclaim_doorbell,
+            /*arena_mode=*/PTO2_SCOPE_ARENA != 0 && r == 0, &sm_handle->header->params
         );
 
         size_t fanin_pool_bytes =
@@ -407,7 +605,10 @@ bool pto2_orchestrator_init(
             }
             return false;
         }
-        orch->rings[r].fanin_pool.init(fanin_entries, dep_pool_capacity, &sm_handle->header->orch_error_code);
+        orch->rings[r].fanin_pool.init(
+            fanin_entries, dep_pool_capacity, &sm_handle->header->orch_error_code,
+            static_cast<int32_t>(sm_handle->header->params.dep_pool_spin_limit)
+        );
     }
 
     // Initialize TensorMap with per-ring task window sizes
@@ -423,14 +624,11 @@ bool pto2_orchestrator_init(
     }
     orch->tensor_map.orch = orch;
 
-    // Initialize scope stack: one flat buffer for task IDs + one array for begin offsets
-    uint64_t max_depth = PTO2_MAX_SCOPE_DEPTH;
+    // Initialize scope stack: one flat buffer for task IDs; the begin-offset
+    // stack is inline (fixed PTO2_MAX_SCOPE_DEPTH) and only needs clearing.
     int32_t init_cap = PTO2_SCOPE_TASKS_INIT_CAP;
     orch->scope_tasks = reinterpret_cast<PTO2TaskSlotState **>(malloc(init_cap * sizeof(PTO2TaskSlotState *)));
-    orch->scope_begins = reinterpret_cast<int32_t *>(malloc(max_depth * sizeof(int32_t)));
-    if (!orch->scope_tasks || !orch->scope_begins) {
-        free(orch->scope_tasks);
-        free(orch->scope_begins);
+    if (!orch->scope_tasks) {
         for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
             free(orch->rings[r].fanin_pool.base);
         }
@@ -439,13 +637,15 @@ bool pto2_orchestrator_init(
     }
     orch->scope_tasks_size = 0;
     orch->scope_tasks_capacity = init_cap;
+    orch->scope_begins.clear();
     orch->scope_stack_top = -1;
-    orch->scope_stack_capacity = max_depth;
 
     return true;
 }
 
 void pto2_orchestrator_destroy(PTO2OrchestratorState *orch) {
+    pto2_submit_trace_close();
+
     orch->tensor_map.destroy();
 
     for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
@@ -455,8 +655,69 @@ void pto2_orchestrator_destroy(PTO2OrchestratorState *orch) {
 
     free(orch->scope_tasks);
     orch->scope_tasks = NULL;
-    free(orch->scope_begins);
-    orch->scope_begins = NULL;
+
+    free(orch->intern_table);
+    orch->intern_table = NULL;
+}
+
+void pto2_orchestrator_reset(PTO2OrchestratorState *orch) {
+    PTO2SharedMemoryHandle *sm_handle = orch->sm_handle;
+    uint64_t heap_size = orch->gm_heap_size / PTO2_MAX_RING_DEPTH;
+
+    pto2_flight_reset();
+
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        void *ring_heap_base = reinterpret_cast<char *>(orch->gm_heap_base) + r * heap_size;
+        auto &fc = sm_handle->header->rings[r].fc;
+
+        // Re-running init on the same resources rewinds every cursor; the
+        // backing allocations are untouched.
+        orch->rings[r].task_allocator.init(
+            sm_handle->task_descriptors[r], sm_handle->header->rings[r].task_window_size, &fc.current_task_index,
+            &fc.last_task_alive, ring_heap_base, heap_size, &sm_handle->header->orch_error_code, &fc.reclaim_doorbell,
+            /*arena_mode=*/PTO2_SCOPE_ARENA != 0 && r == 0, &sm_handle->header->params
+        );
+
+        auto &fanin_pool = orch->rings[r].fanin_pool;
+        fanin_pool.init(fanin_pool.base, fanin_pool.capacity, fanin_pool.error_code_ptr, fanin_pool.spin_limit);
+    }
+
+    orch->tensor_map.reset();
+
+    orch->scope_tasks_size = 0;
+    orch->scope_begins.clear();
+    orch->scope_stack_top = -1;
+
+    // Old intern handles belong to the previous workload; the next one
+    // re-registers its own views into the retained table storage.
+    if (orch->intern_table) {
+        orch->intern_table->count = 0;
+    }
+
+    orch->fatal = false;
+    orch->open_branch_count = 0;
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        orch->ring_claimed[r] = false;
+    }
+    orch->wiring_push_lock.store(0, std::memory_order_relaxed);
+    orch->pipeline_enabled = false;
+    orch->pipeline_rings[0] = 0;
+    orch->pipeline_rings[1] = 0;
+    orch->pipeline_active = 0;
+    orch->inline_completed_tasks = 0;
+
+#if PTO2_PROFILING
+    orch->tasks_submitted = 0;
+    orch->buffers_allocated = 0;
+    orch->bytes_allocated = 0;
+    orch->buffers_donated = 0;
+    orch->bytes_donated = 0;
+    for (int b = 0; b < PTO2_FANIN_HIST_BUCKETS; b++) {
+        orch->fanin_histogram[b] = 0;
+    }
+    orch->fanin_spilled_tasks = 0;
+    orch->fanin_spilled_entries = 0;
+#endif
 }
 
 void pto2_orchestrator_set_scheduler(PTO2OrchestratorState *orch, PTO2SchedulerState *scheduler) {
@@ -467,6 +728,18 @@ void pto2_orchestrator_set_scheduler(PTO2OrchestratorState *orch, PTO2SchedulerS
 // Scope Management
 // =============================================================================
 
+static void branch_tasks_push(PTO2OrchBranch *branch, PTO2TaskSlotState *task_slot_state) {
+    if (branch->tasks_size >= branch->tasks_capacity) {
+        int32_t new_cap = branch->tasks_capacity * 2;
+        PTO2TaskSlotState **new_buf =
+            reinterpret_cast<PTO2TaskSlotState **>(realloc(branch->tasks, new_cap * sizeof(PTO2TaskSlotState *)));
+        assert(new_buf && "Failed to grow branch task buffer");
+        branch->tasks = new_buf;
+        branch->tasks_capacity = new_cap;
+    }
+    branch->tasks[branch->tasks_size++] = task_slot_state;
+}
+
 static void scope_tasks_push(PTO2OrchestratorState *orch, PTO2TaskSlotState *task_slot_state) {
     if (orch->scope_tasks_size >= orch->scope_tasks_capacity) {
         int32_t new_cap = orch->scope_tasks_capacity * 2;
@@ -483,10 +756,15 @@ void pto2_scope_begin(PTO2OrchestratorState *orch) {
     if (orch->fatal) {
         return;
     }
-    assert(orch->scope_stack_top < static_cast<int32_t>(orch->scope_stack_capacity - 1) && "Scope stack overflow");
+    assert(!orch->scope_begins.full() && "Scope stack overflow");
 
     ++orch->scope_stack_top;
-    orch->scope_begins[orch->scope_stack_top] = orch->scope_tasks_size;
+    orch->scope_begins.push_back(orch->scope_tasks_size);
+
+    pto2_flight_record(PTO2FlightEventType::SCOPE_BEGIN, 0, orch->scope_stack_top + 1, 0);
+    if (pto2_submit_trace_active()) {
+        pto2_submit_trace_record_scope(PTO2TraceRecordType::SCOPE_BEGIN);
+    }
 }
 
 void pto2_scope_end(PTO2OrchestratorState *orch) {
@@ -499,7 +777,9 @@ void pto2_scope_end(PTO2OrchestratorState *orch) {
     uint64_t _se0 = get_sys_cnt_aicpu();
 #endif
 
-    int32_t begin = orch->scope_begins[orch->scope_stack_top--];
+    int32_t begin = orch->scope_begins.back();
+    orch->scope_begins.pop_back();
+    orch->scope_stack_top--;
     int32_t count = orch->scope_tasks_size - begin;
 
     if (orch->scheduler && count > 0) {
@@ -509,6 +789,11 @@ void pto2_scope_end(PTO2OrchestratorState *orch) {
     // Rewind the task buffer — these entries are no longer needed
     orch->scope_tasks_size = begin;
 
+    pto2_flight_record(PTO2FlightEventType::SCOPE_END, 0, orch->scope_stack_top + 2, count);
+    if (pto2_submit_trace_active()) {
+        pto2_submit_trace_record_scope(PTO2TraceRecordType::SCOPE_END);
+    }
+
 #if PTO2_ORCH_PROFILING
     uint64_t _se1 = get_sys_cnt_aicpu();
     g_orch_scope_end_cycle += (_se1 - _se0);
@@ -519,10 +804,124 @@ void pto2_scope_end(PTO2OrchestratorState *orch) {
 // =============================================================================
 // Task Submission
 // =============================================================================
-TaskOutputTensors
-pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_kernels, const Arg &args) {
+// Push one wired task to the scheduler. The wiring queue is SPSC; while
+// branches are open every producer (main thread included) serializes through
+// wiring_push_lock. Branch threads always lock — they only exist while
+// open_branch_count is nonzero.
+static void pto2_wiring_push(PTO2OrchestratorState *orch, PTO2SchedulerState *sched, PTO2TaskSlotState *slot_state) {
+    bool locked = orch->open_branch_count != 0;
+    if (locked) {
+        int32_t expected = 0;
+        while (!orch->wiring_push_lock.compare_exchange_weak(
+            expected, 1, std::memory_order_acquire, std::memory_order_relaxed
+        )) {
+            expected = 0;
+            SPIN_WAIT_HINT();
+        }
+    }
+    while (!sched->wiring_queue.push(slot_state)) {
+        SPIN_WAIT_HINT();
+    }
+    if (locked) {
+        orch->wiring_push_lock.store(0, std::memory_order_release);
+    }
+}
+
+/**
+ * Buffer donation (opt-in via PTO2LaunchSpec::set_donate_input): find an
+ * INPUT whose buffer can back this task's single OUTPUT in place of a
+ * fresh heap allocation. Returns the donor's producer slot state, or
+ * nullptr to fall back to normal allocation.
+ *
+ * A donor qualifies when every condition below holds; the first qualifying
+ * INPUT wins:
+ *  - the task has exactly one OUTPUT, without an initial-value fill (the
+ *    fill runs at submit time and would clobber the input before the
+ *    kernel reads it);
+ *  - the INPUT is a full, unshifted view of a runtime-materialized buffer
+ *    (valid owner_task_id) whose logical size matches the output's exactly;
+ *  - the owning slot still holds that task and is not CONSUMED;
+ *  - the producer's fanout_count is still 1 (owning-scope reference only):
+ *    no other consumer was ever wired, and none can appear concurrently
+ *    because donation is restricted to main-thread submits with no open
+ *    branches.
+ *
+ * Lifetime: the donated bytes live in the producer's packed buffer (heap,
+ * inline, or spill), all reclaimed once last_task_alive passes the
+ * producer. The donating task therefore takes one extra fanout reference
+ * on the producer, released only at its own CONSUMED transition (see
+ * check_and_handle_consumed) — pinning the region until every consumer of
+ * the aliased output has finished, not just until the donating kernel ran.
+ */
+static PTO2TaskSlotState *pto2_find_donation_donor(
+    PTO2OrchestratorState *orch, const Arg &args, int32_t *donor_arg_index, int32_t *output_arg_index
+) {
+    PTO2SchedulerState *sched = orch->scheduler;
+    int32_t output_idx = -1;
+    for (int32_t i = 0; i < args.tensor_count(); i++) {
+        if (args.tag(i) != TensorArgType::OUTPUT) {
+            continue;
+        }
+        if (output_idx >= 0) {
+            return nullptr;  // Multiple outputs: ambiguous, allocate normally
+        }
+        output_idx = i;
+    }
+    if (output_idx < 0) {
+        return nullptr;
+    }
+    const TensorCreateInfo *ci = args.tensor(output_idx).create_info;
+    if (ci->has_initial_value) {
+        return nullptr;
+    }
+    uint64_t output_bytes = ci->buffer_size_bytes();
+
+    for (int32_t i = 0; i < args.tensor_count(); i++) {
+        if (args.tag(i) != TensorArgType::INPUT) {
+            continue;
+        }
+        const Tensor *tensor = args.tensor(i).ptr;
+        PTO2TaskId owner = tensor->owner_task_id;
+        if (!owner.is_valid()) {
+            continue;  // External memory is not runtime-owned
+        }
+        // Views that shift or shrink the buffer alias only part of it.
+        if (!tensor->is_all_offset_zero || !tensor->is_raw_eq_shapes) {
+            continue;
+        }
+        if (tensor->numel() * get_element_size(tensor->dtype) != output_bytes) {
+            continue;
+        }
+        PTO2TaskSlotState *prod_state =
+            &sched->ring_sched_states[owner.ring()].get_slot_state_by_task_id(owner.local());
+        // Slot recycled or already retired: the buffer is (or may become) someone else's.
+        if (prod_state->task == nullptr || prod_state->task->task_id.raw != owner.raw) {
+            continue;
+        }
+        if (prod_state->state_word.load(std::memory_order_relaxed) & PTO2_STATE_CONSUMED_BIT) {
+            continue;
+        }
+        if (prod_state->fanout_count.load(std::memory_order_relaxed) != 1) {
+            continue;  // Another consumer already reads this buffer
+        }
+        *donor_arg_index = i;
+        *output_arg_index = output_idx;
+        return prod_state;
+    }
+    return nullptr;
+}
+
+static TaskOutputTensors pto2_submit_mixed_task_impl(
+    PTO2OrchestratorState *orch, PTO2OrchBranch *branch, const MixedKernels &mixed_kernels, const Arg &args
+) {
     CYCLE_COUNT_START();
 
+#if PTO2_ORCH_PROFILING
+    void *submit_caller = g_orch_batch_caller != nullptr ? g_orch_batch_caller : __builtin_return_address(0);
+    uint64_t submit_begin_cycle = _t0;  // CYCLE_COUNT_START timestamp, before laps rewrite it
+    uint64_t submit_stall_base = pto2_sum_alloc_stalls(orch);
+#endif
+
     TaskOutputTensors result;
 
     // Orchestration API should short-circuit after fatal, but keep this entry
@@ -537,6 +936,12 @@ pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_ke
         LOG_ERROR("FATAL: Invalid Arg Detected!");
         LOG_ERROR("========================================");
         LOG_ERROR("Error: %s", args.error_msg ? args.error_msg : "(unknown)");
+        if (args.error_detail != 0) {
+            // Cold path: materialize the operands latched with the error.
+            char detail[256];
+            pto2_status_detail_format(args.error_detail, detail, sizeof(detail));
+            LOG_ERROR("Detail: %s", detail);
+        }
         LOG_ERROR("  tensor_count: %d, scalar_count: %d", args.tensor_count(), args.scalar_count());
         LOG_ERROR("This is a bug in the orchestration code.");
         LOG_ERROR("========================================");
@@ -549,7 +954,8 @@ pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_ke
     always_assert(active_mask != 0 && "MixedKernels must have at least one active slot");
 
     int16_t block_num = args.launch_spec.block_num();
-    always_assert(block_num >= 1 && "block_num must be >= 1");
+    bool block_num_auto = (block_num == PTO2_BLOCK_NUM_AUTO);
+    always_assert((block_num >= 1 || block_num_auto) && "block_num must be >= 1 or PTO2_BLOCK_NUM_AUTO");
 
     // Normalize single-AIV tasks: if only aiv1 is set (no aic, no aiv0), move
     // it to the aiv0 slot.  This guarantees the dispatch path can always use
@@ -566,6 +972,30 @@ pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_ke
         active_mask = pto2_mixed_kernels_to_active_mask(normalized);
     }
 
+#if !PTO2_ENABLE_MIX
+    // Mix-free build: the MIX dispatch lane is compiled out, so a full-cluster
+    // task would sit in its ready queue forever. Fail fast at submit instead.
+    if (pto2_active_mask_to_shape(active_mask) == PTO2ResourceShape::MIX) {
+        pto2_orch_report_fatal(
+            orch, PTO2_ERROR_MIX_NOT_SUPPORTED, __FUNCTION__,
+            "mixed task (active_mask=0x%x) submitted to a PTO2_ENABLE_MIX=0 build", active_mask
+        );
+        return result;
+    }
+#endif
+
+    // Resolve AUTO block_num from the func's measured history (machine width
+    // on the first launch). Resolution precedes the sync-start deadlock check
+    // so the chosen count is validated like an explicit one.
+    if (block_num_auto) {
+        PTO2ResourceShape auto_shape = pto2_active_mask_to_shape(active_mask);
+        int32_t width = (auto_shape == PTO2ResourceShape::AIV) ? orch->total_aiv_count : orch->total_cluster_count;
+        int32_t key = pto2_block_autotune_key(
+            normalized.aic_kernel_id, normalized.aiv0_kernel_id, normalized.aiv1_kernel_id
+        );
+        block_num = pto2_block_autotune_resolve(key, width);
+    }
+
     // Encode require_sync_start into active_mask bit 3 (only meaningful for tasks with block_num > 1)
     if (block_num > 1 && args.launch_spec.require_sync_start()) {
         // Deadlock check: block_num >= total available slots of the required type.
@@ -582,9 +1012,27 @@ pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_ke
         }
         active_mask |= PTO2_SUBTASK_FLAG_SYNC_START;
     }
+    // Encode latency priority into active_mask bit 4 (ready-lane routing)
+    if (args.launch_spec.high_priority()) {
+        active_mask |= PTO2_SUBTASK_FLAG_HIGH_PRIO;
+    }
     PTO2OutputLayout layout = pto2_calculate_output_layout(args);
+
+    // Buffer donation (opt-in): serve the single OUTPUT from a dying INPUT's
+    // buffer and skip the heap allocation. Main-thread submits only — a
+    // concurrently submitting branch could wire a new consumer between the
+    // sole-consumer probe and the fanout bump in STEP 6.
+    PTO2TaskSlotState *donated_producer = nullptr;
+    int32_t donor_arg_idx = -1;
+    int32_t donated_output_idx = -1;
+    if (args.launch_spec.donate_input() && branch == nullptr && orch->open_branch_count == 0 &&
+        orch->scheduler != nullptr) {
+        donated_producer = pto2_find_donation_donor(orch, args, &donor_arg_idx, &donated_output_idx);
+    }
+    int32_t alloc_output_size = donated_producer != nullptr ? 0 : layout.total_output_size;
+
     PTO2PreparedTask prepared;
-    if (!pto2_prepare_task(orch, args, layout.total_output_size, active_mask, &prepared)) {
+    if (!pto2_prepare_task(orch, branch, args, alloc_output_size, active_mask, block_num, &prepared)) {
         return result;
     }
     uint8_t ring_id = prepared.task_id.ring();
@@ -603,9 +1051,14 @@ pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_ke
     CYCLE_COUNT_LAP_RECORD(g_orch_alloc_cycle, AicpuPhaseId::ORCH_ALLOC, task_id.raw);
 
 #if PTO2_PROFILING
-    if (layout.total_output_size > 0) {
-        orch->buffers_allocated++;
-        orch->bytes_allocated += layout.total_output_size;
+    if (branch == nullptr && layout.total_output_size > 0) {
+        if (donated_producer != nullptr) {
+            orch->buffers_donated++;
+            orch->bytes_donated += layout.total_output_size;
+        } else {
+            orch->buffers_allocated++;
+            orch->bytes_allocated += layout.total_output_size;
+        }
     }
 #endif
 
@@ -647,8 +1100,12 @@ pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_ke
             continue;
         }
 
+        // Interned views carry precomputed hash/segment metadata — skip the
+        // per-submit shard/bucket/segment derivation for them.
+        const PTO2TensorHashInfo *hash_info = orch->intern_table ? orch->intern_table->info_of(tensor) : nullptr;
+
         PTO2LookupResult lookup_result;
-        orch->tensor_map.lookup(*tensor, lookup_result);
+        orch->tensor_map.lookup(*tensor, lookup_result, hash_info);
 
         for (int r = 0; r < lookup_result.count; r++) {
             PTO2TensorMapEntry &entry = *lookup_result.entries[r].entry;
@@ -674,8 +1131,11 @@ pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_ke
         for (int i = 0; i < args.tensor_count(); i++) {
             TensorArgType ptype = args.tag(i);
             if (ptype == TensorArgType::INOUT || ptype == TensorArgType::OUTPUT_EXISTING) {
-                if (!args.tensor(i).ptr->manual_dep) {
-                    orch->tensor_map.insert(*args.tensor(i).ptr, task_id);
+                const Tensor *tensor = args.tensor(i).ptr;
+                if (!tensor->manual_dep) {
+                    const PTO2TensorHashInfo *hash_info =
+                        orch->intern_table ? orch->intern_table->info_of(tensor) : nullptr;
+                    orch->tensor_map.insert(*tensor, task_id, hash_info);
                 }
             }
         }
@@ -691,10 +1151,29 @@ pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_ke
     task.kernel_id[static_cast<int>(PTO2SubtaskSlot::AIC)] = normalized.aic_kernel_id;
     task.kernel_id[static_cast<int>(PTO2SubtaskSlot::AIV0)] = normalized.aiv0_kernel_id;
     task.kernel_id[static_cast<int>(PTO2SubtaskSlot::AIV1)] = normalized.aiv1_kernel_id;
+    task.block_dim_x = args.launch_spec.block_dim_x();
+    task.block_num_auto = block_num_auto ? 1 : 0;
+    task.autotune_dispatch_cnt = 0;
     task.packed_buffer_base = prepared.alloc_result.packed_base;
     task.packed_buffer_end = prepared.alloc_result.packed_end;
+    task.scalar_result = static_cast<uint8_t>(args.launch_spec.scalar_result());
+    if (task.scalar_result) {
+        // Empty the mailbox before the task can be dispatched; the reused
+        // slot may hold a predecessor's published flag.
+        task.scalar_mailbox_flag = 0;
+    }
 
-    payload->init(args, result, prepared.alloc_result.packed_base, layout.offsets, layout.buffer_sizes);
+    void *output_base = prepared.alloc_result.packed_base;
+    if (donated_producer != nullptr) {
+        // Alias the output onto the donor's buffer. The descriptor keeps the
+        // (zero-length) ring positions from alloc above so heap tail
+        // derivation stays exact; only the payload's output tensor points at
+        // the donated bytes.
+        const Tensor *donor = args.tensor(donor_arg_idx).ptr;
+        output_base = reinterpret_cast<void *>(donor->buffer.addr);
+        layout.buffer_sizes[donated_output_idx] = donor->buffer.size;
+    }
+    payload->init(args, result, output_base, layout.offsets, layout.buffer_sizes);
 
     // Write owner_task_id into materialized OUTPUT tensors so creator-only dependency
     // tracking remains available even when manual_dep skips OverlapMap publication.
@@ -720,6 +1199,16 @@ pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_ke
         int32_t inline_count = std::min(fanin_count, PTO2_FANIN_INLINE_CAP);
         int32_t spill_count = fanin_count - inline_count;
 
+#if PTO2_PROFILING
+        if (branch == nullptr) {
+            orch->fanin_histogram[pto2_fanin_hist_bucket(fanin_count)]++;
+            if (spill_count > 0) {
+                orch->fanin_spilled_tasks++;
+                orch->fanin_spilled_entries += spill_count;
+            }
+        }
+#endif
+
         // Store fanin metadata in payload for scheduler to iterate
         payload->fanin_actual_count = fanin_count;
         payload->fanin_spill_start = (spill_count > 0) ? fanin_builder.spill_start : 0;
@@ -728,16 +1217,55 @@ pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_ke
             payload->fanin_inline_slot_states[i] = fanin_builder.inline_slots[i];
         }
 
-        // Increment fanout_count on each producer (no lock — only orch writes this field).
-        // Prevents premature CONSUMED: scope_end's release_producer checks fanout_refcount == fanout_count.
+        // Increment fanout_count on each producer. Relaxed fetch_add: only
+        // submitting threads write this field, and parallel branches may hit
+        // one producer concurrently. Prevents premature CONSUMED: scope_end's
+        // release_producer checks fanout_refcount == fanout_count.
         pto2_for_each_fanin_slot_state(*payload, [](PTO2TaskSlotState *producer) {
-            producer->fanout_count += 1;
+            producer->fanout_count.fetch_add(1, std::memory_order_relaxed);
         });
 
-        // Push to global wiring queue — scheduler sets fanin_count, wires fanout, checks readiness
-        while (!sched->wiring_queue.push(&cur_slot_state)) {
-            SPIN_WAIT_HINT();
+        // Donation hold: one extra fanout reference keeps the donor's buffer
+        // mapped until this task's CONSUMED transition releases it — the
+        // consumers of the aliased output read those bytes.
+        payload->donated_producer = donated_producer;
+        if (donated_producer != nullptr) {
+            donated_producer->fanout_count.fetch_add(1, std::memory_order_relaxed);
         }
+
+        // Early input release: arm the completion scan's dispatch-payload
+        // poll only for the shapes it can handle — one core, one logical
+        // block (a multi-block task would need all blocks to agree before
+        // any input is reclaimable) — and only when there are fanins to
+        // release.
+        payload->fanin_early_released = 0;
+        payload->early_input_release = static_cast<uint8_t>(
+            args.launch_spec.early_input_release() && fanin_count > 0 && block_num == 1 &&
+            __builtin_popcount(pto2_core_mask(active_mask)) == 1
+        );
+
+        // Chain-fusion detection: this task's only dependency is a single
+        // producer that (so far) has no other consumer — the classic A→B
+        // linear chain found via the TensorMap lookup above. Mark the
+        // producer so dispatch stages this task into the producer's pending
+        // slot at launch time (back-to-back execution on one core) instead
+        // of waiting for the speculative idle scan to discover the pair.
+        if (orch->enable_chain_fusion && fanin_count == 1 && block_num == 1 &&
+            !pto2_requires_sync_start(active_mask) && __builtin_popcount(pto2_core_mask(active_mask)) == 1) {
+            PTO2TaskSlotState *producer = fanin_builder.inline_slots[0];
+            // A donated producer carries the extra donation hold on top of
+            // the owning-scope reference and this task's fanin.
+            int32_t expected_fanout = producer == donated_producer ? 3 : 2;
+            if (producer->logical_block_num == 1 &&
+                producer->fanout_count.load(std::memory_order_relaxed) == expected_fanout &&
+                __builtin_popcount(pto2_core_mask(producer->active_mask)) == 1 &&
+                pto2_active_mask_to_shape(producer->active_mask) == pto2_active_mask_to_shape(active_mask)) {
+                producer->chain_hint.store(1, std::memory_order_relaxed);
+            }
+        }
+
+        // Push to global wiring queue — scheduler sets fanin_count, wires fanout, checks readiness
+        pto2_wiring_push(orch, sched, &cur_slot_state);
 #if PTO2_ORCH_PROFILING
         g_orch_fanin_atomic_count += 0;  // No lock/atomic ops in submit hot path
 #endif
@@ -746,15 +1274,91 @@ pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_ke
     CYCLE_COUNT_LAP_RECORD(g_orch_fanin_cycle, AicpuPhaseId::ORCH_FANIN, task_id.raw);
 
 #if PTO2_PROFILING
-    orch->tasks_submitted++;
+    if (branch == nullptr) {
+        orch->tasks_submitted++;
+    }
 #if PTO2_ORCH_PROFILING
     g_orch_submit_count++;
+    pto2_record_submit_callsite(
+        submit_caller, get_sys_cnt_aicpu() - submit_begin_cycle, pto2_sum_alloc_stalls(orch) - submit_stall_base,
+        static_cast<uint32_t>(fanin_builder.count)
+    );
 #endif
     g_orch_submit_idx++;
 #endif
+
+    pto2_flight_record(
+        PTO2FlightEventType::TASK_SUBMIT, task_id.raw, mixed_kernels.aic_kernel_id, args.tensor_count()
+    );
+    if (branch != nullptr) {
+        branch->tasks_submitted++;
+    } else if (pto2_submit_trace_active()) {
+        pto2_submit_trace_record_submit(PTO2TraceRecordType::SUBMIT, mixed_kernels, args, result);
+    }
     return result;
 }
 
+TaskOutputTensors
+pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_kernels, const Arg &args) {
+    return pto2_submit_mixed_task_impl(orch, nullptr, mixed_kernels, args);
+}
+
+TaskOutputTensors
+pto2_branch_submit_mixed_task(PTO2OrchBranch *branch, const MixedKernels &mixed_kernels, const Arg &args) {
+    return pto2_submit_mixed_task_impl(branch->orch, branch, mixed_kernels, args);
+}
+
+bool pto2_submit_would_block(PTO2OrchestratorState *orch, const Arg &args) {
+    if (orch->fatal || args.has_error) {
+        // Nothing to wait for: the submit itself will no-op or trip the
+        // fatal path immediately.
+        return false;
+    }
+    PTO2OutputLayout layout = pto2_calculate_output_layout(args);
+    return orch->rings[orch->current_ring_id()].task_allocator.would_block(layout.total_output_size);
+}
+
+bool pto2_try_submit_mixed_task(
+    PTO2OrchestratorState *orch, const MixedKernels &mixed_kernels, const Arg &args, TaskOutputTensors *outputs
+) {
+    // The layout is recomputed inside the submit; the duplicate pass is a
+    // short walk over the Arg tensors, cheap next to the stall it avoids.
+    if (pto2_submit_would_block(orch, args)) {
+        return false;
+    }
+    *outputs = pto2_submit_mixed_task_impl(orch, nullptr, mixed_kernels, args);
+    return true;
+}
+
+void pto2_submit_task_batch(PTO2OrchestratorState *orch, const PTO2TaskBatchEntry entries[], int32_t count) {
+    if (orch->fatal || count <= 0) {
+        return;
+    }
+
+    // All entries of one batch submit into the current scope's ring, so a
+    // single allocator owns the deferred publication for the whole batch.
+    auto &allocator = orch->rings[orch->current_ring_id()].task_allocator;
+    allocator.begin_batch();
+
+#if PTO2_ORCH_PROFILING
+    g_orch_batch_caller = __builtin_return_address(0);
+#endif
+    for (int32_t i = 0; i < count; i++) {
+        TaskOutputTensors outputs = pto2_submit_mixed_task(orch, entries[i].mixed_kernels, *entries[i].args);
+        if (orch->fatal) {
+            break;
+        }
+        if (entries[i].outputs != nullptr) {
+            *entries[i].outputs = outputs;
+        }
+    }
+#if PTO2_ORCH_PROFILING
+    g_orch_batch_caller = nullptr;
+#endif
+
+    allocator.end_batch();
+}
+
 TaskOutputTensors pto2_alloc_tensors(PTO2OrchestratorState *orch, const Arg &args) {
     // Orchestration API should short-circuit after fatal, but keep this entry
     // robust as a no-op in case a caller reaches it directly.
@@ -786,16 +1390,19 @@ TaskOutputTensors pto2_alloc_tensors(PTO2OrchestratorState *orch, const Arg &arg
     CYCLE_COUNT_START();
 
     if (args.has_error) {
+        char detail[256];
+        pto2_status_detail_format(args.error_detail, detail, sizeof(detail));
         pto2_orch_report_fatal(
-            orch, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "%s",
-            args.error_msg ? args.error_msg : "alloc_tensors failed to construct output-only Arg"
+            orch, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "%s%s%s",
+            args.error_msg ? args.error_msg : "alloc_tensors failed to construct output-only Arg",
+            detail[0] != '\0' ? " — " : "", detail
         );
         return TaskOutputTensors{};
     }
 
     PTO2OutputLayout layout = pto2_calculate_output_layout(args);
     PTO2PreparedTask prepared;
-    if (!pto2_prepare_task(orch, args, layout.total_output_size, 0, &prepared)) {
+    if (!pto2_prepare_task(orch, nullptr, args, layout.total_output_size, 0, args.launch_spec.block_num(), &prepared)) {
         return TaskOutputTensors{};
     }
 
@@ -821,6 +1428,10 @@ TaskOutputTensors pto2_alloc_tensors(PTO2OrchestratorState *orch, const Arg &arg
     task.kernel_id[static_cast<int>(PTO2SubtaskSlot::AIC)] = INVALID_KERNEL_ID;
     task.kernel_id[static_cast<int>(PTO2SubtaskSlot::AIV0)] = INVALID_KERNEL_ID;
     task.kernel_id[static_cast<int>(PTO2SubtaskSlot::AIV1)] = INVALID_KERNEL_ID;
+    task.block_dim_x = 0;
+    task.block_num_auto = 0;
+    task.scalar_result = 0;
+    task.autotune_dispatch_cnt = 0;
     task.packed_buffer_base = prepared.alloc_result.packed_base;
     task.packed_buffer_end = prepared.alloc_result.packed_end;
 
@@ -829,6 +1440,9 @@ TaskOutputTensors pto2_alloc_tensors(PTO2OrchestratorState *orch, const Arg &arg
     payload->fanin_actual_count = 0;
     payload->fanin_spill_start = 0;
     payload->fanin_spill_pool = nullptr;
+    payload->donated_producer = nullptr;
+    payload->early_input_release = 0;
+    payload->fanin_early_released = 0;
     for (int32_t i = 0; i < args.tensor_count(); i++) {
         payload->tensors[i].owner_task_id = prepared.task_id;
     }
@@ -844,7 +1458,7 @@ TaskOutputTensors pto2_alloc_tensors(PTO2OrchestratorState *orch, const Arg &arg
         // required so scope_end can release the producer-side reference and
         // drive the slot to CONSUMED, but worker dispatch fields are never
         // observed for hidden alloc tasks.
-        prepared.slot_state->task_state.store(PTO2_TASK_COMPLETED, std::memory_order_release);
+        prepared.slot_state->state_word.fetch_or(PTO2_STATE_COMPLETED_BIT, std::memory_order_release);
     }
     orch->inline_completed_tasks++;
 
@@ -852,15 +1466,190 @@ TaskOutputTensors pto2_alloc_tensors(PTO2OrchestratorState *orch, const Arg &arg
 
 #if PTO2_PROFILING
     orch->tasks_submitted++;
+    orch->fanin_histogram[0]++;
 #if PTO2_ORCH_PROFILING
     g_orch_submit_count++;
 #endif
     g_orch_submit_idx++;
 #endif
 
+    pto2_flight_record(PTO2FlightEventType::TASK_SUBMIT, prepared.task_id.raw, -1, args.tensor_count());
+    if (pto2_submit_trace_active()) {
+        pto2_submit_trace_record_submit(PTO2TraceRecordType::ALLOC_TENSORS, MixedKernels{}, args, outputs);
+    }
     return outputs;
 }
 
+// =============================================================================
+// Parallel Branch Orchestration
+// =============================================================================
+
+bool pto2_orch_branch_open(PTO2OrchestratorState *orch, uint8_t ring_id, PTO2OrchBranch *branch) {
+    always_assert(branch != nullptr);
+    if (orch->fatal) {
+        return false;
+    }
+    always_assert(orch->scope_stack_top >= 0 && "Branches must be opened inside a scope");
+
+    if (ring_id >= PTO2_MAX_RING_DEPTH || orch->ring_claimed[ring_id] || ring_id == orch->current_ring_id()) {
+        pto2_orch_report_fatal(
+            orch, PTO2_ERROR_INVALID_ARGS, __FUNCTION__,
+            "cannot open branch on ring %d (claimed=%d, main ring=%d)", ring_id,
+            ring_id < PTO2_MAX_RING_DEPTH ? orch->ring_claimed[ring_id] : 0, orch->current_ring_id()
+        );
+        return false;
+    }
+
+    new (branch) PTO2OrchBranch{};
+    branch->orch = orch;
+    branch->ring_id = ring_id;
+    branch->open_scope_top = orch->scope_stack_top;
+    branch->tasks_capacity = PTO2_SCOPE_TASKS_INIT_CAP;
+    branch->tasks =
+        reinterpret_cast<PTO2TaskSlotState **>(malloc(branch->tasks_capacity * sizeof(PTO2TaskSlotState *)));
+    if (branch->tasks == nullptr) {
+        pto2_orch_report_fatal(orch, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "branch task buffer allocation failed");
+        return false;
+    }
+
+    orch->ring_claimed[ring_id] = true;
+    orch->open_branch_count++;
+    return true;
+}
+
+void pto2_orch_branch_close(PTO2OrchestratorState *orch, PTO2OrchBranch *branch) {
+    always_assert(branch != nullptr && branch->orch == orch);
+    always_assert(
+        orch->scope_stack_top == branch->open_scope_top &&
+        "Branch must be closed in the scope it was opened in"
+    );
+
+    // Fold branch tasks into the current scope: scope_end's fanout release
+    // now covers them exactly as if they had been submitted on this thread.
+    for (int32_t i = 0; i < branch->tasks_size; i++) {
+        scope_tasks_push(orch, branch->tasks[i]);
+    }
+#if PTO2_PROFILING
+    orch->tasks_submitted += branch->tasks_submitted;
+#endif
+
+    orch->ring_claimed[branch->ring_id] = false;
+    orch->open_branch_count--;
+    free(branch->tasks);
+    branch->tasks = nullptr;
+    branch->tasks_size = 0;
+    branch->tasks_capacity = 0;
+    branch->orch = nullptr;
+}
+
+void pto2_ring_fence(PTO2OrchestratorState *orch, uint8_t ring_id) {
+    always_assert(ring_id < PTO2_MAX_RING_DEPTH);
+    if (orch->scheduler == nullptr || orch->fatal) {
+        return;
+    }
+
+    PTO2RingFlowControl &fc = orch->sm_handle->header->rings[ring_id].fc;
+    int32_t target = fc.current_task_index.load(std::memory_order_acquire);
+    int32_t alive = fc.last_task_alive.load(std::memory_order_acquire);
+    auto &rs = orch->scheduler->ring_sched_states[ring_id];
+
+    // Local ids below last_task_alive are already retired (CONSUMED); walk
+    // the still-live window oldest-first. A slot reclaimed and re-used
+    // mid-wait restarts at PENDING, which only lengthens the wait — the
+    // original occupant must have completed for the slot to recycle.
+    for (int32_t id = alive; id - target < 0; id++) {
+        PTO2TaskSlotState &slot = rs.get_slot_state_by_task_id(id);
+        while (!(slot.state_word.load(std::memory_order_acquire) & PTO2_STATE_COMPLETED_BIT)) {
+            if (orch->fatal) {
+                return;
+            }
+            SPIN_WAIT_HINT();
+        }
+    }
+}
+
+// =============================================================================
+// Ring-Pair Pipelining
+// =============================================================================
+
+bool pto2_orch_pipeline_enable(PTO2OrchestratorState *orch, uint8_t ring_a, uint8_t ring_b) {
+    if (orch->fatal) {
+        return false;
+    }
+    if (ring_a >= PTO2_MAX_RING_DEPTH || ring_b >= PTO2_MAX_RING_DEPTH || ring_a == ring_b ||
+        orch->ring_claimed[ring_a] || orch->ring_claimed[ring_b]) {
+        pto2_orch_report_fatal(
+            orch, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "invalid pipeline ring pair (%d, %d)", ring_a, ring_b
+        );
+        return false;
+    }
+    orch->pipeline_rings[0] = ring_a;
+    orch->pipeline_rings[1] = ring_b;
+    orch->pipeline_active = 0;
+    orch->pipeline_enabled = true;
+    return true;
+}
+
+void pto2_orch_pipeline_swap(PTO2OrchestratorState *orch) {
+    always_assert(orch->pipeline_enabled && "pto2_orch_pipeline_swap outside A/B mode");
+    orch->pipeline_active ^= 1;
+}
+
+void pto2_orch_pipeline_disable(PTO2OrchestratorState *orch) { orch->pipeline_enabled = false; }
+
+// =============================================================================
+// Tensor Interning
+// =============================================================================
+
+int32_t pto2_orchestrator_intern_tensor(PTO2OrchestratorState *orch, const Tensor &tensor) {
+    if (orch->fatal) {
+        return -1;
+    }
+
+    if (orch->intern_table == nullptr) {
+        orch->intern_table = reinterpret_cast<PTO2TensorInternTable *>(
+            pto2_aligned_zalloc(sizeof(PTO2TensorInternTable), PTO2_ALIGN_SIZE)
+        );
+        if (orch->intern_table == nullptr) {
+            pto2_orch_report_fatal(
+                orch, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "failed to allocate tensor intern table"
+            );
+            return -1;
+        }
+    }
+
+    int32_t handle = orch->intern_table->intern(tensor);
+    if (handle < 0) {
+        pto2_orch_report_fatal(
+            orch, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "tensor intern table full (capacity=%d)",
+            PTO2_TENSOR_INTERN_CAP
+        );
+    }
+    return handle;
+}
+
+int32_t pto2_orchestrator_bump_tensor_version(PTO2OrchestratorState *orch, int32_t handle) {
+    int32_t version = orch->intern_table ? orch->intern_table->bump_version(handle) : -1;
+    if (version < 0 && !orch->fatal) {
+        pto2_orch_report_fatal(
+            orch, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "invalid tensor intern handle %d (count=%d)", handle,
+            orch->intern_table ? orch->intern_table->count : 0
+        );
+    }
+    return version;
+}
+
+const Tensor *pto2_orchestrator_interned_tensor(PTO2OrchestratorState *orch, int32_t handle) {
+    const Tensor *tensor = orch->intern_table ? orch->intern_table->view_of(handle) : nullptr;
+    if (tensor == nullptr && !orch->fatal) {
+        pto2_orch_report_fatal(
+            orch, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "invalid tensor intern handle %d (count=%d)", handle,
+            orch->intern_table ? orch->intern_table->count : 0
+        );
+    }
+    return tensor;
+}
+
 // =============================================================================
 // Flow Control
 // =============================================================================
@@ -878,7 +1667,53 @@ void pto2_orchestrator_done(PTO2OrchestratorState *orch) {
                 fanin_pool.tail, fanin_pool.top - fanin_pool.tail, fanin_pool.high_water, fanin_pool.capacity
             );
         }
+        auto &allocator = orch->rings[r].task_allocator;
+        if (allocator.peak_active() > 0) {
+            LOG_INFO(
+                "=== [TaskAllocator %d] peak_tasks=%d/%d peak_heap=%" PRIu64 "/%" PRIu64 " stalls(task=%" PRIu64
+                ", heap=%" PRIu64 ") spills=%" PRIu64 " inline=%" PRIu64 " ===",
+                r, allocator.peak_active(), allocator.window_size(), allocator.peak_heap_used(),
+                allocator.heap_capacity(), allocator.task_stall_count(), allocator.heap_stall_count(),
+                allocator.spill_alloc_count(), allocator.inline_alloc_count()
+            );
+        }
+    }
+#if PTO2_PROFILING
+    if (orch->tasks_submitted > 0) {
+        LOG_INFO(
+            "=== [Fanin] distribution over %" PRId64 " tasks (inline cap %d) ===", orch->tasks_submitted,
+            PTO2_FANIN_INLINE_CAP
+        );
+        int64_t cumulative = 0;
+        for (int b = 0; b < PTO2_FANIN_HIST_BUCKETS; b++) {
+            cumulative += orch->fanin_histogram[b];
+            if (orch->fanin_histogram[b] == 0) continue;
+            LOG_INFO(
+                "    fanin <= %4d : %" PRId64 " tasks (%.1f%% cumulative)", b == 0 ? 0 : 1 << (b - 1),
+                orch->fanin_histogram[b], 100.0 * cumulative / orch->tasks_submitted
+            );
+        }
+        // Smallest power-of-two inline width keeping at least 99% of tasks
+        // spill-free; a run report above the compiled cap means the model
+        // wants a wider PTO2_FANIN_INLINE_CAP.
+        int32_t suggested_cap = 1 << (PTO2_FANIN_HIST_BUCKETS - 2);
+        cumulative = 0;
+        for (int b = 0; b < PTO2_FANIN_HIST_BUCKETS; b++) {
+            cumulative += orch->fanin_histogram[b];
+            if (cumulative * 100 >= orch->tasks_submitted * 99) {
+                suggested_cap = b <= 1 ? 1 : 1 << (b - 1);
+                break;
+            }
+        }
+        LOG_INFO(
+            "    spilled: %" PRId64 " tasks, %" PRId64 " entries; suggested PTO2_FANIN_INLINE_CAP=%d (99%% inline)",
+            orch->fanin_spilled_tasks, orch->fanin_spilled_entries, suggested_cap
+        );
     }
+#endif
+#if PTO2_ORCH_PROFILING
+    pto2_log_submit_callsites();
+#endif
     orch->sm_handle->header->orchestrator_done.store(1, std::memory_order_release);
 #if !PTO2_ORCH_PROFILING && PTO2_PROFILING
     g_orch_submit_idx = 0;
@@ -895,6 +1730,8 @@ void pto2_orchestrator_print_stats(PTO2OrchestratorState *orch) {
     LOG_INFO("Tasks submitted:     %" PRId64, orch->tasks_submitted);
     LOG_INFO("Buffers allocated:   %" PRId64, orch->buffers_allocated);
     LOG_INFO("Bytes allocated:     %" PRId64, orch->bytes_allocated);
+    LOG_INFO("Buffers donated:     %" PRId64, orch->buffers_donated);
+    LOG_INFO("Bytes donated:       %" PRId64, orch->bytes_donated);
 #endif
     LOG_INFO("Current scope depth: %d", orch->scope_stack_top + 1);
     for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
@@ -927,6 +1764,22 @@ void pto2_orchestrator_print_scope_stack(PTO2OrchestratorState *orch) {
     LOG_INFO("==================");
 }
 
+PTO2RingTelemetry pto2_orchestrator_get_ring_telemetry(PTO2OrchestratorState *orch) {
+    PTO2RingTelemetry t = {};
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        auto &allocator = orch->rings[r].task_allocator;
+        t.peak_live_tasks = std::max(t.peak_live_tasks, allocator.peak_active());
+        t.task_window_size = std::max(t.task_window_size, allocator.window_size());
+        t.peak_heap_used = std::max(t.peak_heap_used, allocator.peak_heap_used());
+        t.heap_capacity = std::max(t.heap_capacity, allocator.heap_capacity());
+        t.task_stall_count += allocator.task_stall_count();
+        t.heap_stall_count += allocator.heap_stall_count();
+        t.spill_alloc_count += allocator.spill_alloc_count();
+        t.inline_alloc_count += allocator.inline_alloc_count();
+    }
+    return t;
+}
+
 #if PTO2_ORCH_PROFILING
 PTO2OrchProfilingData pto2_orchestrator_get_profiling() {
     PTO2OrchProfilingData d;
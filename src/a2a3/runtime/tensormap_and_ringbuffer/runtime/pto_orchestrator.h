@@ -28,6 +28,7 @@
 #ifndef PTO_ORCHESTRATOR_H
 #define PTO_ORCHESTRATOR_H
 
+#include "pto_inplace_vector.h"
 #include "pto_ring_buffer.h"
 #include "pto_runtime2_types.h"
 #include "pto_submit_types.h"
@@ -36,6 +37,10 @@
 #include "pto_tensormap.h"
 #include "pto_types.h"
 
+// Fanin histogram buckets: 0, <=1, <=2, <=4, ..., <=2^(BUCKETS-2); the last
+// bucket absorbs everything larger.
+#define PTO2_FANIN_HIST_BUCKETS 12
+
 // =============================================================================
 // Orchestrator State
 // =============================================================================
@@ -55,6 +60,11 @@ struct PTO2OrchestratorState {
     // === TENSOR MAP (Private) ===
     PTO2TensorMap tensor_map;  // Producer lookup
 
+    // === TENSOR INTERN TABLE (Private) ===
+    // Registered views with precomputed hash/segment metadata.
+    // Lazily allocated on first pto2_orchestrator_intern_tensor call.
+    PTO2TensorInternTable *intern_table;
+
     // === SCOPE STACK (Private) ===
     // Single contiguous buffer of task IDs, partitioned by scope level.
     // scope_begins[i] is the index into scope_tasks where scope i starts.
@@ -62,9 +72,11 @@ struct PTO2OrchestratorState {
     PTO2TaskSlotState **scope_tasks;  // Flat buffer of taskSlotState (all scopes concatenated)
     int32_t scope_tasks_size;         // Number of task IDs currently in the buffer
     int32_t scope_tasks_capacity;     // Allocated capacity of scope_tasks
-    int32_t *scope_begins;            // scope_begins[i] = start index of scope i in scope_tasks
-    int32_t scope_stack_top;          // Current top of stack (-1 = no scope open)
-    uint64_t scope_stack_capacity;    // Max nesting depth (PTO2_MAX_SCOPE_DEPTH)
+    // scope_begins[i] = start index of scope i in scope_tasks. Depth is
+    // bounded at compile time, so the stack lives inline — no init-time
+    // allocation and no pointer chase on scope begin/end.
+    PTO2InplaceVectorT<int32_t, PTO2_MAX_SCOPE_DEPTH> scope_begins;
+    int32_t scope_stack_top;  // Current top of stack (-1 = no scope open), == scope_begins.size() - 1
 
     // === SCHEDULER REFERENCE ===
     // Note: In simulated mode, orchestrator and scheduler share address space
@@ -74,6 +86,11 @@ struct PTO2OrchestratorState {
     // Total core counts set once at executor init; used for submit-time deadlock detection.
     int32_t total_cluster_count{0};  // AIC cores = MIX clusters
     int32_t total_aiv_count{0};      // AIV cores (= 2 × clusters on standard hardware)
+
+    // Opt-in chain fusion (PTO2OrchestrationConfig::enable_chain_fusion):
+    // submit marks single-consumer producers so dispatch stages the consumer
+    // into the producer's pending slot at launch time.
+    bool enable_chain_fusion{false};
 #if PTO2_PROFILING
     // Runtime profiling switch copied from Runtime::enable_profiling.
     bool enable_profiling;
@@ -84,9 +101,29 @@ struct PTO2OrchestratorState {
     uint64_t gm_heap_size;  // Total size of GM heap (all rings)
 
     // === FATAL ERROR ===
-    // Fatal error flag (single-thread access by orchestrator, no atomic needed)
-    // Cross-thread notification uses shared memory orch_error_code (atomic)
-    bool fatal;
+    // Fatal error latch. Atomic because parallel orchestration branches can
+    // trip it from their own threads; the detailed code still travels through
+    // the shared memory orch_error_code (first writer wins).
+    std::atomic<bool> fatal;
+
+    // === PARALLEL BRANCHES ===
+    // Nonzero while pto2_orch_branch_open'ed branches exist; routes every
+    // wiring-queue push through wiring_push_lock (the queue is SPSC
+    // otherwise). Written only by the main orchestration thread; branch
+    // threads are created after open and joined before close, so they always
+    // observe it nonzero without synchronization.
+    int32_t open_branch_count{0};
+    bool ring_claimed[PTO2_MAX_RING_DEPTH] = {};  // Ring ownership by an open branch
+    std::atomic<int32_t> wiring_push_lock{0};     // Serializes wiring-queue producers
+
+    // === RING-PAIR PIPELINING ===
+    // A/B mode: while enabled, ring selection ignores scope depth and uses
+    // the active member of a ring pair; pto2_orch_pipeline_swap flips it
+    // between iterations so iteration N+1 submits into one ring while
+    // iteration N's window drains in the other.
+    bool pipeline_enabled{false};
+    uint8_t pipeline_rings[2] = {0, 0};
+    uint8_t pipeline_active{0};
 
     // Hidden alloc tasks complete synchronously inside the orchestrator and
     // therefore bypass the executor's normal worker-completion counter path.
@@ -99,13 +136,30 @@ struct PTO2OrchestratorState {
     int64_t tasks_submitted;
     int64_t buffers_allocated;
     int64_t bytes_allocated;
+    // Heap allocations skipped by aliasing the output onto a dying input
+    // (PTO2LaunchSpec::set_donate_input); bytes count the layout that would
+    // otherwise have been packed.
+    int64_t buffers_donated;
+    int64_t bytes_donated;
+
+    // Fanin distribution in power-of-two buckets: bucket 0 counts zero-fanin
+    // tasks, bucket b >= 1 counts tasks with fanin in (2^(b-2), 2^(b-1)].
+    // Printed with the spill totals at orchestrator_done so
+    // PTO2_FANIN_INLINE_CAP can be tuned per model.
+    int64_t fanin_histogram[PTO2_FANIN_HIST_BUCKETS];
+    int64_t fanin_spilled_tasks;
+    int64_t fanin_spilled_entries;
 #endif
 
     /**
-     * Get current ring index from scope depth.
-     * Maps scope depth to ring_id: min(scope_depth, PTO2_MAX_RING_DEPTH - 1)
+     * Get current ring index.
+     * Ring-pair pipelining overrides the default scope-depth mapping:
+     * min(scope_depth, PTO2_MAX_RING_DEPTH - 1)
      */
     uint8_t current_ring_id() const {
+        if (pipeline_enabled) {
+            return pipeline_rings[pipeline_active];
+        }
         int32_t depth = scope_stack_top;
         if (depth < 0) depth = 0;
         return depth < PTO2_MAX_RING_DEPTH ? static_cast<uint8_t>(depth) : PTO2_MAX_RING_DEPTH - 1;
@@ -135,6 +189,14 @@ bool pto2_orchestrator_init(
  */
 void pto2_orchestrator_destroy(PTO2OrchestratorState *orch);
 
+/**
+ * Return the orchestrator to its post-init empty state without freeing or
+ * reallocating: allocators rewound, tensormap dropped in O(buckets),
+ * pools/scope stack/intern table emptied, fatal latch cleared. Caller must
+ * guarantee no tasks are in flight and no branches are open.
+ */
+void pto2_orchestrator_reset(PTO2OrchestratorState *orch);
+
 /**
  * Set scheduler reference (for simulated mode)
  */
@@ -189,6 +251,49 @@ void pto2_scope_end(PTO2OrchestratorState *orch);
 TaskOutputTensors
 pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_kernels, const Arg &args);
 
+/**
+ * Cheap back-pressure probe: would submitting args on the current ring make
+ * the task allocator spin?
+ *
+ * Computes the packed output layout for args and asks the ring's allocator
+ * without reserving anything. False guarantees the immediately following
+ * submit of the same args commits without an alloc stall (the orchestrator
+ * is single-threaded and the scheduler only frees resources); true is a
+ * hint to submit a ready-independent branch first and retry later.
+ */
+bool pto2_submit_would_block(PTO2OrchestratorState *orch, const Arg &args);
+
+/**
+ * Non-spinning variant of pto2_submit_mixed_task().
+ *
+ * If the current ring's allocator would have to wait for a task slot or
+ * output buffer, returns false without submitting (and without touching
+ * outputs). Otherwise submits and returns true; fatal-path failures inside
+ * the submit still return true with empty outputs, exactly like the
+ * spinning variant — false strictly means "would block, try other work".
+ */
+bool pto2_try_submit_mixed_task(
+    PTO2OrchestratorState *orch, const MixedKernels &mixed_kernels, const Arg &args, TaskOutputTensors *outputs
+);
+
+/**
+ * Submit a batch of tasks with one shared-memory publication.
+ *
+ * Equivalent to calling pto2_submit_mixed_task() per entry, but the task
+ * allocator defers the current_task_index release store until the whole
+ * batch is committed, amortizing the publish/fence cost across the batch.
+ * If allocation blocks mid-batch, already-committed tasks are flushed so
+ * the scheduler can drain them (no added deadlock risk).
+ *
+ * Stops at the first entry that trips the fatal path; remaining entries
+ * are not submitted.
+ *
+ * @param orch     Orchestrator state
+ * @param entries  Array of batch entries (kernels + args + optional outputs)
+ * @param count    Number of entries
+ */
+void pto2_submit_task_batch(PTO2OrchestratorState *orch, const PTO2TaskBatchEntry entries[], int32_t count);
+
 /**
  * Allocate fresh tensors by creating one hidden runtime-owned output task.
  *
@@ -197,6 +302,164 @@ pto2_submit_mixed_task(PTO2OrchestratorState *orch, const MixedKernels &mixed_ke
  */
 TaskOutputTensors pto2_alloc_tensors(PTO2OrchestratorState *orch, const Arg &args);
 
+// =============================================================================
+// Parallel Branch Orchestration
+// =============================================================================
+//
+// Naturally independent branches of a model can submit in parallel: the main
+// thread opens one branch per extra ring, hands each branch to its own
+// thread, and keeps submitting on its own ring. The TensorMap is sharded
+// with per-shard spinlocks and producer fanout bumps are atomic, so
+// cross-ring dependencies are discovered exactly as in single-stream
+// submission — the ring-aware PTO2TaskId in each map entry points back to
+// the producer regardless of which thread submitted it.
+//
+// Protocol (branch misuse trips the fatal path, not UB):
+// 1. Main thread: pto2_orch_branch_open(ring_id) inside an open scope.
+//    The ring must not be the main thread's current ring and each ring can
+//    back at most one open branch (the task allocator is single-owner).
+// 2. Branch thread: pto2_branch_submit_mixed_task() only. Scope begin/end,
+//    batch submit, pto2_alloc_tensors and tensor interning stay on the main
+//    thread.
+// 3. Main thread, after joining the branch thread:
+//    pto2_orch_branch_close() folds the branch's tasks into the scope that
+//    was open at branch open (fanout release at scope_end covers them) and
+//    releases the ring claim.
+//
+// Per-submit statistics other than the submit count are recorded only for
+// main-thread submits; submit tracing skips branch submits.
+
+/**
+ * Thread-owned submission context pinned to one ring.
+ *
+ * Created by pto2_orch_branch_open on the main orchestration thread, then
+ * driven exclusively by a single branch thread until close. Tasks are
+ * recorded branch-locally and folded into the opening scope at close.
+ */
+struct PTO2OrchBranch {
+    PTO2OrchestratorState *orch{nullptr};
+    uint8_t ring_id{0};
+    int32_t open_scope_top{-1};  // Scope stack depth at open; close asserts it is unchanged
+    // Branch-local task list (same growth pattern as the scope task buffer)
+    PTO2TaskSlotState **tasks{nullptr};
+    int32_t tasks_size{0};
+    int32_t tasks_capacity{0};
+    int64_t tasks_submitted{0};
+};
+
+/**
+ * Open a branch pinned to ring_id. Main orchestration thread only; must be
+ * called inside an open scope.
+ *
+ * @return true on success; false (with the fatal latch set) if the ring is
+ *         out of range, already claimed, or the main thread's current ring
+ */
+bool pto2_orch_branch_open(PTO2OrchestratorState *orch, uint8_t ring_id, PTO2OrchBranch *branch);
+
+/**
+ * Submit a task on the branch's ring. Branch thread only.
+ *
+ * Semantics match pto2_submit_mixed_task; the task joins the scope that was
+ * open when the branch was opened.
+ */
+TaskOutputTensors
+pto2_branch_submit_mixed_task(PTO2OrchBranch *branch, const MixedKernels &mixed_kernels, const Arg &args);
+
+/**
+ * Close a branch. Main orchestration thread only, after the branch thread
+ * has been joined. Folds the branch's tasks into the current scope and
+ * releases the ring claim.
+ */
+void pto2_orch_branch_close(PTO2OrchestratorState *orch, PTO2OrchBranch *branch);
+
+/**
+ * Cross-ring fence: block until every task submitted on ring_id before the
+ * call has completed execution (reached COMPLETED or later).
+ *
+ * Lightweight join for ordering that is not expressible through tensors:
+ * snapshots the ring's submission watermark and spin-waits each still-live
+ * slot below it. Fence a ring only after its owning thread has stopped
+ * submitting — a slot retired and re-used mid-fence extends the wait to the
+ * new occupant.
+ */
+void pto2_ring_fence(PTO2OrchestratorState *orch, uint8_t ring_id);
+
+// =============================================================================
+// Ring-Pair Pipelining
+// =============================================================================
+//
+// Without pipelining, consecutive iterations at one scope depth share a
+// ring: the next iteration's first allocation blocks until the previous
+// iteration's tasks retire (last_task_alive converging on
+// current_task_index), serializing the drain tail into the step. In A/B
+// mode the orchestration swaps rings between iterations, so iteration N+1
+// fills one window while iteration N drains the other. The scheduler
+// already services every ring; this is purely submission-side policy.
+//
+// Typical iteration loop:
+//
+//   pto2_orch_pipeline_enable(orch, 2, 3);
+//   for (...) {
+//       PTO2_SCOPE(rt) { /* submit iteration */ }
+//       pto2_orch_pipeline_swap(orch);
+//   }
+//   pto2_orch_pipeline_disable(orch);
+//
+// Back-pressure is unchanged: returning to a ring still waits for whatever
+// of its previous iteration has not retired — by then overlapped with a
+// whole iteration of execution.
+
+/**
+ * Enter A/B mode on a distinct ring pair; submissions start on ring_a.
+ * Main orchestration thread only; the rings must not be claimed by open
+ * branches (claims are also re-checked per submit).
+ *
+ * @return true on success; false (with the fatal latch set) on an invalid
+ *         or claimed pair
+ */
+bool pto2_orch_pipeline_enable(PTO2OrchestratorState *orch, uint8_t ring_a, uint8_t ring_b);
+
+/**
+ * Swap the active ring of the pair. Call between iterations, outside the
+ * iteration's scope.
+ */
+void pto2_orch_pipeline_swap(PTO2OrchestratorState *orch);
+
+/**
+ * Leave A/B mode and return to the scope-depth ring mapping.
+ */
+void pto2_orch_pipeline_disable(PTO2OrchestratorState *orch);
+
+// =============================================================================
+// Tensor Interning
+// =============================================================================
+
+/**
+ * Register a tensor view for handle-based submission.
+ *
+ * Copies the view into the intern table and precomputes its TensorMap
+ * hash/segment metadata, so every subsequent submit referencing the
+ * interned view skips the per-submit derivation.  Lazily allocates the
+ * table on first call.
+ *
+ * @return Handle (>= 0), or -1 on table overflow (marks orchestrator fatal)
+ */
+int32_t pto2_orchestrator_intern_tensor(PTO2OrchestratorState *orch, const Tensor &tensor);
+
+/**
+ * Bump the version of a registered view (per-slice version stream).
+ *
+ * @return New version (> 0), or -1 for an invalid handle (marks fatal)
+ */
+int32_t pto2_orchestrator_bump_tensor_version(PTO2OrchestratorState *orch, int32_t handle);
+
+/**
+ * Resolve an interned handle to its stable Tensor.
+ *
+ * @return Interned view, or nullptr for an invalid handle (marks fatal)
+ */
+const Tensor *pto2_orchestrator_interned_tensor(PTO2OrchestratorState *orch, int32_t handle);
+
 // =============================================================================
 // Flow Control
 // =============================================================================
@@ -222,6 +485,31 @@ void pto2_orchestrator_print_stats(PTO2OrchestratorState *orch);
  */
 void pto2_orchestrator_print_scope_stack(PTO2OrchestratorState *orch);
 
+// =============================================================================
+// Ring Telemetry
+// =============================================================================
+
+/**
+ * Aggregated task/heap ring high-water data, for right-sizing window_size and
+ * heap_size. Peaks are the maximum across rings; stall and spill counts are
+ * summed (rings share uniform sizing by default).
+ */
+struct PTO2RingTelemetry {
+    int32_t peak_live_tasks;    // Peak concurrent live tasks in any ring window
+    int32_t task_window_size;   // Per-ring task window capacity
+    uint64_t peak_heap_used;    // Peak heap ring occupancy in bytes (any ring)
+    uint64_t heap_capacity;     // Per-ring heap ring capacity in bytes
+    uint64_t task_stall_count;  // alloc() calls that blocked on a full task window
+    uint64_t heap_stall_count;  // alloc() calls that blocked on heap exhaustion
+    uint64_t spill_alloc_count; // Allocations served from the emergency spill segment
+    uint64_t inline_alloc_count; // Small outputs served from descriptor inline storage
+};
+
+/**
+ * Collect ring telemetry across all rings (does not reset counters).
+ */
+PTO2RingTelemetry pto2_orchestrator_get_ring_telemetry(PTO2OrchestratorState *orch);
+
 // =============================================================================
 // Orchestrator Profiling Data
 // =============================================================================
@@ -64,7 +64,7 @@ void PTO2FaninPool::ensure_space(PTO2SchedulerState &sched, PTO2RingFlowControl
             prev_last_alive = cur_last_alive;
         }
 
-        if (spin_count >= PTO2_DEP_POOL_SPIN_LIMIT) {
+        if (spin_count >= spin_limit) {
             int32_t current = fc.current_task_index.load(std::memory_order_acquire);
             LOG_ERROR("========================================");
             LOG_ERROR("FATAL: Fanin Spill Pool Deadlock Detected! (ring %d)", ring_id);
@@ -89,6 +89,7 @@ void PTO2FaninPool::ensure_space(PTO2SchedulerState &sched, PTO2RingFlowControl
             LOG_ERROR("  Compile-time: PTO2_DEP_LIST_POOL_SIZE in pto_runtime2_types.h");
             LOG_ERROR("  Runtime env:  PTO2_RING_DEP_POOL=%d", high_water * 2);
             LOG_ERROR("========================================");
+            pto2_flight_dump("fanin_pool_deadlock");
             exit(1);
         }
         SPIN_WAIT_HINT();
@@ -128,7 +129,7 @@ void PTO2DepListPool::ensure_space(
             prev_last_alive = cur_last_alive;
         }
 
-        if (spin_count >= PTO2_DEP_POOL_SPIN_LIMIT) {
+        if (spin_count >= spin_limit) {
             int32_t current = fc.current_task_index.load(std::memory_order_acquire);
             LOG_ERROR("========================================");
             LOG_ERROR("FATAL: Dependency Pool Deadlock Detected! (ring %d)", ring_id);
@@ -153,6 +154,7 @@ void PTO2DepListPool::ensure_space(
             LOG_ERROR("  Compile-time: PTO2_DEP_LIST_POOL_SIZE in pto_runtime2_types.h");
             LOG_ERROR("  Runtime env:  PTO2_RING_DEP_POOL=%d", high_water * 2);
             LOG_ERROR("========================================");
+            pto2_flight_dump("dep_pool_deadlock");
             exit(1);
         }
         SPIN_WAIT_HINT();
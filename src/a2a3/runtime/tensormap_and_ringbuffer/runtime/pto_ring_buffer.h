@@ -17,6 +17,14 @@
  *    - Combines task ring (slot allocation) and heap ring (output buffer allocation)
  *    - Single spin-wait loop with unified back-pressure and deadlock detection
  *    - O(1) bump allocation for both task slots and heap buffers
+ *    - High-water telemetry (peak live tasks, peak heap occupancy, stall counts)
+ *      for right-sizing window_size and heap_size
+ *    - Emergency spill segment carved from the top of the heap: when the ring
+ *      cannot serve a request because the oldest live task pins the tail, the
+ *      allocator falls back to the spill segment instead of spinning into the
+ *      deadlock limit. The segment is itself a small rotating ring with
+ *      incremental reclamation, so degraded mode sustains steady-state
+ *      throughput rather than hitting a second cliff when the segment fills
  *
  * 2. FaninPool - Fanin spill entry allocation
  *    - Ring buffer for spilled fanin entries
@@ -25,7 +33,7 @@
  *
  * 3. DepListPool - Dependency list entry allocation
  *    - Ring buffer for linked list entries
- *    - O(1) prepend operation
+ *    - O(1) contiguous run allocation (per-producer fanout chunks)
  *    - Implicit reclamation with task ring
  *
  * Based on: docs/RUNTIME_LOGIC.md
@@ -38,8 +46,10 @@
 #include <inttypes.h>
 #include <type_traits>
 
+#include "pto_flight_recorder.h"
 #include "pto_runtime2_types.h"
 #include "pto_shared_memory.h"
+#include "pto_sm_shadow.h"
 #include "common/unified_log.h"
 
 struct PTO2SchedulerState;  // Forward declaration for dep_pool reclaim
@@ -54,9 +64,47 @@ struct PTO2SchedulerState;  // Forward declaration for dep_pool reclaim
 // Alloc spin limit - after this, report deadlock and exit
 #define PTO2_ALLOC_SPIN_LIMIT 100000
 
+// Tight-spin budget before the alloc wait switches to doorbell polling
+#define PTO2_ALLOC_TIGHT_SPIN 256
+// Max pause-loop iterations per doorbell poll (exponential backoff cap)
+#define PTO2_ALLOC_BACKOFF_MAX 64
+
 // Dep pool spin limit - if exceeded, dep pool capacity too small for workload
 #define PTO2_DEP_POOL_SPIN_LIMIT 100000
 
+// Fraction of the heap reserved as the emergency spill segment: spill size is
+// heap_size / PTO2_HEAP_SPILL_DIV. Define as 0 to disable spilling and give the
+// ring the full heap.
+#ifndef PTO2_HEAP_SPILL_DIV
+#define PTO2_HEAP_SPILL_DIV 8
+#endif
+
+// Fruitless spins blocked on the heap before the allocator falls back to the
+// spill segment. Short enough to beat the deadlock limit by a wide margin,
+// long enough that transient back-pressure is still absorbed by reclamation.
+#ifndef PTO2_ALLOC_SPILL_SPIN
+#define PTO2_ALLOC_SPILL_SPIN 4096
+#endif
+
+// Depth of the spill reclamation FIFO: (task_id, end offset) pairs recorded
+// per spill allocation so the spill ring's tail advances as spill tasks
+// retire. When more than this many spill allocations are live at once the
+// extras go unrecorded; their space returns via the next recorded retirement
+// (retirement is in task order) or the wholesale reset.
+#ifndef PTO2_SPILL_FIFO_DEPTH
+#define PTO2_SPILL_FIFO_DEPTH 64
+#endif
+
+// Scope-aware arena for the outermost ring. Ring 0 holds the outer scope's
+// long-lived tensors — exactly the allocations that pin a rotating heap
+// ring's tail and back-pressure everything behind them. With the arena
+// enabled, ring 0's heap becomes a non-rotating bump arena reclaimed
+// wholesale once the outer scope's tasks drain; rings 1+ keep rotating.
+// Define as 0 to restore rotating-ring behavior on all depths.
+#ifndef PTO2_SCOPE_ARENA
+#define PTO2_SCOPE_ARENA 1
+#endif
+
 // =============================================================================
 // Task Allocator (unified task slot + heap buffer allocation)
 // =============================================================================
@@ -67,8 +115,8 @@ struct PTO2SchedulerState;  // Forward declaration for dep_pool reclaim
 struct PTO2TaskAllocResult {
     int32_t task_id;    // Absolute task ID (not wrapped), -1 on failure
     int32_t slot;       // task_id & (window_size - 1)
-    void *packed_base;  // Heap allocation result (nullptr if output_size == 0)
-    void *packed_end;   // packed_base + aligned output_size
+    void *packed_base;  // Output buffer (heap, descriptor inline area, or spill)
+    void *packed_end;   // Heap ring position for tail derivation (base + size for heap allocs)
 
     bool failed() const { return task_id < 0; }
 };
@@ -90,7 +138,9 @@ public:
      */
     void init(
         PTO2TaskDescriptor *descriptors, int32_t window_size, std::atomic<int32_t> *current_index_ptr,
-        std::atomic<int32_t> *last_alive_ptr, void *heap_base, uint64_t heap_size, std::atomic<int32_t> *error_code_ptr
+        std::atomic<int32_t> *last_alive_ptr, void *heap_base, uint64_t heap_size, std::atomic<int32_t> *error_code_ptr,
+        std::atomic<uint32_t> *doorbell_ptr = nullptr, bool arena_mode = false,
+        const PTO2RuntimeParams *params = nullptr
     ) {
         descriptors_ = descriptors;
         window_size_ = window_size;
@@ -98,12 +148,48 @@ public:
         current_index_ptr_ = current_index_ptr;
         last_alive_ptr_ = last_alive_ptr;
         heap_base_ = heap_base;
-        heap_size_ = heap_size;
+        arena_mode_ = arena_mode;
+        // Carve the emergency spill segment off the top of the heap; the ring
+        // gets the (aligned) remainder as its primary capacity. An arena never
+        // wraps, so it already degrades like the spill segment — give it the
+        // full heap instead.
+#if PTO2_HEAP_SPILL_DIV > 0
+        uint64_t spill_target = arena_mode ? 0 : heap_size / PTO2_HEAP_SPILL_DIV;
+#else
+        uint64_t spill_target = 0;
+#endif
+        heap_size_ = (heap_size - spill_target) & ~static_cast<uint64_t>(PTO2_ALIGN_SIZE - 1);
+        spill_base_ = static_cast<char *>(heap_base) + heap_size_;
+        spill_size_ = heap_size - heap_size_;
+        spill_top_ = 0;
+        spill_tail_ = 0;
+        spill_fifo_head_ = 0;
+        spill_fifo_count_ = 0;
+        last_spill_task_id_ = -1;
         error_code_ptr_ = error_code_ptr;
+        doorbell_ptr_ = doorbell_ptr;
         local_task_id_ = current_index_ptr->load(std::memory_order_relaxed);
         heap_top_ = 0;
         heap_tail_ = 0;
         last_alive_seen_ = 0;
+        peak_active_ = 0;
+        peak_heap_used_ = 0;
+        task_stall_count_ = 0;
+        heap_stall_count_ = 0;
+        spill_alloc_count_ = 0;
+        inline_alloc_count_ = 0;
+        // Resolve spin/notify knobs once: host-set params override the
+        // compile-time macros, zero fields keep them (see PTO2RuntimeParams).
+        notify_interval_ = params && params->block_notify_interval > 0
+                               ? static_cast<int32_t>(params->block_notify_interval)
+                               : PTO2_BLOCK_NOTIFY_INTERVAL;
+        alloc_spin_limit_ = params && params->alloc_spin_limit > 0 ? static_cast<int32_t>(params->alloc_spin_limit)
+                                                                   : PTO2_ALLOC_SPIN_LIMIT;
+        tight_spin_ = params && params->alloc_tight_spin > 0 ? static_cast<int32_t>(params->alloc_tight_spin)
+                                                             : PTO2_ALLOC_TIGHT_SPIN;
+        backoff_max_ = params && params->alloc_backoff_max > 0 ? params->alloc_backoff_max : PTO2_ALLOC_BACKOFF_MAX;
+        spill_spin_ = params && params->alloc_spill_spin > 0 ? static_cast<int32_t>(params->alloc_spill_spin)
+                                                             : PTO2_ALLOC_SPILL_SPIN;
     }
 
     /**
@@ -117,10 +203,14 @@ public:
      * @return Allocation result; check failed() for errors
      */
     PTO2TaskAllocResult alloc(int32_t output_size) {
+        // Small outputs live inline in the descriptor slot: no heap bump, no
+        // heap back-pressure. The heap ring sees them as zero-size.
+        bool use_inline = output_size > 0 && output_size <= PTO2_INLINE_OUTPUT_CAP;
         uint64_t aligned_size =
-            output_size > 0 ? PTO2_ALIGN_UP(static_cast<uint64_t>(output_size), PTO2_ALIGN_SIZE) : 0;
+            !use_inline && output_size > 0 ? PTO2_ALIGN_UP(static_cast<uint64_t>(output_size), PTO2_ALIGN_SIZE) : 0;
 
         int spin_count = 0;
+        uint32_t backoff = 1;
         int32_t prev_last_alive = last_alive_ptr_->load(std::memory_order_acquire);
         int32_t last_alive = prev_last_alive;
         update_heap_tail(last_alive);
@@ -136,11 +226,40 @@ public:
                 void *heap_ptr = try_bump_heap(aligned_size);
                 if (heap_ptr) {
                     int32_t task_id = commit_task();
+                    record_high_water(last_alive);
 #if PTO2_ORCH_PROFILING
                     record_wait(spin_count, wait_start, waiting);
 #endif
+                    if (use_inline) {
+                        // packed_end keeps the heap ring position (heap_ptr ==
+                        // heap_base_ + heap_top_, nothing was bumped) so tail
+                        // derivation from this task stays exact.
+                        inline_alloc_count_++;
+                        return {task_id, task_id & window_mask_, descriptors_[task_id & window_mask_].inline_output,
+                                heap_ptr};
+                    }
                     return {task_id, task_id & window_mask_, heap_ptr, static_cast<char *>(heap_ptr) + aligned_size};
                 }
+                // Heap ring can't serve the request (tail pinned by the oldest
+                // live task). After a grace period, fall back to the spill
+                // segment: a slowdown instead of a deadlock.
+                if (spin_count >= spill_spin_) {
+                    void *spill_ptr = try_bump_spill(aligned_size);
+                    if (spill_ptr) {
+                        int32_t task_id = commit_task();
+                        last_spill_task_id_ = task_id;
+                        record_spill_task(task_id);
+                        spill_alloc_count_++;
+                        record_high_water(last_alive);
+#if PTO2_ORCH_PROFILING
+                        record_wait(spin_count, wait_start, waiting);
+#endif
+                        return {
+                            task_id, task_id & window_mask_, spill_ptr,
+                            static_cast<char *>(spill_ptr) + aligned_size
+                        };
+                    }
+                }
                 blocked_on_heap = true;
             } else {
                 blocked_on_heap = false;
@@ -148,20 +267,53 @@ public:
 
             // Spin: wait for scheduler to advance last_task_alive
             spin_count++;
+            if (spin_count == 1) {
+                if (blocked_on_heap) {
+                    heap_stall_count_++;
+                } else {
+                    task_stall_count_++;
+                }
+                pto2_flight_record(
+                    PTO2FlightEventType::ALLOC_STALL, 0, output_size, blocked_on_heap ? 1 : 0
+                );
+            }
+            // Mid-batch back-pressure: flush deferred publications so the
+            // scheduler can see (and retire) tasks committed so far.
+            if (publish_deferred_) {
+                current_index_ptr_->store(local_task_id_, std::memory_order_release);
+            }
 #if PTO2_ORCH_PROFILING
             if (!waiting) {
                 wait_start = get_sys_cnt_aicpu();
                 waiting = true;
             }
 #endif
+            // Adaptive wait: after the tight-spin budget, poll the reclaim
+            // doorbell with an exponentially growing pause window. The doorbell
+            // only changes when the scheduler actually advanced last_task_alive,
+            // so the expensive acquire re-checks coincide with real progress
+            // instead of burning the AICPU thread's issue slots.
+            if (spin_count >= tight_spin_ && doorbell_ptr_ != nullptr) {
+                uint32_t seen = doorbell_ptr_->load(std::memory_order_acquire);
+                for (uint32_t i = 0; i < backoff; i++) {
+                    SPIN_WAIT_HINT();
+                    if (doorbell_ptr_->load(std::memory_order_relaxed) != seen) {
+                        break;
+                    }
+                }
+                if (backoff < backoff_max_) {
+                    backoff <<= 1;
+                }
+            }
             last_alive = last_alive_ptr_->load(std::memory_order_acquire);
             update_heap_tail(last_alive);
             if (last_alive > prev_last_alive) {
                 spin_count = 0;
+                backoff = 1;
                 prev_last_alive = last_alive;
             } else {
 #if PTO2_SPIN_VERBOSE_LOGGING
-                if (spin_count % PTO2_BLOCK_NOTIFY_INTERVAL == 0) {
+                if (spin_count % notify_interval_ == 0) {
                     LOG_WARN(
                         "[TaskAllocator] BLOCKED: tasks=%d/%d, heap=%" PRIu64 "/%" PRIu64 ", on=%s, spins=%d",
                         local_task_id_ - last_alive, window_size_, heap_top_, heap_size_,
@@ -169,7 +321,7 @@ public:
                     );
                 }
 #endif
-                if (spin_count >= PTO2_ALLOC_SPIN_LIMIT) {
+                if (spin_count >= alloc_spin_limit_) {
                     report_deadlock(output_size, blocked_on_heap);
                     return {-1, -1, nullptr, nullptr};
                 }
@@ -178,6 +330,67 @@ public:
         }
     }
 
+    /**
+     * Cheap non-committing probe: would alloc(output_size) have to wait?
+     *
+     * Refreshes last_task_alive and the derived heap tail (the same state
+     * alloc() polls) and answers from local counters without reserving
+     * anything. The orchestrator is the only allocator and the scheduler
+     * only ever frees resources, so a false return guarantees the next
+     * alloc() of the same size commits without spinning; a true return can
+     * turn false at any moment as tasks retire, so callers should treat it
+     * as "do other useful work first", not as a stable state.
+     *
+     * The emergency spill segment is deliberately not counted: it sits
+     * behind a spin grace period as a deadlock escape, not a resource that
+     * cooperative callers should plan against.
+     */
+    bool would_block(int32_t output_size) {
+        bool use_inline = output_size > 0 && output_size <= PTO2_INLINE_OUTPUT_CAP;
+        uint64_t aligned_size =
+            !use_inline && output_size > 0 ? PTO2_ALIGN_UP(static_cast<uint64_t>(output_size), PTO2_ALIGN_SIZE) : 0;
+        int32_t last_alive = last_alive_ptr_->load(std::memory_order_acquire);
+        update_heap_tail(last_alive);
+        if (local_task_id_ - last_alive + 1 >= window_size_) {
+            return true;
+        }
+        if (aligned_size == 0) {
+            return false;
+        }
+        // Mirror try_bump_heap's accept conditions without moving heap_top_.
+        if (arena_mode_) {
+            return heap_size_ - heap_top_ < aligned_size;
+        }
+        if (heap_top_ >= heap_tail_) {
+            return heap_size_ - heap_top_ < aligned_size && heap_tail_ <= aligned_size;
+        }
+        return heap_tail_ - heap_top_ <= aligned_size;
+    }
+
+    // =========================================================================
+    // Batched publish control
+    // =========================================================================
+
+    /**
+     * Defer shared-memory publication of current_task_index until end_batch().
+     *
+     * Used by pto2_submit_task_batch() so a run of submits pays the release
+     * store (and its fence on hardware) once instead of once per task.
+     * If alloc() blocks mid-batch, pending tasks are flushed automatically so
+     * the scheduler can drain them and advance last_task_alive.
+     */
+    void begin_batch() { publish_deferred_ = true; }
+
+    /**
+     * Publish all tasks committed since begin_batch() and resume per-task
+     * publication.
+     */
+    void end_batch() {
+        publish_deferred_ = false;
+        current_index_ptr_->store(local_task_id_, std::memory_order_release);
+        pto2_shadow_on_publish(current_index_ptr_, local_task_id_, last_alive_ptr_, window_size_);
+    }
+
     // =========================================================================
     // Task descriptor accessors
     // =========================================================================
@@ -198,6 +411,9 @@ public:
     int32_t window_size() const { return window_size_; }
 
     uint64_t heap_available() const {
+        if (arena_mode_) {
+            return heap_size_ - heap_top_;
+        }
         uint64_t tail = heap_tail_;
         if (heap_top_ >= tail) {
             uint64_t at_end = heap_size_ - heap_top_;
@@ -210,6 +426,15 @@ public:
     uint64_t heap_top() const { return heap_top_; }
     uint64_t heap_capacity() const { return heap_size_; }
 
+    // --- High-water telemetry (for right-sizing window_size / heap_size) ---
+    int32_t peak_active() const { return peak_active_; }
+    uint64_t peak_heap_used() const { return peak_heap_used_; }
+    uint64_t task_stall_count() const { return task_stall_count_; }
+    uint64_t heap_stall_count() const { return heap_stall_count_; }
+    uint64_t spill_alloc_count() const { return spill_alloc_count_; }
+    uint64_t spill_capacity() const { return spill_size_; }
+    uint64_t inline_alloc_count() const { return inline_alloc_count_; }
+
 private:
     // --- Task Ring ---
     PTO2TaskDescriptor *descriptors_ = nullptr;
@@ -221,15 +446,52 @@ private:
     // --- Heap ---
     void *heap_base_ = nullptr;
     uint64_t heap_size_ = 0;
+    // Scope arena mode (ring 0 with PTO2_SCOPE_ARENA): the heap is a
+    // non-rotating bump arena reclaimed wholesale when all tasks drain.
+    bool arena_mode_ = false;
+
+    // --- Emergency spill segment (top of the heap, small rotating ring) ---
+    void *spill_base_ = nullptr;
+    uint64_t spill_size_ = 0;
+    uint64_t spill_top_ = 0;
+    uint64_t spill_tail_ = 0;
+    int32_t last_spill_task_id_ = -1;  // Highest task served from spill (-1 = none live)
+
+    // Spill reclamation FIFO: each recorded spill allocation maps its task id
+    // to the spill ring offset reached after it; popping a retired entry
+    // advances spill_tail_ there. In-order task retirement makes skipping
+    // unrecorded (FIFO-full) allocations safe — any recorded entry that
+    // retires subsumes every earlier unrecorded one.
+    int32_t spill_fifo_task_[PTO2_SPILL_FIFO_DEPTH];
+    uint64_t spill_fifo_end_[PTO2_SPILL_FIFO_DEPTH];
+    int32_t spill_fifo_head_ = 0;
+    int32_t spill_fifo_count_ = 0;
 
     // --- Local state (single-writer, no atomics needed) ---
     int32_t local_task_id_ = 0;    // Next task ID to allocate
     uint64_t heap_top_ = 0;        // Current heap allocation pointer
     uint64_t heap_tail_ = 0;       // Heap reclamation pointer (derived from consumed tasks)
     int32_t last_alive_seen_ = 0;  // last_task_alive at last heap_tail derivation
+    bool publish_deferred_ = false;  // begin_batch() active: skip per-commit publish
+
+    // --- Telemetry (cumulative since init) ---
+    int32_t peak_active_ = 0;         // Peak concurrent live tasks
+    uint64_t peak_heap_used_ = 0;     // Peak heap ring occupancy in bytes
+    uint64_t task_stall_count_ = 0;   // alloc() calls that blocked on a full task window
+    uint64_t heap_stall_count_ = 0;   // alloc() calls that blocked on heap exhaustion
+    uint64_t spill_alloc_count_ = 0;  // Allocations served from the spill segment
+    uint64_t inline_alloc_count_ = 0;  // Small outputs served from descriptor inline storage
+
+    // --- Spin/notify tuning (resolved once at init, see PTO2RuntimeParams) ---
+    int32_t notify_interval_ = PTO2_BLOCK_NOTIFY_INTERVAL;
+    int32_t alloc_spin_limit_ = PTO2_ALLOC_SPIN_LIMIT;
+    int32_t tight_spin_ = PTO2_ALLOC_TIGHT_SPIN;
+    uint32_t backoff_max_ = PTO2_ALLOC_BACKOFF_MAX;
+    int32_t spill_spin_ = PTO2_ALLOC_SPILL_SPIN;
 
     // --- Shared ---
     std::atomic<int32_t> *error_code_ptr_ = nullptr;
+    std::atomic<uint32_t> *doorbell_ptr_ = nullptr;  // Scheduler reclaim-progress signal
 
     // =========================================================================
     // Internal helpers
@@ -241,7 +503,10 @@ private:
      */
     int32_t commit_task() {
         int32_t task_id = local_task_id_++;
-        current_index_ptr_->store(local_task_id_, std::memory_order_release);
+        if (!publish_deferred_) {
+            current_index_ptr_->store(local_task_id_, std::memory_order_release);
+            pto2_shadow_on_publish(current_index_ptr_, local_task_id_, last_alive_ptr_, window_size_);
+        }
         return task_id;
     }
 
@@ -250,15 +515,48 @@ private:
      *
      * Every task has a valid packed_buffer_end (equal to packed_buffer_base
      * for zero-size allocations), so the last consumed task always determines
-     * the correct heap_tail — no backward scan needed.
+     * the correct heap_tail — no backward scan needed. If the last consumed
+     * task was served from the spill segment, its buffer carries no heap ring
+     * position and the tail keeps its previous (conservative) value.
      */
     void update_heap_tail(int32_t last_alive) {
         if (last_alive <= last_alive_seen_) return;
         last_alive_seen_ = last_alive;
 
+        // Arena: no incremental tail. A long-lived tensor anywhere in the
+        // arena cannot pin later allocations; the whole arena resets at once
+        // when the scope drains (every committed task consumed).
+        if (arena_mode_) {
+            if (last_alive >= local_task_id_) {
+                heap_top_ = 0;
+            }
+            return;
+        }
+
+        // Incremental spill reclamation: pop FIFO entries whose task has been
+        // consumed, advancing the spill tail to each retired task's end.
+        while (spill_fifo_count_ > 0 && spill_fifo_task_[spill_fifo_head_] < last_alive) {
+            spill_tail_ = spill_fifo_end_[spill_fifo_head_];
+            spill_fifo_head_ = (spill_fifo_head_ + 1) % PTO2_SPILL_FIFO_DEPTH;
+            spill_fifo_count_--;
+        }
+        // Once every task served from the spill segment has been consumed,
+        // the whole segment is reclaimed at once (also drains any allocations
+        // that went unrecorded while the FIFO was full).
+        if (last_spill_task_id_ >= 0 && last_alive > last_spill_task_id_) {
+            spill_top_ = 0;
+            spill_tail_ = 0;
+            spill_fifo_head_ = 0;
+            spill_fifo_count_ = 0;
+            last_spill_task_id_ = -1;
+        }
+
         PTO2TaskDescriptor &desc = descriptors_[(last_alive - 1) & window_mask_];
-        heap_tail_ =
+        uint64_t tail =
             static_cast<uint64_t>(static_cast<char *>(desc.packed_buffer_end) - static_cast<char *>(heap_base_));
+        if (tail <= heap_size_) {
+            heap_tail_ = tail;
+        }
     }
 
     /**
@@ -271,6 +569,17 @@ private:
         if (alloc_size == 0) {
             return static_cast<char *>(heap_base_) + top;
         }
+        if (arena_mode_) {
+            if (heap_size_ - top < alloc_size) {
+                LOG_DEBUG(
+                    "try_bump_heap failed (arena): top=%" PRIu64 ", alloc=%" PRIu64 ", heap_size=%" PRIu64, top,
+                    alloc_size, heap_size_
+                );
+                return nullptr;
+            }
+            heap_top_ = top + alloc_size;
+            return static_cast<char *>(heap_base_) + top;
+        }
         uint64_t tail = heap_tail_;
         void *result;
 
@@ -311,6 +620,74 @@ private:
         return result;
     }
 
+    /**
+     * Allocate from the emergency spill segment — a small rotating ring with
+     * the same wrap discipline as the main heap, reclaimed incrementally as
+     * spill tasks retire (see the FIFO in update_heap_tail).
+     * Returns nullptr if the segment is disabled, full, or too small.
+     */
+    void *try_bump_spill(uint64_t alloc_size) {
+        if (alloc_size == 0 || spill_size_ == 0) {
+            return nullptr;
+        }
+        uint64_t top = spill_top_;
+        uint64_t tail = spill_tail_;
+        void *result;
+        if (top >= tail) {
+            if (spill_size_ - top >= alloc_size) {
+                result = static_cast<char *>(spill_base_) + top;
+                spill_top_ = top + alloc_size;
+            } else if (tail > alloc_size) {
+                result = spill_base_;
+                spill_top_ = alloc_size;
+            } else {
+                return nullptr;
+            }
+        } else {
+            if (tail - top > alloc_size) {
+                result = static_cast<char *>(spill_base_) + top;
+                spill_top_ = top + alloc_size;
+            } else {
+                return nullptr;
+            }
+        }
+        LOG_WARN(
+            "[TaskAllocator] Heap ring full, spilling %" PRIu64 " bytes (spill top=%" PRIu64 " tail=%" PRIu64
+            " size=%" PRIu64 ")",
+            alloc_size, spill_top_, spill_tail_, spill_size_
+        );
+        return result;
+    }
+
+    /**
+     * Record a spill allocation for incremental reclamation. Best-effort:
+     * when the FIFO is full the entry is dropped and the allocation's space
+     * returns with the next recorded retirement or the wholesale reset.
+     */
+    void record_spill_task(int32_t task_id) {
+        if (spill_fifo_count_ >= PTO2_SPILL_FIFO_DEPTH) {
+            return;
+        }
+        int32_t idx = (spill_fifo_head_ + spill_fifo_count_) % PTO2_SPILL_FIFO_DEPTH;
+        spill_fifo_task_[idx] = task_id;
+        spill_fifo_end_[idx] = spill_top_;
+        spill_fifo_count_++;
+    }
+
+    /**
+     * Update peak-occupancy telemetry after a successful commit.
+     */
+    void record_high_water(int32_t last_alive) {
+        int32_t active = local_task_id_ - last_alive;
+        if (active > peak_active_) {
+            peak_active_ = active;
+        }
+        uint64_t used = heap_top_ >= heap_tail_ ? heap_top_ - heap_tail_ : heap_size_ - (heap_tail_ - heap_top_);
+        if (used > peak_heap_used_) {
+            peak_heap_used_ = used;
+        }
+    }
+
 #if PTO2_ORCH_PROFILING
     void record_wait(int spin_count, uint64_t wait_start, bool waiting) {
         if (waiting) {
@@ -339,7 +716,7 @@ private:
             LOG_ERROR("FATAL: Task Allocator Deadlock - Task Ring Full!");
         }
         LOG_ERROR("========================================");
-        LOG_ERROR("No progress after %d spins.", PTO2_ALLOC_SPIN_LIMIT);
+        LOG_ERROR("No progress after %d spins.", alloc_spin_limit_);
         LOG_ERROR(
             "  Task ring:  current=%d, last_alive=%d, active=%d/%d (%.1f%%)", local_task_id_, last_alive, active_tasks,
             window_size_, 100.0 * active_tasks / window_size_
@@ -348,6 +725,20 @@ private:
             "  Heap ring:  top=%" PRIu64 ", tail=%" PRIu64 ", size=%" PRIu64 ", available=%" PRIu64, heap_top_, htail,
             heap_size_, heap_available()
         );
+        LOG_ERROR(
+            "  High water: peak_tasks=%d/%d, peak_heap=%" PRIu64 "/%" PRIu64 ", stalls(task=%" PRIu64 ", heap=%" PRIu64
+            "), spills=%" PRIu64 ", inline=%" PRIu64,
+            peak_active_, window_size_, peak_heap_used_, heap_size_, task_stall_count_, heap_stall_count_,
+            spill_alloc_count_, inline_alloc_count_
+        );
+        if (spill_size_ > 0) {
+            uint64_t spill_used =
+                spill_top_ >= spill_tail_ ? spill_top_ - spill_tail_ : spill_size_ - (spill_tail_ - spill_top_);
+            LOG_ERROR(
+                "  Spill ring: used=%" PRIu64 "/%" PRIu64 " (top=%" PRIu64 ", tail=%" PRIu64 "), live entries=%d",
+                spill_used, spill_size_, spill_top_, spill_tail_, spill_fifo_count_
+            );
+        }
         if (heap_blocked) {
             LOG_ERROR("  Requested:  %d bytes", requested_output_size);
         }
@@ -365,14 +756,20 @@ private:
             );
             LOG_ERROR("  Compile-time: PTO2_HEAP_SIZE in pto_runtime2_types.h");
             LOG_ERROR("  Runtime env:  PTO2_RING_HEAP=<power-of-2 bytes> (e.g. %" PRIu64 ")", heap_size_ * 2);
+            if (arena_mode_) {
+                LOG_ERROR("  This ring is a scope arena (bump-only, wholesale reclaim);");
+                LOG_ERROR("  PTO2_SCOPE_ARENA=0 restores rotating-ring reclamation on ring 0.");
+            }
         } else {
             LOG_ERROR("  Increase task window size (current: %d, recommended: %d)", window_size_, active_tasks * 2);
             LOG_ERROR("  Compile-time: PTO2_TASK_WINDOW_SIZE in pto_runtime2_types.h");
             LOG_ERROR("  Runtime env:  PTO2_RING_TASK_WINDOW=<power-of-2> (e.g. %d)", active_tasks * 2);
         }
         LOG_ERROR("========================================");
+        int32_t code = heap_blocked ? PTO2_ERROR_HEAP_RING_DEADLOCK : PTO2_ERROR_FLOW_CONTROL_DEADLOCK;
+        pto2_flight_record(PTO2FlightEventType::ABORT, 0, code, requested_output_size);
+        pto2_flight_dump(heap_blocked ? "heap_ring_deadlock" : "task_ring_deadlock");
         if (error_code_ptr_) {
-            int32_t code = heap_blocked ? PTO2_ERROR_HEAP_RING_DEADLOCK : PTO2_ERROR_FLOW_CONTROL_DEADLOCK;
             error_code_ptr_->store(code, std::memory_order_release);
         }
     }
@@ -398,16 +795,21 @@ struct PTO2FaninPool {
     int32_t tail;                    // Linear first-alive counter (entries before this are dead)
     int32_t high_water;              // Peak concurrent usage (top - tail)
     int32_t reclaim_task_cursor{0};  // Last task id scanned for reclaim on this pool
+    int32_t spin_limit{PTO2_DEP_POOL_SPIN_LIMIT};  // ensure_space deadlock threshold
 
     std::atomic<int32_t> *error_code_ptr = nullptr;
 
-    void init(PTO2FaninSpillEntry *in_base, int32_t in_capacity, std::atomic<int32_t> *in_error_code_ptr) {
+    void init(
+        PTO2FaninSpillEntry *in_base, int32_t in_capacity, std::atomic<int32_t> *in_error_code_ptr,
+        int32_t in_spin_limit = 0
+    ) {
         base = in_base;
         capacity = in_capacity;
         top = 1;
         tail = 1;
         high_water = 0;
         reclaim_task_cursor = 0;
+        spin_limit = in_spin_limit > 0 ? in_spin_limit : PTO2_DEP_POOL_SPIN_LIMIT;
         base[0].slot_state = nullptr;
         error_code_ptr = in_error_code_ptr;
     }
@@ -542,9 +944,11 @@ inline PTO2FaninForEachReturn<Fn> pto2_for_each_fanin_slot_state(const PTO2TaskP
 /**
  * Dependency list pool structure
  *
- * True ring buffer for allocating linked list entries.
- * Entries are reclaimed when their producer tasks become CONSUMED,
- * as tracked by the orchestrator via dep_pool_mark per task.
+ * True ring buffer for allocating linked list entries. Entries are handed
+ * out as contiguous per-producer runs (see PTO2_DEP_CHUNK_MIN/MAX) so a
+ * producer's completion walk is a linear scan rather than a pointer chase
+ * over scattered nodes. Entries are reclaimed when the task whose wiring
+ * allocated them becomes CONSUMED, as tracked via dep_pool_mark per task.
  *
  * Linear counters (top, tail) grow monotonically; the physical index
  * is obtained via modulo: base[linear_index % capacity].
@@ -556,6 +960,7 @@ struct PTO2DepListPool {
     int32_t tail;               // Linear first-alive counter (entries before this are dead)
     int32_t high_water;         // Peak concurrent usage (top - tail)
     int32_t last_reclaimed{0};  // last_task_alive at last successful reclamation
+    int32_t spin_limit{PTO2_DEP_POOL_SPIN_LIMIT};  // ensure_space deadlock threshold
 
     // Error code pointer for fatal error reporting (→ sm_header->orch_error_code)
     std::atomic<int32_t> *error_code_ptr = nullptr;
@@ -563,16 +968,21 @@ struct PTO2DepListPool {
     /**
      *
      * Initialize dependency list pool
-     * @param base      Pool base address from shared memory
-     * @param capacity  Total number of entries
+     * @param base           Pool base address from shared memory
+     * @param capacity       Total number of entries
+     * @param in_spin_limit  ensure_space deadlock threshold (0 = compile-time default)
      */
-    void init(PTO2DepListEntry *in_base, int32_t in_capacity, std::atomic<int32_t> *in_error_code_ptr) {
+    void init(
+        PTO2DepListEntry *in_base, int32_t in_capacity, std::atomic<int32_t> *in_error_code_ptr,
+        int32_t in_spin_limit = 0
+    ) {
         base = in_base;
         capacity = in_capacity;
         top = 1;   // Start from 1, 0 means NULL/empty
         tail = 1;  // Match initial top (no reclaimable entries yet)
         high_water = 0;
         last_reclaimed = 0;
+        spin_limit = in_spin_limit > 0 ? in_spin_limit : PTO2_DEP_POOL_SPIN_LIMIT;
 
         // Initialize entry 0 as NULL marker
         base[0].slot_state = nullptr;
@@ -598,17 +1008,25 @@ struct PTO2DepListPool {
     void ensure_space(PTO2SchedulerState &sched, PTO2RingFlowControl &fc, uint8_t ring_id, int32_t needed);
 
     /**
-     * Allocate a single entry from the pool (single-thread per pool instance)
+     * Allocate a contiguous run of `count` entries (single-thread per pool instance).
+     *
+     * Runs never straddle the physical wrap-around boundary: when fewer than
+     * `count` entries remain before the end of the backing array, the remainder
+     * is skipped as padding. The pad is covered by the same dep_pool_mark as the
+     * run itself, so it is reclaimed with the ring like any other entries.
      *
-     * @return Pointer to allocated entry, or nullptr on fatal error
+     * @param count  Number of contiguous entries (must be <= capacity)
+     * @return Pointer to the first entry of the run, or nullptr on fatal error
      */
-    PTO2DepListEntry *alloc() {
+    PTO2DepListEntry *alloc_run(int32_t count) {
+        int32_t idx = top % capacity;
+        int32_t pad = (idx + count > capacity) ? (capacity - idx) : 0;
         int32_t used = top - tail;
-        if (used >= capacity) {
+        if (used + pad + count > capacity) {
             LOG_ERROR("========================================");
             LOG_ERROR("FATAL: Dependency Pool Overflow!");
             LOG_ERROR("========================================");
-            LOG_ERROR("DepListPool exhausted: %d entries alive (capacity=%d).", used, capacity);
+            LOG_ERROR("DepListPool exhausted: %d entries alive (capacity=%d, run=%d).", used, capacity, count);
             LOG_ERROR("  - Pool top:      %d (linear)", top);
             LOG_ERROR("  - Pool tail:     %d (linear)", tail);
             LOG_ERROR("  - High water:    %d", high_water);
@@ -622,11 +1040,12 @@ struct PTO2DepListPool {
             }
             return nullptr;
         }
-        int32_t idx = top % capacity;
-        top++;
-        used++;
+        top += pad;
+        int32_t run_idx = top % capacity;
+        top += count;
+        used += pad + count;
         if (used > high_water) high_water = used;
-        return &base[idx];
+        return &base[run_idx];
     }
 
     /**
@@ -639,23 +1058,6 @@ struct PTO2DepListPool {
         }
     }
 
-    /**
-     * Prepend a task ID to a dependency list
-     *
-     * O(1) operation: allocates new entry and links to current head.
-     *
-     * @param current_head  Current list head offset (0 = empty list)
-     * @param task_slot     Task slot to prepend
-     * @return New head offset
-     */
-    PTO2DepListEntry *prepend(PTO2DepListEntry *cur, PTO2TaskSlotState *slot_state) {
-        PTO2DepListEntry *new_entry = alloc();
-        if (!new_entry) return nullptr;
-        new_entry->slot_state = slot_state;
-        new_entry->next = cur;
-        return new_entry;
-    }
-
     /**
      * Get entry by offset
      */
@@ -28,6 +28,7 @@
 
 #include "aicpu/device_time.h"
 #include "common/unified_log.h"
+#include "runtime.h"  // RUNTIME_MAX_WORKER (device-enqueue ring count)
 
 // Weak fallback for HOST .so builds (never called, but satisfies linker).
 // The AICPU build links the strong symbol from platform/.../device_time.cpp.
@@ -46,6 +47,38 @@ static TaskOutputTensors alloc_tensors_impl(PTO2Runtime *rt, const Arg &args) {
     return pto2_alloc_tensors(&rt->orchestrator, args);
 }
 
+static void submit_task_batch_impl(PTO2Runtime *rt, const PTO2TaskBatchEntry entries[], int32_t count) {
+    pto2_submit_task_batch(&rt->orchestrator, entries, count);
+}
+
+static int32_t intern_tensor_impl(PTO2Runtime *rt, const Tensor &tensor) {
+    return pto2_orchestrator_intern_tensor(&rt->orchestrator, tensor);
+}
+
+static const Tensor *interned_tensor_impl(PTO2Runtime *rt, int32_t handle) {
+    return pto2_orchestrator_interned_tensor(&rt->orchestrator, handle);
+}
+
+static int32_t bump_tensor_version_impl(PTO2Runtime *rt, int32_t handle) {
+    return pto2_orchestrator_bump_tensor_version(&rt->orchestrator, handle);
+}
+
+static bool submit_would_block_impl(PTO2Runtime *rt, const Arg &args) {
+    return pto2_submit_would_block(&rt->orchestrator, args);
+}
+
+static bool try_submit_task_impl(
+    PTO2Runtime *rt, const MixedKernels &mixed_kernels, const Arg &args, TaskOutputTensors *outputs
+) {
+    return pto2_try_submit_mixed_task(&rt->orchestrator, mixed_kernels, args, outputs);
+}
+
+static void profiling_set_enabled_impl(PTO2Runtime *rt, bool enabled) {
+    // Single shared gate: the orchestrator folds it into _prof_active per
+    // submit and scheduler threads into their cached flag per loop iteration.
+    rt->sm_handle->header->profiling_gate.store(enabled ? 1u : 0u, std::memory_order_release);
+}
+
 void pto2_rt_scope_begin(PTO2Runtime *rt) { pto2_scope_begin(&rt->orchestrator); }
 
 void pto2_rt_scope_end(PTO2Runtime *rt) { pto2_scope_end(&rt->orchestrator); }
@@ -67,21 +100,18 @@ void pto2_rt_report_fatal(PTO2Runtime *rt, int32_t error_code, const char *func,
     va_end(args);
 }
 
-// Wait for all producers of this tensor to be safe for data access.
-// Checks owner metadata (lifecycle anchor) and OverlapMap (modifier writers).
-// For reads: wait until each producer COMPLETED (done writing).
-// For writes: also wait until all consumers done reading
-//   (fanout_refcount >= fanout_count - 1, excluding scope reference).
-// Uses cycle-based timeout (checked every 1024 spins).
-// Returns false on timeout (sets orch.fatal).
-MAYBE_UNINITIALIZED_BEGIN
-static bool wait_for_tensor_ready(PTO2Runtime *rt, const Tensor &tensor, bool wait_for_consumers, const char *caller) {
-    PTO2OrchestratorState &orch = rt->orchestrator;
+// Max producer slots per tensor: one creator slot + up to
+// PTO2_LOOKUP_MAX_RESULTS modifier slots.
+constexpr int PTO2_MAX_TENSOR_PRODUCERS = PTO2_LOOKUP_MAX_RESULTS + 1;
 
-    // Collect producer slot states from both maps, deduplicated by pointer.
-    // +1: one creator slot + up to PTO2_LOOKUP_MAX_RESULTS modifier slots.
-    constexpr int kMaxWait = PTO2_LOOKUP_MAX_RESULTS + 1;
-    PTO2TaskSlotState *slots[kMaxWait];
+// Collect producer slot states for a tensor from both maps, deduplicated by
+// pointer: the creator (owner metadata, lifecycle anchor) plus modifier
+// writers (OverlapMap lookup).  Shared by the blocking wait and the
+// non-blocking readiness probe.
+static int collect_producer_slots(
+    PTO2Runtime *rt, const Tensor &tensor, PTO2TaskSlotState *slots[PTO2_MAX_TENSOR_PRODUCERS]
+) {
+    PTO2OrchestratorState &orch = rt->orchestrator;
     int slot_count = 0;
 
     // Step A: creator retention — read owner directly from tensor metadata
@@ -91,8 +121,9 @@ static bool wait_for_tensor_ready(PTO2Runtime *rt, const Tensor &tensor, bool wa
     }
 
     // Step B: modifier writer lookup (OverlapMap)
+    const PTO2TensorHashInfo *hash_info = orch.intern_table ? orch.intern_table->info_of(&tensor) : nullptr;
     PTO2LookupResult lookup_result;
-    orch.tensor_map.lookup(tensor, lookup_result);
+    orch.tensor_map.lookup(tensor, lookup_result, hash_info);
     for (int r = 0; r < lookup_result.count; r++) {
         PTO2TaskId pid = lookup_result.entries[r].entry->producer_task_id;
         PTO2TaskSlotState *s = &rt->scheduler.ring_sched_states[pid.ring()].get_slot_state_by_task_id(pid.local());
@@ -103,11 +134,28 @@ static bool wait_for_tensor_ready(PTO2Runtime *rt, const Tensor &tensor, bool wa
                 break;
             }
         }
-        if (!already && slot_count < kMaxWait) {
+        if (!already && slot_count < PTO2_MAX_TENSOR_PRODUCERS) {
             slots[slot_count++] = s;
         }
     }
 
+    return slot_count;
+}
+
+// Wait for all producers of this tensor to be safe for data access.
+// Checks owner metadata (lifecycle anchor) and OverlapMap (modifier writers).
+// For reads: wait until each producer COMPLETED (done writing).
+// For writes: also wait until all consumers done reading
+//   (fanout_refcount >= fanout_count - 1, excluding scope reference).
+// Uses cycle-based timeout (checked every 1024 spins).
+// Returns false on timeout (sets orch.fatal).
+MAYBE_UNINITIALIZED_BEGIN
+static bool wait_for_tensor_ready(PTO2Runtime *rt, const Tensor &tensor, bool wait_for_consumers, const char *caller) {
+    PTO2OrchestratorState &orch = rt->orchestrator;
+
+    PTO2TaskSlotState *slots[PTO2_MAX_TENSOR_PRODUCERS];
+    int slot_count = collect_producer_slots(rt, tensor, slots);
+
     // Signal scheduler: orchestrator is about to block, bypass wiring backoff
     bool signaled = slot_count > 0 && orch.scheduler;
     if (signaled) {
@@ -122,7 +170,7 @@ static bool wait_for_tensor_ready(PTO2Runtime *rt, const Tensor &tensor, bool wa
 
         uint64_t t0 = get_sys_cnt_aicpu();
         int32_t spin_count = 0;
-        while (slot.task_state.load(std::memory_order_acquire) < PTO2_TASK_COMPLETED) {
+        while (!(slot.state_word.load(std::memory_order_acquire) & PTO2_STATE_COMPLETED_BIT)) {
             SPIN_WAIT_HINT();
             if ((++spin_count & 1023) == 0 && get_sys_cnt_aicpu() - t0 > PTO2_TENSOR_DATA_TIMEOUT_CYCLES) {
                 if (signaled) {
@@ -140,7 +188,8 @@ static bool wait_for_tensor_ready(PTO2Runtime *rt, const Tensor &tensor, bool wa
         if (wait_for_consumers) {
             t0 = get_sys_cnt_aicpu();
             spin_count = 0;
-            while (slot.fanout_refcount.load(std::memory_order_acquire) < slot.fanout_count - 1) {
+            while (slot.fanout_refcount.load(std::memory_order_acquire) <
+                   slot.fanout_count.load(std::memory_order_relaxed) - 1) {
                 SPIN_WAIT_HINT();
                 if ((++spin_count & 1023) == 0 && get_sys_cnt_aicpu() - t0 > PTO2_TENSOR_DATA_TIMEOUT_CYCLES) {
                     if (signaled) {
@@ -187,6 +236,80 @@ uint64_t pto2_get_tensor_data(PTO2Runtime *rt, const Tensor &tensor, uint32_t nd
     return result;
 }
 
+uint64_t pto2_read_scalar(PTO2Runtime *rt, const Tensor &result_tensor) {
+    PTO2OrchestratorState &orch = rt->orchestrator;
+
+    PTO2TaskId owner = result_tensor.owner_task_id;
+    if (!owner.is_valid()) {
+        pto2_orch_report_fatal(
+            &orch, PTO2_ERROR_INVALID_ARGS, __FUNCTION__,
+            "read_scalar: tensor has no owner task (external tensor?); mailbox reads need a submitted task's output"
+        );
+        return 0;
+    }
+
+    PTO2TaskDescriptor *desc = rt->scheduler.ring_sched_states[owner.ring()].get_slot_state_by_task_id(owner.local()).task;
+    if (desc->scalar_result == 0 || desc->task_id.raw != owner.raw) {
+        pto2_orch_report_fatal(
+            &orch, PTO2_ERROR_INVALID_ARGS, __FUNCTION__,
+            "read_scalar: task (ring=%d, local=%d) was not submitted with set_scalar_result() "
+            "or its window slot has been reused",
+            (int)owner.ring(), (int)owner.local()
+        );
+        return 0;
+    }
+
+    // Signal scheduler: orchestrator is blocking on this task, bypass
+    // wiring backoff (same contract as wait_for_tensor_ready).
+    bool signaled = orch.scheduler != nullptr;
+    if (signaled) {
+        orch.scheduler->orch_needs_drain.store(true, std::memory_order_release);
+    }
+
+    // Spin on the mailbox line only: the kernel's publish makes the flag
+    // (and the value sharing its line) visible at cacheline-transfer
+    // latency, well before the completion path processes the task.
+    uint64_t t0 = get_sys_cnt_aicpu();
+    int32_t spin_count = 0;
+    while (desc->scalar_mailbox_flag == 0) {
+        SPIN_WAIT_HINT();
+        if ((++spin_count & 1023) == 0 && get_sys_cnt_aicpu() - t0 > PTO2_TENSOR_DATA_TIMEOUT_CYCLES) {
+            if (signaled) {
+                orch.scheduler->orch_needs_drain.store(false, std::memory_order_release);
+            }
+            pto2_orch_report_fatal(
+                &orch, PTO2_ERROR_TENSOR_WAIT_TIMEOUT, __FUNCTION__,
+                "Timeout (%llu cycles): task (ring=%d, local=%d) never published its scalar mailbox",
+                (unsigned long long)PTO2_TENSOR_DATA_TIMEOUT_CYCLES, (int)owner.ring(), (int)owner.local()
+            );
+            return 0;
+        }
+    }
+
+    if (signaled) {
+        orch.scheduler->orch_needs_drain.store(false, std::memory_order_release);
+    }
+    return desc->scalar_mailbox_value;
+}
+
+bool pto2_tensor_data_ready(PTO2Runtime *rt, const Tensor &tensor) {
+    if (tensor.buffer.addr == 0) {
+        // Unallocated buffer: get_tensor_data would fail immediately, not
+        // wait — report ready so a parked continuation runs and hits the
+        // same error path instead of being deferred forever.
+        return true;
+    }
+
+    PTO2TaskSlotState *slots[PTO2_MAX_TENSOR_PRODUCERS];
+    int slot_count = collect_producer_slots(rt, tensor, slots);
+    for (int p = 0; p < slot_count; p++) {
+        if (!(slots[p]->state_word.load(std::memory_order_acquire) & PTO2_STATE_COMPLETED_BIT)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 void pto2_set_tensor_data(
     PTO2Runtime *rt, const Tensor &tensor, uint32_t ndims, const uint32_t indices[], uint64_t value
 ) {
@@ -209,6 +332,78 @@ void pto2_set_tensor_data(
     memcpy(ptr, &value, elem_size);
 }
 
+// Per-core device-enqueue rings. Static storage (like the dispatch payload
+// slots) so the GM addresses staged into kernel args are stable for the
+// process lifetime; pto2_register_child() zeroes and attaches them lazily,
+// and runtimes that never register a child pay nothing.
+static PTO2DeviceEnqueueRing s_device_enqueue_rings[RUNTIME_MAX_WORKER];
+
+int32_t pto2_register_child(PTO2Runtime *rt, const MixedKernels &mixed_kernels) {
+    if (mixed_kernels.aic_kernel_id == INVALID_KERNEL_ID && mixed_kernels.aiv0_kernel_id == INVALID_KERNEL_ID &&
+        mixed_kernels.aiv1_kernel_id == INVALID_KERNEL_ID) {
+        pto2_rt_report_fatal(
+            rt, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "child callable needs at least one valid kernel ID"
+        );
+        return -1;
+    }
+    if (rt->child_callable_count >= PTO2_MAX_CHILD_CALLABLES) {
+        pto2_rt_report_fatal(
+            rt, PTO2_ERROR_INVALID_ARGS, __FUNCTION__, "child callable table full (max %d)", PTO2_MAX_CHILD_CALLABLES
+        );
+        return -1;
+    }
+    if (rt->device_enqueue_rings == nullptr) {
+        memset(s_device_enqueue_rings, 0, sizeof(s_device_enqueue_rings));
+        // Rings must be observably empty before the dispatcher starts
+        // staging their addresses into kernel args.
+        std::atomic_thread_fence(std::memory_order_release);
+        rt->device_enqueue_rings = s_device_enqueue_rings;
+    }
+    rt->child_callables[rt->child_callable_count] = mixed_kernels;
+    return rt->child_callable_count++;
+}
+
+int32_t pto2_serve_children(PTO2Runtime *rt, int32_t max_tasks) {
+    if (rt->device_enqueue_rings == nullptr || max_tasks <= 0) {
+        return 0;
+    }
+    int32_t served = 0;
+    for (int32_t core = 0; core < RUNTIME_MAX_WORKER && served < max_tasks; core++) {
+        PTO2DeviceEnqueueRing &ring = rt->device_enqueue_rings[core];
+        uint64_t head = ring.head;
+        uint64_t tail = ring.tail;  // volatile: published by the core's kernel
+        if (head == tail) {
+            continue;
+        }
+        // The producer publishes each entry line before advancing tail.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        while (head != tail && served < max_tasks) {
+            const PTO2DeviceEnqueueEntry &entry =
+                ring.entries[head & (static_cast<uint64_t>(PTO2_DEVICE_ENQUEUE_DEPTH) - 1)];
+            int32_t handle = entry.child_handle;
+            if (handle < 0 || handle >= rt->child_callable_count || entry.scalar_count < 0 ||
+                entry.scalar_count > PTO2_DEVICE_ENQUEUE_MAX_SCALARS) {
+                pto2_rt_report_fatal(
+                    rt, PTO2_ERROR_INVALID_ARGS, __FUNCTION__,
+                    "core %d enqueued malformed child request (handle=%d, scalars=%d)", core, handle,
+                    entry.scalar_count
+                );
+                return served;
+            }
+            Arg args;
+            args.add_scalars(entry.scalars, entry.scalar_count);
+            submit_task_impl(rt, rt->child_callables[handle], args);
+            head++;
+            ring.head = head;  // frees the slot for the producing core
+            served++;
+            if (is_fatal_impl(rt)) {
+                return served;
+            }
+        }
+    }
+    return served;
+}
+
 static const PTO2RuntimeOps s_runtime_ops = {
     .submit_task = submit_task_impl,
     .scope_begin = pto2_rt_scope_begin,
@@ -224,6 +419,17 @@ static const PTO2RuntimeOps s_runtime_ops = {
     .get_tensor_data = pto2_get_tensor_data,
     .set_tensor_data = pto2_set_tensor_data,
     .alloc_tensors = alloc_tensors_impl,
+    .submit_task_batch = submit_task_batch_impl,
+    .intern_tensor = intern_tensor_impl,
+    .interned_tensor = interned_tensor_impl,
+    .profiling_set_enabled = profiling_set_enabled_impl,
+    .bump_tensor_version = bump_tensor_version_impl,
+    .submit_would_block = submit_would_block_impl,
+    .try_submit_task = try_submit_task_impl,
+    .tensor_data_ready = pto2_tensor_data_ready,
+    .read_scalar = pto2_read_scalar,
+    .register_child = pto2_register_child,
+    .serve_children = pto2_serve_children,
 };
 
 // =============================================================================
@@ -343,6 +549,38 @@ void pto2_runtime_destroy(PTO2Runtime *rt) {
     free(rt);
 }
 
+int32_t pto2_runtime_reset(PTO2Runtime *rt) {
+    if (!rt) return -1;
+
+    // Refuse mid-flight resets: every ring must have retired everything it
+    // published. The scheduler only advances last_task_alive, so equality
+    // here is stable once reached.
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        PTO2RingFlowControl &fc = rt->sm_handle->header->rings[r].fc;
+        int32_t current = fc.current_task_index.load(std::memory_order_acquire);
+        int32_t last_alive = fc.last_task_alive.load(std::memory_order_acquire);
+        if (current != last_alive) {
+            LOG_ERROR(
+                "[PTO2] runtime reset refused: ring %d has %d unconsumed tasks (current=%d, last_alive=%d)", r,
+                current - last_alive, current, last_alive
+            );
+            return -1;
+        }
+    }
+
+    pto2_sm_reset(rt->sm_handle);
+    pto2_scheduler_reset(&rt->scheduler);
+    pto2_orchestrator_reset(&rt->orchestrator);
+    rt->total_cycles = 0;
+
+    // Disarm device enqueue: handles are per-workload, so the next workload
+    // re-registers its children (which re-zeroes the rings on first use).
+    rt->device_enqueue_rings = nullptr;
+    rt->child_callable_count = 0;
+
+    return 0;
+}
+
 void pto2_runtime_set_mode(PTO2Runtime *rt, PTO2RuntimeMode mode) {
     if (rt) {
         rt->mode = mode;
@@ -87,6 +87,35 @@ struct PTO2RuntimeOps {
         PTO2Runtime *rt, const Tensor &tensor, uint32_t ndims, const uint32_t indices[], uint64_t value
     );
     TaskOutputTensors (*alloc_tensors)(PTO2Runtime *rt, const Arg &args);
+
+    // Batch submission (appended to preserve hot-path field offsets)
+    void (*submit_task_batch)(PTO2Runtime *rt, const PTO2TaskBatchEntry entries[], int32_t count);
+
+    // Tensor interning (appended to preserve hot-path field offsets)
+    int32_t (*intern_tensor)(PTO2Runtime *rt, const Tensor &tensor);
+    const Tensor *(*interned_tensor)(PTO2Runtime *rt, int32_t handle);
+
+    // Runtime profiling gate (appended to preserve hot-path field offsets)
+    void (*profiling_set_enabled)(PTO2Runtime *rt, bool enabled);
+
+    // Per-slice tensor versioning (appended to preserve hot-path field offsets)
+    int32_t (*bump_tensor_version)(PTO2Runtime *rt, int32_t handle);
+
+    // Cooperative back-pressure (appended to preserve hot-path field offsets)
+    bool (*submit_would_block)(PTO2Runtime *rt, const Arg &args);
+    bool (*try_submit_task)(
+        PTO2Runtime *rt, const MixedKernels &mixed_kernels, const Arg &args, TaskOutputTensors *outputs
+    );
+
+    // Non-blocking tensor readiness probe (appended to preserve hot-path field offsets)
+    bool (*tensor_data_ready)(PTO2Runtime *rt, const Tensor &tensor);
+
+    // Scalar mailbox fast read (appended to preserve hot-path field offsets)
+    uint64_t (*read_scalar)(PTO2Runtime *rt, const Tensor &result_tensor);
+
+    // Device-side child enqueue (appended to preserve hot-path field offsets)
+    int32_t (*register_child)(PTO2Runtime *rt, const MixedKernels &mixed_kernels);
+    int32_t (*serve_children)(PTO2Runtime *rt, int32_t max_tasks);
 };
 
 /**
@@ -114,6 +143,14 @@ struct PTO2Runtime {
 
     // Statistics
     int64_t total_cycles;
+
+    // Device-side child enqueue: per-core rings kernels push into and the
+    // table of pre-registered child callables their handles index.  Rings
+    // stay null until the first pto2_register_child(), so the dispatcher
+    // stages a 0 ring address (and kernels see the feature off) for free.
+    PTO2DeviceEnqueueRing *device_enqueue_rings;
+    MixedKernels child_callables[PTO2_MAX_CHILD_CALLABLES];
+    int32_t child_callable_count;
 };
 
 // =============================================================================
@@ -161,6 +198,23 @@ PTO2Runtime *pto2_runtime_create_from_sm(
  */
 void pto2_runtime_destroy(PTO2Runtime *rt);
 
+/**
+ * Fast reset between independent workloads sharing a session.
+ *
+ * Returns the runtime to its post-create empty state without remapping
+ * memory, reallocating pools, or restarting the executor: shared-memory
+ * flow control, allocators, tensormap (O(buckets)), scheduler queues, and
+ * the fatal latch are all rewound in place.
+ *
+ * The caller must have quiesced the runtime first: orchestration finished
+ * (or abandoned) and every submitted task consumed, so no core or
+ * scheduler thread still references ring state. The reset refuses to run
+ * while tasks are in flight.
+ *
+ * @return 0 on success, -1 if any ring still has unconsumed tasks
+ */
+int32_t pto2_runtime_reset(PTO2Runtime *rt);
+
 /**
  * Set execution mode
  */
@@ -204,6 +258,32 @@ void pto2_rt_report_fatal(PTO2Runtime *rt, int32_t error_code, const char *func,
  */
 uint64_t pto2_get_tensor_data(PTO2Runtime *rt, const Tensor &tensor, uint32_t ndims, const uint32_t indices[]);
 
+/**
+ * Non-blocking probe: true when every producer of `tensor` has completed,
+ * i.e. get_tensor_data would return without spinning.
+ * See pto2_rt_tensor_data_ready in pto_orchestration_api.h for semantics.
+ */
+bool pto2_tensor_data_ready(PTO2Runtime *rt, const Tensor &tensor);
+
+/**
+ * Scalar mailbox fast read: spin on the owner task's mailbox line until the
+ * kernel publishes, then return the value word.
+ * See pto2_rt_read_scalar in pto_orchestration_api.h for semantics.
+ */
+uint64_t pto2_read_scalar(PTO2Runtime *rt, const Tensor &result_tensor);
+
+/**
+ * Register a child callable for device-side enqueue and arm the per-core rings.
+ * See pto2_rt_register_child in pto_orchestration_api.h for semantics.
+ */
+int32_t pto2_register_child(PTO2Runtime *rt, const MixedKernels &mixed_kernels);
+
+/**
+ * Drain the per-core device-enqueue rings, submitting up to max_tasks children.
+ * See pto2_rt_serve_children in pto_orchestration_api.h for semantics.
+ */
+int32_t pto2_serve_children(PTO2Runtime *rt, int32_t max_tasks);
+
 /**
  * Cross-layer data access: write a value to a tensor at given indices.
  * Waits for producer completion (WAW) and all consumers (WAR) via TensorMap.
@@ -221,6 +301,7 @@ void pto2_set_tensor_data(
 #define PTO2_ORCHESTRATION_CONFIG_DEFINED
 struct PTO2OrchestrationConfig {
     int expected_arg_count;
+    int enable_chain_fusion;  /**< Nonzero: fuse single-consumer chains onto one core at dispatch */
 };
 #endif
 
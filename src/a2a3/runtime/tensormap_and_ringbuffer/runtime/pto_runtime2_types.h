@@ -69,6 +69,41 @@
 #error "PTO2_TENSORMAP_PROFILING requires PTO2_ORCH_PROFILING=1"
 #endif
 
+// Strict no-instrumentation builds (platform PTO_INSTRUMENTATION=0) stub out
+// the collector the profiling code writes through; records would silently
+// vanish, so reject the combination up front.
+#if PTO2_PROFILING && defined(PTO_INSTRUMENTATION) && !PTO_INSTRUMENTATION
+#error "PTO_INSTRUMENTATION=0 (strict no-instrumentation build) requires PTO2_PROFILING=0"
+#endif
+
+// =============================================================================
+// Deployment Specialization
+// =============================================================================
+// Compile-time variant selection. Deployments opt in through the "defines"
+// list in their runtime's build_config.py (flows into every target as -D
+// flags), so a build that never exercises a feature pays no runtime branch
+// for it. Macros in this section affect shared-memory layout or scheduling
+// behavior and therefore MUST be set identically across the host, aicpu,
+// aicore and orchestration targets — build_config.py shares one list for
+// exactly this reason.
+
+// Mixed (full-cluster) task support. When 0, the MIX dispatch lane is
+// compiled out of the scheduler inner loop and submitting a task whose
+// active_mask spans multiple cores reports PTO2_ERROR_MIX_NOT_SUPPORTED.
+// Pure-AIC/AIV deployments set this to 0 for a branch-free probe order.
+#ifndef PTO2_ENABLE_MIX
+#define PTO2_ENABLE_MIX 1
+#endif
+
+// Number of ready-queue lanes the dispatch loop probes per iteration.
+// Queue arrays stay sized by PTO2_NUM_RESOURCE_SHAPES (they are indexed by
+// shape value); this only bounds the probe order.
+#if PTO2_ENABLE_MIX
+#define PTO2_NUM_DISPATCH_SHAPES PTO2_NUM_RESOURCE_SHAPES
+#else
+#define PTO2_NUM_DISPATCH_SHAPES 2  // AIC + AIV lanes only; MIX lane compiled out
+#endif
+
 // =============================================================================
 // Configuration Constants
 // =============================================================================
@@ -77,15 +112,23 @@
 // NOTE: PTO2_TASK_WINDOW_SIZE is now a per-ring default value.
 // Actual window size is passed at runtime to pto2_runtime_create_threaded_custom().
 // Use pto2_task_slot(sched, task_id) for slot calculation.
+#ifndef PTO2_TASK_WINDOW_SIZE
 #define PTO2_TASK_WINDOW_SIZE 16384  // Default per-ring task window size (power of 2)
+#endif
 
 // Multi-ring: number of independent ring layers (HeapRing + TaskRing + DepPool per layer)
 // Scope depth maps to ring index via: min(scope_depth, PTO2_MAX_RING_DEPTH - 1)
+// Overridable: single-ring deployments build with PTO2_MAX_RING_DEPTH=1 so
+// every per-ring loop collapses to a single iteration at compile time.
+#ifndef PTO2_MAX_RING_DEPTH
 #define PTO2_MAX_RING_DEPTH 4
+#endif
 
 // Memory pools (per-ring defaults; total = value × PTO2_MAX_RING_DEPTH)
 #define PTO2_HEAP_SIZE (256 * 1024 * 1024)  // 256MB per ring (1GB total)
 #define PTO2_DEP_LIST_POOL_SIZE 16384       // Per-ring dependency list pool entries
+#define PTO2_DEP_CHUNK_MIN 4                // First contiguous fanout run per producer
+#define PTO2_DEP_CHUNK_MAX 64               // Fanout run growth cap (4 -> 16 -> 64)
 #define PTO2_TENSORMAP_POOL_SIZE (65536)    // TensorMap entry pool
 #define PTO2_TENSORMAP_NUM_BUCKETS 4096     // Power of 2 for fast hash (4096×8B=32KB fits L1)
 
@@ -94,7 +137,18 @@
 #define PTO2_SCOPE_TASKS_INIT_CAP 65536  // Initial capacity for scope task buffer
 
 // Ready queue
-#define PTO2_READY_QUEUE_SIZE 65536  // Per-shape queue size
+#define PTO2_READY_QUEUE_SIZE 65536      // Per-shape queue size
+#define PTO2_LOCAL_READY_CAP 64          // Thread-local ready deque slots (power of 2)
+#define PTO2_PRIO_STARVATION_INTERVAL 8  // Every Nth global pop services the normal lane first
+
+// Aging promotion: when the oldest un-serviced normal-lane task is older than
+// this many sys-counter ticks (~1 ms at the 50 MHz counter), the normal lane
+// is serviced first regardless of the round, so bulk work keeps progressing
+// through a sustained high-priority stream. 0 disables aging and leaves only
+// the round-robin credit.
+#ifndef PTO2_PRIO_AGING_TICKS
+#define PTO2_PRIO_AGING_TICKS (50 * 1000)
+#endif
 
 // Wiring queue
 #define PTO2_WRIRING_QUEUE_SIZE 1024  // Per-shape queue size
@@ -102,10 +156,34 @@
 // Memory alignment
 #define PTO2_ALIGN_SIZE 64             // Cache line alignment
 #define PTO2_PACKED_OUTPUT_ALIGN 1024  // Each output in packed buffer aligned to 1024B; gap is padding
+
+// Small-output fast path: packed outputs up to this many bytes are stored
+// inline in the task's PTO2TaskDescriptor slot (64B-aligned packing) instead
+// of going through the heap ring with 1KB-aligned outputs.
+#ifndef PTO2_INLINE_OUTPUT_CAP
+#define PTO2_INLINE_OUTPUT_CAP 256
+#endif
+#define PTO2_INLINE_OUTPUT_ALIGN 64  // Per-output alignment inside the inline area
+
+// Chain-residency hint cap: when a consumer is staged back-to-back behind
+// its producer on the same core, packed outputs up to this many bytes are
+// advertised (LocalContext::chain_src) as still resident in the core's
+// local buffer, letting cooperating kernel pairs skip the GM re-read of
+// tiny intermediates. Larger outputs (which a producer would have tiled
+// back out of local memory anyway) are never advertised. 0 disables the
+// hint entirely.
+#ifndef PTO2_CHAIN_RESIDENT_CAP
+#define PTO2_CHAIN_RESIDENT_CAP (32 * 1024)
+#endif
 #define PTO2_ALIGN_UP(x, align) (((x) + (align) - 1) & ~((align) - 1))
 
-// Fanin storage
+// Fanin storage. Entries beyond the inline cap spill to the FaninPool and
+// cost an extra indirection on the completion hot path; overridable so a
+// build config can widen (or narrow) the payload's inline array per model
+// based on the fanin distribution the profiling summary reports.
+#ifndef PTO2_FANIN_INLINE_CAP
 #define PTO2_FANIN_INLINE_CAP 16
+#endif
 
 // TensorMap cleanup interval
 #define PTO2_TENSORMAP_CLEANUP_INTERVAL 64  // Cleanup every N retired tasks
@@ -115,6 +193,10 @@
 // ~10s on hardware (1.5 GHz counter), ~10s on simulation (chrono-based).
 constexpr uint64_t PTO2_TENSOR_DATA_TIMEOUT_CYCLES = 15 * 1000 * 1000 * 1000ULL;
 
+// Max child callables registrable for device-side enqueue
+// (pto2_register_child). Handles index a fixed table in PTO2Runtime.
+constexpr int32_t PTO2_MAX_CHILD_CALLABLES = 16;
+
 // =============================================================================
 // Multi-Ring task_id Encoding
 // =============================================================================
@@ -144,23 +226,67 @@ typedef enum {
 // =============================================================================
 
 /**
- * Task state enumeration
+ * Task state enumeration (reporting view of the packed state word below)
  *
  * State transitions:
  *   PENDING -> READY -> RUNNING -> COMPLETED -> CONSUMED
  *
  * Conditions:
- *   PENDING->READY:     fanin_refcount == fanin_count
+ *   PENDING->READY:     all fanin releases applied (remaining fanin hits 0)
  *   COMPLETED->CONSUMED: fanout_refcount == fanout_count && state == COMPLETED
  */
 typedef enum {
-    PTO2_TASK_PENDING = 0,    // Waiting for dependencies (fanin_refcount < fanin_count)
+    PTO2_TASK_PENDING = 0,    // Waiting for dependencies (remaining fanin > 0)
     PTO2_TASK_READY = 1,      // All dependencies satisfied, waiting in ready queue
     PTO2_TASK_RUNNING = 2,    // Currently executing on a worker
     PTO2_TASK_COMPLETED = 3,  // Execution finished, output may still be in use
     PTO2_TASK_CONSUMED = 4    // Output fully consumed, buffers can be released
 } PTO2TaskState;
 
+/**
+ * Packed task state word
+ *
+ * Task state and the fanin progress counter live in one 64-bit atomic so the
+ * hot transitions are single branch-free RMWs instead of counter-RMW +
+ * state-CAS pairs:
+ *
+ *   bits  0..31  remaining fanin releases, counted DOWN. Wiring initializes
+ *                the counter to fanin_count before any fanout entry exists,
+ *                so a release is fetch_sub(1) and the caller that observes
+ *                the counter crossing to 0 (old value == its decrement) is
+ *                the unique ready-crossing releaser.
+ *   bit   32     READY     — set with fetch_or; the caller that sees the bit
+ *                            clear in the returned word owns the dispatch
+ *                            (arbitrates crossing release vs speculative claim)
+ *   bit   33     COMPLETED — set with fetch_or on task completion
+ *   bit   34     CONSUMED  — set with fetch_or; the caller that sees the bit
+ *                            clear owns slot retirement
+ *
+ * State bits are monotone (only ever set until the slot is reset), so state
+ * comparisons reduce to single-bit tests and because counter and state share
+ * one word every RMW observes a consistent snapshot of both.
+ */
+static constexpr uint64_t PTO2_STATE_FANIN_MASK = 0xFFFFFFFFull;
+static constexpr uint64_t PTO2_STATE_READY_BIT = 1ull << 32;
+static constexpr uint64_t PTO2_STATE_COMPLETED_BIT = 1ull << 33;
+static constexpr uint64_t PTO2_STATE_CONSUMED_BIT = 1ull << 34;
+
+static inline uint32_t pto2_fanin_remaining(uint64_t state_word) {
+    return static_cast<uint32_t>(state_word & PTO2_STATE_FANIN_MASK);
+}
+
+/**
+ * Reporting view: collapse the packed word to the classic enum. RUNNING was
+ * never recorded in the old state field either (dispatch goes straight from
+ * READY to COMPLETED), so it never appears here.
+ */
+static inline PTO2TaskState pto2_task_state_of(uint64_t state_word) {
+    if (state_word & PTO2_STATE_CONSUMED_BIT) return PTO2_TASK_CONSUMED;
+    if (state_word & PTO2_STATE_COMPLETED_BIT) return PTO2_TASK_COMPLETED;
+    if (state_word & PTO2_STATE_READY_BIT) return PTO2_TASK_READY;
+    return PTO2_TASK_PENDING;
+}
+
 // =============================================================================
 // Logical Tensor (for view/reshape/transpose operations)
 // =============================================================================
@@ -316,7 +442,7 @@ struct PTO2DepListEntry {
  *
  * Stored in the TaskDescriptor ring buffer in shared memory.
  * Contains static identification and buffer pointers only.
- * Dynamic scheduling state (fanin/fanout/task_state) is in PTO2TaskSlotState.
+ * Dynamic scheduling state (fanin/fanout/state word) is in PTO2TaskSlotState.
  *
  * Fields set by Orchestrator at submission, read by Scheduler for dispatch.
  */
@@ -327,11 +453,52 @@ struct PTO2TaskDescriptor {
     // Per-slot kernel IDs (INVALID_KERNEL_ID = inactive)
     int32_t kernel_id[PTO2_SUBTASK_SLOT_COUNT];
 
-    // Packed output buffer (all outputs packed into single contiguous buffer)
-    void *packed_buffer_base;  // Start of packed buffer in GM Heap
-    void *packed_buffer_end;   // End of packed buffer (for heap reclamation)
+    // Logical 2-D grid width from PTO2LaunchSpec (0 or 1 = 1-D numbering).
+    // Read at dispatch to precompute per-block coordinates into LocalContext.
+    int16_t block_dim_x{0};
+
+    // The scheduler stamps every task's first dispatch into
+    // autotune_dispatch_cnt and measures dispatch → completion wall cycles
+    // from it at completion: all tasks feed the health block's latency
+    // EWMA; tasks whose block_num came from PTO2_BLOCK_NUM_AUTO resolution
+    // (block_num_auto set) additionally feed the auto-tune history table.
+    uint8_t block_num_auto{0};
+
+    // Non-zero when the submit opted in via PTO2LaunchSpec::set_scalar_result():
+    // dispatch stages the mailbox address below into LocalContext so the
+    // kernel can publish a scalar result mid-execution.
+    uint8_t scalar_result{0};
+
+    uint64_t autotune_dispatch_cnt{0};
+
+    // Packed output buffer (all outputs packed into single contiguous buffer).
+    // For small outputs packed_buffer_base points at inline_output below and
+    // packed_buffer_end carries the heap ring position at allocation time
+    // (same convention as zero-size allocations), so tail derivation is exact.
+    void *packed_buffer_base;  // Start of packed buffer (GM Heap or inline_output)
+    void *packed_buffer_end;   // End of packed buffer in GM Heap (for heap reclamation)
+
+    // Inline storage for small packed outputs (<= PTO2_INLINE_OUTPUT_CAP).
+    // Written by kernels, live until the slot is reused — the same lifetime
+    // the heap ring guarantees for packed buffers.
+    alignas(PTO2_ALIGN_SIZE) uint8_t inline_output[PTO2_INLINE_OUTPUT_CAP];
+
+    // Scalar result mailbox, on its own cache line so the orchestrator's
+    // pto2_read_scalar() spin touches nothing the scheduler reads. The flag
+    // word is cleared at submit for opted-in tasks (scalar_result above);
+    // the kernel writes the value word and then publishes a non-zero flag
+    // with one line writeback (see get_scalar_mailbox() in intrinsic.h).
+    // Live until the slot is reused, same lifetime as inline_output.
+    alignas(PTO2_ALIGN_SIZE) volatile uint64_t scalar_mailbox_flag{0};
+    volatile uint64_t scalar_mailbox_value{0};
 };
 
+// An inline-eligible total must be distinguishable from a heap-resident one:
+// any non-empty 1KB-aligned packed total exceeds the inline cap by design.
+static_assert(
+    PTO2_INLINE_OUTPUT_CAP < PTO2_PACKED_OUTPUT_ALIGN, "inline cap must stay below the packed output alignment"
+);
+
 // =============================================================================
 // Per-Slot Scheduling State
 // =============================================================================
@@ -351,6 +518,24 @@ struct PTO2TaskPayload {
     int32_t fanin_spill_start{0};   // Linear start index in fanin spill pool (0 = no spill)
     PTO2FaninPool *fanin_spill_pool{nullptr};
     PTO2TaskSlotState *fanin_inline_slot_states[PTO2_FANIN_INLINE_CAP];
+    // Buffer donation: producer whose packed output this task's OUTPUT was
+    // aliased onto (nullptr = no donation). The donating task holds one
+    // extra fanout reference on that producer, released only when THIS task
+    // reaches CONSUMED — the donated bytes must outlive every consumer of
+    // the aliased output, not just this task's own execution.
+    PTO2TaskSlotState *donated_producer{nullptr};
+    // Early input release: non-zero when the submit opted in via
+    // PTO2LaunchSpec::set_early_input_release() AND the task qualifies
+    // (single core, single logical block, at least one fanin). Arms the
+    // completion scan's dispatch-payload poll for this task.
+    uint8_t early_input_release{0};
+    // Set once the completion scan has released this task's fanins in
+    // response to the kernel's mid-execution signal; on_task_release()
+    // then skips the fanin walk at completion. Only ever written by the
+    // scheduler thread that owns the task's core (single-core tasks only),
+    // and core handoffs between threads synchronize through the elastic
+    // resize ack protocol — a plain flag suffices.
+    uint8_t fanin_early_released{0};
     // === Cache lines 3-34 (2048B) — tensors (alignas(64) forces alignment) ===
     Tensor tensors[MAX_TENSOR_ARGS];
     // === Cache lines 35-50 (1024B) — scalars ===
@@ -412,23 +597,23 @@ static_assert(
  * slot state brings all related fields into the same cache line.
  *
  * Concurrency notes:
- * - fanout_head, fanout_count protected by fanout_lock (per-task spinlock)
- * - fanin_count set once at submission, read-only after (hot path for ready check)
- * - task_state, fanin_refcount, fanout_refcount updated atomically
+ * - fanout_head protected by fanout_lock (per-task spinlock)
+ * - fanout_count bumped with relaxed fetch_add: parallel orchestration
+ *   branches may add consumers to one producer concurrently
+ * - state_word packs task state bits and the remaining-fanin counter
+ *   (see PTO2_STATE_* above); wiring initializes the counter before the
+ *   first fanout entry referencing this slot exists
+ * - fanout_refcount updated atomically
  */
 struct alignas(64) PTO2TaskSlotState {
     // Fanout lock + list (accessed together under lock in on_task_complete)
-    std::atomic<int32_t> fanout_lock;  // Per-task spinlock (0=unlocked, 1=locked)
-    int32_t fanout_count;              // 1 (owning scope) + number of consumers
+    std::atomic<int32_t> fanout_lock;   // Per-task spinlock (0=unlocked, 1=locked)
+    std::atomic<int32_t> fanout_count;  // 1 (owning scope) + number of consumers
 
     PTO2DepListEntry *fanout_head;  // Pointer to first fanout entry (nullptr = empty)
 
-    // Task state (completion, consumed check, ready check)
-    std::atomic<PTO2TaskState> task_state;  // PENDING/READY/RUNNING/COMPLETED/CONSUMED
-
-    // Fanin (accessed together in release_fanin_and_check_ready)
-    std::atomic<int32_t> fanin_refcount;  // Dynamic: counts completed producers
-    int32_t fanin_count;                  // Number of producer dependencies (set once)
+    // Packed task state + remaining-fanin counter (ready/consumed transitions)
+    std::atomic<uint64_t> state_word;
 
     // Fanout refcount (accessed with fanout_count in check_and_handle_consumed)
     std::atomic<int32_t> fanout_refcount;  // Dynamic: counts released references
@@ -438,9 +623,10 @@ struct alignas(64) PTO2TaskSlotState {
     PTO2TaskDescriptor *task;
 
     // Hot-path completion fields (moved from TaskDescriptor to avoid cross-struct access)
-    uint8_t active_mask;                     // Bitmask of active subtask slots (set once)
-    std::atomic<uint8_t> subtask_done_mask;  // Deprecated: superseded by completed_subtasks
+    uint8_t active_mask;              // Bitmask of active subtask slots (set once)
+    std::atomic<uint8_t> chain_hint;  // Nonzero: submit detected a single-consumer successor (chain fusion)
     uint8_t ring_id;                         // Ring layer this task belongs to (for per-ring reclamation)
+    uint8_t affinity_cluster{0};  // Producer's cluster (AIC worker id + 1, 0 = none) — dispatch locality hint
     int32_t dep_pool_mark{0};  // Dep pool top after this task's submission (orchestrator-only, local memory)
 
     // SPMD multi-block (occupies the 8 tail bytes previously implicit padding)
@@ -498,6 +684,29 @@ typedef void (*PTO2InCoreFunc)(void **args, int32_t num_args);
 #define SPIN_WAIT_HINT() ((void)0)
 #endif
 
+// =============================================================================
+// Hot/cold code placement for the AICPU scheduler
+// =============================================================================
+// The steady-state scheduler loop is front-end bound: every byte of error
+// handling or diagnostics inlined into it competes with dispatch code for
+// the AICPU's L1 I-cache. PTO2_COLD_PATH outlines non-steady-state helpers
+// (always: noinline keeps them out of the loop body); PTO2_ICACHE_SPLIT=1
+// additionally groups hot-loop functions and outlined cold helpers into
+// dedicated .text.pto2_hot / .text.pto2_cold sections so the linker lays
+// the steady-state loop out contiguously. Verify the hot section fits the
+// I-cache with examples/scripts/icache_report.py after a split build.
+#ifndef PTO2_ICACHE_SPLIT
+#define PTO2_ICACHE_SPLIT 0
+#endif
+
+#if PTO2_ICACHE_SPLIT
+#define PTO2_COLD_PATH __attribute__((noinline, cold, section(".text.pto2_cold")))
+#define PTO2_HOT_PATH __attribute__((hot, section(".text.pto2_hot")))
+#else
+#define PTO2_COLD_PATH __attribute__((noinline, cold))
+#define PTO2_HOT_PATH
+#endif
+
 // =============================================================================
 // Per-task fanout spinlock helpers
 //
@@ -505,9 +714,10 @@ typedef void (*PTO2InCoreFunc)(void **args, int32_t num_args);
 // (aicpu_executor.cpp). Placing them here ensures both translation units use
 // identical acquire/release semantics.
 //
-// The fanout_lock MUST be held whenever reading or writing fanout_head /
-// fanout_count, because the orchestrator adds consumers concurrently with the
-// scheduler traversing the list after task completion.
+// The fanout_lock MUST be held whenever reading or writing fanout_head,
+// because the orchestrator adds consumers concurrently with the scheduler
+// traversing the list after task completion. fanout_count is atomic and is
+// bumped without the lock.
 // =============================================================================
 
 #if PTO2_ORCH_PROFILING || PTO2_SCHED_PROFILING
@@ -88,7 +88,7 @@ const char *pto2_task_state_name(PTO2TaskState state) {
 // Ready Queue Implementation
 // =============================================================================
 
-bool pto2_ready_queue_init(PTO2ReadyQueue *queue, uint64_t capacity) {
+bool pto2_ready_queue_init(PTO2ReadyQueue *queue, uint64_t capacity, bool single_thread) {
     queue->slots = (PTO2ReadyQueueSlot *)malloc(capacity * sizeof(PTO2ReadyQueueSlot));
     if (!queue->slots) {
         return false;
@@ -96,6 +96,7 @@ bool pto2_ready_queue_init(PTO2ReadyQueue *queue, uint64_t capacity) {
 
     queue->capacity = capacity;
     queue->mask = capacity - 1;
+    queue->single_thread = single_thread;
     queue->enqueue_pos.store(0, std::memory_order_relaxed);
     queue->dequeue_pos.store(0, std::memory_order_relaxed);
 
@@ -114,16 +115,34 @@ void pto2_ready_queue_destroy(PTO2ReadyQueue *queue) {
     }
 }
 
+void pto2_ready_queue_reset(PTO2ReadyQueue *queue) {
+    queue->enqueue_pos.store(0, std::memory_order_relaxed);
+    queue->dequeue_pos.store(0, std::memory_order_relaxed);
+    for (uint64_t i = 0; i < queue->capacity; i++) {
+        queue->slots[i].sequence.store((int64_t)i, std::memory_order_relaxed);
+        queue->slots[i].slot_state = nullptr;
+    }
+}
+
+void pto2_scheduler_set_single_thread(PTO2SchedulerState *sched, bool single_thread) {
+    for (int i = 0; i < PTO2_NUM_RESOURCE_SHAPES; i++) {
+        sched->ready_queues[i].single_thread = single_thread;
+        sched->ready_queues_high[i].single_thread = single_thread;
+    }
+}
+
 // =============================================================================
 // Scheduler Initialization
 // =============================================================================
 
 bool PTO2SchedulerState::RingSchedState::init(PTO2SharedMemoryHandle *sm_handle, int32_t ring_id) {
+    pto2_shadow_init_from_env();
     task_descriptors = sm_handle->task_descriptors[ring_id];
     task_window_size = sm_handle->header->rings[ring_id].task_window_size;
     task_window_mask = static_cast<int32_t>(task_window_size - 1);
     last_task_alive = 0;
     slot_states = nullptr;
+    fanout_wire_states = nullptr;
     advance_lock.store(0, std::memory_order_relaxed);
 
     // Allocate per-task slot state array (dynamically sized based on runtime window_size)
@@ -135,19 +154,25 @@ bool PTO2SchedulerState::RingSchedState::init(PTO2SharedMemoryHandle *sm_handle,
     // Zero-initialize all per-task slot state fields.
     for (uint64_t i = 0; i < task_window_size; i++) {
         slot_states[i].fanout_lock.store(0, std::memory_order_relaxed);
-        slot_states[i].fanout_count = 0;
+        slot_states[i].fanout_count.store(0, std::memory_order_relaxed);
         slot_states[i].fanout_head = nullptr;
-        slot_states[i].task_state.store(static_cast<PTO2TaskState>(0), std::memory_order_relaxed);
-        slot_states[i].fanin_refcount.store(0, std::memory_order_relaxed);
-        slot_states[i].fanin_count = 0;
+        slot_states[i].state_word.store(0, std::memory_order_relaxed);
         slot_states[i].fanout_refcount.store(0, std::memory_order_relaxed);
         slot_states[i].payload = nullptr;
         slot_states[i].task = nullptr;
         slot_states[i].active_mask = 0;
-        slot_states[i].subtask_done_mask.store(0, std::memory_order_relaxed);
+        slot_states[i].chain_hint.store(0, std::memory_order_relaxed);
         slot_states[i].ring_id = 0;
     }
 
+    // Per-producer fanout append cursors, parallel to slot_states (value-initialized)
+    fanout_wire_states = new (std::nothrow) FanoutWireState[task_window_size]();
+    if (!fanout_wire_states) {
+        delete[] slot_states;
+        slot_states = nullptr;
+        return false;
+    }
+
     return true;
 }
 
@@ -155,6 +180,27 @@ void PTO2SchedulerState::RingSchedState::destroy() {
     if (!slot_states) return;
     delete[] slot_states;
     slot_states = nullptr;
+    delete[] fanout_wire_states;
+    fanout_wire_states = nullptr;
+}
+
+void PTO2SchedulerState::RingSchedState::reset() {
+    last_task_alive = 0;
+    advance_lock.store(0, std::memory_order_relaxed);
+
+    for (uint64_t i = 0; i < task_window_size; i++) {
+        slot_states[i].fanout_lock.store(0, std::memory_order_relaxed);
+        slot_states[i].fanout_count.store(0, std::memory_order_relaxed);
+        slot_states[i].fanout_head = nullptr;
+        slot_states[i].state_word.store(0, std::memory_order_relaxed);
+        slot_states[i].fanout_refcount.store(0, std::memory_order_relaxed);
+        slot_states[i].payload = nullptr;
+        slot_states[i].task = nullptr;
+        slot_states[i].active_mask = 0;
+        slot_states[i].chain_hint.store(0, std::memory_order_relaxed);
+        slot_states[i].ring_id = 0;
+        fanout_wire_states[i] = FanoutWireState{};
+    }
 }
 
 bool pto2_scheduler_init(PTO2SchedulerState *sched, PTO2SharedMemoryHandle *sm_handle, int32_t dep_pool_capacity) {
@@ -174,12 +220,23 @@ bool pto2_scheduler_init(PTO2SchedulerState *sched, PTO2SharedMemoryHandle *sm_h
         }
     }
 
-    // Initialize ready queues (one per resource shape, global)
+    // No local buffers registered yet (threads register on scheduling-loop entry)
+    for (int i = 0; i < PLATFORM_MAX_AICPU_THREADS; i++) {
+        sched->thread_local_bufs[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    sched->ready_shape_occupancy.store(0, std::memory_order_relaxed);
+
+    // Initialize ready queues (two lanes per resource shape, global)
     for (int i = 0; i < PTO2_NUM_RESOURCE_SHAPES; i++) {
-        if (!pto2_ready_queue_init(&sched->ready_queues[i], PTO2_READY_QUEUE_SIZE)) {
-            // Cleanup on failure
-            for (int j = 0; j < i; j++) {
+        sched->prio_pop_rounds[i].store(0, std::memory_order_relaxed);
+        sched->normal_lane_oldest[i].store(0, std::memory_order_relaxed);
+        if (!pto2_ready_queue_init(&sched->ready_queues[i], PTO2_READY_QUEUE_SIZE) ||
+            !pto2_ready_queue_init(&sched->ready_queues_high[i], PTO2_READY_QUEUE_SIZE)) {
+            // Cleanup on failure (destroy tolerates the half-initialized pair)
+            for (int j = 0; j <= i; j++) {
                 pto2_ready_queue_destroy(&sched->ready_queues[j]);
+                pto2_ready_queue_destroy(&sched->ready_queues_high[j]);
             }
             for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
                 sched->ring_sched_states[r].destroy();
@@ -198,6 +255,7 @@ bool pto2_scheduler_init(PTO2SchedulerState *sched, PTO2SharedMemoryHandle *sm_h
             }
             for (int i = 0; i < PTO2_NUM_RESOURCE_SHAPES; i++) {
                 pto2_ready_queue_destroy(&sched->ready_queues[i]);
+                pto2_ready_queue_destroy(&sched->ready_queues_high[i]);
             }
             sched->wiring_queue.destroy();
             for (int rr = 0; rr < PTO2_MAX_RING_DEPTH; rr++) {
@@ -205,7 +263,10 @@ bool pto2_scheduler_init(PTO2SchedulerState *sched, PTO2SharedMemoryHandle *sm_h
             }
             return false;
         }
-        sched->ring_sched_states[r].dep_pool.init(dep_entries, dep_pool_capacity, &sm_handle->header->orch_error_code);
+        sched->ring_sched_states[r].dep_pool.init(
+            dep_entries, dep_pool_capacity, &sm_handle->header->orch_error_code,
+            static_cast<int32_t>(sm_handle->header->params.dep_pool_spin_limit)
+        );
     }
 
     // Initialize global wiring queue (SPSC: orchestrator pushes, scheduler thread 0 drains)
@@ -215,6 +276,7 @@ bool pto2_scheduler_init(PTO2SchedulerState *sched, PTO2SharedMemoryHandle *sm_h
         }
         for (int i = 0; i < PTO2_NUM_RESOURCE_SHAPES; i++) {
             pto2_ready_queue_destroy(&sched->ready_queues[i]);
+            pto2_ready_queue_destroy(&sched->ready_queues_high[i]);
         }
         for (int rr = 0; rr < PTO2_MAX_RING_DEPTH; rr++) {
             sched->ring_sched_states[rr].destroy();
@@ -228,6 +290,37 @@ bool pto2_scheduler_init(PTO2SchedulerState *sched, PTO2SharedMemoryHandle *sm_h
     return true;
 }
 
+void pto2_scheduler_reset(PTO2SchedulerState *sched) {
+#if PTO2_SCHED_PROFILING
+    sched->tasks_completed.store(0, std::memory_order_relaxed);
+    sched->tasks_consumed.store(0, std::memory_order_relaxed);
+#endif
+
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        sched->ring_sched_states[r].reset();
+        auto &dep_pool = sched->ring_sched_states[r].dep_pool;
+        dep_pool.init(dep_pool.base, dep_pool.capacity, dep_pool.error_code_ptr, dep_pool.spin_limit);
+    }
+
+    for (int i = 0; i < PLATFORM_MAX_AICPU_THREADS; i++) {
+        sched->thread_local_bufs[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    for (int i = 0; i < PTO2_NUM_RESOURCE_SHAPES; i++) {
+        sched->prio_pop_rounds[i].store(0, std::memory_order_relaxed);
+        sched->normal_lane_oldest[i].store(0, std::memory_order_relaxed);
+        pto2_ready_queue_reset(&sched->ready_queues[i]);
+        pto2_ready_queue_reset(&sched->ready_queues_high[i]);
+    }
+    sched->ready_shape_occupancy.store(0, std::memory_order_relaxed);
+
+    sched->wiring_queue.reset();
+    sched->wiring_batch_count = 0;
+    sched->wiring_batch_index = 0;
+    sched->wiring_backoff_counter = 0;
+    sched->orch_needs_drain.store(false, std::memory_order_relaxed);
+}
+
 void pto2_scheduler_destroy(PTO2SchedulerState *sched) {
     for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
         sched->ring_sched_states[r].destroy();
@@ -239,6 +332,7 @@ void pto2_scheduler_destroy(PTO2SchedulerState *sched) {
 
     for (int i = 0; i < PTO2_NUM_RESOURCE_SHAPES; i++) {
         pto2_ready_queue_destroy(&sched->ready_queues[i]);
+        pto2_ready_queue_destroy(&sched->ready_queues_high[i]);
     }
 }
 
@@ -274,7 +368,10 @@ void pto2_scheduler_print_queues(PTO2SchedulerState *sched) {
     const char *shape_names[] = {"AIC", "AIV", "MIX"};
 
     for (int i = 0; i < PTO2_NUM_RESOURCE_SHAPES; i++) {
-        LOG_INFO("  %s: count=%" PRIu64, shape_names[i], sched->ready_queues[i].size());
+        LOG_INFO(
+            "  %s: count=%" PRIu64 " high=%" PRIu64, shape_names[i], sched->ready_queues[i].size(),
+            sched->ready_queues_high[i].size()
+        );
     }
 
     LOG_INFO("====================");
@@ -20,7 +20,7 @@
  * 5. Two-stage mixed-task completion (subtask done bits → mixed-task complete)
  *
  * The Scheduler runs on Device AI_CPU and processes:
- * - Task state transitions based on fanin_refcount
+ * - Task state transitions on the packed state word (remaining fanin + state bits)
  * - Buffer lifecycle based on fanout_refcount
  * - Ring pointer advancement for flow control
  *
@@ -31,13 +31,16 @@
 
 #include <atomic>
 
+#include "aicpu/device_time.h"  // get_sys_cnt_aicpu for aging promotion + profiling
 #include "common/core_type.h"
+#include "common/platform_config.h"
 #include "pto_ring_buffer.h"
 #include "pto_runtime2_types.h"
 #include "pto_shared_memory.h"
+#include "pto_spsc_queue.h"
+#include "pto_ws_deque.h"
 
 #if PTO2_SCHED_PROFILING
-#include "aicpu/device_time.h"
 #define PTO2_SCHED_CYCLE_START() uint64_t _st0 = get_sys_cnt_aicpu(), _st1
 #define PTO2_SCHED_CYCLE_LAP(acc)   \
     do {                            \
@@ -62,38 +65,26 @@ struct PTO2ReadyQueueSlot {
 /**
  * Thread-local ready buffer for local-first dispatch optimization.
  *
- * Two buffers per scheduling thread, one per CoreType (AIC=0, AIV=1).
- * Initialized once before the scheduling loop; must be empty at
- * the start of each iteration (verified by always_assert).
+ * One buffer per resource shape per scheduling thread.  The owning thread
+ * fills it via on_mixed_task_complete() and drains it LIFO during dispatch;
+ * leftovers are flushed to the global ready queue at the end of each loop
+ * iteration.
  *
- * Phase 1 fills per-CoreType buffers via on_task_complete().
- * dispatch_ready_tasks_to_idle_cores drains them: local-first via
- * get_ready_task_batch, then remaining tasks pushed to global readyQ.
+ * Work stealing: the buffer is a bounded Chase-Lev deque.  The owner
+ * pushes/pops at the bottom without atomics on the hot path; idle threads
+ * steal single entries from the top via CAS (see
+ * PTO2SchedulerState::steal_ready_tasks), so another thread's ready work is
+ * reachable before the owner's flush instead of only after the
+ * global-queue round trip.
  */
 // Number of CoreType values eligible for local dispatch (AIC=0, AIV=1)
 static constexpr int PTO2_LOCAL_DISPATCH_TYPE_NUM = 2;
 
-struct PTO2LocalReadyBuffer {
-    PTO2TaskSlotState **slot_states = nullptr;
-    int count = 0;
-    int capacity = 0;
-
-    void reset(PTO2TaskSlotState **buf, int cap) {
-        slot_states = buf;
-        count = 0;
-        capacity = cap;
-    }
-
-    bool try_push(PTO2TaskSlotState *s) {
-        if (slot_states && count < capacity) {
-            slot_states[count++] = s;
-            return true;
-        }
-        return false;
-    }
-
-    PTO2TaskSlotState *pop() { return (count > 0) ? slot_states[--count] : nullptr; }
-};
+// Shared-core Chase-Lev deque with the ring embedded in the struct: the
+// executor's per-thread buffers need no separate backing arrays, and every
+// push/pop/steal indexes storage at a fixed offset instead of chasing the
+// old slot_states pointer.
+using PTO2LocalReadyBuffer = PTO2WorkStealingDequeT<PTO2TaskSlotState *, PTO2_LOCAL_READY_CAP>;
 
 /**
  * Lock-free bounded MPMC queue (Dmitry Vyukov design)
@@ -108,8 +99,17 @@ struct PTO2LocalReadyBuffer {
 struct alignas(64) PTO2ReadyQueue {
     PTO2ReadyQueueSlot *slots;
     uint64_t capacity;
-    uint64_t mask;        // capacity - 1
-    char _pad0[64 - 24];  // Pad to own cache line
+    uint64_t mask;  // capacity - 1
+    // Wait-free single-endpoint mode, selected at init when exactly one
+    // scheduler thread exists (aicpu_thread_num == 1): every push and pop
+    // happens on that thread, so the sequence-CAS protocol degenerates to
+    // plain index reads and release stores. The release on the position
+    // stores keeps cross-thread size() observers (queue-depth stats,
+    // elastic scaling) coherent with the published payload. Per-slot
+    // sequences are not maintained in this mode; reset() restores them, so
+    // the mode must not change while the queue holds entries.
+    bool single_thread;
+    char _pad0[64 - 25];  // Pad to own cache line
 
     std::atomic<uint64_t> enqueue_pos;
     char _pad1[64 - sizeof(std::atomic<uint64_t>)];  // Own cache line
@@ -123,7 +123,32 @@ struct alignas(64) PTO2ReadyQueue {
         return (e >= d) ? (e - d) : 0;
     }
 
+    // --- Single-thread fast paths (single_thread == true) ---
+
+    bool push_st(PTO2TaskSlotState *slot_state) {
+        uint64_t pos = enqueue_pos.load(std::memory_order_relaxed);
+        if (pos - dequeue_pos.load(std::memory_order_relaxed) >= capacity) {
+            return false;  // Queue full
+        }
+        slots[pos & mask].slot_state = slot_state;
+        enqueue_pos.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    PTO2TaskSlotState *pop_st() {
+        uint64_t pos = dequeue_pos.load(std::memory_order_relaxed);
+        if (pos >= enqueue_pos.load(std::memory_order_relaxed)) {
+            return nullptr;  // Queue empty
+        }
+        PTO2TaskSlotState *result = slots[pos & mask].slot_state;
+        dequeue_pos.store(pos + 1, std::memory_order_release);
+        return result;
+    }
+
     bool push(PTO2TaskSlotState *slot_state) {
+        if (single_thread) {
+            return push_st(slot_state);
+        }
         uint64_t pos;
         PTO2ReadyQueueSlot *slot;
         while (true) {
@@ -152,6 +177,17 @@ struct alignas(64) PTO2ReadyQueue {
     void push_batch(PTO2TaskSlotState **items, int count) {
         if (count == 0) return;
 
+        if (single_thread) {
+            // Like the MPMC path, a full queue is unrecoverable here (nobody
+            // else drains it); callers size the queues past the task window.
+            uint64_t st_pos = enqueue_pos.load(std::memory_order_relaxed);
+            for (int i = 0; i < count; i++) {
+                slots[(st_pos + i) & mask].slot_state = items[i];
+            }
+            enqueue_pos.store(st_pos + count, std::memory_order_release);
+            return;
+        }
+
         uint64_t pos;
         while (true) {
             pos = enqueue_pos.load(std::memory_order_relaxed);
@@ -184,6 +220,11 @@ struct alignas(64) PTO2ReadyQueue {
 
 #if PTO2_ORCH_PROFILING || PTO2_SCHED_PROFILING
     bool push(PTO2TaskSlotState *slot_state, uint64_t &atomic_count, uint64_t &wait_cycle) {
+        if (single_thread) {
+            (void)wait_cycle;  // wait-free: never contended
+            atomic_count += 3;  // enqueue_pos.load + dequeue_pos.load + enqueue_pos.store
+            return push_st(slot_state);
+        }
         uint64_t pos;
         PTO2ReadyQueueSlot *slot;
         uint64_t t0 = get_sys_cnt_aicpu();
@@ -223,6 +264,9 @@ struct alignas(64) PTO2ReadyQueue {
 #endif
 
     PTO2TaskSlotState *pop() {
+        if (single_thread) {
+            return pop_st();
+        }
         // Fast-path: skip slot load when queue is clearly empty
         uint64_t d = dequeue_pos.load(std::memory_order_relaxed);
         uint64_t e = enqueue_pos.load(std::memory_order_relaxed);
@@ -254,6 +298,11 @@ struct alignas(64) PTO2ReadyQueue {
 
 #if PTO2_SCHED_PROFILING
     PTO2TaskSlotState *pop(uint64_t &atomic_count, uint64_t &wait_cycle) {
+        if (single_thread) {
+            (void)wait_cycle;
+            atomic_count += 3;  // dequeue_pos.load + enqueue_pos.load + dequeue_pos.store
+            return pop_st();
+        }
         // Fast-path: skip slot load when queue is clearly empty
         uint64_t d = dequeue_pos.load(std::memory_order_relaxed);
         uint64_t e = enqueue_pos.load(std::memory_order_relaxed);
@@ -304,6 +353,19 @@ struct alignas(64) PTO2ReadyQueue {
     // Batch pop: reserve a contiguous run of ready slots with a single CAS.
     // Returns actual number of items popped (may be less than max_count).
     int pop_batch(PTO2TaskSlotState **out, int max_count) {
+        if (single_thread) {
+            uint64_t st_pos = dequeue_pos.load(std::memory_order_relaxed);
+            uint64_t avail = enqueue_pos.load(std::memory_order_relaxed) - st_pos;
+            int st_count = avail < static_cast<uint64_t>(max_count) ? static_cast<int>(avail) : max_count;
+            for (int i = 0; i < st_count; i++) {
+                out[i] = slots[(st_pos + i) & mask].slot_state;
+            }
+            if (st_count > 0) {
+                dequeue_pos.store(st_pos + st_count, std::memory_order_release);
+            }
+            return st_count;
+        }
+
         uint64_t pos;
         int count;
         while (true) {
@@ -342,6 +404,11 @@ struct alignas(64) PTO2ReadyQueue {
 
 #if PTO2_SCHED_PROFILING
     int pop_batch(PTO2TaskSlotState **out, int max_count, uint64_t &atomic_count, uint64_t &wait_cycle) {
+        if (single_thread) {
+            (void)wait_cycle;
+            atomic_count += 3;  // dequeue_pos.load + enqueue_pos.load + dequeue_pos.store
+            return pop_batch(out, max_count);
+        }
         uint64_t pos;
         int count;
         uint64_t t0 = get_sys_cnt_aicpu();
@@ -400,100 +467,21 @@ struct alignas(64) PTO2ReadyQueue {
 };
 
 // Cold-path ready queue operations (defined in pto_scheduler.cpp)
-bool pto2_ready_queue_init(PTO2ReadyQueue *queue, uint64_t capacity);
+bool pto2_ready_queue_init(PTO2ReadyQueue *queue, uint64_t capacity, bool single_thread = false);
 void pto2_ready_queue_destroy(PTO2ReadyQueue *queue);
+void pto2_ready_queue_reset(PTO2ReadyQueue *queue);  // Re-empty without reallocating (endpoints idle)
 
 // =============================================================================
 // SPSC Queue (Single-Producer Single-Consumer, wait-free)
 // =============================================================================
 //
-// Bounded ring buffer optimized for the wiring queue use case:
+// Implementation lives in the shared runtime core (src/common/runtime_core)
+// so both chip generations pick up fixes together. Instantiated here for the
+// wiring queue use case:
 //   - Producer: orchestrator thread (push)
 //   - Consumer: scheduler thread 0 (pop_batch)
-//
-// Design based on Rigtorp's cached-index technique: each side caches
-// the other's index locally, avoiding cross-core cache line bouncing
-// on the hot path. Only when the local cache says "full" or "empty"
-// does the thread issue an acquire load on the remote index.
-//
-// Memory layout: 4 cache-line-aligned fields ensure zero false sharing.
-
-struct PTO2SpscQueue {
-    // --- Producer cache lines (orchestrator thread) ---
-    alignas(64) std::atomic<uint64_t> head_{0};
-    alignas(64) uint64_t tail_cached_{0};
-
-    // --- Consumer cache lines (scheduler thread 0) ---
-    alignas(64) std::atomic<uint64_t> tail_{0};
-    alignas(64) uint64_t head_cached_{0};
-
-    // --- Shared (immutable after init) ---
-    PTO2TaskSlotState **buffer_{nullptr};
-    uint64_t mask_{0};
-
-    bool init(uint64_t capacity) {
-        if (capacity == 0 || (capacity & (capacity - 1)) != 0) return false;
-        buffer_ = static_cast<PTO2TaskSlotState **>(calloc(capacity, sizeof(PTO2TaskSlotState *)));
-        if (!buffer_) return false;
-        mask_ = capacity - 1;
-        head_.store(0, std::memory_order_relaxed);
-        tail_.store(0, std::memory_order_relaxed);
-        tail_cached_ = 0;
-        head_cached_ = 0;
-        return true;
-    }
 
-    void destroy() {
-        if (buffer_) {
-            free(buffer_);
-            buffer_ = nullptr;
-        }
-    }
-
-    // Push one item (producer only). Returns false if queue is full.
-    // Full condition: next_h - tail > mask_ (i.e. > capacity-1), so the
-    // effective usable capacity is capacity-1 (one slot is wasted as a
-    // sentinel to distinguish full from empty). uint64_t wrapping is safe
-    // since head and tail are monotonically increasing and subtraction
-    // wraps correctly.
-    bool push(PTO2TaskSlotState *item) {
-        uint64_t h = head_.load(std::memory_order_relaxed);
-        uint64_t next_h = h + 1;
-        if (next_h - tail_cached_ > mask_) {
-            tail_cached_ = tail_.load(std::memory_order_acquire);
-            if (next_h - tail_cached_ > mask_) {
-                return false;
-            }
-        }
-        buffer_[h & mask_] = item;
-        head_.store(next_h, std::memory_order_release);
-        return true;
-    }
-
-    // Pop up to max_count items (consumer only). Returns actual count.
-    int pop_batch(PTO2TaskSlotState **out, int max_count) {
-        uint64_t t = tail_.load(std::memory_order_relaxed);
-        uint64_t avail = head_cached_ - t;
-        if (avail == 0) {
-            head_cached_ = head_.load(std::memory_order_acquire);
-            avail = head_cached_ - t;
-            if (avail == 0) return 0;
-        }
-        int count = (avail < static_cast<uint64_t>(max_count)) ? static_cast<int>(avail) : max_count;
-        for (int i = 0; i < count; i++) {
-            out[i] = buffer_[(t + i) & mask_];
-        }
-        tail_.store(t + count, std::memory_order_release);
-        return count;
-    }
-
-    // Approximate size (used for backoff decisions, not exact).
-    uint64_t size() const {
-        uint64_t h = head_.load(std::memory_order_acquire);
-        uint64_t t = tail_.load(std::memory_order_acquire);
-        return h - t;
-    }
-};
+using PTO2SpscQueue = PTO2SpscQueueT<PTO2TaskSlotState *>;
 
 // =============================================================================
 // Scheduler State
@@ -533,8 +521,22 @@ struct PTO2SchedulerState {
         // --- Wiring hot path (thread 0 only, isolated from completion traffic) ---
         alignas(64) PTO2DepListPool dep_pool;
 
+        // Per-producer fanout append cursor (thread 0 only, parallel to
+        // slot_states — PTO2TaskSlotState is a full cache line and cannot
+        // grow). Consumers are packed into contiguous dep_pool runs that
+        // grow PTO2_DEP_CHUNK_MIN -> x4 -> PTO2_DEP_CHUNK_MAX, so the
+        // producer's completion walk scans sequential memory.
+        struct FanoutWireState {
+            PTO2DepListEntry *next_entry;  // Next free entry in the current run
+            PTO2DepListEntry *tail;        // Last appended entry (link point)
+            int16_t run_free;              // Unused entries left in the current run
+            int16_t run_size;              // Current run size (0 = none allocated yet)
+        };
+        FanoutWireState *fanout_wire_states;
+
         bool init(PTO2SharedMemoryHandle *sm_handle, int32_t ring_id);
         void destroy();
+        void reset();  // Re-empty all slot/wire state without reallocating
 
         PTO2TaskSlotState &get_slot_state_by_task_id(int32_t local_id) {
             return slot_states[local_id & task_window_mask];
@@ -543,25 +545,72 @@ struct PTO2SchedulerState {
 
         void sync_to_sm(PTO2SharedMemoryRingHeader &ring) {
             ring.fc.last_task_alive.store(last_task_alive, std::memory_order_release);
+            pto2_shadow_on_retire(&ring.fc.last_task_alive, last_task_alive, &ring.fc.current_task_index);
         }
 
         void advance_ring_pointers(PTO2SharedMemoryRingHeader &ring) {
-            int32_t current_task_index = ring.fc.current_task_index.load(std::memory_order_acquire);
+            // Relaxed: current_task_index is only a bound for the walk, and a
+            // stale-low read just advances less this round. Nothing published
+            // with it is read here — monotonic local ids guarantee the slots
+            // scanned below belong to occupants at or past last_task_alive,
+            // and each slot's own acquire load imports its retirement.
+            int32_t current_task_index = ring.fc.current_task_index.load(std::memory_order_relaxed);
+            int32_t before = last_task_alive;
 
             while (last_task_alive < current_task_index) {
                 PTO2TaskSlotState &slot_state = get_slot_state_by_task_id(last_task_alive);
-                if (slot_state.task_state.load(std::memory_order_acquire) != PTO2_TASK_CONSUMED) {
+                if (!(slot_state.state_word.load(std::memory_order_acquire) & PTO2_STATE_CONSUMED_BIT)) {
                     break;
                 }
                 last_task_alive++;
             }
 
             sync_to_sm(ring);
+
+            // Ring the reclaim doorbell only on real progress so a blocked
+            // orchestrator wakes exactly when reclamation happened.
+            if (last_task_alive != before) {
+                ring.fc.reclaim_doorbell.fetch_add(1, std::memory_order_release);
+            }
         }
     } ring_sched_states[PTO2_MAX_RING_DEPTH];
 
-    // Ready queues remain global (scheduling is ring-agnostic)
+    // Ready queues remain global (scheduling is ring-agnostic).
+    // Two lanes per shape: tasks submitted with launch_spec.high_priority()
+    // go to the high lane and are popped first (with an anti-starvation
+    // credit — see get_ready_tasks_batch).
     PTO2ReadyQueue ready_queues[PTO2_NUM_RESOURCE_SHAPES];
+    PTO2ReadyQueue ready_queues_high[PTO2_NUM_RESOURCE_SHAPES];
+
+    // Shape-occupancy bitmap over the global ready queues: bit `shape` for
+    // the normal lane, bit `shape + PTO2_NUM_RESOURCE_SHAPES` for the high
+    // lane. Push sites set the bit after their enqueue lands; the batch pop
+    // skips a lane whose bit is clear and clears the bit only after an empty
+    // probe, re-checking size() so a racing push is never hidden. The mask
+    // is a filter, not an authority — a stale set bit costs one wasted MPMC
+    // probe, a clear bit never masks queued work.
+    std::atomic<uint32_t> ready_shape_occupancy;
+
+    static constexpr uint32_t occupancy_bit(int32_t shape_idx, bool high) {
+        return 1u << (shape_idx + (high ? PTO2_NUM_RESOURCE_SHAPES : 0));
+    }
+
+    // Per-shape pop round counter driving the anti-starvation credit.
+    // Relaxed RMW only — a lost update merely shifts which round yields.
+    std::atomic<uint32_t> prio_pop_rounds[PTO2_NUM_RESOURCE_SHAPES];
+
+    // Aging promotion: sys-counter stamp of the oldest un-serviced push into
+    // each shape's normal lane, 0 while the lane is drained. The lane is
+    // FIFO, so this single stamp IS the head task's age — no per-payload
+    // timestamp is needed. Relaxed accesses only: the stamp feeds a
+    // lane-order heuristic, and a stamp lost to a rare push/drain race is
+    // re-covered by the round-robin credit (see normal_lane_first).
+    std::atomic<uint64_t> normal_lane_oldest[PTO2_NUM_RESOURCE_SHAPES];
+
+    // Work stealing: each scheduler thread registers its per-shape local
+    // buffer array here so idle threads can steal ready tasks directly
+    // instead of waiting for the owner's end-of-iteration flush.
+    std::atomic<PTO2LocalReadyBuffer *> thread_local_bufs[PLATFORM_MAX_AICPU_THREADS];
 
     // Global wiring batch buffer — thread 0 only, tight layout for cache locality.
     // count(4B) + index(4B) + batch[31](248B) = 256B = exactly 4 cache lines.
@@ -595,9 +644,9 @@ struct PTO2SchedulerState {
 
     /**
      * Drain wiring queue: pop submitted tasks and wire their fanout edges.
-     * Called by scheduler thread 0 each loop iteration. Sets fanin_count,
-     * acquires fanout_lock per producer, allocates dep_pool entries, and
-     * pushes ready tasks to the appropriate ready queue.
+     * Called by scheduler thread 0 each loop iteration. Seeds the fanin
+     * counter, acquires fanout_lock per producer, allocates dep_pool entries,
+     * and pushes ready tasks to the appropriate ready queue.
      *
      * @return Number of tasks wired this call.
      */
@@ -629,10 +678,16 @@ struct PTO2SchedulerState {
             auto &rss = ring_sched_states[ring_id];
             int32_t wfanin = ws->payload->fanin_actual_count;
 
-            if (wfanin > 0 && rss.dep_pool.available() < wfanin) {
-                rss.dep_pool.reclaim(*this, ring_id, rss.last_task_alive);
-                if (wfanin > 0 && rss.dep_pool.available() < wfanin) {
-                    break;  // not enough dep_pool space — keep remainder for next call
+            // Quick gate: reserving a fresh run per producer costs at most
+            // 2 * PTO2_DEP_CHUNK_MAX entries (run + worst-case wrap padding).
+            // Only compute the precise need when the pool is actually tight.
+            if (wfanin > 0 && rss.dep_pool.available() < wfanin * 2 * PTO2_DEP_CHUNK_MAX) {
+                int32_t dep_need = wiring_dep_need(ws->payload);
+                if (dep_need > 0 && rss.dep_pool.available() < dep_need) {
+                    rss.dep_pool.reclaim(*this, ring_id, rss.last_task_alive);
+                    if (rss.dep_pool.available() < dep_need) {
+                        break;  // not enough dep_pool space — keep remainder for next call
+                    }
                 }
             }
 
@@ -645,35 +700,105 @@ struct PTO2SchedulerState {
     }
 
     /**
-     * Wire fanout edges for a single task. Sets fanin_count, acquires each
-     * producer's fanout_lock, allocates dep_pool entries for live producers,
-     * pushes the task to the ready queue once its fanin refcount is satisfied.
+     * Next fanout run size for a producer: PTO2_DEP_CHUNK_MIN on first
+     * allocation, then x4 growth capped at PTO2_DEP_CHUNK_MAX.
+     */
+    static int32_t next_fanout_run_size(int32_t cur) {
+        if (cur == 0) return PTO2_DEP_CHUNK_MIN;
+        int32_t next = cur * 4;
+        return next < PTO2_DEP_CHUNK_MAX ? next : PTO2_DEP_CHUNK_MAX;
+    }
+
+    /**
+     * Worst-case dep_pool entries needed to wire one task: each producer whose
+     * current run is exhausted needs a fresh run plus up to a run of padding
+     * if the allocation would straddle the pool's wrap-around boundary.
+     * Conservative: producers that turn out to be already completed need none.
+     */
+    int32_t wiring_dep_need(PTO2TaskPayload *wp) {
+        int32_t need = 0;
+        pto2_for_each_fanin_slot_state(*wp, [&](PTO2TaskSlotState *producer) {
+            auto &prs = ring_sched_states[producer->ring_id];
+            auto &pw = prs.fanout_wire_states[producer - prs.slot_states];
+            if (pw.run_free == 0) {
+                need += 2 * next_fanout_run_size(pw.run_size);
+            }
+        });
+        return need;
+    }
+
+    /**
+     * Append consumer `ws` to `producer`'s fanout list. Entries come from the
+     * producer's per-slot contiguous run, refilled from the wiring task's ring
+     * pool (`rss`) when exhausted — dep_pool_mark of the wiring task covers
+     * the run, preserving the implicit reclamation with the task ring.
+     * Caller holds the producer's fanout_lock.
+     */
+    void append_fanout_entry(RingSchedState &rss, PTO2TaskSlotState *producer, PTO2TaskSlotState *ws) {
+        auto &prs = ring_sched_states[producer->ring_id];
+        auto &pw = prs.fanout_wire_states[producer - prs.slot_states];
+        if (pw.run_free == 0) {
+            int32_t run = next_fanout_run_size(pw.run_size);
+            PTO2DepListEntry *chunk = rss.dep_pool.alloc_run(run);
+            if (!chunk) return;  // fatal — error code already posted by the pool
+            pw.next_entry = chunk;
+            pw.run_free = static_cast<int16_t>(run);
+            pw.run_size = static_cast<int16_t>(run);
+        }
+        PTO2DepListEntry *entry = pw.next_entry++;
+        pw.run_free--;
+        entry->slot_state = ws;
+        entry->next = nullptr;
+        if (pw.tail != nullptr) {
+            pw.tail->next = entry;
+        } else {
+            producer->fanout_head = entry;
+        }
+        pw.tail = entry;
+    }
+
+    /**
+     * Wire fanout edges for a single task. Seeds the remaining-fanin counter,
+     * acquires each producer's fanout_lock, appends dep_pool entries for live
+     * producers, pushes the task to the ready queue once all fanin releases
+     * (including the wiring redundance release applied below) are in.
      */
     void wire_task(RingSchedState &rss, PTO2TaskSlotState *ws, int32_t wfanin) {
         PTO2TaskPayload *wp = ws->payload;
-        ws->fanin_count = wfanin + 1;
-
+        // Seed the down-counter with fanin_count = wfanin + 1 (the +1 is the
+        // wiring redundance released at the end of this call, so the crossing
+        // cannot happen before wiring finishes). Plain store is safe: releases
+        // only flow through fanout entries, and the first entry referencing
+        // this slot is appended below — after the store, ordered by the
+        // producer's fanout_lock.
+        ws->state_word.store(static_cast<uint64_t>(wfanin) + 1, std::memory_order_relaxed);
+
+        // Reset this slot's fanout append cursor from any previous occupant.
+        // Safe without the lock: every consumer listing this task was submitted
+        // after it and is therefore wired after this call (FIFO wiring order).
+        rss.fanout_wire_states[static_cast<int32_t>(ws - rss.slot_states)] = {};
+
+        int32_t early_finished = 0;
         if (wfanin != 0) {
-            int32_t early_finished = 0;
             pto2_for_each_fanin_slot_state(*wp, [&](PTO2TaskSlotState *producer) {
                 pto2_fanout_lock(*producer);
-                int32_t pstate = producer->task_state.load(std::memory_order_acquire);
-                if (pstate >= PTO2_TASK_COMPLETED) {
+                uint64_t pword = producer->state_word.load(std::memory_order_acquire);
+                if (pword & PTO2_STATE_COMPLETED_BIT) {
                     early_finished++;
                 } else {
-                    producer->fanout_head = rss.dep_pool.prepend(producer->fanout_head, ws);
+                    append_fanout_entry(rss, producer, ws);
                 }
                 pto2_fanout_unlock(*producer);
             });
+        }
 
-            int32_t init_rc = early_finished + 1;
-            int32_t new_rc = ws->fanin_refcount.fetch_add(init_rc, std::memory_order_acq_rel) + init_rc;
-            if (new_rc >= ws->fanin_count) {
-                ready_queues[static_cast<int32_t>(pto2_active_mask_to_shape(ws->active_mask))].push(ws);
-            }
-        } else {
-            ws->fanin_refcount.fetch_add(1, std::memory_order_acq_rel);
-            ready_queues[static_cast<int32_t>(pto2_active_mask_to_shape(ws->active_mask))].push(ws);
+        // Apply the already-completed producers' releases plus the redundance
+        // in one RMW; the crossing test below is exact because the counter
+        // never undershoots (total releases == seeded fanin_count).
+        uint64_t init_rc = static_cast<uint64_t>(early_finished) + 1;
+        uint64_t prev = ws->state_word.fetch_sub(init_rc, std::memory_order_acq_rel);
+        if (pto2_fanin_remaining(prev) == init_rc) {
+            claim_ready_and_push(*ws);
         }
 
         ws->dep_pool_mark = rss.dep_pool.top;
@@ -688,12 +813,32 @@ struct PTO2SchedulerState {
     }
 
     void check_and_handle_consumed(PTO2TaskSlotState &slot_state) {
-        if (slot_state.fanout_refcount.load(std::memory_order_acquire) != slot_state.fanout_count) return;
+        // The refcount acquire is load-bearing, not a recycling guard: when a
+        // deferred self-check retires the task, it is the edge that orders
+        // every consumer's release (and the reads behind it) before the
+        // CONSUMED flip and the heap reuse it unlocks.
+        if (slot_state.fanout_refcount.load(std::memory_order_acquire) !=
+            slot_state.fanout_count.load(std::memory_order_relaxed))
+            return;
 
-        PTO2TaskState expected = PTO2_TASK_COMPLETED;
-        if (!slot_state.task_state.compare_exchange_strong(
-                expected, PTO2_TASK_CONSUMED, std::memory_order_acq_rel, std::memory_order_acquire
-            )) {
+        // Claim retirement with a single fetch_or: COMPLETED is monotone so
+        // the pre-check cannot go stale, and the returned word tells the one
+        // caller that flipped CONSUMED apart from every racer. The pre-check
+        // load is relaxed: it is a pure filter (the acq_rel fetch_or re-reads
+        // the word authoritatively), and a stale holder of this slot is
+        // structurally impossible — every caller pins the occupant through a
+        // live reference (the owning scope or an unreleased fanin edge), and
+        // generation-counted task ids (see pto_task_id.h) never repeat.
+        uint64_t word = slot_state.state_word.load(std::memory_order_relaxed);
+        if ((word & (PTO2_STATE_COMPLETED_BIT | PTO2_STATE_CONSUMED_BIT)) != PTO2_STATE_COMPLETED_BIT) {
+            return;
+        }
+        // Capture the donation hold before flipping CONSUMED: the flip is
+        // what licenses slot reuse, after which the payload may already be
+        // rewritten by the next occupant.
+        PTO2TaskSlotState *donated_producer = slot_state.payload->donated_producer;
+        uint64_t prev = slot_state.state_word.fetch_or(PTO2_STATE_CONSUMED_BIT, std::memory_order_acq_rel);
+        if (prev & PTO2_STATE_CONSUMED_BIT) {
             return;
         }
 
@@ -701,6 +846,13 @@ struct PTO2SchedulerState {
         tasks_consumed.fetch_add(1, std::memory_order_relaxed);
 #endif
 
+        // Release the donated producer before advancing the ring so one
+        // advance pass covers a same-ring producer this release retires.
+        // Recursion depth is bounded by the donation chain length.
+        if (donated_producer != nullptr) {
+            release_producer(*donated_producer);
+        }
+
         int32_t ring_id = slot_state.ring_id;
         // Try-lock — if another thread is advancing this ring, it will scan our CONSUMED task
         int32_t expected_lock = 0;
@@ -714,27 +866,33 @@ struct PTO2SchedulerState {
 
 #if PTO2_ORCH_PROFILING || PTO2_SCHED_PROFILING
     void check_and_handle_consumed(PTO2TaskSlotState &slot_state, uint64_t &atomic_count) {
-        int32_t fc = slot_state.fanout_count;
+        int32_t fc = slot_state.fanout_count.load(std::memory_order_relaxed);
         int32_t rc = slot_state.fanout_refcount.load(std::memory_order_acquire);
 
         atomic_count += 2;  // fanout_count.load + fanout_refcount.load
 
         if (rc != fc) return;
 
-        PTO2TaskState expected = PTO2_TASK_COMPLETED;
-        if (!slot_state.task_state.compare_exchange_strong(
-                expected, PTO2_TASK_CONSUMED, std::memory_order_acq_rel, std::memory_order_acquire
-            )) {
-            atomic_count += 1;  // failed CAS
+        uint64_t word = slot_state.state_word.load(std::memory_order_relaxed);
+        atomic_count += 1;  // state_word.load (relaxed pre-filter — see non-profiling variant)
+        if ((word & (PTO2_STATE_COMPLETED_BIT | PTO2_STATE_CONSUMED_BIT)) != PTO2_STATE_COMPLETED_BIT) {
+            return;
+        }
+        PTO2TaskSlotState *donated_producer = slot_state.payload->donated_producer;
+        uint64_t prev = slot_state.state_word.fetch_or(PTO2_STATE_CONSUMED_BIT, std::memory_order_acq_rel);
+        atomic_count += 1;  // state_word.fetch_or(CONSUMED)
+        if (prev & PTO2_STATE_CONSUMED_BIT) {
             return;
         }
-
-        atomic_count += 1;  // successful CAS
 
 #if PTO2_SCHED_PROFILING
         tasks_consumed.fetch_add(1, std::memory_order_relaxed);
 #endif
 
+        if (donated_producer != nullptr) {
+            release_producer(*donated_producer, atomic_count);
+        }
+
         int32_t ring_id = slot_state.ring_id;
         // Try-lock — if another thread is advancing this ring, it will scan our CONSUMED task
         int32_t expected_lock = 0;
@@ -763,42 +921,201 @@ struct PTO2SchedulerState {
     }
 #endif
 
-    bool release_fanin_and_check_ready(PTO2TaskSlotState &slot_state, PTO2LocalReadyBuffer *local_bufs = nullptr) {
-        // Atomically increment fanin_refcount and check if all producers are done
-        // ACQ_REL on fanin_refcount already synchronizes with the orchestrator's
-        // init release, making fanin_count visible — plain load suffices.
-        int32_t new_refcount = slot_state.fanin_refcount.fetch_add(1, std::memory_order_acq_rel) + 1;
-
-        if (new_refcount == slot_state.fanin_count) {
-            // Local-first: try per-CoreType thread-local buffer before global queue
-            // Route by active_mask: AIC-containing tasks → buf[0], AIV-only → buf[1]
-            PTO2ResourceShape shape = pto2_active_mask_to_shape(slot_state.active_mask);
-            if (!local_bufs || !local_bufs[static_cast<int32_t>(shape)].try_push(&slot_state)) {
-                ready_queues[static_cast<int32_t>(shape)].push(&slot_state);
+    /**
+     * Route a task to its ready queue lane: shape by active_mask core bits,
+     * lane by the high-priority flag. Used by every push site (ready
+     * transition and executor requeues) so a task never changes lane.
+     */
+    PTO2ReadyQueue &ready_queue_for(const PTO2TaskSlotState &slot_state) {
+        int32_t shape = static_cast<int32_t>(pto2_active_mask_to_shape(slot_state.active_mask));
+        return pto2_is_high_priority(slot_state.active_mask) ? ready_queues_high[shape] : ready_queues[shape];
+    }
+
+    // Flag the task's (shape, lane) pair occupied. Relaxed is enough: the
+    // queue's own release publication carries the data, and the clear side
+    // re-checks size() after every empty probe.
+    void mark_ready_occupied(const PTO2TaskSlotState &slot_state) {
+        int32_t shape = static_cast<int32_t>(pto2_active_mask_to_shape(slot_state.active_mask));
+        bool high = pto2_is_high_priority(slot_state.active_mask);
+        ready_shape_occupancy.fetch_or(occupancy_bit(shape, high), std::memory_order_relaxed);
+        if (!high) {
+            note_normal_push(shape);
+        }
+    }
+
+    // Start the normal lane's age clock on the first push into a drained
+    // lane. Only the 0 -> now transition is stamped, so a busy lane pays one
+    // relaxed load per push; the CAS tolerates racing pushes (whichever
+    // lands is within one push of the true head age).
+    void note_normal_push(int32_t shape_idx) {
+        if (PTO2_PRIO_AGING_TICKS == 0) {
+            return;
+        }
+        if (normal_lane_oldest[shape_idx].load(std::memory_order_relaxed) == 0) {
+            uint64_t expected = 0;
+            normal_lane_oldest[shape_idx].compare_exchange_strong(
+                expected, get_sys_cnt_aicpu(), std::memory_order_relaxed
+            );
+        }
+    }
+
+    // After servicing the normal lane, restart its age clock: the new head
+    // (if any) was pushed after the old stamp, so stamping `now` under-ages
+    // it by at most one service interval — promotion is delayed, never lost.
+    void refresh_normal_age(int32_t shape_idx) {
+        if (PTO2_PRIO_AGING_TICKS == 0) {
+            return;
+        }
+        normal_lane_oldest[shape_idx].store(
+            ready_queues[shape_idx].size() == 0 ? 0 : get_sys_cnt_aicpu(), std::memory_order_relaxed
+        );
+    }
+
+    // Push to the global queue and flag its lane occupied — the path every
+    // out-of-line push site (executor requeues included) must take so the
+    // bitmap gate never hides queued work.
+    void push_ready_global(PTO2TaskSlotState *slot_state) {
+        ready_queue_for(*slot_state).push(slot_state);
+        mark_ready_occupied(*slot_state);
+    }
+
+    /**
+     * Claim a task whose fanin releases are all applied (PENDING→READY) and
+     * push it to its ready queue. The fetch_or makes the crossing release
+     * caller and the executor's speculative pending-slot staging mutually
+     * exclusive: the one caller that sees READY clear in the returned word
+     * owns the task's dispatch. The COMPLETED test keeps inline-completed
+     * tasks (hidden allocs, finished before wiring) off the ready queues.
+     */
+    bool claim_ready_and_push(PTO2TaskSlotState &slot_state, PTO2LocalReadyBuffer *local_bufs = nullptr) {
+        uint64_t prev = slot_state.state_word.fetch_or(PTO2_STATE_READY_BIT, std::memory_order_acq_rel);
+        if (prev & (PTO2_STATE_READY_BIT | PTO2_STATE_COMPLETED_BIT)) {
+            return false;
+        }
+        // Local-first: try per-CoreType thread-local buffer before global queue
+        // Route by active_mask: AIC-containing tasks → buf[0], AIV-only → buf[1]
+        PTO2ResourceShape shape = pto2_active_mask_to_shape(slot_state.active_mask);
+        if (!local_bufs || !local_bufs[static_cast<int32_t>(shape)].try_push(&slot_state)) {
+            ready_queue_for(slot_state).push(&slot_state);
+            mark_ready_occupied(slot_state);
+        }
+        return true;
+    }
+
+    /**
+     * Speculative claim: find a consumer of `producer` whose only outstanding
+     * fanin release is `producer`'s own, and claim it (PENDING→READY) without
+     * pushing it to a ready queue. The executor stages the claimed task into
+     * the pending payload slot of the core running `producer`, so the hardware
+     * flips to it the moment the producer's done-bit lands.
+     *
+     * Validity of the claim: while `producer` is below COMPLETED its fanout
+     * walk has not run, so its release of each consumer is still outstanding
+     * (r releases for a duplicate edge with r repeats). A consumer observed
+     * with remaining fanin == 1 therefore has exactly the producer's single
+     * release missing — every other producer and the wiring redundance have
+     * already been applied. The READY fetch_or closes the race with a
+     * concurrent crossing release: exactly one side wins the dispatch.
+     *
+     * Only single-block tasks of the given shape qualify (a staged task runs
+     * on exactly one core), and sync_start tasks are excluded as in the
+     * regular pending-dispatch phase.
+     */
+    PTO2TaskSlotState *try_claim_ready_successor(
+        PTO2TaskSlotState &producer, PTO2ResourceShape shape, int32_t scan_max
+    ) {
+        PTO2TaskSlotState *claimed = nullptr;
+        pto2_fanout_lock(producer);
+        if (!(producer.state_word.load(std::memory_order_acquire) & PTO2_STATE_COMPLETED_BIT)) {
+            PTO2DepListEntry *entry = producer.fanout_head;
+            for (int32_t scanned = 0; entry != nullptr && scanned < scan_max; entry = entry->next, scanned++) {
+                PTO2TaskSlotState *consumer = entry->slot_state;
+                if (consumer->logical_block_num > 1) continue;
+                if (pto2_requires_sync_start(consumer->active_mask)) continue;
+                if (pto2_active_mask_to_shape(consumer->active_mask) != shape) continue;
+                // One load snapshots remaining fanin and state together.
+                uint64_t cword = consumer->state_word.load(std::memory_order_acquire);
+                if (pto2_fanin_remaining(cword) != 1) continue;
+                if (cword & PTO2_STATE_READY_BIT) continue;
+                uint64_t prev = consumer->state_word.fetch_or(PTO2_STATE_READY_BIT, std::memory_order_acq_rel);
+                if (!(prev & PTO2_STATE_READY_BIT)) {
+                    claimed = consumer;
+                    break;
+                }
             }
-            return true;
+        }
+        pto2_fanout_unlock(producer);
+        return claimed;
+    }
+
+    bool release_fanin_and_check_ready(PTO2TaskSlotState &slot_state, PTO2LocalReadyBuffer *local_bufs = nullptr) {
+        // Single branch-free RMW: count the remaining-fanin field down and
+        // read the crossing straight out of the returned word — the caller
+        // whose decrement lands on 0 is unique, no separate count compare.
+        uint64_t prev = slot_state.state_word.fetch_sub(1, std::memory_order_acq_rel);
+
+        if (pto2_fanin_remaining(prev) == 1) {
+            return claim_ready_and_push(slot_state, local_bufs);
+        }
+        return false;
+    }
+
+    /**
+     * Coalesced fanin release: apply `n` releases with a single RMW.
+     * Exactly one caller observes the counter crossing to 0 (its returned
+     * remaining equals its own decrement), so the ready push still happens
+     * once even when releases arrive batched.
+     */
+    bool release_fanin_n_and_check_ready(
+        PTO2TaskSlotState &slot_state, int32_t n, PTO2LocalReadyBuffer *local_bufs = nullptr
+    ) {
+        uint64_t prev = slot_state.state_word.fetch_sub(static_cast<uint64_t>(n), std::memory_order_acq_rel);
+
+        if (pto2_fanin_remaining(prev) == static_cast<uint32_t>(n)) {
+            return claim_ready_and_push(slot_state, local_bufs);
         }
         return false;
     }
 
 #if PTO2_ORCH_PROFILING || PTO2_SCHED_PROFILING
+    bool release_fanin_n_and_check_ready(
+        PTO2TaskSlotState &slot_state, int32_t n, uint64_t &atomic_count, uint64_t &push_wait,
+        PTO2LocalReadyBuffer *local_bufs = nullptr
+    ) {
+        uint64_t prev = slot_state.state_word.fetch_sub(static_cast<uint64_t>(n), std::memory_order_acq_rel);
+        atomic_count += 1;  // state_word.fetch_sub
+
+        if (pto2_fanin_remaining(prev) == static_cast<uint32_t>(n)) {
+            uint64_t claim = slot_state.state_word.fetch_or(PTO2_STATE_READY_BIT, std::memory_order_acq_rel);
+            atomic_count += 1;  // state_word.fetch_or(READY)
+            if (!(claim & (PTO2_STATE_READY_BIT | PTO2_STATE_COMPLETED_BIT))) {
+                PTO2ResourceShape shape = pto2_active_mask_to_shape(slot_state.active_mask);
+                if (!local_bufs || !local_bufs[static_cast<int32_t>(shape)].try_push(&slot_state)) {
+                    ready_queue_for(slot_state).push(&slot_state, atomic_count, push_wait);
+                    mark_ready_occupied(slot_state);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
     bool release_fanin_and_check_ready(
         PTO2TaskSlotState &slot_state, uint64_t &atomic_count, uint64_t &push_wait,
         PTO2LocalReadyBuffer *local_bufs = nullptr
     ) {
-        int32_t new_refcount = slot_state.fanin_refcount.fetch_add(1, std::memory_order_acq_rel) + 1;
-        atomic_count += 1;  // fanin_refcount.fetch_add
+        uint64_t prev = slot_state.state_word.fetch_sub(1, std::memory_order_acq_rel);
+        atomic_count += 1;  // state_word.fetch_sub
 
-        if (new_refcount == slot_state.fanin_count) {
-            PTO2TaskState expected = PTO2_TASK_PENDING;
-            if (slot_state.task_state.compare_exchange_strong(
-                    expected, PTO2_TASK_READY, std::memory_order_acq_rel, std::memory_order_acquire
-                )) {
-                atomic_count += 1;  // CAS(task_state PENDING→READY)
+        if (pto2_fanin_remaining(prev) == 1) {
+            uint64_t claim = slot_state.state_word.fetch_or(PTO2_STATE_READY_BIT, std::memory_order_acq_rel);
+            atomic_count += 1;  // state_word.fetch_or(READY)
+            if (!(claim & (PTO2_STATE_READY_BIT | PTO2_STATE_COMPLETED_BIT))) {
                 // Local-first: try per-CoreType thread-local buffer before global queue
                 PTO2ResourceShape shape = pto2_active_mask_to_shape(slot_state.active_mask);
                 if (!local_bufs || !local_bufs[static_cast<int32_t>(shape)].try_push(&slot_state)) {
-                    ready_queues[static_cast<int32_t>(shape)].push(&slot_state, atomic_count, push_wait);
+                    ready_queue_for(slot_state).push(&slot_state, atomic_count, push_wait);
+                    mark_ready_occupied(slot_state);
                 }
                 return true;
             }
@@ -807,16 +1124,74 @@ struct PTO2SchedulerState {
     }
 #endif
 
+    /**
+     * Pick the lane order for a global pop: high lane first, except every
+     * PTO2_PRIO_STARVATION_INTERVAL-th round, which services the normal lane
+     * first so a sustained high-priority stream cannot starve bulk work.
+     * Aging promotion sharpens the round-robin credit: once the normal
+     * lane's head has waited PTO2_PRIO_AGING_TICKS, every pop services the
+     * normal lane first until the aged head drains, bounding bulk-task
+     * latency in wall time rather than in high-priority pop rounds.
+     */
+    bool normal_lane_first(PTO2ResourceShape shape) {
+        int32_t si = static_cast<int32_t>(shape);
+        uint32_t round = prio_pop_rounds[si].fetch_add(1, std::memory_order_relaxed);
+        if ((round % PTO2_PRIO_STARVATION_INTERVAL) == (PTO2_PRIO_STARVATION_INTERVAL - 1)) {
+            return true;
+        }
+        if (PTO2_PRIO_AGING_TICKS == 0) {
+            return false;
+        }
+        uint64_t oldest = normal_lane_oldest[si].load(std::memory_order_relaxed);
+        return oldest != 0 && get_sys_cnt_aicpu() - oldest > static_cast<uint64_t>(PTO2_PRIO_AGING_TICKS);
+    }
+
+    /**
+     * Bitmap-gated lane probe: skip the MPMC pop entirely when the lane's
+     * occupancy bit is clear. An empty probe clears the bit and then
+     * re-checks size() — a push that raced the probe re-sets the bit here,
+     * so the mask can hide at most one redundant probe, never queued work.
+     */
+    int pop_lane_batch(PTO2ReadyQueue &lane, uint32_t bit, PTO2TaskSlotState **out, int max_count) {
+        if (!(ready_shape_occupancy.load(std::memory_order_relaxed) & bit)) return 0;
+        int n = lane.pop_batch(out, max_count);
+        if (n == 0) {
+            ready_shape_occupancy.fetch_and(~bit, std::memory_order_relaxed);
+            if (lane.size() != 0) {
+                ready_shape_occupancy.fetch_or(bit, std::memory_order_relaxed);
+            }
+        }
+        return n;
+    }
+
     int get_ready_tasks_batch(
         PTO2ResourceShape shape, PTO2LocalReadyBuffer &local_buf, PTO2TaskSlotState **out, int max_count
     ) {
         int count = 0;
-        while (count < max_count && local_buf.count > 0) {
-            out[count++] = local_buf.slot_states[--local_buf.count];
+        while (count < max_count) {
+            PTO2TaskSlotState *s = local_buf.pop();
+            if (s == nullptr) break;
+            out[count++] = s;
         }
         int remaining = max_count - count;
         if (remaining > 0) {
-            count += ready_queues[static_cast<int32_t>(shape)].pop_batch(out + count, remaining);
+            int32_t si = static_cast<int32_t>(shape);
+            bool normal_first = normal_lane_first(shape);
+            PTO2ReadyQueue &first = normal_first ? ready_queues[si] : ready_queues_high[si];
+            PTO2ReadyQueue &second = normal_first ? ready_queues_high[si] : ready_queues[si];
+            uint32_t first_bit = occupancy_bit(si, !normal_first);
+            uint32_t second_bit = occupancy_bit(si, normal_first);
+            int n_first = pop_lane_batch(first, first_bit, out + count, remaining);
+            count += n_first;
+            remaining = max_count - count;
+            int n_second = 0;
+            if (remaining > 0) {
+                n_second = pop_lane_batch(second, second_bit, out + count, remaining);
+                count += n_second;
+            }
+            if ((normal_first ? n_first : n_second) > 0) {
+                refresh_normal_age(si);
+            }
         }
         return count;
     }
@@ -827,19 +1202,84 @@ struct PTO2SchedulerState {
         uint64_t &atomic_count, uint64_t &wait_cycle, uint64_t &local_dispatch_count
     ) {
         int count = 0;
-        while (count < max_count && local_buf.count > 0) {
+        while (count < max_count) {
+            PTO2TaskSlotState *s = local_buf.pop();
+            if (s == nullptr) break;
             local_dispatch_count++;
-            out[count++] = local_buf.slot_states[--local_buf.count];
+            out[count++] = s;
         }
         int remaining = max_count - count;
         if (remaining > 0) {
-            count +=
-                ready_queues[static_cast<int32_t>(shape)].pop_batch(out + count, remaining, atomic_count, wait_cycle);
+            int32_t si = static_cast<int32_t>(shape);
+            bool normal_first = normal_lane_first(shape);
+            PTO2ReadyQueue &first = normal_first ? ready_queues[si] : ready_queues_high[si];
+            PTO2ReadyQueue &second = normal_first ? ready_queues_high[si] : ready_queues[si];
+            uint32_t first_bit = occupancy_bit(si, !normal_first);
+            uint32_t second_bit = occupancy_bit(si, normal_first);
+            int n_first = 0;
+            if (ready_shape_occupancy.load(std::memory_order_relaxed) & first_bit) {
+                n_first = first.pop_batch(out + count, remaining, atomic_count, wait_cycle);
+                if (n_first == 0) {
+                    ready_shape_occupancy.fetch_and(~first_bit, std::memory_order_relaxed);
+                    if (first.size() != 0) ready_shape_occupancy.fetch_or(first_bit, std::memory_order_relaxed);
+                }
+                count += n_first;
+            }
+            remaining = max_count - count;
+            int n_second = 0;
+            if (remaining > 0 && (ready_shape_occupancy.load(std::memory_order_relaxed) & second_bit)) {
+                n_second = second.pop_batch(out + count, remaining, atomic_count, wait_cycle);
+                if (n_second == 0) {
+                    ready_shape_occupancy.fetch_and(~second_bit, std::memory_order_relaxed);
+                    if (second.size() != 0) ready_shape_occupancy.fetch_or(second_bit, std::memory_order_relaxed);
+                }
+                count += n_second;
+            }
+            if ((normal_first ? n_first : n_second) > 0) {
+                refresh_normal_age(si);
+            }
         }
         return count;
     }
 #endif
 
+    /**
+     * Publish (or retract, with nullptr) a thread's local ready buffers for
+     * work stealing.  `bufs` points to the thread's per-shape array.
+     */
+    void register_local_bufs(int32_t thread_idx, PTO2LocalReadyBuffer *bufs) {
+        thread_local_bufs[thread_idx].store(bufs, std::memory_order_release);
+    }
+
+    /**
+     * Steal ready tasks of a given shape from other threads' local buffers.
+     * Called when both the thief's local buffer and the global ready queue
+     * came up empty.  Takes up to half of each victim's visible entries,
+     * starting with the thread after the thief to spread steal pressure.
+     *
+     * @return Number of tasks written to out
+     */
+    int steal_ready_tasks(PTO2ResourceShape shape, int32_t thief_idx, PTO2TaskSlotState **out, int max_count) {
+        int count = 0;
+        for (int32_t i = 1; i < PLATFORM_MAX_AICPU_THREADS && count < max_count; i++) {
+            int32_t victim = (thief_idx + i) % PLATFORM_MAX_AICPU_THREADS;
+            PTO2LocalReadyBuffer *bufs = thread_local_bufs[victim].load(std::memory_order_acquire);
+            if (bufs == nullptr) {
+                continue;
+            }
+            PTO2LocalReadyBuffer &buf = bufs[static_cast<int32_t>(shape)];
+            // Steal at most half so the owner keeps its locality benefit.
+            int32_t want = (buf.size() + 1) / 2;
+            while (want > 0 && count < max_count) {
+                PTO2TaskSlotState *s = buf.steal();
+                if (s == nullptr) break;  // Empty or lost the race — next victim
+                out[count++] = s;
+                want--;
+            }
+        }
+        return count;
+    }
+
     void on_scope_end(PTO2TaskSlotState **task_slot_states, int32_t count) {
 #if PTO2_ORCH_PROFILING
         extern uint64_t g_orch_scope_end_atomic_count;
@@ -870,6 +1310,19 @@ struct PTO2SchedulerState {
         return (prev + 1) == slot_state.total_required_subtasks;
     }
 
+    /**
+     * Batched variant: credits n subtask completions in a single atomic add.
+     * The completion scan harvests same-task done events into a bit word per
+     * pass and passes its popcount here, so a block-parallel task costs one
+     * atomic per scan pass instead of one per subtask.
+     *
+     * @return true if these were the last outstanding subtasks, completing the entire task.
+     */
+    bool on_subtasks_complete(PTO2TaskSlotState &slot_state, int16_t n) {
+        int16_t prev = slot_state.completed_subtasks.fetch_add(n, std::memory_order_acq_rel);
+        return (prev + n) == slot_state.total_required_subtasks;
+    }
+
     /**
      * Two-stage completion: second stage.
      * Called exactly once when all subtasks of a mixed task are done
@@ -905,32 +1358,64 @@ struct PTO2SchedulerState {
 #else
         pto2_fanout_lock(slot_state);
 #endif
-        slot_state.task_state.store(PTO2_TASK_COMPLETED, std::memory_order_release);
+        slot_state.state_word.fetch_or(PTO2_STATE_COMPLETED_BIT, std::memory_order_release);
         PTO2DepListEntry *current = slot_state.fanout_head;  // Protected by fanout_lock
         pto2_fanout_unlock(slot_state);
 
 #if PTO2_SCHED_PROFILING
-        lock_atomics += 2;  // state.store + unlock.store
+        lock_atomics += 2;  // state_word.fetch_or(COMPLETED) + unlock.store
         g_sched_lock_atomic_count[thread_idx] += lock_atomics;
         g_sched_lock_wait_cycle[thread_idx] += lock_wait;
         PTO2_SCHED_CYCLE_LAP(g_sched_lock_cycle[thread_idx]);
 #endif
 
-        // Fanout: notify consumers
+        // Fanout: notify consumers in cache-line-sized chunks. Entries are
+        // gathered while prefetching the next dep-list node and each consumer
+        // slot line, then releases are applied; duplicate consumers within a
+        // chunk collapse into a single refcount RMW.
 #if PTO2_SCHED_PROFILING
         uint64_t fanout_atomics = 0, push_wait = 0;
 #endif
+        constexpr int32_t kFanoutChunk = 8;  // 8 pointers = one cache line
+        PTO2TaskSlotState *chunk[kFanoutChunk];
         while (current != nullptr) {
-            PTO2TaskSlotState &consumer_slot = *current->slot_state;
-#if PTO2_SCHED_PROFILING
-            stats.fanout_edges++;
-            if (release_fanin_and_check_ready(consumer_slot, fanout_atomics, push_wait, local_bufs)) {
-                stats.tasks_enqueued++;
+            int32_t n = 0;
+            while (current != nullptr && n < kFanoutChunk) {
+                chunk[n++] = current->slot_state;
+                current = current->next;
+                if (current != nullptr) {
+                    __builtin_prefetch(current, 0, 3);
+                }
+            }
+            for (int32_t i = 0; i < n; i++) {
+                __builtin_prefetch(chunk[i], 1, 3);
             }
+            for (int32_t i = 0; i < n; i++) {
+                PTO2TaskSlotState *consumer_slot = chunk[i];
+                if (consumer_slot == nullptr) {
+                    continue;  // coalesced into an earlier release
+                }
+                int32_t repeats = 1;
+                for (int32_t j = i + 1; j < n; j++) {
+                    if (chunk[j] == consumer_slot) {
+                        chunk[j] = nullptr;
+                        repeats++;
+                    }
+                }
+                // Propagate the completing core's cluster so dispatch can keep
+                // the consumer on the producer's cluster (L2 locality). Plain
+                // write is fine — it is only ever a hint, and the consumer's
+                // slot cannot be recycled before this release is applied.
+                consumer_slot->affinity_cluster = slot_state.affinity_cluster;
+#if PTO2_SCHED_PROFILING
+                stats.fanout_edges += repeats;
+                if (release_fanin_n_and_check_ready(*consumer_slot, repeats, fanout_atomics, push_wait, local_bufs)) {
+                    stats.tasks_enqueued++;
+                }
 #else
-            release_fanin_and_check_ready(consumer_slot, local_bufs);
+                release_fanin_n_and_check_ready(*consumer_slot, repeats, local_bufs);
 #endif
-            current = current->next;
+            }
         }
 
 #if PTO2_SCHED_PROFILING
@@ -958,13 +1443,17 @@ struct PTO2SchedulerState {
     int32_t on_task_release(PTO2TaskSlotState &slot_state) {
 #endif
         PTO2TaskPayload *payload = slot_state.payload;
-        pto2_for_each_fanin_slot_state(*payload, [&](PTO2TaskSlotState *producer_slot_state) {
+        // Fanins already dropped by on_task_early_release() while the kernel
+        // was still running — releasing them again would underflow refcounts.
+        if (payload->fanin_early_released == 0) {
+            pto2_for_each_fanin_slot_state(*payload, [&](PTO2TaskSlotState *producer_slot_state) {
 #if PTO2_SCHED_PROFILING
-            release_producer(*producer_slot_state, fanin_atomics);
+                release_producer(*producer_slot_state, fanin_atomics);
 #else
-            release_producer(*producer_slot_state);
+                release_producer(*producer_slot_state);
 #endif
-        });
+            });
+        }
 #if PTO2_SCHED_PROFILING
         g_sched_fanin_atomic_count[thread_idx] += fanin_atomics;
         PTO2_SCHED_CYCLE_LAP(g_sched_fanin_cycle[thread_idx]);
@@ -982,6 +1471,37 @@ struct PTO2SchedulerState {
 #endif
         return payload->fanin_actual_count;
     }
+
+    /**
+     * Early input release: drop this RUNNING task's fanin references now,
+     * ahead of completion. Called from the completion scan when a
+     * single-core, single-block kernel publishes its early-release signal
+     * (see get_input_release_slot() in intrinsic.h). Producers whose
+     * refcounts reach zero retire immediately, so the ring heap reclaims
+     * input buffers while the kernel is still computing. No self consumed
+     * check here — the task itself is not COMPLETED yet; on_task_release()
+     * at completion skips the fanin walk via fanin_early_released.
+     */
+#if PTO2_SCHED_PROFILING
+    void on_task_early_release(PTO2TaskSlotState &slot_state, int32_t thread_idx) {
+        extern uint64_t g_sched_fanin_atomic_count[];
+        uint64_t fanin_atomics = 0;
+#else
+    void on_task_early_release(PTO2TaskSlotState &slot_state) {
+#endif
+        PTO2TaskPayload *payload = slot_state.payload;
+        payload->fanin_early_released = 1;
+        pto2_for_each_fanin_slot_state(*payload, [&](PTO2TaskSlotState *producer_slot_state) {
+#if PTO2_SCHED_PROFILING
+            release_producer(*producer_slot_state, fanin_atomics);
+#else
+            release_producer(*producer_slot_state);
+#endif
+        });
+#if PTO2_SCHED_PROFILING
+        g_sched_fanin_atomic_count[thread_idx] += fanin_atomics;
+#endif
+    }
 };
 
 // =============================================================================
@@ -993,6 +1513,22 @@ bool pto2_scheduler_init(
 );
 void pto2_scheduler_destroy(PTO2SchedulerState *sched);
 
+/**
+ * Return all scheduler state to its post-init empty state without freeing
+ * or reallocating (fast runtime reset). Caller must guarantee quiescence:
+ * every submitted task consumed and no scheduler thread in its dispatch
+ * loop.
+ */
+void pto2_scheduler_reset(PTO2SchedulerState *sched);
+
+/**
+ * Switch every ready queue to the wait-free single-thread protocol (or back).
+ * Legal only while all queues are empty and no scheduler thread is in its
+ * dispatch loop — the executor calls it right after runtime creation when
+ * it knows aicpu_thread_num == 1, before any task is submitted.
+ */
+void pto2_scheduler_set_single_thread(PTO2SchedulerState *sched, bool single_thread);
+
 // =============================================================================
 // Debug Utilities (cold path, defined in pto_scheduler.cpp)
 // =============================================================================
@@ -19,9 +19,19 @@
 
 #include "pto_shared_memory.h"
 #include <inttypes.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #include "common/unified_log.h"
+#include "pto_mem_ops.h"
+
+// Explicit hugetlb page size attempted for the arena before falling back to
+// transparent huge pages (madvise) and finally default pages.
+#ifndef PTO2_SM_HUGE_PAGE_SIZE
+#define PTO2_SM_HUGE_PAGE_SIZE (2ull << 20)
+#endif
 
 // =============================================================================
 // Size Calculation
@@ -41,9 +51,17 @@ uint64_t pto2_sm_calculate_size_per_ring(const uint64_t task_window_sizes[PTO2_M
     // Header (aligned to cache line)
     size += PTO2_ALIGN_UP(sizeof(PTO2SharedMemoryHeader), PTO2_ALIGN_SIZE);
 
-    // Per-ring task descriptors and payloads
+    // Descriptor block: every ring's window back to back, page-aligned as a
+    // whole so the scheduler-walked region never shares a page with the
+    // header's flow-control lines or the core-polled payloads.
+    size = PTO2_ALIGN_UP(size, PTO2_SM_BLOCK_ALIGN);
     for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
         size += PTO2_ALIGN_UP(task_window_sizes[r] * sizeof(PTO2TaskDescriptor), PTO2_ALIGN_SIZE);
+    }
+
+    // Payload block
+    size = PTO2_ALIGN_UP(size, PTO2_SM_BLOCK_ALIGN);
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
         size += PTO2_ALIGN_UP(task_window_sizes[r] * sizeof(PTO2TaskPayload), PTO2_ALIGN_SIZE);
     }
 
@@ -56,19 +74,25 @@ uint64_t pto2_sm_calculate_size_per_ring(const uint64_t task_window_sizes[PTO2_M
 
 static void
 pto2_sm_setup_pointers_per_ring(PTO2SharedMemoryHandle *handle, const uint64_t task_window_sizes[PTO2_MAX_RING_DEPTH]) {
-    char *ptr = (char *)handle->sm_base;
+    char *base = (char *)handle->sm_base;
+    uint64_t offset = 0;
 
     // Header
-    handle->header = (PTO2SharedMemoryHeader *)ptr;
-    ptr += PTO2_ALIGN_UP(sizeof(PTO2SharedMemoryHeader), PTO2_ALIGN_SIZE);
+    handle->header = (PTO2SharedMemoryHeader *)base;
+    offset += PTO2_ALIGN_UP(sizeof(PTO2SharedMemoryHeader), PTO2_ALIGN_SIZE);
 
-    // Per-ring task descriptors and payloads
+    // Affinity-grouped blocks (must mirror pto2_sm_calculate_size_per_ring):
+    // all descriptor windows, then all payload windows.
+    offset = PTO2_ALIGN_UP(offset, PTO2_SM_BLOCK_ALIGN);
     for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
-        handle->task_descriptors[r] = (PTO2TaskDescriptor *)ptr;
-        ptr += PTO2_ALIGN_UP(task_window_sizes[r] * sizeof(PTO2TaskDescriptor), PTO2_ALIGN_SIZE);
+        handle->task_descriptors[r] = (PTO2TaskDescriptor *)(base + offset);
+        offset += PTO2_ALIGN_UP(task_window_sizes[r] * sizeof(PTO2TaskDescriptor), PTO2_ALIGN_SIZE);
+    }
 
-        handle->task_payloads[r] = (PTO2TaskPayload *)ptr;
-        ptr += PTO2_ALIGN_UP(task_window_sizes[r] * sizeof(PTO2TaskPayload), PTO2_ALIGN_SIZE);
+    offset = PTO2_ALIGN_UP(offset, PTO2_SM_BLOCK_ALIGN);
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        handle->task_payloads[r] = (PTO2TaskPayload *)(base + offset);
+        offset += PTO2_ALIGN_UP(task_window_sizes[r] * sizeof(PTO2TaskPayload), PTO2_ALIGN_SIZE);
     }
 }
 
@@ -80,6 +104,53 @@ static void pto2_sm_setup_pointers(PTO2SharedMemoryHandle *handle, uint64_t task
     pto2_sm_setup_pointers_per_ring(handle, task_window_sizes);
 }
 
+// Allocate the arena for `handle` and fill in sm_base/is_mmapped/map_size.
+// Returns false (handle untouched beyond sm_base=NULL) on failure.
+static bool pto2_sm_alloc_arena(PTO2SharedMemoryHandle *handle, uint64_t sm_size) {
+    // The descriptor windows span megabytes and are
+    // walked continuously by every scheduler thread, so prefer huge-page
+    // backing to keep the walk inside a handful of TLB entries: explicit
+    // hugetlb pages first (needs a reserved pool), then transparent huge
+    // pages via madvise, then default pages. mmap returns page-aligned
+    // memory, which satisfies the PTO2_ALIGN_SIZE DMA requirement.
+    const char *backing = "hugetlb";
+    uint64_t map_size = PTO2_ALIGN_UP(sm_size, PTO2_SM_HUGE_PAGE_SIZE);
+    void *base = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (base == MAP_FAILED) {
+        map_size = PTO2_ALIGN_UP(sm_size, static_cast<uint64_t>(sysconf(_SC_PAGESIZE)));
+        base = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (base != MAP_FAILED) {
+            backing = madvise(base, map_size, MADV_HUGEPAGE) == 0 ? "madvise(THP)" : "default pages";
+        }
+    }
+    if (base != MAP_FAILED) {
+        handle->sm_base = base;
+        handle->is_mmapped = true;
+        handle->map_size = map_size;
+    } else {
+        // Last resort: plain aligned allocation (e.g. mmap-restricted hosts).
+        backing = "malloc";
+#if defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200112L
+        if (posix_memalign(&handle->sm_base, PTO2_ALIGN_SIZE, static_cast<size_t>(sm_size)) != 0) {
+            handle->sm_base = NULL;
+            return false;
+        }
+#else
+        handle->sm_base = aligned_alloc(PTO2_ALIGN_SIZE, static_cast<size_t>(sm_size));
+        if (!handle->sm_base) {
+            return false;
+        }
+#endif
+    }
+    LOG_INFO(
+        "[PTO2 SM] arena: %" PRIu64 " bytes at %p, backing=%s", sm_size, handle->sm_base, backing
+    );
+
+    handle->sm_size = sm_size;
+    handle->is_owner = true;
+    return true;
+}
+
 PTO2SharedMemoryHandle *pto2_sm_create(uint64_t task_window_size, uint64_t heap_size) {
     // Allocate handle
     PTO2SharedMemoryHandle *handle = (PTO2SharedMemoryHandle *)calloc(1, sizeof(PTO2SharedMemoryHandle));
@@ -87,28 +158,17 @@ PTO2SharedMemoryHandle *pto2_sm_create(uint64_t task_window_size, uint64_t heap_
         return NULL;
     }
 
-    // Calculate total size
+    // Calculate total size and allocate the arena
     uint64_t sm_size = pto2_sm_calculate_size(task_window_size);
-
-// Allocate shared memory (aligned for DMA efficiency)
-#if defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200112L
-    if (posix_memalign(&handle->sm_base, PTO2_ALIGN_SIZE, static_cast<size_t>(sm_size)) != 0) {
+    if (!pto2_sm_alloc_arena(handle, sm_size)) {
         free(handle);
         return NULL;
     }
-#else
-    handle->sm_base = aligned_alloc(PTO2_ALIGN_SIZE, static_cast<size_t>(sm_size));
-    if (!handle->sm_base) {
-        free(handle);
-        return NULL;
-    }
-#endif
 
-    handle->sm_size = sm_size;
-    handle->is_owner = true;
-
-    // Initialize to zero
-    memset(handle->sm_base, 0, static_cast<size_t>(sm_size));
+    // Zero the arena with streaming stores: it spans megabytes, mmap returns
+    // it cache-line aligned, and nothing reads it back until the windows are
+    // populated — caching the zeroes would only evict the live working set.
+    pto2_mem_zero_nt(handle->sm_base, static_cast<size_t>(sm_size));
 
     // Set up pointers
     pto2_sm_setup_pointers(handle, task_window_size);
@@ -145,7 +205,11 @@ void pto2_sm_destroy(PTO2SharedMemoryHandle *handle) {
     if (!handle) return;
 
     if (handle->is_owner && handle->sm_base) {
-        free(handle->sm_base);
+        if (handle->is_mmapped) {
+            munmap(handle->sm_base, static_cast<size_t>(handle->map_size));
+        } else {
+            free(handle->sm_base);
+        }
     }
 
     free(handle);
@@ -178,15 +242,18 @@ void pto2_sm_init_header_per_ring(
     }
 
     header->orchestrator_done.store(0, std::memory_order_relaxed);
+    header->profiling_gate.store(1, std::memory_order_relaxed);
 
-    // Per-ring layout info
+    // Per-ring layout info. Descriptor offsets follow the affinity-grouped
+    // block layout (see pto2_sm_setup_pointers_per_ring): all descriptor
+    // windows contiguous in one page-aligned block, payloads after.
     uint64_t offset = PTO2_ALIGN_UP(sizeof(PTO2SharedMemoryHeader), PTO2_ALIGN_SIZE);
+    offset = PTO2_ALIGN_UP(offset, PTO2_SM_BLOCK_ALIGN);
     for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
         header->rings[r].task_window_size = task_window_sizes[r];
         header->rings[r].heap_size = heap_sizes[r];
         header->rings[r].task_descriptors_offset = offset;
         offset += PTO2_ALIGN_UP(task_window_sizes[r] * sizeof(PTO2TaskDescriptor), PTO2_ALIGN_SIZE);
-        offset += PTO2_ALIGN_UP(task_window_sizes[r] * sizeof(PTO2TaskPayload), PTO2_ALIGN_SIZE);
     }
 
     header->total_size = handle->sm_size;
@@ -198,6 +265,215 @@ void pto2_sm_init_header_per_ring(
     header->sched_error_bitmap.store(0, std::memory_order_relaxed);
     header->sched_error_code.store(PTO2_ERROR_NONE, std::memory_order_relaxed);
     header->sched_error_thread.store(-1, std::memory_order_relaxed);
+
+    // Tuning params: all-zero means compile-time defaults. The AICPU launcher
+    // overwrites this block from Runtime::pto2_params after init_header.
+    header->params = PTO2RuntimeParams{};
+
+    header->health.init();
+}
+
+void pto2_sm_reset(PTO2SharedMemoryHandle *handle) {
+    PTO2SharedMemoryHeader *header = handle->header;
+
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        header->rings[r].fc.init();
+    }
+
+    header->orchestrator_done.store(0, std::memory_order_relaxed);
+    header->profiling_gate.store(1, std::memory_order_relaxed);
+    header->graph_output_ptr.store(0, std::memory_order_relaxed);
+    header->graph_output_size.store(0, std::memory_order_relaxed);
+    header->orch_error_code.store(PTO2_ERROR_NONE, std::memory_order_relaxed);
+    header->sched_error_bitmap.store(0, std::memory_order_relaxed);
+    header->sched_error_code.store(PTO2_ERROR_NONE, std::memory_order_relaxed);
+    header->sched_error_thread.store(-1, std::memory_order_relaxed);
+    header->health.init();
+}
+
+// =============================================================================
+// Snapshot / Restore
+// =============================================================================
+
+// A snapshot is only meaningful pre-first-task: flow control at zero, no
+// completion flag, no errors. Anything else is mid-run state.
+static bool pto2_sm_is_pristine(const PTO2SharedMemoryHandle *handle) {
+    const PTO2SharedMemoryHeader *h = handle->header;
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        const PTO2RingFlowControl &fc = h->rings[r].fc;
+        if (fc.heap_top.load(std::memory_order_relaxed) != 0) return false;
+        if (fc.heap_tail.load(std::memory_order_relaxed) != 0) return false;
+        if (fc.current_task_index.load(std::memory_order_relaxed) != 0) return false;
+        if (fc.last_task_alive.load(std::memory_order_relaxed) != 0) return false;
+    }
+    if (h->orchestrator_done.load(std::memory_order_relaxed) != 0) return false;
+    if (h->orch_error_code.load(std::memory_order_relaxed) != PTO2_ERROR_NONE) return false;
+    if (h->sched_error_bitmap.load(std::memory_order_relaxed) != 0) return false;
+    return true;
+}
+
+int pto2_sm_snapshot_save(PTO2SharedMemoryHandle *handle, const char *path) {
+    if (!handle || !handle->sm_base || !handle->header || !path) return -1;
+    if (!pto2_sm_validate(handle)) {
+        LOG_ERROR("%s", "[PTO2 SM] snapshot save: image failed validation");
+        return -1;
+    }
+    if (!pto2_sm_is_pristine(handle)) {
+        LOG_ERROR("%s", "[PTO2 SM] snapshot save: image is not pristine (tasks already ran)");
+        return -1;
+    }
+
+    PTO2SnapshotFileHeader fh;
+    memset(&fh, 0, sizeof(fh));
+    fh.magic = PTO2_SNAPSHOT_MAGIC;
+    fh.version = PTO2_SNAPSHOT_VERSION;
+    fh.ring_depth = PTO2_MAX_RING_DEPTH;
+    fh.sm_size = handle->sm_size;
+    fh.header_size = sizeof(PTO2SharedMemoryHeader);
+    fh.descriptor_size = sizeof(PTO2TaskDescriptor);
+    fh.payload_size = sizeof(PTO2TaskPayload);
+
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        LOG_ERROR("[PTO2 SM] snapshot save: cannot open %s", path);
+        return -1;
+    }
+    bool ok = fwrite(&fh, sizeof(fh), 1, f) == 1 &&
+              fwrite(handle->sm_base, 1, static_cast<size_t>(handle->sm_size), f) ==
+                  static_cast<size_t>(handle->sm_size);
+    if (fclose(f) != 0) ok = false;
+    if (!ok) {
+        LOG_ERROR("[PTO2 SM] snapshot save: write to %s failed", path);
+        unlink(path);
+        return -1;
+    }
+    LOG_INFO("[PTO2 SM] snapshot saved: %" PRIu64 " bytes to %s", handle->sm_size, path);
+    return 0;
+}
+
+// Read and validate the versioned file header. Returns true and fills `fh`
+// when the snapshot matches this build's layout.
+static bool pto2_sm_snapshot_read_header(FILE *f, const char *path, PTO2SnapshotFileHeader *fh) {
+    if (fread(fh, sizeof(*fh), 1, f) != 1) {
+        LOG_ERROR("[PTO2 SM] snapshot restore: short read on %s", path);
+        return false;
+    }
+    if (fh->magic != PTO2_SNAPSHOT_MAGIC) {
+        LOG_ERROR("[PTO2 SM] snapshot restore: bad magic in %s", path);
+        return false;
+    }
+    if (fh->version != PTO2_SNAPSHOT_VERSION) {
+        LOG_ERROR(
+            "[PTO2 SM] snapshot restore: version %u != %u in %s", fh->version, PTO2_SNAPSHOT_VERSION, path
+        );
+        return false;
+    }
+    if (fh->ring_depth != PTO2_MAX_RING_DEPTH || fh->header_size != sizeof(PTO2SharedMemoryHeader) ||
+        fh->descriptor_size != sizeof(PTO2TaskDescriptor) || fh->payload_size != sizeof(PTO2TaskPayload)) {
+        LOG_ERROR("[PTO2 SM] snapshot restore: layout mismatch in %s (different build)", path);
+        return false;
+    }
+    return true;
+}
+
+// Attach handle pointers using the per-ring window sizes the restored image
+// carries in its own header (no init_header — that would wipe the snapshot).
+static bool pto2_sm_attach_restored(PTO2SharedMemoryHandle *handle) {
+    PTO2SharedMemoryHeader *header = (PTO2SharedMemoryHeader *)handle->sm_base;
+    if (header->total_size != handle->sm_size) {
+        LOG_ERROR(
+            "[PTO2 SM] snapshot restore: image total_size %" PRIu64 " != payload %" PRIu64, header->total_size,
+            handle->sm_size
+        );
+        return false;
+    }
+    uint64_t task_window_sizes[PTO2_MAX_RING_DEPTH];
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        task_window_sizes[r] = header->rings[r].task_window_size;
+    }
+    if (pto2_sm_calculate_size_per_ring(task_window_sizes) != handle->sm_size) {
+        LOG_ERROR("%s", "[PTO2 SM] snapshot restore: window sizes inconsistent with image size");
+        return false;
+    }
+    pto2_sm_setup_pointers_per_ring(handle, task_window_sizes);
+    return pto2_sm_validate(handle);
+}
+
+PTO2SharedMemoryHandle *pto2_sm_snapshot_restore(const char *path) {
+    if (!path) return NULL;
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        LOG_ERROR("[PTO2 SM] snapshot restore: cannot open %s", path);
+        return NULL;
+    }
+
+    PTO2SnapshotFileHeader fh;
+    if (!pto2_sm_snapshot_read_header(f, path, &fh)) {
+        fclose(f);
+        return NULL;
+    }
+
+    PTO2SharedMemoryHandle *handle = (PTO2SharedMemoryHandle *)calloc(1, sizeof(PTO2SharedMemoryHandle));
+    if (!handle) {
+        fclose(f);
+        return NULL;
+    }
+    if (!pto2_sm_alloc_arena(handle, fh.sm_size)) {
+        free(handle);
+        fclose(f);
+        return NULL;
+    }
+
+    // One contiguous read lands the whole image in the arena
+    bool ok = fread(handle->sm_base, 1, static_cast<size_t>(fh.sm_size), f) == static_cast<size_t>(fh.sm_size);
+    fclose(f);
+    if (!ok || !pto2_sm_attach_restored(handle)) {
+        pto2_sm_destroy(handle);
+        return NULL;
+    }
+    LOG_INFO("[PTO2 SM] snapshot restored: %" PRIu64 " bytes from %s", fh.sm_size, path);
+    return handle;
+}
+
+PTO2SharedMemoryHandle *pto2_sm_snapshot_restore_into(const char *path, void *sm_base, uint64_t sm_size) {
+    if (!path || !sm_base || sm_size == 0) return NULL;
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        LOG_ERROR("[PTO2 SM] snapshot restore: cannot open %s", path);
+        return NULL;
+    }
+
+    PTO2SnapshotFileHeader fh;
+    if (!pto2_sm_snapshot_read_header(f, path, &fh)) {
+        fclose(f);
+        return NULL;
+    }
+    if (sm_size < fh.sm_size) {
+        LOG_ERROR(
+            "[PTO2 SM] snapshot restore: buffer %" PRIu64 " bytes < image %" PRIu64, sm_size, fh.sm_size
+        );
+        fclose(f);
+        return NULL;
+    }
+
+    bool ok = fread(sm_base, 1, static_cast<size_t>(fh.sm_size), f) == static_cast<size_t>(fh.sm_size);
+    fclose(f);
+    if (!ok) {
+        LOG_ERROR("[PTO2 SM] snapshot restore: short image read on %s", path);
+        return NULL;
+    }
+
+    PTO2SharedMemoryHandle *handle = (PTO2SharedMemoryHandle *)calloc(1, sizeof(PTO2SharedMemoryHandle));
+    if (!handle) return NULL;
+    handle->sm_base = sm_base;
+    handle->sm_size = fh.sm_size;
+    handle->is_owner = false;
+    if (!pto2_sm_attach_restored(handle)) {
+        free(handle);
+        return NULL;
+    }
+    LOG_INFO("[PTO2 SM] snapshot restored in place: %" PRIu64 " bytes from %s", fh.sm_size, path);
+    return handle;
 }
 
 // =============================================================================
@@ -13,16 +13,17 @@
  *
  * Defines the shared memory structure for Orchestrator-Scheduler communication.
  *
- * Memory Layout (per-ring sections repeat for each ring 0..PTO2_MAX_RING_DEPTH-1):
+ * Memory Layout (access-affinity grouped; blocks are PTO2_SM_BLOCK_ALIGN
+ * page-aligned so regions with different writers never share a page):
  *   +---------------------------+
  *   | SharedMemoryHeader        |  (per-ring flow control + sync)
  *   +---------------------------+
- *   | Ring 0: TaskDescriptor[]  |
- *   | Ring 0: TaskPayload[]     |
- *   +---------------------------+
+ *   | Ring 0: TaskDescriptor[]  |  (orchestrator-written, scheduler-walked)
  *   | Ring 1: TaskDescriptor[]  |
- *   | Ring 1: TaskPayload[]     |
+ *   | ...                       |
  *   +---------------------------+
+ *   | Ring 0: TaskPayload[]     |  (orchestrator-written, core-polled)
+ *   | Ring 1: TaskPayload[]     |
  *   | ...                       |
  *   +---------------------------+
  *
@@ -30,6 +31,10 @@
  * - Only data needed for Orchestrator<->Scheduler communication is here
  * - TensorMap, scope_stack, ready_queues, dep_pool are in private memory
  * - Flow control via atomic counters/flags (no locks needed for single-word R/W)
+ * - Regions are packed by access affinity, not declaration order: all
+ *   descriptor windows form one contiguous block (one agent pair, one TLB/
+ *   prefetch stream) and all payload windows another, instead of
+ *   interleaving per ring
  *
  * Based on: docs/RUNTIME_LOGIC.md
  */
@@ -39,6 +44,14 @@
 
 #include "pto_runtime2_types.h"
 
+// Alignment of the affinity-grouped arena blocks (header, descriptor
+// windows, payload windows). Page granularity keeps regions with different
+// writers out of each other's pages; both the host sizing path and the
+// AICPU attach path derive the layout from this same constant.
+#ifndef PTO2_SM_BLOCK_ALIGN
+#define PTO2_SM_BLOCK_ALIGN 4096ull
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -52,23 +65,34 @@ struct PTO2SharedMemoryHandle;
 /**
  * Per-ring flow control state in shared memory.
  * Written/read by Orchestrator and Scheduler for synchronization.
+ *
+ * Fields are grouped by writer onto separate cache lines: the orchestrator's
+ * publish stores and the scheduler's retire stores target different lines,
+ * so neither side's write stream invalidates the line the other is spinning
+ * on (submit-rate back-pressure polls run concurrently with every retire).
  */
-struct PTO2RingFlowControl {
+struct alignas(PTO2_ALIGN_SIZE) PTO2RingFlowControl {
     // Written by Orchestrator, Read by Scheduler
-    std::atomic<uint64_t> heap_top;           // Heap ring allocation pointer
-    std::atomic<int32_t> current_task_index;  // Task ring head (next to allocate)
-    int32_t _pad0;                            // Alignment padding
+    alignas(PTO2_ALIGN_SIZE) std::atomic<uint64_t> heap_top;  // Heap ring allocation pointer
+    std::atomic<int32_t> current_task_index;                  // Task ring head (next to allocate)
 
     // Written by Scheduler, Read by Orchestrator (for back-pressure)
-    std::atomic<uint64_t> heap_tail;       // Heap ring free pointer
-    std::atomic<int32_t> last_task_alive;  // Task ring tail (oldest active task)
-    int32_t _pad1;                         // Alignment padding
+    alignas(PTO2_ALIGN_SIZE) std::atomic<uint64_t> heap_tail;  // Heap ring free pointer
+    std::atomic<int32_t> last_task_alive;                      // Task ring tail (oldest active task)
+
+    // Progress doorbell: bumped by the scheduler whenever last_task_alive
+    // actually advances. The orchestrator's adaptive alloc wait polls this
+    // instead of hammering last_task_alive, so its re-checks coincide with
+    // real reclamation progress. Own line: the blocked orchestrator's poll
+    // loop must not contend with the release stores above.
+    alignas(PTO2_ALIGN_SIZE) std::atomic<uint32_t> reclaim_doorbell;
 
     void init() {
         heap_top.store(0, std::memory_order_relaxed);
         current_task_index.store(0, std::memory_order_relaxed);
         heap_tail.store(0, std::memory_order_relaxed);
         last_task_alive.store(0, std::memory_order_relaxed);
+        reclaim_doorbell.store(0, std::memory_order_relaxed);
     }
 
     bool validate(PTO2SharedMemoryHandle *handle, int32_t ring_id) const;
@@ -77,15 +101,60 @@ struct PTO2RingFlowControl {
 /**
  * Per-ring shared memory header section.
  *
- * Groups flow-control and layout info for a single ring to avoid parallel arrays.
+ * Groups flow-control and layout info for a single ring to avoid parallel
+ * arrays. The layout fields are read-mostly (set once at init) and sit on
+ * their own cache line so lookups never pull one of fc's contended lines.
  */
-struct PTO2SharedMemoryRingHeader {
+struct alignas(PTO2_ALIGN_SIZE) PTO2SharedMemoryRingHeader {
     PTO2RingFlowControl fc;
-    uint64_t task_window_size;
+    alignas(PTO2_ALIGN_SIZE) uint64_t task_window_size;
     uint64_t heap_size;
     uint64_t task_descriptors_offset;  // Offset from SM base, in bytes
 };
 
+/**
+ * Always-on runtime health block (AICPU → Host).
+ *
+ * Scheduler thread 0 refreshes this once per HEALTH_PUBLISH_INTERVAL loop
+ * iterations — independent of profiling builds and gates — so fleet
+ * monitors can poll runtime health without the collector machinery. The
+ * host snapshots it mid-run with one small copy_from_device; `seq` is a
+ * seqlock generation (odd = publish in progress): readers retry while odd
+ * or while seq changed across the copy, writers bump it around the field
+ * stores. All other fields are plain single-writer values.
+ */
+struct alignas(PTO2_ALIGN_SIZE) PTO2HealthMetrics {
+    std::atomic<uint32_t> seq;        // Seqlock generation (odd = write in progress)
+    uint32_t publish_count;           // Heartbeat: publishes so far this run
+    uint64_t publish_sys_cnt;         // Sys-counter stamp of the last publish
+    uint64_t sys_cnt_freq_hz;         // Counter frequency for host-side conversion
+    uint64_t tasks_completed;         // Run-to-date global completion count
+    uint64_t tasks_per_sec;           // Completion rate over the last publish interval
+    uint64_t dispatch_latency_ewma;   // Dispatch → completion EWMA, sys-counter ticks
+    uint64_t ring_tasks_live;         // Sum over rings: submitted - retired
+    uint64_t heap_bytes_live;         // Sum over rings: heap_top - heap_tail
+    uint32_t alloc_stall_samples;     // Publishes that observed a full task window
+    uint32_t reserved;
+    int32_t orch_error_code;          // Mirror of header error codes at publish time
+    int32_t sched_error_code;
+
+    void init() {
+        seq.store(0, std::memory_order_relaxed);
+        publish_count = 0;
+        publish_sys_cnt = 0;
+        sys_cnt_freq_hz = 0;
+        tasks_completed = 0;
+        tasks_per_sec = 0;
+        dispatch_latency_ewma = 0;
+        ring_tasks_live = 0;
+        heap_bytes_live = 0;
+        alloc_stall_samples = 0;
+        reserved = 0;
+        orch_error_code = 0;
+        sched_error_code = 0;
+    }
+};
+
 /**
  * Shared memory header structure
  *
@@ -117,6 +186,29 @@ struct alignas(PTO2_ALIGN_SIZE) PTO2SharedMemoryHeader {
     std::atomic<int32_t> sched_error_bitmap;  // Bit X set = thread X had error
     std::atomic<int32_t> sched_error_code;    // Last scheduler error code (last-writer-wins)
     std::atomic<int32_t> sched_error_thread;  // Thread index of last error writer
+
+    // === PROFILING GATE ===
+
+    // Runtime-togglable collection gate (Orchestration → Scheduler/AICPU).
+    // 1 = collect (default), 0 = paused. Only meaningful on runs launched
+    // with profiling enabled; toggled between scope boundaries through
+    // pto2_rt_profiling_pause/resume so a single region of interest can be
+    // profiled without rebuilding or paying collection cost elsewhere.
+    std::atomic<uint32_t> profiling_gate;
+
+    // === RUNTIME TUNING PARAMETERS ===
+
+    // Host-set spin/notify overrides (see PTO2RuntimeParams in pto_types.h).
+    // Zeroed by init_header, then overwritten by the AICPU launcher from
+    // Runtime::pto2_params before the orchestrator and scheduler snapshot
+    // their effective limits at init. Zero fields keep compile-time defaults.
+    PTO2RuntimeParams params;
+
+    // === HEALTH METRICS ===
+
+    // Always-on runtime health block (see PTO2HealthMetrics). Own cache
+    // line: refreshed by scheduler thread 0 while the host DMA-reads it.
+    PTO2HealthMetrics health;
 };
 
 static_assert(
@@ -142,7 +234,9 @@ struct PTO2SharedMemoryHandle {
     PTO2TaskPayload *task_payloads[PTO2_MAX_RING_DEPTH];
 
     // Ownership flag
-    bool is_owner;  // True if this handle allocated the memory
+    bool is_owner;     // True if this handle allocated the memory
+    bool is_mmapped;   // True if sm_base came from mmap (munmap on destroy)
+    uint64_t map_size;  // Page-rounded length passed to mmap (valid if is_mmapped)
 };
 
 // =============================================================================
@@ -211,6 +305,78 @@ void pto2_sm_init_header_per_ring(
     const uint64_t heap_sizes[PTO2_MAX_RING_DEPTH]
 );
 
+/**
+ * Return the header's run state to pristine without touching layout info or
+ * host-set tuning params (fast runtime reset). Clears per-ring flow
+ * control, completion flag, graph-output fields, and error state.
+ */
+void pto2_sm_reset(PTO2SharedMemoryHandle *handle);
+
+// =============================================================================
+// Snapshot / Restore
+// =============================================================================
+
+#define PTO2_SNAPSHOT_MAGIC 0x32324F54504D53ULL  // "SMPTO22" tag
+// v2: affinity-grouped arena (descriptor/payload blocks de-interleaved,
+// page-aligned). v1 images carry the old offsets and are rejected.
+#define PTO2_SNAPSHOT_VERSION 2u
+
+/**
+ * Versioned on-disk header preceding the raw shared-memory image.
+ *
+ * The struct-size fields pin the layout: a snapshot taken by a build with
+ * different descriptor/payload/header sizes (or ring depth) is rejected on
+ * restore instead of silently misinterpreting offsets.
+ */
+struct PTO2SnapshotFileHeader {
+    uint64_t magic;            // PTO2_SNAPSHOT_MAGIC
+    uint32_t version;          // PTO2_SNAPSHOT_VERSION
+    uint32_t ring_depth;       // PTO2_MAX_RING_DEPTH at save time
+    uint64_t sm_size;          // Image payload size in bytes
+    uint64_t header_size;      // sizeof(PTO2SharedMemoryHeader) at save time
+    uint64_t descriptor_size;  // sizeof(PTO2TaskDescriptor) at save time
+    uint64_t payload_size;     // sizeof(PTO2TaskPayload) at save time
+};
+
+/**
+ * Serialize an initialized, pristine shared-memory image to a file.
+ *
+ * Pristine means post-init_header, pre-first-task: all per-ring flow-control
+ * counters zero, orchestrator_done clear, no error codes. A dirty image is
+ * refused — restoring mid-run state would resurrect stale task windows.
+ *
+ * @param handle  Initialized shared memory handle
+ * @param path    Destination file path (overwritten)
+ * @return 0 on success, -1 on failure
+ */
+int pto2_sm_snapshot_save(PTO2SharedMemoryHandle *handle, const char *path);
+
+/**
+ * Restore a snapshot into a freshly allocated arena.
+ *
+ * Validates the versioned header, reads the image in one copy, and attaches
+ * without re-running init_header — the restored image already carries the
+ * full layout, so warm restart skips the rebuild entirely.
+ *
+ * @param path  Snapshot file written by pto2_sm_snapshot_save
+ * @return Handle owning the restored arena, or NULL on failure
+ */
+PTO2SharedMemoryHandle *pto2_sm_snapshot_restore(const char *path);
+
+/**
+ * Restore a snapshot into a caller-provided buffer in one copy.
+ *
+ * Same validation as pto2_sm_snapshot_restore, but the image lands in
+ * `sm_base` (e.g. a pinned staging buffer about to be DMA'd to the device).
+ * Caller owns the buffer; the handle will not free it.
+ *
+ * @param path     Snapshot file written by pto2_sm_snapshot_save
+ * @param sm_base  Destination buffer
+ * @param sm_size  Destination capacity in bytes (must fit the image)
+ * @return Handle attached to sm_base, or NULL on failure
+ */
+PTO2SharedMemoryHandle *pto2_sm_snapshot_restore_into(const char *path, void *sm_base, uint64_t sm_size);
+
 // =============================================================================
 // Debug Utilities
 // =============================================================================
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * PTO Runtime2 - Shared-Memory Shadow Checker (state + reporting)
+ */
+
+#include "pto_sm_shadow.h"
+
+#include <cinttypes>
+#include <cstdlib>
+
+PTO2ShadowState g_pto2_shadow;
+uint32_t g_pto2_shadow_sample_mask = 0;
+
+// Log the first few violations in full; afterwards only count them so a
+// systematically broken invariant can't flood the CI log.
+static constexpr uint64_t SHADOW_REPORT_LIMIT = 8;
+
+void pto2_shadow_init_from_env() {
+    const char *enabled = std::getenv("PTO2_SHADOW_CHECK");
+    if (enabled == nullptr || enabled[0] != '1') {
+        return;
+    }
+
+    uint32_t sample = 64;
+    const char *sample_env = std::getenv("PTO2_SHADOW_SAMPLE");
+    if (sample_env != nullptr) {
+        unsigned long parsed = std::strtoul(sample_env, nullptr, 10);
+        if (parsed > 0) {
+            sample = static_cast<uint32_t>(parsed);
+        }
+    }
+    // Round down to a power of two so the hot-path test stays a single AND
+    while ((sample & (sample - 1)) != 0) {
+        sample &= sample - 1;
+    }
+    g_pto2_shadow_sample_mask = sample - 1;
+    LOG_INFO("[ShadowCheck] enabled, sampling 1 in %u transitions", sample);
+}
+
+void pto2_shadow_report(const char *invariant, int64_t prev, int64_t now, int64_t bound) {
+    uint64_t count = g_pto2_shadow.violations.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (count <= SHADOW_REPORT_LIMIT) {
+        LOG_ERROR(
+            "[ShadowCheck] invariant violated: %s (prev=%" PRId64 ", now=%" PRId64 ", bound=%" PRId64 ")", invariant,
+            prev, now, bound
+        );
+    } else if (count == SHADOW_REPORT_LIMIT + 1) {
+        LOG_ERROR("[ShadowCheck] further violations suppressed (total counted in g_pto2_shadow.violations)");
+    }
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * PTO Runtime2 - Shared-Memory Shadow Checker
+ *
+ * Opt-in invariant checker for the hot flow-control atomics in
+ * pto_shared_memory.h. Races on these fields manifest on hardware as rare
+ * stalls that diagnose_stuck_state() only reports after the spin limit; the
+ * shadow checker catches the violation at the transition that caused it.
+ *
+ * Each checked field keeps a shadow copy of the highest value its single
+ * writer has published. On a sampled fraction of transitions the hooks verify:
+ *   - current_task_index and last_task_alive never move backwards
+ *   - the active window (current - last_alive) stays within [0, window_size]
+ *   - last_task_alive never overtakes current_task_index
+ *
+ * Enable with PTO2_SHADOW_CHECK=1; PTO2_SHADOW_SAMPLE sets the sampling
+ * period (power of two, default 64 — cheap enough for every CI workload).
+ * The environment is only visible in simulation; on device AICPU the checker
+ * stays disabled. Violations are logged (first few in full, then counted) —
+ * the run is not aborted, so a red CI log still comes with a complete trace.
+ */
+
+#ifndef PTO_SM_SHADOW_H
+#define PTO_SM_SHADOW_H
+
+#include <atomic>
+#include <cstdint>
+
+#include "common/unified_log.h"
+#include "pto_runtime2_types.h"
+
+// One slot per checked atomic: current_task_index + last_task_alive per ring
+#define PTO2_SHADOW_MAX_SLOTS (PTO2_MAX_RING_DEPTH * 2)
+
+/** Shadow copy of one checked atomic, keyed by its address. */
+struct PTO2ShadowSlot {
+    std::atomic<const void *> key{nullptr};
+    std::atomic<int32_t> max_seen{0};
+};
+
+struct PTO2ShadowState {
+    PTO2ShadowSlot slots[PTO2_SHADOW_MAX_SLOTS];
+    std::atomic<uint64_t> violations{0};
+};
+
+extern PTO2ShadowState g_pto2_shadow;
+extern uint32_t g_pto2_shadow_sample_mask;  // 0 = checker disabled
+
+/** Read PTO2_SHADOW_CHECK / PTO2_SHADOW_SAMPLE once. Idempotent. */
+void pto2_shadow_init_from_env();
+
+/** Log a violation (rate-limited) and bump the violation counter. */
+void pto2_shadow_report(const char *invariant, int64_t prev, int64_t now, int64_t bound);
+
+/** True on 1-in-N transitions when the checker is enabled. */
+inline bool pto2_shadow_sample() {
+    if (g_pto2_shadow_sample_mask == 0) {
+        return false;
+    }
+    thread_local uint32_t transitions = 0;
+    return ((++transitions) & g_pto2_shadow_sample_mask) == 0;
+}
+
+/** Find or claim the shadow slot for a checked atomic. */
+inline PTO2ShadowSlot *pto2_shadow_slot(const void *key) {
+    for (int i = 0; i < PTO2_SHADOW_MAX_SLOTS; i++) {
+        PTO2ShadowSlot &slot = g_pto2_shadow.slots[i];
+        const void *k = slot.key.load(std::memory_order_acquire);
+        if (k == key) {
+            return &slot;
+        }
+        if (k == nullptr) {
+            const void *expected = nullptr;
+            if (slot.key.compare_exchange_strong(expected, key, std::memory_order_acq_rel)) {
+                return &slot;
+            }
+            if (expected == key) {
+                return &slot;
+            }
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Publish-side hook: called by the orchestrator (single writer) right after
+ * storing current_task_index. last_alive is re-read here; it can only be
+ * fresher than the value the publish gate used, so the bound check cannot
+ * false-positive.
+ */
+inline void pto2_shadow_on_publish(
+    const std::atomic<int32_t> *current_ptr, int32_t new_current, const std::atomic<int32_t> *last_alive_ptr,
+    int32_t window_size
+) {
+    if (!pto2_shadow_sample()) {
+        return;
+    }
+    PTO2ShadowSlot *slot = pto2_shadow_slot(current_ptr);
+    if (slot == nullptr) {
+        return;
+    }
+    int32_t prev = slot->max_seen.load(std::memory_order_relaxed);
+    if (new_current < prev) {
+        pto2_shadow_report("current_task_index moved backwards", prev, new_current, 0);
+    } else {
+        slot->max_seen.store(new_current, std::memory_order_relaxed);
+    }
+    int32_t last_alive = last_alive_ptr->load(std::memory_order_acquire);
+    int32_t active = new_current - last_alive;
+    if (active < 0 || active > window_size) {
+        pto2_shadow_report("active window out of bounds", last_alive, new_current, window_size);
+    }
+}
+
+/**
+ * Retire-side hook: called by the owning scheduler thread right after
+ * storing last_task_alive. current_task_index is re-read; it is at least
+ * the value under which the retired tasks were observed, so the overtake
+ * check cannot false-positive.
+ */
+inline void pto2_shadow_on_retire(
+    const std::atomic<int32_t> *last_alive_ptr, int32_t new_last_alive, const std::atomic<int32_t> *current_ptr
+) {
+    if (!pto2_shadow_sample()) {
+        return;
+    }
+    PTO2ShadowSlot *slot = pto2_shadow_slot(last_alive_ptr);
+    if (slot == nullptr) {
+        return;
+    }
+    int32_t prev = slot->max_seen.load(std::memory_order_relaxed);
+    if (new_last_alive < prev) {
+        pto2_shadow_report("last_task_alive moved backwards", prev, new_last_alive, 0);
+    } else {
+        slot->max_seen.store(new_last_alive, std::memory_order_relaxed);
+    }
+    int32_t current = current_ptr->load(std::memory_order_acquire);
+    if (new_last_alive > current) {
+        pto2_shadow_report("last_task_alive overtook current_task_index", current, new_last_alive, 0);
+    }
+}
+
+#endif  // PTO_SM_SHADOW_H
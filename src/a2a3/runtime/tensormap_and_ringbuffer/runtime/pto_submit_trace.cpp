@@ -0,0 +1,428 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * PTO Runtime2 - Submit-Stream Trace (writer + replayer)
+ */
+
+#include "pto_submit_trace.h"
+
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common/unified_log.h"
+#include "pto_orchestrator.h"
+
+// Weak fallback for builds that don't link device_time.cpp (e.g. host).
+// Same pattern as pto_orchestrator.cpp: the strong AICPU symbol wins, and
+// hidden visibility keeps the host .so from exporting the fallback globally.
+__attribute__((weak, visibility("hidden"))) uint64_t get_sys_cnt_aicpu() { return 0; }
+
+bool g_pto2_submit_trace_active = false;
+
+static FILE *g_trace_file = nullptr;
+static uint64_t g_trace_start_cycle = 0;
+
+void pto2_submit_trace_init_from_env() {
+    if (g_trace_file != nullptr) {
+        return;
+    }
+    const char *path = std::getenv("PTO2_SUBMIT_TRACE");
+    if (path == nullptr || path[0] == '\0') {
+        return;
+    }
+
+    g_trace_file = fopen(path, "wb");
+    if (g_trace_file == nullptr) {
+        LOG_ERROR("[SubmitTrace] cannot open capture file '%s'", path);
+        return;
+    }
+
+    g_trace_start_cycle = get_sys_cnt_aicpu();
+    PTO2TraceFileHeader header{};
+    header.magic = PTO2_TRACE_MAGIC;
+    header.version = PTO2_TRACE_VERSION;
+    header.tensor_arg_size = static_cast<uint16_t>(sizeof(PTO2TraceTensorArg));
+    header.start_cycle = g_trace_start_cycle;
+    fwrite(&header, sizeof(header), 1, g_trace_file);
+
+    g_pto2_submit_trace_active = true;
+    LOG_INFO("[SubmitTrace] capturing submit stream to '%s'", path);
+}
+
+void pto2_submit_trace_close() {
+    if (g_trace_file == nullptr) {
+        return;
+    }
+    g_pto2_submit_trace_active = false;
+    fclose(g_trace_file);
+    g_trace_file = nullptr;
+}
+
+static void trace_fill_tensor_arg(PTO2TraceTensorArg &ta, TensorArgType tag, const TensorRef &ref) {
+    ta.tag = static_cast<int32_t>(tag);
+    if (tag == TensorArgType::OUTPUT) {
+        const TensorCreateInfo *ci = ref.create_info;
+        ta.ndims = ci->ndims;
+        ta.dtype = static_cast<int32_t>(ci->dtype);
+        ta.initial_value = ci->initial_value;
+        ta.has_initial_value = ci->has_initial_value ? 1 : 0;
+        ta.manual_dep = ci->manual_dep ? 1 : 0;
+        ta.is_all_offset_zero = 1;
+        ta.is_raw_eq_shapes = 1;
+        // TensorCreateInfo::raw_shapes occupies the Tensor::shapes slot
+        for (uint32_t d = 0; d < ci->ndims; d++) {
+            ta.shapes[d] = ci->raw_shapes[d];
+        }
+        return;
+    }
+
+    const Tensor *t = ref.ptr;
+    ta.addr = t->buffer.addr;
+    ta.size = t->buffer.size;
+    ta.version = t->version;
+    ta.ndims = t->ndims;
+    ta.dtype = static_cast<int32_t>(t->dtype);
+    ta.is_all_offset_zero = t->is_all_offset_zero ? 1 : 0;
+    ta.is_raw_eq_shapes = t->is_raw_eq_shapes ? 1 : 0;
+    ta.manual_dep = t->manual_dep ? 1 : 0;
+    for (uint32_t d = 0; d < t->ndims; d++) {
+        ta.shapes[d] = t->shapes[d];
+        if (!t->is_raw_eq_shapes) {
+            ta.raw_shapes[d] = t->raw_shapes[d];
+        }
+        if (!t->is_all_offset_zero) {
+            ta.offsets[d] = t->offsets[d];
+        }
+    }
+}
+
+void pto2_submit_trace_record_submit(
+    PTO2TraceRecordType type, const MixedKernels &mixed_kernels, const Arg &args, const TaskOutputTensors &outputs
+) {
+    if (g_trace_file == nullptr) {
+        return;
+    }
+
+    PTO2TraceRecord rec{};
+    rec.type = static_cast<uint8_t>(type);
+    rec.flags = (args.launch_spec.require_sync_start() ? 1u : 0u) | (args.launch_spec.high_priority() ? 2u : 0u) |
+                (args.launch_spec.donate_input() ? 4u : 0u) | (args.launch_spec.early_input_release() ? 8u : 0u);
+    rec.block_num = args.launch_spec.block_num();
+    rec.block_dim_x = args.launch_spec.block_dim_x();
+    rec.aic_kernel_id = mixed_kernels.aic_kernel_id;
+    rec.aiv0_kernel_id = mixed_kernels.aiv0_kernel_id;
+    rec.aiv1_kernel_id = mixed_kernels.aiv1_kernel_id;
+    rec.tensor_count = args.tensor_count();
+    rec.scalar_count = args.scalar_count();
+    rec.output_count = static_cast<int32_t>(outputs.size());
+    rec.timestamp = get_sys_cnt_aicpu() - g_trace_start_cycle;
+    fwrite(&rec, sizeof(rec), 1, g_trace_file);
+
+    for (int32_t i = 0; i < rec.tensor_count; i++) {
+        PTO2TraceTensorArg ta{};
+        trace_fill_tensor_arg(ta, args.tag(i), args.tensor(i));
+        fwrite(&ta, sizeof(ta), 1, g_trace_file);
+    }
+    for (int32_t i = 0; i < rec.scalar_count; i++) {
+        uint64_t value = args.scalar(i);
+        fwrite(&value, sizeof(value), 1, g_trace_file);
+    }
+    for (uint32_t i = 0; i < outputs.size(); i++) {
+        uint64_t out_addr = outputs.get_ref(i).buffer.addr;
+        fwrite(&out_addr, sizeof(out_addr), 1, g_trace_file);
+    }
+}
+
+void pto2_submit_trace_record_scope(PTO2TraceRecordType type) {
+    if (g_trace_file == nullptr) {
+        return;
+    }
+    PTO2TraceRecord rec{};
+    rec.type = static_cast<uint8_t>(type);
+    rec.timestamp = get_sys_cnt_aicpu() - g_trace_start_cycle;
+    fwrite(&rec, sizeof(rec), 1, g_trace_file);
+}
+
+// =============================================================================
+// Replay
+// =============================================================================
+
+/**
+ * Open-addressing map from recorded output buffer address to the replayed
+ * Tensor produced at the same stream position. Tensor is trivially copyable,
+ * so slots hold raw 128B storage (Tensor has no public default constructor).
+ */
+struct PTO2TraceAddrMap {
+    struct Slot {
+        uint64_t key;  // 0 = empty
+        alignas(64) unsigned char tensor[sizeof(Tensor)];
+    };
+
+    Slot *slots{nullptr};
+    uint32_t capacity{0};
+    uint32_t count{0};
+
+    ~PTO2TraceAddrMap() { free(slots); }
+
+    void put(uint64_t key, const Tensor &tensor) {
+        if (key == 0) {
+            return;
+        }
+        if (count * 4 >= capacity * 3) {
+            grow();
+        }
+        Slot &slot = probe(slots, capacity, key);
+        if (slot.key == 0) {
+            slot.key = key;
+            count++;
+        }
+        memcpy(slot.tensor, &tensor, sizeof(Tensor));
+    }
+
+    const Tensor *find(uint64_t key) const {
+        if (capacity == 0 || key == 0) {
+            return nullptr;
+        }
+        const Slot &slot = probe(slots, capacity, key);
+        return slot.key == key ? reinterpret_cast<const Tensor *>(slot.tensor) : nullptr;
+    }
+
+private:
+    static Slot &probe(Slot *table, uint32_t cap, uint64_t key) {
+        uint32_t mask = cap - 1;
+        uint32_t idx = static_cast<uint32_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+        while (table[idx].key != 0 && table[idx].key != key) {
+            idx = (idx + 1) & mask;
+        }
+        return table[idx];
+    }
+
+    void grow() {
+        uint32_t new_cap = capacity == 0 ? 256 : capacity * 2;
+        Slot *new_slots = reinterpret_cast<Slot *>(calloc(new_cap, sizeof(Slot)));
+        assert(new_slots && "Failed to grow trace address map");
+        for (uint32_t i = 0; i < capacity; i++) {
+            if (slots[i].key != 0) {
+                Slot &dst = probe(new_slots, new_cap, slots[i].key);
+                dst = slots[i];
+            }
+        }
+        free(slots);
+        slots = new_slots;
+        capacity = new_cap;
+    }
+};
+
+/** Friend of Tensor: reconstructs tensor arguments from trace records. */
+struct PTO2SubmitTraceReplayer {
+    static bool replay(PTO2OrchestratorState *orch, FILE *file);
+
+private:
+    static void
+    rebuild_tensor(Tensor &t, const PTO2TraceTensorArg &ta, const PTO2TraceAddrMap &map);
+    static bool replay_task(
+        PTO2OrchestratorState *orch, FILE *file, const PTO2TraceRecord &rec, PTO2TraceAddrMap &map
+    );
+};
+
+void PTO2SubmitTraceReplayer::rebuild_tensor(Tensor &t, const PTO2TraceTensorArg &ta, const PTO2TraceAddrMap &map) {
+    const Tensor *base = map.find(ta.addr);
+    if (base != nullptr) {
+        // Produced earlier in this replay: rebind to the replayed buffer and
+        // keep its owner/version so creator retention matches the capture run.
+        t.init(*base);
+    } else {
+        // External to the trace: the recorded address is reused as-is — it is
+        // only a dependency key, never dereferenced by the runtime itself.
+        t.buffer = {ta.addr, ta.size};
+        t.owner_task_id = PTO2TaskId::invalid();
+        t.version = ta.version;
+    }
+    // Reapply the recorded view geometry on top of the base buffer.
+    t.ndims = ta.ndims;
+    t.dtype = static_cast<DataType>(ta.dtype);
+    t.is_all_offset_zero = ta.is_all_offset_zero != 0;
+    t.is_raw_eq_shapes = ta.is_raw_eq_shapes != 0;
+    t.manual_dep = ta.manual_dep != 0;
+    for (uint32_t d = 0; d < ta.ndims; d++) {
+        t.shapes[d] = ta.shapes[d];
+        if (!t.is_raw_eq_shapes) {
+            t.raw_shapes[d] = ta.raw_shapes[d];
+        }
+        if (!t.is_all_offset_zero) {
+            t.offsets[d] = ta.offsets[d];
+        }
+    }
+    t.update_start_offset();
+}
+
+bool PTO2SubmitTraceReplayer::replay_task(
+    PTO2OrchestratorState *orch, FILE *file, const PTO2TraceRecord &rec, PTO2TraceAddrMap &map
+) {
+    if (rec.tensor_count < 0 || rec.tensor_count > MAX_TENSOR_ARGS || rec.scalar_count < 0 ||
+        rec.scalar_count > MAX_SCALAR_ARGS || rec.output_count < 0 || rec.output_count > PTO2_MAX_OUTPUTS) {
+        LOG_ERROR("[SubmitTrace] corrupt record (counts %d/%d/%d)", rec.tensor_count, rec.scalar_count,
+                  rec.output_count);
+        return false;
+    }
+
+    PTO2TraceTensorArg tensor_args[MAX_TENSOR_ARGS];
+    uint64_t scalars[MAX_SCALAR_ARGS];
+    uint64_t out_addrs[PTO2_MAX_OUTPUTS];
+    if (rec.tensor_count > 0 &&
+        fread(tensor_args, sizeof(PTO2TraceTensorArg), rec.tensor_count, file) !=
+            static_cast<size_t>(rec.tensor_count)) {
+        return false;
+    }
+    if (rec.scalar_count > 0 &&
+        fread(scalars, sizeof(uint64_t), rec.scalar_count, file) != static_cast<size_t>(rec.scalar_count)) {
+        return false;
+    }
+    if (rec.output_count > 0 &&
+        fread(out_addrs, sizeof(uint64_t), rec.output_count, file) != static_cast<size_t>(rec.output_count)) {
+        return false;
+    }
+
+    // Rebuilt argument storage must outlive the submit call (Arg keeps pointers).
+    Tensor tensors[MAX_TENSOR_ARGS];
+    TensorCreateInfo create_infos[MAX_TENSOR_ARGS] = {};
+
+    Arg args;
+    args.launch_spec.set_block_num(rec.block_num);
+    args.launch_spec.set_block_dim_x(rec.block_dim_x);
+    args.launch_spec.set_require_sync_start((rec.flags & 1u) != 0);
+    args.launch_spec.set_high_priority((rec.flags & 2u) != 0);
+    args.launch_spec.set_donate_input((rec.flags & 4u) != 0);
+    args.launch_spec.set_early_input_release((rec.flags & 8u) != 0);
+
+    for (int32_t i = 0; i < rec.tensor_count; i++) {
+        const PTO2TraceTensorArg &ta = tensor_args[i];
+        TensorArgType tag = static_cast<TensorArgType>(ta.tag);
+        if (tag == TensorArgType::OUTPUT) {
+            TensorCreateInfo &ci = create_infos[i];
+            ci.initial_value = ta.initial_value;
+            ci.has_initial_value = ta.has_initial_value != 0;
+            ci.version = 0;
+            ci.ndims = ta.ndims;
+            ci.dtype = static_cast<DataType>(ta.dtype);
+            ci.is_all_offset_zero = true;
+            ci.is_raw_eq_shapes = true;
+            ci.manual_dep = ta.manual_dep != 0;
+            for (uint32_t d = 0; d < ta.ndims; d++) {
+                ci.raw_shapes[d] = ta.shapes[d];
+            }
+            args.add_output(ci);
+            continue;
+        }
+
+        Tensor &t = tensors[i];
+        rebuild_tensor(t, ta, map);
+        switch (tag) {
+            case TensorArgType::INPUT:
+                args.add_input(t);
+                break;
+            case TensorArgType::INOUT:
+                args.add_inout(t);
+                break;
+            case TensorArgType::OUTPUT_EXISTING:
+                args.add_output(t);
+                break;
+            case TensorArgType::NO_DEP:
+                args.add_no_dep(t);
+                break;
+            default:
+                LOG_ERROR("[SubmitTrace] corrupt record (tensor tag %d)", ta.tag);
+                return false;
+        }
+    }
+    for (int32_t i = 0; i < rec.scalar_count; i++) {
+        args.add_scalar(scalars[i]);
+    }
+
+    TaskOutputTensors outputs;
+    if (static_cast<PTO2TraceRecordType>(rec.type) == PTO2TraceRecordType::ALLOC_TENSORS) {
+        outputs = pto2_alloc_tensors(orch, args);
+    } else {
+        MixedKernels mixed_kernels;
+        mixed_kernels.aic_kernel_id = rec.aic_kernel_id;
+        mixed_kernels.aiv0_kernel_id = rec.aiv0_kernel_id;
+        mixed_kernels.aiv1_kernel_id = rec.aiv1_kernel_id;
+        outputs = pto2_submit_mixed_task(orch, mixed_kernels, args);
+    }
+    if (orch->fatal) {
+        return false;
+    }
+
+    // Bind recorded output addresses to the replayed outputs so later inputs
+    // referencing them resolve to this run's buffers.
+    uint32_t bind_count = outputs.size() < static_cast<uint32_t>(rec.output_count)
+                              ? outputs.size()
+                              : static_cast<uint32_t>(rec.output_count);
+    for (uint32_t i = 0; i < bind_count; i++) {
+        map.put(out_addrs[i], outputs.get_ref(i));
+    }
+    return true;
+}
+
+bool PTO2SubmitTraceReplayer::replay(PTO2OrchestratorState *orch, FILE *file) {
+    PTO2TraceAddrMap map;
+    PTO2TraceRecord rec;
+    while (fread(&rec, sizeof(rec), 1, file) == 1) {
+        switch (static_cast<PTO2TraceRecordType>(rec.type)) {
+            case PTO2TraceRecordType::SCOPE_BEGIN:
+                pto2_scope_begin(orch);
+                break;
+            case PTO2TraceRecordType::SCOPE_END:
+                pto2_scope_end(orch);
+                break;
+            case PTO2TraceRecordType::SUBMIT:
+            case PTO2TraceRecordType::ALLOC_TENSORS:
+                if (!replay_task(orch, file, rec, map)) {
+                    return false;
+                }
+                break;
+            default:
+                LOG_ERROR("[SubmitTrace] corrupt record (type %d)", rec.type);
+                return false;
+        }
+        if (orch->fatal) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool pto2_submit_trace_replay(PTO2OrchestratorState *orch, const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == nullptr) {
+        LOG_ERROR("[SubmitTrace] cannot open trace file '%s'", path);
+        return false;
+    }
+
+    PTO2TraceFileHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != PTO2_TRACE_MAGIC ||
+        header.version != PTO2_TRACE_VERSION || header.tensor_arg_size != sizeof(PTO2TraceTensorArg)) {
+        LOG_ERROR("[SubmitTrace] '%s' is not a compatible submit trace", path);
+        fclose(file);
+        return false;
+    }
+
+    // Suspend capture so a replay run cannot re-record its own stream.
+    bool was_active = g_pto2_submit_trace_active;
+    g_pto2_submit_trace_active = false;
+    bool ok = PTO2SubmitTraceReplayer::replay(orch, file);
+    g_pto2_submit_trace_active = was_active;
+
+    fclose(file);
+    return ok;
+}
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * PTO Runtime2 - Submit-Stream Trace (capture + replay)
+ *
+ * Opt-in recorder for the orchestration submit stream. With capture enabled,
+ * every successful pto2_submit_mixed_task / pto2_alloc_tensors call and every
+ * scope_begin/scope_end is appended to a compact binary file: kernel IDs,
+ * launch spec, per-tensor descriptors (shape/offset/dtype/size), raw scalar
+ * values, a capture-relative timestamp, and the buffer addresses of the
+ * materialized outputs. pto2_submit_trace_replay() re-drives the recorded
+ * stream through the normal submit path, reproducing the exact task graph
+ * (dependency structure, allocation sizes, scope lifetimes) without the
+ * orchestration code that produced it — on sim or on hardware.
+ *
+ * Enable capture with PTO2_SUBMIT_TRACE=<path> (checked once at orchestrator
+ * init, same pattern as PTO2_SHADOW_CHECK). Capture runs on the single
+ * orchestration thread, so the writer needs no locking.
+ *
+ * Replay identity: recorded buffer addresses are used only as opaque keys.
+ * An input whose address matches a previously replayed output is rebound to
+ * that output's replayed tensor (view geometry reapplied on top); addresses
+ * never produced by the trace are treated as external tensors at their
+ * recorded address. Recorded timestamps are kept for offline analysis; replay
+ * submits as fast as the allocator admits, which is what benchmark
+ * reproduction wants.
+ *
+ * Known limits: tensor *contents* are not captured, and scalars that encode
+ * raw pointers replay as their recorded bit patterns.
+ */
+
+#ifndef PTO_SUBMIT_TRACE_H
+#define PTO_SUBMIT_TRACE_H
+
+#include <stdint.h>
+
+#include "pto_types.h"
+#include "tensor.h"
+
+struct PTO2OrchestratorState;
+
+inline constexpr uint32_t PTO2_TRACE_MAGIC = 0x50545243;  // "PTRC"
+inline constexpr uint16_t PTO2_TRACE_VERSION = 1;
+
+/** Record kinds, in stream order. */
+enum class PTO2TraceRecordType : uint8_t {
+    SUBMIT = 0,         // pto2_submit_mixed_task
+    ALLOC_TENSORS = 1,  // pto2_alloc_tensors (hidden output task)
+    SCOPE_BEGIN = 2,    // pto2_scope_begin
+    SCOPE_END = 3,      // pto2_scope_end
+};
+
+/** File header; tensor_arg_size pins the on-disk PTO2TraceTensorArg layout. */
+struct PTO2TraceFileHeader {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t tensor_arg_size;
+    uint64_t start_cycle;  // Absolute cycle of capture start (timestamps are relative)
+};
+
+/**
+ * One serialized tensor argument.
+ *
+ * For OUTPUT (TensorCreateInfo) slots only initial_value/ndims/dtype/shapes
+ * are meaningful and addr is 0; for all Tensor-backed tags the full view
+ * descriptor is stored and addr/size identify the recorded buffer.
+ */
+struct PTO2TraceTensorArg {
+    uint64_t addr;
+    uint64_t size;
+    uint64_t initial_value;
+    int32_t version;
+    uint32_t ndims;
+    int32_t dtype;  // DataType
+    int32_t tag;    // TensorArgType
+    uint32_t shapes[RUNTIME_MAX_TENSOR_DIMS];
+    uint32_t raw_shapes[RUNTIME_MAX_TENSOR_DIMS];
+    uint32_t offsets[RUNTIME_MAX_TENSOR_DIMS];
+    uint8_t is_all_offset_zero;
+    uint8_t is_raw_eq_shapes;
+    uint8_t manual_dep;
+    uint8_t has_initial_value;
+};
+
+/**
+ * Fixed-size record header. Followed in the stream by tensor_count
+ * PTO2TraceTensorArg, scalar_count uint64 scalars, and output_count uint64
+ * recorded output buffer addresses (the replay rebinding keys).
+ */
+struct PTO2TraceRecord {
+    uint8_t type;   // PTO2TraceRecordType
+    uint8_t flags;  // bit0 = require_sync_start, bit1 = high_priority
+    int16_t block_num;
+    int32_t aic_kernel_id;
+    int32_t aiv0_kernel_id;
+    int32_t aiv1_kernel_id;
+    int32_t tensor_count;
+    int32_t scalar_count;
+    int32_t output_count;
+    int16_t block_dim_x;  // Carved from the old reserved word: zero in
+                          // pre-existing captures, matching the 1-D default
+    uint16_t reserved;
+    uint64_t timestamp;  // Cycles since capture start
+};
+
+extern bool g_pto2_submit_trace_active;
+
+/** Hot-path guard — false unless PTO2_SUBMIT_TRACE opened a file. */
+static inline bool pto2_submit_trace_active() { return g_pto2_submit_trace_active; }
+
+/** Open the capture file named by PTO2_SUBMIT_TRACE, if set. Idempotent. */
+void pto2_submit_trace_init_from_env();
+
+/** Flush and close the capture file (no-op when capture is off). */
+void pto2_submit_trace_close();
+
+/** Append one submit record (call only when pto2_submit_trace_active()). */
+void pto2_submit_trace_record_submit(
+    PTO2TraceRecordType type, const MixedKernels &mixed_kernels, const Arg &args, const TaskOutputTensors &outputs
+);
+
+/** Append a scope begin/end marker. */
+void pto2_submit_trace_record_scope(PTO2TraceRecordType type);
+
+/**
+ * Replay a captured stream through the live submit path.
+ *
+ * Reads `path` and re-issues every record against `orch` in order. Returns
+ * false on file/format errors or when the orchestrator trips its fatal path
+ * mid-replay; capture is suspended for the duration so a replay cannot
+ * re-record itself.
+ */
+bool pto2_submit_trace_replay(PTO2OrchestratorState *orch, const char *path);
+
+#endif  // PTO_SUBMIT_TRACE_H
@@ -22,6 +22,13 @@
 
 inline constexpr int32_t INVALID_KERNEL_ID = -1;
 
+/**
+ * block_num sentinel: let the runtime pick the block count from the
+ * func's measured history (see pto_block_autotune.h). Resolved to a
+ * concrete count inside pto2_submit_mixed_task().
+ */
+inline constexpr int16_t PTO2_BLOCK_NUM_AUTO = -1;
+
 /**
  * Subtask slot count: AIC, AIV0, AIV1
  */
@@ -37,12 +44,13 @@ enum class PTO2SubtaskSlot : uint8_t {
 };
 
 /**
- * Subtask mask bits (for active_mask / subtask_done_mask)
+ * Subtask mask bits (for active_mask)
  */
 inline constexpr uint8_t PTO2_SUBTASK_MASK_AIC = (1u << 0);         // 0x1
 inline constexpr uint8_t PTO2_SUBTASK_MASK_AIV0 = (1u << 1);        // 0x2
 inline constexpr uint8_t PTO2_SUBTASK_MASK_AIV1 = (1u << 2);        // 0x4
 inline constexpr uint8_t PTO2_SUBTASK_FLAG_SYNC_START = (1u << 3);  // 0x8: all blocks must launch atomically
+inline constexpr uint8_t PTO2_SUBTASK_FLAG_HIGH_PRIO = (1u << 4);   // 0x10: latency-critical, high ready lane
 
 /**
  * Test whether a subtask slot is active in a given mask
@@ -63,6 +71,13 @@ static inline bool pto2_requires_sync_start(uint8_t active_mask) {
     return (active_mask & PTO2_SUBTASK_FLAG_SYNC_START) != 0;
 }
 
+/**
+ * Check whether a task was submitted as latency-critical (high ready lane).
+ */
+static inline bool pto2_is_high_priority(uint8_t active_mask) {
+    return (active_mask & PTO2_SUBTASK_FLAG_HIGH_PRIO) != 0;
+}
+
 /**
  * Mixed-task submit contract.
  *
@@ -128,10 +143,66 @@ public:
     int16_t block_num() const { return block_num_; }
     void set_block_num(int16_t n) { block_num_ = n; }
 
+    /** Let the runtime pick block_num from the func's measured history. */
+    void set_block_num_auto() { block_num_ = PTO2_BLOCK_NUM_AUTO; }
+    bool block_num_is_auto() const { return block_num_ == PTO2_BLOCK_NUM_AUTO; }
+
+    int16_t block_dim_x() const { return block_dim_x_; }
+    void set_block_dim_x(int16_t w) { block_dim_x_ = w; }
+
     bool require_sync_start() const { return require_sync_start_; }
     void set_require_sync_start(bool v) { require_sync_start_ = v; }
 
+    bool high_priority() const { return high_priority_; }
+    void set_high_priority(bool v) { high_priority_ = v; }
+
+    /**
+     * Opt-in buffer donation: ask the runtime to serve this task's OUTPUT
+     * from a dying INPUT's buffer instead of a fresh heap allocation.
+     * Only set this for kernels that are in-place safe — the output tensor
+     * may alias an input tensor byte-for-byte. The runtime honors the
+     * request only when it can confirm this task is the input's sole
+     * consumer (see pto2_submit_mixed_task); otherwise the output is
+     * allocated normally, so the flag never changes results — only where
+     * the output lives.
+     */
+    bool donate_input() const { return donate_input_; }
+    void set_donate_input(bool v) { donate_input_ = v; }
+
+    /**
+     * Opt-in early input release: let the kernel signal, mid-execution, that
+     * it has finished reading all of its inputs (see get_input_release_slot()
+     * in intrinsic.h). The AICPU then drops the task's fanin references
+     * ahead of completion, so upstream ring-heap buffers become reclaimable
+     * while the kernel is still computing. Only honored for single-core,
+     * single-block tasks; a kernel that never signals behaves exactly as
+     * before, so the flag is safe on kernels that signal conditionally.
+     */
+    bool early_input_release() const { return early_input_release_; }
+    void set_early_input_release(bool v) { early_input_release_ = v; }
+
+    /**
+     * Opt-in scalar result mailbox: give the kernel a dedicated per-task
+     * mailbox line to publish an 8-byte result mid-execution (see
+     * get_scalar_mailbox() in intrinsic.h). The orchestrator reads it with
+     * pto2_rt_read_scalar(), spinning only on that line — the value arrives
+     * at cacheline-transfer latency instead of waiting out the full
+     * completion path through a result tensor. The kernel MUST publish when
+     * this is set: the reader spins until the flag arrives or times out
+     * fatally.
+     */
+    bool scalar_result() const { return scalar_result_; }
+    void set_scalar_result(bool v) { scalar_result_ = v; }
+
 private:
     int16_t block_num_{1};
+    // Width of the logical 2-D block grid (0 or 1 = plain 1-D numbering).
+    // When set, the dispatcher precomputes (block_idx % width, block_idx / width)
+    // into LocalContext so kernel prologues skip the div/mod chain.
+    int16_t block_dim_x_{0};
     bool require_sync_start_{false};
+    bool high_priority_{false};  // Latency-critical: dispatched from the high ready lane
+    bool donate_input_{false};   // In-place safe: OUTPUT may alias a sole-consumer INPUT
+    bool early_input_release_{false};  // Kernel may signal input last-use mid-execution
+    bool scalar_result_{false};        // Kernel publishes an 8-byte result to the task mailbox
 };
@@ -28,6 +28,14 @@
  * ring_id:  which ring layer (0..PTO2_MAX_RING_DEPTH-1)
  * local_id: per-ring monotonic counter
  *
+ * local_id is never reused. With a power-of-two task window it decomposes
+ * into (generation << window_bits) | slot_index: two ids that land on the
+ * same slot always differ in the generation bits, so raw equality is an
+ * ABA-proof occupant test — a recycled slot's descriptor carries a strictly
+ * larger local id, never a repeat of an old one. Stale-reference detection
+ * against a held id is therefore a single 64-bit compare; no ordering
+ * against the ring's live window is required.
+ *
  * Invalid sentinel: raw == UINT64_MAX (no valid task has this encoding).
  */
 struct PTO2TaskId {
@@ -43,6 +51,12 @@ struct PTO2TaskId {
     constexpr uint32_t local() const { return static_cast<uint32_t>(raw & 0xFFFFFFFFu); }
     constexpr bool is_valid() const { return raw != UINT64_MAX; }
 
+    // Window decomposition (mask = per-ring task_window_size - 1). slot()
+    // indexes the slot-state/descriptor arrays; generation() is the reuse
+    // count left in place (unshifted — it only ever feeds equality tests).
+    constexpr uint32_t slot(uint32_t window_mask) const { return local() & window_mask; }
+    constexpr uint32_t generation(uint32_t window_mask) const { return local() & ~window_mask; }
+
     constexpr bool operator==(const PTO2TaskId &other) const { return raw == other.raw; }
     constexpr bool operator!=(const PTO2TaskId &other) const { return raw != other.raw; }
 };
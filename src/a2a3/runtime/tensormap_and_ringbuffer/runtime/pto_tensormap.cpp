@@ -11,14 +11,14 @@
 /**
  * PTO Runtime2 - TensorMap Implementation
  *
- * Implements TensorMap with ring buffer pool, lazy invalidation,
- * and chain truncation optimization.
+ * Implements the sharded TensorMap with per-shard entry pools, lazy
+ * invalidation, and epoch-based stale-entry reclamation.
  *
  * Key features:
  * 1. O(1) insert at bucket head
- * 2. O(valid_entries) lookup with chain truncation
- * 3. Automatic stale entry cleanup during lookup
- * 4. Periodic explicit cleanup for long chains
+ * 2. O(valid_entries) lookup over base + overlapped segment buckets
+ * 3. Incremental epoch sweep reclaims stale entries (no per-task chains)
+ * 4. Full shard sweep on pool exhaustion before asserting
  *
  * Based on: docs/RUNTIME_LOGIC.md
  */
@@ -30,6 +30,7 @@
 
 #include "common.h"
 #include "common/unified_log.h"
+#include "pto_mem_ops.h"
 #include "pto_orchestrator.h"
 
 // =============================================================================
@@ -48,86 +49,102 @@ uint64_t g_insert_count = 0;
 // Initialization and Destruction
 // =============================================================================
 
+static void destroy_shard(PTO2TensorMapShard &shard) {
+    if (shard.buckets) {
+        free(shard.buckets);
+        shard.buckets = NULL;
+    }
+    if (shard.old_buckets) {
+        free(shard.old_buckets);
+        shard.old_buckets = NULL;
+    }
+    if (shard.entry_pool) {
+        free(shard.entry_pool);
+        shard.entry_pool = NULL;
+    }
+    if (shard.free_entry_list) {
+        free(shard.free_entry_list);
+        shard.free_entry_list = NULL;
+    }
+}
+
 bool PTO2TensorMap::init(
     int32_t new_num_buckets, int32_t new_pool_size, const int32_t new_task_window_sizes[PTO2_MAX_RING_DEPTH]
 ) {
-    // Validate power of 2 for fast modulo
-    if ((new_num_buckets & (new_num_buckets - 1)) != 0) {
+    (void)new_task_window_sizes;  // Reclamation is epoch-based; no per-task tracking
+
+    // Validate power of 2 for fast modulo; totals divide evenly across shards
+    if ((new_num_buckets & (new_num_buckets - 1)) != 0 || new_num_buckets < PTO2_TENSORMAP_NUM_SHARDS) {
         return false;  // num_buckets must be power of 2
     }
 
-    // Allocate buckets
-    buckets = (PTO2TensorMapEntry **)malloc(new_num_buckets * sizeof(PTO2TensorMapEntry *));
-    if (!buckets) {
+    int32_t shard_buckets = new_num_buckets / PTO2_TENSORMAP_NUM_SHARDS;
+    int32_t shard_pool = new_pool_size / PTO2_TENSORMAP_NUM_SHARDS;
+    if (shard_pool <= 0) {
         return false;
     }
 
-    // Initialize all buckets to empty (-1)
-    for (int32_t i = 0; i < new_num_buckets; i++) {
-        buckets[i] = nullptr;
-    }
-
-    num_buckets = new_num_buckets;
+    for (int s = 0; s < PTO2_TENSORMAP_NUM_SHARDS; s++) {
+        PTO2TensorMapShard &shard = shards[s];
 
-    // Allocate entry pool (64-byte aligned for cache-line-aligned entries)
-    entry_pool =
-        (PTO2TensorMapEntry *)aligned_alloc(alignof(PTO2TensorMapEntry), new_pool_size * sizeof(PTO2TensorMapEntry));
-    if (!entry_pool) {
-        free(buckets);
-        buckets = NULL;
-        return false;
-    }
-    memset(entry_pool, 0, new_pool_size * sizeof(PTO2TensorMapEntry));
-
-    // Allocate free entry list
-    free_entry_list = (PTO2TensorMapEntry **)calloc(new_pool_size, sizeof(PTO2TensorMapEntry *));
-    if (!free_entry_list) {
-        free(buckets);
-        free(entry_pool);
-        buckets = NULL;
-        entry_pool = NULL;
-        return false;
-    }
+        // Allocate buckets
+        shard.buckets = (PTO2TensorMapEntry **)malloc(shard_buckets * sizeof(PTO2TensorMapEntry *));
+        if (!shard.buckets) {
+            for (int j = 0; j <= s; j++) {
+                destroy_shard(shards[j]);
+            }
+            return false;
+        }
 
-    pool_size = new_pool_size;
-    next_entry_idx = 0;
-    free_num = 0;
-
-    // Initialize all entries as not in bucket
-    for (int32_t i = 0; i < pool_size; i++) {
-        entry_pool[i].bucket_index = -1;
-        entry_pool[i].next_in_bucket = nullptr;
-        entry_pool[i].prev_in_bucket = nullptr;
-        entry_pool[i].next_in_task = nullptr;
-        entry_pool[i].prev_in_task = nullptr;
-        entry_pool[i].producer_task_id = PTO2TaskId{};
-    }
+        // Initialize all buckets to empty
+        for (int32_t i = 0; i < shard_buckets; i++) {
+            shard.buckets[i] = nullptr;
+        }
 
-    // Allocate per-ring per-task entry tracking (each ring has its own window size)
-    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
-        task_entry_heads[r] = (PTO2TensorMapEntry **)malloc(new_task_window_sizes[r] * sizeof(PTO2TensorMapEntry *));
-        if (!task_entry_heads[r]) {
-            // Cleanup previously allocated rings
-            for (int j = 0; j < r; j++) {
-                free(task_entry_heads[j]);
-                task_entry_heads[j] = NULL;
+        // Allocate entry pool (64-byte aligned for cache-line-aligned entries)
+        shard.entry_pool =
+            (PTO2TensorMapEntry *)aligned_alloc(alignof(PTO2TensorMapEntry), shard_pool * sizeof(PTO2TensorMapEntry));
+        if (!shard.entry_pool) {
+            for (int j = 0; j <= s; j++) {
+                destroy_shard(shards[j]);
+            }
+            return false;
+        }
+        // Streaming zero: entries are cache-line aligned and claimed lazily,
+        // so nothing re-reads the pool until inserts reach it.
+        pto2_mem_zero_nt(shard.entry_pool, shard_pool * sizeof(PTO2TensorMapEntry));
+
+        // Allocate free entry list
+        shard.free_entry_list = (PTO2TensorMapEntry **)calloc(shard_pool, sizeof(PTO2TensorMapEntry *));
+        if (!shard.free_entry_list) {
+            for (int j = 0; j <= s; j++) {
+                destroy_shard(shards[j]);
             }
-            free(entry_pool);
-            free(buckets);
-            free(free_entry_list);
-            entry_pool = NULL;
-            buckets = NULL;
-            free_entry_list = NULL;
             return false;
         }
-        for (int32_t i = 0; i < new_task_window_sizes[r]; i++) {
-            task_entry_heads[r][i] = nullptr;
+
+        shard.pool_size = shard_pool;
+        shard.num_buckets = shard_buckets;
+        shard.old_buckets = nullptr;
+        shard.next_entry_idx = 0;
+        shard.free_num = 0;
+        shard.sweep_cursor = 0;
+        shard.rehash_cursor = 0;
+        shard.live_entries = 0;
+        shard.bucket_gen = 1;  // 0 is reserved for "intern info not yet derived"
+        shard.lock.store(0, std::memory_order_relaxed);
+
+        // Initialize all entries as not in bucket
+        for (int32_t i = 0; i < shard_pool; i++) {
+            shard.entry_pool[i].bucket_index = -1;
+            shard.entry_pool[i].next_in_bucket = nullptr;
+            shard.entry_pool[i].prev_in_bucket = nullptr;
+            shard.entry_pool[i].producer_task_id = PTO2TaskId{};
         }
-        task_window_sizes[r] = new_task_window_sizes[r];
     }
 
     for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
-        last_task_alives[r] = 0;
+        last_task_alives[r].store(0, std::memory_order_relaxed);
         last_cleanup[r] = 0;
     }
 
@@ -139,26 +156,46 @@ bool PTO2TensorMap::init_default(const int32_t new_task_window_sizes[PTO2_MAX_RI
 }
 
 void PTO2TensorMap::destroy() {
-    if (buckets) {
-        free(buckets);
-        buckets = NULL;
+    for (int s = 0; s < PTO2_TENSORMAP_NUM_SHARDS; s++) {
+        destroy_shard(shards[s]);
     }
+}
 
-    if (entry_pool) {
-        free(entry_pool);
-        entry_pool = NULL;
-    }
+void PTO2TensorMap::reset() {
+    for (int s = 0; s < PTO2_TENSORMAP_NUM_SHARDS; s++) {
+        PTO2TensorMapShard &shard = shards[s];
 
-    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
-        if (task_entry_heads[r]) {
-            free(task_entry_heads[r]);
-            task_entry_heads[r] = NULL;
+        // Grown geometry is kept across resets — the workload that forced the
+        // grow is the one about to be re-run.  An in-flight migration is
+        // simply dropped: both arrays are being emptied anyway.
+        if (shard.old_buckets != nullptr) {
+            free(shard.old_buckets);
+            shard.old_buckets = nullptr;
+        }
+        for (int32_t i = 0; i < shard.num_buckets; i++) {
+            shard.buckets[i] = nullptr;
         }
+
+        // Only entries the bump allocator ever handed out can be dirty;
+        // everything past next_entry_idx is still in its init state.
+        for (int32_t i = 0; i < shard.next_entry_idx; i++) {
+            shard.entry_pool[i].bucket_index = -1;
+            shard.entry_pool[i].next_in_bucket = nullptr;
+            shard.entry_pool[i].prev_in_bucket = nullptr;
+            shard.entry_pool[i].producer_task_id = PTO2TaskId{};
+        }
+
+        shard.next_entry_idx = 0;
+        shard.free_num = 0;
+        shard.sweep_cursor = 0;
+        shard.rehash_cursor = 0;
+        shard.live_entries = 0;
+        shard.lock.store(0, std::memory_order_relaxed);
     }
 
-    if (free_entry_list) {
-        free(free_entry_list);
-        free_entry_list = NULL;
+    for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
+        last_task_alives[r].store(0, std::memory_order_relaxed);
+        last_cleanup[r] = 0;
     }
 }
 
@@ -173,51 +210,74 @@ void PTO2TensorMap::print_stats() {
     int32_t max_chain = 0;
     int64_t total_chain = 0;
     int32_t non_empty_buckets = 0;
-
-    // Count entries
-    for (int32_t i = 0; i < pool_size; i++) {
-        if (entry_pool[i].bucket_index != -1) {
-            if (entry_valid(entry_pool[i])) {
-                valid++;
-            } else {
-                stale++;
+    int32_t pool_size_total = 0;
+    int32_t next_entry_total = 0;
+    int32_t free_num_total = 0;
+    int32_t bucket_total = 0;
+    int32_t grow_total = 0;
+
+    for (int s = 0; s < PTO2_TENSORMAP_NUM_SHARDS; s++) {
+        PTO2TensorMapShard &shard = shards[s];
+        pool_size_total += shard.pool_size;
+        next_entry_total += shard.next_entry_idx;
+        free_num_total += shard.free_num;
+        bucket_total += shard.num_buckets;
+        grow_total += static_cast<int32_t>(shard.bucket_gen) - 1;
+
+        // Count entries
+        for (int32_t i = 0; i < shard.pool_size; i++) {
+            if (shard.entry_pool[i].bucket_index != -1) {
+                if (entry_valid(shard.entry_pool[i])) {
+                    valid++;
+                } else {
+                    stale++;
+                }
             }
         }
-    }
 
-    // Count bucket stats
-    for (int32_t b = 0; b < num_buckets; b++) {
-        int32_t chain_len = 0;
-        auto cur_entry = buckets[b];
-
-        while (cur_entry != nullptr) {
-            chain_len++;
-            cur_entry = cur_entry->next_in_bucket;
-        }
+        // Count bucket stats.  During a grow, unmigrated chains still live
+        // in the old array; fold them in so the numbers stay truthful.
+        for (int32_t b = 0; b < shard.num_buckets; b++) {
+            int32_t chain_len = 0;
+            auto cur_entry = shard.buckets[b];
+            while (cur_entry != nullptr) {
+                chain_len++;
+                cur_entry = cur_entry->next_in_bucket;
+            }
+            if (shard.old_buckets != nullptr && b < shard.num_buckets / 2) {
+                cur_entry = shard.old_buckets[b];
+                while (cur_entry != nullptr) {
+                    chain_len++;
+                    cur_entry = cur_entry->next_in_bucket;
+                }
+            }
 
-        if (chain_len == 0) {
-            empty_buckets++;
-        } else {
-            non_empty_buckets++;
-            total_chain += chain_len;
-            if (chain_len > max_chain) {
-                max_chain = chain_len;
+            if (chain_len == 0) {
+                empty_buckets++;
+            } else {
+                non_empty_buckets++;
+                total_chain += chain_len;
+                if (chain_len > max_chain) {
+                    max_chain = chain_len;
+                }
             }
         }
     }
 
     LOG_INFO("=== TensorMap Statistics ===");
-    LOG_INFO("Pool size:           %d", pool_size);
-    LOG_INFO("Pool next entry idx: %d", next_entry_idx);
-    LOG_INFO("Pool free_num:       %d", free_num);
-    LOG_INFO("Num buckets:         %d", num_buckets);
+    LOG_INFO("Num shards:          %d", PTO2_TENSORMAP_NUM_SHARDS);
+    LOG_INFO("Pool size:           %d", pool_size_total);
+    LOG_INFO("Pool next entry idx: %d", next_entry_total);
+    LOG_INFO("Pool free_num:       %d", free_num_total);
+    LOG_INFO("Num buckets:         %d", bucket_total);
+    LOG_INFO("Bucket growths:      %d", grow_total);
     LOG_INFO("Valid entries:       %d", valid);
     LOG_INFO("Stale entries:       %d", stale);
     LOG_INFO("Empty buckets:       %d", empty_buckets);
     LOG_INFO("Max chain len:       %d", max_chain);
     LOG_INFO("Avg chain len:       %.2f", non_empty_buckets > 0 ? (float)total_chain / non_empty_buckets : 0);
     for (int r = 0; r < PTO2_MAX_RING_DEPTH; r++) {
-        LOG_INFO("Last task alive[%d]: %d", r, last_task_alives[r]);
+        LOG_INFO("Last task alive[%d]: %d", r, last_task_alives[r].load(std::memory_order_relaxed));
     }
     LOG_INFO("============================");
 }
@@ -225,9 +285,12 @@ void PTO2TensorMap::print_stats() {
 int32_t PTO2TensorMap::valid_count() {
     int32_t count = 0;
 
-    for (int32_t i = 0; i < pool_size; i++) {
-        if (entry_pool[i].bucket_index != -1 && entry_valid(entry_pool[i])) {
-            count++;
+    for (int s = 0; s < PTO2_TENSORMAP_NUM_SHARDS; s++) {
+        PTO2TensorMapShard &shard = shards[s];
+        for (int32_t i = 0; i < shard.pool_size; i++) {
+            if (shard.entry_pool[i].bucket_index != -1 && entry_valid(shard.entry_pool[i])) {
+                count++;
+            }
         }
     }
 
@@ -236,14 +299,20 @@ int32_t PTO2TensorMap::valid_count() {
 
 void PTO2TensorMap::sync_tensormap(PTO2TaskId task_id, int32_t sm_last_task_alive) {
     auto ring_id = task_id.ring();
-    auto local_id = task_id.local();
     sync_validity(ring_id, sm_last_task_alive);
 
-    // Only attempt cleanup when last_task_alive has actually advanced;
-    // otherwise cleanup_retired would empty-loop and we'd spin forever.
-    auto overlap = get_task_local_id_slot(ring_id, local_id) == get_task_local_id_slot(ring_id, last_cleanup[ring_id]);
-    if (sm_last_task_alive - last_cleanup[ring_id] >= PTO2_TENSORMAP_CLEANUP_INTERVAL || overlap) {
-        cleanup_retired(ring_id, last_cleanup[ring_id], sm_last_task_alive);
+    // Incremental epoch sweep: once the retire threshold has advanced far
+    // enough, visit a slice of every shard's buckets.  A full pass over the
+    // table completes every SWEEP_SLICES triggers; pool exhaustion forces a
+    // full sweep of the allocating shard as a backstop (see new_entry).
+    if (sm_last_task_alive - last_cleanup[ring_id] >= PTO2_TENSORMAP_CLEANUP_INTERVAL) {
+        for (int s = 0; s < PTO2_TENSORMAP_NUM_SHARDS; s++) {
+            shards[s].acquire();
+            int32_t budget =
+                (shards[s].num_buckets + PTO2_TENSORMAP_SWEEP_SLICES - 1) / PTO2_TENSORMAP_SWEEP_SLICES;
+            sweep_shard(shards[s], budget);
+            shards[s].release();
+        }
         last_cleanup[ring_id] = sm_last_task_alive;
     }
 }
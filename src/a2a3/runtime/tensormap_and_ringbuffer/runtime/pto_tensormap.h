@@ -17,21 +17,69 @@
  * - Used by pto_submit_task() to find dependencies
  *
  * Key design features:
- * 1. Ring buffer pool for entries (no malloc/free)
- * 2. Lazy invalidation (entries become stale when producer retires)
- * 3. Per-task per-ring entry tracking for efficient cleanup
- * 4. OVERLAP DETECTION: Detects dependencies for overlapping sub-regions
+ * 1. Sharded by base-pointer hash: each shard is an independent hash table
+ *    slice with its own entry pool and spinlock, so concurrent submitting
+ *    threads only contend when they touch the same shard
+ * 2. Ring buffer pool for entries (no malloc/free)
+ * 3. Lazy invalidation (entries become stale when producer retires)
+ * 4. Epoch-based reclamation: stale entries are freed by an incremental
+ *    bucket sweep keyed off last_task_alive (no per-task unlink chains)
+ * 5. OVERLAP DETECTION: Detects dependencies for overlapping sub-regions
  *
  * Hash table with chaining:
  * - buckets[] array of head offsets
  * - Entries linked via next_in_bucket
  * - Insert at head (newest first) for sorted chains
  *
- * CRITICAL: Hash only by base_ptr
- * ==============================
- * For overlap detection to work, ALL sub-regions of the same base tensor
- * MUST be in the SAME hash bucket. This allows lookup to compare all
- * potentially overlapping regions.
+ * CRITICAL: Two-level hashing by (base_ptr, dim-0 segment)
+ * ========================================================
+ * For overlap detection to work, lookup must visit every entry of the same
+ * base tensor that can intersect the queried region.  A single bucket per
+ * base_ptr satisfies this but degenerates into one enormous chain when
+ * thousands of sub-region tasks target one giant base tensor (e.g. KV cache).
+ *
+ * The dim-0 index space is therefore partitioned into fixed segments of
+ * 2^PTO2_TENSORMAP_SEGMENT_SHIFT elements:
+ *   - Entries whose dim-0 range fits inside ONE segment are bucketed by
+ *     hash(base_ptr, segment) — the second level.
+ *   - Entries spanning multiple segments (or with no usable dim-0 range)
+ *     stay in the base bucket hash(base_ptr) — the first level.
+ * Lookup scans the base bucket plus only the segment buckets overlapped by
+ * the query's dim-0 range, so disjoint sub-regions never see each other.
+ * The shard is selected by base_ptr alone, so both levels of one tensor
+ * always live in the same shard and a lookup locks exactly one shard.
+ *
+ * Epoch-based reclamation
+ * =======================
+ * Entry validity is the epoch check: an entry is live while its producer's
+ * local id is >= last_task_alive of its ring.  Reclamation never needs to
+ * find "the entries of task N" — it just frees any entry that fails the
+ * epoch check while walking bucket chains:
+ *   - Periodic: every PTO2_TENSORMAP_CLEANUP_INTERVAL retired tasks, each
+ *     shard sweeps 1/PTO2_TENSORMAP_SWEEP_SLICES of its buckets (round
+ *     robin), so a full pass completes every
+ *     PTO2_TENSORMAP_SWEEP_SLICES * PTO2_TENSORMAP_CLEANUP_INTERVAL tasks.
+ *   - On pool exhaustion: the allocating shard is swept in full before the
+ *     out-of-entries assert fires.
+ * Entries returned by lookup stay allocated until their producer retires,
+ * so holding a lookup result across the shard unlock is safe within the
+ * submitting epoch.
+ *
+ * Adaptive bucket resizing
+ * ========================
+ * The initial bucket count is a guess; KV-style workloads that pack tens of
+ * thousands of live sub-region entries degrade into long chains when it is
+ * low, while oversizing wastes memory on every run.  Each shard therefore
+ * tracks its live entry count and, when the average chain length would
+ * exceed PTO2_TENSORMAP_MAX_LOAD, doubles its bucket array and rehashes
+ * INCREMENTALLY: every subsequent insert migrates a few old buckets
+ * (PTO2_TENSORMAP_REHASH_BUDGET) into the new array, so no single submit
+ * pays the full migration.  Because the hash extracts the TOP log2(buckets)
+ * bits, doubling splits old bucket b into new buckets 2b and 2b+1; while a
+ * grow is in flight a lookup of new bucket nb additionally scans
+ * unmigrated old bucket nb >> 1.  Interned hash infos
+ * (PTO2TensorHashInfo) carry the shard's bucket-array generation and are
+ * re-derived lazily under the shard lock after a grow.
  *
  * Overlap detection: Two regions create a dependency if:
  *   1. Same base_ptr (raw tensor pointer)
@@ -42,6 +90,10 @@
 
 #pragma once
 
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 #include "common.h"
 #include "pto_runtime2_types.h"
 #include "tensor.h"
@@ -55,6 +107,44 @@ struct PTO2OrchestratorState;  // forward declare
 #define PTO2_TENSORMAP_PROFILING 0
 #endif
 
+// Dim-0 segment granularity for the second-level index (elements per segment).
+// Entries contained in one segment hash by (base_ptr, segment); spanning
+// entries fall back to the base bucket.
+#ifndef PTO2_TENSORMAP_SEGMENT_SHIFT
+#define PTO2_TENSORMAP_SEGMENT_SHIFT 12
+#endif
+
+// Number of independent shards, selected by base-pointer hash.  Must be a
+// power of 2.  Buckets and pool entries are divided evenly across shards.
+#ifndef PTO2_TENSORMAP_NUM_SHARDS
+#define PTO2_TENSORMAP_NUM_SHARDS 4
+#endif
+
+// Epoch sweep granularity: each periodic sweep visits this fraction of every
+// shard's buckets (1/N), bounding per-submit cleanup cost.
+#ifndef PTO2_TENSORMAP_SWEEP_SLICES
+#define PTO2_TENSORMAP_SWEEP_SLICES 16
+#endif
+
+// Adaptive resize: a shard doubles its bucket array once its live entry
+// count exceeds this many entries per bucket (average chain length), then
+// migrates old buckets incrementally so no single insert pays the full
+// rehash. Growth caps at the shard's pool size — more buckets than entries
+// can never shorten a chain.
+#ifndef PTO2_TENSORMAP_MAX_LOAD
+#define PTO2_TENSORMAP_MAX_LOAD 4
+#endif
+
+// Old buckets migrated per insert while a shard grow is in progress.
+#ifndef PTO2_TENSORMAP_REHASH_BUDGET
+#define PTO2_TENSORMAP_REHASH_BUDGET 4
+#endif
+
+// Capacity of the orchestrator's tensor intern table (registered views).
+#ifndef PTO2_TENSOR_INTERN_CAP
+#define PTO2_TENSOR_INTERN_CAP 1024
+#endif
+
 #if PTO2_TENSORMAP_PROFILING
 extern uint64_t g_lookup_chain_total;
 extern uint64_t g_lookup_count;
@@ -77,7 +167,7 @@ extern uint64_t g_insert_count;
  *   shapes[5] — overlap comparison
  *
  * Cache line 2 (64B, insert/remove/slow-path only):
- *   prev_in_bucket, next_in_task, prev_in_task — chain manipulation
+ *   prev_in_bucket — chain manipulation
  *   offsets[5] — only read when !is_all_offset_zero
  *
  * When is_all_offset_zero is true, lookup touches only cache line 1.
@@ -88,21 +178,20 @@ struct alignas(64) PTO2TensorMapEntry {
     uint64_t buffer_addr;                // 8B: tensor base address (hash key)
     PTO2TensorMapEntry *next_in_bucket;  // 8B: next entry in hash bucket chain
     PTO2TaskId producer_task_id;         // 8B: raw (ring_id << 32) | local_id
-    int32_t bucket_index;                // 4B: bucket index (-1 if unlinked)
+    int32_t bucket_index;                // 4B: bucket index within shard (-1 if unlinked)
     uint32_t __padding0__;               // 4B: occupies Tensor::start_offset high half
     int32_t version;                     // 4B: tensor version for overlap detection
     uint32_t ndims;                      // 4B: number of dimensions
     DataType __padding_dtype__;          // 1B: occupies Tensor::dtype
     bool is_all_offset_zero;             // 1B: fast-path flag
-    uint8_t __padding1__[2];
+    uint8_t link_gen;                    // 1B: shard bucket-array generation at link time
+    uint8_t __padding1__;
     uint32_t shapes[RUNTIME_MAX_TENSOR_DIMS];  // 20B: shape per dimension
 
     // === Cache line 2 (64B) — insert/remove/slow-path ===
     PTO2TensorMapEntry *prev_in_bucket;         // 8B: prev in hash bucket chain
-    PTO2TensorMapEntry *next_in_task;           // 8B: next entry for same task
-    PTO2TensorMapEntry *prev_in_task;           // 8B: prev entry for same task
     uint32_t offsets[RUNTIME_MAX_TENSOR_DIMS];  // 20B: only when !is_all_offset_zero
-    // padding: 20B to fill 64B
+    // padding: 36B to fill 64B
 
     /**
      * Copy overlap-relevant fields from a Tensor into this entry.
@@ -121,18 +210,96 @@ struct alignas(64) PTO2TensorMapEntry {
         buffer_addr = addr;
     }
 
+    /**
+     * Dimension-specialized overlap check for low-rank entries.
+     *
+     * NDims is a compile-time constant selected per entry by check_overlap,
+     * so every per-dimension loop below fully unrolls with no runtime ndims
+     * test: the dominant 2-D case reduces to four scalar compares per
+     * interval test, cheaper than the vector path's lane masking and setup.
+     * Region ends fit in 32 bits — offset + shape never exceeds the base
+     * tensor's per-dim extent, which is itself a uint32 — so the adds
+     * cannot wrap.
+     */
+    template <uint32_t NDims>
+    OverlapStatus check_overlap_fixed(const Tensor &input) const {
+        // Fast path: both have zero offsets → ranges are [0, shape[i]) and
+        // always intersect.
+        if (input.is_all_offset_zero && is_all_offset_zero) {
+            bool contains = true;
+            for (uint32_t i = 0; i < NDims; i++) {
+                if (input.shapes[i] < shapes[i]) {
+                    contains = false;
+                }
+            }
+            if (input.version != version) {
+                return OverlapStatus::OTHER;
+            }
+            return contains ? OverlapStatus::COVERED : OverlapStatus::OTHER;
+        }
+        bool contains = true;
+        for (uint32_t i = 0; i < NDims; i++) {
+            uint32_t in_off = input.is_all_offset_zero ? 0 : input.offsets[i];
+            uint32_t ent_off = is_all_offset_zero ? 0 : offsets[i];
+            uint32_t in_end = in_off + input.shapes[i];
+            uint32_t ent_end = ent_off + shapes[i];
+            if (in_end <= ent_off || ent_end <= in_off) {
+                return OverlapStatus::NO_OVERLAP;
+            }
+            if (in_off > ent_off || ent_end > in_end) {
+                contains = false;
+            }
+        }
+        if (input.version != version) {
+            return OverlapStatus::OTHER;
+        }
+        return contains ? OverlapStatus::COVERED : OverlapStatus::OTHER;
+    }
+
     /**
      * Check overlap between input tensor and this entry (the producer output).
-     * Mirrors Tensor::is_overlap() logic but operates on entry fields directly.
+     *
+     * Rank 1-3 entries (the overwhelming majority of real workloads) dispatch
+     * to the dimension-templated scalar path above, where the loop count is a
+     * compile-time constant. Rank 4-5 entries fall through to the lanewise
+     * path: shapes[]/offsets[] are packed uint32 lanes on both sides, so on
+     * aarch64 the per-dimension interval test is done with NEON — dims 0..3 in
+     * one uint32x4 compare (lanes >= ndims masked out), dim 4 as a scalar
+     * tail. Region ends fit in 32 bits — offset + shape never exceeds the
+     * base tensor's per-dim extent, which is itself a uint32 — so the lane
+     * adds cannot wrap.
+     *
+     * Versions are resolved AFTER geometry. Registered slice views carry
+     * independent per-slice version streams (see
+     * PTO2TensorInternTable::bump_version), so counters of different slices
+     * drift apart freely: disjoint regions stay independent no matter the
+     * skew, while an overlapping region with a version mismatch downgrades
+     * to OTHER — a conservative dependency that is never treated as covered.
      */
     OverlapStatus check_overlap(const Tensor &input) const {
         debug_assert(input.buffer.addr == buffer_addr);
-        debug_assert(input.version >= version);
-        if (input.version > version) {
-            return OverlapStatus::OTHER;
+        switch (ndims) {
+            case 1:
+                return check_overlap_fixed<1>(input);
+            case 2:
+                return check_overlap_fixed<2>(input);
+            case 3:
+                return check_overlap_fixed<3>(input);
+            default:
+                break;
         }
         // Fast path: both have zero offsets → ranges are [0, shape[i])
         if (input.is_all_offset_zero && is_all_offset_zero) {
+#if defined(__aarch64__)
+            const uint32_t lane_idx[4] = {0, 1, 2, 3};
+            uint32x4_t active = vcltq_u32(vld1q_u32(lane_idx), vdupq_n_u32(ndims));
+            uint32x4_t shrinks = vcltq_u32(vld1q_u32(input.shapes), vld1q_u32(shapes));
+            bool contains = vmaxvq_u32(vandq_u32(shrinks, active)) == 0;
+            if (ndims == RUNTIME_MAX_TENSOR_DIMS &&
+                input.shapes[RUNTIME_MAX_TENSOR_DIMS - 1] < shapes[RUNTIME_MAX_TENSOR_DIMS - 1]) {
+                contains = false;
+            }
+#else
             bool contains = true;
             for (uint32_t i = 0; i < ndims; i++) {
                 if (input.shapes[i] < shapes[i]) {
@@ -140,9 +307,47 @@ struct alignas(64) PTO2TensorMapEntry {
                     break;
                 }
             }
+#endif
+            // Both regions start at offset 0, so they always intersect.
+            if (input.version != version) {
+                return OverlapStatus::OTHER;
+            }
             return contains ? OverlapStatus::COVERED : OverlapStatus::OTHER;
         }
         // Slow path: at least one has non-zero offsets
+#if defined(__aarch64__)
+        const uint32_t lane_idx[4] = {0, 1, 2, 3};
+        uint32x4_t active = vcltq_u32(vld1q_u32(lane_idx), vdupq_n_u32(ndims));
+        uint32x4_t in_off = input.is_all_offset_zero ? vdupq_n_u32(0) : vld1q_u32(input.offsets);
+        uint32x4_t ent_off = is_all_offset_zero ? vdupq_n_u32(0) : vld1q_u32(offsets);
+        uint32x4_t in_end = vaddq_u32(in_off, vld1q_u32(input.shapes));
+        uint32x4_t ent_end = vaddq_u32(ent_off, vld1q_u32(shapes));
+        // Disjoint in any active dim → no dependency; a dim where the entry
+        // range escapes the input range downgrades COVERED to OTHER.
+        uint32x4_t disjoint = vorrq_u32(vcleq_u32(in_end, ent_off), vcleq_u32(ent_end, in_off));
+        uint32x4_t escapes = vorrq_u32(vcgtq_u32(in_off, ent_off), vcgtq_u32(ent_end, in_end));
+        bool no_overlap = vmaxvq_u32(vandq_u32(disjoint, active)) != 0;
+        bool contains = vmaxvq_u32(vandq_u32(escapes, active)) == 0;
+        if (ndims == RUNTIME_MAX_TENSOR_DIMS) {
+            constexpr uint32_t i = RUNTIME_MAX_TENSOR_DIMS - 1;
+            uint64_t in_off_tail = input.is_all_offset_zero ? 0 : input.offsets[i];
+            uint64_t ent_off_tail = is_all_offset_zero ? 0 : offsets[i];
+            Segment in_range{in_off_tail, in_off_tail + static_cast<uint64_t>(input.shapes[i])};
+            Segment ent_range{ent_off_tail, ent_off_tail + static_cast<uint64_t>(shapes[i])};
+            if (!in_range.line_segment_intersection(ent_range)) {
+                no_overlap = true;
+            } else if (!in_range.contains(ent_range)) {
+                contains = false;
+            }
+        }
+        if (no_overlap) {
+            return OverlapStatus::NO_OVERLAP;
+        }
+        if (input.version != version) {
+            return OverlapStatus::OTHER;
+        }
+        return contains ? OverlapStatus::COVERED : OverlapStatus::OTHER;
+#else
         bool contains = true;
         for (uint32_t i = 0; i < ndims; i++) {
             uint64_t in_off = input.is_all_offset_zero ? 0 : input.offsets[i];
@@ -155,7 +360,11 @@ struct alignas(64) PTO2TensorMapEntry {
                 contains = false;
             }
         }
+        if (input.version != version) {
+            return OverlapStatus::OTHER;
+        }
         return contains ? OverlapStatus::COVERED : OverlapStatus::OTHER;
+#endif
     }
 };
 
@@ -169,6 +378,27 @@ static_assert(
     offsetof(PTO2TensorMapEntry, prev_in_bucket) == 64, "TensorMapEntry must be exactly 2 cache lines (128 bytes)"
 );
 
+/**
+ * Precomputed hash/segment metadata for one tensor view.
+ *
+ * Derived once at intern time (PTO2TensorInternTable) so repeated
+ * lookups/inserts of the same view skip shard selection, bucket hashing,
+ * and dim-0 segment-range derivation on every submit.
+ */
+struct PTO2TensorHashInfo {
+    uint32_t shard;         // Shard index (shard_of result)
+    uint32_t base_bucket;   // First-level bucket (hash of base addr)
+    uint32_t entry_bucket;  // Insert bucket (bucket_for_entry result)
+    uint32_t seg_lo;        // Dim-0 segment range covered by the view
+    uint32_t seg_hi;
+    bool has_segment;       // False when the view has no usable dim-0 range
+    // Shard bucket-array generation base/entry_bucket were derived under.
+    // 0 (the intern-time value) never matches a live generation, so the
+    // geometry-dependent buckets are (re)computed lazily under the shard
+    // lock — on first use and again after every shard grow.
+    uint32_t gen;
+};
+
 /**
  * Stack-allocated lookup result (avoids heap allocation per lookup)
  */
@@ -192,60 +422,108 @@ struct PTO2LookupResult {
 };
 
 /**
- * TensorMap structure
- *
- * Hash table with ring buffer entry pool and lazy invalidation.
+ * One TensorMap shard: an independent hash table slice with its own entry
+ * pool.  All buckets (base and segment level) of one base tensor live in
+ * the same shard, so a lookup or insert locks exactly one shard.
  */
-struct PTO2TensorMap {
-    // Hash table buckets (fixed size, power of 2)
-    PTO2TensorMapEntry **buckets;  // Array of offsets into entry_pool (-1 = empty)
-    int32_t num_buckets;           // Must be power of 2 for fast modulo
-
-    // Entry pool as ring buffer
-    PTO2TensorMapEntry *entry_pool;        // Ring buffer of entries
+struct PTO2TensorMapShard {
+    PTO2TensorMapEntry **buckets;          // Shard's bucket heads (nullptr = empty)
+    PTO2TensorMapEntry **old_buckets;      // Previous bucket array while a grow is migrating (else nullptr)
+    PTO2TensorMapEntry *entry_pool;        // Shard's entry pool
     PTO2TensorMapEntry **free_entry_list;  // free entry ids
-    int32_t pool_size;                     // Total pool capacity
+    int32_t pool_size;                     // Shard pool capacity
+    int32_t num_buckets;                   // Current bucket count (power of 2, grows by doubling)
     int32_t next_entry_idx;                // id when next entry insert
     int32_t free_num;                      // free entry number in entry pool
+    int32_t sweep_cursor;                  // Next bucket visited by the epoch sweep
+    int32_t rehash_cursor;                 // Next old bucket to migrate during a grow
+    int32_t live_entries;                  // Linked entries (inserts - frees), drives the load factor
+    uint32_t bucket_gen;                   // Bucket-array generation, bumped on every grow (starts at 1)
+
+    // Per-shard spinlock serializing submitting threads.  Uncontended
+    // acquire is a single CAS; the single-threaded orchestrator never spins.
+    std::atomic<int32_t> lock;
 
-    // Per-ring per-task entry tracking (for efficient bucket cleanup)
-    // Indexed by [ring_id][local_id & (task_window_sizes[ring_id] - 1)]
-    PTO2TensorMapEntry **task_entry_heads[PTO2_MAX_RING_DEPTH];
-    int32_t task_window_sizes[PTO2_MAX_RING_DEPTH];  // Per-ring task window size (for slot masking)
+    void acquire() {
+        int32_t expected = 0;
+        while (!lock.compare_exchange_weak(expected, 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+            expected = 0;
+            SPIN_WAIT_HINT();
+        }
+    }
+
+    void release() { lock.store(0, std::memory_order_release); }
+};
+
+/**
+ * TensorMap structure
+ *
+ * Sharded hash table with per-shard entry pools, lazy invalidation, and
+ * epoch-based stale-entry reclamation.
+ */
+struct PTO2TensorMap {
+    // Independent shards, selected by base-pointer hash.  Bucket geometry is
+    // per shard (PTO2TensorMapShard::num_buckets) so each shard grows on its
+    // own load factor without coordinating with the others.
+    PTO2TensorMapShard shards[PTO2_TENSORMAP_NUM_SHARDS];
 
-    // Per-ring validity threshold (for lazy invalidation)
-    int32_t last_task_alives[PTO2_MAX_RING_DEPTH];  // Cached from shared memory per ring
+    // Per-ring validity threshold (for lazy invalidation). Atomic because
+    // each parallel orchestration branch refreshes its own ring's slot while
+    // every submitting thread reads all of them in entry_valid; relaxed is
+    // enough since the threshold only ever advances and a stale read merely
+    // keeps an entry alive one sweep longer.
+    std::atomic<int32_t> last_task_alives[PTO2_MAX_RING_DEPTH];  // Cached from shared memory per ring
 
-    // Per-ring cleanup progress (for periodic cleanup_retired)
+    // Per-ring sweep progress (for periodic epoch sweeps)
     int32_t last_cleanup[PTO2_MAX_RING_DEPTH]{};
 
     PTO2OrchestratorState *orch{nullptr};
 
-    uint32_t get_task_local_id_slot(uint8_t ring_id, uint32_t task_local_id) const {
-        return task_local_id & (task_window_sizes[ring_id] - 1);
+    /**
+     * Select the shard for a base address.  Distinct multiplier from hash()
+     * so shard and bucket indices don't correlate.
+     */
+    static uint32_t shard_of(uint64_t addr) {
+        return static_cast<uint32_t>((addr * 0xFF51AFD7ED558CCDULL) >> 56) & (PTO2_TENSORMAP_NUM_SHARDS - 1);
     }
 
     // new_entry only allocates memory, does not assign attributes
-    PTO2TensorMapEntry *new_entry() {
-        if (free_num > 0) {
-            PTO2TensorMapEntry *res = free_entry_list[--free_num];
+    PTO2TensorMapEntry *new_entry(PTO2TensorMapShard &shard) {
+        if (shard.free_num > 0) {
+            PTO2TensorMapEntry *res = shard.free_entry_list[--shard.free_num];
             debug_assert(res->bucket_index == -1);
             return res;
         }
-        always_assert(next_entry_idx < pool_size);
-        PTO2TensorMapEntry *res = &entry_pool[next_entry_idx++];
+        if (shard.next_entry_idx < shard.pool_size) {
+            PTO2TensorMapEntry *res = &shard.entry_pool[shard.next_entry_idx++];
+            debug_assert(res->bucket_index == -1);
+            return res;
+        }
+        // Pool exhausted: finish any in-flight bucket migration (which
+        // reclaims stale old-table entries as it goes), then epoch-sweep the
+        // whole shard before giving up.
+        migrate_step(shard, shard.num_buckets);
+        sweep_shard(shard, shard.num_buckets);
+        always_assert(shard.free_num > 0);
+        PTO2TensorMapEntry *res = shard.free_entry_list[--shard.free_num];
         debug_assert(res->bucket_index == -1);
         return res;
     }
 
-    void free_entry(PTO2TensorMapEntry &entry) {
+    void free_entry(PTO2TensorMapShard &shard, PTO2TensorMapEntry &entry) {
         always_assert(entry.bucket_index != -1);  // must still be in a bucket
 
+        // During a grow, entries linked under the previous generation still
+        // sit in the old bucket array; their bucket_index is relative to it.
+        PTO2TensorMapEntry **table =
+            (shard.old_buckets != nullptr && entry.link_gen != static_cast<uint8_t>(shard.bucket_gen))
+                ? shard.old_buckets
+                : shard.buckets;
+
         // Update predecessor's next pointer (O(1) via prev_in_bucket)
         if (entry.prev_in_bucket == nullptr) {
             // Entry is the head of its bucket chain, update bucket head
-            // Must compute hash BEFORE clearing tensor
-            buckets[entry.bucket_index] = entry.next_in_bucket;
+            table[entry.bucket_index] = entry.next_in_bucket;
         } else {
             entry.prev_in_bucket->next_in_bucket = entry.next_in_bucket;
         }
@@ -255,12 +533,11 @@ struct PTO2TensorMap {
             entry.next_in_bucket->prev_in_bucket = entry.prev_in_bucket;
         }
 
-        free_entry_list[free_num++] = &entry;
+        shard.free_entry_list[shard.free_num++] = &entry;
         entry.bucket_index = -1;
         entry.next_in_bucket = nullptr;
         entry.prev_in_bucket = nullptr;
-        entry.next_in_task = nullptr;
-        entry.prev_in_task = nullptr;
+        shard.live_entries--;
     }
 
     // =============================================================================
@@ -270,8 +547,8 @@ struct PTO2TensorMap {
     /**
      * Initialize TensorMap
      *
-     * @param num_buckets Number of hash buckets (must be power of 2)
-     * @param pool_size   Size of entry pool
+     * @param num_buckets Total number of hash buckets across shards (power of 2)
+     * @param pool_size   Total entry pool size across shards
      * @return true on success, false on allocation failure
      */
     bool init(int32_t num_buckets, int32_t pool_size, const int32_t task_window_sizes[PTO2_MAX_RING_DEPTH]);
@@ -286,13 +563,25 @@ struct PTO2TensorMap {
      */
     void destroy();
 
+    /**
+     * Drop every entry without freeing or reallocating (fast runtime reset).
+     *
+     * Clears bucket heads and returns the entry pools to their pristine
+     * bump-allocation state; cost is O(buckets + used entries), independent
+     * of graph size. Caller must guarantee no concurrent lookups or inserts
+     * (shard locks are not taken).
+     */
+    void reset();
+
     /**
      * Update validity threshold from shared memory
      * Called periodically to refresh the lazy invalidation threshold.
      *
      * @param last_task_alive  Current value from shared memory
      */
-    void sync_validity(int32_t ring_id, int32_t last_task_alive) { this->last_task_alives[ring_id] = last_task_alive; }
+    void sync_validity(int32_t ring_id, int32_t last_task_alive) {
+        this->last_task_alives[ring_id].store(last_task_alive, std::memory_order_relaxed);
+    }
 
     /**
      * Lookup producer for a tensor region
@@ -302,18 +591,96 @@ struct PTO2TensorMap {
      * Stale entries from different rings are skipped (not truncated).
      *
      * @param tensor  Tensor to look up
+     * @param info    Optional precomputed hash/segment metadata for this view
+     *                (from the intern table); nullptr derives it from the tensor
      * @param result  Output: stack-allocated result buffer
      */
-    void lookup(const Tensor &tensor, PTO2LookupResult &result) {
-        uint32_t bucket_index = hash(tensor.buffer.addr);
-        PTO2TensorMapEntry *cur_entry = buckets[bucket_index];
-
+    void lookup(const Tensor &tensor, PTO2LookupResult &result, const PTO2TensorHashInfo *info = nullptr) {
         result.count = 0;
 #if PTO2_TENSORMAP_PROFILING
         g_lookup_count++;
         int32_t chain_len = 0;
 #endif
+        PTO2TensorMapShard &shard = shards[info ? info->shard : shard_of(tensor.buffer.addr)];
+        shard.acquire();
+        if (info != nullptr && info->gen != shard.bucket_gen) {
+            refresh_info(shard, *const_cast<PTO2TensorHashInfo *>(info), tensor);
+        }
 
+        // Level 1: base bucket holds segment-spanning entries of this base.
+        uint32_t base_bucket = info ? info->base_bucket : hash(tensor.buffer.addr, shard.num_buckets);
+#if PTO2_TENSORMAP_PROFILING
+        scan_bucket(shard, tensor, base_bucket, /*dedupe=*/false, result, chain_len);
+#else
+        scan_bucket(shard, tensor, base_bucket, /*dedupe=*/false, result);
+#endif
+
+        // Level 2: segment buckets overlapped by the query's dim-0 range.
+        uint32_t seg_lo, seg_hi;
+        bool has_segment;
+        if (info) {
+            has_segment = info->has_segment;
+            seg_lo = info->seg_lo;
+            seg_hi = info->seg_hi;
+        } else {
+            has_segment = segment_range(
+                tensor.ndims, tensor.is_all_offset_zero ? nullptr : tensor.offsets, tensor.shapes, seg_lo, seg_hi
+            );
+        }
+        if (has_segment) {
+            for (uint32_t seg = seg_lo; seg <= seg_hi; seg++) {
+                uint32_t seg_bucket = hash_segment(tensor.buffer.addr, seg, shard.num_buckets);
+                if (seg_bucket == base_bucket) {
+                    continue;  // already scanned as level 1
+                }
+                // Hash collisions between segments can alias to the same bucket;
+                // dedupe at push so an entry is never reported twice.
+#if PTO2_TENSORMAP_PROFILING
+                scan_bucket(shard, tensor, seg_bucket, /*dedupe=*/true, result, chain_len);
+#else
+                scan_bucket(shard, tensor, seg_bucket, /*dedupe=*/true, result);
+#endif
+            }
+        }
+        shard.release();
+#if PTO2_TENSORMAP_PROFILING
+        g_lookup_chain_total += chain_len;
+        if (chain_len > g_lookup_chain_max) g_lookup_chain_max = chain_len;
+#endif
+    }
+
+    /**
+     * Scan one bucket chain for valid overlapping entries of this base tensor.
+     *
+     * While a grow is migrating, entries hashed to this bucket may still sit
+     * in the OLD array under the parent bucket (new index = (old << 1) | bit,
+     * since the hash extracts the top bits), so the unmigrated parent chain
+     * is scanned as well.  Base and segment buckets with a shared parent
+     * cannot double-report: segment scans dedupe against the result, and an
+     * entry lives in exactly one of the two arrays.
+     */
+#if PTO2_TENSORMAP_PROFILING
+    void scan_bucket(PTO2TensorMapShard &shard, const Tensor &tensor, uint32_t bucket_index, bool dedupe,
+                     PTO2LookupResult &result, int32_t &chain_len) {
+        scan_chain(shard.buckets[bucket_index], tensor, dedupe, result, chain_len);
+        if (shard.old_buckets != nullptr && static_cast<int32_t>(bucket_index >> 1) >= shard.rehash_cursor) {
+            scan_chain(shard.old_buckets[bucket_index >> 1], tensor, /*dedupe=*/true, result, chain_len);
+        }
+    }
+
+    void scan_chain(PTO2TensorMapEntry *cur_entry, const Tensor &tensor, bool dedupe, PTO2LookupResult &result,
+                    int32_t &chain_len) {
+#else
+    void scan_bucket(PTO2TensorMapShard &shard, const Tensor &tensor, uint32_t bucket_index, bool dedupe,
+                     PTO2LookupResult &result) {
+        scan_chain(shard.buckets[bucket_index], tensor, dedupe, result);
+        if (shard.old_buckets != nullptr && static_cast<int32_t>(bucket_index >> 1) >= shard.rehash_cursor) {
+            scan_chain(shard.old_buckets[bucket_index >> 1], tensor, /*dedupe=*/true, result);
+        }
+    }
+
+    void scan_chain(PTO2TensorMapEntry *cur_entry, const Tensor &tensor, bool dedupe, PTO2LookupResult &result) {
+#endif
         while (cur_entry != nullptr) {
             PTO2TensorMapEntry *next_entry = cur_entry->next_in_bucket;
 
@@ -329,14 +696,15 @@ struct PTO2TensorMap {
             }
 
             // Entry is valid - check if regions OVERLAP (not just exact match)
-            // Since we hash only by base_ptr, all entries in this bucket have
-            // potential to overlap. We must check actual byte-range overlap.
+            // Buckets hash only by (base_ptr, segment), so every entry in this
+            // bucket has potential to overlap.  We must check actual byte-range
+            // overlap.
             if (tensor.buffer.addr == cur_entry->buffer_addr) {
 #if PTO2_TENSORMAP_PROFILING
                 g_lookup_overlap_checks++;
 #endif
                 auto overlap_status = cur_entry->check_overlap(tensor);
-                if (overlap_status != OverlapStatus::NO_OVERLAP) {
+                if (overlap_status != OverlapStatus::NO_OVERLAP && (!dedupe || !result_contains(result, cur_entry))) {
                     result.push(cur_entry, overlap_status);
 #if PTO2_TENSORMAP_PROFILING
                     g_lookup_overlap_hits++;
@@ -347,57 +715,172 @@ struct PTO2TensorMap {
             // Move to next entry
             cur_entry = next_entry;
         }
-#if PTO2_TENSORMAP_PROFILING
-        g_lookup_chain_total += chain_len;
-        if (chain_len > g_lookup_chain_max) g_lookup_chain_max = chain_len;
-#endif
+    }
+
+    static bool result_contains(const PTO2LookupResult &result, const PTO2TensorMapEntry *entry) {
+        for (int32_t i = 0; i < result.count; i++) {
+            if (result.entries[i].entry == entry) {
+                return true;
+            }
+        }
+        return false;
     }
 
     /**
      * Insert a new entry (called when task produces output)
      *
-     * Allocates from ring buffer pool, may overwrite stale entries.
+     * Allocates from the shard's pool, may reclaim stale entries.
      * Inserts at head of hash bucket chain (maintains task_id ordering).
      *
      * @param tensor            Tensor produced
      * @param producer_task_id  Task ID of producer
+     * @param info              Optional precomputed hash/segment metadata
+     *                          (from the intern table); nullptr derives it
      */
-    void insert(const Tensor &tensor, PTO2TaskId producer_task_id) {
-        PTO2TensorMapEntry *entry = new_entry();
+    void insert(const Tensor &tensor, PTO2TaskId producer_task_id, const PTO2TensorHashInfo *info = nullptr) {
+        PTO2TensorMapShard &shard = shards[info ? info->shard : shard_of(tensor.buffer.addr)];
+        shard.acquire();
+        // Resize work rides the insert path: advance an in-flight migration
+        // by a few buckets, or start a grow once the load factor crosses the
+        // threshold.  Either way the geometry is settled before the info
+        // refresh and the link below, so hints always target the new array.
+        if (shard.old_buckets != nullptr) {
+            migrate_step(shard, PTO2_TENSORMAP_REHASH_BUDGET);
+        } else {
+            maybe_grow_shard(shard);
+        }
+        if (info != nullptr && info->gen != shard.bucket_gen) {
+            refresh_info(shard, *const_cast<PTO2TensorHashInfo *>(info), tensor);
+        }
+        PTO2TensorMapEntry *entry = new_entry(shard);
         entry->copy_from_tensor(tensor);
-        link_entry(entry, tensor.buffer.addr, producer_task_id);
+        link_entry(
+            shard, entry, tensor.buffer.addr, producer_task_id, info ? static_cast<int32_t>(info->entry_bucket) : -1
+        );
+        shard.release();
     }
 
     /**
-     * Cleanup stale entries for retired tasks
-     *
-     * Called periodically by Orchestrator when last_task_alive advances.
-     * Removes entries from bucket chains for tasks in [old, new) range.
+     * Epoch sweep: walk up to `budget` bucket chains of a shard (resuming at
+     * the shard's cursor) and free every entry whose producer has retired.
+     * Caller must hold the shard lock.
      *
-     * @param old_last_task_alive  Previous threshold
-     * @param new_last_task_alive  New threshold
+     * @param shard   Shard to sweep
+     * @param budget  Number of buckets to visit
      */
-    void cleanup_retired(int32_t ring_id, int32_t old_last_task_alive, int32_t new_last_task_alive) {
-        // Iterate through retired tasks on this ring and remove their entries
-        for (int32_t local_id = old_last_task_alive; local_id < new_last_task_alive; local_id++) {
-            int32_t task_slot = local_id & (task_window_sizes[ring_id] - 1);
-            PTO2TensorMapEntry *cur_entry = task_entry_heads[ring_id][task_slot];
+    void sweep_shard(PTO2TensorMapShard &shard, int32_t budget) {
+        for (int32_t n = 0; n < budget; n++) {
+            PTO2TensorMapEntry *cur_entry = shard.buckets[shard.sweep_cursor];
+            while (cur_entry != nullptr) {
+                PTO2TensorMapEntry *next_entry = cur_entry->next_in_bucket;  // Save before unlinking
+                if (!entry_valid(*cur_entry)) {
+                    free_entry(shard, *cur_entry);
+                }
+                cur_entry = next_entry;
+            }
+            shard.sweep_cursor = (shard.sweep_cursor + 1) & (shard.num_buckets - 1);
+        }
+    }
 
+    // =============================================================================
+    // Adaptive Resizing (incremental rehash)
+    // =============================================================================
+
+    /**
+     * Double the shard's bucket array once live entries exceed the load
+     * threshold.  The old array stays in place and drains through
+     * migrate_step; growth caps at the pool size and is best-effort — an
+     * allocation failure just keeps the current geometry.  Caller must hold
+     * the shard lock and must not be mid-migration.
+     */
+    void maybe_grow_shard(PTO2TensorMapShard &shard) {
+        if (shard.num_buckets >= shard.pool_size ||
+            shard.live_entries <= shard.num_buckets * PTO2_TENSORMAP_MAX_LOAD) {
+            return;
+        }
+        int32_t new_count = shard.num_buckets * 2;
+        PTO2TensorMapEntry **grown = (PTO2TensorMapEntry **)calloc(new_count, sizeof(PTO2TensorMapEntry *));
+        if (grown == nullptr) {
+            return;
+        }
+        shard.old_buckets = shard.buckets;
+        shard.buckets = grown;
+        shard.num_buckets = new_count;
+        shard.rehash_cursor = 0;
+        shard.sweep_cursor = 0;
+        shard.bucket_gen++;
+    }
+
+    /**
+     * Migrate up to `budget` old buckets of a growing shard into the new
+     * array, reclaiming stale entries on the way instead of relinking them.
+     * Frees the old array when the last bucket drains.  Caller must hold the
+     * shard lock.
+     */
+    void migrate_step(PTO2TensorMapShard &shard, int32_t budget) {
+        int32_t old_count = shard.num_buckets >> 1;
+        while (shard.old_buckets != nullptr && budget-- > 0) {
+            PTO2TensorMapEntry *cur_entry = shard.old_buckets[shard.rehash_cursor];
+            shard.old_buckets[shard.rehash_cursor] = nullptr;
             while (cur_entry != nullptr) {
-                PTO2TensorMapEntry *next_entry = cur_entry->next_in_task;  // Save before clearing
-                // Only remove if this entry belongs to the retiring task
-                // (slot may have been reused by a newer task)
-                debug_assert(
-                    cur_entry->producer_task_id ==
-                    PTO2TaskId::make(static_cast<uint8_t>(ring_id), static_cast<uint32_t>(local_id))
-                );
-                free_entry(*cur_entry);
+                PTO2TensorMapEntry *next_entry = cur_entry->next_in_bucket;
+                if (!entry_valid(*cur_entry)) {
+                    shard.free_entry_list[shard.free_num++] = cur_entry;
+                    cur_entry->bucket_index = -1;
+                    cur_entry->next_in_bucket = nullptr;
+                    cur_entry->prev_in_bucket = nullptr;
+                    shard.live_entries--;
+                } else {
+                    link_entry_tail(
+                        shard, cur_entry, bucket_for_entry(cur_entry, cur_entry->buffer_addr, shard.num_buckets)
+                    );
+                }
                 cur_entry = next_entry;
             }
+            if (++shard.rehash_cursor >= old_count) {
+                free(shard.old_buckets);
+                shard.old_buckets = nullptr;
+            }
+        }
+    }
 
-            // Clear task's entry head (slot will be reused by local_id + task_window_sizes[ring_id])
-            task_entry_heads[ring_id][task_slot] = nullptr;
+    /**
+     * Relink a migrated entry at the TAIL of its new chain, keeping chains
+     * newest-first: everything inserted since the grow is newer than any
+     * migrated entry, and the old chain itself is walked newest-first.
+     * Migrated chains are short (they were built under the old geometry's
+     * load), so the tail walk is cheap and only paid during a grow.
+     */
+    void link_entry_tail(PTO2TensorMapShard &shard, PTO2TensorMapEntry *entry, uint32_t bucket_index) {
+        entry->bucket_index = static_cast<int32_t>(bucket_index);
+        entry->link_gen = static_cast<uint8_t>(shard.bucket_gen);
+        entry->next_in_bucket = nullptr;
+        PTO2TensorMapEntry *tail = shard.buckets[bucket_index];
+        if (tail == nullptr) {
+            shard.buckets[bucket_index] = entry;
+            entry->prev_in_bucket = nullptr;
+            return;
         }
+        while (tail->next_in_bucket != nullptr) {
+            tail = tail->next_in_bucket;
+        }
+        tail->next_in_bucket = entry;
+        entry->prev_in_bucket = tail;
+    }
+
+    /**
+     * (Re)derive the geometry-dependent fields of an interned hash info
+     * against the shard's current bucket array.  Caller must hold the shard
+     * lock: that makes the in-place update single-writer, and every reader
+     * of base_bucket/entry_bucket holds the same lock.  The segment range is
+     * geometry-independent and never recomputed.
+     */
+    void refresh_info(const PTO2TensorMapShard &shard, PTO2TensorHashInfo &info, const Tensor &tensor) const {
+        info.base_bucket = hash(tensor.buffer.addr, shard.num_buckets);
+        info.entry_bucket = (info.has_segment && info.seg_lo == info.seg_hi)
+                                ? hash_segment(tensor.buffer.addr, info.seg_lo, shard.num_buckets)
+                                : info.base_bucket;
+        info.gen = shard.bucket_gen;
     }
 
     // =============================================================================
@@ -412,79 +895,98 @@ struct PTO2TensorMap {
      * addresses (low bits all-zero) still distribute evenly.  We extract
      * the top log2(num_buckets) bits which carry the most entropy.
      */
-    uint32_t hash(uint64_t key) {
+    static uint32_t hash(uint64_t key, int32_t nbuckets) {
         key *= 0x9E3779B97F4A7C15ULL;
-        return static_cast<uint32_t>(key >> (64 - __builtin_ctz(num_buckets)));
+        return static_cast<uint32_t>(key >> (64 - __builtin_ctz(nbuckets)));
     }
 
     /**
-     * Link an initialized entry into bucket and task chains.
+     * Second-level hash: mix the dim-0 segment index into the base address
+     * so each (base, segment) pair gets its own bucket chain.
      */
-    void link_entry(PTO2TensorMapEntry *entry, uint64_t addr, PTO2TaskId producer_task_id) {
+    static uint32_t hash_segment(uint64_t addr, uint32_t segment, int32_t nbuckets) {
+        return hash(addr ^ ((static_cast<uint64_t>(segment) + 1) * 0xC2B2AE3D27D4EB4FULL), nbuckets);
+    }
+
+    /**
+     * Compute the dim-0 segment range [seg_lo, seg_hi] covered by a region.
+     * Returns false when the region has no usable dim-0 range (the caller
+     * must then use the base bucket).  offsets may be null (all-zero).
+     */
+    static bool segment_range(
+        uint32_t ndims, const uint32_t *offsets, const uint32_t *shapes, uint32_t &seg_lo, uint32_t &seg_hi
+    ) {
+        if (ndims == 0 || shapes[0] == 0) {
+            return false;
+        }
+        uint32_t begin = offsets ? offsets[0] : 0;
+        seg_lo = begin >> PTO2_TENSORMAP_SEGMENT_SHIFT;
+        seg_hi = (begin + shapes[0] - 1) >> PTO2_TENSORMAP_SEGMENT_SHIFT;
+        return true;
+    }
+
+    /**
+     * Choose the bucket for an initialized entry: segment bucket when the
+     * entry's dim-0 range fits inside one segment, base bucket otherwise.
+     */
+    static uint32_t bucket_for_entry(const PTO2TensorMapEntry *entry, uint64_t addr, int32_t nbuckets) {
+        uint32_t seg_lo, seg_hi;
+        if (segment_range(entry->ndims, entry->is_all_offset_zero ? nullptr : entry->offsets, entry->shapes, seg_lo,
+                          seg_hi) &&
+            seg_lo == seg_hi) {
+            return hash_segment(addr, seg_lo, nbuckets);
+        }
+        return hash(addr, nbuckets);
+    }
+
+    /**
+     * Link an initialized entry into its shard's bucket chain.
+     * Caller must hold the shard lock.
+     *
+     * @param bucket_hint  Precomputed bucket index (>= 0), or -1 to derive
+     *                     it via bucket_for_entry
+     */
+    void link_entry(
+        PTO2TensorMapShard &shard, PTO2TensorMapEntry *entry, uint64_t addr, PTO2TaskId producer_task_id,
+        int32_t bucket_hint = -1
+    ) {
 #if PTO2_TENSORMAP_PROFILING
         g_insert_count++;
 #endif
-        uint32_t bucket_index = hash(addr);
-        auto ring_id = producer_task_id.ring();
-        auto local_id = producer_task_id.local();
-        int32_t task_slot = local_id & (task_window_sizes[ring_id] - 1);
+        uint32_t bucket_index = bucket_hint >= 0 ? static_cast<uint32_t>(bucket_hint)
+                                                 : bucket_for_entry(entry, addr, shard.num_buckets);
 
         entry->producer_task_id = producer_task_id;
 
         // Insert at head of hash bucket
         entry->bucket_index = bucket_index;
-        entry->next_in_bucket = buckets[bucket_index];
+        entry->link_gen = static_cast<uint8_t>(shard.bucket_gen);
+        entry->next_in_bucket = shard.buckets[bucket_index];
         if (entry->next_in_bucket != nullptr) {
             entry->next_in_bucket->prev_in_bucket = entry;
         }
-        buckets[bucket_index] = entry;
+        shard.buckets[bucket_index] = entry;
         entry->prev_in_bucket = nullptr;
-
-        // Link to task's entry list
-        entry->next_in_task = task_entry_heads[ring_id][task_slot];
-        entry->prev_in_task = nullptr;
-        if (entry->next_in_task != nullptr) {
-            entry->next_in_task->prev_in_task = entry;
-        }
-        task_entry_heads[ring_id][task_slot] = entry;
+        shard.live_entries++;
     }
 
     /**
      * Check if entry is valid (producer has not retired)
      */
     bool entry_valid(const PTO2TensorMapEntry &entry) const {
-        return static_cast<int32_t>(entry.producer_task_id.local()) >= last_task_alives[entry.producer_task_id.ring()];
-    }
-
-    void remove_entry(PTO2TensorMapEntry &entry) {
-        remove_from_task(entry);
-        free_entry(entry);
+        return static_cast<int32_t>(entry.producer_task_id.local()) >=
+               last_task_alives[entry.producer_task_id.ring()].load(std::memory_order_relaxed);
     }
 
     /**
-     * Remove entry from its task chain (O(1) with prev pointer)
-     * Called during pool wrap-around to unlink reused entries.
+     * Remove an entry immediately (e.g. a covered producer superseded by a
+     * newer write).  Locks the entry's shard, derived from its address.
      */
-    void remove_from_task(PTO2TensorMapEntry &entry) {
-        always_assert(entry.bucket_index != -1);  // must still be in a bucket
-        // Update predecessor's next pointer (O(1) via prev_in_task)
-        if (entry.prev_in_task == nullptr) {
-            // Entry is the head of its task chain, update task_entry_heads
-            int32_t ring_id = entry.producer_task_id.ring();
-            int32_t local_id = static_cast<int32_t>(entry.producer_task_id.local());
-            int32_t task_slot = local_id & (task_window_sizes[ring_id] - 1);
-            task_entry_heads[ring_id][task_slot] = entry.next_in_task;
-        } else {
-            entry.prev_in_task->next_in_task = entry.next_in_task;
-        }
-
-        // Update successor's prev pointer
-        if (entry.next_in_task != nullptr) {
-            entry.next_in_task->prev_in_task = entry.prev_in_task;
-        }
-
-        entry.next_in_task = nullptr;
-        entry.prev_in_task = nullptr;
+    void remove_entry(PTO2TensorMapEntry &entry) {
+        PTO2TensorMapShard &shard = shards[shard_of(entry.buffer_addr)];
+        shard.acquire();
+        free_entry(shard, entry);
+        shard.release();
     }
 
     // =============================================================================
@@ -509,11 +1011,114 @@ struct PTO2TensorMap {
      * Sync TensorMap validity threshold from shared memory
      *
      * Called periodically to refresh the lazy invalidation threshold.
-     * Also triggers cleanup if threshold has advanced significantly.
+     * Also triggers an incremental epoch sweep when the threshold has
+     * advanced significantly.
      */
     void sync_tensormap(PTO2TaskId task_id, int32_t sm_last_task_alive);
 };
 
+// =============================================================================
+// Tensor Intern Table
+// =============================================================================
+
+/**
+ * Registry of interned tensor views for handle-based submission.
+ *
+ * Orchestrations typically reuse the same few hundred tensor views across
+ * thousands of submits.  Registering a view once stores a stable Tensor copy
+ * together with its precomputed PTO2TensorHashInfo, so every subsequent
+ * TensorMap lookup/insert of that view skips shard/bucket/segment derivation
+ * and starts straight at the chain scan.
+ *
+ * Handles are small array indices; interned Tensors have stable addresses,
+ * so Arg slots can reference them directly and the submit path recovers the
+ * handle with a pointer-range check (info_of).  Allocated lazily by the
+ * orchestrator on first registration.
+ */
+struct PTO2TensorInternTable {
+    Tensor views[PTO2_TENSOR_INTERN_CAP];             // Stable Tensor copies, indexed by handle
+    PTO2TensorHashInfo infos[PTO2_TENSOR_INTERN_CAP];  // Precomputed hash/segment metadata
+    int32_t count;
+
+    /**
+     * Register a view and precompute its geometry-independent metadata.
+     *
+     * Shard selection and the dim-0 segment range never change; the bucket
+     * indices depend on the shard's (resizable) bucket array, so they are
+     * derived lazily — gen 0 never matches a live shard generation, and the
+     * first lookup/insert under the shard lock fills base/entry_bucket via
+     * PTO2TensorMap::refresh_info.  The intern path therefore never has to
+     * synchronize with a concurrent shard grow.
+     *
+     * @param tensor  View to intern (copied; the original need not outlive it)
+     * @return Handle (>= 0), or -1 when the table is full
+     */
+    int32_t intern(const Tensor &tensor) {
+        if (count >= PTO2_TENSOR_INTERN_CAP) {
+            return -1;
+        }
+        int32_t handle = count++;
+        views[handle].init(tensor);
+        PTO2TensorHashInfo &info = infos[handle];
+        info.shard = PTO2TensorMap::shard_of(tensor.buffer.addr);
+        info.has_segment = PTO2TensorMap::segment_range(
+            tensor.ndims, tensor.is_all_offset_zero ? nullptr : tensor.offsets, tensor.shapes, info.seg_lo, info.seg_hi
+        );
+        if (!info.has_segment) {
+            info.seg_lo = info.seg_hi = 0;
+        }
+        info.base_bucket = 0;
+        info.entry_bucket = 0;
+        info.gen = 0;
+        return handle;
+    }
+
+    /**
+     * Bump the version of a registered view, starting a new write
+     * generation for just that slice.
+     *
+     * In-place update chains (optimizer steps, KV-cache append) register
+     * one view per independently-written slice and bump only the slice
+     * they are about to overwrite. Each view then carries its own version
+     * stream — a version vector over the base tensor — so writers of
+     * disjoint slices never serialize behind one base-pointer version
+     * chain, while readers of the bumped slice still order behind its
+     * latest writer. Hash/segment metadata is version-independent, so the
+     * precomputed info stays valid across bumps.
+     *
+     * @return New version (> 0), or -1 when the handle is invalid
+     */
+    int32_t bump_version(int32_t handle) {
+        if (handle < 0 || handle >= count) {
+            return -1;
+        }
+        return ++views[handle].version;
+    }
+
+    /// Interned view for a handle, or nullptr when the handle is invalid.
+    const Tensor *view_of(int32_t handle) const {
+        if (handle < 0 || handle >= count) {
+            return nullptr;
+        }
+        return &views[handle];
+    }
+
+    /**
+     * Recover the precomputed metadata for a tensor that lives inside this
+     * table (i.e. was obtained from view_of).  Returns nullptr for any other
+     * tensor, in which case the caller derives the metadata as usual.
+     */
+    const PTO2TensorHashInfo *info_of(const Tensor *tensor) const {
+        uintptr_t p = reinterpret_cast<uintptr_t>(tensor);
+        uintptr_t lo = reinterpret_cast<uintptr_t>(&views[0]);
+        uintptr_t hi = reinterpret_cast<uintptr_t>(&views[count]);
+        if (p < lo || p >= hi) {
+            return nullptr;
+        }
+        return &infos[(p - lo) / sizeof(Tensor)];
+    }
+};
+
 #if PTO2_TENSORMAP_PROFILING
 struct PTO2TensorMapProfilingData {
     uint64_t lookup_chain_total;
@@ -32,6 +32,7 @@
 #include <arm_neon.h>
 #endif
 
+#include "pto_runtime_status.h"
 #include "pto_submit_types.h"
 #include "task_args.h"
 #include "tensor.h"
@@ -44,6 +45,30 @@
 #define PTO2_MAX_INPUTS 16   // Maximum inputs per task
 #define PTO2_MAX_INOUTS 8    // Maximum in-out args per task
 
+// =============================================================================
+// Runtime Tuning Parameters
+// =============================================================================
+
+/**
+ * Spin/notify tuning knobs, settable per run without rebuilding the runtime.
+ *
+ * Each field overrides one of the compile-time spin-wait macros in
+ * pto_ring_buffer.h; a zero field keeps the compile-time default, the same
+ * convention the PTO2_RING_* size overrides use. The host fills this block
+ * from PTO2_TUNE_* environment variables (see runtime_maker.cpp) and the
+ * AICPU launcher copies it into the shared-memory header before the
+ * orchestrator and scheduler initialize, so parameter sweeps run back to
+ * back without a --build cycle.
+ */
+struct PTO2RuntimeParams {
+    uint32_t block_notify_interval;  // PTO2_BLOCK_NOTIFY_INTERVAL
+    uint32_t alloc_spin_limit;       // PTO2_ALLOC_SPIN_LIMIT
+    uint32_t alloc_tight_spin;       // PTO2_ALLOC_TIGHT_SPIN
+    uint32_t alloc_backoff_max;      // PTO2_ALLOC_BACKOFF_MAX
+    uint32_t alloc_spill_spin;       // PTO2_ALLOC_SPILL_SPIN
+    uint32_t dep_pool_spin_limit;    // PTO2_DEP_POOL_SPIN_LIMIT
+};
+
 // =============================================================================
 // Task Output Tensors (return value from submit)
 // =============================================================================
@@ -86,6 +111,25 @@ private:
     const Tensor *tensors_[PTO2_MAX_OUTPUTS];
 };
 
+// =============================================================================
+// Batch Submission (for pto2_rt_submit_task_batch API)
+// =============================================================================
+
+struct Arg;  // forward declare (defined below)
+
+/**
+ * One task of a batched submission.
+ *
+ * `args` must outlive the batch call.  `outputs` is optional: when non-null,
+ * the materialized output tensors for this task are stored there (same
+ * contract as the return value of pto2_rt_submit_task).
+ */
+struct PTO2TaskBatchEntry {
+    MixedKernels mixed_kernels;
+    const Arg *args{nullptr};
+    TaskOutputTensors *outputs{nullptr};
+};
+
 // =============================================================================
 // Argument Types (for pto_submit_task API)
 // =============================================================================
@@ -129,12 +173,14 @@ union TensorRef {
 struct Arg : TaskArgsTpl<TensorRef, uint64_t, MAX_TENSOR_ARGS, MAX_SCALAR_ARGS, TensorArgType> {
     bool has_error{false};
     const char *error_msg{nullptr};
+    int32_t error_detail{0};     // optional detail-arena handle (see pto_runtime_status.h)
     PTO2LaunchSpec launch_spec;  // SPMD launch parameters (block_num, etc.)
 
     void reset() {
         clear();
         has_error = false;
         error_msg = nullptr;
+        error_detail = 0;
     }
 
     void set_error(const char *msg) {
@@ -144,6 +190,17 @@ struct Arg : TaskArgsTpl<TensorRef, uint64_t, MAX_TENSOR_ARGS, MAX_SCALAR_ARGS,
         }
     }
 
+    // Latch a detail record alongside the static message: raw operands only,
+    // no formatting — the reporter materializes the full text on the cold
+    // path via pto2_status_detail_format().
+    void set_error(const char *msg, int32_t detail) {
+        if (!has_error) {
+            has_error = true;
+            error_msg = msg;
+            error_detail = detail;
+        }
+    }
+
     template <typename... Args>
     void add_input(Args &&...args) {
         if (!check_add_tensor_valid<false>(args...)) {
@@ -196,7 +253,13 @@ struct Arg : TaskArgsTpl<TensorRef, uint64_t, MAX_TENSOR_ARGS, MAX_SCALAR_ARGS,
         static_assert(sizeof...(Args) >= 1, "add_scalar: at least one argument required");
         static_assert((is_supported_scalar_arg_v<Args> && ...), "add_scalar: all types must be arithmetic or enum");
         if (scalar_count_ + sizeof...(Args) > MAX_SCALAR_ARGS) {
-            set_error("Too many scalar args (exceeds MAX_SCALAR_ARGS=128)");
+            set_error(
+                "Too many scalar args (exceeds MAX_SCALAR_ARGS=128)",
+                pto2_status_detail_latch(
+                    "Arg::add_scalar", "adding %lld scalars at count %lld exceeds MAX_SCALAR_ARGS=%lld",
+                    static_cast<int64_t>(sizeof...(Args)), scalar_count_, MAX_SCALAR_ARGS
+                )
+            );
             return;
         }
         ((scalars_[scalar_count_++] = to_u64(args)), ...);
@@ -204,7 +267,13 @@ struct Arg : TaskArgsTpl<TensorRef, uint64_t, MAX_TENSOR_ARGS, MAX_SCALAR_ARGS,
 
     void add_scalars(const uint64_t *values, int count) {
         if (scalar_count_ + count > MAX_SCALAR_ARGS) {
-            set_error("Too many scalar args (exceeds MAX_SCALAR_ARGS=128)");
+            set_error(
+                "Too many scalar args (exceeds MAX_SCALAR_ARGS=128)",
+                pto2_status_detail_latch(
+                    "Arg::add_scalars", "adding %lld scalars at count %lld exceeds MAX_SCALAR_ARGS=%lld", count,
+                    scalar_count_, MAX_SCALAR_ARGS
+                )
+            );
             return;
         }
         memcpy(&scalars_[scalar_count_], values, count * sizeof(uint64_t));
@@ -219,7 +288,13 @@ struct Arg : TaskArgsTpl<TensorRef, uint64_t, MAX_TENSOR_ARGS, MAX_SCALAR_ARGS,
      */
     void add_scalars_i32(const int32_t *values, int count) {
         if (scalar_count_ + count > MAX_SCALAR_ARGS) {
-            set_error("Too many scalar args (exceeds MAX_SCALAR_ARGS=128)");
+            set_error(
+                "Too many scalar args (exceeds MAX_SCALAR_ARGS=128)",
+                pto2_status_detail_latch(
+                    "Arg::add_scalars_i32", "adding %lld scalars at count %lld exceeds MAX_SCALAR_ARGS=%lld", count,
+                    scalar_count_, MAX_SCALAR_ARGS
+                )
+            );
             return;
         }
         uint64_t *dst = &scalars_[scalar_count_];
@@ -249,11 +324,23 @@ struct Arg : TaskArgsTpl<TensorRef, uint64_t, MAX_TENSOR_ARGS, MAX_SCALAR_ARGS,
      */
     void copy_scalars_from(const Arg &src, int src_offset, int count) {
         if (src_offset + count > src.scalar_count_) {
-            set_error("Source scalar range out of bounds in copy_scalars_from");
+            set_error(
+                "Source scalar range out of bounds in copy_scalars_from",
+                pto2_status_detail_latch(
+                    "Arg::copy_scalars_from", "range [%lld, +%lld) outside source scalar count %lld", src_offset,
+                    count, src.scalar_count_
+                )
+            );
             return;
         }
         if (scalar_count_ + count > MAX_SCALAR_ARGS) {
-            set_error("Too many scalar args (exceeds MAX_SCALAR_ARGS=128)");
+            set_error(
+                "Too many scalar args (exceeds MAX_SCALAR_ARGS=128)",
+                pto2_status_detail_latch(
+                    "Arg::copy_scalars_from", "adding %lld scalars at count %lld exceeds MAX_SCALAR_ARGS=%lld", count,
+                    scalar_count_, MAX_SCALAR_ARGS
+                )
+            );
             return;
         }
         memcpy(&scalars_[scalar_count_], &src.scalars_[src_offset], count * sizeof(uint64_t));
@@ -285,7 +372,13 @@ private:
             return false;
         }
         if (tensor_count_ + sizeof...(Args) > MAX_TENSOR_ARGS) {
-            set_error("Too many tensor args (exceeds MAX_TENSOR_ARGS=16)");
+            set_error(
+                "Too many tensor args (exceeds MAX_TENSOR_ARGS=16)",
+                pto2_status_detail_latch(
+                    "Arg::add_tensor", "adding %lld tensors at count %lld exceeds MAX_TENSOR_ARGS=%lld",
+                    static_cast<int64_t>(sizeof...(Args)), tensor_count_, MAX_TENSOR_ARGS
+                )
+            );
             return false;
         }
         return true;
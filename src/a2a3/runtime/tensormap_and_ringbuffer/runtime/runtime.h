@@ -95,6 +95,9 @@ constexpr int RUNTIME_DEFAULT_READY_QUEUE_SHARDS = PLATFORM_MAX_AICPU_THREADS -
  * - control: Written by AICPU, read by AICore (0 = continue, 1 = quit)
  * - core_type: Written by AICPU, read by AICore (CoreType::AIC or CoreType::AIV)
  * - enable_profiling_flag: Written by host/AICPU init, read by AICore (bitmask)
+ * - cond_doorbell: Written by AICore (carries every COND value: ACK, FIN,
+ *   idle, exited), read by AICPU as the authoritative completion publication;
+ *   the COND register is only read on the exit path and for diagnostics
  */
 struct Handshake {
     volatile uint32_t aicpu_ready;            // AICPU ready signal: 0=not ready, 1=ready
@@ -109,6 +112,10 @@ struct Handshake {
     volatile uint32_t aicpu_regs_ready;       // AICPU register init done: 0=pending, 1=done
     volatile uint32_t aicore_regs_ready;      // AICore ID reported: 0=pending, 1=done
     volatile uint32_t enable_profiling_flag;  // Generic profiling-related flags; bit0=dump tensor
+    // Second cache line: completion doorbell, polled every scheduler iteration.
+    // Kept apart from the init-time fields above so doorbell flushes never
+    // contend with anything else.
+    volatile uint64_t cond_doorbell;  // Last COND value published by the AICore; drives the completion scan
 } __attribute__((aligned(64)));
 
 /**
@@ -130,6 +137,10 @@ struct HostApi {
     void (*device_free)(void *dev_ptr);
     int (*copy_to_device)(void *dev_ptr, const void *host_ptr, size_t size);
     int (*copy_from_device)(void *host_ptr, const void *dev_ptr, size_t size);
+    // Asynchronous upload: the copy is queued and may complete any time before
+    // the next copy_sync() returns; the host buffer must stay valid until then.
+    int (*copy_to_device_async)(void *dev_ptr, const void *host_ptr, size_t size);
+    int (*copy_sync)(void);
     uint64_t (*upload_kernel_binary)(int func_id, const uint8_t *bin_data, size_t bin_size);
     void (*remove_kernel_binary)(int func_id);
 };
@@ -172,6 +183,10 @@ public:
     uint64_t pto2_heap_size;
     uint64_t pto2_dep_pool_size;
 
+    // Spin/notify tuning overrides copied into the PTO2 shared-memory header
+    // at launch (zero fields = compile-time defaults, see PTO2RuntimeParams)
+    PTO2RuntimeParams pto2_params;
+
     // PTO2 integration: kernel_id -> GM function_bin_addr mapping
     // NOTE: Made public for direct access from aicore code
     uint64_t func_id_to_addr_[RUNTIME_MAX_FUNC_ID];
@@ -458,6 +458,8 @@ private:
 
     // Friends that need to construct Tensors
     friend struct PTO2TaskPayload;
+    friend struct PTO2TensorInternTable;
+    friend struct PTO2SubmitTraceReplayer;
     friend inline Tensor make_tensor_external(
         void *addr, const uint32_t shapes[], uint32_t ndims, DataType dtype, bool manual_dep, int32_t version
     );
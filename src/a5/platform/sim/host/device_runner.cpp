@@ -397,15 +397,18 @@ int DeviceRunner::run(
         }));
     }
 
-    // Launch AICore threads
-    LOG_INFO("Launching %d AICore thread(s)", num_aicore);
-    std::vector<std::thread> aicore_threads;
+    // Dispatch AICore execution onto the persistent per-device core pool.
+    // One pool thread per simulated core, reused across runs, so back-to-back
+    // runs skip thread creation and the shared-memory handshake runs with the
+    // same per-core concurrency as onboard.
+    LOG_INFO("Dispatching %d AICore job(s) onto the sim core pool", num_aicore);
+    sim_core_pool_resize(device_id_, num_aicore);
     for (int i = 0; i < num_aicore; i++) {
         CoreType core_type = runtime.workers[i].core_type;
         uint32_t physical_core_id = static_cast<uint32_t>(i);
-        aicore_threads.push_back(create_thread([this, &runtime, i, core_type, physical_core_id]() {
+        sim_core_pool_dispatch(device_id_, i, [this, &runtime, i, core_type, physical_core_id]() {
             aicore_execute_func_(&runtime, i, core_type, physical_core_id, kernel_args_.regs);
-        }));
+        });
     }
 
     // Wait for all threads to complete
@@ -413,9 +416,7 @@ int DeviceRunner::run(
     for (auto &t : aicpu_threads) {
         t.join();
     }
-    for (auto &t : aicore_threads) {
-        t.join();
-    }
+    sim_core_pool_wait_idle(device_id_);
 
     LOG_INFO("All threads completed");
 
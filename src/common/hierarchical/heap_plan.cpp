@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "heap_plan.h"
+
+#include <algorithm>
+
+void HeapPlanner::reset() {
+    nodes_.clear();
+    index_of_.clear();
+    span_count_ = 0;
+}
+
+int32_t HeapPlanner::node_index(TaskSlot slot) {
+    auto it = index_of_.find(slot);
+    if (it != index_of_.end()) return it->second;
+    int32_t idx = static_cast<int32_t>(nodes_.size());
+    nodes_.emplace_back();
+    nodes_.back().slot = slot;
+    index_of_.emplace(slot, idx);
+    return idx;
+}
+
+void HeapPlanner::record_task(TaskSlot slot, const std::vector<TaskSlot> &producers) {
+    int32_t idx = node_index(slot);
+    for (TaskSlot p : producers) {
+        auto it = index_of_.find(p);
+        if (it == index_of_.end()) continue;  // outside the capture (user buffer / pre-capture task)
+        if (it->second == idx) continue;
+        nodes_[idx].producers.push_back(it->second);
+        nodes_[it->second].consumers.push_back(idx);
+    }
+}
+
+void HeapPlanner::record_alloc(TaskSlot slot, uint64_t aligned_bytes) {
+    if (aligned_bytes == 0) return;
+    Node &n = nodes_[node_index(slot)];
+    if (n.bytes == 0) span_count_++;
+    n.bytes = aligned_bytes;
+}
+
+HeapPlan HeapPlanner::plan() const {
+    HeapPlan out;
+    size_t n = nodes_.size();
+    if (n == 0) return out;
+
+    // Ancestor bitsets over the captured DAG, built in one pass — capture
+    // order is slot-id order, so every producer index precedes its consumer.
+    size_t words = (n + 63) / 64;
+    std::vector<uint64_t> anc(n * words, 0);
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t *ai = anc.data() + i * words;
+        for (int32_t p : nodes_[i].producers) {
+            const uint64_t *ap = anc.data() + static_cast<size_t>(p) * words;
+            for (size_t w = 0; w < words; ++w)
+                ai[w] |= ap[w];
+            ai[static_cast<size_t>(p) / 64] |= 1ULL << (static_cast<size_t>(p) % 64);
+        }
+    }
+    auto reaches = [&](size_t from, size_t to) {
+        // true iff `from` is an ancestor of `to` (to's execution is ordered
+        // strictly after from's completion by the DAG).
+        return (anc[to * words + from / 64] >> (from % 64)) & 1ULL;
+    };
+
+    // A placed span j is dead before node i starts iff j itself and every
+    // reader of j's outputs are ancestors of i; otherwise the two lifetimes
+    // may overlap under some worker timing and the spans must not share
+    // bytes, whatever the capture's wall-clock schedule happened to be.
+    auto lifetimes_disjoint = [&](size_t j, size_t i) {
+        if (!reaches(j, i)) return false;
+        for (int32_t c : nodes_[j].consumers) {
+            // c == i: node i itself reads span j while writing its own
+            // output, so j is live during i's execution — never overlap.
+            if (static_cast<size_t>(c) == i || !reaches(static_cast<size_t>(c), i)) return false;
+        }
+        return true;
+    };
+
+    // Greedy lowest-gap packing in capture order: each span takes the lowest
+    // offset that clears every conflicting (possibly-overlapping-lifetime)
+    // span placed before it. O(spans^2 log) — offline planning cost only.
+    struct Placed {
+        size_t node;
+        uint64_t offset;
+        uint64_t bytes;
+    };
+    std::vector<Placed> placed;
+    std::vector<Placed> conflicts;
+    out.spans.reserve(static_cast<size_t>(span_count_));
+
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t bytes = nodes_[i].bytes;
+        if (bytes == 0) continue;
+        out.sum_bytes += bytes;
+
+        conflicts.clear();
+        for (const Placed &p : placed) {
+            if (!lifetimes_disjoint(p.node, i)) conflicts.push_back(p);
+        }
+        std::sort(conflicts.begin(), conflicts.end(), [](const Placed &a, const Placed &b) {
+            return a.offset < b.offset;
+        });
+
+        uint64_t offset = 0;
+        for (const Placed &c : conflicts) {
+            if (c.offset >= offset + bytes) break;  // gap before c fits
+            if (c.offset + c.bytes > offset) offset = c.offset + c.bytes;
+        }
+
+        placed.push_back({i, offset, bytes});
+        out.spans.push_back({offset, bytes});
+        if (offset + bytes > out.required_bytes) out.required_bytes = offset + bytes;
+    }
+    return out;
+}
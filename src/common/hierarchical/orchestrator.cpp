@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
+#include <type_traits>
 
 #include "worker_manager.h"
 
@@ -30,6 +31,11 @@ void Orchestrator::init(
     active_tasks_.store(0, std::memory_order_relaxed);
 }
 
+void Orchestrator::init_direct_dispatch() {
+    direct_next_level_ = manager_ ? manager_->single_worker(WorkerType::NEXT_LEVEL) : nullptr;
+    direct_sub_ = manager_ ? manager_->single_worker(WorkerType::SUB) : nullptr;
+}
+
 uint64_t Orchestrator::malloc(int worker_id, size_t size) {
     auto *wt = manager_->get_worker(WorkerType::NEXT_LEVEL, worker_id);
     if (!wt) throw std::runtime_error("Orchestrator::malloc: invalid worker_id");
@@ -54,6 +60,164 @@ void Orchestrator::copy_from(int worker_id, uint64_t dst, uint64_t src, size_t s
     wt->control_copy_from(dst, src, size);
 }
 
+void Orchestrator::copy_between(int dst_worker_id, uint64_t dst, int src_worker_id, uint64_t src, size_t size) {
+    do_copy_between(dst_worker_id, dst, src_worker_id, src, size);
+}
+
+void Orchestrator::do_copy_between(int dst_worker_id, uint64_t dst, int src_worker_id, uint64_t src, size_t size) {
+    auto *dst_wt = manager_->get_worker(WorkerType::NEXT_LEVEL, dst_worker_id);
+    if (!dst_wt) throw std::runtime_error("Orchestrator::copy_between: invalid dst worker_id");
+    auto *src_wt = manager_->get_worker(WorkerType::NEXT_LEVEL, src_worker_id);
+    if (!src_wt) throw std::runtime_error("Orchestrator::copy_between: invalid src worker_id");
+    if (size == 0) return;
+
+    // Direct path: issued through the destination worker, whose context
+    // pulls from the peer device.
+    if (dst_wt->control_copy_between(dst, src, size)) {
+        std::lock_guard<std::mutex> lk(transfer_stats_mu_);
+        transfer_stats_.d2d_transfers++;
+        transfer_stats_.d2d_bytes += size;
+        return;
+    }
+
+    // Staged fallback: bounce through a transient host buffer.
+    std::vector<uint8_t> bounce(size);
+    uint64_t host = reinterpret_cast<uint64_t>(bounce.data());
+    src_wt->control_copy_from(host, src, size);
+    dst_wt->control_copy_to(dst, host, size);
+    std::lock_guard<std::mutex> lk(transfer_stats_mu_);
+    transfer_stats_.staged_transfers++;
+    transfer_stats_.staged_bytes += size;
+}
+
+Orchestrator::~Orchestrator() {
+    std::lock_guard<std::mutex> lk(copy_queues_mu_);
+    for (auto &entry : copy_queues_) {
+        WorkerCopyQueue &q = *entry.second;
+        {
+            std::lock_guard<std::mutex> qlk(q.mu);
+            q.stop = true;
+        }
+        q.cv.notify_all();
+        if (q.thr.joinable()) q.thr.join();
+    }
+}
+
+Orchestrator::WorkerCopyQueue &Orchestrator::copy_queue_for(int worker_id) {
+    std::lock_guard<std::mutex> lk(copy_queues_mu_);
+    auto it = copy_queues_.find(worker_id);
+    if (it == copy_queues_.end()) {
+        it = copy_queues_.emplace(worker_id, std::make_unique<WorkerCopyQueue>()).first;
+        WorkerCopyQueue &q = *it->second;
+        q.thr = std::thread([this, worker_id, &q]() { copy_queue_loop(worker_id, q); });
+    }
+    return *it->second;
+}
+
+CopyToken Orchestrator::enqueue_copy(int worker_id, bool to_device, uint64_t dst, uint64_t src, size_t size) {
+    // Validate eagerly so a bad worker_id fails at the call site, not on
+    // the copy thread.
+    auto *wt = manager_->get_worker(WorkerType::NEXT_LEVEL, worker_id);
+    if (!wt) throw std::runtime_error("Orchestrator::copy_async: invalid worker_id");
+    WorkerCopyQueue &q = copy_queue_for(worker_id);
+    CopyToken token;
+    {
+        std::lock_guard<std::mutex> lk(q.mu);
+        token = CopyToken{worker_id, q.next_seq++};
+        q.pending.push_back(CopyRequest{to_device, dst, src, size, token.seq});
+    }
+    q.cv.notify_one();
+    return token;
+}
+
+CopyToken Orchestrator::copy_to_async(int worker_id, uint64_t dst, uint64_t src, size_t size) {
+    return enqueue_copy(worker_id, /*to_device=*/true, dst, src, size);
+}
+
+CopyToken Orchestrator::copy_from_async(int worker_id, uint64_t dst, uint64_t src, size_t size) {
+    return enqueue_copy(worker_id, /*to_device=*/false, dst, src, size);
+}
+
+void Orchestrator::copy_queue_loop(int worker_id, WorkerCopyQueue &q) {
+    for (;;) {
+        CopyRequest req;
+        {
+            std::unique_lock<std::mutex> lk(q.mu);
+            q.cv.wait(lk, [&q] { return q.stop || !q.pending.empty(); });
+            if (q.pending.empty()) {
+                return;  // stop requested and nothing left to transfer
+            }
+            req = q.pending.front();
+            q.pending.pop_front();
+        }
+        try {
+            if (req.transfer_slot != INVALID_SLOT) {
+                slot_state(req.transfer_slot).state.store(TaskState::RUNNING, std::memory_order_release);
+                do_copy_between(worker_id, req.dst, req.src_worker, req.src, req.size);
+            } else if (req.to_device) {
+                copy_to(worker_id, req.dst, req.src, req.size);
+            } else {
+                copy_from(worker_id, req.dst, req.src, req.size);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lk(q.mu);
+            if (!q.error) {
+                q.error = std::current_exception();
+            }
+        }
+        if (req.transfer_slot != INVALID_SLOT && transfer_done_) {
+            // Report even a failed transfer so the DAG (and drain) unblock;
+            // the stored error rethrows from the next wait()/drain().
+            transfer_done_(req.transfer_slot);
+        }
+        {
+            std::lock_guard<std::mutex> lk(q.mu);
+            q.completed_seq = req.seq;
+        }
+        q.done_cv.notify_all();
+    }
+}
+
+void Orchestrator::wait(const CopyToken &token) {
+    if (!token.valid()) return;
+    WorkerCopyQueue *q = nullptr;
+    {
+        std::lock_guard<std::mutex> lk(copy_queues_mu_);
+        auto it = copy_queues_.find(token.worker_id);
+        if (it == copy_queues_.end()) return;
+        q = it->second.get();
+    }
+    std::unique_lock<std::mutex> lk(q->mu);
+    q->done_cv.wait(lk, [q, &token] { return q->completed_seq >= token.seq; });
+    if (q->error) {
+        std::exception_ptr e = q->error;
+        q->error = nullptr;
+        lk.unlock();
+        std::rethrow_exception(e);
+    }
+}
+
+void Orchestrator::wait_all_copies() {
+    std::vector<WorkerCopyQueue *> queues;
+    {
+        std::lock_guard<std::mutex> lk(copy_queues_mu_);
+        queues.reserve(copy_queues_.size());
+        for (auto &entry : copy_queues_) queues.push_back(entry.second.get());
+    }
+    std::exception_ptr first_error;
+    for (WorkerCopyQueue *q : queues) {
+        std::unique_lock<std::mutex> lk(q->mu);
+        q->done_cv.wait(lk, [q] { return q->completed_seq + 1 == q->next_seq; });
+        if (q->error && !first_error) {
+            first_error = q->error;
+            q->error = nullptr;
+        }
+    }
+    if (first_error) {
+        std::rethrow_exception(first_error);
+    }
+}
+
 TaskSlotState &Orchestrator::slot_state(TaskSlot s) {
     TaskSlotState *p = allocator_->slot_state(s);
     if (!p) throw std::runtime_error("Orchestrator::slot_state: invalid slot id");
@@ -140,7 +304,10 @@ SubmitResult
 Orchestrator::submit_next_level(uint64_t callable, const TaskArgs &args, const ChipCallConfig &config, int8_t worker) {
     std::vector<int8_t> affinities;
     if (worker >= 0) affinities = {worker};
-    return submit_impl(WorkerType::NEXT_LEVEL, callable, /*callable_id=*/-1, config, {args}, std::move(affinities));
+    return submit_impl(
+        WorkerType::NEXT_LEVEL, callable, /*callable_id=*/-1, config, std::vector<TaskArgs>{args},
+        std::move(affinities)
+    );
 }
 
 SubmitResult Orchestrator::submit_next_level_group(
@@ -151,20 +318,281 @@ SubmitResult Orchestrator::submit_next_level_group(
 }
 
 SubmitResult Orchestrator::submit_sub(int32_t callable_id, const TaskArgs &args) {
-    return submit_impl(WorkerType::SUB, /*callable_ptr=*/0, callable_id, ChipCallConfig{}, {args});
+    return submit_impl(WorkerType::SUB, /*callable_ptr=*/0, callable_id, ChipCallConfig{}, std::vector<TaskArgs>{args});
 }
 
 SubmitResult Orchestrator::submit_sub_group(int32_t callable_id, const std::vector<TaskArgs> &args_list) {
     return submit_impl(WorkerType::SUB, /*callable_ptr=*/0, callable_id, ChipCallConfig{}, args_list);
 }
 
+SubmitResult
+Orchestrator::submit_next_level(uint64_t callable, const ArenaArgs &args, const ChipCallConfig &config, int8_t worker) {
+    std::vector<int8_t> affinities;
+    if (worker >= 0) affinities = {worker};
+    return submit_impl(
+        WorkerType::NEXT_LEVEL, callable, /*callable_id=*/-1, config, std::vector<ArenaArgs>{args},
+        std::move(affinities)
+    );
+}
+
+SubmitResult Orchestrator::submit_next_level_group(
+    uint64_t callable, const std::vector<ArenaArgs> &args_list, const ChipCallConfig &config,
+    const std::vector<int8_t> &workers
+) {
+    return submit_impl(WorkerType::NEXT_LEVEL, callable, /*callable_id=*/-1, config, args_list, workers);
+}
+
+SubmitResult Orchestrator::submit_sub(int32_t callable_id, const ArenaArgs &args) {
+    return submit_impl(
+        WorkerType::SUB, /*callable_ptr=*/0, callable_id, ChipCallConfig{}, std::vector<ArenaArgs>{args}
+    );
+}
+
+SubmitResult Orchestrator::submit_sub_group(int32_t callable_id, const std::vector<ArenaArgs> &args_list) {
+    return submit_impl(WorkerType::SUB, /*callable_ptr=*/0, callable_id, ChipCallConfig{}, args_list);
+}
+
+// =============================================================================
+// Callable registry — submit by dense id
+// =============================================================================
+
+int32_t Orchestrator::register_callable(uint64_t callable, const ChipCallConfig &config) {
+    if (callable == 0) throw std::invalid_argument("Orchestrator: cannot register a null callable");
+    callable_registry_.push_back(RegisteredCallable{callable, config});
+    return static_cast<int32_t>(callable_registry_.size()) - 1;
+}
+
+const Orchestrator::RegisteredCallable &Orchestrator::registered(int32_t id) const {
+    if (id < 0 || static_cast<size_t>(id) >= callable_registry_.size()) {
+        throw std::out_of_range("Orchestrator: unknown registered callable id");
+    }
+    return callable_registry_[static_cast<size_t>(id)];
+}
+
+SubmitResult Orchestrator::submit_registered(int32_t id, const TaskArgs &args, int8_t worker) {
+    const RegisteredCallable &rc = registered(id);
+    std::vector<int8_t> affinities;
+    if (worker >= 0) affinities = {worker};
+    return submit_impl(
+        WorkerType::NEXT_LEVEL, rc.callable, /*callable_id=*/-1, rc.config, std::vector<TaskArgs>{args},
+        std::move(affinities)
+    );
+}
+
+SubmitResult Orchestrator::submit_registered_group(
+    int32_t id, const std::vector<TaskArgs> &args_list, const std::vector<int8_t> &workers
+) {
+    const RegisteredCallable &rc = registered(id);
+    return submit_impl(WorkerType::NEXT_LEVEL, rc.callable, /*callable_id=*/-1, rc.config, args_list, workers);
+}
+
+SubmitResult Orchestrator::submit_registered(int32_t id, const ArenaArgs &args, int8_t worker) {
+    const RegisteredCallable &rc = registered(id);
+    std::vector<int8_t> affinities;
+    if (worker >= 0) affinities = {worker};
+    return submit_impl(
+        WorkerType::NEXT_LEVEL, rc.callable, /*callable_id=*/-1, rc.config, std::vector<ArenaArgs>{args},
+        std::move(affinities)
+    );
+}
+
+SubmitResult Orchestrator::submit_registered_group(
+    int32_t id, const std::vector<ArenaArgs> &args_list, const std::vector<int8_t> &workers
+) {
+    const RegisteredCallable &rc = registered(id);
+    return submit_impl(WorkerType::NEXT_LEVEL, rc.callable, /*callable_id=*/-1, rc.config, args_list, workers);
+}
+
+// =============================================================================
+// Partitioned-graph submit — partition resolution + transfer splicing
+// =============================================================================
+
+int8_t Orchestrator::resolve_partition(int32_t partition) const {
+    if (!manager_) throw std::runtime_error("Orchestrator::submit_partitioned: no WorkerManager wired");
+    int8_t worker = manager_->partition_worker(partition);
+    if (worker < 0) throw std::invalid_argument("Orchestrator::submit_partitioned: partition not mapped to a worker");
+    return worker;
+}
+
+SubmitResult Orchestrator::submit_partitioned(
+    uint64_t callable, const TaskArgs &args, const ChipCallConfig &config, int32_t partition
+) {
+    int8_t worker = resolve_partition(partition);
+    TaskArgs local = args;
+    splice_partition_transfers(local, worker);
+    return submit_next_level(callable, local, config, worker);
+}
+
+SubmitResult Orchestrator::submit_registered_partitioned(int32_t id, const TaskArgs &args, int32_t partition) {
+    const RegisteredCallable &rc = registered(id);
+    int8_t worker = resolve_partition(partition);
+    TaskArgs local = args;
+    splice_partition_transfers(local, worker);
+    return submit_impl(
+        WorkerType::NEXT_LEVEL, rc.callable, /*callable_id=*/-1, rc.config, std::vector<TaskArgs>{local},
+        std::vector<int8_t>{worker}
+    );
+}
+
+// Rewrite each child-memory INPUT/INOUT tensor whose producer registered it
+// under another partition's worker: the consumer reads a partition-local
+// replica instead, produced by a spliced transfer task. The tensormap entry
+// for the replica key makes the transfer the producer the consumer's
+// infer_deps wires against — no special casing downstream. Tensors with a
+// same-worker producer, host tensors, and tensors with no producer anywhere
+// (pointers presumed already valid on the destination worker) pass through
+// untouched.
+void Orchestrator::splice_partition_transfers(TaskArgs &args, int8_t dst_worker) {
+    for (int32_t i = 0; i < args.tensor_count(); ++i) {
+        TensorArgType tag = args.tag(i);
+        if (tag != TensorArgType::INPUT && tag != TensorArgType::INOUT) continue;
+        ContinuousTensor &t = args.tensor(i);
+        if (t.data == 0 || !t.is_child_memory()) continue;
+        if (tensormap_->lookup(TensorKey{t.data, dst_worker}) != INVALID_SLOT) continue;  // partition-local
+
+        // An earlier consumer on this partition already spliced a transfer
+        // for this source tensor — share its replica (and, through the
+        // tensormap, its transfer slot).
+        {
+            std::lock_guard<std::mutex> lk(transfer_routes_mu_);
+            auto it = transfer_routes_.find(TensorKey{t.data, dst_worker});
+            if (it != transfer_routes_.end()) {
+                t.data = it->second;
+                continue;
+            }
+        }
+
+        // Scan the other partitions' workers for the producer.
+        int32_t partitions = manager_->partition_count();
+        for (int32_t p = 0; p < partitions; ++p) {
+            int8_t src_worker = manager_->partition_worker(p);
+            if (src_worker < 0 || src_worker == dst_worker) continue;
+            TaskSlot producer = tensormap_->lookup(TensorKey{t.data, src_worker});
+            if (producer == INVALID_SLOT) continue;
+            t.data = create_transfer(producer, t, src_worker, dst_worker);
+            break;
+        }
+    }
+}
+
+uint64_t Orchestrator::create_transfer(
+    TaskSlot producer, const ContinuousTensor &t, int8_t src_worker, int8_t dst_worker
+) {
+    uint64_t size = t.nbytes();
+    uint64_t replica = malloc(dst_worker, size);
+
+    active_tasks_.fetch_add(1, std::memory_order_relaxed);
+    AllocResult ar = allocator_->alloc(0, scope_->current_depth());  // slot-only: the replica is device memory
+    if (ar.slot == INVALID_SLOT) {
+        active_tasks_.fetch_sub(1, std::memory_order_relaxed);
+        free(dst_worker, replica);
+        throw std::runtime_error("Orchestrator: allocator shutdown");
+    }
+    TaskSlot slot = ar.slot;
+
+    TaskSlotState &s = slot_state(slot);
+    s.reset();
+    s.worker_type = WorkerType::NEXT_LEVEL;
+    s.transfer = true;
+    s.transfer_src = t.data;
+    s.transfer_src_worker = src_worker;
+    s.transfer_dst = replica;
+    s.transfer_dst_worker = dst_worker;
+    s.transfer_size = size;
+
+    // The replica key is this transfer's output: consumers reading the
+    // patched pointer wire a fanin on the transfer through the normal
+    // tensormap lookup.
+    TensorKey replica_key{replica, dst_worker};
+    tensormap_->insert(replica_key, slot);
+    s.output_keys.push_back(replica_key);
+
+    {
+        std::lock_guard<std::mutex> lk(transfer_routes_mu_);
+        transfer_routes_[TensorKey{t.data, dst_worker}] = replica;
+    }
+
+    producers_.clear();
+    producers_.push_back(producer);
+    int32_t live_fanins = wire_fanins(slot, s);
+    finalize_submit(slot, s, live_fanins);
+
+    return replica;
+}
+
+void Orchestrator::launch_transfer(TaskSlot slot) {
+    TaskSlotState &s = slot_state(slot);
+    WorkerCopyQueue &q = copy_queue_for(s.transfer_dst_worker);
+    {
+        std::lock_guard<std::mutex> lk(q.mu);
+        CopyRequest req{};
+        req.to_device = true;
+        req.dst = s.transfer_dst;
+        req.src = s.transfer_src;
+        req.size = s.transfer_size;
+        req.seq = q.next_seq++;
+        req.transfer_slot = slot;
+        req.src_worker = s.transfer_src_worker;
+        q.pending.push_back(req);
+    }
+    q.cv.notify_one();
+}
+
+void Orchestrator::prefer_worker(TaskSlot task, int8_t worker) {
+    allocator_->slot_state(task)->preferred_worker.store(worker, std::memory_order_relaxed);
+}
+
+// =============================================================================
+// Args arena — backing storage for ArenaArgs (zero-copy submit)
+// =============================================================================
+
+void *Orchestrator::arena_alloc(size_t bytes, size_t align) {
+    size_t offset = (arena_chunk_used_ + align - 1) & ~(align - 1);
+    if (arena_chunks_.empty() || offset + bytes > ARGS_ARENA_CHUNK) {
+        // Oversized requests get a dedicated chunk; it still recycles on
+        // drain() like any other.
+        size_t chunk_bytes = bytes > ARGS_ARENA_CHUNK ? bytes : ARGS_ARENA_CHUNK;
+        arena_chunks_.push_back(std::make_unique<uint8_t[]>(chunk_bytes));
+        offset = 0;
+    }
+    arena_chunk_used_ = offset + bytes;
+    return arena_chunks_.back().get() + offset;
+}
+
+void Orchestrator::arena_reset() {
+    if (arena_chunks_.size() > 1) {
+        arena_chunks_.resize(1);
+    }
+    arena_chunk_used_ = 0;
+}
+
+ArenaArgs Orchestrator::make_args(int32_t tensor_cap, int32_t scalar_cap) {
+    ArenaArgs a;
+    a.tensor_cap_ = tensor_cap;
+    a.scalar_cap_ = scalar_cap;
+    if (tensor_cap > 0) {
+        a.tensors_ = static_cast<ContinuousTensor *>(
+            arena_alloc(sizeof(ContinuousTensor) * static_cast<size_t>(tensor_cap), alignof(ContinuousTensor))
+        );
+        a.tags_ = static_cast<TensorArgType *>(
+            arena_alloc(sizeof(TensorArgType) * static_cast<size_t>(tensor_cap), alignof(TensorArgType))
+        );
+    }
+    if (scalar_cap > 0) {
+        a.scalars_ =
+            static_cast<uint64_t *>(arena_alloc(sizeof(uint64_t) * static_cast<size_t>(scalar_cap), alignof(uint64_t)));
+    }
+    return a;
+}
+
 // =============================================================================
 // submit_impl — shared 7-step submit machinery
 // =============================================================================
 
+template <typename Args>
 SubmitResult Orchestrator::submit_impl(
     WorkerType worker_type, uint64_t callable_ptr, int32_t callable_id, const ChipCallConfig &config,
-    std::vector<TaskArgs> args_list, std::vector<int8_t> affinities
+    std::vector<Args> args_list, std::vector<int8_t> affinities
 ) {
     if (args_list.empty()) throw std::invalid_argument("Orchestrator: args_list must not be empty");
 
@@ -186,6 +614,10 @@ SubmitResult Orchestrator::submit_impl(
 
     TaskSlotState &s = slot_state(slot);
     s.reset();
+    // Non-null heap_ptr means reserve_outputs_and_slot carved OUTPUT slabs
+    // out of this slot's HeapRing range — remembered so mark_recurring can
+    // reject templates whose buffers die with the slot's FIFO release.
+    s.heap_outputs = ar.heap_ptr != nullptr;
 
     s.worker_type = worker_type;
     s.callable = callable_ptr;
@@ -195,15 +627,33 @@ SubmitResult Orchestrator::submit_impl(
     // --- Step 2: Walk tags → tensormap.lookup (deps) + tensormap.insert
     // (outputs). Must happen before we move args_list into the slot because
     // infer_deps reads tensor data pointers and tags from it.
-    std::vector<TaskSlot> producers;
-    infer_deps(slot, args_list, affinities, producers, s.output_keys);
+    producers_.clear();
+    infer_deps(slot, args_list, affinities, producers_, s.output_keys);
+
+    if (heap_capture_ != nullptr) {
+        heap_capture_->record_task(slot, producers_);
+    }
+    // Planned submits consume the plan region: wire the region's synthetic
+    // slot as a (COMPLETED) producer so the region cannot reach CONSUMED —
+    // and hand its bytes back to the ring — before every planned task has.
+    if (plan_drew_) {
+        plan_drew_ = false;
+        producers_.push_back(plan_region_slot_);
+    }
 
     // --- Step 3: Store TaskArgs directly (no chip-storage pre-build) ---
     // Dispatch builds a TaskArgsView on demand via `slot.args_view(i)`
     // (THREAD mode) or write_blob → read_blob (PROCESS mode). The L2 ABI
     // ChipStorageTaskArgs conversion now runs inside ChipWorker::run
-    // rather than at submit time.
-    if (args_list.size() == 1) {
+    // rather than at submit time. Arena-backed submits store only views —
+    // the argument arrays stay in the args arena until drain().
+    if constexpr (std::is_same_v<Args, ArenaArgs>) {
+        s.is_group_ = args_list.size() > 1;
+        s.arena_views.reserve(args_list.size());
+        for (const ArenaArgs &a : args_list) {
+            s.arena_views.push_back(make_view(a));
+        }
+    } else if (args_list.size() == 1) {
         s.is_group_ = false;
         s.task_args = std::move(args_list.front());
     } else {
@@ -212,16 +662,27 @@ SubmitResult Orchestrator::submit_impl(
     }
     s.affinities = std::move(affinities);
 
-    // --- Step 5: Finalize fanin — lock each producer's fanout_mu, attach ---
-    //
-    // For COMPLETED producers (notably alloc-created synthetic slots), we
-    // still wire the fanout edge so the producer waits for this consumer
-    // before being CONSUMED (and freeing any owned buffers). The consumer
-    // itself doesn't gain a live fanin — it can run immediately because the
-    // producer is already done. CONSUMED producers are gone (resources freed),
-    // so we skip them entirely.
+    // --- Steps 5–6: fanin wiring + scope ref + READY/PENDING push ---
+    // Shared with resubmit(), which rebuilds exactly these edges for a
+    // recurring template.
+    int32_t live_fanins = wire_fanins(slot, s);
+    finalize_submit(slot, s, live_fanins);
+
+    return SubmitResult{slot};
+}
+
+// Finalize fanin — lock each producer's fanout_mu, attach.
+//
+// For COMPLETED producers (notably alloc-created synthetic slots), we
+// still wire the fanout edge so the producer waits for this consumer
+// before being CONSUMED (and freeing any owned buffers). The consumer
+// itself doesn't gain a live fanin — it can run immediately because the
+// producer is already done. CONSUMED producers are gone (resources freed),
+// so we skip them entirely. Reads the `producers_` scratch populated by
+// the preceding infer_deps call.
+int32_t Orchestrator::wire_fanins(TaskSlot slot, TaskSlotState &s) {
     int32_t live_fanins = 0;
-    for (TaskSlot prod : producers) {
+    for (TaskSlot prod : producers_) {
         TaskSlotState &ps = slot_state(prod);
         std::lock_guard<std::mutex> lk(ps.fanout_mu);
 
@@ -236,7 +697,10 @@ SubmitResult Orchestrator::submit_impl(
             live_fanins++;
         }
     }
+    return live_fanins;
+}
 
+void Orchestrator::finalize_submit(TaskSlot slot, TaskSlotState &s, int32_t live_fanins) {
     s.fanin_count = live_fanins;
     s.fanin_released.store(0, std::memory_order_relaxed);
 
@@ -249,19 +713,182 @@ SubmitResult Orchestrator::submit_impl(
 
     if (scope_ref > 0) scope_->register_task(slot);
 
-    // --- Step 6: If no live fanins → READY ---
+    // No live fanins → READY.
     // Strict-4: push to the queue dedicated to this task's worker type so a
     // saturated sub pool cannot stall next-level dispatch (and vice versa).
+    // Transfer tasks never enter a ready queue — with their producer already
+    // COMPLETED the copy can launch right away.
     if (live_fanins == 0) {
+        if (s.transfer) {
+            s.state.store(TaskState::READY, std::memory_order_release);
+            launch_transfer(slot);
+            return;
+        }
+        // Single-child pass-through: with exactly one worker in this task's
+        // pool there is nothing for the Scheduler to pick, so hand the task
+        // straight to that worker's queue (FIFO like dispatch_ready) and
+        // skip the ready-queue round trip.
+        WorkerThread *direct = (s.worker_type == WorkerType::NEXT_LEVEL) ? direct_next_level_ : direct_sub_;
+        if (direct && direct_dispatch_eligible(s)) {
+            s.ran_on = static_cast<int8_t>(direct->logical_id());
+            s.state.store(TaskState::RUNNING, std::memory_order_release);
+            WorkerDispatch d;
+            d.task_slot = slot;
+            d.group_index = 0;
+            direct->dispatch(d);
+            return;
+        }
         s.state.store(TaskState::READY, std::memory_order_release);
-        ready_queue_for(worker_type)->push(slot);
+        ready_queue_for(s.worker_type)->push(s);
     } else {
         s.state.store(TaskState::PENDING, std::memory_order_release);
     }
+}
+
+// =============================================================================
+// Recurring-submit fast path — mark_recurring / resubmit
+// =============================================================================
+
+void Orchestrator::mark_recurring(TaskSlot slot) {
+    TaskSlotState &s = slot_state(slot);
+    if (!s.arena_views.empty()) {
+        // Arena views drop the per-tensor tags, and resubmit needs them to
+        // re-run dependency inference.
+        throw std::invalid_argument("Orchestrator::mark_recurring: arena-backed submissions cannot recur");
+    }
+    if (s.heap_outputs) {
+        throw std::invalid_argument(
+            "Orchestrator::mark_recurring: task has auto-allocated OUTPUT slabs tied to this slot's lifetime"
+        );
+    }
+    s.recurring = true;
+}
+
+SubmitResult Orchestrator::resubmit(TaskSlot template_slot) {
+    TaskSlotState &t = slot_state(template_slot);
+    if (!t.recurring) {
+        throw std::invalid_argument("Orchestrator::resubmit: slot was not marked recurring");
+    }
+
+    active_tasks_.fetch_add(1, std::memory_order_relaxed);
+
+    // Slot-only claim: the template cannot own heap outputs (mark_recurring
+    // rejected those), so there is nothing to carve.
+    AllocResult ar = allocator_->alloc(0, scope_->current_depth());
+    if (ar.slot == INVALID_SLOT) {
+        active_tasks_.fetch_sub(1, std::memory_order_relaxed);
+        throw std::runtime_error("Orchestrator: allocator shutdown");
+    }
+    TaskSlot slot = ar.slot;
+
+    TaskSlotState &s = slot_state(slot);
+    s.reset();
+
+    s.worker_type = t.worker_type;
+    s.callable = t.callable;
+    s.callable_id = t.callable_id;
+    s.config = t.config;
+
+    // Alias the template's argument storage instead of copying it. Slot
+    // states live until drain() (the allocator's deque is only cleared by
+    // reset_to_empty), so the template's TaskArgs stay readable even after
+    // the template itself reaches CONSUMED. Note the clone does NOT inherit
+    // `recurring` — resubmit always targets the originally marked slot.
+    s.is_group_ = t.is_group_;
+    resubmit_refs_.clear();
+    if (t.is_group_) {
+        s.arena_views.reserve(t.task_args_list.size());
+        resubmit_refs_.reserve(t.task_args_list.size());
+        for (const TaskArgs &a : t.task_args_list) {
+            s.arena_views.push_back(make_view(a));
+            resubmit_refs_.push_back(TaskArgsRef{&a});
+        }
+    } else {
+        s.arena_views.push_back(make_view(t.task_args));
+        resubmit_refs_.push_back(TaskArgsRef{&t.task_args});
+    }
+    s.affinities = t.affinities;
+
+    // Dependency inference re-runs in full: the tensormap's producer set
+    // changes every iteration (the previous clone now owns the shared keys),
+    // so the fanin edges cannot be carried over from the template.
+    producers_.clear();
+    infer_deps(slot, resubmit_refs_, s.affinities, producers_, s.output_keys);
+
+    int32_t live_fanins = wire_fanins(slot, s);
+    finalize_submit(slot, s, live_fanins);
 
     return SubmitResult{slot};
 }
 
+// =============================================================================
+// Offline heap planning — begin_heap_capture / use_heap_plan
+// =============================================================================
+
+void Orchestrator::begin_heap_capture(HeapPlanner *planner) {
+    if (planner == nullptr) {
+        throw std::invalid_argument("Orchestrator::begin_heap_capture: planner must not be null");
+    }
+    if (heap_plan_active_) {
+        // A planned replay takes no ring bumps, so capturing it would record
+        // a stream the planner cannot improve on — reject the combination.
+        throw std::logic_error("Orchestrator::begin_heap_capture: a heap plan is active");
+    }
+    planner->reset();
+    heap_capture_ = planner;
+}
+
+void Orchestrator::end_heap_capture() { heap_capture_ = nullptr; }
+
+void Orchestrator::use_heap_plan(const HeapPlan &plan) {
+    if (plan.spans.empty()) {
+        throw std::invalid_argument("Orchestrator::use_heap_plan: plan has no spans");
+    }
+    if (heap_plan_active_) {
+        throw std::logic_error("Orchestrator::use_heap_plan: a heap plan is already active");
+    }
+
+    // Carve the whole planned region as one long-lived synthetic slot —
+    // the same pattern as alloc(), minus tensormap registration (dependency
+    // inference keys on the per-task output tensors, not the region).
+    AllocResult ar = allocator_->alloc(align_up(plan.required_bytes, HEAP_ALIGN), scope_->current_depth());
+    if (ar.slot == INVALID_SLOT || ar.heap_ptr == nullptr) {
+        throw std::runtime_error("Orchestrator::use_heap_plan: allocator shutdown");
+    }
+
+    TaskSlotState &s = slot_state(ar.slot);
+    s.reset();
+    s.fanin_count = 0;
+    s.fanin_released.store(0, std::memory_order_relaxed);
+    int32_t scope_ref = (scope_->depth() > 0) ? 1 : 0;
+    {
+        std::lock_guard<std::mutex> lk(s.fanout_mu);
+        s.fanout_total = scope_ref;
+    }
+    // Same self try_consume simulation as alloc(): without the bump the
+    // fanout-release threshold would be one short and the region slot would
+    // never reach CONSUMED.
+    s.fanout_released.store(1, std::memory_order_relaxed);
+    if (scope_ref > 0) scope_->register_task(ar.slot);
+    s.state.store(TaskState::COMPLETED, std::memory_order_release);
+    active_tasks_.fetch_add(1, std::memory_order_relaxed);
+
+    heap_plan_ = plan;
+    heap_plan_active_ = true;
+    plan_base_ = static_cast<char *>(ar.heap_ptr);
+    plan_cursor_ = 0;
+    plan_region_slot_ = ar.slot;
+    plan_drew_ = false;
+}
+
+void Orchestrator::clear_heap_plan() {
+    heap_plan_active_ = false;
+    plan_base_ = nullptr;
+    plan_cursor_ = 0;
+    plan_region_slot_ = INVALID_SLOT;
+    plan_drew_ = false;
+}
+
 // =============================================================================
 // reserve_outputs_and_slot — atomic slot + heap carve-up for this submit
 // =============================================================================
@@ -273,9 +900,10 @@ SubmitResult Orchestrator::submit_impl(
 // OUTPUT.data themselves). The single allocator call owns both the slot and
 // the heap range, so there is no partial-failure rollback.
 
-AllocResult Orchestrator::reserve_outputs_and_slot(std::vector<TaskArgs> &args_list) {
+template <typename Args>
+AllocResult Orchestrator::reserve_outputs_and_slot(std::vector<Args> &args_list) {
     uint64_t total_bytes = 0;
-    for (const TaskArgs &a : args_list) {
+    for (const Args &a : args_list) {
         for (int32_t i = 0; i < a.tensor_count(); ++i) {
             if (a.tag(i) != TensorArgType::OUTPUT) continue;
             if (a.tensor(i).data != 0) continue;  // user supplied a pointer — leave alone
@@ -283,13 +911,45 @@ AllocResult Orchestrator::reserve_outputs_and_slot(std::vector<TaskArgs> &args_l
         }
     }
 
+    // Planned mode: outputs come from the plan region at the next planner-
+    // assigned offset; the ring sees only a slot claim. The replay must
+    // track the capture — the positional span's size is the same aligned
+    // total the capture recorded, so a mismatch means the stream diverged.
+    if (heap_plan_active_ && total_bytes > 0) {
+        const HeapPlan::Span &span = heap_plan_.spans[plan_cursor_];
+        if (span.bytes != total_bytes) {
+            throw std::logic_error("Orchestrator: planned replay diverged from capture (span size mismatch)");
+        }
+        plan_cursor_ = (plan_cursor_ + 1) % heap_plan_.spans.size();
+
+        AllocResult ar = allocator_->alloc(0, scope_->current_depth());
+        if (ar.slot == INVALID_SLOT) return ar;
+        uint64_t off = 0;
+        char *base = plan_base_ + span.offset;
+        for (Args &a : args_list) {
+            for (int32_t i = 0; i < a.tensor_count(); ++i) {
+                if (a.tag(i) != TensorArgType::OUTPUT) continue;
+                ContinuousTensor &t = a.tensor(i);
+                if (t.data != 0) continue;
+                t.data = reinterpret_cast<uint64_t>(base + off);
+                off += output_alloc_bytes(t);
+            }
+        }
+        plan_drew_ = true;
+        return ar;
+    }
+
     AllocResult ar = allocator_->alloc(total_bytes, scope_->current_depth());
     if (ar.slot == INVALID_SLOT) return ar;
 
+    if (heap_capture_ != nullptr && total_bytes > 0) {
+        heap_capture_->record_alloc(ar.slot, total_bytes);
+    }
+
     // Hand slabs out in the same order we counted them.
     uint64_t off = 0;
     char *base = static_cast<char *>(ar.heap_ptr);
-    for (TaskArgs &a : args_list) {
+    for (Args &a : args_list) {
         for (int32_t i = 0; i < a.tensor_count(); ++i) {
             if (a.tag(i) != TensorArgType::OUTPUT) continue;
             ContinuousTensor &t = a.tensor(i);
@@ -306,15 +966,15 @@ AllocResult Orchestrator::reserve_outputs_and_slot(std::vector<TaskArgs> &args_l
 // infer_deps — tag-driven dependency inference
 // =============================================================================
 
+template <typename Args>
 void Orchestrator::infer_deps(
-    TaskSlot slot, const std::vector<TaskArgs> &args_list, const std::vector<int8_t> &affinities,
+    TaskSlot slot, const std::vector<Args> &args_list, const std::vector<int8_t> &affinities,
     std::vector<TaskSlot> &producers, std::vector<TensorKey> &output_keys
 ) {
     auto add_unique_producer = [&](TaskSlot p) {
-        // Group submits walk many TaskArgs under one slot: if two entries in
-        // the same group tag the same buffer (e.g. both OUTPUT 0xCAFE), the
-        // second-pass lookup would return the slot that the first pass just
-        // inserted — a self-loop. Skip it.
+        // Defensive: the batch cache already suppresses self-references via
+        // `inserted`, but a stale tensormap entry pointing at this slot would
+        // otherwise wire a self-loop.
         if (p == slot) return;
         for (TaskSlot existing : producers) {
             if (existing == p) return;
@@ -322,6 +982,21 @@ void Orchestrator::infer_deps(
         producers.push_back(p);
     };
 
+    // Batch dedup: codegen-emitted groups repeat a small set of shared
+    // tensors across hundreds of entries. Each unique key pays for exactly
+    // one tensormap lookup and one insert per submit; repeats are answered
+    // from this table. `inserted` also covers the within-batch
+    // produce-then-consume pattern (an OUTPUT earlier in the batch followed
+    // by an INPUT of the same key is a self-reference, not a fanin).
+    batch_keys_.clear();
+    auto cached_lookup = [&](const TensorKey &key, BatchKeyInfo &info) {
+        if (!info.looked_up) {
+            info.producer = tensormap_->lookup(key);
+            info.looked_up = true;
+        }
+        return info.producer;
+    };
+
     // Tag-driven dependency inference — mirrors L2
     // (src/a2a3/runtime/tensormap_and_ringbuffer/runtime/pto_orchestrator.cpp
     //  steps B and 4):
@@ -335,32 +1010,38 @@ void Orchestrator::infer_deps(
     //   NO_DEP           → skip
     for (size_t g = 0; g < args_list.size(); ++g) {
         int8_t worker_id = (g < affinities.size()) ? affinities[g] : int8_t(-1);
-        const TaskArgs &a = args_list[g];
+        const Args &a = args_list[g];
         for (int32_t i = 0; i < a.tensor_count(); ++i) {
             const ContinuousTensor &t = a.tensor(i);
             if (t.data == 0) continue;  // null tensor — nothing to track
             TensorKey key{t.data, t.is_child_memory() ? worker_id : int8_t(-1)};
             TensorArgType tag = a.tag(i);
+            if (tag == TensorArgType::NO_DEP) continue;
+            BatchKeyInfo &info = batch_keys_[key];
             switch (tag) {
             case TensorArgType::INPUT: {
-                TaskSlot prod = tensormap_->lookup(key);
+                if (info.inserted) break;  // produced earlier in this batch
+                TaskSlot prod = cached_lookup(key, info);
                 if (prod != INVALID_SLOT) add_unique_producer(prod);
                 break;
             }
             case TensorArgType::INOUT: {
-                TaskSlot prod = tensormap_->lookup(key);
+                if (info.inserted) break;
+                TaskSlot prod = cached_lookup(key, info);
                 if (prod != INVALID_SLOT) add_unique_producer(prod);
                 tensormap_->insert(key, slot);
+                info.inserted = true;
                 output_keys.push_back(key);
                 break;
             }
             case TensorArgType::OUTPUT:
             case TensorArgType::OUTPUT_EXISTING: {
+                if (info.inserted) break;
                 tensormap_->insert(key, slot);
+                info.inserted = true;
                 output_keys.push_back(key);
                 break;
             }
-            case TensorArgType::NO_DEP:
             default:
                 break;
             }
@@ -372,9 +1053,26 @@ void Orchestrator::infer_deps(
 // Scope
 // =============================================================================
 
-void Orchestrator::scope_begin() { scope_->scope_begin(); }
+void Orchestrator::scope_begin(int32_t reserve_tasks, uint64_t reserve_bytes) {
+    scope_->scope_begin(reserve_tasks);
+    if (reserve_bytes > 0 || reserve_tasks > 0) {
+        try {
+            allocator_->scope_reserve(scope_->current_depth(), reserve_tasks, reserve_bytes);
+        } catch (...) {
+            // Close the just-opened (empty) frame so the caller's bracket
+            // balance survives the throw.
+            scope_->scope_end([](TaskSlot) {});
+            throw;
+        }
+        scope_reserved_[scope_->depth() - 1] = true;
+    }
+}
 
 void Orchestrator::scope_end() {
+    if (scope_->depth() > 0 && scope_reserved_[scope_->depth() - 1]) {
+        scope_reserved_[scope_->depth() - 1] = false;
+        allocator_->scope_unreserve(scope_->current_depth());
+    }
     scope_->scope_end([this](TaskSlot slot) {
         release_ref(slot);
     });
@@ -419,6 +1117,18 @@ bool Orchestrator::on_consumed(TaskSlot slot) {
 
     tensormap_->erase_task_outputs(s.output_keys);
 
+    // Transfer slots own their partition-local replica buffer: drop the
+    // route (a later consumer splices a fresh transfer) and free the device
+    // memory. Each consumer's deferred release lands only after its run()
+    // finished, so nothing can still read the replica.
+    if (s.transfer) {
+        {
+            std::lock_guard<std::mutex> lk(transfer_routes_mu_);
+            transfer_routes_.erase(TensorKey{s.transfer_src, s.transfer_dst_worker});
+        }
+        free(s.transfer_dst_worker, s.transfer_dst);
+    }
+
     // HeapRing-owned OUTPUT slabs are reclaimed implicitly when the allocator
     // advances last_alive past this slot — no per-slot munmap needed.
     allocator_->release(slot);
@@ -436,6 +1146,37 @@ bool Orchestrator::on_consumed(TaskSlot slot) {
     return true;
 }
 
+// Advance completed_watermark_ past every contiguously-finished slot.
+// Caller holds drain_mu_. Returns true when the watermark moved.
+bool Orchestrator::advance_watermark_locked() {
+    TaskSlot next = completed_watermark_;
+    TaskSlot limit = allocator_->next_task_id();
+    while (next < limit) {
+        TaskState st = slot_state(next).state.load(std::memory_order_acquire);
+        if (st != TaskState::COMPLETED && st != TaskState::CONSUMED) break;
+        ++next;
+    }
+    if (next == completed_watermark_) return false;
+    completed_watermark_ = next;
+    return true;
+}
+
+void Orchestrator::on_completed(TaskSlot /*slot*/) {
+    std::lock_guard<std::mutex> lk(drain_mu_);
+    if (advance_watermark_locked()) drain_cv_.notify_all();
+}
+
+void Orchestrator::wait_watermark(TaskSlot watermark) {
+    std::unique_lock<std::mutex> lk(drain_mu_);
+    // Scan once up front: alloc() slots reach COMPLETED on the orch thread
+    // without a scheduler callback, so the watermark may already be
+    // satisfiable with no further completion event coming.
+    advance_watermark_locked();
+    drain_cv_.wait(lk, [this, watermark] {
+        return completed_watermark_ > watermark;
+    });
+}
+
 void Orchestrator::drain() {
     {
         std::unique_lock<std::mutex> lk(drain_mu_);
@@ -443,8 +1184,24 @@ void Orchestrator::drain() {
             return active_tasks_.load(std::memory_order_acquire) == 0;
         });
     }
+    // Outstanding async copies are not DAG nodes, so wait for them
+    // explicitly before declaring the scope quiescent. Runs after the
+    // active-task wait so partition transfer copies — which enqueue only
+    // when their producer completes — also have their stored errors
+    // rethrown by this drain.
+    wait_all_copies();
     // Every slot is CONSUMED (active_tasks_ == 0 ⇒ allocator last_alive_ ==
     // next_task_id_). Drop all per-slot state so the next Worker.run()
-    // starts from task_id = 0 with no accumulated memory.
+    // starts from task_id = 0 with no accumulated memory. No slot can still
+    // hold a view into the args arena, so it recycles here too.
     allocator_->reset_to_empty();
+    arena_reset();
+    // Slot ids restart from 0 — watermarks issued before this drain are no
+    // longer meaningful, and neither is an active heap plan (its region slot
+    // was just dropped with the rest of the ring).
+    clear_heap_plan();
+    {
+        std::lock_guard<std::mutex> lk(drain_mu_);
+        completed_watermark_ = 0;
+    }
 }
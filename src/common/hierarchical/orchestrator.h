@@ -17,6 +17,7 @@
  *   - submit_next_level_group(callable, vector<TaskArgs>, ChipCallConfig)
  *   - submit_sub(callable_id, TaskArgs)
  *   - submit_sub_group(callable_id, vector<TaskArgs>)
+ *   - submit_partitioned(callable, TaskArgs, ChipCallConfig, partition)
  *   - alloc(shape, dtype) — runtime-owned intermediate buffer
  *
  * Each TaskArgs carries per-tensor TensorArgType tags. The Orchestrator
@@ -33,20 +34,26 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <exception>
 #include <memory>
 #include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "../task_interface/chip_call_config.h"
 #include "../task_interface/data_type.h"
 #include "../task_interface/task_args.h"
 #include "../task_interface/tensor_arg.h"
+#include "heap_plan.h"
 #include "ring.h"
 #include "scope.h"
 #include "tensormap.h"
 #include "types.h"
 
 class WorkerManager;
+class WorkerThread;
 
 // ---------------------------------------------------------------------------
 // SubmitResult — just the slot id
@@ -60,12 +67,91 @@ struct SubmitResult {
     TaskSlot task_slot{INVALID_SLOT};
 };
 
+// ---------------------------------------------------------------------------
+// TransferStats — per-class counters for cross-worker transfers
+// ---------------------------------------------------------------------------
+//
+// copy_between() lands in exactly one class per call: `d2d` when the platform
+// carried the transfer directly between devices, `staged` when it bounced
+// through a host buffer. Distinguishing the two is what tells a pipeline-
+// parallel deployment whether peer DMA is actually engaged.
+
+struct TransferStats {
+    uint64_t d2d_transfers{0};
+    uint64_t d2d_bytes{0};
+    uint64_t staged_transfers{0};
+    uint64_t staged_bytes{0};
+};
+
+// ---------------------------------------------------------------------------
+// CopyToken — completion handle for async copies
+// ---------------------------------------------------------------------------
+//
+// Lightweight value type: (worker, sequence number) into that worker's copy
+// queue. Redeemable any number of times via Orchestrator::wait(); a
+// default-constructed token is a no-op to wait on.
+
+struct CopyToken {
+    int worker_id{-1};
+    uint64_t seq{0};
+
+    bool valid() const { return seq != 0; }
+};
+
+// ---------------------------------------------------------------------------
+// ArenaArgs — arena-backed argument builder for the zero-copy submit path
+// ---------------------------------------------------------------------------
+//
+// Created via Orchestrator::make_args(): the tensor/tag/scalar arrays live in
+// the Orchestrator's args arena and are written in place, so a submit stores
+// only a TaskArgsView into the slot — one write per argument at build time,
+// no vector copies at submit. Mirrors the TaskArgs accessors so the submit
+// machinery (dependency inference, output auto-alloc) is shared.
+//
+// Lifetime: the arena is recycled by drain(), after every task has reached
+// CONSUMED. scope_end() is non-blocking (tasks may still be executing when
+// it returns), so the arena cannot recycle earlier.
+
+struct ArenaArgs {
+    ContinuousTensor *tensors_{nullptr};
+    TensorArgType *tags_{nullptr};
+    uint64_t *scalars_{nullptr};
+    int32_t tensor_count_{0};
+    int32_t scalar_count_{0};
+    int32_t tensor_cap_{0};
+    int32_t scalar_cap_{0};
+
+    void add_tensor(const ContinuousTensor &t, TensorArgType tag) {
+        if (tensor_count_ >= tensor_cap_) throw std::out_of_range("ArenaArgs: tensor capacity exceeded");
+        tensors_[tensor_count_] = t;
+        tags_[tensor_count_++] = tag;
+    }
+
+    void add_scalar(uint64_t s) {
+        if (scalar_count_ >= scalar_cap_) throw std::out_of_range("ArenaArgs: scalar capacity exceeded");
+        scalars_[scalar_count_++] = s;
+    }
+
+    int32_t tensor_count() const { return tensor_count_; }
+    int32_t scalar_count() const { return scalar_count_; }
+    const ContinuousTensor &tensor(int32_t i) const { return tensors_[i]; }
+    ContinuousTensor &tensor(int32_t i) { return tensors_[i]; }
+    const TensorArgType &tag(int32_t i) const { return tags_[i]; }
+};
+
+inline TaskArgsView make_view(const ArenaArgs &a) {
+    return TaskArgsView{a.tensor_count_, a.scalar_count_, a.tensors_, a.scalars_};
+}
+
 // ---------------------------------------------------------------------------
 // Orchestrator
 // ---------------------------------------------------------------------------
 
 class Orchestrator {
 public:
+    Orchestrator() = default;
+    ~Orchestrator();
+
     // Strict-4: the engine keeps one ReadyQueue per WorkerType so a
     // saturated sub pool cannot head-of-line-block chip dispatch (and vice
     // versa). Submit routes to the queue matching the task's worker_type;
@@ -75,6 +161,13 @@ public:
         ReadyQueue *ready_sub_queue, WorkerManager *manager = nullptr
     );
 
+    // Single-child pass-through: for each pool holding exactly one worker,
+    // cache that WorkerThread so finalize_submit hands READY tasks straight
+    // to it — no ready-queue hop, no Scheduler pick. Called by Worker::init
+    // after the WorkerManager has started (the targets are the manager's
+    // WorkerThreads, which exist only from start()).
+    void init_direct_dispatch();
+
     // Allocate an intermediate buffer from the Worker's HeapRing (MAP_SHARED,
     // visible to forked child workers). Returns a ContinuousTensor whose
     // `.data` points into the ring.
@@ -92,6 +185,39 @@ public:
     void copy_to(int worker_id, uint64_t dst, uint64_t src, size_t size);
     void copy_from(int worker_id, uint64_t dst, uint64_t src, size_t size);
 
+    // Async variants: enqueue the transfer on the target worker's copy
+    // queue (one background thread per worker, FIFO) and return
+    // immediately, so weight streaming overlaps submit_next_level()
+    // execution. Copies to the same worker complete in enqueue order.
+    //
+    // The DAG does not see these transfers — call wait(token) before
+    // submitting a task that reads the copied data (copy_to_async) or
+    // before touching the host buffer (copy_from_async). The source /
+    // destination buffers must stay alive until the token completes.
+    // drain() implicitly waits for all outstanding copies. A failed copy
+    // rethrows its exception from the next wait()/drain() on that worker.
+    CopyToken copy_to_async(int worker_id, uint64_t dst, uint64_t src, size_t size);
+    CopyToken copy_from_async(int worker_id, uint64_t dst, uint64_t src, size_t size);
+
+    // Worker-to-worker tensor transfer (pipeline parallel activations).
+    // Tries the platform's direct device-to-device path first (issued
+    // through the destination worker); when that is unavailable — PROCESS
+    // mode, an old runtime SO, or no peer access — stages through a
+    // transient host buffer instead of requiring the caller to bounce
+    // manually. Each call is recorded in transfer_stats() under its class.
+    // Orch-thread only, synchronous.
+    void copy_between(int dst_worker_id, uint64_t dst, int src_worker_id, uint64_t src, size_t size);
+
+    // Cumulative cross-worker transfer counters since init() — covers both
+    // explicit copy_between() calls and automatic partition transfer tasks.
+    // Writes are mutex-guarded (transfer tasks record from copy threads);
+    // read after drain() for a stable snapshot.
+    const TransferStats &transfer_stats() const { return transfer_stats_; }
+
+    // Block until the tokened copy (and everything enqueued before it on
+    // that worker) has completed. No-op for invalid/default tokens.
+    void wait(const CopyToken &token);
+
     // Submit a NEXT_LEVEL task. `callable` is the chip callable buffer pointer
     // (uint64_t handle from Python — typically ChipCallable.buffer_ptr()).
     // Tags inside `args` drive dependency inference; OUTPUT tensors with null
@@ -113,6 +239,122 @@ public:
     // Submit a group of SUB tasks: N args -> N workers, 1 DAG node.
     SubmitResult submit_sub_group(int32_t callable_id, const std::vector<TaskArgs> &args_list);
 
+    // Zero-copy submit path. make_args() returns an ArenaArgs whose arrays
+    // live in the args arena; build the arguments in place and submit — the
+    // slot stores only a TaskArgsView over the arena, avoiding the
+    // per-submit TaskArgs vector copies. ArenaArgs values are cheap handles
+    // (pointers + counts) and must not be reused after drain() recycles the
+    // arena. Single-threaded like the other submit_* methods.
+    ArenaArgs make_args(int32_t tensor_cap, int32_t scalar_cap);
+
+    SubmitResult
+    submit_next_level(uint64_t callable, const ArenaArgs &args, const ChipCallConfig &config, int8_t worker = -1);
+    SubmitResult submit_next_level_group(
+        uint64_t callable, const std::vector<ArenaArgs> &args_list, const ChipCallConfig &config,
+        const std::vector<int8_t> &workers = {}
+    );
+    SubmitResult submit_sub(int32_t callable_id, const ArenaArgs &args);
+    SubmitResult submit_sub_group(int32_t callable_id, const std::vector<ArenaArgs> &args_list);
+
+    // Callable registry — register a NEXT_LEVEL callable once, submit by
+    // dense id. register_callable() captures the chip callable pointer
+    // together with its ChipCallConfig in a flat table; submit_registered()
+    // indexes that table directly, so steady-state loops pass one small int
+    // per submit instead of re-shipping the 8-byte handle and the full
+    // config every call. The entry is also the natural home for further
+    // per-callable metadata (arg schema, typical output size) as dispatch
+    // grows. Ids are dense, survive drain(), and — like the rest of the
+    // submit API — are orch-thread only.
+    int32_t register_callable(uint64_t callable, const ChipCallConfig &config = ChipCallConfig{});
+
+    SubmitResult submit_registered(int32_t id, const TaskArgs &args, int8_t worker = -1);
+    SubmitResult submit_registered_group(
+        int32_t id, const std::vector<TaskArgs> &args_list, const std::vector<int8_t> &workers = {}
+    );
+    SubmitResult submit_registered(int32_t id, const ArenaArgs &args, int8_t worker = -1);
+    SubmitResult submit_registered_group(
+        int32_t id, const std::vector<ArenaArgs> &args_list, const std::vector<int8_t> &workers = {}
+    );
+
+    // Partitioned-graph submit: `partition` resolves through the
+    // WorkerManager's static partition map to a NEXT_LEVEL worker, and the
+    // task is pinned there. Child-memory INPUT/INOUT tensors whose producer
+    // ran on a different partition's worker are rewritten to a partition-
+    // local replica buffer, fed by an automatically spliced transfer task:
+    // a DAG node that depends on the producer, runs copy_between() on the
+    // destination worker's copy thread once the producer completes, and is
+    // itself the producer the consumer's dependency inference sees. Replicas
+    // are shared by every same-partition consumer of the same source tensor
+    // and freed when the transfer slot is CONSUMED. A cross-partition INOUT
+    // mutates the replica, not the producer's original buffer. Host-memory
+    // tensors need no transfer — their pointers are valid everywhere.
+    // Requires a WorkerManager with a partition map; throws on an unmapped
+    // partition.
+    SubmitResult
+    submit_partitioned(uint64_t callable, const TaskArgs &args, const ChipCallConfig &config, int32_t partition);
+    SubmitResult submit_registered_partitioned(int32_t id, const TaskArgs &args, int32_t partition);
+
+    // Called by the Scheduler when a transfer task becomes READY (and
+    // directly at submit when its producer is already COMPLETED): enqueues
+    // the copy on the destination worker's copy queue. The copy thread
+    // reports completion through the transfer-done callback so the slot
+    // re-enters the normal completion path.
+    void launch_transfer(TaskSlot slot);
+
+    // Completion sink for transfer tasks — wired by Worker::init to
+    // Scheduler::worker_done so finished transfers release their consumers.
+    void set_transfer_done(std::function<void(TaskSlot)> cb) { transfer_done_ = std::move(cb); }
+
+    // Recurring-submit fast path for steady-state loops that re-issue the
+    // same task every iteration. mark_recurring() declares a submitted slot
+    // a template: it must carry TaskArgs storage (not arena views — the
+    // views drop tags, which dep inference needs) and must not have
+    // auto-allocated OUTPUT slabs (those die with the template slot; a
+    // recurring task supplies its own persistent buffers). resubmit() then
+    // issues a new task that aliases the template's argument storage — no
+    // arg copies, no output walk, no affinity rebuild — and re-runs only
+    // dependency inference, which cannot be skipped because the tensormap's
+    // producer set changes every iteration. Valid until drain() (slot ids
+    // restart and template storage recycles).
+    void mark_recurring(TaskSlot slot);
+    SubmitResult resubmit(TaskSlot template_slot);
+
+    // Offline heap planning for recurring graphs (see heap_plan.h).
+    //
+    // Capture: between begin_heap_capture() and end_heap_capture(), every
+    // submit is recorded into `planner` — the DAG node with its inferred
+    // producer edges, plus the aligned byte total of any auto-allocated
+    // OUTPUT slabs. Allocation behavior is unchanged during capture; run
+    // one representative iteration, end the capture, and call
+    // `planner.plan()` for the static offset assignment.
+    //
+    // Replay: use_heap_plan() copies the plan, carves one region of
+    // `plan.required_bytes` from the current scope's ring (a long-lived
+    // synthetic slot, same lifetime rules as alloc() buffers), and switches
+    // auto-allocation over: each subsequent submit with null-data OUTPUT
+    // tensors takes the next planned span positionally — a slot-only ring
+    // claim plus `region_base + offset` — instead of a ring bump. The
+    // replayed stream must allocate in the captured order and sizes;
+    // divergence throws std::logic_error. The span cursor wraps, so whole-
+    // graph re-issues keep drawing the same offsets; cross-iteration reuse
+    // of a span relies on the graph's own dependencies ordering the next
+    // writer after the previous readers, exactly like any recurring task's
+    // persistent buffers. Planned submits carry no auto-allocated slabs, so
+    // they are eligible for mark_recurring()/resubmit(). The plan (and its
+    // region) is valid until clear_heap_plan() or drain().
+    void begin_heap_capture(HeapPlanner *planner);
+    void end_heap_capture();
+    void use_heap_plan(const HeapPlan &plan);
+    void clear_heap_plan();
+
+    // Soft placement hint: prefer dispatching `task` to logical `worker` of
+    // its own worker type. Unlike the submit-time `worker=` pin this is
+    // advisory — the Scheduler overrides it when that worker is busy or
+    // markedly slower than the best idle candidate, and left unhinted
+    // consumers inherit their producer's worker automatically. A hint that
+    // lands after the task is already dispatched is simply ignored.
+    void prefer_worker(TaskSlot task, int8_t worker);
+
     // Open a nested scope. Every task submitted between this call and the
     // matching `scope_end()` picks a heap ring based on the current scope
     // depth (`min(depth, MAX_RING_DEPTH - 1)`) so its slab reclaims
@@ -125,13 +367,39 @@ public:
     // happen asynchronously as each task's consumer count reaches
     // threshold (mirrors L2's `pto2_scope_end`). Callers that need a
     // synchronous wait must call `drain()` separately.
-    void scope_begin();
+    //
+    // Reserve-ahead: when the scope's shape is known at entry (generated
+    // code usually knows both), `reserve_tasks` / `reserve_bytes` forward to
+    // `Ring::scope_reserve` on the scope's ring and to the Scope frame's
+    // task-list preallocation, making every covered in-scope alloc a
+    // guaranteed bump with no back-pressure stall. `reserve_bytes` should be
+    // the sum of per-task sizes each rounded up to HEAP_ALIGN. The
+    // reservation may block (same timeout discipline as alloc) and whatever
+    // credit remains is handed back automatically at `scope_end`. Two
+    // reserved scopes that map to the same ring (nesting beyond
+    // MAX_RING_DEPTH - 1) throw std::logic_error.
+    void scope_begin(int32_t reserve_tasks = 0, uint64_t reserve_bytes = 0);
     void scope_end();
 
     // Block until every submitted task has reached CONSUMED. Invoked by
     // Worker::run after scope_end; not part of the user-facing orch-fn API.
     void drain();
 
+    // Block until every task with slot id <= `watermark` has finished
+    // executing (reached COMPLETED or later). Slot ids — as returned in
+    // SubmitResult — are allocated monotonically, so a pipeline can recycle
+    // the input buffers of everything up to a submission point without the
+    // full barrier of drain(). Watermarks are COMPLETED-based: runtime-owned
+    // outputs may still be referenced past the wait, and ids restart from 0
+    // after drain(), invalidating earlier watermarks. A task that can never
+    // run (unsatisfiable fanin) blocks its watermark forever.
+    void wait_watermark(TaskSlot watermark);
+
+    // Called by Scheduler when a task reaches COMPLETED: advances the
+    // completion watermark past every contiguously-finished slot id and
+    // wakes wait_watermark() waiters.
+    void on_completed(TaskSlot slot);
+
     // Called by Scheduler (via Worker) when a task becomes CONSUMED:
     // erases TensorMap entries, releases the allocator slot (and implicitly
     // the slot's heap slab via last_alive).
@@ -151,6 +419,10 @@ private:
     ReadyQueue *ready_next_level_queue_ = nullptr;
     ReadyQueue *ready_sub_queue_ = nullptr;
 
+    // Pass-through targets for single-worker pools (init_direct_dispatch).
+    WorkerThread *direct_next_level_ = nullptr;
+    WorkerThread *direct_sub_ = nullptr;
+
     // Returns the ready queue that owns tasks of the given worker type.
     // The method itself does not mutate the Orchestrator (hence `const`);
     // the returned pointer is non-const because callers push into the queue.
@@ -163,16 +435,125 @@ private:
     std::mutex drain_mu_;
     std::condition_variable drain_cv_;
 
+    // Smallest slot id that has not yet reached COMPLETED (guarded by
+    // drain_mu_). "All tasks <= id finished" is simply `watermark_ > id`.
+    TaskSlot completed_watermark_{0};
+    bool advance_watermark_locked();
+
+    // Which open scopes hold a Ring reservation, indexed by depth() - 1.
+    // Orch-owned like scope_ itself, so no locking; scope_end consults the
+    // flag to hand leftover credit back to the ring.
+    bool scope_reserved_[MAX_SCOPE_DEPTH] = {};
+
+    // --- Async copy queues (one per next-level worker, created lazily) ---
+
+    struct CopyRequest {
+        bool to_device;
+        uint64_t dst;
+        uint64_t src;
+        size_t size;
+        uint64_t seq;
+        // Valid slot id → this request is a cross-partition transfer task:
+        // the copy thread pulls from `src_worker` via the d2d path (staged
+        // fallback) and reports the slot through transfer_done_.
+        TaskSlot transfer_slot{INVALID_SLOT};
+        int src_worker{-1};
+    };
+
+    struct WorkerCopyQueue {
+        std::mutex mu;
+        std::condition_variable cv;       // new work / stop → copy thread
+        std::condition_variable done_cv;  // completed_seq advance → waiters
+        std::deque<CopyRequest> pending;
+        uint64_t next_seq{1};
+        uint64_t completed_seq{0};
+        std::exception_ptr error;  // first failure; rethrown by wait()/drain()
+        bool stop{false};
+        std::thread thr;
+    };
+
+    std::mutex copy_queues_mu_;
+    std::unordered_map<int, std::unique_ptr<WorkerCopyQueue>> copy_queues_;
+
+    // Cross-worker transfer accounting. Guarded by transfer_stats_mu_ —
+    // transfer tasks record from copy threads while copy_between() records
+    // from the orch thread.
+    std::mutex transfer_stats_mu_;
+    TransferStats transfer_stats_;
+
+    // Shared d2d-first / staged-fallback copy body behind copy_between()
+    // and the transfer-task execution path. Thread-safe via the workers'
+    // control locks plus transfer_stats_mu_.
+    void do_copy_between(int dst_worker_id, uint64_t dst, int src_worker_id, uint64_t src, size_t size);
+
+    // --- Partitioned-graph transfers ---
+    // Route cache: {source tensor ptr, destination worker} → partition-local
+    // replica ptr, so every same-partition consumer of a source tensor
+    // shares one transfer. Entries die with their transfer slot (erased in
+    // on_consumed alongside the buffer free). Guarded by transfer_routes_mu_
+    // — submits read/insert on the orch thread, on_consumed erases from the
+    // scheduler thread. Assumes live device pointer values do not collide
+    // across partitions (the same assumption the producer scan makes).
+    std::mutex transfer_routes_mu_;
+    std::unordered_map<TensorKey, uint64_t, TensorKeyHash> transfer_routes_;
+
+    std::function<void(TaskSlot)> transfer_done_;
+
+    // Resolve a partition id through the WorkerManager's map; throws when
+    // no manager is wired or the partition is unmapped.
+    int8_t resolve_partition(int32_t partition) const;
+
+    // Rewrite child-memory INPUT/INOUT tensors whose producer lives on
+    // another partition's worker to point at a partition-local replica,
+    // splicing in a transfer task per new (source, destination) pair.
+    void splice_partition_transfers(TaskArgs &args, int8_t dst_worker);
+
+    // Build one transfer task: replica malloc on the destination worker,
+    // slot-only alloc, fanin on `producer`, tensormap registration of the
+    // replica key. Returns the replica pointer.
+    uint64_t create_transfer(TaskSlot producer, const ContinuousTensor &t, int8_t src_worker, int8_t dst_worker);
+
+    // Find-or-create the queue (and its thread) for worker_id.
+    WorkerCopyQueue &copy_queue_for(int worker_id);
+    CopyToken enqueue_copy(int worker_id, bool to_device, uint64_t dst, uint64_t src, size_t size);
+    void copy_queue_loop(int worker_id, WorkerCopyQueue &q);
+    // Block until every queue is empty; rethrows the first stored error.
+    void wait_all_copies();
+
     // Slot state lives in the Ring; the pointer stays stable for the
     // slot's lifetime. Throws if the id is out of range — callers that
     // hold a recently-allocated slot id should always get a valid pointer.
     TaskSlotState &slot_state(TaskSlot s);
 
-    // Shared submit machinery. Takes `args_list` by value so the Orchestrator
-    // can patch `tensor.data` on OUTPUT tensors flagged for auto-allocation.
+    // --- Callable registry ---
+    // Flat table indexed by the dense ids register_callable() hands out.
+    // Entries are immutable after registration, so submit_registered()
+    // reads them without synchronization.
+    struct RegisteredCallable {
+        uint64_t callable{0};
+        ChipCallConfig config;
+    };
+    std::vector<RegisteredCallable> callable_registry_;
+    const RegisteredCallable &registered(int32_t id) const;
+
+    // --- Args arena (zero-copy submit) ---
+    // Chunked bump allocator backing ArenaArgs arrays. Grows on demand;
+    // drain() resets it back to one retained chunk. Orch-thread only.
+    static constexpr size_t ARGS_ARENA_CHUNK = 64u << 10;
+    std::vector<std::unique_ptr<uint8_t[]>> arena_chunks_;
+    size_t arena_chunk_used_ = 0;  // bytes used in the newest chunk
+    void *arena_alloc(size_t bytes, size_t align);
+    void arena_reset();
+
+    // Shared submit machinery, duck-typed over TaskArgs / ArenaArgs (both
+    // expose tensor_count/tensor/tag). Takes `args_list` by value so the
+    // Orchestrator can patch `tensor.data` on OUTPUT tensors flagged for
+    // auto-allocation; for ArenaArgs the elements are cheap pointer handles
+    // and the patch lands in the arena.
+    template <typename Args>
     SubmitResult submit_impl(
         WorkerType worker_type, uint64_t callable_ptr, int32_t callable_id, const ChipCallConfig &config,
-        std::vector<TaskArgs> args_list, std::vector<int8_t> affinities = {}
+        std::vector<Args> args_list, std::vector<int8_t> affinities = {}
     );
 
     // Size, in aligned bytes, an OUTPUT tensor should occupy in the HeapRing.
@@ -183,17 +564,75 @@ private:
     // consumed, and populates `slot` / `heap_ptr` / `heap_end_offset` via the
     // output params (reused for book-keeping on the slot state). Throws on
     // back-pressure timeout.
-    AllocResult reserve_outputs_and_slot(std::vector<TaskArgs> &args_list);
+    template <typename Args>
+    AllocResult reserve_outputs_and_slot(std::vector<Args> &args_list);
 
     // Walk the tags of each TaskArgs in `args_list`, accumulating producer
     // slots (for INPUT/INOUT tags) and registering outputs in the tensormap
     // (for OUTPUT/INOUT/OUTPUT_EXISTING tags). NO_DEP tags are skipped.
     // `affinities` maps args_list[i] → worker id for TensorKey construction.
+    //
+    // One tensormap query per unique key per submit: group submits repeat a
+    // handful of shared tensors across many entries, so the walk caches each
+    // key's producer (and whether this submit already registered it) in
+    // `batch_keys_` and wires all fanins from that table.
+    template <typename Args>
     void infer_deps(
-        TaskSlot slot, const std::vector<TaskArgs> &args_list, const std::vector<int8_t> &affinities,
+        TaskSlot slot, const std::vector<Args> &args_list, const std::vector<int8_t> &affinities,
         std::vector<TaskSlot> &producers, std::vector<TensorKey> &output_keys
     );
 
+    // Per-submit key cache for infer_deps. A member rather than a local so
+    // the bucket storage is reused across submits (cleared at the start of
+    // each inference pass, no steady-state allocation). Orch-thread only,
+    // like the rest of the submit machinery.
+    struct BatchKeyInfo {
+        TaskSlot producer{INVALID_SLOT};
+        bool looked_up{false};  // producer field is valid
+        bool inserted{false};   // this submit already registered the key
+    };
+    std::unordered_map<TensorKey, BatchKeyInfo, TensorKeyHash> batch_keys_;
+
+    // Producer-slot scratch for submit_impl — a member for the same reason
+    // as `batch_keys_`: cleared at each submit, capacity reused, so the
+    // steady-state submit path performs no heap allocation for dep
+    // inference.
+    std::vector<TaskSlot> producers_;
+
+    // Cheap handle over a template slot's stored TaskArgs so resubmit()
+    // can re-run infer_deps without copying argument vectors. Mirrors the
+    // tensor_count/tensor/tag surface the submit machinery duck-types on.
+    struct TaskArgsRef {
+        const TaskArgs *args;
+        int32_t tensor_count() const { return args->tensor_count(); }
+        const ContinuousTensor &tensor(int32_t i) const { return args->tensor(i); }
+        TensorArgType tag(int32_t i) const { return args->tag(i); }
+    };
+    std::vector<TaskArgsRef> resubmit_refs_;  // scratch, same reuse pattern as producers_
+
+    // --- Offline heap planning (begin_heap_capture / use_heap_plan) ---
+    // Capture sink: non-null while a capture is active. Planned mode: the
+    // copied plan, the carved region, the positional span cursor, and the
+    // region's synthetic slot (wired as a COMPLETED producer of every
+    // planned submit so the region outlives all of them). `plan_drew_`
+    // carries "this submit took planned spans" from reserve_outputs_and_slot
+    // to submit_impl's dep wiring. Orch-thread only.
+    HeapPlanner *heap_capture_ = nullptr;
+    HeapPlan heap_plan_;
+    bool heap_plan_active_ = false;
+    char *plan_base_ = nullptr;
+    size_t plan_cursor_ = 0;
+    TaskSlot plan_region_slot_{INVALID_SLOT};
+    bool plan_drew_ = false;
+
+    // Steps 5–6 of submit_impl, shared with resubmit(): attach this slot to
+    // each producer's fanout (returns the live-fanin count), then set the
+    // fanin/fanout counters, take the scope ref, and push READY or leave
+    // PENDING. `wire_fanins` reads the `producers_` scratch populated by the
+    // preceding infer_deps call.
+    int32_t wire_fanins(TaskSlot slot, TaskSlotState &s);
+    void finalize_submit(TaskSlot slot, TaskSlotState &s, int32_t live_fanins);
+
     // Release one fanout reference on 'slot'.
     // If all references are released → transition to CONSUMED.
     void release_ref(TaskSlot slot);
@@ -42,9 +42,13 @@ void Ring::init(uint64_t heap_bytes, uint32_t timeout_ms) {
     }
     shutdown_.store(false, std::memory_order_relaxed);
 
+    if (heap_bytes > RESERVE_TOP_MASK) {
+        throw std::invalid_argument("Ring: per-ring heap size exceeds the reserve-word total range");
+    }
+
     for (HeapRing &r : rings_) {
-        r.top = 0;
-        r.tail = 0;
+        r.reserve_word.store(0, std::memory_order_relaxed);
+        r.tail_total.store(0, std::memory_order_relaxed);
         r.last_alive = 0;
         r.released.clear();
         r.slot_heap_end.clear();
@@ -74,48 +78,61 @@ void Ring::init(uint64_t heap_bytes, uint32_t timeout_ms) {
 }
 
 // ---------------------------------------------------------------------------
-// alloc — picks a ring by scope depth, reserves slot + heap slab
+// alloc — picks a ring (installed policy, else scope depth), reserves
+// slot + heap slab
 // ---------------------------------------------------------------------------
 
 AllocResult Ring::alloc(uint64_t bytes, int32_t scope_depth) {
-    int32_t ring_idx = ring_idx_for_scope(scope_depth);
+    uint64_t aligned = bytes > 0 ? align_up(bytes, HEAP_ALIGN) : 0;
+    int32_t ring_idx = ring_policy_ ? ring_policy_(scope_depth, aligned) : ring_idx_for_scope(scope_depth);
+    if (ring_idx < 0 || ring_idx >= MAX_RING_DEPTH) {
+        throw std::runtime_error("Ring: ring policy returned an out-of-range ring index");
+    }
     HeapRing &ring = rings_[static_cast<size_t>(ring_idx)];
 
     if (bytes > 0 && ring.size == 0) {
         throw std::runtime_error("Ring: heap disabled (heap_bytes=0) but alloc(bytes>0) requested");
     }
-    uint64_t aligned = bytes > 0 ? align_up(bytes, HEAP_ALIGN) : 0;
     if (aligned > ring.size) {
         throw std::runtime_error("Ring: requested allocation exceeds per-ring heap size");
     }
 
-    // --- Phase 1: wait for heap space + reserve in-ring bookkeeping ---
-    // Holds only the target ring's mu. Back-pressure on ring A cannot block
-    // alloc calls targeting a different ring, and it cannot block readers of
-    // `slots_mu_` (`slot_state`, `next_task_id`, or `release` on a slot that
-    // already exists in another ring).
+    // --- Phase 1a: reserve a span (lock-free fast path) ---
+    // One CAS on the ring's reserve word claims the heap range AND the
+    // in-ring FIFO position together, so concurrent allocs on the same ring
+    // get span indices in heap address order without holding any lock.
     void *heap_ptr = nullptr;
     uint64_t heap_end = 0;
     int32_t ring_slot_idx = 0;
-    {
+    if (shutdown_.load(std::memory_order_acquire)) {
+        return AllocResult{INVALID_SLOT, nullptr, 0, ring_idx};
+    }
+    // Draw from any scope reserve-ahead credit first; the covered portion is
+    // exempt from the free-space check, so a fully covered non-wrapping
+    // alloc cannot take the slow path.
+    uint64_t covered = aligned > 0 ? draw_credit(ring, aligned) : 0;
+    if (!try_reserve_span(ring, aligned, covered, heap_ptr, heap_end, ring_slot_idx)) {
+        // Heap full on THIS ring — slow path. Takes the ring's mu only to
+        // wait; the reserve itself stays a CAS so it composes with fast-path
+        // racers that never take the lock. Back-pressure on ring A cannot
+        // block alloc calls targeting a different ring, and it cannot block
+        // readers of `slots_mu_` (`slot_state`, `next_task_id`, or `release`
+        // on a slot that already exists in another ring).
         std::unique_lock<std::mutex> rlk(ring.mu);
         auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms_);
 
         while (true) {
             if (shutdown_.load(std::memory_order_acquire)) {
+                if (covered > 0) ring.reserved_credit.fetch_add(covered, std::memory_order_acq_rel);
                 return AllocResult{INVALID_SLOT, nullptr, 0, ring_idx};
             }
-            if (aligned == 0) {
-                heap_ptr = nullptr;
-                heap_end = ring.top;
-                break;
-            }
-            if (try_bump_ring_heap_locked(ring, aligned, heap_ptr, heap_end)) {
+            if (try_reserve_span(ring, aligned, covered, heap_ptr, heap_end, ring_slot_idx)) {
                 break;
             }
-            // Heap full on THIS ring. Wait for a release on this ring (other
-            // rings stay usable) or a shutdown.
+            // Wait for a release on this ring (other rings stay usable) or a
+            // shutdown.
             if (ring.cv.wait_until(rlk, deadline) == std::cv_status::timeout) {
+                if (covered > 0) ring.reserved_credit.fetch_add(covered, std::memory_order_acq_rel);
                 if (shutdown_.load(std::memory_order_acquire)) {
                     return AllocResult{INVALID_SLOT, nullptr, 0, ring_idx};
                 }
@@ -125,12 +142,21 @@ AllocResult Ring::alloc(uint64_t bytes, int32_t scope_depth) {
                 );
             }
         }
+    }
 
-        // Capture the in-ring FIFO position BEFORE releasing ring.mu so
-        // concurrent allocs on the same ring get strictly ordered positions.
-        ring_slot_idx = static_cast<int32_t>(ring.released.size());
-        ring.released.push_back(0);
-        ring.slot_heap_end.push_back(heap_end);
+    // --- Phase 1b: publish the span's end for the reclaimer ---
+    // Brief ring.mu critical section. Spans can publish out of order when
+    // fast-path racers interleave; the resize leaves zero placeholders for
+    // earlier still-unpublished spans, which the release-side walk treats as
+    // live (released[i] == 0) until their own publish + release happen.
+    {
+        std::lock_guard<std::mutex> rlk(ring.mu);
+        size_t needed = static_cast<size_t>(ring_slot_idx) + 1;
+        if (ring.released.size() < needed) {
+            ring.released.resize(needed, 0);
+            ring.slot_heap_end.resize(needed, 0);
+        }
+        ring.slot_heap_end[static_cast<size_t>(ring_slot_idx)] = heap_end;
     }
 
     // --- Phase 2: assign a global task id and park the slot state ---
@@ -143,12 +169,105 @@ AllocResult Ring::alloc(uint64_t bytes, int32_t scope_depth) {
         task_id = next_task_id_++;
         slot_states_.emplace_back(std::make_unique<TaskSlotState>());
         auto *s = slot_states_.back().get();
+        s->self = task_id;
         s->ring_idx = ring_idx;
         s->ring_slot_idx = ring_slot_idx;
     }
     return AllocResult{task_id, heap_ptr, heap_end, ring_idx};
 }
 
+// ---------------------------------------------------------------------------
+// Scope reserve-ahead — park the space up front so in-scope allocs are
+// guaranteed bumps
+// ---------------------------------------------------------------------------
+
+void Ring::scope_reserve(int32_t scope_depth, int32_t task_slots, uint64_t heap_bytes) {
+    int32_t ring_idx = ring_idx_for_scope(scope_depth);
+    HeapRing &ring = rings_[static_cast<size_t>(ring_idx)];
+
+    uint64_t aligned = heap_bytes > 0 ? align_up(heap_bytes, HEAP_ALIGN) : 0;
+    if (aligned > 0 && ring.size == 0) {
+        throw std::runtime_error("Ring: heap disabled (heap_bytes=0) but scope_reserve requested bytes");
+    }
+    if (aligned > ring.size) {
+        throw std::runtime_error("Ring: scope reservation exceeds per-ring heap size");
+    }
+
+    std::unique_lock<std::mutex> rlk(ring.mu);
+    if (ring.reserve_active) {
+        throw std::logic_error("Ring: scope_reserve while this ring already holds a reservation");
+    }
+
+    if (aligned > 0) {
+        // The one back-pressure wait the scope pays — everything covered by
+        // the credit afterwards is stall-free.
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms_);
+        while (true) {
+            if (shutdown_.load(std::memory_order_acquire)) {
+                return;
+            }
+            uint64_t top = ring.reserve_word.load(std::memory_order_acquire) & RESERVE_TOP_MASK;
+            uint64_t tail = ring.tail_total.load(std::memory_order_acquire);
+            uint64_t claimed = (top - tail) + ring.reserved_credit.load(std::memory_order_acquire);
+            if (claimed + aligned <= ring.size) {
+                break;
+            }
+            if (ring.cv.wait_until(rlk, deadline) == std::cv_status::timeout) {
+                if (shutdown_.load(std::memory_order_acquire)) {
+                    return;
+                }
+                throw std::runtime_error(
+                    "Ring: scope_reserve timed out waiting for heap space. "
+                    "Increase heap_ring_size on Worker."
+                );
+            }
+        }
+        ring.reserved_credit.fetch_add(aligned, std::memory_order_acq_rel);
+    }
+    ring.reserve_active = true;
+
+    // Pre-grow the FIFO vectors so in-scope publishes never reallocate.
+    if (task_slots > 0) {
+        size_t want = ring.released.size() + static_cast<size_t>(task_slots);
+        ring.released.reserve(want);
+        ring.slot_heap_end.reserve(want);
+    }
+}
+
+uint64_t Ring::scope_unreserve(int32_t scope_depth) {
+    int32_t ring_idx = ring_idx_for_scope(scope_depth);
+    HeapRing &ring = rings_[static_cast<size_t>(ring_idx)];
+    uint64_t leftover;
+    {
+        std::lock_guard<std::mutex> rlk(ring.mu);
+        leftover = ring.reserved_credit.exchange(0, std::memory_order_acq_rel);
+        ring.reserve_active = false;
+    }
+    // Returned bytes are free space again — wake anyone waiting behind the
+    // credit.
+    if (leftover > 0) {
+        ring.cv.notify_all();
+    }
+    return leftover;
+}
+
+uint64_t Ring::reserved_bytes(int32_t ring_idx) const {
+    return ring_at(ring_idx).reserved_credit.load(std::memory_order_acquire);
+}
+
+uint64_t Ring::draw_credit(HeapRing &ring, uint64_t want) {
+    uint64_t cur = ring.reserved_credit.load(std::memory_order_acquire);
+    while (cur > 0) {
+        uint64_t take = want < cur ? want : cur;
+        if (ring.reserved_credit.compare_exchange_weak(
+                cur, cur - take, std::memory_order_acq_rel, std::memory_order_acquire
+            )) {
+            return take;
+        }
+    }
+    return 0;
+}
+
 // ---------------------------------------------------------------------------
 // release — mark consumed in the slot's own ring and FIFO-advance that ring
 // ---------------------------------------------------------------------------
@@ -214,8 +333,10 @@ void Ring::reset_to_empty() {
     // (active_count() == 0 was the drain precondition).
     for (HeapRing &r : rings_) {
         std::lock_guard<std::mutex> rlk(r.mu);
-        r.top = 0;
-        r.tail = 0;
+        r.reserve_word.store(0, std::memory_order_relaxed);
+        r.tail_total.store(0, std::memory_order_relaxed);
+        r.reserved_credit.store(0, std::memory_order_relaxed);
+        r.reserve_active = false;
         r.last_alive = 0;
         r.released.clear();
         r.slot_heap_end.clear();
@@ -264,14 +385,50 @@ uint64_t Ring::heap_size(int32_t ring_idx) const { return ring_at(ring_idx).size
 
 uint64_t Ring::heap_top(int32_t ring_idx) const {
     const HeapRing &r = ring_at(ring_idx);
-    std::lock_guard<std::mutex> rlk(r.mu);
-    return r.top;
+    uint64_t total = r.reserve_word.load(std::memory_order_acquire) & RESERVE_TOP_MASK;
+    return r.size > 0 ? total % r.size : total;
 }
 
 uint64_t Ring::heap_tail(int32_t ring_idx) const {
     const HeapRing &r = ring_at(ring_idx);
-    std::lock_guard<std::mutex> rlk(r.mu);
-    return r.tail;
+    uint64_t total = r.tail_total.load(std::memory_order_acquire);
+    return r.size > 0 ? total % r.size : total;
+}
+
+uint64_t Ring::heap_in_use(int32_t ring_idx) const {
+    const HeapRing &r = ring_at(ring_idx);
+    // Both totals are monotonic, so the difference is exact modulo benign
+    // staleness: a lagging tail read can only over-report usage, which at
+    // worst steers a policy toward an emptier ring.
+    uint64_t top = r.reserve_word.load(std::memory_order_acquire) & RESERVE_TOP_MASK;
+    uint64_t tail = r.tail_total.load(std::memory_order_acquire);
+    return top - tail;
+}
+
+RingSelectFn Ring::balanced_policy(const Ring *ring) {
+    auto rr = std::make_shared<std::atomic<uint32_t>>(0);
+    return [ring, rr](int32_t /*scope_depth*/, uint64_t aligned_bytes) -> int32_t {
+        int32_t start = static_cast<int32_t>(rr->fetch_add(1, std::memory_order_relaxed)) % MAX_RING_DEPTH;
+        int32_t best = -1;
+        int32_t best_fit = -1;
+        uint64_t best_use = 0;
+        uint64_t best_fit_use = 0;
+        for (int32_t i = 0; i < MAX_RING_DEPTH; i++) {
+            int32_t idx = (start + i) % MAX_RING_DEPTH;
+            uint64_t in_use = ring->heap_in_use(idx);
+            if (best < 0 || in_use < best_use) {
+                best = idx;
+                best_use = in_use;
+            }
+            if (in_use + aligned_bytes <= ring->heap_size(idx) && (best_fit < 0 || in_use < best_fit_use)) {
+                best_fit = idx;
+                best_fit_use = in_use;
+            }
+        }
+        // Every ring too full to fit without waiting → the least-occupied
+        // one absorbs the back-pressure wait.
+        return best_fit >= 0 ? best_fit : best;
+    };
 }
 
 void Ring::shutdown() {
@@ -282,43 +439,64 @@ void Ring::shutdown() {
 }
 
 // ---------------------------------------------------------------------------
-// Internal helpers — all called under the respective ring's mu
+// Internal helpers — try_reserve_span is lock-free; advance_last_alive_locked
+// runs under the respective ring's mu
 // ---------------------------------------------------------------------------
 
-bool Ring::try_bump_ring_heap_locked(HeapRing &r, uint64_t aligned, void *&out_ptr, uint64_t &out_end) {
-    uint64_t top = r.top;
-    uint64_t tail = r.tail;
-
-    // Case 1: heap fully live forward (top >= tail). Space either after top
-    // to the end of the region, or (after wrap) from 0 to tail-1.
-    if (top >= tail) {
-        uint64_t at_end = r.size - top;
-        if (at_end >= aligned) {
-            out_ptr = static_cast<char *>(r.base) + top;
-            r.top = top + aligned;
-            out_end = r.top;
-            return true;
+bool Ring::try_reserve_span(
+    HeapRing &r, uint64_t aligned, uint64_t covered, void *&out_ptr, uint64_t &out_end, int32_t &out_ring_slot_idx
+) {
+    uint64_t word = r.reserve_word.load(std::memory_order_acquire);
+    while (true) {
+        uint64_t top_total = word & RESERVE_TOP_MASK;
+        uint64_t span_idx = word >> RESERVE_TOP_BITS;
+        if (span_idx >= RESERVE_MAX_SPANS) {
+            throw std::runtime_error("Ring: per-ring span count overflow — was reset_to_empty() skipped?");
         }
-        // Wrap only when there is real space at the start. Must be strictly >,
-        // not ==: leaving a single byte gap prevents top==tail being ambiguous
-        // between "full" and "empty".
-        if (tail > aligned) {
-            out_ptr = r.base;
-            r.top = aligned;
-            out_end = r.top;
-            return true;
+
+        uint64_t need = 0;
+        uint64_t start_offset = 0;
+        if (aligned > 0) {
+            // Monotonic-total arithmetic sidesteps the classic wrapped-vs-not
+            // classification race: the totals never wrap, so bytes in use is
+            // a plain subtraction. A stale tail_total only under-reports free
+            // space (tail_total is monotonic), so a reservation that passes
+            // this check can never overlap a live span.
+            uint64_t tail_total = r.tail_total.load(std::memory_order_acquire);
+            start_offset = top_total % r.size;
+            uint64_t at_end = r.size - start_offset;
+            need = aligned;
+            if (at_end < aligned) {
+                // Wrap: the unusable end-of-region remainder is charged to
+                // this span, so releasing it jumps the tail past the skip.
+                need = at_end + aligned;
+                start_offset = 0;
+            }
+            // The covered portion was paid for by scope_reserve; only the
+            // uncovered remainder (plus any wrap skip) competes for free
+            // space, and it must also leave outstanding credit untouched.
+            uint64_t demand = need - covered;
+            if (demand > 0) {
+                uint64_t claimed = (top_total - tail_total) + r.reserved_credit.load(std::memory_order_acquire);
+                if (claimed + demand > r.size) {
+                    return false;
+                }
+            }
         }
-        return false;
-    }
 
-    // Case 2: wrapped (top < tail). Allocate in the gap only.
-    if (tail - top > aligned) {
-        out_ptr = static_cast<char *>(r.base) + top;
-        r.top = top + aligned;
-        out_end = r.top;
-        return true;
+        uint64_t new_total = top_total + need;
+        if (new_total > RESERVE_TOP_MASK) {
+            throw std::runtime_error("Ring: per-ring bump total overflow — was reset_to_empty() skipped?");
+        }
+        uint64_t new_word = ((span_idx + 1) << RESERVE_TOP_BITS) | new_total;
+        if (r.reserve_word.compare_exchange_weak(word, new_word, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            out_ptr = aligned > 0 ? static_cast<char *>(r.base) + start_offset : nullptr;
+            out_end = new_total;
+            out_ring_slot_idx = static_cast<int32_t>(span_idx);
+            return true;
+        }
+        // CAS failure reloaded `word`; recompute against the fresh cursor.
     }
-    return false;
 }
 
 void Ring::advance_last_alive_locked(HeapRing &r) {
@@ -328,7 +506,7 @@ void Ring::advance_last_alive_locked(HeapRing &r) {
     // invalidate pointers that other threads may still hold.
     while (r.last_alive < static_cast<int32_t>(r.released.size()) &&
            r.released[static_cast<size_t>(r.last_alive)] == 1) {
-        r.tail = r.slot_heap_end[static_cast<size_t>(r.last_alive)];
+        r.tail_total.store(r.slot_heap_end[static_cast<size_t>(r.last_alive)], std::memory_order_release);
         r.last_alive++;
     }
 }
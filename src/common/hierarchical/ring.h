@@ -21,11 +21,12 @@
  *      L2 Consistency Audit, allowed exception #6).
  *   2. `MAX_RING_DEPTH` independent shared-memory heap slabs (Strict-1,
  *      matches L2's `PTO2_MAX_RING_DEPTH = 4`). Each slab has its own
- *      `mmap(MAP_SHARED)` region, bump cursor, FIFO reclamation pointer,
- *      mutex and cv. Slot → ring mapping is driven by scope depth:
+ *      `mmap(MAP_SHARED)` region, lock-free bump cursor, FIFO reclamation
+ *      pointer, mutex and cv. Slot → ring mapping defaults to scope depth:
  *         ring_idx = min(scope_depth, MAX_RING_DEPTH - 1)
  *      so tasks inside nested scopes reclaim independently of the outer
- *      scope's long-lived allocations. A mapping taken before any fork is
+ *      scope's long-lived allocations. `set_ring_policy` swaps in a
+ *      different selection (occupancy balancing, topology steering). A mapping taken before any fork is
  *      inherited by every child process at the same virtual address.
  *   3. The per-task scheduling state (`TaskSlotState`). Stored in a
  *      `std::deque<std::unique_ptr<...>>` so push_back never invalidates
@@ -33,10 +34,21 @@
  *      process teardown. Slot state records its `ring_idx` and
  *      `ring_slot_idx` so `release(slot)` knows which ring to advance.
  *
- * Back-pressure: only the heap can be full, and per-ring. `alloc(bytes,
- * scope_depth)` picks a ring, spin-waits on that ring's cv; if no progress
- * is made for `timeout_ms` it throws `std::runtime_error`. Other rings
- * remain usable while one ring is full.
+ * Concurrency: `alloc()` is reserve-then-publish. The hot path reserves a
+ * span with a single CAS on the ring's packed `reserve_word` — monotonic
+ * bump total in the low bits, in-ring span index in the high bits, claimed
+ * together so FIFO index order always matches heap address order — and then
+ * publishes the span's end under a brief `ring.mu` critical section. Byte
+ * totals are monotonic (never reduced modulo the ring size) so free-space
+ * math is a plain subtraction against the reclaimer's `tail_total`; a stale
+ * tail read can only under-report free space, never hand out live bytes.
+ * `ring.mu` is kept for the slow path (ring full → cv wait), the publish
+ * step, and the release-side FIFO walk.
+ *
+ * Back-pressure: only the heap can be full, and per-ring. When the CAS
+ * reserve fails, `alloc(bytes, scope_depth)` falls back to waiting on that
+ * ring's cv; if no progress is made for `timeout_ms` it throws
+ * `std::runtime_error`. Other rings remain usable while one ring is full.
  *
  * Lifecycle:
  *
@@ -56,6 +68,7 @@
 #include <condition_variable>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -86,10 +99,19 @@ inline int32_t ring_idx_for_scope(int32_t scope_depth) {
 struct AllocResult {
     TaskSlot slot{INVALID_SLOT};
     void *heap_ptr{nullptr};
-    uint64_t heap_end_offset{0};  // byte offset within the selected ring's heap
+    uint64_t heap_end_offset{0};  // ring's monotonic bump total at this span's end
     int32_t ring_idx{0};
 };
 
+// Pluggable ring-selection policy. Called once per alloc with the submitting
+// scope depth and the HEAP_ALIGN-rounded span size; returns the ring index to
+// carve from (must be in [0, MAX_RING_DEPTH)). Policies that capture topology
+// knowledge (e.g. which mmap slab is local to the worker expected to consume
+// the output) can steer placement; `Ring::balanced_policy` is the built-in
+// occupancy balancer. When no policy is installed, the scope-depth mapping
+// (`ring_idx_for_scope`) applies.
+using RingSelectFn = std::function<int32_t(int32_t scope_depth, uint64_t aligned_bytes)>;
+
 class Ring {
 public:
     Ring() = default;
@@ -112,12 +134,57 @@ public:
     // slot's `ring_idx` / `ring_slot_idx` are stamped into the slot state
     // before this call returns.
     //
-    // Blocks on the selected ring's cv; throws `std::runtime_error` on
+    // The common case is wait-free: one CAS on the ring's reserve word plus
+    // a short publish under `ring.mu`. Only when the ring is full does the
+    // call block on that ring's cv; it throws `std::runtime_error` on
     // timeout. Returns the sentinel `{INVALID_SLOT, nullptr, 0, 0}` on
     // `shutdown()`. `bytes` is rounded up to `HEAP_ALIGN`. Passing `0`
     // skips the heap bump entirely (slot-only allocation).
     AllocResult alloc(uint64_t bytes = 0, int32_t scope_depth = 0);
 
+    // Reserve-ahead for a scope whose task count and output bytes are known
+    // at entry (generated code typically knows both). Waits — with the same
+    // back-pressure/cv/timeout discipline as alloc — until the scope's ring
+    // (`ring_idx_for_scope(scope_depth)`) has `heap_bytes` free beyond any
+    // outstanding credit, then parks that amount as a reservation credit and
+    // pre-grows the ring's FIFO vectors by `task_slots` entries. Subsequent
+    // allocs on the ring draw from the credit first, and a fully covered,
+    // non-wrapping alloc skips the free-space check entirely — a guaranteed
+    // bump with no stall (a span that wraps the region end still pays the
+    // skip bytes through the normal check). `heap_bytes` should be the sum
+    // of the per-task sizes each rounded up to HEAP_ALIGN, since every span
+    // is carved at that granularity.
+    //
+    // One reservation per ring: a second scope_reserve on the same ring
+    // (e.g. two reserved scopes nested beyond MAX_RING_DEPTH - 1) throws
+    // std::logic_error. Reservations assume the default scope-depth mapping;
+    // a custom ring policy that routes allocs elsewhere will simply not draw
+    // the credit.
+    void scope_reserve(int32_t scope_depth, int32_t task_slots, uint64_t heap_bytes);
+
+    // Hand back whatever remains of the scope's reservation (over-reserved
+    // bytes return cleanly to the ring) and wake waiters that were blocked
+    // behind the credit. Returns the number of bytes handed back.
+    uint64_t scope_unreserve(int32_t scope_depth);
+
+    // Outstanding reservation credit on a ring (tests + tooling).
+    uint64_t reserved_bytes(int32_t ring_idx) const;
+
+    // Install a ring-selection policy (empty resets to the scope-depth
+    // default). The policy is read un-synchronized on the alloc path, so it
+    // must be installed before the first alloc of a run. Note the trade-off:
+    // routing away from the scope-depth mapping gives up the per-scope
+    // reclamation isolation described above — a long-lived span can then
+    // delay FIFO reclamation of short-lived spans sharing its ring.
+    void set_ring_policy(RingSelectFn policy) { ring_policy_ = std::move(policy); }
+
+    // Built-in occupancy-balancing policy: least-occupied ring wins, the scan
+    // start rotates round-robin so equally empty rings interleave, and rings
+    // that cannot fit the span without waiting are skipped unless every ring
+    // is that full (then the least-occupied one takes the back-pressure
+    // wait). `ring` must outlive the returned closure.
+    static RingSelectFn balanced_policy(const Ring *ring);
+
     // Release a slot. Reads the slot's `ring_idx` / `ring_slot_idx` to find
     // its ring, marks the slot consumed, and advances that ring's
     // `last_alive_` (and `heap_tail`) as far as FIFO order allows. Other
@@ -137,12 +204,17 @@ public:
     int32_t active_count() const;
     int32_t next_task_id() const;
 
-    // Per-ring introspection (tests + tooling).
+    // Per-ring introspection (tests + tooling). `heap_top` / `heap_tail`
+    // report in-region byte offsets derived from the monotonic totals.
     void *heap_base(int32_t ring_idx) const;
     uint64_t heap_size(int32_t ring_idx) const;
     uint64_t heap_top(int32_t ring_idx) const;
     uint64_t heap_tail(int32_t ring_idx) const;
 
+    // Bytes currently reserved in a ring (monotonic bump total minus the
+    // reclaimer's tail total). Lock-free; drives occupancy-based policies.
+    uint64_t heap_in_use(int32_t ring_idx) const;
+
     void shutdown();
 
 private:
@@ -153,14 +225,40 @@ private:
         // mmap region
         void *base{nullptr};
         uint64_t size{0};
-        uint64_t top{0};   // next free byte (bump head, can wrap)
-        uint64_t tail{0};  // oldest live byte (derived from last_alive_)
         bool mapped{false};
 
+        // Packed reservation word, the lock-free bump cursor:
+        //   [63:RESERVE_TOP_BITS]  next ring_slot_idx (in-ring span count)
+        //   [RESERVE_TOP_BITS-1:0] monotonic bump total in bytes
+        // Both halves advance together in one CAS so a span's FIFO index
+        // order always matches its heap address order. The total is never
+        // wrapped — `total % size` gives the in-region offset, and
+        // `total - tail_total` gives bytes in use (skipped end-of-region
+        // remainders are charged to the span that wrapped).
+        std::atomic<uint64_t> reserve_word{0};
+
+        // Monotonic reclamation total (mirrors reserve_word's bump total).
+        // Advanced only by the release-side FIFO walk under `mu`; read
+        // lock-free by reservers.
+        std::atomic<uint64_t> tail_total{0};
+
+        // Scope reserve-ahead credit in bytes. Added by scope_reserve after
+        // waiting for the space, drawn down lock-free by allocs on this
+        // ring, and zeroed by scope_unreserve. Uncovered allocs treat the
+        // credit as already-claimed space so reserved bytes can never be
+        // handed out twice. `reserve_active` (guarded by `mu`) distinguishes
+        // a fully drawn reservation from no reservation at all.
+        std::atomic<uint64_t> reserved_credit{0};
+        bool reserve_active{false};
+
         // Per-ring FIFO ordering — vectors are indexed by a slot's
-        // ring_slot_idx (the order it was allocated into this ring).
+        // ring_slot_idx (the order it was allocated into this ring). Grown
+        // under `mu` at publish time; a reserver that publishes out of order
+        // leaves zero placeholders for earlier still-unpublished spans — the
+        // reclaimer never reads `slot_heap_end[i]` until `released[i] == 1`,
+        // which can only happen after span i's own publish.
         std::vector<uint8_t> released;        // 0 = live, 1 = consumed
-        std::vector<uint64_t> slot_heap_end;  // byte-offset high-water within this ring
+        std::vector<uint64_t> slot_heap_end;  // monotonic bump total at span end
         int32_t last_alive{0};                // FIFO frontier over released/slot_heap_end
 
         mutable std::mutex mu;
@@ -173,6 +271,10 @@ private:
 
     uint32_t timeout_ms_{ALLOC_TIMEOUT_MS};
 
+    // Optional ring-selection override (empty = scope-depth mapping). Read
+    // without synchronization by `alloc`; install before the first alloc.
+    RingSelectFn ring_policy_;
+
     // Monotonic across all rings within a run. Reset to 0 by `reset_to_empty`.
     int32_t next_task_id_{0};
 
@@ -194,11 +296,29 @@ private:
     // without holding that ring's mu_).
     std::atomic<bool> shutdown_{false};
 
-    // Helpers — `try_bump_ring_heap_locked` runs under `ring.mu`;
+    // reserve_word layout: low RESERVE_TOP_BITS = monotonic bump total,
+    // high bits = in-ring span count. 40 bits of total caps cumulative
+    // allocation per ring per run at 1 TiB; 24 bits of count caps spans per
+    // ring per run at ~16.7M. Both reset at `reset_to_empty()`; overflow of
+    // either throws rather than wrapping silently.
+    static constexpr unsigned RESERVE_TOP_BITS = 40;
+    static constexpr uint64_t RESERVE_TOP_MASK = (1ULL << RESERVE_TOP_BITS) - 1;
+    static constexpr uint64_t RESERVE_MAX_SPANS = (1ULL << (64 - RESERVE_TOP_BITS)) - 1;
+
+    // Helpers — `try_reserve_span` is lock-free (safe with or without
+    // `ring.mu`; the slow path calls it while holding the lock);
     // `advance_last_alive_locked` runs under `ring.mu`.
-    bool try_bump_ring_heap_locked(HeapRing &ring, uint64_t aligned_bytes, void *&out_ptr, uint64_t &out_end);
+    // `covered` is the portion of `aligned_bytes` already drawn from the
+    // ring's reservation credit — it is exempt from the free-space check.
+    bool try_reserve_span(
+        HeapRing &ring, uint64_t aligned_bytes, uint64_t covered, void *&out_ptr, uint64_t &out_end,
+        int32_t &out_ring_slot_idx
+    );
     void advance_last_alive_locked(HeapRing &ring);
 
+    // Draw up to `want` bytes from the ring's reservation credit (lock-free).
+    static uint64_t draw_credit(HeapRing &ring, uint64_t want);
+
     // Ring-index validation for the public introspection accessors.
     const HeapRing &ring_at(int32_t ring_idx) const;
 };
@@ -30,6 +30,8 @@ void Scheduler::start(const Config &cfg) {
         cfg.manager == nullptr)
         throw std::invalid_argument("Scheduler::start: null config fields");
     cfg_ = cfg;
+    direct_next_level_ = cfg.manager->single_worker(WorkerType::NEXT_LEVEL);
+    direct_sub_ = cfg.manager->single_worker(WorkerType::SUB);
 
     stop_requested_.store(false, std::memory_order_relaxed);
     running_.store(true, std::memory_order_release);
@@ -52,18 +54,29 @@ void Scheduler::stop() {
 // WorkerThread completion callback (called from WorkerThread via Manager)
 // =============================================================================
 
+// Group aggregation: one run() finishes per group member, but the task
+// completes only when the LAST member reports. Returns true for non-group
+// tasks and for the final member of a group. Safe from any thread — each
+// member event is counted exactly once.
+bool Scheduler::last_group_member(TaskSlotState &s) {
+    if (!s.is_group()) return true;
+    int32_t done = s.sub_complete_count.fetch_add(1, std::memory_order_acq_rel) + 1;
+    return done >= s.group_size();
+}
+
 void Scheduler::worker_done(TaskSlot slot) {
     TaskSlotState &s = *cfg_.ring->slot_state(slot);
-
-    // Group aggregation: only push to completion queue when ALL workers done
-    if (s.is_group()) {
-        int32_t done = s.sub_complete_count.fetch_add(1, std::memory_order_acq_rel) + 1;
-        if (done < s.group_size()) return;
-    }
+    if (!last_group_member(s)) return;
 
     {
         std::lock_guard<std::mutex> lk(completion_mu_);
-        completion_queue_.push(slot);
+        s.queue_next = nullptr;
+        if (completion_tail_) {
+            completion_tail_->queue_next = &s;
+        } else {
+            completion_head_ = &s;
+        }
+        completion_tail_ = &s;
     }
     completion_cv_.notify_one();
 }
@@ -78,21 +91,13 @@ void Scheduler::run() {
         {
             std::unique_lock<std::mutex> lk(completion_mu_);
             completion_cv_.wait_for(lk, std::chrono::milliseconds(1), [this] {
-                return !completion_queue_.empty() || stop_requested_.load(std::memory_order_acquire);
+                return completion_head_ != nullptr || cfg_.manager->completions_pending() ||
+                       stop_requested_.load(std::memory_order_acquire);
             });
         }
 
-        // Phase 1: drain completions
-        while (true) {
-            TaskSlot slot;
-            {
-                std::lock_guard<std::mutex> lk(completion_mu_);
-                if (completion_queue_.empty()) break;
-                slot = completion_queue_.front();
-                completion_queue_.pop();
-            }
-            on_task_complete(slot);
-        }
+        // Phase 1: drain completions in one batch
+        drain_completions();
 
         // Phase 2: dispatch ready tasks
         dispatch_ready();
@@ -101,16 +106,7 @@ void Scheduler::run() {
         if (stop_requested_.load(std::memory_order_acquire)) {
             if (!cfg_.manager->any_busy()) {
                 // Final drain
-                while (true) {
-                    TaskSlot slot;
-                    {
-                        std::lock_guard<std::mutex> lk(completion_mu_);
-                        if (completion_queue_.empty()) break;
-                        slot = completion_queue_.front();
-                        completion_queue_.pop();
-                    }
-                    on_task_complete(slot);
-                }
+                drain_completions();
                 dispatch_ready();
                 break;
             }
@@ -118,6 +114,35 @@ void Scheduler::run() {
     }
 }
 
+// Batch-drain all pending completions: every per-worker SPSC ring first,
+// then the fallback queue under a single lock acquisition. Ring entries are
+// raw per-run events, so group aggregation happens here; fallback-queue
+// entries were already aggregated in worker_done().
+void Scheduler::drain_completions() {
+    completion_batch_.clear();
+    cfg_.manager->drain_completions(completion_batch_);
+    for (TaskSlot slot : completion_batch_) {
+        if (!last_group_member(*cfg_.ring->slot_state(slot))) continue;
+        on_task_complete(slot);
+    }
+
+    TaskSlotState *pending;
+    {
+        std::lock_guard<std::mutex> lk(completion_mu_);
+        pending = completion_head_;
+        completion_head_ = nullptr;
+        completion_tail_ = nullptr;
+    }
+    while (pending) {
+        // Read the link before on_task_complete: the slot may be consumed
+        // (and its state recycled into another queue) by the time it returns.
+        TaskSlotState *next = pending->queue_next;
+        pending->queue_next = nullptr;
+        on_task_complete(pending->self);
+        pending = next;
+    }
+}
+
 // =============================================================================
 // on_task_complete / try_consume
 // =============================================================================
@@ -126,6 +151,8 @@ void Scheduler::on_task_complete(TaskSlot slot) {
     TaskSlotState &s = *cfg_.ring->slot_state(slot);
     s.state.store(TaskState::COMPLETED, std::memory_order_release);
 
+    if (cfg_.on_completed_cb) cfg_.on_completed_cb(slot);
+
     // Release fanin on downstream consumers
     std::vector<TaskSlot> consumers;
     {
@@ -138,11 +165,39 @@ void Scheduler::on_task_complete(TaskSlot slot) {
         if (released >= cs.fanin_count) {
             TaskState expected = TaskState::PENDING;
             if (cs.state.compare_exchange_strong(expected, TaskState::READY, std::memory_order_acq_rel)) {
+                // Transfer tasks bypass the ready queues — there is no
+                // callable to dispatch. Hand them to the Orchestrator's
+                // copy machinery; it reports back through worker_done().
+                if (cs.transfer) {
+                    if (cfg_.on_transfer_ready_cb) cfg_.on_transfer_ready_cb(consumer);
+                    continue;
+                }
+                // Single-child pass-through: with one worker in the pool
+                // there is nothing to pick — queue the consumer on that
+                // worker directly (FIFO like dispatch_ready) and skip the
+                // ready-queue round trip.
+                WorkerThread *direct =
+                    (cs.worker_type == WorkerType::NEXT_LEVEL) ? direct_next_level_ : direct_sub_;
+                if (direct && direct_dispatch_eligible(cs)) {
+                    cs.ran_on = static_cast<int8_t>(direct->logical_id());
+                    cs.state.store(TaskState::RUNNING, std::memory_order_release);
+                    WorkerDispatch d;
+                    d.task_slot = consumer;
+                    d.group_index = 0;
+                    direct->dispatch(d);
+                    continue;
+                }
+                // Locality hint: steer the consumer toward the worker that
+                // produced its last-arriving input (soft — dispatch
+                // overrides it under load skew).
+                if (cs.worker_type == s.worker_type && cs.preferred_worker.load(std::memory_order_relaxed) < 0) {
+                    cs.preferred_worker.store(s.ran_on, std::memory_order_relaxed);
+                }
                 // Strict-4: route the freshly-ready consumer to the queue
                 // matching its own worker type.
                 auto *q =
                     (cs.worker_type == WorkerType::NEXT_LEVEL) ? cfg_.ready_next_level_queue : cfg_.ready_sub_queue;
-                q->push(consumer);
+                q->push(cs);
                 completion_cv_.notify_one();
             }
         }
@@ -208,11 +263,14 @@ void Scheduler::dispatch_ready() {
                 }
             }
 
-            // Pass 2: fill unconstrained slots from idle pool
+            // Pass 2: fill unconstrained slots from the idle pool, cheapest
+            // worker first. Single tasks carry an optional soft preference
+            // (locality hint) that pick_for_dispatch may override.
             if (ok) {
+                int8_t hint = (N == 1) ? s.preferred_worker.load(std::memory_order_relaxed) : static_cast<int8_t>(-1);
                 for (int i = 0; i < N; i++) {
                     if (workers[static_cast<size_t>(i)] != nullptr) continue;
-                    auto *wt = cfg_.manager->pick_idle_excluding(s.worker_type, workers);
+                    auto *wt = cfg_.manager->pick_for_dispatch(s.worker_type, hint, workers);
                     if (!wt) {
                         ok = false;
                         break;
@@ -222,10 +280,11 @@ void Scheduler::dispatch_ready() {
             }
 
             if (!ok) {
-                q->push(slot);
+                q->push(s);
                 break;
             }
 
+            if (N == 1) s.ran_on = static_cast<int8_t>(workers[0]->logical_id());
             s.state.store(TaskState::RUNNING, std::memory_order_release);
             for (int i = 0; i < N; i++) {
                 WorkerDispatch d;
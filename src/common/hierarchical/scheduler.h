@@ -22,13 +22,21 @@
  *   Orch: submit() → ready_queue.push(slot) + cv.notify()
  *
  *   Scheduler thread:
- *     wait on cv (ready_queue OR completion_queue non-empty)
- *     drain completion_queue → on_task_complete → fanout release → ready_queue
- *     drain ready_queue → manager.pick_n_idle → dispatch
+ *     wait on cv (completions pending OR stop requested)
+ *     drain per-worker SPSC completion rings + fallback queue in one batch
+ *       → on_task_complete → fanout release → ready_queue
+ *     drain ready_queue → manager.pick_for_dispatch → dispatch
  *
  *   WorkerThread (managed by WorkerManager):
  *     loop: task_queue.pop() → worker.run(payload) →
- *           completion callback → Scheduler.worker_done(slot)
+ *           push own SPSC completion ring → completion_posted()
+ *           (locked fallback: Scheduler.worker_done(slot) on ring overflow)
+ *
+ * Completions are drained in batches: each worker posts to its own SPSC
+ * ring (no lock, no shared cacheline with other workers), and the
+ * Scheduler sweeps all rings plus the fallback queue once per loop
+ * iteration, so the per-event handoff cost does not scale with worker
+ * count.
  */
 
 #pragma once
@@ -37,12 +45,13 @@
 #include <condition_variable>
 #include <functional>
 #include <mutex>
-#include <queue>
 #include <thread>
+#include <vector>
 
 #include "types.h"
 
 class WorkerManager;  // forward decl
+class WorkerThread;   // forward decl
 class Ring;           // forward decl
 
 // =============================================================================
@@ -61,6 +70,14 @@ public:
         WorkerManager *manager;  // not owned — Scheduler calls manager for dispatch
         // Called when a task reaches CONSUMED (TensorMap cleanup + ring release).
         std::function<void(TaskSlot)> on_consumed_cb;
+        // Called when a task reaches COMPLETED, before its fanout is
+        // released (drives the Orchestrator's completion watermark).
+        std::function<void(TaskSlot)> on_completed_cb;
+        // Called when a transfer task (slot.transfer == true) becomes READY.
+        // Transfer tasks have no callable to dispatch, so they bypass the
+        // ready queues; the Orchestrator launches them on the destination
+        // worker's copy thread and reports completion via worker_done().
+        std::function<void(TaskSlot)> on_transfer_ready_cb;
     };
 
     void start(const Config &cfg);
@@ -68,22 +85,43 @@ public:
 
     bool running() const { return running_.load(std::memory_order_acquire); }
 
-    // Called by WorkerManager (from WorkerThread) after run() completes.
+    // Locked fallback completion path: ring-overflow posts from
+    // WorkerThreads, plus any external completion source (tests, process
+    // children). Applies group aggregation before enqueueing.
     void worker_done(TaskSlot slot);
 
+    // Called by a WorkerThread after pushing into its SPSC completion
+    // ring — wakes the scheduler thread without taking the queue lock path.
+    void completion_posted() { completion_cv_.notify_one(); }
+
 private:
     Config cfg_;
 
-    // Shared completion queue (WorkerThread → Scheduler)
-    std::queue<TaskSlot> completion_queue_;
+    // Single-child pass-through targets, cached from the manager at start():
+    // a freshly-readied consumer in a one-worker pool dispatches straight to
+    // that worker instead of round-tripping through its ready queue.
+    WorkerThread *direct_next_level_{nullptr};
+    WorkerThread *direct_sub_{nullptr};
+
+    // Fallback completion list (ring overflow / external callers).
+    // Intrusive FIFO over TaskSlotState::queue_next, like ReadyQueue — a
+    // completed slot is never simultaneously in a ready queue, so the link
+    // is free here.
+    TaskSlotState *completion_head_{nullptr};
+    TaskSlotState *completion_tail_{nullptr};
     std::mutex completion_mu_;
     std::condition_variable completion_cv_;
 
+    // Scratch for one batch of ring-drained completions (scheduler thread).
+    std::vector<TaskSlot> completion_batch_;
+
     std::thread sched_thread_;
     std::atomic<bool> stop_requested_{false};
     std::atomic<bool> running_{false};
 
     void run();
+    void drain_completions();
+    bool last_group_member(TaskSlotState &s);
     void on_task_complete(TaskSlot slot);
     void try_consume(TaskSlot slot);
     void dispatch_ready();
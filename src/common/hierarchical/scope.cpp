@@ -11,20 +11,67 @@
 
 #include "scope.h"
 
-void Scope::scope_begin() {
+#include <cstring>
+
+void *Scope::arena_alloc(size_t bytes, size_t align) {
+    while (true) {
+        if (chunk_ < chunks_.size()) {
+            ArenaChunk &c = chunks_[chunk_];
+            size_t off = (used_ + align - 1) & ~(align - 1);
+            if (off + bytes <= c.size) {
+                used_ = off + bytes;
+                return c.data.get() + off;
+            }
+            // Retained chunk too small for this request — skip to the next.
+            // The remainder is wasted until the next rewind past it.
+            ++chunk_;
+            used_ = 0;
+            continue;
+        }
+        size_t chunk_bytes = bytes > ARENA_CHUNK ? bytes : ARENA_CHUNK;
+        chunks_.push_back({std::make_unique<uint8_t[]>(chunk_bytes), chunk_bytes});
+        used_ = 0;
+    }
+}
+
+void Scope::scope_begin(int32_t reserve_tasks) {
     if (depth() >= MAX_SCOPE_DEPTH) throw std::runtime_error("Scope: maximum nesting depth exceeded");
-    stack_.push_back(ScopeFrame{});
+    ScopeFrame frame;
+    frame.mark_chunk = chunk_;
+    frame.mark_used = used_;
+    if (reserve_tasks > 0) {
+        // The watermark is already recorded, so the preallocation rewinds
+        // with the rest of the frame at scope_end.
+        frame.tasks = static_cast<TaskSlot *>(
+            arena_alloc(sizeof(TaskSlot) * static_cast<size_t>(reserve_tasks), alignof(TaskSlot))
+        );
+        frame.cap = reserve_tasks;
+    }
+    stack_.push_back(frame);
 }
 
 void Scope::scope_end(const std::function<void(TaskSlot)> &release_fn) {
     if (stack_.empty()) throw std::runtime_error("Scope: scope_end without scope_begin");
     ScopeFrame &frame = stack_.back();
-    for (TaskSlot slot : frame.tasks)
-        release_fn(slot);
+    for (int32_t i = 0; i < frame.count; ++i)
+        release_fn(frame.tasks[i]);
+    // Wholesale release: rewind the arena to where this scope started.
+    chunk_ = frame.mark_chunk;
+    used_ = frame.mark_used;
     stack_.pop_back();
 }
 
 void Scope::register_task(TaskSlot slot) {
     if (stack_.empty()) return;  // no open scope — task has no scope ref
-    stack_.back().tasks.push_back(slot);
+    ScopeFrame &frame = stack_.back();
+    if (frame.count == frame.cap) {
+        int32_t grown_cap = frame.cap > 0 ? frame.cap * 2 : 64;
+        auto *grown = static_cast<TaskSlot *>(
+            arena_alloc(sizeof(TaskSlot) * static_cast<size_t>(grown_cap), alignof(TaskSlot))
+        );
+        if (frame.count > 0) std::memcpy(grown, frame.tasks, sizeof(TaskSlot) * static_cast<size_t>(frame.count));
+        frame.tasks = grown;
+        frame.cap = grown_cap;
+    }
+    frame.tasks[frame.count++] = slot;
 }
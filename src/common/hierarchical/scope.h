@@ -17,6 +17,13 @@
  * scope_end() is called, that reference is released for every task in the scope,
  * allowing tasks that have no downstream consumers to reach CONSUMED.
  *
+ * Scope-lifetime metadata (currently the per-frame task lists) lives in a
+ * chunked bump arena: scope_begin() records a watermark, scope_end() rewinds
+ * to it, releasing the scope's allocations wholesale with no per-object
+ * free. Chunks are retained across scopes, so steady-state registration
+ * stops hitting malloc. (Contrast with the Orchestrator's args arena, which
+ * must survive until drain() — nothing placed here may escape its scope.)
+ *
  * Orch-owned: single-threaded, no locking required.
  *
  * Mirrors L2 scope_begin / scope_end semantics.
@@ -24,7 +31,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
+#include <memory>
 #include <stdexcept>
 #include <vector>
 
@@ -32,8 +41,11 @@
 
 class Scope {
 public:
-    // Open a new scope level.
-    void scope_begin();
+    // Open a new scope level. `reserve_tasks > 0` preallocates the frame's
+    // task list from the arena so the first `reserve_tasks` register_task
+    // calls never trigger a doubling copy — pair with Ring::scope_reserve
+    // when the scope's task count is known at entry.
+    void scope_begin(int32_t reserve_tasks = 0);
 
     // Close innermost scope.
     // Calls release_fn(slot) for every task registered in this scope.
@@ -60,8 +72,31 @@ public:
     }
 
 private:
+    // --- Scope arena ---
+    struct ArenaChunk {
+        std::unique_ptr<uint8_t[]> data;
+        size_t size;
+    };
+    // Bump position: chunks_[chunk_] is the chunk being filled, used_ the
+    // bytes consumed in it. A watermark is just a saved (chunk_, used_) pair.
+    static constexpr size_t ARENA_CHUNK = 16u << 10;
+    std::vector<ArenaChunk> chunks_;
+    size_t chunk_{0};
+    size_t used_{0};
+
+    void *arena_alloc(size_t bytes, size_t align);
+
+    // One open scope. `tasks` is an arena-backed array grown by doubling —
+    // growth copies into a fresh arena block and abandons the old one,
+    // which is fine because everything rewinds at scope_end(). An outer
+    // frame never grows while an inner scope is open (registration targets
+    // the innermost frame), so an inner rewind cannot free an outer list.
     struct ScopeFrame {
-        std::vector<TaskSlot> tasks;
+        size_t mark_chunk{0};  // arena watermark at scope_begin
+        size_t mark_used{0};
+        TaskSlot *tasks{nullptr};
+        int32_t count{0};
+        int32_t cap{0};
     };
     std::vector<ScopeFrame> stack_;
 };
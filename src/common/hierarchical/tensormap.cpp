@@ -11,17 +11,140 @@
 
 #include "tensormap.h"
 
+#include <stdexcept>
+
+namespace {
+
+// Round up to the next power of two (v > 0).
+uint32_t next_pow2(uint32_t v) {
+    v--;
+    v |= v >> 1;
+    v |= v >> 2;
+    v |= v >> 4;
+    v |= v >> 8;
+    v |= v >> 16;
+    return v + 1;
+}
+
+}  // namespace
+
+TensorMap::TensorMap() { init(DEFAULT_CAPACITY); }
+
+void TensorMap::init(int32_t capacity_hint) {
+    if (size() != 0) {
+        throw std::logic_error("TensorMap::init: map is not empty");
+    }
+    if (capacity_hint <= 0) {
+        capacity_hint = DEFAULT_CAPACITY;
+    }
+
+    uint32_t per_shard =
+        next_pow2(static_cast<uint32_t>((static_cast<int64_t>(capacity_hint) * 2 + SHARD_COUNT - 1) / SHARD_COUNT));
+    if (per_shard < 16) per_shard = 16;
+
+    for (Shard &s : shards_) {
+        std::lock_guard<std::mutex> lk(s.mu);
+        s.slots = std::make_unique<Entry[]>(per_shard);
+        s.mask = per_shard - 1;
+        s.max_used = static_cast<int32_t>(per_shard - per_shard / 8);
+        s.used.store(0, std::memory_order_relaxed);
+    }
+}
+
 TaskSlot TensorMap::lookup(TensorKey key) const {
-    auto it = map_.find(key);
-    if (it == map_.end()) return INVALID_SLOT;
-    return it->second;
+    size_t h = TensorKeyHash{}(key);
+    const Shard &s = shards_[h & (SHARD_COUNT - 1)];
+    size_t idx = (h / SHARD_COUNT) & s.mask;
+
+    for (uint32_t n = 0; n <= s.mask; ++n, idx = (idx + 1) & s.mask) {
+        const Entry &e = s.slots[idx];
+        uint64_t m = e.meta.load(std::memory_order_acquire);
+        if (meta_state(m) == META_EMPTY) return INVALID_SLOT;  // end of probe chain
+        if (meta_state(m) != META_LIVE) continue;
+        if (meta_worker(m) != key.worker) continue;
+
+        // The acquire on meta made the committed key pointer visible; the
+        // acquire on ptr keeps the revalidating meta load below it.
+        uint64_t p = e.ptr.load(std::memory_order_acquire);
+        if (p != key.ptr) continue;
+
+        // Revalidate: a concurrent erase-and-reinsert can swap in a
+        // different key between the two loads above. Identical meta words
+        // pin (state, worker, producer); combined with the key match, the
+        // producer we return was this key's mapping at some point during
+        // the call. (An erase + identical re-insert passing this check
+        // returns the re-inserted producer — also correct.)
+        if (e.meta.load(std::memory_order_relaxed) != m) continue;
+        return meta_producer(m);
+    }
+    return INVALID_SLOT;
 }
 
-void TensorMap::insert(TensorKey key, TaskSlot producer) { map_[key] = producer; }
+void TensorMap::insert(TensorKey key, TaskSlot producer) {
+    size_t h = TensorKeyHash{}(key);
+    Shard &s = shards_[h & (SHARD_COUNT - 1)];
+    std::lock_guard<std::mutex> lk(s.mu);
+
+    size_t idx = (h / SHARD_COUNT) & s.mask;
+    int64_t reuse_idx = -1;  // first tombstone seen along the probe chain
+    int64_t empty_idx = -1;
+
+    for (uint32_t n = 0; n <= s.mask; ++n, idx = (idx + 1) & s.mask) {
+        Entry &e = s.slots[idx];
+        uint64_t m = e.meta.load(std::memory_order_relaxed);
+        if (meta_state(m) == META_EMPTY) {
+            empty_idx = static_cast<int64_t>(idx);
+            break;
+        }
+        if (meta_state(m) == META_TOMBSTONE) {
+            if (reuse_idx < 0) reuse_idx = static_cast<int64_t>(idx);
+            continue;
+        }
+        if (e.ptr.load(std::memory_order_relaxed) == key.ptr && meta_worker(m) == key.worker) {
+            // Producer overwrite (buffer re-use): one meta store — readers
+            // see either the old or the new producer, never a torn mix.
+            e.meta.store(pack_meta(key.worker, producer), std::memory_order_release);
+            return;
+        }
+    }
+
+    int64_t target = reuse_idx >= 0 ? reuse_idx : empty_idx;
+    if (target < 0 || s.used.load(std::memory_order_relaxed) >= s.max_used) {
+        throw std::runtime_error("TensorMap: shard full — raise the capacity passed to TensorMap::init()");
+    }
+
+    Entry &t = s.slots[static_cast<size_t>(target)];
+    // Write the key first, commit with the meta store: a reader that
+    // acquires the LIVE meta is guaranteed to observe this key pointer.
+    t.ptr.store(key.ptr, std::memory_order_relaxed);
+    t.meta.store(pack_meta(key.worker, producer), std::memory_order_release);
+    s.used.fetch_add(1, std::memory_order_relaxed);
+}
 
 void TensorMap::erase_task_outputs(const std::vector<TensorKey> &keys) {
-    for (const auto &key : keys)
-        map_.erase(key);
+    for (const TensorKey &key : keys) {
+        size_t h = TensorKeyHash{}(key);
+        Shard &s = shards_[h & (SHARD_COUNT - 1)];
+        std::lock_guard<std::mutex> lk(s.mu);
+
+        size_t idx = (h / SHARD_COUNT) & s.mask;
+        for (uint32_t n = 0; n <= s.mask; ++n, idx = (idx + 1) & s.mask) {
+            Entry &e = s.slots[idx];
+            uint64_t m = e.meta.load(std::memory_order_relaxed);
+            if (meta_state(m) == META_EMPTY) break;  // key not present
+            if (meta_state(m) != META_LIVE) continue;
+            if (e.ptr.load(std::memory_order_relaxed) != key.ptr || meta_worker(m) != key.worker) continue;
+            e.meta.store(META_TOMBSTONE, std::memory_order_release);
+            s.used.fetch_sub(1, std::memory_order_relaxed);
+            break;
+        }
+    }
 }
 
-int32_t TensorMap::size() const { return static_cast<int32_t>(map_.size()); }
+int32_t TensorMap::size() const {
+    int32_t total = 0;
+    for (const Shard &s : shards_) {
+        if (s.slots) total += s.used.load(std::memory_order_relaxed);
+    }
+    return total;
+}
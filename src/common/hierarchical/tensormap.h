@@ -19,37 +19,106 @@
  * across different NPUs.
  *
  * Unlike the L2 PTO2TensorMap, this implementation:
- *   - Uses std::unordered_map (no ring buffer entry pool)
  *   - Does not perform overlap detection (each key maps to one producer)
  *   - Cleans up entries actively when a task is CONSUMED
  *
- * Owned exclusively by the Orchestrator (main thread); no locking required.
+ * Concurrency: the map is `SHARD_COUNT` independent open-addressing tables,
+ * a key's shard chosen by its hash. Writers (`insert`, `erase_task_outputs`)
+ * serialize per shard on that shard's mutex — dependency inference on one
+ * shard never contends with inserts or the scheduler-thread CONSUMED cleanup
+ * on another. `lookup` takes no lock at all: an entry's key pointer is
+ * written first and committed by a release store of the packed (state,
+ * worker, producer) meta word, and a reader revalidates the meta after
+ * reading the key, so a concurrent erase-and-reinsert of the slot is
+ * detected and retried along the probe chain. Tables are sized once at
+ * `init` and never rehash, which is what makes the lock-free read side safe
+ * (no table swap to chase).
  */
 
 #pragma once
 
-#include <unordered_map>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
 #include <vector>
 
 #include "types.h"
 
 class TensorMap {
 public:
-    // Look up the producer for a tensor key.
+    // Number of independent tables. Power of two; the low hash bits pick the
+    // shard, the remaining bits drive the in-shard probe sequence.
+    static constexpr int32_t SHARD_COUNT = 16;
+
+    // Default total live-entry capacity when init() is not called explicitly.
+    static constexpr int32_t DEFAULT_CAPACITY = 64 * 1024;
+
+    TensorMap();
+
+    // Size every shard for `capacity_hint` total live entries (with 2x
+    // headroom so probe chains stay short at the advertised load). May only
+    // be called while the map is empty; throws std::logic_error otherwise.
+    void init(int32_t capacity_hint);
+
+    // Look up the producer for a tensor key. Lock-free.
     // Returns INVALID_SLOT when not found.
     TaskSlot lookup(TensorKey key) const;
 
     // Register key → producer mapping.
-    // Overwrites any existing entry (re-use of the same buffer by a new producer).
+    // Overwrites any existing entry (re-use of the same buffer by a new
+    // producer). Takes only the key's shard mutex. Throws std::runtime_error
+    // when the shard is at its load-factor cap — raise the init() capacity.
     void insert(TensorKey key, TaskSlot producer);
 
     // Remove all entries whose key appears in 'keys'.
-    // Called when a producer task transitions to CONSUMED.
+    // Called when a producer task transitions to CONSUMED (which can happen
+    // on the scheduler thread). Takes each key's shard mutex in turn.
     void erase_task_outputs(const std::vector<TensorKey> &keys);
 
-    // Number of entries currently tracked.
+    // Number of entries currently tracked. Sums per-shard counters without
+    // locking — exact when quiescent, approximate under concurrent writes.
     int32_t size() const;
 
 private:
-    std::unordered_map<TensorKey, TaskSlot, TensorKeyHash> map_;
+    // meta word layout: [31:0] producer slot, [39:32] worker byte,
+    // [41:40] entry state. The state lives out-of-band so every 64-bit
+    // value (including 0) is a usable key pointer. EMPTY is all-zero so
+    // value-initialized tables start empty.
+    static constexpr uint64_t META_STATE_SHIFT = 40;
+    static constexpr uint64_t META_STATE_MASK = 3ULL << META_STATE_SHIFT;
+    static constexpr uint64_t META_EMPTY = 0ULL << META_STATE_SHIFT;
+    static constexpr uint64_t META_LIVE = 1ULL << META_STATE_SHIFT;
+    static constexpr uint64_t META_TOMBSTONE = 2ULL << META_STATE_SHIFT;
+
+    // One table slot. Writers store `ptr` first, then commit with a release
+    // store of `meta`; a reader that acquires a LIVE meta therefore sees the
+    // matching key pointer.
+    struct Entry {
+        std::atomic<uint64_t> ptr{0};
+        std::atomic<uint64_t> meta{META_EMPTY};
+    };
+
+    struct Shard {
+        std::unique_ptr<Entry[]> slots;
+        uint32_t mask{0};     // capacity - 1 (capacity is a power of two)
+        int32_t max_used{0};  // live-entry cap (7/8 load factor)
+        std::atomic<int32_t> used{0};
+        std::mutex mu;  // serializes writers; lookup never takes it
+
+        Shard() = default;
+        Shard(const Shard &) = delete;
+        Shard &operator=(const Shard &) = delete;
+    };
+
+    static uint64_t pack_meta(int8_t worker, TaskSlot producer) {
+        return META_LIVE | (static_cast<uint64_t>(static_cast<uint8_t>(worker)) << 32) |
+               static_cast<uint32_t>(producer);
+    }
+    static uint64_t meta_state(uint64_t meta) { return meta & META_STATE_MASK; }
+    static int8_t meta_worker(uint64_t meta) { return static_cast<int8_t>(static_cast<uint8_t>(meta >> 32)); }
+    static TaskSlot meta_producer(uint64_t meta) { return static_cast<TaskSlot>(static_cast<int32_t>(meta)); }
+
+    std::array<Shard, SHARD_COUNT> shards_;
 };
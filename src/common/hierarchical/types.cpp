@@ -33,8 +33,19 @@ void TaskSlotState::reset() {
     config = ChipCallConfig{};
     task_args.clear();
     task_args_list.clear();
+    arena_views.clear();
     is_group_ = false;
+    recurring = false;
+    heap_outputs = false;
+    transfer = false;
+    transfer_src_worker = -1;
+    transfer_dst_worker = -1;
+    transfer_src = 0;
+    transfer_dst = 0;
+    transfer_size = 0;
     affinities.clear();
+    ran_on = -1;
+    preferred_worker.store(-1, std::memory_order_relaxed);
     // ring_idx / ring_slot_idx are deliberately NOT cleared here: Ring
     // stamps them at alloc() before the Orchestrator ever calls reset(),
     // and Ring::release() needs to read them for the FIFO advance. The
@@ -46,30 +57,42 @@ void TaskSlotState::reset() {
 // ReadyQueue
 // =============================================================================
 
-void ReadyQueue::push(TaskSlot slot) {
+void ReadyQueue::push(TaskSlotState &s) {
     {
         std::lock_guard<std::mutex> lk(mu_);
-        q_.push(slot);
+        s.queue_next = nullptr;
+        if (tail_) {
+            tail_->queue_next = &s;
+        } else {
+            head_ = &s;
+        }
+        tail_ = &s;
     }
     cv_.notify_one();
 }
 
+TaskSlot ReadyQueue::pop_head_locked() {
+    TaskSlotState *s = head_;
+    head_ = s->queue_next;
+    if (!head_) tail_ = nullptr;
+    s->queue_next = nullptr;
+    return s->self;
+}
+
 bool ReadyQueue::try_pop(TaskSlot &out) {
     std::lock_guard<std::mutex> lk(mu_);
-    if (q_.empty()) return false;
-    out = q_.front();
-    q_.pop();
+    if (!head_) return false;
+    out = pop_head_locked();
     return true;
 }
 
 bool ReadyQueue::wait_pop(TaskSlot &out) {
     std::unique_lock<std::mutex> lk(mu_);
     cv_.wait(lk, [this] {
-        return !q_.empty() || shutdown_;
+        return head_ != nullptr || shutdown_;
     });
-    if (q_.empty()) return false;
-    out = q_.front();
-    q_.pop();
+    if (!head_) return false;
+    out = pop_head_locked();
     return true;
 }
 
@@ -35,7 +35,6 @@
 #include <cstdint>
 #include <functional>
 #include <mutex>
-#include <queue>
 #include <vector>
 
 #include "../task_interface/chip_call_config.h"
@@ -139,6 +138,19 @@ struct TaskSlotState {
         return affinities[static_cast<size_t>(i)];
     }
 
+    // --- Placement hints (soft, distinct from the hard `affinities` pin) ---
+    // `ran_on` records the logical worker a single (non-group) task was
+    // dispatched to. When its completion readies a same-type consumer, the
+    // Scheduler copies `ran_on` into the consumer's `preferred_worker` so a
+    // producer→consumer chain tends to stay on one worker's memory.
+    // `preferred_worker` is advisory: dispatch honors it only while that
+    // worker is idle and not markedly slower than the best idle candidate
+    // (see WorkerManager::pick_for_dispatch). Atomic because
+    // Orchestrator::prefer_worker may store it from the orch thread while
+    // the Scheduler thread reads it.
+    int8_t ran_on{-1};
+    std::atomic<int8_t> preferred_worker{-1};
+
     // --- Producer tasks this task depends on (for deferred release) ---
     // When this task reaches COMPLETED, the Scheduler releases one fanout ref
     // on each producer — mirroring L2's "deferred release: walk fanin" step.
@@ -159,10 +171,40 @@ struct TaskSlotState {
     std::vector<TaskArgs> task_args_list;
     bool is_group_{false};
 
+    // Arena-backed alternative (zero-copy submit): views reference argument
+    // arrays owned by the Orchestrator's args arena, valid until drain()
+    // recycles it. Non-empty arena_views takes precedence over task_args /
+    // task_args_list in args_view() and group_size().
+    std::vector<TaskArgsView> arena_views;
+
     // Runtime-owned OUTPUT slabs live in the Worker's HeapRing and are
     // reclaimed implicitly by Ring::release(slot) — no per-slot
     // munmap is needed. See docs/orchestrator.md §8b.
 
+    // --- Recurring-submit support ---
+    // `recurring`: this slot was marked as a resubmission template via
+    // Orchestrator::mark_recurring. Its stored TaskArgs stay readable past
+    // CONSUMED (slot states live until drain), so resubmit() can re-issue
+    // them without copying.
+    // `heap_outputs`: reserve_outputs_and_slot carved HeapRing slabs for
+    // null-pointer OUTPUT tensors. Those slabs die with this slot's FIFO
+    // release, so such tasks cannot be marked recurring.
+    bool recurring{false};
+    bool heap_outputs{false};
+
+    // --- Cross-partition transfer task (Orchestrator::submit_partitioned) ---
+    // Transfer slots carry no callable: when one becomes READY the Scheduler
+    // hands it to the Orchestrator's transfer launcher instead of a ready
+    // queue, and the destination worker's copy thread reports the completion.
+    // `transfer_dst` is a partition-local replica buffer owned by this slot
+    // (control_free'd on CONSUMED).
+    bool transfer{false};
+    int8_t transfer_src_worker{-1};
+    int8_t transfer_dst_worker{-1};
+    uint64_t transfer_src{0};
+    uint64_t transfer_dst{0};
+    uint64_t transfer_size{0};
+
     // --- HeapRing layer membership (Strict-1 per-scope rings) ---
     // Set by Ring::alloc from the caller's scope depth. ring_idx picks
     // which of the MAX_RING_DEPTH heaps holds this slot's slab;
@@ -171,15 +213,32 @@ struct TaskSlotState {
     int32_t ring_idx{0};
     int32_t ring_slot_idx{0};
 
+    // --- Intrusive queue membership ---
+    // `self` is the slot's own id, stamped by Ring::alloc alongside
+    // ring_idx (and likewise not cleared by reset()). `queue_next` is the
+    // link used by ReadyQueue and the Scheduler's fallback completion list:
+    // the node IS the slot state, so enqueue/dequeue touch no allocator and
+    // the link shares the state's cache lines — mirroring the device
+    // runtime's DepListPool-style intrusive rings. A slot is in at most one
+    // such queue at a time (READY in a ready queue, COMPLETED in the
+    // fallback list, never both), so one link suffices; the owning queue
+    // writes it under its own mutex.
+    TaskSlot self{INVALID_SLOT};
+    TaskSlotState *queue_next{nullptr};
+
     // --- Group bookkeeping ---
     std::atomic<int32_t> sub_complete_count{0};
 
     bool is_group() const { return is_group_; }
-    int32_t group_size() const { return is_group_ ? static_cast<int32_t>(task_args_list.size()) : 1; }
+    int32_t group_size() const {
+        if (!is_group_) return 1;
+        return static_cast<int32_t>(arena_views.empty() ? task_args_list.size() : arena_views.size());
+    }
 
     // Zero-copy view over the i-th worker's args (THREAD-mode dispatch).
     // `i` must be 0 for non-group slots; 0..group_size()-1 for groups.
     TaskArgsView args_view(int32_t i) const {
+        if (!arena_views.empty()) return arena_views[static_cast<size_t>(i)];
         return is_group_ ? make_view(task_args_list[static_cast<size_t>(i)]) : make_view(task_args);
     }
 
@@ -190,13 +249,26 @@ struct TaskSlotState {
     void reset();
 };
 
+// A slot may bypass the ready queue straight to a pool's only worker when it
+// needs exactly one dispatch and does not pin a worker other than that one
+// (in a single-worker pool the only valid pin is logical id 0). Transfer
+// slots never reach either dispatch path, so they need no exclusion here.
+inline bool direct_dispatch_eligible(const TaskSlotState &s) { return !s.is_group() && s.get_affinity(0) <= 0; }
+
 // =============================================================================
 // ReadyQueue — Orch pushes, Scheduler pops
 // =============================================================================
+//
+// Intrusive FIFO threaded through TaskSlotState::queue_next — no per-node
+// allocation, so sustained submit rates never churn the heap. Callers pass
+// the slot state itself (every push site already holds it); pops still hand
+// back the TaskSlot id via `state.self`. A slot must not be pushed while it
+// is already linked in a queue — the DAG state machine guarantees this
+// (a slot is READY in exactly one per-type queue).
 
 class ReadyQueue {
 public:
-    void push(TaskSlot slot);
+    void push(TaskSlotState &s);
 
     // Non-blocking: returns false immediately if empty.
     bool try_pop(TaskSlot &out);
@@ -208,7 +280,12 @@ public:
     void shutdown();
 
 private:
-    std::queue<TaskSlot> q_;
+    // Pops the head and returns its slot id; caller holds mu_ and has
+    // checked head_ != nullptr.
+    TaskSlot pop_head_locked();
+
+    TaskSlotState *head_{nullptr};
+    TaskSlotState *tail_{nullptr};
     std::mutex mu_;
     std::condition_variable cv_;
     bool shutdown_{false};
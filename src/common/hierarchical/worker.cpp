@@ -69,7 +69,7 @@ void atfork_prepare() {
     //   3. worker_thread.queue_mu_ (PR-D, per thread)
     //   4. scheduler.completion_mu_
     //   5. allocator.mu_
-    //   6. tensormap.mu_
+    //   6. tensormap shard mu_ (per shard, ascending index)
     // Locks are taken in this order and released in reverse on prepare/parent
     // handlers so the handlers never themselves deadlock. Today none of our
     // locks are held across potential fork points, so the handler is empty;
@@ -135,13 +135,30 @@ void Worker::init() {
     if (initialized_) throw std::runtime_error("Worker: already initialized");
 
     orchestrator_.init(&tensormap_, &allocator_, &scope_, &ready_next_level_queue_, &ready_sub_queue_, &manager_);
-
-    // Start WorkerManager first — creates WorkerThreads.
-    // The on_complete callback routes through the Scheduler's worker_done().
-    manager_.start(&allocator_, [this](TaskSlot slot) {
+    // Finished partition transfers re-enter the DAG through the external
+    // completion path, like any other worker completion.
+    orchestrator_.set_transfer_done([this](TaskSlot slot) {
         scheduler_.worker_done(slot);
     });
 
+    // Start WorkerManager first — creates WorkerThreads.
+    // Completions normally land in per-worker SPSC rings (completion_posted
+    // wakes the scheduler); worker_done() is the locked overflow fallback.
+    manager_.start(
+        &allocator_,
+        [this](TaskSlot slot) {
+            scheduler_.worker_done(slot);
+        },
+        [this]() {
+            scheduler_.completion_posted();
+        }
+    );
+
+    // Single-child pass-through: pools with exactly one worker collapse
+    // submit-side dispatch to a direct WorkerThread handoff. Must run after
+    // manager_.start() — that is when the WorkerThreads exist.
+    orchestrator_.init_direct_dispatch();
+
     Scheduler::Config cfg;
     cfg.ring = &allocator_;
     cfg.ready_next_level_queue = &ready_next_level_queue_;
@@ -150,6 +167,12 @@ void Worker::init() {
     cfg.on_consumed_cb = [this](TaskSlot slot) {
         orchestrator_.on_consumed(slot);
     };
+    cfg.on_completed_cb = [this](TaskSlot slot) {
+        orchestrator_.on_completed(slot);
+    };
+    cfg.on_transfer_ready_cb = [this](TaskSlot slot) {
+        orchestrator_.launch_transfer(slot);
+    };
 
     scheduler_.start(cfg);
     initialized_ = true;
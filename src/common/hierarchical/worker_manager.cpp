@@ -53,19 +53,44 @@ void WorkerThread::write_mailbox_state(MailboxState s) {
 // =============================================================================
 
 void WorkerThread::start(
-    Mode mode, IWorker *worker, Ring *ring, const std::function<void(TaskSlot)> &on_complete, void *mailbox
+    Mode mode, IWorker *worker, Ring *ring, const std::function<void(TaskSlot)> &on_complete, void *mailbox,
+    int logical_id, const std::function<void()> &on_posted
 ) {
     mode_ = mode;
     worker_ = worker;
     ring_ = ring;
     on_complete_ = on_complete;
+    on_posted_ = on_posted;
     mailbox_ = mailbox;
+    logical_id_ = logical_id;
     shutdown_ = false;
     idle_.store(true, std::memory_order_relaxed);
+    inflight_.store(0, std::memory_order_relaxed);
+    avg_task_us_.store(0, std::memory_order_relaxed);
+    comp_head_.store(0, std::memory_order_relaxed);
+    comp_tail_.store(0, std::memory_order_relaxed);
     thread_ = std::thread(&WorkerThread::loop, this);
 }
 
+bool WorkerThread::try_push_completion(TaskSlot slot) {
+    uint32_t tail = comp_tail_.load(std::memory_order_relaxed);
+    uint32_t head = comp_head_.load(std::memory_order_acquire);
+    if (tail - head >= COMPLETION_RING_CAP) return false;
+    completion_ring_[tail & (COMPLETION_RING_CAP - 1)] = slot;
+    comp_tail_.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool WorkerThread::pop_completion(TaskSlot &slot) {
+    uint32_t head = comp_head_.load(std::memory_order_relaxed);
+    if (head == comp_tail_.load(std::memory_order_acquire)) return false;
+    slot = completion_ring_[head & (COMPLETION_RING_CAP - 1)];
+    comp_head_.store(head + 1, std::memory_order_release);
+    return true;
+}
+
 void WorkerThread::dispatch(WorkerDispatch d) {
+    inflight_.fetch_add(1, std::memory_order_acq_rel);
     idle_.store(false, std::memory_order_release);
     std::lock_guard<std::mutex> lk(mu_);
     queue_.push(d);
@@ -106,14 +131,38 @@ void WorkerThread::loop() {
 
         TaskSlotState &s = *ring_->slot_state(d.task_slot);
 
+        auto t0 = std::chrono::steady_clock::now();
         if (mode_ == Mode::THREAD) {
             dispatch_thread(s, d.group_index);
         } else {
             dispatch_process(s, d.group_index);
         }
+        auto sample_us = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - t0).count()
+        );
 
+        // EWMA (1/8 weight on the new sample) — tracks "recent" duration
+        // without unbounded history; a worker with no history reads 0.
+        uint64_t prev = avg_task_us_.load(std::memory_order_relaxed);
+        uint64_t next = (prev == 0)
+                            ? sample_us
+                            : static_cast<uint64_t>(
+                                  static_cast<int64_t>(prev) +
+                                  (static_cast<int64_t>(sample_us) - static_cast<int64_t>(prev)) / 8
+                              );
+        avg_task_us_.store(next, std::memory_order_relaxed);
+
+        inflight_.fetch_sub(1, std::memory_order_acq_rel);
         idle_.store(true, std::memory_order_release);
-        on_complete_(d.task_slot);
+
+        // Post to the SPSC ring so the Scheduler can drain completions in
+        // batches; fall back to the locked per-event path only when the ring
+        // is full (the Scheduler has been stalled for >CAP completions).
+        if (try_push_completion(d.task_slot)) {
+            if (on_posted_) on_posted_();
+        } else {
+            on_complete_(d.task_slot);
+        }
     }
 }
 
@@ -191,13 +240,13 @@ void WorkerManager::add_sub_process(void *mailbox) {
     sub_entries_.push_back({nullptr, WorkerThread::Mode::PROCESS, mailbox});
 }
 
-void WorkerManager::start(Ring *ring, const OnCompleteFn &on_complete) {
+void WorkerManager::start(Ring *ring, const OnCompleteFn &on_complete, const OnPostedFn &on_posted) {
     if (ring == nullptr) throw std::invalid_argument("WorkerManager::start: null ring");
     auto make_threads = [&](const std::vector<WorkerEntry> &entries,
                             std::vector<std::unique_ptr<WorkerThread>> &threads) {
         for (const WorkerEntry &e : entries) {
             auto wt = std::make_unique<WorkerThread>();
-            wt->start(e.mode, e.worker, ring, on_complete, e.mailbox);
+            wt->start(e.mode, e.worker, ring, on_complete, e.mailbox, static_cast<int>(threads.size()), on_posted);
             threads.push_back(std::move(wt));
         }
     };
@@ -205,6 +254,22 @@ void WorkerManager::start(Ring *ring, const OnCompleteFn &on_complete) {
     make_threads(sub_entries_, sub_threads_);
 }
 
+void WorkerManager::drain_completions(std::vector<TaskSlot> &out) const {
+    TaskSlot slot;
+    for (auto &wt : next_level_threads_)
+        while (wt->pop_completion(slot)) out.push_back(slot);
+    for (auto &wt : sub_threads_)
+        while (wt->pop_completion(slot)) out.push_back(slot);
+}
+
+bool WorkerManager::completions_pending() const {
+    for (auto &wt : next_level_threads_)
+        if (wt->completion_pending()) return true;
+    for (auto &wt : sub_threads_)
+        if (wt->completion_pending()) return true;
+    return false;
+}
+
 void WorkerManager::stop() {
     for (auto &wt : next_level_threads_)
         wt->stop();
@@ -248,20 +313,48 @@ WorkerThread *WorkerManager::get_worker(WorkerType type, int logical_id) const {
     return threads[static_cast<size_t>(logical_id)].get();
 }
 
-WorkerThread *WorkerManager::pick_idle_excluding(WorkerType type, const std::vector<WorkerThread *> &exclude) const {
+WorkerThread *WorkerManager::single_worker(WorkerType type) const {
     auto &threads = (type == WorkerType::NEXT_LEVEL) ? next_level_threads_ : sub_threads_;
-    for (auto &wt : threads) {
-        if (!wt->idle()) continue;
-        bool excluded = false;
+    return threads.size() == 1 ? threads[0].get() : nullptr;
+}
+
+// Estimated cost of placing one more task on `wt`: queued depth plus the
+// new task, weighted by the worker's recent per-task duration. Idle workers
+// with no history cost 1 — cheapest, so a cold pool spreads work evenly.
+static uint64_t load_cost(const WorkerThread *wt) {
+    uint64_t avg = wt->avg_task_us();
+    if (avg == 0) avg = 1;
+    return static_cast<uint64_t>(wt->inflight() + 1) * avg;
+}
+
+WorkerThread *WorkerManager::pick_for_dispatch(
+    WorkerType type, int8_t preferred, const std::vector<WorkerThread *> &exclude
+) const {
+    auto &threads = (type == WorkerType::NEXT_LEVEL) ? next_level_threads_ : sub_threads_;
+    auto excluded = [&exclude](const WorkerThread *wt) {
         for (auto *ex : exclude) {
-            if (ex == wt.get()) {
-                excluded = true;
-                break;
-            }
+            if (ex == wt) return true;
         }
-        if (!excluded) return wt.get();
+        return false;
+    };
+
+    WorkerThread *best = nullptr;
+    for (auto &wt : threads) {
+        if (!wt->idle() || excluded(wt.get())) continue;
+        if (best == nullptr || load_cost(wt.get()) < load_cost(best)) best = wt.get();
     }
-    return nullptr;
+    if (best == nullptr) return nullptr;
+
+    // Honor the soft preference while its cost is within 2x of the best
+    // candidate's; beyond that the balancer overrides — a slow preferred
+    // worker must not capture an entire producer→consumer chain. A best
+    // candidate with no duration history never overrides the hint: with no
+    // evidence it is faster, locality wins.
+    if (preferred >= 0 && static_cast<size_t>(preferred) < threads.size()) {
+        WorkerThread *p = threads[static_cast<size_t>(preferred)].get();
+        if (p->idle() && !excluded(p) && (best->avg_task_us() == 0 || load_cost(p) <= 2 * load_cost(best))) return p;
+    }
+    return best;
 }
 
 // =============================================================================
@@ -282,6 +375,7 @@ static uint64_t read_control_result(const char *mbox) {
 }
 
 uint64_t WorkerThread::control_malloc(size_t size) {
+    std::lock_guard<std::mutex> control_lk(control_mu_);
     if (mode_ == Mode::THREAD) {
         auto *cw = dynamic_cast<ChipWorker *>(worker_);
         if (!cw) throw std::runtime_error("control_malloc: worker is not a ChipWorker");
@@ -299,6 +393,7 @@ uint64_t WorkerThread::control_malloc(size_t size) {
 }
 
 void WorkerThread::control_free(uint64_t ptr) {
+    std::lock_guard<std::mutex> control_lk(control_mu_);
     if (mode_ == Mode::THREAD) {
         auto *cw = dynamic_cast<ChipWorker *>(worker_);
         if (!cw) throw std::runtime_error("control_free: worker is not a ChipWorker");
@@ -312,6 +407,7 @@ void WorkerThread::control_free(uint64_t ptr) {
 }
 
 void WorkerThread::control_copy_to(uint64_t dst, uint64_t src, size_t size) {
+    std::lock_guard<std::mutex> control_lk(control_mu_);
     if (mode_ == Mode::THREAD) {
         auto *cw = dynamic_cast<ChipWorker *>(worker_);
         if (!cw) throw std::runtime_error("control_copy_to: worker is not a ChipWorker");
@@ -325,6 +421,7 @@ void WorkerThread::control_copy_to(uint64_t dst, uint64_t src, size_t size) {
 }
 
 void WorkerThread::control_copy_from(uint64_t dst, uint64_t src, size_t size) {
+    std::lock_guard<std::mutex> control_lk(control_mu_);
     if (mode_ == Mode::THREAD) {
         auto *cw = dynamic_cast<ChipWorker *>(worker_);
         if (!cw) throw std::runtime_error("control_copy_from: worker is not a ChipWorker");
@@ -337,6 +434,31 @@ void WorkerThread::control_copy_from(uint64_t dst, uint64_t src, size_t size) {
     write_mailbox_state(MailboxState::IDLE);
 }
 
+bool WorkerThread::control_copy_between(uint64_t dst, uint64_t src, size_t size) {
+    std::lock_guard<std::mutex> control_lk(control_mu_);
+    if (mode_ != Mode::THREAD) {
+        // The child process owns the device context; no in-process direct path.
+        return false;
+    }
+    auto *cw = dynamic_cast<ChipWorker *>(worker_);
+    if (!cw) throw std::runtime_error("control_copy_between: worker is not a ChipWorker");
+    return cw->copy_between(dst, src, size);
+}
+
+void WorkerManager::set_partition_map(const std::vector<int8_t> &partition_workers) {
+    for (int8_t w : partition_workers) {
+        if (w >= 0 && static_cast<size_t>(w) >= next_level_entries_.size()) {
+            throw std::invalid_argument("WorkerManager::set_partition_map: worker id not registered");
+        }
+    }
+    partition_workers_ = partition_workers;
+}
+
+int8_t WorkerManager::partition_worker(int32_t partition) const {
+    if (partition < 0 || static_cast<size_t>(partition) >= partition_workers_.size()) return -1;
+    return partition_workers_[static_cast<size_t>(partition)];
+}
+
 bool WorkerManager::any_busy() const {
     for (auto &wt : next_level_threads_)
         if (!wt->idle()) return true;
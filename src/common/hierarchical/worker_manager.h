@@ -13,7 +13,11 @@
  * WorkerManager — worker pool lifecycle and dispatch.
  *
  * Owns WorkerThread instances (one per registered worker).
- * Provides idle-worker selection and dispatch to the Scheduler.
+ * Provides idle-worker selection and dispatch to the Scheduler. Selection is
+ * load-aware: each thread tracks its in-flight depth and an EWMA of recent
+ * task durations, and `pick_for_dispatch` prefers the cheapest idle worker —
+ * on a heterogeneous chip mix the fast workers drain the tail instead of
+ * idling behind a first-fit scan.
  * The Scheduler drives the DAG; the Manager drives the workers.
  *
  * Each WorkerThread operates in one of two modes:
@@ -132,18 +136,42 @@ public:
     // `ring` is a borrowed pointer to the engine's slot-state pool —
     // the thread reads callable/args/config from
     // `ring->slot_state(task_slot)` on each dispatch.
-    // on_complete(slot) is called (in the WorkerThread) after each run().
+    // After each run() the thread posts the slot to its SPSC completion
+    // ring and calls on_posted() (if set) to wake the consumer; it falls
+    // back to on_complete(slot) — the locked per-event path — only when
+    // the ring is full.
+    // `logical_id` is the worker's index within its manager pool (the same
+    // id the `affinities` pin and TaskSlotState::ran_on use).
     void start(
         Mode mode, IWorker *worker, Ring *ring, const std::function<void(TaskSlot)> &on_complete,
-        void *mailbox = nullptr
+        void *mailbox = nullptr, int logical_id = 0, const std::function<void()> &on_posted = {}
     );
 
     // Enqueue a dispatch for the worker. Non-blocking.
     void dispatch(WorkerDispatch d);
 
+    // Consumer side of the SPSC completion ring (Scheduler thread only).
+    // Pops the oldest posted completion; false when the ring is empty.
+    bool pop_completion(TaskSlot &slot);
+
+    // True if the completion ring has undrained entries.
+    bool completion_pending() const {
+        return comp_head_.load(std::memory_order_relaxed) != comp_tail_.load(std::memory_order_acquire);
+    }
+
     // True if the worker has no active task.
     bool idle() const { return idle_.load(std::memory_order_acquire); }
 
+    // Dispatches accepted but not yet finished (queued + running).
+    int32_t inflight() const { return inflight_.load(std::memory_order_acquire); }
+
+    // EWMA of recent run() durations in microseconds (0 = no history yet).
+    // Heterogeneous pools show markedly different values per worker; the
+    // manager's load-aware pick uses this to keep fast workers fed at tail.
+    uint64_t avg_task_us() const { return avg_task_us_.load(std::memory_order_relaxed); }
+
+    int logical_id() const { return logical_id_; }
+
     void stop();
 
     // PROCESS mode only: write SHUTDOWN to the mailbox so the child
@@ -155,17 +183,38 @@ public:
     // thread may be running a task (MemoryAllocator is mutex-protected).
     // THREAD mode: direct call on the ChipWorker.
     // PROCESS mode: control command via mailbox (blocks until child responds).
+    // Serialized by control_mu_: the Orchestrator's async copy thread may
+    // issue copies concurrently with malloc/free from the orch thread, and
+    // the PROCESS-mode mailbox supports one in-flight command at a time.
     uint64_t control_malloc(size_t size);
     void control_free(uint64_t ptr);
     void control_copy_to(uint64_t dst, uint64_t src, size_t size);
     void control_copy_from(uint64_t dst, uint64_t src, size_t size);
 
+    // Direct device-to-device copy into this worker's memory. Returns false
+    // when no direct path exists (PROCESS mode — the child owns the device
+    // context — or the platform declines); the caller stages through host.
+    bool control_copy_between(uint64_t dst, uint64_t src, size_t size);
+
 private:
+    std::mutex control_mu_;
     Mode mode_{Mode::THREAD};
     IWorker *worker_{nullptr};
     Ring *ring_{nullptr};
     void *mailbox_{nullptr};
     std::function<void(TaskSlot)> on_complete_;
+    std::function<void()> on_posted_;
+
+    // SPSC completion ring: this thread is the sole producer, the Scheduler
+    // thread the sole consumer, so posting a completion is two relaxed loads
+    // plus one release store — no lock on the per-task hot path. Capacity is
+    // a power of two; cursors grow monotonically and are masked on access.
+    static constexpr uint32_t COMPLETION_RING_CAP = 256;
+    TaskSlot completion_ring_[COMPLETION_RING_CAP];
+    std::atomic<uint32_t> comp_head_{0};  // consumer cursor
+    std::atomic<uint32_t> comp_tail_{0};  // producer cursor
+
+    bool try_push_completion(TaskSlot slot);
 
     std::thread thread_;
     std::queue<WorkerDispatch> queue_;
@@ -173,6 +222,9 @@ private:
     std::condition_variable cv_;
     bool shutdown_{false};
     std::atomic<bool> idle_{true};
+    std::atomic<int32_t> inflight_{0};
+    std::atomic<uint64_t> avg_task_us_{0};
+    int logical_id_{0};
 
     void loop();
     void dispatch_thread(TaskSlotState &s, int32_t group_index);
@@ -190,6 +242,7 @@ private:
 class WorkerManager {
 public:
     using OnCompleteFn = std::function<void(TaskSlot)>;
+    using OnPostedFn = std::function<void()>;
 
     // THREAD mode: worker is called directly.
     void add_next_level(IWorker *worker);
@@ -200,20 +253,57 @@ public:
     void add_next_level_process(void *mailbox);
     void add_sub_process(void *mailbox);
 
-    void start(Ring *ring, const OnCompleteFn &on_complete);
+    // `on_complete` is the locked fallback path (ring overflow); `on_posted`
+    // wakes the Scheduler after a completion lands in a worker's SPSC ring.
+    void start(Ring *ring, const OnCompleteFn &on_complete, const OnPostedFn &on_posted = {});
     void stop();
 
+    // Pop every pending entry from all per-worker completion rings into
+    // `out` (appended). Scheduler thread only — it is the sole consumer.
+    void drain_completions(std::vector<TaskSlot> &out) const;
+
+    // True if any worker's completion ring has undrained entries.
+    bool completions_pending() const;
+
     WorkerThread *pick_idle(WorkerType type) const;
     std::vector<WorkerThread *> pick_n_idle(WorkerType type, int n) const;
 
     // Direct index into the worker pool by logical id (0-based).
     WorkerThread *get_worker(WorkerType type, int logical_id) const;
 
-    // Pick one idle worker NOT in `exclude`. Returns nullptr if none available.
-    WorkerThread *pick_idle_excluding(WorkerType type, const std::vector<WorkerThread *> &exclude) const;
+    // Pass-through dispatch target: when a pool holds exactly one worker
+    // there is nothing to pick, so readiness can collapse to a direct
+    // WorkerThread::dispatch — no ready-queue hop through the Scheduler.
+    // Returns nullptr for pools with zero or several workers. Valid after
+    // start().
+    WorkerThread *single_worker(WorkerType type) const;
+
+    // Load-aware pick: among idle workers of `type` not in `exclude`, choose
+    // the one with the lowest estimated cost (in-flight depth x recent avg
+    // task duration). `preferred` is a logical id acting as a soft hint
+    // (-1 = none): it wins while its cost stays within 2x of the best
+    // candidate's, so a skewed (slow or backlogged) preferred worker is
+    // overridden rather than serializing a chain behind it. A candidate
+    // with no duration history never overrides the hint.
+    // Returns nullptr if no idle worker is available.
+    WorkerThread *pick_for_dispatch(WorkerType type, int8_t preferred, const std::vector<WorkerThread *> &exclude) const;
 
     bool any_busy() const;
 
+    // --- Static graph partitioning ---
+    // `partition_workers[p]` is the NEXT_LEVEL logical worker id that owns
+    // partition p (-1 = unmapped). Set once after registering workers and
+    // before submitting partitioned work; Orchestrator::submit_partitioned
+    // consults the map on every submit. Throws if an entry references a
+    // worker that was never registered.
+    void set_partition_map(const std::vector<int8_t> &partition_workers);
+
+    // Logical worker id owning `partition`, or -1 when the partition is
+    // out of range or unmapped.
+    int8_t partition_worker(int32_t partition) const;
+
+    int32_t partition_count() const { return static_cast<int32_t>(partition_workers_.size()); }
+
     // Write SHUTDOWN to every PROCESS-mode mailbox.
     void shutdown_children();
 
@@ -227,6 +317,9 @@ private:
     std::vector<WorkerEntry> next_level_entries_;
     std::vector<WorkerEntry> sub_entries_;
 
+    // Partition → NEXT_LEVEL logical worker id (static; set before submits).
+    std::vector<int8_t> partition_workers_;
+
     std::vector<std::unique_ptr<WorkerThread>> next_level_threads_;
     std::vector<std::unique_ptr<WorkerThread>> sub_threads_;
 };
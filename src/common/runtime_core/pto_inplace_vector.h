@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Shared runtime core: fixed-capacity inline vector template.
+ *
+ * Architecture-neutral building block consumed by the tensormap_and_ringbuffer
+ * runtimes (see README.md in this directory). Changes here reach every chip
+ * generation in one commit; do not fork a per-arch copy.
+ *
+ * Single-threaded push/pop stack with the storage embedded in the owning
+ * struct: no init-time allocation, no failure path to unwind, and element
+ * access is a direct offset instead of a pointer chase. Capacity comes from
+ * a compile-time runtime-config constant; exceeding it is a caller bug
+ * (guarded by debug assertions at the call sites, as with the raw arrays
+ * this replaces).
+ *
+ * T must be trivially copyable and trivially destructible — elements live
+ * in a plain array and are never individually destroyed.
+ */
+
+#ifndef SRC_COMMON_RUNTIME_CORE_PTO_INPLACE_VECTOR_H_
+#define SRC_COMMON_RUNTIME_CORE_PTO_INPLACE_VECTOR_H_
+
+#include <stdint.h>
+
+#include <type_traits>
+
+template <typename T, int32_t Capacity>
+struct PTO2InplaceVectorT {
+    static_assert(std::is_trivially_copyable<T>::value, "elements are stored in a plain array");
+    static_assert(std::is_trivially_destructible<T>::value, "elements are never individually destroyed");
+    static_assert(Capacity > 0, "capacity must be positive");
+
+    static constexpr int32_t kCapacity = Capacity;
+
+    T items_[Capacity];
+    int32_t size_{0};
+
+    int32_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    bool full() const { return size_ == Capacity; }
+    void clear() { size_ = 0; }
+
+    void push_back(T v) { items_[size_++] = v; }
+    void pop_back() { --size_; }
+
+    T &back() { return items_[size_ - 1]; }
+    const T &back() const { return items_[size_ - 1]; }
+
+    T &operator[](int32_t i) { return items_[i]; }
+    const T &operator[](int32_t i) const { return items_[i]; }
+};
+
+#endif  // SRC_COMMON_RUNTIME_CORE_PTO_INPLACE_VECTOR_H_
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Shared runtime core: SPSC queue template.
+ *
+ * Architecture-neutral building block consumed by both the a2a3 and a5
+ * tensormap_and_ringbuffer runtimes (see README.md in this directory).
+ * Changes here reach every chip generation in one commit; do not fork a
+ * per-arch copy.
+ *
+ * Bounded single-producer single-consumer ring buffer, wait-free on both
+ * sides. Design based on Rigtorp's cached-index technique: each side caches
+ * the other's index locally, avoiding cross-core cache line bouncing on the
+ * hot path. Only when the local cache says "full" or "empty" does the thread
+ * issue an acquire load on the remote index.
+ *
+ * Memory layout: 4 cache-line-aligned fields ensure zero false sharing.
+ * T must be trivially copyable (elements are relayed through a raw buffer).
+ */
+
+#ifndef SRC_COMMON_RUNTIME_CORE_PTO_SPSC_QUEUE_H_
+#define SRC_COMMON_RUNTIME_CORE_PTO_SPSC_QUEUE_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <atomic>
+
+template <typename T>
+struct PTO2SpscQueueT {
+    // --- Producer cache lines ---
+    alignas(64) std::atomic<uint64_t> head_{0};
+    alignas(64) uint64_t tail_cached_{0};
+
+    // --- Consumer cache lines ---
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    alignas(64) uint64_t head_cached_{0};
+
+    // --- Shared (immutable after init) ---
+    T *buffer_{nullptr};
+    uint64_t mask_{0};
+
+    bool init(uint64_t capacity) {
+        if (capacity == 0 || (capacity & (capacity - 1)) != 0) return false;
+        buffer_ = static_cast<T *>(calloc(capacity, sizeof(T)));
+        if (!buffer_) return false;
+        mask_ = capacity - 1;
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+        tail_cached_ = 0;
+        head_cached_ = 0;
+        return true;
+    }
+
+    void destroy() {
+        if (buffer_) {
+            free(buffer_);
+            buffer_ = nullptr;
+        }
+    }
+
+    // Reset to empty (both endpoints must be idle).
+    void reset() {
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+        tail_cached_ = 0;
+        head_cached_ = 0;
+    }
+
+    // Push one item (producer only). Returns false if queue is full.
+    // Full condition: next_h - tail > mask_ (i.e. > capacity-1), so the
+    // effective usable capacity is capacity-1 (one slot is wasted as a
+    // sentinel to distinguish full from empty). uint64_t wrapping is safe
+    // since head and tail are monotonically increasing and subtraction
+    // wraps correctly.
+    bool push(T item) {
+        uint64_t h = head_.load(std::memory_order_relaxed);
+        uint64_t next_h = h + 1;
+        if (next_h - tail_cached_ > mask_) {
+            tail_cached_ = tail_.load(std::memory_order_acquire);
+            if (next_h - tail_cached_ > mask_) {
+                return false;
+            }
+        }
+        buffer_[h & mask_] = item;
+        head_.store(next_h, std::memory_order_release);
+        return true;
+    }
+
+    // Pop up to max_count items (consumer only). Returns actual count.
+    int pop_batch(T *out, int max_count) {
+        uint64_t t = tail_.load(std::memory_order_relaxed);
+        uint64_t avail = head_cached_ - t;
+        if (avail == 0) {
+            head_cached_ = head_.load(std::memory_order_acquire);
+            avail = head_cached_ - t;
+            if (avail == 0) return 0;
+        }
+        int count = (avail < static_cast<uint64_t>(max_count)) ? static_cast<int>(avail) : max_count;
+        for (int i = 0; i < count; i++) {
+            out[i] = buffer_[(t + i) & mask_];
+        }
+        tail_.store(t + count, std::memory_order_release);
+        return count;
+    }
+
+    // Approximate size (used for backoff decisions, not exact).
+    uint64_t size() const {
+        uint64_t h = head_.load(std::memory_order_acquire);
+        uint64_t t = tail_.load(std::memory_order_acquire);
+        return h - t;
+    }
+};
+
+#endif  // SRC_COMMON_RUNTIME_CORE_PTO_SPSC_QUEUE_H_
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * Shared runtime core: bounded work-stealing deque template.
+ *
+ * Architecture-neutral building block consumed by the tensormap_and_ringbuffer
+ * runtimes (see README.md in this directory). Changes here reach every chip
+ * generation in one commit; do not fork a per-arch copy.
+ *
+ * Bounded Chase-Lev deque with inline storage: the owner pushes and pops at
+ * the bottom without atomic RMWs on the hot path; thieves steal single
+ * entries from the top via CAS. Capacity is a compile-time parameter so the
+ * ring lives inside the owning struct — no separate backing array to
+ * allocate, wire up, or chase through a pointer on every push.
+ *
+ * T must be a pointer type (empty pop/steal is signalled by nullptr).
+ */
+
+#ifndef SRC_COMMON_RUNTIME_CORE_PTO_WS_DEQUE_H_
+#define SRC_COMMON_RUNTIME_CORE_PTO_WS_DEQUE_H_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <type_traits>
+
+template <typename T, int32_t Capacity>
+struct PTO2WorkStealingDequeT {
+    static_assert(std::is_pointer<T>::value, "element type must be a pointer (nullptr = empty)");
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "capacity must be a power of 2");
+
+    static constexpr int32_t kCapacity = Capacity;
+    static constexpr int32_t kMask = Capacity - 1;
+
+    T slots_[Capacity];
+
+    std::atomic<int64_t> bottom_{0};  // Owner end: push/pop here
+    std::atomic<int64_t> top_{0};     // Thief end: steal here
+
+    void reset() {
+        bottom_.store(0, std::memory_order_relaxed);
+        top_.store(0, std::memory_order_relaxed);
+    }
+
+    int32_t size() const {
+        int64_t b = bottom_.load(std::memory_order_relaxed);
+        int64_t t = top_.load(std::memory_order_relaxed);
+        return (b > t) ? static_cast<int32_t>(b - t) : 0;
+    }
+
+    // Owner only.
+    bool try_push(T s) {
+        int64_t b = bottom_.load(std::memory_order_relaxed);
+        int64_t t = top_.load(std::memory_order_acquire);
+        if (b - t >= Capacity) {
+            return false;
+        }
+        slots_[b & kMask] = s;
+        bottom_.store(b + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Owner only.  Races with thieves on the last element via CAS on top.
+    T pop() {
+        int64_t b = bottom_.load(std::memory_order_relaxed) - 1;
+        bottom_.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top_.load(std::memory_order_relaxed);
+        if (t > b) {
+            // Empty — restore bottom.
+            bottom_.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        T s = slots_[b & kMask];
+        if (t == b) {
+            // Last element: arbitrate with concurrent steals.
+            if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                s = nullptr;  // A thief won
+            }
+            bottom_.store(b + 1, std::memory_order_relaxed);
+        }
+        return s;
+    }
+
+    // Thief only.  Steals the oldest entry; returns nullptr on empty or lost race.
+    T steal() {
+        int64_t t = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = bottom_.load(std::memory_order_acquire);
+        if (t >= b) {
+            return nullptr;
+        }
+        T s = slots_[t & kMask];
+        if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return s;
+    }
+};
+
+#endif  // SRC_COMMON_RUNTIME_CORE_PTO_WS_DEQUE_H_
@@ -35,11 +35,16 @@
 #include "cpu_sim_context.h"
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdlib>
+#include <memory>
 #include <mutex>
 #include <pthread.h>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 namespace {
 
@@ -63,9 +68,27 @@ struct PipeStateKeyHash {
     }
 };
 
+// One persistent host thread simulating one core. The slot cycles
+// idle -> job set -> running -> idle; dispatch requires the idle state
+// (DeviceRunner dispatches each core exactly once per run and waits for
+// the whole pool to drain before the next run).
+struct SimCoreSlot {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::function<void()> job;
+    bool stop{false};
+    std::thread thread;
+};
+
 struct DeviceSimContext {
     std::mutex pipe_state_mutex;
     std::unordered_map<PipeStateKey, void *, PipeStateKeyHash> pipe_states;
+
+    // Simulated-core thread pool (grow-only, threads live until release)
+    std::mutex pool_mutex;
+    std::condition_variable pool_idle_cv;
+    std::vector<std::unique_ptr<SimCoreSlot>> core_pool;
+    int pool_jobs_in_flight{0};
 };
 
 std::mutex g_registry_mutex;
@@ -87,6 +110,10 @@ constexpr intptr_t DEVICE_ID_OFFSET = 1;
 
 std::mutex g_device_key_mutex;
 pthread_key_t g_device_id_key{};
+// Cached DeviceSimContext* for the bound device. Every pto-isa hook call
+// goes through get_current_device_context(); without the cache each call
+// takes g_registry_mutex, which serializes all simulated cores on one lock.
+pthread_key_t g_device_ctx_key{};
 std::atomic<bool> g_device_key_initialized{false};
 
 void ensure_device_key() {
@@ -98,6 +125,10 @@ void ensure_device_key() {
         if (pthread_key_create(&g_device_id_key, nullptr) != 0) {
             return;
         }
+        if (pthread_key_create(&g_device_ctx_key, nullptr) != 0) {
+            pthread_key_delete(g_device_id_key);
+            return;
+        }
         g_device_key_initialized.store(true, std::memory_order_release);
     }
 }
@@ -111,8 +142,19 @@ int get_current_device_id() {
 }
 
 DeviceSimContext *get_current_device_context() {
+    auto *cached = static_cast<DeviceSimContext *>(pthread_getspecific(g_device_ctx_key));
+    if (cached != nullptr) {
+        return cached;
+    }
     int id = get_current_device_id();
-    return (id >= 0) ? lookup_device_context(id) : nullptr;
+    DeviceSimContext *ctx = (id >= 0) ? lookup_device_context(id) : nullptr;
+    if (ctx != nullptr) {
+        // Safe to cache: a device's context outlives every thread bound to it
+        // (release_device requires all worker threads joined first), and
+        // pto_cpu_sim_bind_device invalidates the cache on rebind.
+        pthread_setspecific(g_device_ctx_key, ctx);
+    }
+    return ctx;
 }
 
 // ---------------------------------------------------------------------------
@@ -151,6 +193,8 @@ void ensure_identity_keys() {
 extern "C" void pto_cpu_sim_bind_device(int device_id) {
     ensure_device_key();
     pthread_setspecific(g_device_id_key, reinterpret_cast<void *>(static_cast<intptr_t>(device_id + DEVICE_ID_OFFSET)));
+    // Invalidate the cached context; it is re-resolved lazily on next use.
+    pthread_setspecific(g_device_ctx_key, nullptr);
 }
 
 extern "C" int pto_cpu_sim_get_bound_device(void) { return get_current_device_id(); }
@@ -181,6 +225,21 @@ extern "C" void pto_cpu_sim_release_device(int device_id) {
         g_device_contexts.erase(it);
     }
 
+    // Stop and join the core pool before tearing the context down. Callers
+    // must have drained outstanding jobs with sim_core_pool_wait_idle().
+    for (auto &slot : ctx->core_pool) {
+        {
+            std::lock_guard<std::mutex> lock(slot->mutex);
+            slot->stop = true;
+        }
+        slot->cv.notify_one();
+    }
+    for (auto &slot : ctx->core_pool) {
+        if (slot->thread.joinable()) {
+            slot->thread.join();
+        }
+    }
+
     {
         std::lock_guard<std::mutex> lock(ctx->pipe_state_mutex);
         for (auto &[key, storage] : ctx->pipe_states) {
@@ -204,6 +263,187 @@ void clear_cpu_sim_shared_storage() {
     ctx->pipe_states.clear();
 }
 
+// ---------------------------------------------------------------------------
+// Virtual clock (opt-in via PTO_SIM_VIRTUAL_TIME=1)
+// ---------------------------------------------------------------------------
+
+namespace {
+
+// Every spin-wait poll costs one tick; when all actors are polling the clock
+// leaps so time-based waits resolve without burning wall time.
+constexpr uint64_t VCLOCK_SPIN_COST_TICKS = 1;
+constexpr uint64_t VCLOCK_IDLE_LEAP_TICKS = 1024;
+
+// Bound on the real time a blocked actor sleeps per poll. Actors busy in
+// host work (kernel execution, dlopen) never touch the clock, so waiters
+// must periodically re-poll shared memory to observe their stores.
+constexpr auto VCLOCK_WAIT_SLICE = std::chrono::microseconds(100);
+
+std::atomic<uint64_t> g_vclock_ticks{0};
+std::mutex g_vclock_mutex;
+std::condition_variable g_vclock_cv;
+int g_vclock_actor_count = 0;
+int g_vclock_blocked = 0;
+
+}  // namespace
+
+extern "C" int pto_sim_vclock_enabled(void) {
+    static const int enabled = []() {
+        const char *env = std::getenv("PTO_SIM_VIRTUAL_TIME");
+        return (env != nullptr && env[0] == '1') ? 1 : 0;
+    }();
+    return enabled;
+}
+
+extern "C" uint64_t pto_sim_vclock_now(void) { return g_vclock_ticks.load(std::memory_order_acquire); }
+
+extern "C" void pto_sim_vclock_set_actor_count(int count) {
+    {
+        std::lock_guard<std::mutex> lock(g_vclock_mutex);
+        g_vclock_actor_count = count;
+        g_vclock_blocked = 0;
+    }
+    // Wake any waiter left over from a previous run
+    g_vclock_cv.notify_all();
+}
+
+extern "C" void pto_sim_vclock_advance(uint64_t ticks) {
+    g_vclock_ticks.fetch_add(ticks, std::memory_order_acq_rel);
+    g_vclock_cv.notify_all();
+}
+
+extern "C" void pto_sim_vclock_spin_wait(void) {
+    uint64_t entry = g_vclock_ticks.fetch_add(VCLOCK_SPIN_COST_TICKS, std::memory_order_acq_rel);
+
+    std::unique_lock<std::mutex> lock(g_vclock_mutex);
+    if (g_vclock_actor_count > 0 && g_vclock_blocked + 1 >= g_vclock_actor_count) {
+        // Last runnable actor just blocked: nothing can progress until time
+        // moves, so jump the clock and release everyone to re-poll.
+        lock.unlock();
+        g_vclock_ticks.fetch_add(VCLOCK_IDLE_LEAP_TICKS, std::memory_order_acq_rel);
+        g_vclock_cv.notify_all();
+        return;
+    }
+    g_vclock_blocked++;
+    g_vclock_cv.wait_for(lock, VCLOCK_WAIT_SLICE, [entry]() {
+        return g_vclock_ticks.load(std::memory_order_acquire) != entry + VCLOCK_SPIN_COST_TICKS;
+    });
+    g_vclock_blocked--;
+}
+
+// ---------------------------------------------------------------------------
+// Per-kernel cycle-cost model (virtual-time mode only)
+// ---------------------------------------------------------------------------
+
+namespace {
+
+std::mutex g_cost_model_mutex;
+std::unordered_map<uint64_t, uint64_t> g_cost_model;  // kernel entry addr -> cycles
+
+uint64_t cost_model_default_ticks() {
+    static const uint64_t default_ticks = []() -> uint64_t {
+        const char *env = std::getenv("PTO_SIM_COST_DEFAULT_TICKS");
+        return (env != nullptr) ? std::strtoull(env, nullptr, 10) : 0;
+    }();
+    return default_ticks;
+}
+
+}  // namespace
+
+extern "C" void pto_sim_cost_model_register(uint64_t fn_addr, uint64_t cycles) {
+    std::lock_guard<std::mutex> lock(g_cost_model_mutex);
+    g_cost_model[fn_addr] = cycles;
+}
+
+extern "C" void pto_sim_cost_model_charge(uint64_t fn_addr) {
+    if (pto_sim_vclock_enabled() == 0) {
+        return;
+    }
+
+    uint64_t cycles = cost_model_default_ticks();
+    {
+        std::lock_guard<std::mutex> lock(g_cost_model_mutex);
+        auto it = g_cost_model.find(fn_addr);
+        if (it != g_cost_model.end()) {
+            cycles = it->second;
+        }
+    }
+    if (cycles != 0) {
+        pto_sim_vclock_advance(cycles);
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Simulated-core thread pool
+// ---------------------------------------------------------------------------
+
+void sim_core_pool_resize(int device_id, int num_cores) {
+    DeviceSimContext *ctx = lookup_device_context(device_id);
+    if (ctx == nullptr || num_cores <= 0) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(ctx->pool_mutex);
+    while (ctx->core_pool.size() < static_cast<size_t>(num_cores)) {
+        auto slot = std::make_unique<SimCoreSlot>();
+        SimCoreSlot *s = slot.get();
+        s->thread = std::thread([device_id, ctx, s]() {
+            pto_cpu_sim_bind_device(device_id);
+            std::unique_lock<std::mutex> slot_lock(s->mutex);
+            for (;;) {
+                s->cv.wait(slot_lock, [s]() { return s->stop || s->job; });
+                if (s->stop) {
+                    return;
+                }
+                std::function<void()> job = std::move(s->job);
+                s->job = nullptr;
+                slot_lock.unlock();
+                job();
+                slot_lock.lock();
+                {
+                    std::lock_guard<std::mutex> pool_lock(ctx->pool_mutex);
+                    ctx->pool_jobs_in_flight--;
+                }
+                ctx->pool_idle_cv.notify_all();
+            }
+        });
+        ctx->core_pool.push_back(std::move(slot));
+    }
+}
+
+void sim_core_pool_dispatch(int device_id, int core_idx, std::function<void()> job) {
+    DeviceSimContext *ctx = lookup_device_context(device_id);
+    if (ctx == nullptr || core_idx < 0) {
+        return;
+    }
+
+    SimCoreSlot *slot = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(ctx->pool_mutex);
+        if (static_cast<size_t>(core_idx) >= ctx->core_pool.size()) {
+            return;
+        }
+        slot = ctx->core_pool[core_idx].get();
+        ctx->pool_jobs_in_flight++;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(slot->mutex);
+        slot->job = std::move(job);
+    }
+    slot->cv.notify_one();
+}
+
+void sim_core_pool_wait_idle(int device_id) {
+    DeviceSimContext *ctx = lookup_device_context(device_id);
+    if (ctx == nullptr) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(ctx->pool_mutex);
+    ctx->pool_idle_cv.wait(lock, [ctx]() { return ctx->pool_jobs_in_flight == 0; });
+}
+
 // ---------------------------------------------------------------------------
 // Per-thread core identity setters (called by sim aicore platform code)
 // ---------------------------------------------------------------------------
@@ -54,12 +54,84 @@ uint32_t pto_sim_get_subblock_id(void);
  */
 void *pto_sim_get_pipe_shared_state(uint64_t pipe_key, size_t size);
 
+/*
+ * Virtual clock (opt-in via PTO_SIM_VIRTUAL_TIME=1).
+ *
+ * In virtual-time mode the sim runs against a process-wide logical clock
+ * instead of wall time: each spin-wait poll charges a fixed tick cost, and
+ * when every registered actor (AICPU thread or simulated core) is blocked
+ * in a spin-wait the clock leaps forward so idle periods cost no real time.
+ * Timestamps are derived from logical progress, not the host clock, so the
+ * same workload yields reproducible traces across runs and machines.
+ *
+ * DeviceRunner injects pto_sim_vclock_now/pto_sim_vclock_spin_wait into the
+ * AICPU and AICore SOs after dlopen (same pattern as the identity helpers).
+ */
+
+/** Return 1 when PTO_SIM_VIRTUAL_TIME=1 is set in the environment. */
+int pto_sim_vclock_enabled(void);
+
+/** Current logical clock value in ticks. */
+uint64_t pto_sim_vclock_now(void);
+
+/** Set the number of actors participating in the idle-leap protocol (0 between runs). */
+void pto_sim_vclock_set_actor_count(int count);
+
+/** Charge logical work to the clock (e.g., a modeled kernel cost). */
+void pto_sim_vclock_advance(uint64_t ticks);
+
+/** One spin-wait poll: charges the poll cost and blocks until the clock moves. */
+void pto_sim_vclock_spin_wait(void);
+
+/*
+ * Per-kernel cycle-cost model (virtual-time mode only).
+ *
+ * Kernels complete in host time in sim, so ready-queue dynamics look
+ * nothing like hardware. The cost model charges a per-kernel cycle
+ * estimate to the virtual clock after each task executes, keyed by the
+ * resolved kernel entry address (the sim dispatch payload carries no
+ * func_id). DeviceRunner registers entries at kernel upload from a
+ * measured table (PTO_SIM_COST_MODEL=<file> with "func_id cycles" lines);
+ * unregistered kernels fall back to PTO_SIM_COST_DEFAULT_TICKS (0 = no
+ * charge).
+ */
+
+/** Register a cycle cost for the kernel entry at fn_addr. */
+void pto_sim_cost_model_register(uint64_t fn_addr, uint64_t cycles);
+
+/** Charge the modeled cost of fn_addr to the virtual clock (no-op when wall-clock). */
+void pto_sim_cost_model_charge(uint64_t fn_addr);
+
 #ifdef __cplusplus
 }
 #endif
 
 #ifdef __cplusplus
 
+#include <functional>
+
+/**
+ * Per-device simulated-core thread pool.
+ *
+ * Spawning one fresh std::thread per simulated core on every run serializes
+ * launch behind thread creation and loses any warm scheduler placement. The
+ * pool keeps one host thread per simulated core alive across runs, bound to
+ * its device once, so back-to-back sim runs exercise the same shared-memory
+ * handshake as onboard without per-run thread churn.
+ *
+ * Threads are joined by pto_cpu_sim_release_device(); callers must drain
+ * outstanding jobs with sim_core_pool_wait_idle() before releasing.
+ */
+
+/** Ensure the device's core pool has at least num_cores threads (grow-only). */
+void sim_core_pool_resize(int device_id, int num_cores);
+
+/** Run job on the pool thread for core_idx. The slot must be idle. */
+void sim_core_pool_dispatch(int device_id, int core_idx, std::function<void()> job);
+
+/** Block until every dispatched job on the device's pool has completed. */
+void sim_core_pool_wait_idle(int device_id);
+
 /**
  * Set the current thread's simulated subblock_id.
  * Called by aicore_execute_wrapper (via function pointer injection).
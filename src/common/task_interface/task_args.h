@@ -81,10 +81,15 @@ struct TensorTagMixin<void, 0> {};
 
 template <typename T, typename S, size_t MaxT, size_t MaxS, typename TensorTag = void>
 struct TaskArgsTpl : TensorTagMixin<TensorTag, MaxT> {
-    T tensors_[MaxT];
-    S scalars_[MaxS];
+    // Hot-first layout: dispatch reads the counts and then walks tensors_
+    // (and usually the first few scalars), so the counts lead and share
+    // their cache line with the head of the tensor array instead of
+    // trailing several KB behind it. Tag storage (submit-time direction
+    // flags) stays in the mixin base — empty for the tagless ABI POD.
     int32_t tensor_count_{0};
     int32_t scalar_count_{0};
+    T tensors_[MaxT];
+    S scalars_[MaxS];
 
     void add_tensor(const T &t) {
         if (scalar_count_ > 0) throw std::logic_error("TaskArgs: cannot add tensor after scalar");
@@ -100,6 +105,27 @@ struct TaskArgsTpl : TensorTagMixin<TensorTag, MaxT> {
     const T &tensor(int32_t i) const { return tensors_[i]; }
     T &tensor(int32_t i) { return tensors_[i]; }
 
+    // Typed scalar access — bit-puns any <=8-byte trivially-copyable value
+    // in/out of the inline slot, so lengths, indices, and float scales
+    // round-trip without manual punning. Scalars stay inline in the
+    // descriptor and never enter dependency inference (infer_deps walks
+    // tensors only), so this is the cheap path for non-tensor arguments.
+    template <typename V>
+    void add_scalar_as(V v) {
+        static_assert(sizeof(V) <= sizeof(S) && std::is_trivially_copyable_v<V>, "scalar value must fit the slot");
+        S s{};
+        std::memcpy(&s, &v, sizeof(V));
+        add_scalar(s);
+    }
+
+    template <typename V>
+    V scalar_as(int32_t i) const {
+        static_assert(sizeof(V) <= sizeof(S) && std::is_trivially_copyable_v<V>, "scalar value must fit the slot");
+        V v;
+        std::memcpy(&v, &scalars_[i], sizeof(V));
+        return v;
+    }
+
     S scalar(int32_t i) const { return scalars_[i]; }
     S &scalar(int32_t i) { return scalars_[i]; }
 
@@ -144,6 +170,23 @@ struct TaskArgsTpl<T, S, 0, 0, TensorTag> : TensorTagMixin<TensorTag, 0> {
 
     void add_scalar(S s) { scalars_.push_back(s); }
 
+    // Typed scalar access — see the static specialization for semantics.
+    template <typename V>
+    void add_scalar_as(V v) {
+        static_assert(sizeof(V) <= sizeof(S) && std::is_trivially_copyable_v<V>, "scalar value must fit the slot");
+        S s{};
+        std::memcpy(&s, &v, sizeof(V));
+        add_scalar(s);
+    }
+
+    template <typename V>
+    V scalar_as(int32_t i) const {
+        static_assert(sizeof(V) <= sizeof(S) && std::is_trivially_copyable_v<V>, "scalar value must fit the slot");
+        V v;
+        std::memcpy(&v, &scalars_[static_cast<size_t>(i)], sizeof(V));
+        return v;
+    }
+
     const T &tensor(int32_t i) const { return tensors_[static_cast<size_t>(i)]; }
     T &tensor(int32_t i) { return tensors_[static_cast<size_t>(i)]; }
 
@@ -178,6 +221,12 @@ using TaskArgs = TaskArgsTpl<ContinuousTensor, uint64_t, 0, 0, TensorArgType>;
 // Assembled from a TaskArgsView on the child side just before pto2_run_runtime.
 using ChipStorageTaskArgs = TaskArgsTpl<ContinuousTensor, uint64_t, CHIP_MAX_TENSOR_ARGS, 128>;
 
+// Dispatch reads counts then tensors: the counts must lead so the first
+// access pulls the head of the tensor array in the same line, and every
+// target linking runtime.so must agree on this layout.
+static_assert(offsetof(ChipStorageTaskArgs, tensor_count_) == 0, "counts must lead ChipStorageTaskArgs");
+static_assert(offsetof(ChipStorageTaskArgs, tensors_) == 8, "tensor array must follow the counts directly");
+
 // ============================================================================
 // TaskArgsView — zero-copy view used by IWorker::run and the wire format
 // ============================================================================
@@ -13,13 +13,19 @@
 
 #include <dlfcn.h>
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
+#include <future>
 #include <mutex>
 #include <stdexcept>
 #include <string>
 #include <thread>
 #include <vector>
 
+#include "launch_trace.h"
+
 namespace {
 
 template <typename T>
@@ -37,6 +43,19 @@ T load_symbol(void *handle, const char *name) {
     return reinterpret_cast<T>(sym);
 }
 
+// Like load_symbol(), but returns nullptr instead of throwing. Used for
+// symbols added after the initial C API (a runtime SO built from an older
+// tree simply loses the associated optimization).
+template <typename T>
+T load_symbol_optional(void *handle, const char *name) {
+    dlerror();
+    void *sym = dlsym(handle, name);
+    if (dlerror() != nullptr) {
+        return nullptr;
+    }
+    return reinterpret_cast<T>(sym);
+}
+
 // Process-wide singleton: libcpu_sim_context.so is loaded once with
 // RTLD_GLOBAL so that host_runtime.so can resolve sim_context_set_* and
 // pto_sim_get_* symbols at runtime.  Never dlclosed.
@@ -79,7 +98,7 @@ ChipWorker::~ChipWorker() { finalize(); }
 
 void ChipWorker::init(
     const std::string &host_lib_path, const std::string &aicpu_path, const std::string &aicore_path,
-    const std::string &sim_context_lib_path
+    const std::string &sim_context_lib_path, bool enable_launch_trace
 ) {
     if (finalized_) {
         throw std::runtime_error("ChipWorker already finalized; cannot reinitialize");
@@ -88,6 +107,11 @@ void ChipWorker::init(
         throw std::runtime_error("ChipWorker already initialized; runtime cannot be changed");
     }
 
+    if (enable_launch_trace) {
+        LaunchTraceRecorder::instance().set_enabled(true);
+    }
+    uint64_t trace_begin = LaunchTraceRecorder::now_ns();
+
     // Load the sim context SO with RTLD_GLOBAL (once per process) so that
     // PTO ISA TPUSH/TPOP can resolve pto_sim_get_subblock_id and
     // pto_sim_get_pipe_shared_state via dlsym(RTLD_DEFAULT).
@@ -121,29 +145,83 @@ void ChipWorker::init(
         get_runtime_size_fn_ = load_symbol<GetRuntimeSizeFn>(handle, "get_runtime_size");
         run_runtime_fn_ = load_symbol<RunRuntimeFn>(handle, "run_runtime");
         finalize_device_fn_ = load_symbol<FinalizeDeviceFn>(handle, "finalize_device");
+        host_pinned_alloc_ctx_fn_ = load_symbol_optional<HostPinnedAllocCtxFn>(handle, "host_pinned_alloc_ctx");
+        host_pinned_free_ctx_fn_ = load_symbol_optional<HostPinnedFreeCtxFn>(handle, "host_pinned_free_ctx");
+        copy_to_device_batch_ctx_fn_ = load_symbol_optional<CopyToDeviceBatchCtxFn>(handle, "copy_to_device_batch_ctx");
+        copy_between_device_ctx_fn_ = load_symbol_optional<CopyBetweenDeviceCtxFn>(handle, "copy_between_device_ctx");
+        warm_up_ctx_fn_ = load_symbol_optional<WarmUpCtxFn>(handle, "warm_up_ctx");
+        launch_trace_enable_ctx_fn_ = load_symbol_optional<LaunchTraceEnableCtxFn>(handle, "launch_trace_enable_ctx");
+        launch_trace_get_ctx_fn_ = load_symbol_optional<LaunchTraceGetCtxFn>(handle, "launch_trace_get_ctx");
+        health_metrics_get_ctx_fn_ = load_symbol_optional<HealthMetricsGetCtxFn>(handle, "health_metrics_get_ctx");
     } catch (...) {
         dlclose(handle);
         throw;
     }
+    LaunchTraceRecorder::instance().add("worker.dlopen", trace_begin);
 
     lib_handle_ = handle;
 
+    trace_begin = LaunchTraceRecorder::now_ns();
     device_ctx_ = create_device_context_fn_();
     if (device_ctx_ == nullptr) {
         dlclose(handle);
         lib_handle_ = nullptr;
         throw std::runtime_error("create_device_context returned null");
     }
+    LaunchTraceRecorder::instance().add("worker.create_ctx", trace_begin);
+
+    // The runtime SO carries its own recorder instance (it is dlopen'd with
+    // RTLD_LOCAL); arm it through the optional symbol so the device-side
+    // stages land in the same trace.
+    if (enable_launch_trace && launch_trace_enable_ctx_fn_ != nullptr) {
+        launch_trace_enable_ctx_fn_(device_ctx_, 1);
+    }
 
     // Read platform binaries from files
+    trace_begin = LaunchTraceRecorder::now_ns();
     aicpu_binary_ = read_binary_file(aicpu_path);
     aicore_binary_ = read_binary_file(aicore_path);
+    LaunchTraceRecorder::instance().add("worker.read_binaries", trace_begin);
 
     runtime_buf_.resize(get_runtime_size_fn_());
 
+    trace_begin = LaunchTraceRecorder::now_ns();
+    init_staging_pool();
+    LaunchTraceRecorder::instance().add("worker.staging_pool", trace_begin);
+
+    launch_trace_pending_ = enable_launch_trace;
     initialized_ = true;
 }
 
+void ChipWorker::init_staging_pool() {
+    if (host_pinned_alloc_ctx_fn_ == nullptr || host_pinned_free_ctx_fn_ == nullptr) {
+        return;
+    }
+    for (int i = 0; i < 2; i++) {
+        staging_chunks_[i] = host_pinned_alloc_ctx_fn_(device_ctx_, STAGING_CHUNK_SIZE);
+    }
+    if (staging_chunks_[0] == nullptr || staging_chunks_[1] == nullptr) {
+        // Pinned memory unavailable (or the platform declined, e.g. sim):
+        // fall back to direct copies.
+        release_staging_pool();
+        return;
+    }
+    staging_ready_ = true;
+}
+
+void ChipWorker::release_staging_pool() {
+    staging_ready_ = false;
+    if (host_pinned_free_ctx_fn_ == nullptr) {
+        return;
+    }
+    for (int i = 0; i < 2; i++) {
+        if (staging_chunks_[i] != nullptr) {
+            host_pinned_free_ctx_fn_(device_ctx_, staging_chunks_[i]);
+            staging_chunks_[i] = nullptr;
+        }
+    }
+}
+
 void ChipWorker::set_device(int device_id) {
     if (!initialized_) {
         throw std::runtime_error("ChipWorker not initialized; call init() first");
@@ -152,24 +230,34 @@ void ChipWorker::set_device(int device_id) {
         throw std::runtime_error("Device already set; call reset_device() before switching devices");
     }
 
+    uint64_t trace_begin = LaunchTraceRecorder::now_ns();
     int rc = set_device_fn_(device_ctx_, device_id);
     if (rc != 0) {
         throw std::runtime_error("set_device failed with code " + std::to_string(rc));
     }
+    LaunchTraceRecorder::instance().add("worker.set_device", trace_begin);
     device_id_ = device_id;
     device_set_ = true;
 }
 
 void ChipWorker::reset_device() {
+    // Drain and park the submit pipeline before the device context goes away;
+    // it restarts lazily on the next run_async().
+    stop_submit_thread();
+    disarm_standby();
     if (device_set_ && finalize_device_fn_) {
         finalize_device_fn_(device_ctx_);
     }
+    // Device memory dies with the context; parked reuse buffers and slab
+    // bookkeeping go with it.
+    drop_alloc_bookkeeping();
     device_id_ = -1;
     device_set_ = false;
 }
 
 void ChipWorker::finalize() {
     reset_device();
+    release_staging_pool();
     if (device_ctx_ != nullptr && destroy_device_context_fn_ != nullptr) {
         destroy_device_context_fn_(device_ctx_);
         device_ctx_ = nullptr;
@@ -185,6 +273,15 @@ void ChipWorker::finalize() {
     device_free_ctx_fn_ = nullptr;
     copy_to_device_ctx_fn_ = nullptr;
     copy_from_device_ctx_fn_ = nullptr;
+    copy_to_device_batch_ctx_fn_ = nullptr;
+    copy_between_device_ctx_fn_ = nullptr;
+    warm_up_ctx_fn_ = nullptr;
+    launch_trace_enable_ctx_fn_ = nullptr;
+    launch_trace_get_ctx_fn_ = nullptr;
+    launch_trace_pending_ = false;
+    health_metrics_get_ctx_fn_ = nullptr;
+    host_pinned_alloc_ctx_fn_ = nullptr;
+    host_pinned_free_ctx_fn_ = nullptr;
     get_runtime_size_fn_ = nullptr;
     run_runtime_fn_ = nullptr;
     finalize_device_fn_ = nullptr;
@@ -209,44 +306,612 @@ void ChipWorker::run(const void *callable, const void *args, const ChipCallConfi
         throw std::runtime_error("ChipWorker device not set; call set_device() first");
     }
 
+    // Keep device order equal to submission order when async runs are queued.
+    wait_all();
+
     void *rt = runtime_buf_.data();
 
+    uint64_t trace_begin = LaunchTraceRecorder::now_ns();
     int rc = run_runtime_fn_(
         device_ctx_, rt, callable, args, config.block_dim, config.aicpu_thread_num, device_id_, aicpu_binary_.data(),
         aicpu_binary_.size(), aicore_binary_.data(), aicore_binary_.size(), config.enable_profiling ? 1 : 0,
         config.enable_dump_tensor ? 1 : 0
     );
+    if (rc != 0 && standby_set_) {
+        // Wedged-run recovery: promote the warm standby and re-dispatch this
+        // run from its start with its device pointers rewritten to the twins.
+        // The caller's POD is const, so the rewrite works on a copy.
+        ChipStorageTaskArgs retry_args = *static_cast<const ChipStorageTaskArgs *>(args);
+        if (fail_over_to_standby(retry_args)) {
+            rc = run_runtime_fn_(
+                device_ctx_, rt, callable, &retry_args, config.block_dim, config.aicpu_thread_num, device_id_,
+                aicpu_binary_.data(), aicpu_binary_.size(), aicore_binary_.data(), aicore_binary_.size(),
+                config.enable_profiling ? 1 : 0, config.enable_dump_tensor ? 1 : 0
+            );
+        }
+    }
     if (rc != 0) {
         throw std::runtime_error("run_runtime failed with code " + std::to_string(rc));
     }
+    if (launch_trace_pending_) {
+        LaunchTraceRecorder::instance().add("worker.first_run", trace_begin);
+        report_launch_trace();
+    }
+}
+
+uint64_t ChipWorker::run_async(const void *callable, const void *args, const ChipCallConfig &config) {
+    if (!device_set_) {
+        throw std::runtime_error("ChipWorker device not set; call set_device() first");
+    }
+
+    std::unique_lock<std::mutex> lock(pipe_mutex_);
+    if (!submit_thread_.joinable()) {
+        pipe_stop_ = false;
+        submit_thread_ = std::thread(&ChipWorker::submit_loop, this);
+    }
+    // Back-pressure: count the queued runs plus the one currently executing.
+    pipe_cv_.wait(lock, [this]() { return pipe_next_seq_ - 1 - pipe_completed_seq_ < PIPELINE_DEPTH; });
+
+    PendingRun pending;
+    pending.seq = pipe_next_seq_++;
+    pending.callable = callable;
+    pending.args = *static_cast<const ChipStorageTaskArgs *>(args);
+    pending.config = config;
+    pipe_queue_.push_back(pending);
+    pipe_cv_.notify_all();
+    return pending.seq;
+}
+
+void ChipWorker::wait(uint64_t handle) {
+    std::unique_lock<std::mutex> lock(pipe_mutex_);
+    if (handle == 0 || handle >= pipe_next_seq_) {
+        throw std::runtime_error("wait: invalid run handle " + std::to_string(handle));
+    }
+    pipe_cv_.wait(lock, [this, handle]() { return pipe_completed_seq_ >= handle; });
+    auto it = pipe_errors_.find(handle);
+    if (it != pipe_errors_.end()) {
+        std::exception_ptr err = it->second;
+        pipe_errors_.erase(it);
+        std::rethrow_exception(err);
+    }
+}
+
+void ChipWorker::wait_all() {
+    std::unique_lock<std::mutex> lock(pipe_mutex_);
+    pipe_cv_.wait(lock, [this]() { return pipe_completed_seq_ >= pipe_next_seq_ - 1; });
+    if (!pipe_errors_.empty()) {
+        auto it = pipe_errors_.begin();
+        std::exception_ptr err = it->second;
+        pipe_errors_.erase(it);
+        std::rethrow_exception(err);
+    }
+}
+
+// Drains the pipeline in submission order. Each run executes synchronously on
+// this thread; overlap comes from the caller preparing and enqueueing the
+// next run while the current one occupies the device.
+void ChipWorker::submit_loop() {
+    for (;;) {
+        PendingRun pending;
+        {
+            std::unique_lock<std::mutex> lock(pipe_mutex_);
+            pipe_cv_.wait(lock, [this]() { return !pipe_queue_.empty() || pipe_stop_; });
+            if (pipe_queue_.empty()) {
+                // Stop is graceful: exit only once every queued run has drained.
+                return;
+            }
+            pending = pipe_queue_.front();
+            pipe_queue_.pop_front();
+        }
+
+        uint64_t trace_begin = LaunchTraceRecorder::now_ns();
+        int rc = run_runtime_fn_(
+            device_ctx_, runtime_buf_.data(), pending.callable, &pending.args, pending.config.block_dim,
+            pending.config.aicpu_thread_num, device_id_, aicpu_binary_.data(), aicpu_binary_.size(),
+            aicore_binary_.data(), aicore_binary_.size(), pending.config.enable_profiling ? 1 : 0,
+            pending.config.enable_dump_tensor ? 1 : 0
+        );
+        if (rc != 0 && standby_set_) {
+            // Wedged-run recovery: promote the warm standby, rewrite the
+            // device pointers of this run and everything still queued behind
+            // it to their twins, and re-dispatch this run from its start.
+            if (fail_over_to_standby(pending.args)) {
+                rc = run_runtime_fn_(
+                    device_ctx_, runtime_buf_.data(), pending.callable, &pending.args, pending.config.block_dim,
+                    pending.config.aicpu_thread_num, device_id_, aicpu_binary_.data(), aicpu_binary_.size(),
+                    aicore_binary_.data(), aicore_binary_.size(), pending.config.enable_profiling ? 1 : 0,
+                    pending.config.enable_dump_tensor ? 1 : 0
+                );
+            }
+        }
+        if (rc == 0 && launch_trace_pending_) {
+            LaunchTraceRecorder::instance().add("worker.first_run", trace_begin);
+            report_launch_trace();
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(pipe_mutex_);
+            if (rc != 0) {
+                pipe_errors_[pending.seq] =
+                    std::make_exception_ptr(std::runtime_error("run_runtime failed with code " + std::to_string(rc)));
+            }
+            pipe_completed_seq_ = pending.seq;
+            pipe_cv_.notify_all();
+        }
+        // Outside pipe_mutex_: the callback may take arbitrary locks (e.g. the
+        // Python GIL) that other pipeline callers could hold while blocked here.
+        if (completion_cb_) {
+            completion_cb_(pending.seq, rc == 0);
+        }
+    }
+}
+
+// Merge host-side spans (this SO's recorder) with the runtime SO's spans and
+// print one budget table to stderr, then disarm recording on both sides.
+// One-shot: the trace targets the cold start, and leaving the recorders armed
+// would grow the tables on every subsequent run.
+void ChipWorker::report_launch_trace() {
+    launch_trace_pending_ = false;
+
+    std::vector<PtoLaunchSpan> spans(2 * LaunchTraceRecorder::MAX_SPANS);
+    int count = LaunchTraceRecorder::instance().snapshot(spans.data(), LaunchTraceRecorder::MAX_SPANS);
+    if (count < 0) {
+        count = 0;
+    }
+    if (launch_trace_get_ctx_fn_ != nullptr) {
+        int device_count = launch_trace_get_ctx_fn_(device_ctx_, spans.data() + count, LaunchTraceRecorder::MAX_SPANS);
+        if (device_count > 0) {
+            count += device_count;
+        }
+    }
+    spans.resize(static_cast<size_t>(count));
+
+    LaunchTraceRecorder::instance().set_enabled(false);
+    if (launch_trace_enable_ctx_fn_ != nullptr) {
+        launch_trace_enable_ctx_fn_(device_ctx_, 0);
+    }
+    if (spans.empty()) {
+        return;
+    }
+
+    std::sort(spans.begin(), spans.end(), [](const PtoLaunchSpan &a, const PtoLaunchSpan &b) {
+        return a.begin_ns < b.begin_ns;
+    });
+    uint64_t base_ns = spans.front().begin_ns;
+    uint64_t end_ns = base_ns;
+    for (const PtoLaunchSpan &span : spans) {
+        end_ns = std::max(end_ns, span.end_ns);
+    }
+    double total_ms = static_cast<double>(end_ns - base_ns) / 1e6;
+
+    // Spans overlap by design (worker.first_run contains every runtime.* and
+    // device.* span), so the %-column describes each span against the wall
+    // total rather than summing to 100.
+    std::fprintf(stderr, "\n=== Cold-start launch trace (total %.1f ms) ===\n", total_ms);
+    std::fprintf(stderr, "%-24s %12s %12s %8s\n", "span", "start_ms", "dur_ms", "%total");
+    for (const PtoLaunchSpan &span : spans) {
+        double start_ms = static_cast<double>(span.begin_ns - base_ns) / 1e6;
+        double dur_ms = static_cast<double>(span.end_ns - span.begin_ns) / 1e6;
+        double pct = total_ms > 0.0 ? dur_ms / total_ms * 100.0 : 0.0;
+        std::fprintf(stderr, "%-24s %12.3f %12.3f %7.1f%%\n", span.name, start_ms, dur_ms, pct);
+    }
+    std::fprintf(stderr, "\n");
+}
+
+void ChipWorker::set_completion_callback(CompletionCallback cb) {
+    completion_cb_ = std::move(cb);
+}
+
+void ChipWorker::stop_submit_thread() {
+    if (!submit_thread_.joinable()) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(pipe_mutex_);
+        pipe_stop_ = true;
+        pipe_cv_.notify_all();
+    }
+    submit_thread_.join();
+    submit_thread_ = std::thread();
+    pipe_errors_.clear();
 }
 
 uint64_t ChipWorker::malloc(size_t size) {
     if (!device_set_) {
         throw std::runtime_error("ChipWorker device not set; call set_device() first");
     }
+    {
+        std::lock_guard<std::mutex> lk(alloc_mutex_);
+        auto it = reuse_cache_.find(size);
+        if (it != reuse_cache_.end()) {
+            uint64_t ptr = it->second;
+            reuse_cache_.erase(it);
+            direct_sizes_[ptr] = size;
+            // A buffer parked before arm_standby() has no twin yet.
+            mirror_alloc_locked(ptr, size);
+            return ptr;
+        }
+    }
     void *ptr = device_malloc_ctx_fn_(device_ctx_, size);
     if (ptr == nullptr) {
         throw std::runtime_error("malloc failed");
     }
+    {
+        std::lock_guard<std::mutex> lk(alloc_mutex_);
+        direct_sizes_[reinterpret_cast<uint64_t>(ptr)] = size;
+        mirror_alloc_locked(reinterpret_cast<uint64_t>(ptr), size);
+    }
     return reinterpret_cast<uint64_t>(ptr);
 }
 
-void ChipWorker::free(uint64_t ptr) {
+void ChipWorker::free(uint64_t ptr, bool reuse) {
     if (!device_set_) {
         throw std::runtime_error("ChipWorker device not set; call set_device() first");
     }
+    {
+        std::lock_guard<std::mutex> lk(alloc_mutex_);
+        // Slab carve: return it to the slab; the last carve out frees the
+        // whole reservation with a single driver call.
+        auto carve = carve_to_slab_.find(ptr);
+        if (carve != carve_to_slab_.end()) {
+            uint64_t base = carve->second;
+            carve_to_slab_.erase(carve);
+            auto live = slab_live_.find(base);
+            if (live != slab_live_.end() && --live->second == 0) {
+                slab_live_.erase(live);
+                device_free_ctx_fn_(device_ctx_, reinterpret_cast<void *>(base));
+                mirror_free_locked(base);
+            }
+            return;
+        }
+        auto sized = direct_sizes_.find(ptr);
+        if (reuse && sized != direct_sizes_.end()) {
+            // The twin stays parked alongside the buffer so a reuse-cache
+            // hit needs no fresh standby allocation.
+            reuse_cache_.emplace(sized->second, ptr);
+            direct_sizes_.erase(sized);
+            return;
+        }
+        if (sized != direct_sizes_.end()) direct_sizes_.erase(sized);
+        mirror_free_locked(ptr);
+    }
     device_free_ctx_fn_(device_ctx_, reinterpret_cast<void *>(ptr));
 }
 
+std::vector<uint64_t> ChipWorker::malloc_many(const std::vector<size_t> &sizes) {
+    if (!device_set_) {
+        throw std::runtime_error("ChipWorker device not set; call set_device() first");
+    }
+    if (sizes.empty()) return {};
+
+    // Lay the carves out at SLAB_CARVE_ALIGN boundaries within one
+    // reservation. Device pointers from the driver are page-aligned, so the
+    // alignment of the base carries to every carve.
+    std::vector<size_t> offsets;
+    offsets.reserve(sizes.size());
+    size_t total = 0;
+    for (size_t size : sizes) {
+        offsets.push_back(total);
+        total += (size + SLAB_CARVE_ALIGN - 1) & ~(SLAB_CARVE_ALIGN - 1);
+    }
+
+    void *base = device_malloc_ctx_fn_(device_ctx_, total);
+    if (base == nullptr) {
+        throw std::runtime_error("malloc_many failed for " + std::to_string(total) + " bytes");
+    }
+    uint64_t base_u = reinterpret_cast<uint64_t>(base);
+
+    std::vector<uint64_t> ptrs;
+    ptrs.reserve(sizes.size());
+    std::lock_guard<std::mutex> lk(alloc_mutex_);
+    for (size_t off : offsets) {
+        ptrs.push_back(base_u + off);
+        carve_to_slab_[base_u + off] = base_u;
+    }
+    slab_live_[base_u] = sizes.size();
+    // One standby twin covers the whole slab; carves remap by offset.
+    mirror_alloc_locked(base_u, total);
+    return ptrs;
+}
+
+void ChipWorker::free_many(const std::vector<uint64_t> &ptrs) {
+    for (uint64_t ptr : ptrs) {
+        free(ptr);
+    }
+}
+
+void ChipWorker::drop_alloc_bookkeeping() {
+    std::lock_guard<std::mutex> lk(alloc_mutex_);
+    carve_to_slab_.clear();
+    slab_live_.clear();
+    direct_sizes_.clear();
+    reuse_cache_.clear();
+}
+
 void ChipWorker::copy_to(uint64_t dst, uint64_t src, size_t size) {
     if (!device_set_) {
         throw std::runtime_error("ChipWorker device not set; call set_device() first");
     }
+    if (staging_ready_ && size >= STAGING_MIN_SIZE) {
+        copy_to_staged(dst, src, size);
+    } else {
+        int rc = copy_to_device_ctx_fn_(
+            device_ctx_, reinterpret_cast<void *>(dst), reinterpret_cast<const void *>(src), size
+        );
+        if (rc != 0) {
+            throw std::runtime_error("copy_to failed with code " + std::to_string(rc));
+        }
+    }
+    mirror_host_write(dst, src, size);
+}
+
+void ChipWorker::copy_to_batch(const uint64_t *dsts, const uint64_t *srcs, const size_t *sizes, size_t count) {
+    if (!device_set_) {
+        throw std::runtime_error("ChipWorker device not set; call set_device() first");
+    }
+    if (count == 0) {
+        return;
+    }
+    if (copy_to_device_batch_ctx_fn_ == nullptr) {
+        // Runtime SO predates the batch symbol: same semantics, one copy each.
+        for (size_t i = 0; i < count; i++) {
+            copy_to(dsts[i], srcs[i], sizes[i]);
+        }
+        return;
+    }
+    std::vector<void *> dev_ptrs(count);
+    std::vector<const void *> host_ptrs(count);
+    for (size_t i = 0; i < count; i++) {
+        dev_ptrs[i] = reinterpret_cast<void *>(dsts[i]);
+        host_ptrs[i] = reinterpret_cast<const void *>(srcs[i]);
+    }
     int rc =
-        copy_to_device_ctx_fn_(device_ctx_, reinterpret_cast<void *>(dst), reinterpret_cast<const void *>(src), size);
+        copy_to_device_batch_ctx_fn_(device_ctx_, dev_ptrs.data(), host_ptrs.data(), sizes, static_cast<int>(count));
+    if (rc != 0) {
+        throw std::runtime_error("copy_to_batch failed with code " + std::to_string(rc));
+    }
+    for (size_t i = 0; i < count; i++) {
+        mirror_host_write(dsts[i], srcs[i], sizes[i]);
+    }
+}
+
+bool ChipWorker::copy_between(uint64_t dst, uint64_t src, size_t size) {
+    if (!device_set_) {
+        throw std::runtime_error("ChipWorker device not set; call set_device() first");
+    }
+    if (copy_between_device_ctx_fn_ == nullptr) {
+        return false;
+    }
+    int rc = copy_between_device_ctx_fn_(
+        device_ctx_, reinterpret_cast<void *>(dst), reinterpret_cast<const void *>(src), size
+    );
+    return rc == 0;
+}
+
+bool ChipWorker::warm_up() {
+    if (!device_set_) {
+        throw std::runtime_error("ChipWorker device not set; call set_device() first");
+    }
+    if (warm_up_ctx_fn_ == nullptr) {
+        return false;
+    }
+    return warm_up_ctx_fn_(device_ctx_, device_id_) == 0;
+}
+
+bool ChipWorker::health_snapshot(PtoHealthMetrics &out) {
+    if (!initialized_ || device_ctx_ == nullptr) {
+        return false;
+    }
+    if (health_metrics_get_ctx_fn_ == nullptr) {
+        return false;  // Runtime SO predates the symbol or publishes no health block
+    }
+    return health_metrics_get_ctx_fn_(device_ctx_, &out) == 0;
+}
+
+void ChipWorker::arm_standby(int device_id) {
+    if (!device_set_) {
+        throw std::runtime_error("ChipWorker device not set; call set_device() first");
+    }
+    if (standby_set_) {
+        throw std::runtime_error("Standby already armed; call disarm_standby() first");
+    }
+    void *ctx = create_device_context_fn_();
+    if (ctx == nullptr) {
+        throw std::runtime_error("arm_standby: create_device_context returned null");
+    }
+    int rc = set_device_fn_(ctx, device_id);
     if (rc != 0) {
-        throw std::runtime_error("copy_to failed with code " + std::to_string(rc));
+        destroy_device_context_fn_(ctx);
+        throw std::runtime_error("arm_standby: set_device failed with code " + std::to_string(rc));
+    }
+    std::lock_guard<std::mutex> lk(alloc_mutex_);
+    standby_ctx_ = ctx;
+    standby_device_id_ = device_id;
+    standby_set_ = true;
+}
+
+void ChipWorker::disarm_standby() {
+    std::lock_guard<std::mutex> lk(alloc_mutex_);
+    disarm_standby_locked();
+}
+
+void ChipWorker::disarm_standby_locked() {
+    if (standby_ctx_ == nullptr) {
+        return;
+    }
+    for (const auto &entry : standby_mirror_) {
+        device_free_ctx_fn_(standby_ctx_, reinterpret_cast<void *>(entry.second.standby_base));
+    }
+    standby_mirror_.clear();
+    if (finalize_device_fn_) {
+        finalize_device_fn_(standby_ctx_);
+    }
+    destroy_device_context_fn_(standby_ctx_);
+    standby_ctx_ = nullptr;
+    standby_device_id_ = -1;
+    standby_set_ = false;
+}
+
+void ChipWorker::mirror_alloc_locked(uint64_t ptr, size_t size) {
+    if (!standby_set_ || standby_mirror_.count(ptr) != 0) {
+        return;
+    }
+    void *twin = device_malloc_ctx_fn_(standby_ctx_, size);
+    if (twin == nullptr) {
+        // The standby can no longer track the primary; give it up rather
+        // than fail the primary allocation.
+        disarm_standby_locked();
+        return;
+    }
+    standby_mirror_[ptr] = MirrorSpan{reinterpret_cast<uint64_t>(twin), size};
+}
+
+void ChipWorker::mirror_free_locked(uint64_t ptr) {
+    auto it = standby_mirror_.find(ptr);
+    if (it == standby_mirror_.end()) {
+        return;
+    }
+    if (standby_ctx_ != nullptr) {
+        device_free_ctx_fn_(standby_ctx_, reinterpret_cast<void *>(it->second.standby_base));
+    }
+    standby_mirror_.erase(it);
+}
+
+// Remap a primary device pointer to its standby twin by offset within the
+// covering span; pointers outside every span pass through unchanged.
+uint64_t ChipWorker::remap_span(const std::map<uint64_t, MirrorSpan> &spans, uint64_t ptr) {
+    auto it = spans.upper_bound(ptr);
+    if (it == spans.begin()) {
+        return ptr;
+    }
+    --it;
+    if (ptr - it->first >= it->second.size) {
+        return ptr;
+    }
+    return it->second.standby_base + (ptr - it->first);
+}
+
+// Replicate a host->device write to the standby twin of `dst`, if one
+// exists. Replica copies go direct (not staged): the pinned staging pool is
+// registered against the primary context only.
+void ChipWorker::mirror_host_write(uint64_t dst, uint64_t src, size_t size) {
+    uint64_t twin = 0;
+    {
+        std::lock_guard<std::mutex> lk(alloc_mutex_);
+        if (!standby_set_) {
+            return;
+        }
+        twin = remap_span(standby_mirror_, dst);
+        if (twin == dst) {
+            return;
+        }
+    }
+    int rc =
+        copy_to_device_ctx_fn_(standby_ctx_, reinterpret_cast<void *>(twin), reinterpret_cast<const void *>(src), size);
+    if (rc != 0) {
+        // A twin that missed a write can no longer stand in for the primary.
+        disarm_standby();
+    }
+}
+
+// Promote the standby to primary after a failed run. The twin map becomes
+// the live allocation set: bookkeeping keys, parked reuse buffers, and the
+// device pointers of the failed and still-queued runs all remap through it.
+// The wedged context is destroyed without finalize_device — finalize
+// synchronizes with outstanding device work, which is exactly what is stuck.
+bool ChipWorker::fail_over_to_standby(ChipStorageTaskArgs &failed_args) {
+    void *old_ctx = nullptr;
+    std::map<uint64_t, MirrorSpan> spans;
+    {
+        std::lock_guard<std::mutex> lk(alloc_mutex_);
+        if (!standby_set_) {
+            return false;
+        }
+        spans.swap(standby_mirror_);
+
+        std::map<uint64_t, uint64_t> carves;
+        for (const auto &entry : carve_to_slab_) {
+            carves[remap_span(spans, entry.first)] = remap_span(spans, entry.second);
+        }
+        carve_to_slab_.swap(carves);
+        std::map<uint64_t, size_t> slabs;
+        for (const auto &entry : slab_live_) {
+            slabs[remap_span(spans, entry.first)] = entry.second;
+        }
+        slab_live_.swap(slabs);
+        std::map<uint64_t, size_t> directs;
+        for (const auto &entry : direct_sizes_) {
+            directs[remap_span(spans, entry.first)] = entry.second;
+        }
+        direct_sizes_.swap(directs);
+        std::multimap<size_t, uint64_t> parked;
+        for (const auto &entry : reuse_cache_) {
+            parked.emplace(entry.first, remap_span(spans, entry.second));
+        }
+        reuse_cache_.swap(parked);
+
+        old_ctx = device_ctx_;
+        device_ctx_ = standby_ctx_;
+        device_id_ = standby_device_id_;
+        standby_ctx_ = nullptr;
+        standby_device_id_ = -1;
+        standby_set_ = false;
+    }
+
+    for (int32_t i = 0; i < failed_args.tensor_count_; i++) {
+        failed_args.tensor(i).data = remap_span(spans, failed_args.tensor(i).data);
+    }
+    {
+        std::lock_guard<std::mutex> lk(pipe_mutex_);
+        for (PendingRun &queued : pipe_queue_) {
+            for (int32_t i = 0; i < queued.args.tensor_count_; i++) {
+                queued.args.tensor(i).data = remap_span(spans, queued.args.tensor(i).data);
+            }
+        }
+    }
+
+    // The staging chunks are pinned against the old context; re-register
+    // them against the promoted one.
+    staging_ready_ = false;
+    if (host_pinned_free_ctx_fn_ != nullptr) {
+        for (int i = 0; i < 2; i++) {
+            if (staging_chunks_[i] != nullptr) {
+                host_pinned_free_ctx_fn_(old_ctx, staging_chunks_[i]);
+                staging_chunks_[i] = nullptr;
+            }
+        }
+    }
+    destroy_device_context_fn_(old_ctx);
+    init_staging_pool();
+    return true;
+}
+
+// Pipeline a large host->device copy through the pinned staging chunks:
+// while chunk i is DMA'd from pinned memory, chunk i+1 is memcpy'd into the
+// other pinned buffer on a helper thread.
+void ChipWorker::copy_to_staged(uint64_t dst, uint64_t src, size_t size) {
+    const char *host = reinterpret_cast<const char *>(src);
+    size_t nchunks = (size + STAGING_CHUNK_SIZE - 1) / STAGING_CHUNK_SIZE;
+    auto chunk_len = [size](size_t i) { return std::min(STAGING_CHUNK_SIZE, size - i * STAGING_CHUNK_SIZE); };
+
+    std::memcpy(staging_chunks_[0], host, chunk_len(0));
+    std::future<void> staged;
+    for (size_t i = 0; i < nchunks; i++) {
+        if (i + 1 < nchunks) {
+            void *buf = staging_chunks_[(i + 1) & 1];
+            const char *from = host + (i + 1) * STAGING_CHUNK_SIZE;
+            size_t len = chunk_len(i + 1);
+            staged = std::async(std::launch::async, [buf, from, len]() { std::memcpy(buf, from, len); });
+        }
+        int rc = copy_to_device_ctx_fn_(
+            device_ctx_, reinterpret_cast<void *>(dst + i * STAGING_CHUNK_SIZE), staging_chunks_[i & 1], chunk_len(i)
+        );
+        if (staged.valid()) {
+            staged.get();
+        }
+        if (rc != 0) {
+            throw std::runtime_error("copy_to failed with code " + std::to_string(rc));
+        }
     }
 }
 
@@ -254,9 +919,46 @@ void ChipWorker::copy_from(uint64_t dst, uint64_t src, size_t size) {
     if (!device_set_) {
         throw std::runtime_error("ChipWorker device not set; call set_device() first");
     }
+    if (staging_ready_ && size >= STAGING_MIN_SIZE) {
+        copy_from_staged(dst, src, size);
+        return;
+    }
     int rc =
         copy_from_device_ctx_fn_(device_ctx_, reinterpret_cast<void *>(dst), reinterpret_cast<const void *>(src), size);
     if (rc != 0) {
         throw std::runtime_error("copy_from failed with code " + std::to_string(rc));
     }
 }
+
+// Device->host mirror of copy_to_staged(): DMA chunk i into a pinned buffer,
+// then drain it to the caller's memory on a helper thread while chunk i+1 is
+// DMA'd into the other buffer. drain[b] guards reuse of staging_chunks_[b].
+void ChipWorker::copy_from_staged(uint64_t dst, uint64_t src, size_t size) {
+    char *host = reinterpret_cast<char *>(dst);
+    size_t nchunks = (size + STAGING_CHUNK_SIZE - 1) / STAGING_CHUNK_SIZE;
+    auto chunk_len = [size](size_t i) { return std::min(STAGING_CHUNK_SIZE, size - i * STAGING_CHUNK_SIZE); };
+
+    std::future<void> drain[2];
+    for (size_t i = 0; i < nchunks; i++) {
+        size_t b = i & 1;
+        if (drain[b].valid()) {
+            drain[b].get();
+        }
+        int rc = copy_from_device_ctx_fn_(
+            device_ctx_, staging_chunks_[b], reinterpret_cast<const void *>(src + i * STAGING_CHUNK_SIZE), chunk_len(i)
+        );
+        if (rc != 0) {
+            for (auto &d : drain) {
+                if (d.valid()) d.get();
+            }
+            throw std::runtime_error("copy_from failed with code " + std::to_string(rc));
+        }
+        void *buf = staging_chunks_[b];
+        char *to = host + i * STAGING_CHUNK_SIZE;
+        size_t len = chunk_len(i);
+        drain[b] = std::async(std::launch::async, [buf, to, len]() { std::memcpy(to, buf, len); });
+    }
+    for (auto &d : drain) {
+        if (d.valid()) d.get();
+    }
+}
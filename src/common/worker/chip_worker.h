@@ -12,14 +12,23 @@
 #ifndef SRC_COMMON_WORKER_CHIP_WORKER_H_
 #define SRC_COMMON_WORKER_CHIP_WORKER_H_
 
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "../task_interface/chip_call_config.h"
 #include "../task_interface/task_args.h"
 #include "types.h"
 
+struct PtoLaunchSpan;     // see pto_runtime_c_api.h
+struct PtoHealthMetrics;  // see pto_runtime_c_api.h
+
 class ChipWorker : public IWorker {
 public:
     ChipWorker() = default;
@@ -30,9 +39,13 @@ public:
 
     /// Bind the runtime library and cache platform binaries.
     /// Can only be called once per lifetime — the runtime cannot be changed.
+    /// With enable_launch_trace, spans covering init(), set_device() and the
+    /// whole first run (including the runtime SO's device-side stages, pulled
+    /// through the optional launch_trace_*_ctx symbols) are collected and
+    /// printed once as a cold-start budget table after that run completes.
     void init(
         const std::string &host_lib_path, const std::string &aicpu_path, const std::string &aicore_path,
-        const std::string &sim_context_lib_path = ""
+        const std::string &sim_context_lib_path = "", bool enable_launch_trace = false
     );
 
     /// Set the target NPU device. Requires init() first.
@@ -54,13 +67,123 @@ public:
 
     // Direct invocation (used by Python wrapper and internal tests) — bypasses
     // the TaskArgsView path and takes a ready-made ChipStorageTaskArgs POD.
+    // Serializes behind any outstanding run_async() submissions.
     void run(const void *callable, const void *args, const ChipCallConfig &config);
 
+    // Asynchronous variant of run(): enqueue the run on the internal submit
+    // pipeline and return a completion handle immediately. Runs execute
+    // in-order on a dedicated submit thread, so the caller can assemble and
+    // upload the next run's arguments while the current run executes on
+    // device. `args` is copied into the pipeline slot; `callable` must stay
+    // valid until the handle completes. Blocks (back-pressure) when
+    // PIPELINE_DEPTH runs are already in flight.
+    uint64_t run_async(const void *callable, const void *args, const ChipCallConfig &config);
+
+    // Block until the given handle has completed; rethrows the run's
+    // run_runtime error if it failed.
+    void wait(uint64_t handle);
+
+    // Block until every submitted run has completed; rethrows the oldest
+    // pending failure (one per call) if any run failed.
+    void wait_all();
+
+    // Invoked on the submit thread after each pipelined run completes, once
+    // the handle is already waitable. `success` is false when the run failed
+    // (the error itself is still delivered through wait()/wait_all()).
+    using CompletionCallback = std::function<void(uint64_t handle, bool success)>;
+
+    // Register (or clear, with an empty function) the completion callback.
+    // Not synchronized with the pipeline: set it before the first run_async()
+    // and do not change it while runs are in flight. The callback must not
+    // call back into this ChipWorker.
+    void set_completion_callback(CompletionCallback cb);
+
+    // A malloc of a size that was previously freed with reuse=true is
+    // served from the reuse cache with no driver call.
     uint64_t malloc(size_t size);
-    void free(uint64_t ptr);
+
+    // reuse=true parks the buffer in a size-keyed cache instead of
+    // returning it to the driver — use it for buffers that will be
+    // re-requested at the identical size next request. The cache is
+    // dropped by reset_device()/finalize(). The hint is ignored for
+    // malloc_many() carves, which always return to their slab.
+    void free(uint64_t ptr, bool reuse = false);
+
+    // Batched allocation: one driver reservation of the summed (aligned)
+    // sizes, carved locally into `sizes.size()` buffers. Carves release
+    // through the normal free()/free_many(); the backing slab returns to
+    // the driver once its last carve is freed, so batch teardown is one
+    // driver call as well. Throws on reservation failure (nothing is
+    // allocated).
+    std::vector<uint64_t> malloc_many(const std::vector<size_t> &sizes);
+
+    // Free a set of buffers in one call. Slab carves coalesce into one
+    // driver release per exhausted slab; direct allocations free
+    // individually.
+    void free_many(const std::vector<uint64_t> &ptrs);
+
+    // Host<->device copies. Transfers of at least STAGING_MIN_SIZE are
+    // pipelined through the double-buffered pinned staging pool (when the
+    // platform provides one): the memcpy into/out of a pinned chunk overlaps
+    // the DMA of the previous chunk, and the DMA itself runs at pinned-memory
+    // bandwidth regardless of the caller's (usually pageable) buffer.
     void copy_to(uint64_t dst, uint64_t src, size_t size);
     void copy_from(uint64_t dst, uint64_t src, size_t size);
 
+    // Batched host->device copy: forwards all regions in one
+    // copy_to_device_batch_ctx call so the platform can coalesce scattered
+    // small uploads (pack + device-side scatter on onboard). Falls back to
+    // per-region copy_to() when the runtime SO predates the batch symbol.
+    // All three arrays must have `count` entries.
+    void copy_to_batch(const uint64_t *dsts, const uint64_t *srcs, const size_t *sizes, size_t count);
+
+    // Direct device-to-device copy (no host bounce). Returns false when the
+    // direct path is unavailable — runtime SO predates the symbol, or the
+    // driver refuses the transfer (e.g. no peer access between the two
+    // devices) — so the caller can stage through host memory instead.
+    // Throws only on state errors (device not set).
+    bool copy_between(uint64_t dst, uint64_t src, size_t size);
+
+    // Pre-pay cold-start costs (page faults, stream creation, one no-op
+    // pipeline flush) so the first run performs like steady state. Best
+    // effort: returns false when the runtime SO predates the symbol or the
+    // warm-up itself failed; subsequent runs work either way. Throws only
+    // on state errors (device not set).
+    bool warm_up();
+
+    // Snapshot the compact health block the AICPU scheduler maintains in
+    // shared memory (tasks/sec, dispatch-latency EWMA, ring occupancy,
+    // stall samples, error codes). Wait-free on the device side and safe
+    // to call from any thread while a run is in flight — this is the
+    // intended use; between runs there is no shared memory to read.
+    // Returns false when no run is active or the runtime SO predates the
+    // health_metrics_get_ctx symbol.
+    bool health_snapshot(PtoHealthMetrics &out);
+
+    // Warm-standby failover. arm_standby() opens a second device context
+    // (same or a different device) and keeps it resident; from then on every
+    // allocation gets a same-size twin on the standby and every host->device
+    // write is replicated to it. When a run fails (e.g. the AICPU give-up
+    // fires on a wedged device), the worker promotes the standby: device
+    // pointers in the failed and still-queued runs are rewritten to their
+    // twins and the runs re-dispatch from their start on the new context —
+    // recovery costs a re-dispatch, not a full reinit. Arm right after
+    // set_device(), before allocating: buffers that predate arming have no
+    // twin and keep their (dead) addresses across a failover. Only
+    // host-uploaded state is mirrored; results one run leaves on device for
+    // a later run to read are re-created by the re-dispatched runs
+    // themselves, and device addresses smuggled through raw scalars are not
+    // rewritten — pass buffers as tensors for failover coverage. Mirroring
+    // degrades to disarmed (failover unavailable, primary unaffected) if a
+    // twin allocation or replica copy fails. Throws on state errors or when
+    // the standby context cannot be created.
+    void arm_standby(int device_id);
+
+    // Release the standby context and its twins. No-op when not armed.
+    void disarm_standby();
+
+    bool standby_armed() const { return standby_set_; }
+
     int device_id() const { return device_id_; }
     bool initialized() const { return initialized_; }
     bool device_set() const { return device_set_; }
@@ -73,6 +196,14 @@ private:
     using DeviceFreeCtxFn = void (*)(void *, void *);
     using CopyToDeviceCtxFn = int (*)(void *, void *, const void *, size_t);
     using CopyFromDeviceCtxFn = int (*)(void *, void *, const void *, size_t);
+    using CopyToDeviceBatchCtxFn = int (*)(void *, void *const *, const void *const *, const size_t *, int);
+    using CopyBetweenDeviceCtxFn = int (*)(void *, void *, const void *, size_t);
+    using WarmUpCtxFn = int (*)(void *, int);
+    using LaunchTraceEnableCtxFn = void (*)(void *, int);
+    using LaunchTraceGetCtxFn = int (*)(void *, PtoLaunchSpan *, int);
+    using HealthMetricsGetCtxFn = int (*)(void *, PtoHealthMetrics *);
+    using HostPinnedAllocCtxFn = void *(*)(void *, size_t);
+    using HostPinnedFreeCtxFn = void (*)(void *, void *);
     using GetRuntimeSizeFn = size_t (*)();
     using RunRuntimeFn = int (*)(
         void *, void *, const void *, const void *, int, int, int, const uint8_t *, size_t, const uint8_t *, size_t,
@@ -88,11 +219,99 @@ private:
     DeviceFreeCtxFn device_free_ctx_fn_ = nullptr;
     CopyToDeviceCtxFn copy_to_device_ctx_fn_ = nullptr;
     CopyFromDeviceCtxFn copy_from_device_ctx_fn_ = nullptr;
+    CopyToDeviceBatchCtxFn copy_to_device_batch_ctx_fn_ = nullptr;
+    CopyBetweenDeviceCtxFn copy_between_device_ctx_fn_ = nullptr;
+    WarmUpCtxFn warm_up_ctx_fn_ = nullptr;
+    LaunchTraceEnableCtxFn launch_trace_enable_ctx_fn_ = nullptr;
+    LaunchTraceGetCtxFn launch_trace_get_ctx_fn_ = nullptr;
+    HealthMetricsGetCtxFn health_metrics_get_ctx_fn_ = nullptr;
+    HostPinnedAllocCtxFn host_pinned_alloc_ctx_fn_ = nullptr;
+    HostPinnedFreeCtxFn host_pinned_free_ctx_fn_ = nullptr;
     GetRuntimeSizeFn get_runtime_size_fn_ = nullptr;
     RunRuntimeFn run_runtime_fn_ = nullptr;
     FinalizeDeviceFn finalize_device_fn_ = nullptr;
     void *device_ctx_ = nullptr;
 
+    // Pinned staging pool: two chunks registered once at init() and reused for
+    // every staged copy until finalize(). Disabled (nullptr chunks) when the
+    // platform's host_pinned_alloc_ctx declines, e.g. in simulation.
+    static constexpr size_t STAGING_CHUNK_SIZE = 8u << 20;
+    static constexpr size_t STAGING_MIN_SIZE = 2u << 20;
+    void *staging_chunks_[2] = {nullptr, nullptr};
+    bool staging_ready_ = false;
+
+    // Cold-start trace: armed by init(enable_launch_trace=true), consumed
+    // (merged host+device budget table printed, recording disarmed) after the
+    // first successful run. Runs are serialized, so the flag never races.
+    bool launch_trace_pending_ = false;
+
+    void report_launch_trace();
+
+    void init_staging_pool();
+    void release_staging_pool();
+    void copy_to_staged(uint64_t dst, uint64_t src, size_t size);
+    void copy_from_staged(uint64_t dst, uint64_t src, size_t size);
+
+    // --- Allocation bookkeeping (guarded by alloc_mutex_) ---
+    // malloc_many slabs: carve ptr → slab base, slab base → live carves.
+    // The slab frees to the driver when its live count reaches zero.
+    // Direct allocations record their size so free(ptr, reuse=true) can
+    // park them in the size-keyed reuse cache; the maps and cache are
+    // host-side only and are cleared when the device context goes away.
+    static constexpr size_t SLAB_CARVE_ALIGN = 512;
+    std::mutex alloc_mutex_;
+    std::map<uint64_t, uint64_t> carve_to_slab_;
+    std::map<uint64_t, size_t> slab_live_;
+    std::map<uint64_t, size_t> direct_sizes_;
+    std::multimap<size_t, uint64_t> reuse_cache_;
+
+    void drop_alloc_bookkeeping();
+
+    // --- Warm standby (twin map guarded by alloc_mutex_) ---
+    // standby_mirror_ maps each primary allocation base (direct buffer or
+    // malloc_many slab) to its standby twin; interior pointers — slab carves
+    // and tensor views — remap by offset within the span. The map is
+    // consumed by the failover that promotes the standby.
+    struct MirrorSpan {
+        uint64_t standby_base;
+        size_t size;
+    };
+    void *standby_ctx_ = nullptr;
+    int standby_device_id_ = -1;
+    bool standby_set_ = false;
+    std::map<uint64_t, MirrorSpan> standby_mirror_;
+
+    void mirror_alloc_locked(uint64_t ptr, size_t size);
+    void mirror_free_locked(uint64_t ptr);
+    void mirror_host_write(uint64_t dst, uint64_t src, size_t size);
+    void disarm_standby_locked();
+    bool fail_over_to_standby(ChipStorageTaskArgs &failed_args);
+    static uint64_t remap_span(const std::map<uint64_t, MirrorSpan> &spans, uint64_t ptr);
+
+    // Run-request pipeline: bounded in-order queue drained by submit_thread_
+    // (started lazily on the first run_async). The depth bounds host memory
+    // held by queued argument PODs and provides back-pressure when the device
+    // falls behind submission.
+    static constexpr size_t PIPELINE_DEPTH = 4;
+    struct PendingRun {
+        uint64_t seq;
+        const void *callable;
+        ChipStorageTaskArgs args;
+        ChipCallConfig config;
+    };
+    void submit_loop();
+    void stop_submit_thread();
+
+    std::thread submit_thread_;
+    std::mutex pipe_mutex_;
+    std::condition_variable pipe_cv_;
+    std::deque<PendingRun> pipe_queue_;
+    std::map<uint64_t, std::exception_ptr> pipe_errors_;
+    uint64_t pipe_next_seq_ = 1;
+    uint64_t pipe_completed_seq_ = 0;
+    bool pipe_stop_ = false;
+    CompletionCallback completion_cb_;  // See set_completion_callback() for the mutation contract.
+
     std::vector<uint8_t> runtime_buf_;
     std::vector<uint8_t> aicpu_binary_;
     std::vector<uint8_t> aicore_binary_;
@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "ipc_session.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include "chip_worker.h"
+
+namespace {
+
+// Host-side pipeline hint: brief architectural pause between polls, with a
+// short sleep once a wait has clearly left the µs regime.
+inline void ipc_spin_pause() {
+#if defined(__aarch64__)
+    __asm__ volatile("yield" ::: "memory");
+#elif defined(__x86_64__)
+    __builtin_ia32_pause();
+#else
+    // other platforms: plain reload
+#endif
+}
+
+constexpr uint32_t SPIN_BEFORE_SLEEP = 20000;
+constexpr uint32_t IDLE_SLEEP_US = 50;
+
+std::string normalize_shm_name(const std::string &name) {
+    if (name.empty()) {
+        throw std::invalid_argument("IpcSession: shm name must not be empty");
+    }
+    return name[0] == '/' ? name : "/" + name;
+}
+
+void fill_error(IpcRequestSlot &slot, const char *what) {
+    slot.status = -1;
+    std::snprintf(slot.error, IPC_ERROR_MAX, "%s", what);
+}
+
+}  // namespace
+
+// ============================================================================
+// IpcSessionBroker
+// ============================================================================
+
+IpcSessionBroker::~IpcSessionBroker() {
+    stop();
+}
+
+void IpcSessionBroker::start(const std::string &name, ChipWorker *worker) {
+    if (shm_ != nullptr) {
+        throw std::runtime_error("IpcSessionBroker: already started");
+    }
+    if (worker == nullptr) {
+        throw std::invalid_argument("IpcSessionBroker: worker must not be null");
+    }
+    shm_name_ = normalize_shm_name(name);
+
+    int fd = shm_open(shm_name_.c_str(), O_CREAT | O_TRUNC | O_RDWR, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("IpcSessionBroker: shm_open(" + shm_name_ + ") failed: " + std::strerror(errno));
+    }
+    if (ftruncate(fd, sizeof(IpcSessionShm)) != 0) {
+        ::close(fd);
+        shm_unlink(shm_name_.c_str());
+        throw std::runtime_error("IpcSessionBroker: ftruncate failed: " + std::string(std::strerror(errno)));
+    }
+    void *mem = mmap(nullptr, sizeof(IpcSessionShm), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mem == MAP_FAILED) {
+        shm_unlink(shm_name_.c_str());
+        throw std::runtime_error("IpcSessionBroker: mmap failed: " + std::string(std::strerror(errno)));
+    }
+
+    // ftruncate zero-fills, which is a valid FREE state for every slot; only
+    // the header needs explicit values. broker_alive last, after the segment
+    // is fully consistent.
+    shm_ = static_cast<IpcSessionShm *>(mem);
+    shm_->magic = IPC_SESSION_MAGIC;
+    shm_->version = IPC_SESSION_VERSION;
+    shm_->broker_alive.store(1, std::memory_order_release);
+
+    worker_ = worker;
+    stop_.store(false);
+    serve_thread_ = std::thread(&IpcSessionBroker::serve_loop, this);
+}
+
+void IpcSessionBroker::stop() {
+    if (shm_ == nullptr) {
+        return;
+    }
+    shm_->broker_alive.store(0, std::memory_order_release);
+    stop_.store(true);
+    if (serve_thread_.joinable()) {
+        serve_thread_.join();
+    }
+    munmap(shm_, sizeof(IpcSessionShm));
+    shm_ = nullptr;
+    shm_unlink(shm_name_.c_str());
+    worker_ = nullptr;
+    callables_.clear();
+    next_callable_id_ = 1;
+}
+
+void IpcSessionBroker::serve_loop() {
+    uint32_t idle_passes = 0;
+    while (!stop_.load(std::memory_order_acquire)) {
+        bool served_any = false;
+        for (size_t i = 0; i < IPC_SLOT_COUNT; i++) {
+            IpcRequestSlot &slot = shm_->slots[i];
+            if (slot.state.load(std::memory_order_acquire) != static_cast<uint32_t>(IpcSlotState::POSTED)) {
+                continue;
+            }
+            execute(slot);
+            served_.fetch_add(1, std::memory_order_relaxed);
+            slot.state.store(static_cast<uint32_t>(IpcSlotState::DONE), std::memory_order_release);
+            served_any = true;
+        }
+        if (served_any) {
+            idle_passes = 0;
+        } else if (++idle_passes < SPIN_BEFORE_SLEEP) {
+            ipc_spin_pause();
+        } else {
+            usleep(IDLE_SLEEP_US);
+        }
+    }
+}
+
+void IpcSessionBroker::execute(IpcRequestSlot &slot) {
+    slot.status = 0;
+    slot.result = 0;
+    slot.error[0] = '\0';
+    try {
+        switch (static_cast<IpcOpcode>(slot.opcode)) {
+            case IpcOpcode::PING:
+                break;
+            case IpcOpcode::OPEN_CALLABLE: {
+                uint64_t id = next_callable_id_++;
+                callables_[id].resize(slot.a0);
+                slot.result = id;
+                break;
+            }
+            case IpcOpcode::WRITE_CALLABLE: {
+                auto it = callables_.find(slot.a0);
+                if (it == callables_.end()) {
+                    throw std::runtime_error("unknown callable id " + std::to_string(slot.a0));
+                }
+                if (slot.a1 + slot.payload_len > it->second.size()) {
+                    throw std::runtime_error("callable chunk out of bounds");
+                }
+                std::memcpy(it->second.data() + slot.a1, slot.payload, slot.payload_len);
+                break;
+            }
+            case IpcOpcode::RUN: {
+                auto it = callables_.find(slot.a0);
+                if (it == callables_.end()) {
+                    throw std::runtime_error("unknown callable id " + std::to_string(slot.a0));
+                }
+                ChipCallConfig config;
+                config.block_dim = static_cast<int>(slot.a1 & 0xFFFFFFFFu);
+                config.aicpu_thread_num = static_cast<int>(slot.a1 >> 32);
+                config.enable_profiling = (slot.a2 & 1u) != 0;
+                config.enable_dump_tensor = (slot.a2 & 2u) != 0;
+                TaskArgsView view = read_blob(slot.payload);
+                ChipStorageTaskArgs storage = view_to_chip_storage(view);
+                worker_->run(it->second.data(), &storage, config);
+                break;
+            }
+            case IpcOpcode::MALLOC:
+                slot.result = worker_->malloc(slot.a0);
+                break;
+            case IpcOpcode::FREE:
+                worker_->free(slot.a0);
+                break;
+            case IpcOpcode::COPY_TO:
+                worker_->copy_to(slot.a0, reinterpret_cast<uint64_t>(slot.payload), slot.payload_len);
+                break;
+            case IpcOpcode::COPY_FROM:
+                if (slot.a1 > IPC_PAYLOAD_MAX) {
+                    throw std::runtime_error("COPY_FROM length exceeds IPC_PAYLOAD_MAX");
+                }
+                worker_->copy_from(reinterpret_cast<uint64_t>(slot.payload), slot.a0, slot.a1);
+                slot.payload_len = static_cast<uint32_t>(slot.a1);
+                break;
+            default:
+                throw std::runtime_error("unknown opcode " + std::to_string(slot.opcode));
+        }
+    } catch (const std::exception &e) {
+        fill_error(slot, e.what());
+    }
+}
+
+// ============================================================================
+// IpcSessionClient
+// ============================================================================
+
+IpcSessionClient::~IpcSessionClient() {
+    close();
+}
+
+void IpcSessionClient::connect(const std::string &name) {
+    if (shm_ != nullptr) {
+        throw std::runtime_error("IpcSessionClient: already connected");
+    }
+    std::string shm_name = normalize_shm_name(name);
+    int fd = shm_open(shm_name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        throw std::runtime_error("IpcSessionClient: shm_open(" + shm_name + ") failed: " + std::strerror(errno));
+    }
+    void *mem = mmap(nullptr, sizeof(IpcSessionShm), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mem == MAP_FAILED) {
+        throw std::runtime_error("IpcSessionClient: mmap failed: " + std::string(std::strerror(errno)));
+    }
+    auto *shm = static_cast<IpcSessionShm *>(mem);
+    if (shm->magic != IPC_SESSION_MAGIC || shm->version != IPC_SESSION_VERSION) {
+        munmap(mem, sizeof(IpcSessionShm));
+        throw std::runtime_error("IpcSessionClient: segment " + shm_name + " is not an IPC session (bad magic/version)");
+    }
+    if (shm->broker_alive.load(std::memory_order_acquire) == 0) {
+        munmap(mem, sizeof(IpcSessionShm));
+        throw std::runtime_error("IpcSessionClient: broker for " + shm_name + " is gone");
+    }
+    shm_ = shm;
+}
+
+void IpcSessionClient::close() {
+    if (shm_ == nullptr) {
+        return;
+    }
+    munmap(shm_, sizeof(IpcSessionShm));
+    shm_ = nullptr;
+}
+
+IpcRequestSlot *IpcSessionClient::claim() {
+    if (shm_ == nullptr) {
+        throw std::runtime_error("IpcSessionClient: not connected");
+    }
+    uint32_t spins = 0;
+    for (;;) {
+        if (shm_->broker_alive.load(std::memory_order_acquire) == 0) {
+            throw std::runtime_error("IpcSessionClient: broker is gone");
+        }
+        for (size_t i = 0; i < IPC_SLOT_COUNT; i++) {
+            IpcRequestSlot &slot = shm_->slots[i];
+            uint32_t expected = static_cast<uint32_t>(IpcSlotState::FREE);
+            if (slot.state.compare_exchange_strong(
+                    expected, static_cast<uint32_t>(IpcSlotState::CLAIMED), std::memory_order_acquire
+                )) {
+                return &slot;
+            }
+        }
+        if (++spins < SPIN_BEFORE_SLEEP) {
+            ipc_spin_pause();
+        } else {
+            usleep(IDLE_SLEEP_US);
+        }
+    }
+}
+
+void IpcSessionClient::post_and_wait(IpcRequestSlot &slot) {
+    slot.state.store(static_cast<uint32_t>(IpcSlotState::POSTED), std::memory_order_release);
+    uint32_t spins = 0;
+    while (slot.state.load(std::memory_order_acquire) != static_cast<uint32_t>(IpcSlotState::DONE)) {
+        if (shm_->broker_alive.load(std::memory_order_acquire) == 0) {
+            throw std::runtime_error("IpcSessionClient: broker died while request was pending");
+        }
+        if (++spins < SPIN_BEFORE_SLEEP) {
+            ipc_spin_pause();
+        } else {
+            usleep(IDLE_SLEEP_US);
+        }
+    }
+    if (slot.status != 0) {
+        std::string error(slot.error, strnlen(slot.error, IPC_ERROR_MAX));
+        release(slot);
+        throw std::runtime_error("IpcSession broker: " + error);
+    }
+}
+
+void IpcSessionClient::release(IpcRequestSlot &slot) {
+    slot.state.store(static_cast<uint32_t>(IpcSlotState::FREE), std::memory_order_release);
+}
+
+void IpcSessionClient::ping() {
+    IpcRequestSlot *slot = claim();
+    slot->opcode = static_cast<uint32_t>(IpcOpcode::PING);
+    slot->a0 = slot->a1 = slot->a2 = 0;
+    slot->payload_len = 0;
+    post_and_wait(*slot);
+    release(*slot);
+}
+
+uint64_t IpcSessionClient::register_callable(const void *bytes, size_t size) {
+    uint64_t id;
+    {
+        IpcRequestSlot *slot = claim();
+        slot->opcode = static_cast<uint32_t>(IpcOpcode::OPEN_CALLABLE);
+        slot->a0 = size;
+        slot->a1 = slot->a2 = 0;
+        slot->payload_len = 0;
+        post_and_wait(*slot);
+        id = slot->result;
+        release(*slot);
+    }
+    const uint8_t *src = static_cast<const uint8_t *>(bytes);
+    for (size_t offset = 0; offset < size; offset += IPC_PAYLOAD_MAX) {
+        size_t chunk = std::min(IPC_PAYLOAD_MAX, size - offset);
+        IpcRequestSlot *slot = claim();
+        slot->opcode = static_cast<uint32_t>(IpcOpcode::WRITE_CALLABLE);
+        slot->a0 = id;
+        slot->a1 = offset;
+        slot->a2 = 0;
+        slot->payload_len = static_cast<uint32_t>(chunk);
+        std::memcpy(slot->payload, src + offset, chunk);
+        post_and_wait(*slot);
+        release(*slot);
+    }
+    return id;
+}
+
+void IpcSessionClient::run(uint64_t callable_id, const TaskArgs &args, const ChipCallConfig &config) {
+    size_t blob_size = task_args_blob_size(args);
+    if (blob_size > IPC_PAYLOAD_MAX) {
+        throw std::invalid_argument("IpcSessionClient: args blob exceeds IPC_PAYLOAD_MAX");
+    }
+    IpcRequestSlot *slot = claim();
+    slot->opcode = static_cast<uint32_t>(IpcOpcode::RUN);
+    slot->a0 = callable_id;
+    slot->a1 = static_cast<uint64_t>(static_cast<uint32_t>(config.block_dim)) |
+               (static_cast<uint64_t>(static_cast<uint32_t>(config.aicpu_thread_num)) << 32);
+    slot->a2 = (config.enable_profiling ? 1u : 0u) | (config.enable_dump_tensor ? 2u : 0u);
+    slot->payload_len = static_cast<uint32_t>(blob_size);
+    write_blob(slot->payload, args);
+    post_and_wait(*slot);
+    release(*slot);
+}
+
+uint64_t IpcSessionClient::malloc(size_t size) {
+    IpcRequestSlot *slot = claim();
+    slot->opcode = static_cast<uint32_t>(IpcOpcode::MALLOC);
+    slot->a0 = size;
+    slot->a1 = slot->a2 = 0;
+    slot->payload_len = 0;
+    post_and_wait(*slot);
+    uint64_t result = slot->result;
+    release(*slot);
+    return result;
+}
+
+void IpcSessionClient::free(uint64_t ptr) {
+    IpcRequestSlot *slot = claim();
+    slot->opcode = static_cast<uint32_t>(IpcOpcode::FREE);
+    slot->a0 = ptr;
+    slot->a1 = slot->a2 = 0;
+    slot->payload_len = 0;
+    post_and_wait(*slot);
+    release(*slot);
+}
+
+void IpcSessionClient::copy_to(uint64_t dst, const void *src, size_t size) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(src);
+    for (size_t offset = 0; offset < size; offset += IPC_PAYLOAD_MAX) {
+        size_t chunk = std::min(IPC_PAYLOAD_MAX, size - offset);
+        IpcRequestSlot *slot = claim();
+        slot->opcode = static_cast<uint32_t>(IpcOpcode::COPY_TO);
+        slot->a0 = dst + offset;
+        slot->a1 = slot->a2 = 0;
+        slot->payload_len = static_cast<uint32_t>(chunk);
+        std::memcpy(slot->payload, bytes + offset, chunk);
+        post_and_wait(*slot);
+        release(*slot);
+    }
+}
+
+void IpcSessionClient::copy_from(void *dst, uint64_t src, size_t size) {
+    uint8_t *bytes = static_cast<uint8_t *>(dst);
+    for (size_t offset = 0; offset < size; offset += IPC_PAYLOAD_MAX) {
+        size_t chunk = std::min(IPC_PAYLOAD_MAX, size - offset);
+        IpcRequestSlot *slot = claim();
+        slot->opcode = static_cast<uint32_t>(IpcOpcode::COPY_FROM);
+        slot->a0 = src + offset;
+        slot->a1 = chunk;
+        slot->a2 = 0;
+        slot->payload_len = 0;
+        post_and_wait(*slot);
+        std::memcpy(bytes + offset, slot->payload, chunk);
+        release(*slot);
+    }
+}
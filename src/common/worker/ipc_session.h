@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * IPC session — share one initialized ChipWorker across Python processes.
+ *
+ * Per-model processes each paying device init waste both init time and GM.
+ * Instead, one broker process owns the ChipWorker and serves run requests
+ * from client processes over a POSIX shared-memory request ring (µs-scale
+ * round trips; no sockets).
+ *
+ * Protocol: the shm segment holds IPC_SLOT_COUNT request slots. A client
+ * claims a FREE slot with CAS, fills opcode + params + inline payload, and
+ * flips it to POSTED. The broker's service thread scans for POSTED slots,
+ * executes the op on its ChipWorker, writes result/status, and flips the
+ * slot to DONE; the client spin-waits on DONE and releases the slot back to
+ * FREE. Requests are independent — concurrent clients just claim different
+ * slots.
+ *
+ * Callables are process-local buffers, so clients upload them once through
+ * OPEN_CALLABLE / WRITE_CALLABLE chunks; the broker stores the bytes and
+ * hands back an id used by RUN. Argument blobs travel inline in the slot
+ * payload (write_blob wire format, tags stripped); bulk host<->device data
+ * is chunked through the payload by the client-side copy helpers.
+ */
+
+#ifndef SRC_COMMON_WORKER_IPC_SESSION_H_
+#define SRC_COMMON_WORKER_IPC_SESSION_H_
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../task_interface/chip_call_config.h"
+#include "../task_interface/task_args.h"
+
+class ChipWorker;
+
+inline constexpr uint32_t IPC_SESSION_MAGIC = 0x4F545049;  // "IPTO"
+inline constexpr uint32_t IPC_SESSION_VERSION = 1;
+inline constexpr size_t IPC_SLOT_COUNT = 16;
+inline constexpr size_t IPC_PAYLOAD_MAX = 8192;
+inline constexpr size_t IPC_ERROR_MAX = 120;
+
+enum class IpcOpcode : uint32_t {
+    PING = 0,
+    OPEN_CALLABLE = 1,   // a0 = total size; result = callable id
+    WRITE_CALLABLE = 2,  // a0 = callable id, a1 = byte offset; payload = chunk
+    RUN = 3,             // a0 = callable id, a1 = block_dim | aicpu_thread_num<<32, a2 = flag bits; payload = args blob
+    MALLOC = 4,          // a0 = size; result = device pointer
+    FREE = 5,            // a0 = device pointer
+    COPY_TO = 6,         // a0 = device dst; payload = host bytes
+    COPY_FROM = 7,       // a0 = device src, a1 = length (<= IPC_PAYLOAD_MAX); payload out = bytes
+};
+
+enum class IpcSlotState : uint32_t {
+    FREE = 0,     // available for a client to claim
+    CLAIMED = 1,  // client is filling the request
+    POSTED = 2,   // broker may execute
+    DONE = 3,     // result/status valid; client reads then releases to FREE
+};
+
+struct IpcRequestSlot {
+    std::atomic<uint32_t> state;  // IpcSlotState
+    uint32_t opcode;              // IpcOpcode
+    uint64_t a0;
+    uint64_t a1;
+    uint64_t a2;
+    int32_t status;  // 0 = success; nonzero = failed, `error` holds the message
+    uint64_t result;
+    uint32_t payload_len;
+    char error[IPC_ERROR_MAX];
+    alignas(64) uint8_t payload[IPC_PAYLOAD_MAX];
+};
+
+struct IpcSessionShm {
+    uint32_t magic;
+    uint32_t version;
+    std::atomic<uint32_t> broker_alive;  // clients bail out of waits when this drops to 0
+    IpcRequestSlot slots[IPC_SLOT_COUNT];
+};
+
+/**
+ * Broker side: owns the shm segment and serves requests against a ChipWorker
+ * on a dedicated service thread. The ChipWorker stays owned by the caller
+ * (typically the broker process's Python driver) and must outlive stop().
+ */
+class IpcSessionBroker {
+public:
+    IpcSessionBroker() = default;
+    ~IpcSessionBroker();
+
+    IpcSessionBroker(const IpcSessionBroker &) = delete;
+    IpcSessionBroker &operator=(const IpcSessionBroker &) = delete;
+
+    /// Create the shm segment `name` (leading '/' optional) and start serving.
+    void start(const std::string &name, ChipWorker *worker);
+
+    /// Mark the session dead (clients' pending waits fail fast), drain the
+    /// service thread, and unlink the segment.
+    void stop();
+
+    bool is_running() const { return shm_ != nullptr; }
+    uint64_t served_count() const { return served_.load(std::memory_order_relaxed); }
+
+private:
+    void serve_loop();
+    void execute(IpcRequestSlot &slot);
+
+    std::string shm_name_;
+    IpcSessionShm *shm_ = nullptr;
+    ChipWorker *worker_ = nullptr;
+    std::thread serve_thread_;
+    std::atomic<bool> stop_{false};
+    std::atomic<uint64_t> served_{0};
+
+    // Uploaded callable buffers, broker-address-space copies (service thread only)
+    std::map<uint64_t, std::vector<uint8_t>> callables_;
+    uint64_t next_callable_id_ = 1;
+};
+
+/**
+ * Client side: attaches to an existing broker segment. All calls block until
+ * the broker has executed the request and rethrow broker-side failures as
+ * std::runtime_error. Safe to use from multiple threads (each call claims
+ * its own slot).
+ */
+class IpcSessionClient {
+public:
+    IpcSessionClient() = default;
+    ~IpcSessionClient();
+
+    IpcSessionClient(const IpcSessionClient &) = delete;
+    IpcSessionClient &operator=(const IpcSessionClient &) = delete;
+
+    /// Attach to the broker's segment. Throws when it does not exist, has a
+    /// mismatched magic/version, or the broker is already gone.
+    void connect(const std::string &name);
+    void close();
+
+    bool connected() const { return shm_ != nullptr; }
+
+    /// Round trip through the broker without touching the device.
+    void ping();
+
+    /// Upload a ChipCallable buffer; returns the broker-side callable id.
+    uint64_t register_callable(const void *bytes, size_t size);
+
+    /// Execute a run on the broker's device session and wait for completion.
+    void run(uint64_t callable_id, const TaskArgs &args, const ChipCallConfig &config);
+
+    uint64_t malloc(size_t size);
+    void free(uint64_t ptr);
+    void copy_to(uint64_t dst, const void *src, size_t size);
+    void copy_from(void *dst, uint64_t src, size_t size);
+
+private:
+    IpcRequestSlot *claim();
+    /// Flip the claimed slot to POSTED and wait for DONE. On broker-side
+    /// failure the slot is released and std::runtime_error rethrows the
+    /// error; on success the slot stays DONE so the caller can read
+    /// result/payload, then must release() it.
+    void post_and_wait(IpcRequestSlot &slot);
+    static void release(IpcRequestSlot &slot);
+
+    IpcSessionShm *shm_ = nullptr;
+};
+
+#endif  // SRC_COMMON_WORKER_IPC_SESSION_H_
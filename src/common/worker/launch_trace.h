@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef SRC_COMMON_WORKER_LAUNCH_TRACE_H_
+#define SRC_COMMON_WORKER_LAUNCH_TRACE_H_
+
+#include <time.h>
+
+#include <cstring>
+#include <mutex>
+
+#include "pto_runtime_c_api.h"
+
+// Process-wide span recorder behind the cold-start launch trace. Header-only
+// on purpose: the worker (bindings SO) and the host runtime SO each carry
+// their own instance — the worker records its half directly and pulls the
+// runtime half through the optional launch_trace_*_ctx C API, so the two
+// instances never need to see each other. Both stamp CLOCK_MONOTONIC, which
+// makes the merged timeline directly comparable.
+//
+// Recording is disabled by default; every call site pays one vDSO clock read
+// and an early-out flag check until ChipWorker::init(enable_launch_trace)
+// switches it on for the first run.
+class LaunchTraceRecorder {
+public:
+    static constexpr int MAX_SPANS = 64;
+
+    static LaunchTraceRecorder &instance() {
+        static LaunchTraceRecorder recorder;
+        return recorder;
+    }
+
+    static uint64_t now_ns() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+    }
+
+    // Enabling clears previously recorded spans so a re-armed trace starts
+    // from an empty table.
+    void set_enabled(bool on) {
+        std::lock_guard<std::mutex> lk(mutex_);
+        enabled_ = on;
+        if (on) {
+            count_ = 0;
+        }
+    }
+
+    bool enabled() const { return enabled_; }
+
+    // Record [begin_ns, now) under `name`. No-op when disabled or full.
+    void add(const char *name, uint64_t begin_ns) {
+        if (!enabled_) {
+            return;
+        }
+        uint64_t end_ns = now_ns();
+        std::lock_guard<std::mutex> lk(mutex_);
+        if (!enabled_ || count_ >= MAX_SPANS) {
+            return;
+        }
+        PtoLaunchSpan &span = spans_[count_++];
+        std::strncpy(span.name, name, sizeof(span.name) - 1);
+        span.name[sizeof(span.name) - 1] = '\0';
+        span.begin_ns = begin_ns;
+        span.end_ns = end_ns;
+    }
+
+    // Copy up to `max_spans` spans into `out`; returns the number copied.
+    int snapshot(PtoLaunchSpan *out, int max_spans) {
+        if (out == nullptr || max_spans < 0) {
+            return -1;
+        }
+        std::lock_guard<std::mutex> lk(mutex_);
+        int n = count_ < max_spans ? count_ : max_spans;
+        for (int i = 0; i < n; i++) {
+            out[i] = spans_[i];
+        }
+        return n;
+    }
+
+private:
+    LaunchTraceRecorder() = default;
+
+    std::mutex mutex_;
+    PtoLaunchSpan spans_[MAX_SPANS] = {};
+    int count_ = 0;
+    bool enabled_ = false;
+};
+
+#endif  // SRC_COMMON_WORKER_LAUNCH_TRACE_H_
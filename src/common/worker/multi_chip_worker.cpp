@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "multi_chip_worker.h"
+
+#include <stdexcept>
+#include <string>
+
+MultiChipWorker::~MultiChipWorker() { finalize(); }
+
+void MultiChipWorker::init(
+    const std::string &host_lib_path, const std::string &aicpu_path, const std::string &aicore_path,
+    const std::vector<int> &device_ids, const std::string &sim_context_lib_path
+) {
+    if (finalized_) {
+        throw std::runtime_error("MultiChipWorker already finalized; cannot reinitialize");
+    }
+    if (initialized_) {
+        throw std::runtime_error("MultiChipWorker already initialized; devices cannot be changed");
+    }
+    if (device_ids.empty()) {
+        throw std::runtime_error("MultiChipWorker requires at least one device");
+    }
+
+    try {
+        for (int device_id : device_ids) {
+            auto w = std::make_unique<ChipWorker>();
+            w->init(host_lib_path, aicpu_path, aicore_path, sim_context_lib_path);
+            w->set_device(device_id);
+            workers_.push_back(std::move(w));
+        }
+    } catch (...) {
+        workers_.clear();
+        throw;
+    }
+
+    device_ids_ = device_ids;
+    initialized_ = true;
+}
+
+void MultiChipWorker::finalize() {
+    // ChipWorker::finalize() drains its submit pipeline before teardown, so
+    // queued broadcasts complete (their errors are dropped, as in ~ChipWorker).
+    workers_.clear();
+    device_ids_.clear();
+    initialized_ = false;
+    finalized_ = true;
+}
+
+void MultiChipWorker::run(const void *callable, const void *const *args, size_t count, const ChipCallConfig &config) {
+    if (!initialized_) {
+        throw std::runtime_error("MultiChipWorker not initialized; call init() first");
+    }
+    if (count != workers_.size()) {
+        throw std::runtime_error(
+            "MultiChipWorker::run: " + std::to_string(count) + " arg slices for " + std::to_string(workers_.size()) +
+            " devices"
+        );
+    }
+
+    // Enqueue on every device before waiting on any: run_async copies the
+    // slice POD into the pipeline slot and returns, so all N submit threads
+    // start their uploads concurrently.
+    for (size_t i = 0; i < workers_.size(); i++) {
+        workers_[i]->run_async(callable, args[i], config);
+    }
+}
+
+void MultiChipWorker::drain() {
+    if (!initialized_) {
+        return;
+    }
+
+    std::string failures;
+    for (size_t i = 0; i < workers_.size(); i++) {
+        try {
+            workers_[i]->wait_all();
+        } catch (const std::exception &e) {
+            if (!failures.empty()) {
+                failures += "; ";
+            }
+            failures += "device " + std::to_string(device_ids_[i]) + ": " + e.what();
+        }
+    }
+    if (!failures.empty()) {
+        throw std::runtime_error("MultiChipWorker drain failed: " + failures);
+    }
+}
+
+ChipWorker &MultiChipWorker::worker(size_t index) {
+    if (index >= workers_.size()) {
+        throw std::runtime_error("MultiChipWorker::worker: index " + std::to_string(index) + " out of range");
+    }
+    return *workers_[index];
+}
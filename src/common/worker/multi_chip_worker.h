@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#ifndef SRC_COMMON_WORKER_MULTI_CHIP_WORKER_H_
+#define SRC_COMMON_WORKER_MULTI_CHIP_WORKER_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chip_worker.h"
+
+/**
+ * Data-parallel launch coordinator above ChipWorker.
+ *
+ * Owns one ChipWorker per device and broadcasts a single callable with
+ * per-device argument slices to all of them. Dispatch rides each worker's
+ * run_async() submit pipeline, so the N launches fan out on per-device
+ * host threads instead of being driven sequentially; drain() joins all
+ * devices and aggregates failures into one error.
+ */
+class MultiChipWorker {
+public:
+    MultiChipWorker() = default;
+    ~MultiChipWorker();
+
+    MultiChipWorker(const MultiChipWorker &) = delete;
+    MultiChipWorker &operator=(const MultiChipWorker &) = delete;
+
+    /// Bind the runtime library and claim one device per entry of
+    /// `device_ids`. Each device gets its own ChipWorker (and thus its own
+    /// RTLD_LOCAL runtime SO handle and submit pipeline).
+    void init(
+        const std::string &host_lib_path, const std::string &aicpu_path, const std::string &aicore_path,
+        const std::vector<int> &device_ids, const std::string &sim_context_lib_path = ""
+    );
+
+    /// Tear down all per-device workers. Terminal.
+    void finalize();
+
+    // Broadcast one callable with per-device argument slices. `args` must
+    // have one ChipStorageTaskArgs pointer per device; slice i goes to
+    // device_ids[i]. Returns once every device has the run queued — uploads
+    // and execution proceed concurrently on the per-device submit threads.
+    // The callable buffer must stay valid until drain() returns.
+    void run(const void *callable, const void *const *args, size_t count, const ChipCallConfig &config);
+
+    // Wait for every queued broadcast to complete on all devices. Failures
+    // are aggregated into a single error naming each failed device.
+    void drain();
+
+    size_t device_count() const { return workers_.size(); }
+    bool initialized() const { return initialized_; }
+
+    /// Per-device access for buffer management (device-resident arg slices).
+    ChipWorker &worker(size_t index);
+
+private:
+    std::vector<std::unique_ptr<ChipWorker>> workers_;
+    std::vector<int> device_ids_;
+    bool initialized_ = false;
+    bool finalized_ = false;
+};
+
+#endif  // SRC_COMMON_WORKER_MULTI_CHIP_WORKER_H_
@@ -72,6 +72,164 @@ int copy_to_device_ctx(DeviceContextHandle ctx, void *dev_ptr, const void *host_
 /** Copy device memory to a host pointer within the given device context. */
 int copy_from_device_ctx(DeviceContextHandle ctx, void *host_ptr, const void *dev_ptr, size_t size);
 
+/**
+ * Gather-upload: copy `count` host regions to their device destinations in
+ * one call. Small regions are packed into a single staging transfer and
+ * scattered on the device side, so hundreds of sub-4KB uploads collapse
+ * into ~2 driver transfers instead of one per region; large regions are
+ * copied directly. Semantically equivalent to `count` copy_to_device_ctx()
+ * calls. Optional symbol — ChipWorker falls back to per-region copies when
+ * the runtime SO does not export it.
+ * @return 0 on success, negative if any region failed.
+ */
+int copy_to_device_batch_ctx(
+    DeviceContextHandle ctx, void *const *dev_ptrs, const void *const *host_ptrs, const size_t *sizes, int count
+);
+
+/**
+ * Copy between two device pointers without a host bounce. Both pointers may
+ * live on different devices; the transfer then depends on driver peer
+ * access. Optional symbol — ChipWorker stages through host memory when the
+ * runtime SO does not export it or the transfer fails.
+ * @return 0 on success, negative on failure (caller should stage).
+ */
+int copy_between_device_ctx(DeviceContextHandle ctx, void *dst_dev, const void *src_dev, size_t size);
+
+/**
+ * Pre-pay cold-start costs for the given device so the first run_runtime()
+ * performs like steady state: attaches the calling thread, creates the
+ * run-scoped streams, pre-faults host staging and device scratch pages,
+ * and flushes one no-op copy through the async pipeline. Optional symbol —
+ * ChipWorker treats its absence as "nothing to warm".
+ * @return 0 on success, negative on failure (warm-up is best-effort; a
+ *         failure does not prevent subsequent runs).
+ */
+int warm_up_ctx(DeviceContextHandle ctx, int device_id);
+
+/**
+ * Allocate DMA-capable pinned host memory for copy staging.
+ * May return NULL on platforms where pinned staging has no benefit (e.g.
+ * simulation, where copies are plain memcpy); the caller must fall back
+ * to direct copies in that case.
+ */
+void *host_pinned_alloc_ctx(DeviceContextHandle ctx, size_t size);
+
+/** Free pinned host memory from host_pinned_alloc_ctx(). NULL is a no-op. */
+void host_pinned_free_ctx(DeviceContextHandle ctx, void *host_ptr);
+
+/* ===========================================================================
+ * Cold-start launch trace
+ * =========================================================================== */
+
+/**
+ * One timed stage of the launch path. Timestamps are host CLOCK_MONOTONIC
+ * nanoseconds; the worker and the runtime SO live in the same process, so
+ * spans recorded on either side of the dlopen boundary share one timeline.
+ */
+typedef struct PtoLaunchSpan {
+    char name[48];
+    uint64_t begin_ns;
+    uint64_t end_ns;
+} PtoLaunchSpan;
+
+/**
+ * Enable (non-zero) or disable (0) launch-span recording inside the runtime
+ * SO. Recording is process-wide rather than per-context: the trace targets
+ * the cold-start path, where exactly one context exists. Enabling clears any
+ * previously recorded spans. Optional symbol — ChipWorker reports only its
+ * own host-side spans when the runtime SO does not export it.
+ */
+void launch_trace_enable_ctx(DeviceContextHandle ctx, int enable);
+
+/**
+ * Copy up to `max_spans` recorded spans into `spans`.
+ * Optional symbol (see launch_trace_enable_ctx).
+ * @return Number of spans copied, negative on bad arguments.
+ */
+int launch_trace_get_ctx(DeviceContextHandle ctx, PtoLaunchSpan *spans, int max_spans);
+
+/* ===========================================================================
+ * Runtime health metrics
+ * =========================================================================== */
+
+/**
+ * Snapshot of the compact health block the AICPU scheduler maintains in
+ * shared memory during a run — always on, independent of profiling builds.
+ * `publish_count` is a heartbeat (it stops advancing when the scheduler
+ * stalls); tick-valued fields convert to seconds via `sys_cnt_freq_hz`.
+ */
+typedef struct PtoHealthMetrics {
+    uint32_t publish_count;              /* Publishes so far this run (heartbeat) */
+    uint32_t alloc_stall_samples;        /* Publishes that saw a full task window */
+    uint64_t publish_sys_cnt;            /* Device sys-counter stamp of the snapshot */
+    uint64_t sys_cnt_freq_hz;            /* Device counter frequency */
+    uint64_t tasks_completed;            /* Run-to-date completion count */
+    uint64_t tasks_per_sec;              /* Completion rate over the last interval */
+    uint64_t dispatch_latency_ewma_ticks; /* Dispatch -> completion EWMA */
+    uint64_t ring_tasks_live;            /* Tasks submitted but not yet retired */
+    uint64_t heap_bytes_live;            /* GM heap bytes between tail and top */
+    int32_t orch_error_code;             /* Orchestrator error code at publish time */
+    int32_t sched_error_code;            /* Scheduler error code at publish time */
+} PtoHealthMetrics;
+
+/**
+ * Device-to-host copy callback for health snapshots. The snapshot may be
+ * requested from any thread while run_runtime() blocks another, so the
+ * runtime-side reader cannot rely on the run thread's HostApi binding and
+ * is handed the transport explicitly.
+ * @return 0 on success, negative on failure.
+ */
+typedef int (*PtoHealthCopyFn)(void *copy_ctx, void *host_dst, const void *dev_src, size_t size);
+
+/**
+ * Read the current health block of the run executing on `ctx` into `out`
+ * (one small device read, wait-free on the device side). Valid while a run
+ * is in flight; between runs there is no shared memory to read. Optional
+ * symbol — ChipWorker treats its absence as "runtime publishes no health
+ * metrics", as do runtimes without a device-side scheduler.
+ * @return 0 on success, negative when no run is active or the snapshot
+ *         could not be read.
+ */
+int health_metrics_get_ctx(DeviceContextHandle ctx, PtoHealthMetrics *out);
+
+/* ===========================================================================
+ * Persistent tensor pool
+ * =========================================================================== */
+
+typedef void *PersistentPoolHandle;
+
+/**
+ * Create a device-resident persistent pool of `size` bytes (one device
+ * allocation). Persistent tensors (KV caches and other long-lived residents)
+ * allocated here live outside the ring-managed heap, so the heap no longer
+ * needs to be oversized to tolerate them.
+ * @return Opaque handle on success, NULL on failure.
+ */
+PersistentPoolHandle persistent_pool_create_ctx(DeviceContextHandle ctx, size_t size);
+
+/**
+ * Destroy a pool and release its device region.
+ * Any tensors still allocated from the pool become invalid.
+ */
+void persistent_pool_destroy_ctx(DeviceContextHandle ctx, PersistentPoolHandle pool);
+
+/**
+ * Allocate a persistent tensor from the pool (first fit, 512-byte aligned).
+ * @return Device pointer, or NULL when no free span is large enough —
+ *         call persistent_pool_compact_ctx() and retry, or grow the pool.
+ */
+void *persistent_pool_alloc_ctx(PersistentPoolHandle pool, size_t size);
+
+/** Return a tensor from persistent_pool_alloc_ctx() to the pool. */
+void persistent_pool_free_ctx(PersistentPoolHandle pool, void *dev_ptr);
+
+/**
+ * Coalesce adjacent free spans and return the largest allocatable span in
+ * bytes. Live tensors are never moved (their device pointers stay valid),
+ * so fragmentation across a live block cannot be compacted away.
+ */
+size_t persistent_pool_compact_ctx(PersistentPoolHandle pool);
+
 /**
  * Build the task graph, execute on device, copy results back, and clean up.
  *
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include "step_graph_runner.h"
+
+#include <stdexcept>
+#include <string>
+
+#include "chip_worker.h"
+
+StepGraphRunner::StepGraphRunner(ChipWorker *worker) : worker_(worker) {
+    if (worker == nullptr) {
+        throw std::invalid_argument("StepGraphRunner: worker must not be null");
+    }
+}
+
+int32_t StepGraphRunner::add_step(const void *callable, TaskArgsSchema *schema, const ChipCallConfig &config) {
+    if (callable == nullptr || schema == nullptr) {
+        throw std::invalid_argument("StepGraphRunner: callable and schema must not be null");
+    }
+    steps_.push_back(Step{callable, schema, config});
+    return static_cast<int32_t>(steps_.size()) - 1;
+}
+
+void StepGraphRunner::check_step_index(int32_t step) const {
+    if (step < 0 || step >= step_count()) {
+        throw std::out_of_range("StepGraphRunner: step index " + std::to_string(step) + " out of range");
+    }
+}
+
+void StepGraphRunner::add_tensor_patch(int32_t step, int32_t tensor_index, uint64_t base, uint64_t stride) {
+    check_step_index(step);
+    if (tensor_index < 0 || tensor_index >= steps_[static_cast<size_t>(step)].schema->tensor_count()) {
+        throw std::out_of_range("StepGraphRunner: tensor index " + std::to_string(tensor_index) + " out of range");
+    }
+    patches_.push_back(PatchRule{step, tensor_index, base, stride, false});
+}
+
+void StepGraphRunner::add_scalar_patch(int32_t step, int32_t scalar_index, uint64_t base, uint64_t stride) {
+    check_step_index(step);
+    if (scalar_index < 0 || scalar_index >= steps_[static_cast<size_t>(step)].schema->scalar_count()) {
+        throw std::out_of_range("StepGraphRunner: scalar index " + std::to_string(scalar_index) + " out of range");
+    }
+    patches_.push_back(PatchRule{step, scalar_index, base, stride, true});
+}
+
+void StepGraphRunner::patch_for_iteration(int64_t iteration) {
+    for (const PatchRule &patch : patches_) {
+        uint64_t value = patch.base + static_cast<uint64_t>(iteration) * patch.stride;
+        TaskArgsSchema *schema = steps_[static_cast<size_t>(patch.step)].schema;
+        if (patch.is_scalar) {
+            schema->set_scalar(patch.index, value);
+        } else {
+            schema->set_tensor_data(patch.index, value);
+        }
+    }
+}
+
+void StepGraphRunner::run(int64_t iterations) {
+    for (int64_t it = 0; it < iterations; it++) {
+        patch_for_iteration(it);
+        for (const Step &step : steps_) {
+            // run_async copies the POD into the pipeline slot, so the next
+            // iteration's patches cannot race the in-flight run.
+            worker_->run_async(step.callable, &step.schema->chip_storage(), step.config);
+            steps_executed_++;
+        }
+    }
+    worker_->wait_all();
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+/**
+ * StepGraphRunner - native executor for a repeating Python-declared step graph
+ *
+ * Python drivers that dispatch each step per iteration pay interpreter
+ * overhead between every device call, which bounds small-model throughput.
+ * Instead, the driver declares the step list once — (callable, compiled
+ * TaskArgsSchema, config) triples plus per-iteration patch rules — and
+ * run(n) executes all n iterations in a single C++ loop.
+ *
+ * Patch rules update the schemas between iterations without touching
+ * Python: a tensor patch writes `base + iteration * stride` into a tensor's
+ * data pointer (batched inputs laid out contiguously), a scalar patch does
+ * the same arithmetic on a scalar slot (e.g. an iteration counter with
+ * stride 1). Steps go through ChipWorker::run_async, so argument assembly
+ * for iteration i+1 overlaps device execution of iteration i; run(n) joins
+ * with wait_all() before returning.
+ *
+ * Callables and schemas stay owned by the caller and must outlive run()
+ * (the bindings pin them to the runner's lifetime).
+ */
+
+#ifndef SRC_COMMON_WORKER_STEP_GRAPH_RUNNER_H_
+#define SRC_COMMON_WORKER_STEP_GRAPH_RUNNER_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "../task_interface/chip_call_config.h"
+#include "../task_interface/task_args_schema.h"
+
+class ChipWorker;
+
+class StepGraphRunner {
+public:
+    explicit StepGraphRunner(ChipWorker *worker);
+
+    StepGraphRunner(const StepGraphRunner &) = delete;
+    StepGraphRunner &operator=(const StepGraphRunner &) = delete;
+
+    /// Append a step; steps execute in declaration order within each
+    /// iteration. Returns the step index for patch rules.
+    int32_t add_step(const void *callable, TaskArgsSchema *schema, const ChipCallConfig &config);
+
+    /// Before each iteration, tensor `tensor_index` of step `step` gets data
+    /// pointer `base + iteration * stride` (stride 0 = bind once).
+    void add_tensor_patch(int32_t step, int32_t tensor_index, uint64_t base, uint64_t stride);
+
+    /// Same arithmetic on scalar slot `scalar_index` of step `step`.
+    void add_scalar_patch(int32_t step, int32_t scalar_index, uint64_t base, uint64_t stride);
+
+    /// Execute `iterations` full passes over the step list without returning
+    /// to the caller in between. Rethrows the first failed run.
+    void run(int64_t iterations);
+
+    /// Apply the patch rules for one iteration without executing (run() calls
+    /// this per iteration; exposed for verification).
+    void patch_for_iteration(int64_t iteration);
+
+    int32_t step_count() const { return static_cast<int32_t>(steps_.size()); }
+    uint64_t steps_executed() const { return steps_executed_; }
+
+private:
+    struct Step {
+        const void *callable;
+        TaskArgsSchema *schema;
+        ChipCallConfig config;
+    };
+    struct PatchRule {
+        int32_t step;
+        int32_t index;  // tensor or scalar slot within the step's schema
+        uint64_t base;
+        uint64_t stride;
+        bool is_scalar;
+    };
+
+    void check_step_index(int32_t step) const;
+
+    ChipWorker *worker_;
+    std::vector<Step> steps_;
+    std::vector<PatchRule> patches_;
+    uint64_t steps_executed_ = 0;
+};
+
+#endif  // SRC_COMMON_WORKER_STEP_GRAPH_RUNNER_H_
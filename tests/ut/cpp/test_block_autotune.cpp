@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// block_num auto-tuning policy: cold-start spread, serial-work splitting,
+// width clamping, collision eviction, and EMA convergence.
+//
+// The history table is process-global, so each test uses its own func_id
+// range to stay independent of the others.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "pto_block_autotune.h"
+
+namespace {
+
+TEST(BlockAutotune, ColdStartUsesFullWidth) {
+    EXPECT_EQ(pto2_block_autotune_resolve(1001, 24), 24);
+    EXPECT_EQ(pto2_block_autotune_resolve(1001, 1), 1);
+    // Degenerate width still yields a launchable count.
+    EXPECT_EQ(pto2_block_autotune_resolve(1001, 0), 1);
+    EXPECT_EQ(pto2_block_autotune_resolve(INVALID_KERNEL_ID, 24), 24);
+}
+
+TEST(BlockAutotune, ShortKernelGetsFewerBlocks) {
+    // 24 blocks on a 24-wide machine finishing in 2 * MIN cycles: serial
+    // work is 48 * MIN, so full width remains the right answer.
+    pto2_block_autotune_observe(2001, 24, 2 * PTO2_AUTOTUNE_MIN_BLOCK_CYCLES);
+    EXPECT_EQ(pto2_block_autotune_resolve(2001, 24), 24);
+
+    // A kernel whose whole run fits inside two MIN budgets at block_num=1:
+    // serial work = 2 * MIN → exactly 2 blocks, not the full width.
+    pto2_block_autotune_observe(2002, 1, 2 * PTO2_AUTOTUNE_MIN_BLOCK_CYCLES);
+    EXPECT_EQ(pto2_block_autotune_resolve(2002, 24), 2);
+
+    // Sub-MIN kernels collapse to a single block.
+    pto2_block_autotune_observe(2003, 1, PTO2_AUTOTUNE_MIN_BLOCK_CYCLES / 4);
+    EXPECT_EQ(pto2_block_autotune_resolve(2003, 24), 1);
+}
+
+TEST(BlockAutotune, LongKernelCapsAtWidth) {
+    pto2_block_autotune_observe(3001, 4, 1000 * PTO2_AUTOTUNE_MIN_BLOCK_CYCLES);
+    EXPECT_EQ(pto2_block_autotune_resolve(3001, 24), 24);
+    EXPECT_EQ(pto2_block_autotune_resolve(3001, 8), 8);
+}
+
+TEST(BlockAutotune, AchievedParallelismBoundedByWidth) {
+    // 48 blocks ran on a 24-wide machine: the serial estimate must use 24,
+    // not 48 — the extra blocks were serialized, not parallel.
+    pto2_block_autotune_observe(4001, 48, 2 * PTO2_AUTOTUNE_MIN_BLOCK_CYCLES);
+    EXPECT_EQ(pto2_block_autotune_resolve(4001, 24), 24);  // 48 chunks, capped
+    EXPECT_EQ(pto2_block_autotune_resolve(4001, 4), 4);    // narrower machine: 8 chunks, capped
+}
+
+TEST(BlockAutotune, CollisionEvictsToLatestFunc) {
+    int32_t a = 5001;
+    int32_t b = a + PTO2_AUTOTUNE_TABLE_SIZE;  // same direct-mapped slot
+    pto2_block_autotune_observe(a, 1, 2 * PTO2_AUTOTUNE_MIN_BLOCK_CYCLES);
+    EXPECT_EQ(pto2_block_autotune_resolve(a, 24), 2);
+
+    pto2_block_autotune_observe(b, 1, 4 * PTO2_AUTOTUNE_MIN_BLOCK_CYCLES);
+    EXPECT_EQ(pto2_block_autotune_resolve(b, 24), 4);
+    // Evicted func falls back to cold-start behavior.
+    EXPECT_EQ(pto2_block_autotune_resolve(a, 24), 24);
+}
+
+TEST(BlockAutotune, EmaConvergesTowardNewSamples) {
+    pto2_block_autotune_observe(6001, 1, 64 * PTO2_AUTOTUNE_MIN_BLOCK_CYCLES);
+    EXPECT_EQ(pto2_block_autotune_resolve(6001, 128), 64);
+    // Workload shrank: repeated short samples pull the estimate down.
+    for (int i = 0; i < 32; i++) {
+        pto2_block_autotune_observe(6001, 1, 2 * PTO2_AUTOTUNE_MIN_BLOCK_CYCLES);
+    }
+    int16_t n = pto2_block_autotune_resolve(6001, 128);
+    EXPECT_GE(n, 2);
+    EXPECT_LE(n, 4);
+}
+
+}  // namespace
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Crash-dump flight recorder: per-thread rings keep the last K events and
+// the first abort path persists them to a binary file for offline decoding.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "pto_flight_recorder.h"
+
+// unified_log backend (normally provided by the platform library)
+extern "C" {
+void unified_log_error(const char *, const char *, ...) {}
+void unified_log_warn(const char *, const char *, ...) {}
+void unified_log_info(const char *, const char *, ...) {}
+void unified_log_debug(const char *, const char *, ...) {}
+void unified_log_always(const char *, const char *, ...) {}
+}
+
+namespace {
+
+class FlightRecorderTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        dump_path_ = std::string(::testing::TempDir()) + "pto2_flight_ut.bin";
+        std::remove(dump_path_.c_str());
+        setenv("PTO2_FLIGHT_DUMP", dump_path_.c_str(), 1);
+        pto2_flight_reset();
+    }
+
+    void TearDown() override {
+        std::remove(dump_path_.c_str());
+        unsetenv("PTO2_FLIGHT_DUMP");
+    }
+
+    // The recorder's rings are process-lived and shared across tests; a dump
+    // therefore reflects everything this thread ever recorded. Tests tag
+    // their events with distinct task_id markers and assert on the window.
+    struct Dump {
+        PTO2FlightFileHeader header{};
+        PTO2FlightRingHeader ring{};
+        PTO2FlightEvent events[PTO2_FLIGHT_RING_CAPACITY];
+    };
+
+    bool read_dump(Dump &dump) {
+        FILE *file = fopen(dump_path_.c_str(), "rb");
+        if (file == nullptr) {
+            return false;
+        }
+        bool ok = fread(&dump.header, sizeof(dump.header), 1, file) == 1 &&
+                  fread(&dump.ring, sizeof(dump.ring), 1, file) == 1 && dump.ring.emitted <= PTO2_FLIGHT_RING_CAPACITY &&
+                  fread(dump.events, sizeof(PTO2FlightEvent), dump.ring.emitted, file) == dump.ring.emitted;
+        fclose(file);
+        return ok;
+    }
+
+    std::string dump_path_;
+};
+
+TEST_F(FlightRecorderTest, DumpKeepsOnlyTheLastCapacityEvents) {
+    constexpr uint64_t kMarker = 0xF1160000u;
+    constexpr uint32_t kOverflow = 10;
+    for (uint32_t i = 0; i < PTO2_FLIGHT_RING_CAPACITY + kOverflow; i++) {
+        pto2_flight_record(PTO2FlightEventType::TASK_DISPATCH, kMarker + i, static_cast<int32_t>(i), 0);
+    }
+    pto2_flight_dump("ut_overflow");
+
+    Dump dump;
+    ASSERT_TRUE(read_dump(dump));
+    EXPECT_EQ(dump.header.magic, PTO2_FLIGHT_MAGIC);
+    EXPECT_EQ(dump.header.version, PTO2_FLIGHT_VERSION);
+    EXPECT_EQ(dump.header.event_size, sizeof(PTO2FlightEvent));
+    EXPECT_EQ(dump.header.ring_capacity, PTO2_FLIGHT_RING_CAPACITY);
+    EXPECT_STREQ(dump.header.reason, "ut_overflow");
+    ASSERT_GE(dump.header.ring_count, 1u);
+
+    // This thread's ring is the first claimed in the process; it must be
+    // full, with the oldest kOverflow events of this burst overwritten.
+    ASSERT_EQ(dump.ring.emitted, PTO2_FLIGHT_RING_CAPACITY);
+    EXPECT_GE(dump.ring.total_count, static_cast<uint64_t>(PTO2_FLIGHT_RING_CAPACITY + kOverflow));
+    EXPECT_EQ(dump.events[0].task_id, kMarker + kOverflow);
+    const PTO2FlightEvent &last = dump.events[PTO2_FLIGHT_RING_CAPACITY - 1];
+    EXPECT_EQ(last.task_id, kMarker + PTO2_FLIGHT_RING_CAPACITY + kOverflow - 1);
+    EXPECT_EQ(last.type, static_cast<uint8_t>(PTO2FlightEventType::TASK_DISPATCH));
+}
+
+TEST_F(FlightRecorderTest, EventFieldsRoundTrip) {
+    pto2_flight_record(PTO2FlightEventType::ALLOC_STALL, 0, 4096, 1);
+    pto2_flight_record(PTO2FlightEventType::ABORT, 0x200000a00u, -7, 42);
+    pto2_flight_dump("ut_fields");
+
+    Dump dump;
+    ASSERT_TRUE(read_dump(dump));
+    ASSERT_GE(dump.ring.emitted, 2u);
+    const PTO2FlightEvent &stall = dump.events[dump.ring.emitted - 2];
+    EXPECT_EQ(stall.type, static_cast<uint8_t>(PTO2FlightEventType::ALLOC_STALL));
+    EXPECT_EQ(stall.arg0, 4096);
+    EXPECT_EQ(stall.arg1, 1);
+    const PTO2FlightEvent &abort_ev = dump.events[dump.ring.emitted - 1];
+    EXPECT_EQ(abort_ev.type, static_cast<uint8_t>(PTO2FlightEventType::ABORT));
+    EXPECT_EQ(abort_ev.task_id, 0x200000a00u);
+    EXPECT_EQ(abort_ev.arg0, -7);
+    EXPECT_EQ(abort_ev.arg1, 42);
+}
+
+TEST_F(FlightRecorderTest, DumpIsOneShotUntilReset) {
+    pto2_flight_record(PTO2FlightEventType::SCOPE_BEGIN, 0, 1, 0);
+    pto2_flight_dump("ut_first");
+
+    // A second abort path must not clobber the already-persisted history
+    std::remove(dump_path_.c_str());
+    pto2_flight_dump("ut_second");
+    Dump dump;
+    EXPECT_FALSE(read_dump(dump));
+
+    // A new run (orchestrator init) re-arms the dump
+    pto2_flight_reset();
+    pto2_flight_dump("ut_third");
+    ASSERT_TRUE(read_dump(dump));
+    EXPECT_STREQ(dump.header.reason, "ut_third");
+}
+
+}  // namespace
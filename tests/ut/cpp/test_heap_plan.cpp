@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "heap_plan.h"
+
+namespace {
+
+// Capture-stream shorthand: node `slot` depends on `producers`, and (when
+// bytes > 0) auto-allocates one span of `bytes`.
+void submit(HeapPlanner &p, TaskSlot slot, std::vector<TaskSlot> producers, uint64_t bytes = 0) {
+    if (bytes > 0) p.record_alloc(slot, bytes);
+    p.record_task(slot, producers);
+}
+
+// Two placed spans overlap in memory iff their [offset, offset+bytes) ranges do.
+bool overlaps(const HeapPlan::Span &a, const HeapPlan::Span &b) {
+    return a.offset < b.offset + b.bytes && b.offset < a.offset + a.bytes;
+}
+
+}  // namespace
+
+TEST(HeapPlan, EmptyCaptureYieldsEmptyPlan) {
+    HeapPlanner p;
+    HeapPlan plan = p.plan();
+    EXPECT_TRUE(plan.spans.empty());
+    EXPECT_EQ(plan.required_bytes, 0u);
+    EXPECT_EQ(p.span_count(), 0);
+}
+
+TEST(HeapPlan, ChainReusesDeadAncestorBytes) {
+    // A -> B -> C: when C starts, A's span is dead (its only reader B is an
+    // ancestor of C), so C can take A's offset. Peak = 2 spans, not 3.
+    HeapPlanner p;
+    submit(p, 0, {}, 1024);
+    submit(p, 1, {0}, 1024);
+    submit(p, 2, {1}, 1024);
+    HeapPlan plan = p.plan();
+    ASSERT_EQ(plan.spans.size(), 3u);
+    EXPECT_EQ(plan.required_bytes, 2048u);
+    EXPECT_EQ(plan.sum_bytes, 3072u);
+    EXPECT_EQ(plan.spans[2].offset, plan.spans[0].offset);
+    EXPECT_TRUE(overlaps(plan.spans[0], plan.spans[2]));
+    EXPECT_FALSE(overlaps(plan.spans[0], plan.spans[1]));
+    EXPECT_FALSE(overlaps(plan.spans[1], plan.spans[2]));
+}
+
+TEST(HeapPlan, IndependentBranchesNeverShareBytes) {
+    // Two parallel chains with no cross edges: nothing proves their
+    // executions are ordered, so no span may overlap another's.
+    HeapPlanner p;
+    submit(p, 0, {}, 1024);
+    submit(p, 1, {}, 1024);
+    submit(p, 2, {0}, 1024);
+    submit(p, 3, {1}, 1024);
+    HeapPlan plan = p.plan();
+    ASSERT_EQ(plan.spans.size(), 4u);
+    for (size_t i = 0; i < plan.spans.size(); ++i) {
+        for (size_t j = i + 1; j < plan.spans.size(); ++j) {
+            EXPECT_FALSE(overlaps(plan.spans[i], plan.spans[j])) << "spans " << i << " and " << j;
+        }
+    }
+    EXPECT_EQ(plan.required_bytes, 4096u);
+}
+
+TEST(HeapPlan, LiveSpanWithUnorderedReaderIsNotReused) {
+    // Diamond: A feeds B and C; D joins B only. C may still be reading A
+    // when D runs (C is not an ancestor of D), so D must not take A's bytes
+    // even though A itself is D's ancestor.
+    HeapPlanner p;
+    submit(p, 0, {}, 1024);      // A
+    submit(p, 1, {0}, 1024);     // B
+    submit(p, 2, {0}, 1024);     // C
+    submit(p, 3, {1}, 1024);     // D
+    HeapPlan plan = p.plan();
+    ASSERT_EQ(plan.spans.size(), 4u);
+    EXPECT_FALSE(overlaps(plan.spans[0], plan.spans[3]));
+}
+
+TEST(HeapPlan, JoinOverBothReadersUnlocksReuse) {
+    // Same diamond, but D joins B and C — every reader of A is now an
+    // ancestor of D, so A's span is provably dead and D reuses it.
+    HeapPlanner p;
+    submit(p, 0, {}, 1024);
+    submit(p, 1, {0}, 1024);
+    submit(p, 2, {0}, 1024);
+    submit(p, 3, {1, 2}, 1024);
+    HeapPlan plan = p.plan();
+    ASSERT_EQ(plan.spans.size(), 4u);
+    EXPECT_EQ(plan.spans[3].offset, plan.spans[0].offset);
+    EXPECT_EQ(plan.required_bytes, 3072u);
+}
+
+TEST(HeapPlan, MixedSizesPackIntoLowestGap)  {
+    // A(4K) -> B(1K) -> C(2K): C fits inside A's dead 4K span at its start,
+    // below B's still-placed 1K span only if B sits above 4K — lowest-gap
+    // placement puts C at offset 0.
+    HeapPlanner p;
+    submit(p, 0, {}, 4096);
+    submit(p, 1, {0}, 1024);
+    submit(p, 2, {1}, 2048);
+    HeapPlan plan = p.plan();
+    ASSERT_EQ(plan.spans.size(), 3u);
+    EXPECT_EQ(plan.spans[0].offset, 0u);
+    EXPECT_EQ(plan.spans[1].offset, 4096u);
+    EXPECT_EQ(plan.spans[2].offset, 0u);
+    EXPECT_EQ(plan.required_bytes, 5120u);
+}
+
+TEST(HeapPlan, NonAllocatingNodesCarryLivenessOnly) {
+    // B has no outputs of its own but reads A; C depends on B. A's span
+    // still dies before C (its reader B is C's ancestor), and the plan has
+    // spans only for the allocating submits.
+    HeapPlanner p;
+    submit(p, 0, {}, 1024);
+    submit(p, 1, {0});  // reader, no alloc
+    submit(p, 2, {1}, 1024);
+    HeapPlan plan = p.plan();
+    ASSERT_EQ(plan.spans.size(), 2u);
+    EXPECT_EQ(p.span_count(), 2);
+    EXPECT_EQ(plan.spans[1].offset, plan.spans[0].offset);
+    EXPECT_EQ(plan.required_bytes, 1024u);
+}
+
+TEST(HeapPlan, UnknownProducersAreIgnored) {
+    // Edges to slots never recorded (user buffers, pre-capture tasks) are
+    // dropped rather than corrupting the node table.
+    HeapPlanner p;
+    submit(p, 5, {}, 1024);
+    submit(p, 6, {3, 4, 5}, 1024);  // 3 and 4 were never recorded
+    submit(p, 7, {6}, 1024);
+    HeapPlan plan = p.plan();
+    ASSERT_EQ(plan.spans.size(), 3u);
+    EXPECT_EQ(plan.spans[2].offset, plan.spans[0].offset);
+}
+
+TEST(HeapPlan, ResetDropsCapturedState) {
+    HeapPlanner p;
+    submit(p, 0, {}, 1024);
+    submit(p, 1, {0}, 1024);
+    p.reset();
+    EXPECT_EQ(p.span_count(), 0);
+    submit(p, 0, {}, 2048);
+    HeapPlan plan = p.plan();
+    ASSERT_EQ(plan.spans.size(), 1u);
+    EXPECT_EQ(plan.required_bytes, 2048u);
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Host logger MPSC staging ring: no lost records under concurrent
+// producers, per-producer ordering, level filtering, truncation.
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "host_log.h"
+
+// unified_log backend (normally provided by the platform library)
+extern "C" {
+void unified_log_error(const char *, const char *, ...) {}
+void unified_log_warn(const char *, const char *, ...) {}
+void unified_log_info(const char *, const char *, ...) {}
+void unified_log_debug(const char *, const char *, ...) {}
+void unified_log_always(const char *, const char *, ...) {}
+}
+
+namespace {
+
+class HostLogTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = ::testing::TempDir() + "host_log_" + std::to_string(getpid()) + "_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".log";
+        setenv("PTO_LOG_FILE", path_.c_str(), 1);
+        setenv("PTO_LOG_LEVEL", "debug", 1);
+        HostLogger::get_instance().reinitialize();
+    }
+
+    void TearDown() override {
+        unsetenv("PTO_LOG_FILE");
+        unsetenv("PTO_LOG_LEVEL");
+        unlink(path_.c_str());
+    }
+
+    std::vector<std::string> read_lines() {
+        HostLogger::get_instance().flush();
+        std::vector<std::string> lines;
+        std::ifstream in(path_);
+        std::string line;
+        while (std::getline(in, line)) {
+            lines.push_back(line);
+        }
+        return lines;
+    }
+
+    std::string path_;
+};
+
+TEST_F(HostLogTest, ConcurrentProducersLoseNothingAndKeepPerProducerOrder) {
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 200;  // Total fits in the ring, so no drops
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < PRODUCERS; p++) {
+        threads.emplace_back([p] {
+            for (int i = 0; i < PER_PRODUCER; i++) {
+                HOST_LOG_INFO("producer=%d seq=%d", p, i);
+            }
+        });
+    }
+    for (auto &t : threads) {
+        t.join();
+    }
+
+    std::vector<std::string> lines = read_lines();
+    ASSERT_EQ(lines.size(), static_cast<size_t>(PRODUCERS * PER_PRODUCER));
+    EXPECT_EQ(HostLogger::get_instance().dropped_count(), 0u);
+
+    int next_seq[PRODUCERS] = {};
+    for (const std::string &line : lines) {
+        int p = -1;
+        int seq = -1;
+        ASSERT_EQ(sscanf(line.c_str(), "[INFO] producer=%d seq=%d", &p, &seq), 2) << line;
+        ASSERT_GE(p, 0);
+        ASSERT_LT(p, PRODUCERS);
+        EXPECT_EQ(seq, next_seq[p]) << line;
+        next_seq[p] = seq + 1;
+    }
+}
+
+TEST_F(HostLogTest, LevelFilterAppliesBeforeStaging) {
+    setenv("PTO_LOG_LEVEL", "warn", 1);
+    HostLogger::get_instance().reinitialize();
+
+    HOST_LOG_INFO("filtered out");
+    HOST_LOG_WARN("kept");
+
+    std::vector<std::string> lines = read_lines();
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0], "[WARN] kept");
+}
+
+TEST_F(HostLogTest, OversizedMessageIsTruncatedNotSplit) {
+    std::string big(HostLogger::RECORD_TEXT_MAX + 100, 'x');
+    HOST_LOG_INFO("%s", big.c_str());
+
+    std::vector<std::string> lines = read_lines();
+    ASSERT_EQ(lines.size(), 1u);
+    // "[INFO] " prefix plus at most RECORD_TEXT_MAX - 1 formatted characters
+    EXPECT_EQ(lines[0].size(), 7 + HostLogger::RECORD_TEXT_MAX - 1);
+}
+
+TEST_F(HostLogTest, TrailingNewlineInFormatDoesNotProduceBlankLine) {
+    HOST_LOG_INFO("with newline\n");
+    HOST_LOG_INFO("without newline");
+
+    std::vector<std::string> lines = read_lines();
+    ASSERT_EQ(lines.size(), 2u);
+    EXPECT_EQ(lines[0], "[INFO] with newline");
+    EXPECT_EQ(lines[1], "[INFO] without newline");
+}
+
+}  // namespace
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Shared-memory IPC session: slot protocol, callable upload, and broker-side
+// error propagation. Device-free — the broker's ChipWorker has no device set,
+// so device ops are expected to fail with a propagated error.
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chip_worker.h"
+#include "ipc_session.h"
+
+namespace {
+
+std::string unique_shm_name(const char *tag) {
+    return std::string("pto_ipc_ut_") + tag + "_" + std::to_string(getpid());
+}
+
+TEST(IpcSession, PingRoundTripsAndCountsRequests) {
+    ChipWorker worker;
+    IpcSessionBroker broker;
+    std::string name = unique_shm_name("ping");
+    broker.start(name, &worker);
+
+    IpcSessionClient client;
+    client.connect(name);
+    client.ping();
+    client.ping();
+    EXPECT_EQ(broker.served_count(), 2u);
+
+    client.close();
+    broker.stop();
+    EXPECT_FALSE(broker.is_running());
+}
+
+TEST(IpcSession, ConnectRejectsMissingSegment) {
+    IpcSessionClient client;
+    EXPECT_THROW(client.connect(unique_shm_name("missing")), std::runtime_error);
+}
+
+TEST(IpcSession, CallableUploadIsChunkedAndIdsAreDistinct) {
+    ChipWorker worker;
+    IpcSessionBroker broker;
+    std::string name = unique_shm_name("upload");
+    broker.start(name, &worker);
+
+    IpcSessionClient client;
+    client.connect(name);
+
+    // Larger than one payload: forces multiple WRITE_CALLABLE chunks
+    std::vector<uint8_t> big(3 * IPC_PAYLOAD_MAX + 100, 0xAB);
+    uint64_t id1 = client.register_callable(big.data(), big.size());
+    uint64_t id2 = client.register_callable(big.data(), 16);
+    EXPECT_NE(id1, 0u);
+    EXPECT_NE(id1, id2);
+
+    broker.stop();
+}
+
+TEST(IpcSession, BrokerErrorsPropagateToTheClient) {
+    ChipWorker worker;  // No device set: every device op must fail broker-side
+    IpcSessionBroker broker;
+    std::string name = unique_shm_name("errors");
+    broker.start(name, &worker);
+
+    IpcSessionClient client;
+    client.connect(name);
+
+    EXPECT_THROW(client.malloc(64), std::runtime_error);
+
+    TaskArgs args;
+    ChipCallConfig config;
+    EXPECT_THROW(client.run(12345, args, config), std::runtime_error);  // Unknown callable id
+
+    uint64_t id = client.register_callable("x", 1);
+    EXPECT_THROW(client.run(id, args, config), std::runtime_error);  // Known id, but no device
+
+    broker.stop();
+}
+
+TEST(IpcSession, ClientFailsFastWhenBrokerStops) {
+    ChipWorker worker;
+    IpcSessionBroker broker;
+    std::string name = unique_shm_name("dead");
+    broker.start(name, &worker);
+
+    IpcSessionClient client;
+    client.connect(name);
+    client.ping();
+    broker.stop();
+
+    EXPECT_THROW(client.ping(), std::runtime_error);
+}
+
+TEST(IpcSession, ConcurrentClientsClaimIndependentSlots) {
+    ChipWorker worker;
+    IpcSessionBroker broker;
+    std::string name = unique_shm_name("mt");
+    broker.start(name, &worker);
+
+    constexpr int THREADS = 4;
+    constexpr int PINGS = 200;
+    std::vector<std::thread> clients;
+    for (int t = 0; t < THREADS; t++) {
+        clients.emplace_back([&name]() {
+            IpcSessionClient client;
+            client.connect(name);
+            for (int i = 0; i < PINGS; i++) {
+                client.ping();
+            }
+        });
+    }
+    for (auto &c : clients) {
+        c.join();
+    }
+    EXPECT_EQ(broker.served_count(), static_cast<uint64_t>(THREADS) * PINGS);
+
+    broker.stop();
+}
+
+}  // namespace
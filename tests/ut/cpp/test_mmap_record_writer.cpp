@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Chunked mmap record stream: append/finalize/read-back round trip,
+// chunk rollover, and footer validation.
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "host/mmap_record_writer.h"
+
+// unified_log backend (normally provided by the platform library)
+extern "C" {
+void unified_log_error(const char *, const char *, ...) {}
+void unified_log_warn(const char *, const char *, ...) {}
+void unified_log_info(const char *, const char *, ...) {}
+void unified_log_debug(const char *, const char *, ...) {}
+void unified_log_always(const char *, const char *, ...) {}
+}
+
+namespace {
+
+class MmapRecordWriterTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = ::testing::TempDir() + "mmap_stream_" + std::to_string(getpid()) + "_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin";
+    }
+
+    void TearDown() override { unlink(path_.c_str()); }
+
+    std::string path_;
+};
+
+TEST_F(MmapRecordWriterTest, RoundTripAcrossChunks) {
+    constexpr uint64_t CHUNK = 4096;
+    MmapRecordWriter writer;
+    ASSERT_EQ(writer.open(path_, CHUNK), 0);
+
+    // Varying sizes force several chunk rollovers
+    std::vector<std::vector<uint8_t>> payloads;
+    for (uint32_t i = 0; i < 64; i++) {
+        std::vector<uint8_t> payload(100 + (i * 37) % 900);
+        for (size_t b = 0; b < payload.size(); b++) {
+            payload[b] = static_cast<uint8_t>(i + b);
+        }
+        ASSERT_EQ(writer.append(i % 4, payload.data(), payload.size()), 0);
+        payloads.push_back(std::move(payload));
+    }
+    EXPECT_EQ(writer.total_entries(), 64u);
+    ASSERT_EQ(writer.finalize(), 0);
+    EXPECT_FALSE(writer.is_open());
+
+    MmapRecordReader reader;
+    ASSERT_EQ(reader.open(path_), 0);
+    EXPECT_EQ(reader.total_entries(), 64u);
+
+    uint32_t seen = 0;
+    reader.for_each([&](uint32_t stream_id, const void *data, uint64_t bytes) {
+        ASSERT_LT(seen, 64u);
+        EXPECT_EQ(stream_id, seen % 4);
+        ASSERT_EQ(bytes, payloads[seen].size());
+        EXPECT_EQ(memcmp(data, payloads[seen].data(), bytes), 0);
+        seen++;
+    });
+    EXPECT_EQ(seen, 64u);
+}
+
+TEST_F(MmapRecordWriterTest, EmptyStreamFinalizesWithValidFooter) {
+    MmapRecordWriter writer;
+    ASSERT_EQ(writer.open(path_, 4096), 0);
+    ASSERT_EQ(writer.finalize(), 0);
+    EXPECT_EQ(writer.finalize(), 0);  // Idempotent
+
+    MmapRecordReader reader;
+    ASSERT_EQ(reader.open(path_), 0);
+    EXPECT_EQ(reader.total_entries(), 0u);
+    uint32_t seen = 0;
+    reader.for_each([&](uint32_t, const void *, uint64_t) { seen++; });
+    EXPECT_EQ(seen, 0u);
+}
+
+TEST_F(MmapRecordWriterTest, RejectsEntryLargerThanChunk) {
+    MmapRecordWriter writer;
+    ASSERT_EQ(writer.open(path_, 4096), 0);
+    std::vector<uint8_t> big(8192);
+    EXPECT_EQ(writer.append(0, big.data(), big.size()), -1);
+    EXPECT_EQ(writer.total_entries(), 0u);
+    ASSERT_EQ(writer.finalize(), 0);
+}
+
+TEST_F(MmapRecordWriterTest, ReaderRejectsMissingOrCorruptFile) {
+    MmapRecordReader reader;
+    EXPECT_EQ(reader.open(path_ + ".does_not_exist"), -1);
+
+    std::ofstream garbage(path_, std::ios::binary);
+    std::vector<char> junk(1024, 0x5A);
+    garbage.write(junk.data(), junk.size());
+    garbage.close();
+    EXPECT_EQ(reader.open(path_), -1);
+    EXPECT_FALSE(reader.is_open());
+}
+
+}  // namespace
@@ -19,6 +19,7 @@
 #include "scope.h"
 #include "tensormap.h"
 #include "types.h"
+#include "worker_manager.h"
 #include "task_args.h"
 
 // ---------------------------------------------------------------------------
@@ -276,3 +277,311 @@ TEST_F(OrchestratorFixture, OutputAndOutputExistingAreInsertOnly) {
         }
     }
 }
+
+TEST_F(OrchestratorFixture, ArenaArgsSubmitStoresViewNotCopy) {
+    ArenaArgs a = orch.make_args(/*tensor_cap=*/1, /*scalar_cap=*/1);
+    ContinuousTensor t{};
+    t.data = 0xD0;
+    t.ndims = 1;
+    t.shapes[0] = 1;
+    t.dtype = DataType::UINT8;
+    a.add_tensor(t, TensorArgType::OUTPUT);
+    a.add_scalar(42);
+
+    auto res = orch.submit_next_level(0xDEAD, a, cfg);
+    ASSERT_NE(res.task_slot, INVALID_SLOT);
+
+    // The slot holds a view into the arena, not a TaskArgs copy.
+    EXPECT_EQ(S(res.task_slot).task_args.tensor_count(), 0);
+    ASSERT_EQ(S(res.task_slot).arena_views.size(), 1u);
+    EXPECT_EQ(S(res.task_slot).args_view(0).tensors, a.tensors_);
+    EXPECT_EQ(S(res.task_slot).args_view(0).tensors[0].data, 0xD0u);
+    EXPECT_EQ(S(res.task_slot).args_view(0).scalars[0], 42u);
+
+    // Dependency inference ran over the arena args like a TaskArgs submit.
+    EXPECT_EQ(tm.lookup(TensorKey{0xD0, -1}), res.task_slot);
+}
+
+TEST_F(OrchestratorFixture, ArenaArgsOutputAutoAllocPatchesArenaInPlace) {
+    ArenaArgs a = orch.make_args(/*tensor_cap=*/1, /*scalar_cap=*/0);
+    ContinuousTensor t{};
+    t.data = 0;
+    t.ndims = 1;
+    t.shapes[0] = 1024;
+    t.dtype = DataType::UINT8;
+    a.add_tensor(t, TensorArgType::OUTPUT);
+
+    auto res = orch.submit_next_level(0xDEAD, a, cfg);
+    ASSERT_NE(res.task_slot, INVALID_SLOT);
+
+    // The auto-allocated pointer lands in the arena-resident tensor itself,
+    // so the dispatch view sees it without any per-slot copy.
+    uint64_t data = a.tensors_[0].data;
+    ASSERT_NE(data, 0u);
+    EXPECT_EQ(S(res.task_slot).args_view(0).tensors[0].data, data);
+    EXPECT_EQ(tm.lookup(TensorKey{data, -1}), res.task_slot);
+}
+
+TEST_F(OrchestratorFixture, ArenaArgsGroupSubmit) {
+    ArenaArgs a0 = orch.make_args(1, 0);
+    ArenaArgs a1 = orch.make_args(1, 0);
+    ContinuousTensor t{};
+    t.ndims = 1;
+    t.shapes[0] = 1;
+    t.dtype = DataType::UINT8;
+    t.data = 0xE0;
+    a0.add_tensor(t, TensorArgType::OUTPUT);
+    t.data = 0xE1;
+    a1.add_tensor(t, TensorArgType::OUTPUT);
+
+    auto res = orch.submit_next_level_group(0xDEAD, {a0, a1}, cfg);
+    ASSERT_NE(res.task_slot, INVALID_SLOT);
+    EXPECT_TRUE(S(res.task_slot).is_group());
+    EXPECT_EQ(S(res.task_slot).group_size(), 2);
+    EXPECT_TRUE(S(res.task_slot).task_args_list.empty());
+    EXPECT_EQ(S(res.task_slot).args_view(0).tensors[0].data, 0xE0u);
+    EXPECT_EQ(S(res.task_slot).args_view(1).tensors[0].data, 0xE1u);
+    EXPECT_EQ(tm.lookup(TensorKey{0xE0, -1}), res.task_slot);
+    EXPECT_EQ(tm.lookup(TensorKey{0xE1, -1}), res.task_slot);
+}
+
+TEST_F(OrchestratorFixture, GroupSharedInputWiresSingleFanin) {
+    // Producer for the shared tensor.
+    auto args_p = single_tensor_args(0x5000, TensorArgType::OUTPUT);
+    auto p = orch.submit_next_level(0xDEAD, args_p, cfg);
+    TaskSlot drain_slot;
+    rq.try_pop(drain_slot);
+
+    // Every entry in the group reads the same key: the batched inference
+    // pass answers repeats from its per-submit cache, and the consumer ends
+    // up with exactly one fanin edge on the producer.
+    std::vector<TaskArgs> batch;
+    for (int i = 0; i < 8; ++i) {
+        batch.push_back(single_tensor_args(0x5000, TensorArgType::INPUT));
+    }
+    auto c = orch.submit_next_level_group(0xDEAD, batch, cfg);
+
+    EXPECT_EQ(S(c.task_slot).fanin_count, 1);
+    ASSERT_EQ(S(c.task_slot).fanin_producers.size(), 1u);
+    EXPECT_EQ(S(c.task_slot).fanin_producers[0], p.task_slot);
+    {
+        std::lock_guard<std::mutex> lk(S(p.task_slot).fanout_mu);
+        ASSERT_EQ(S(p.task_slot).fanout_consumers.size(), 1u);
+    }
+}
+
+TEST_F(OrchestratorFixture, GroupProduceThenConsumeIsNotAFanin) {
+    // One batch writes a key (entry 0) and later entries read it: a
+    // within-batch self-reference, not a dependency. The shared OUTPUT key
+    // registers exactly one tensormap entry and one cleanup key.
+    std::vector<TaskArgs> batch;
+    batch.push_back(single_tensor_args(0x6000, TensorArgType::OUTPUT));
+    batch.push_back(single_tensor_args(0x6000, TensorArgType::INPUT));
+    batch.push_back(single_tensor_args(0x6000, TensorArgType::INPUT));
+    auto res = orch.submit_next_level_group(0xDEAD, batch, cfg);
+
+    EXPECT_EQ(S(res.task_slot).fanin_count, 0);
+    EXPECT_EQ(S(res.task_slot).state.load(), TaskState::READY);
+    EXPECT_EQ(tm.lookup(TensorKey{0x6000, -1}), res.task_slot);
+    EXPECT_EQ(S(res.task_slot).output_keys.size(), 1u);
+}
+
+TEST_F(OrchestratorFixture, ResubmitAliasesTemplateArgs) {
+    auto args = single_tensor_args(0x9000, TensorArgType::OUTPUT);
+    auto tmpl = orch.submit_next_level(0xDEAD, args, cfg);
+    TaskSlot drain_slot;
+    rq.try_pop(drain_slot);
+    orch.mark_recurring(tmpl.task_slot);
+    EXPECT_TRUE(S(tmpl.task_slot).recurring);
+
+    auto clone = orch.resubmit(tmpl.task_slot);
+    ASSERT_NE(clone.task_slot, INVALID_SLOT);
+    ASSERT_NE(clone.task_slot, tmpl.task_slot);
+
+    // The clone carries no TaskArgs copy — only a view into the template's
+    // stored args (same pointer-aliasing shape as an arena submit).
+    EXPECT_EQ(S(clone.task_slot).task_args.tensor_count(), 0);
+    ASSERT_EQ(S(clone.task_slot).arena_views.size(), 1u);
+    EXPECT_EQ(S(clone.task_slot).args_view(0).tensors, S(tmpl.task_slot).task_args.tensor_data());
+    EXPECT_EQ(S(clone.task_slot).args_view(0).tensors[0].data, 0x9000u);
+
+    // Callable / config came across; the clone is not itself a template.
+    EXPECT_EQ(S(clone.task_slot).callable, 0xDEADu);
+    EXPECT_FALSE(S(clone.task_slot).recurring);
+
+    // OUTPUT re-registers: the clone is now the producer of the key.
+    EXPECT_EQ(tm.lookup(TensorKey{0x9000, -1}), clone.task_slot);
+    EXPECT_EQ(S(clone.task_slot).state.load(), TaskState::READY);
+}
+
+TEST_F(OrchestratorFixture, ResubmitReinfersDependenciesEachIteration) {
+    // Producer template writes a key; a consumer submitted after a resubmit
+    // must depend on the newest clone, not the original template — dep
+    // inference re-runs in full on every resubmit.
+    auto p_args = single_tensor_args(0x9100, TensorArgType::OUTPUT);
+    auto p = orch.submit_next_level(0xDEAD, p_args, cfg);
+    TaskSlot drain_slot;
+    rq.try_pop(drain_slot);
+    orch.mark_recurring(p.task_slot);
+
+    auto clone = orch.resubmit(p.task_slot);
+    rq.try_pop(drain_slot);
+    EXPECT_EQ(tm.lookup(TensorKey{0x9100, -1}), clone.task_slot);
+
+    auto c_args = single_tensor_args(0x9100, TensorArgType::INPUT);
+    auto c = orch.submit_next_level(0xDEAD, c_args, cfg);
+    EXPECT_EQ(S(c.task_slot).state.load(), TaskState::PENDING);
+    ASSERT_EQ(S(c.task_slot).fanin_producers.size(), 1u);
+    EXPECT_EQ(S(c.task_slot).fanin_producers[0], clone.task_slot);
+}
+
+TEST_F(OrchestratorFixture, MarkRecurringRejectsUnsuitableTemplates) {
+    // Unmarked slot cannot be resubmitted.
+    auto plain = orch.submit_next_level(0xDEAD, single_tensor_args(0x9200, TensorArgType::OUTPUT), cfg);
+    EXPECT_THROW(orch.resubmit(plain.task_slot), std::invalid_argument);
+
+    // Auto-allocated OUTPUT slabs die with the template slot's FIFO release,
+    // so such a task cannot serve as a recurring template.
+    TaskArgs auto_out;
+    ContinuousTensor t{};
+    t.data = 0;
+    t.ndims = 1;
+    t.shapes[0] = 64;
+    t.dtype = DataType::UINT8;
+    auto_out.add_tensor(t, TensorArgType::OUTPUT);
+    auto heap_task = orch.submit_next_level(0xDEAD, auto_out, cfg);
+    EXPECT_TRUE(S(heap_task.task_slot).heap_outputs);
+    EXPECT_THROW(orch.mark_recurring(heap_task.task_slot), std::invalid_argument);
+
+    // Arena-backed submissions store tag-less views — dep inference cannot
+    // re-run from them.
+    ArenaArgs a = orch.make_args(1, 0);
+    ContinuousTensor t2{};
+    t2.data = 0x9300;
+    t2.ndims = 1;
+    t2.shapes[0] = 1;
+    t2.dtype = DataType::UINT8;
+    a.add_tensor(t2, TensorArgType::OUTPUT);
+    auto arena_task = orch.submit_next_level(0xDEAD, a, cfg);
+    EXPECT_THROW(orch.mark_recurring(arena_task.task_slot), std::invalid_argument);
+}
+
+TEST_F(OrchestratorFixture, RegisteredCallableSubmitUsesStoredEntry) {
+    ChipCallConfig reg_cfg;
+    reg_cfg.block_dim = 8;
+    reg_cfg.enable_profiling = true;
+    int32_t id = orch.register_callable(0xBEEF, reg_cfg);
+    EXPECT_EQ(id, 0);
+    EXPECT_EQ(orch.register_callable(0xF00D), 1);  // Ids are dense
+
+    auto res = orch.submit_registered(id, single_tensor_args(0x9400, TensorArgType::OUTPUT));
+    TaskSlotState &s = S(res.task_slot);
+    EXPECT_EQ(s.callable, 0xBEEFu);
+    EXPECT_EQ(s.config.block_dim, 8);
+    EXPECT_TRUE(s.config.enable_profiling);
+}
+
+TEST_F(OrchestratorFixture, RegisteredCallableRejectsBadIds) {
+    EXPECT_THROW(orch.register_callable(0), std::invalid_argument);
+    EXPECT_THROW(
+        orch.submit_registered(0, single_tensor_args(0x9500, TensorArgType::OUTPUT)), std::out_of_range
+    );
+    int32_t id = orch.register_callable(0xBEEF);
+    EXPECT_THROW(
+        orch.submit_registered(id + 1, single_tensor_args(0x9500, TensorArgType::OUTPUT)), std::out_of_range
+    );
+}
+
+// ---------------------------------------------------------------------------
+// Partitioned-graph submit — partition map resolution and submit-side wiring.
+// Cross-partition transfer execution needs real ChipWorkers (device malloc +
+// d2d copies), so the replica path is covered by the scene tests; here we
+// exercise the map, the worker pin, and the no-transfer edges.
+// ---------------------------------------------------------------------------
+
+namespace {
+struct NoopWorker : public IWorker {
+    void run(uint64_t, TaskArgsView, const ChipCallConfig &) override {}
+};
+}  // namespace
+
+TEST(WorkerManagerPartitionMap, MapsPartitionsToWorkers) {
+    WorkerManager m;
+    NoopWorker a, b;
+    m.add_next_level(&a);
+    m.add_next_level(&b);
+    m.set_partition_map({1, 0, -1});
+    EXPECT_EQ(m.partition_count(), 3);
+    EXPECT_EQ(m.partition_worker(0), 1);
+    EXPECT_EQ(m.partition_worker(1), 0);
+    EXPECT_EQ(m.partition_worker(2), -1);  // explicitly unmapped
+    EXPECT_EQ(m.partition_worker(3), -1);  // out of range
+    EXPECT_EQ(m.partition_worker(-1), -1);
+    // Map entries must reference registered NEXT_LEVEL workers.
+    EXPECT_THROW(m.set_partition_map({2}), std::invalid_argument);
+}
+
+struct PartitionedFixture : public OrchestratorFixture {
+    WorkerManager manager;
+    NoopWorker w0, w1;
+
+    void SetUp() override {
+        allocator.init(/*heap_bytes=*/1ULL << 20);
+        manager.add_next_level(&w0);
+        manager.add_next_level(&w1);
+        manager.set_partition_map({0, 1});
+        orch.init(&tm, &allocator, &scope, &rq_next_level, &rq_sub, &manager);
+    }
+};
+
+TEST_F(PartitionedFixture, SubmitPartitionedPinsMappedWorker) {
+    auto res = orch.submit_partitioned(0xDEAD, single_tensor_args(0xA100, TensorArgType::OUTPUT), cfg, 1);
+    TaskSlotState &s = S(res.task_slot);
+    ASSERT_EQ(s.affinities.size(), 1u);
+    EXPECT_EQ(s.affinities[0], 1);
+    TaskSlot slot;
+    EXPECT_TRUE(rq.try_pop(slot));
+    EXPECT_EQ(slot, res.task_slot);
+}
+
+TEST_F(PartitionedFixture, SubmitPartitionedRejectsUnmappedPartition) {
+    EXPECT_THROW(
+        orch.submit_partitioned(0xDEAD, single_tensor_args(0xA200, TensorArgType::OUTPUT), cfg, 7),
+        std::invalid_argument
+    );
+}
+
+TEST_F(PartitionedFixture, HostTensorEdgesCrossPartitionsWithoutTransfers) {
+    // Host-memory tensors are globally addressable: a cross-partition
+    // consumer wires straight onto the producer, no transfer spliced.
+    auto prod = orch.submit_partitioned(0xDEAD, single_tensor_args(0xA300, TensorArgType::OUTPUT), cfg, 0);
+    TaskSlot drain_slot;
+    rq.try_pop(drain_slot);
+
+    auto cons = orch.submit_partitioned(0xDEAD, single_tensor_args(0xA300, TensorArgType::INPUT), cfg, 1);
+    TaskSlotState &cs = S(cons.task_slot);
+    EXPECT_EQ(cs.state.load(), TaskState::PENDING);
+    EXPECT_EQ(cs.fanin_count, 1);
+    ASSERT_EQ(cs.fanin_producers.size(), 1u);
+    EXPECT_EQ(cs.fanin_producers[0], prod.task_slot);
+    EXPECT_FALSE(cs.transfer);
+}
+
+TEST_F(PartitionedFixture, SamePartitionChildMemoryEdgeNeedsNoTransfer) {
+    TaskArgs out = single_tensor_args(0xA400, TensorArgType::OUTPUT);
+    out.tensor(0).child_memory = 1;
+    auto prod = orch.submit_partitioned(0xDEAD, out, cfg, 0);
+    TaskSlot drain_slot;
+    rq.try_pop(drain_slot);
+    EXPECT_EQ(tm.lookup(TensorKey{0xA400, 0}), prod.task_slot);
+
+    TaskArgs in = single_tensor_args(0xA400, TensorArgType::INPUT);
+    in.tensor(0).child_memory = 1;
+    auto cons = orch.submit_partitioned(0xDEAD, in, cfg, 0);
+    TaskSlotState &cs = S(cons.task_slot);
+    EXPECT_EQ(cs.fanin_count, 1);
+    ASSERT_EQ(cs.fanin_producers.size(), 1u);
+    EXPECT_EQ(cs.fanin_producers[0], prod.task_slot);
+    // The consumer reads the producer's buffer in place — same worker.
+    EXPECT_EQ(cs.task_args.tensor(0).data, 0xA400u);
+}
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Varint delta codec: phase-marker roundtrip, count clamping, and the
+// worst-case size bound the AICPU commit path relies on.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+
+#include "common/perf_profiling.h"
+
+// unified_log backend (normally provided by the platform library)
+extern "C" {
+void unified_log_error(const char *, const char *, ...) {}
+void unified_log_warn(const char *, const char *, ...) {}
+void unified_log_info(const char *, const char *, ...) {}
+void unified_log_debug(const char *, const char *, ...) {}
+void unified_log_always(const char *, const char *, ...) {}
+}
+
+namespace {
+
+PerfRecord make_record(uint64_t start, uint64_t duration) {
+    PerfRecord rec;
+    memset(&rec, 0, sizeof(rec));
+    rec.start_time = start;
+    rec.end_time = start + duration;
+    rec.dispatch_time = start - 50;
+    rec.finish_time = rec.end_time + 50;
+    rec.task_id = 42;
+    rec.func_id = 7;
+    rec.core_type = CoreType::AIV;
+    return rec;
+}
+
+TEST(PerfPhaseCodec, RoundtripsMarkers) {
+    PerfRecord rec = make_record(100000, 4000);
+    rec.phase_count = 3;
+    rec.phase_markers[0] = perf_phase_marker_pack(1, 100500);   // after start
+    rec.phase_markers[1] = perf_phase_marker_pack(2, 102000);
+    rec.phase_markers[2] = perf_phase_marker_pack(255, 99900);  // before start: negative delta
+
+    uint8_t buf[PERF_RECORD_ENCODED_MAX];
+    PerfDeltaBase enc_base{};
+    uint32_t n = perf_record_encode(buf, &rec, &enc_base);
+    ASSERT_GT(n, 0u);
+
+    PerfRecord out;
+    memset(&out, 0xAA, sizeof(out));
+    PerfDeltaBase dec_base{};
+    ASSERT_EQ(perf_record_decode(buf, buf + n, &out, &dec_base), n);
+
+    EXPECT_EQ(out.phase_count, 3);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(out.phase_markers[i], rec.phase_markers[i]) << "marker " << i;
+    }
+    EXPECT_EQ(perf_phase_marker_id(out.phase_markers[2]), 255);
+    EXPECT_EQ(perf_phase_marker_time(out.phase_markers[2]), 99900u);
+}
+
+TEST(PerfPhaseCodec, EmptyPhaseListCostsOneByte) {
+    PerfRecord rec = make_record(1000, 100);
+    uint8_t with[PERF_RECORD_ENCODED_MAX];
+    uint8_t without[PERF_RECORD_ENCODED_MAX];
+    PerfDeltaBase base{};
+    uint32_t n0 = perf_record_encode(without, &rec, &base);
+
+    rec.phase_count = 1;
+    rec.phase_markers[0] = perf_phase_marker_pack(3, 1010);
+    base = PerfDeltaBase{};
+    uint32_t n1 = perf_record_encode(with, &rec, &base);
+
+    // Zero markers encode as a single count byte; one marker adds id + delta.
+    EXPECT_GT(n1, n0);
+    PerfRecord out;
+    PerfDeltaBase dec_base{};
+    ASSERT_EQ(perf_record_decode(without, without + n0, &out, &dec_base), n0);
+    EXPECT_EQ(out.phase_count, 0);
+}
+
+TEST(PerfPhaseCodec, ClampsOutOfRangeCountOnEncode) {
+    PerfRecord rec = make_record(5000, 100);
+    rec.phase_count = static_cast<int32_t>(PERF_PHASE_MARKER_SLOTS) + 17;
+    for (uint32_t i = 0; i < PERF_PHASE_MARKER_SLOTS; i++) {
+        rec.phase_markers[i] = perf_phase_marker_pack(static_cast<uint8_t>(i), 5000 + i);
+    }
+
+    uint8_t buf[PERF_RECORD_ENCODED_MAX];
+    PerfDeltaBase base{};
+    uint32_t n = perf_record_encode(buf, &rec, &base);
+
+    PerfRecord out;
+    PerfDeltaBase dec_base{};
+    ASSERT_EQ(perf_record_decode(buf, buf + n, &out, &dec_base), n);
+    EXPECT_EQ(out.phase_count, static_cast<int32_t>(PERF_PHASE_MARKER_SLOTS));
+}
+
+TEST(PerfPhaseCodec, WorstCaseFitsEncodedMax) {
+    PerfRecord rec;
+    memset(&rec, 0xFF, sizeof(rec));
+    rec.core_type = CoreType::AIC;
+    rec.fanout_count = RUNTIME_MAX_FANOUT;
+    rec.phase_count = static_cast<int32_t>(PERF_PHASE_MARKER_SLOTS);
+
+    uint8_t buf[PERF_RECORD_ENCODED_MAX + 64];
+    PerfDeltaBase base{};
+    uint32_t n = perf_record_encode(buf, &rec, &base);
+    EXPECT_LE(n, PERF_RECORD_ENCODED_MAX);
+}
+
+}  // namespace
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Columnar perf query: stream load into SoA columns, filter, groupby,
+// percentile, and corrupt-entry rejection.
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "common/perf_profiling.h"
+#include "host/mmap_record_writer.h"
+#include "host/perf_query.h"
+
+// unified_log backend (normally provided by the platform library)
+extern "C" {
+void unified_log_error(const char *, const char *, ...) {}
+void unified_log_warn(const char *, const char *, ...) {}
+void unified_log_info(const char *, const char *, ...) {}
+void unified_log_debug(const char *, const char *, ...) {}
+void unified_log_always(const char *, const char *, ...) {}
+}
+
+namespace {
+
+class PerfQueryTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = ::testing::TempDir() + "perf_query_" + std::to_string(getpid()) + "_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin";
+    }
+
+    void TearDown() override { unlink(path_.c_str()); }
+
+    static PerfRecord make_record(uint64_t task_id, uint32_t func_id, CoreType core_type, uint64_t start,
+                                  uint64_t duration) {
+        PerfRecord rec;
+        memset(&rec, 0, sizeof(rec));
+        rec.task_id = task_id;
+        rec.func_id = func_id;
+        rec.core_type = core_type;
+        rec.start_time = start;
+        rec.end_time = start + duration;
+        rec.duration = duration;
+        rec.dispatch_time = start - 10;
+        rec.finish_time = rec.end_time + 10;
+        rec.fanout_count = static_cast<int32_t>(task_id % 3);
+        return rec;
+    }
+
+    // Two cores: core 0 runs func 1 (durations 100, 200, 300),
+    // core 1 runs func 2 (durations 1000, 2000)
+    void write_sample_run() {
+        MmapRecordWriter writer;
+        ASSERT_EQ(writer.open(path_, 1 << 20), 0);
+
+        std::vector<PerfRecord> core0;
+        core0.push_back(make_record(10, 1, CoreType::AIC, 1000, 100));
+        core0.push_back(make_record(11, 1, CoreType::AIC, 2000, 200));
+        core0.push_back(make_record(12, 1, CoreType::AIC, 3000, 300));
+        ASSERT_EQ(writer.append(0, core0.data(), core0.size() * sizeof(PerfRecord)), 0);
+
+        std::vector<PerfRecord> core1;
+        core1.push_back(make_record(20, 2, CoreType::AIV, 1500, 1000));
+        core1.push_back(make_record(21, 2, CoreType::AIV, 2500, 2000));
+        ASSERT_EQ(writer.append(1, core1.data(), core1.size() * sizeof(PerfRecord)), 0);
+
+        ASSERT_EQ(writer.finalize(), 0);
+    }
+
+    std::string path_;
+};
+
+TEST_F(PerfQueryTest, LoadBuildsColumnsInAppendOrder) {
+    write_sample_run();
+
+    PerfRunData run;
+    ASSERT_EQ(run.load(path_), 0);
+    ASSERT_EQ(run.size(), 5u);
+
+    EXPECT_EQ(run.task_id()[0], 10u);
+    EXPECT_EQ(run.task_id()[4], 21u);
+    EXPECT_EQ(run.core_id()[0], 0u);
+    EXPECT_EQ(run.core_id()[3], 1u);
+    EXPECT_EQ(run.func_id()[3], 2u);
+    EXPECT_EQ(run.core_type()[3], static_cast<uint8_t>(CoreType::AIV));
+    EXPECT_EQ(run.duration()[2], 300u);
+    EXPECT_EQ(run.fanout_count()[0], static_cast<int32_t>(10 % 3));
+}
+
+TEST_F(PerfQueryTest, FilterAppliesAllPredicatesAndSortsByStartTime) {
+    write_sample_run();
+
+    PerfRunData run;
+    ASSERT_EQ(run.load(path_), 0);
+
+    // Core filter
+    std::vector<uint64_t> rows = run.filter_indices(-1, 1, -1, 0, 0);
+    ASSERT_EQ(rows.size(), 2u);
+    EXPECT_EQ(run.task_id()[rows[0]], 20u);
+
+    // Time-window filter spans both cores and is start_time ordered
+    rows = run.filter_indices(-1, -1, -1, 1500, 3500);
+    ASSERT_EQ(rows.size(), 3u);
+    EXPECT_EQ(run.start_time()[rows[0]], 1500u);
+    EXPECT_EQ(run.start_time()[rows[1]], 2000u);
+    EXPECT_EQ(run.start_time()[rows[2]], 3000u);
+
+    // func + core_type combined
+    rows = run.filter_indices(1, -1, static_cast<int64_t>(CoreType::AIC), 0, 0);
+    EXPECT_EQ(rows.size(), 3u);
+}
+
+TEST_F(PerfQueryTest, GroupByFuncSortsByTotalDurationDescending) {
+    write_sample_run();
+
+    PerfRunData run;
+    ASSERT_EQ(run.load(path_), 0);
+
+    std::vector<PerfGroupStats> groups = run.group_by_func();
+    ASSERT_EQ(groups.size(), 2u);
+    EXPECT_EQ(groups[0].key, 2u);  // 3000 total beats 600
+    EXPECT_EQ(groups[0].count, 2u);
+    EXPECT_EQ(groups[0].total_duration, 3000u);
+    EXPECT_EQ(groups[0].min_duration, 1000u);
+    EXPECT_EQ(groups[0].max_duration, 2000u);
+    EXPECT_EQ(groups[1].key, 1u);
+    EXPECT_EQ(groups[1].total_duration, 600u);
+}
+
+TEST_F(PerfQueryTest, PercentileOverAllRowsAndOverSelection) {
+    write_sample_run();
+
+    PerfRunData run;
+    ASSERT_EQ(run.load(path_), 0);
+
+    EXPECT_EQ(run.duration_percentile(0.0), 100u);
+    EXPECT_EQ(run.duration_percentile(50.0), 300u);
+    EXPECT_EQ(run.duration_percentile(100.0), 2000u);
+
+    std::vector<uint64_t> rows = run.filter_indices(1, -1, -1, 0, 0);
+    EXPECT_EQ(run.duration_percentile(100.0, rows), 300u);
+}
+
+TEST_F(PerfQueryTest, RejectsEntriesThatAreNotWholeRecords) {
+    MmapRecordWriter writer;
+    ASSERT_EQ(writer.open(path_, 1 << 20), 0);
+    uint8_t garbage[100] = {};
+    ASSERT_EQ(writer.append(0, garbage, sizeof(garbage)), 0);
+    ASSERT_EQ(writer.finalize(), 0);
+
+    PerfRunData run;
+    EXPECT_EQ(run.load(path_), -1);
+    EXPECT_EQ(run.size(), 0u);
+}
+
+}  // namespace
@@ -11,6 +11,7 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
 #include <chrono>
 #include <thread>
 #include <vector>
@@ -210,6 +211,47 @@ TEST(Ring, ShutdownUnblocksAlloc) {
     t.join();
 }
 
+TEST(Ring, ConcurrentAllocSameRingNoOverlap) {
+    // Hammers the lock-free reserve path: several threads alloc/release on
+    // the SAME ring. Each thread stamps its slab and re-reads the pattern —
+    // an overlapping reservation (or a tail advanced past a live span)
+    // corrupts the stamp.
+    Ring a;
+    a.init(64 * HEAP_ALIGN, /*timeout_ms=*/5000);
+
+    constexpr int kThreads = 4;
+    constexpr int kItersPerThread = 2000;
+    std::atomic<bool> failed{false};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < kItersPerThread && !failed.load(); ++i) {
+                auto r = a.alloc(HEAP_ALIGN);
+                if (r.slot == INVALID_SLOT || r.heap_ptr == nullptr) {
+                    failed.store(true);
+                    return;
+                }
+                auto *p = static_cast<uint64_t *>(r.heap_ptr);
+                uint64_t stamp = (uint64_t(t) << 48) | (uint64_t(r.slot) << 16) | uint64_t(i);
+                for (int w = 0; w < 8; ++w) p[w] = stamp;
+                for (int w = 0; w < 8; ++w) {
+                    if (p[w] != stamp) {
+                        failed.store(true);
+                        return;
+                    }
+                }
+                a.release(r.slot);
+            }
+        });
+    }
+    for (auto &th : threads) th.join();
+
+    EXPECT_FALSE(failed.load());
+    EXPECT_EQ(a.active_count(), 0);
+    EXPECT_EQ(a.next_task_id(), kThreads * kItersPerThread);
+}
+
 // ---------------------------------------------------------------------------
 // Per-scope ring tests (Strict-1)
 // ---------------------------------------------------------------------------
@@ -382,3 +424,151 @@ TEST(Ring, NewSlotStatesCarryRingMetadata) {
     a.release(r2.slot);
     a.release(r3.slot);
 }
+
+TEST(Ring, CustomRingPolicyOverridesScopeMapping) {
+    Ring a;
+    a.init(kSmallHeap, kQuickTimeoutMs);
+    a.set_ring_policy([](int32_t /*scope_depth*/, uint64_t /*aligned_bytes*/) {
+        return 2;
+    });
+
+    // Scope depth 0 would map to ring 0; the policy pins everything to ring 2.
+    auto r = a.alloc(100, /*scope_depth=*/0);
+    EXPECT_EQ(r.ring_idx, 2);
+    EXPECT_EQ(a.slot_state(r.slot)->ring_idx, 2);
+    EXPECT_GT(a.heap_in_use(2), 0u);
+    EXPECT_EQ(a.heap_in_use(0), 0u);
+
+    // Clearing the policy restores the scope-depth mapping.
+    a.set_ring_policy({});
+    auto r2 = a.alloc(100, /*scope_depth=*/0);
+    EXPECT_EQ(r2.ring_idx, 0);
+
+    a.release(r.slot);
+    a.release(r2.slot);
+}
+
+TEST(Ring, PolicyReturningBadIndexThrows) {
+    Ring a;
+    a.init(kSmallHeap, kQuickTimeoutMs);
+    a.set_ring_policy([](int32_t, uint64_t) {
+        return MAX_RING_DEPTH;
+    });
+    EXPECT_THROW(a.alloc(100), std::runtime_error);
+}
+
+TEST(Ring, BalancedPolicySpreadsAcrossRings) {
+    Ring a;
+    a.init(kSmallHeap, kQuickTimeoutMs);
+    a.set_ring_policy(Ring::balanced_policy(&a));
+
+    // With every ring empty, occupancy balancing lands one span per ring
+    // before doubling up anywhere.
+    std::vector<AllocResult> spans;
+    int per_ring[MAX_RING_DEPTH] = {0};
+    for (int i = 0; i < 2 * MAX_RING_DEPTH; i++) {
+        spans.push_back(a.alloc(HEAP_ALIGN));
+        per_ring[spans.back().ring_idx]++;
+    }
+    for (int i = 0; i < MAX_RING_DEPTH; i++) {
+        EXPECT_EQ(per_ring[i], 2) << "ring " << i;
+    }
+
+    for (const auto &s : spans)
+        a.release(s.slot);
+}
+
+TEST(Ring, BalancedPolicyAvoidsFullRing) {
+    // Each ring holds 2 spans. Fill ring 0 via an explicit policy, then
+    // switch to the balancer: new spans must route around the full ring
+    // instead of blocking on its back-pressure wait.
+    Ring a;
+    a.init(2 * HEAP_ALIGN, /*timeout_ms=*/100);
+    a.set_ring_policy([](int32_t, uint64_t) {
+        return 0;
+    });
+    auto f0 = a.alloc(HEAP_ALIGN);
+    auto f1 = a.alloc(HEAP_ALIGN);  // ring 0 full
+
+    a.set_ring_policy(Ring::balanced_policy(&a));
+    std::vector<AllocResult> spans;
+    for (int i = 0; i < 2 * (MAX_RING_DEPTH - 1); i++) {
+        spans.push_back(a.alloc(HEAP_ALIGN));
+        EXPECT_NE(spans.back().ring_idx, 0);
+    }
+
+    a.release(f0.slot);
+    a.release(f1.slot);
+    for (const auto &s : spans)
+        a.release(s.slot);
+}
+
+TEST(Ring, ScopeReserveGuaranteesCoveredAllocs) {
+    // Reserve half of a 4-slab ring, then let an uncovered competitor claim
+    // the rest: the reserved allocs must still succeed immediately because
+    // they draw the parked credit, while a further uncovered alloc sees the
+    // ring as fully claimed and times out.
+    Ring a;
+    a.init(4 * HEAP_ALIGN, /*timeout_ms=*/100);
+
+    a.scope_reserve(/*scope_depth=*/0, /*task_slots=*/2, 2 * HEAP_ALIGN);
+    EXPECT_EQ(a.reserved_bytes(0), 2 * HEAP_ALIGN);
+
+    auto u0 = a.alloc(HEAP_ALIGN, 1);  // ring 1 — unrelated ring is unaffected
+    EXPECT_EQ(u0.ring_idx, 1);
+
+    // The first two ring-0 allocs draw down the parked credit; the next two
+    // take the remaining free slabs through the normal check.
+    auto c0 = a.alloc(HEAP_ALIGN, 0);
+    auto c1 = a.alloc(HEAP_ALIGN, 0);
+    EXPECT_EQ(a.reserved_bytes(0), 0u);  // fully drawn
+    auto c2 = a.alloc(HEAP_ALIGN, 0);
+    auto c3 = a.alloc(HEAP_ALIGN, 0);
+    EXPECT_THROW(a.alloc(HEAP_ALIGN, 0), std::runtime_error);  // truly full now
+
+    EXPECT_EQ(a.scope_unreserve(0), 0u);  // nothing left to hand back
+    for (TaskSlot s : {u0.slot, c0.slot, c1.slot, c2.slot, c3.slot})
+        a.release(s);
+}
+
+TEST(Ring, ScopeReserveWaitsForSpaceAndReturnsLeftover) {
+    // scope_reserve pays the back-pressure wait up front: with 3 of 4 slabs
+    // live, reserving 2 blocks until a release makes room. An untouched
+    // reservation comes back in full from scope_unreserve.
+    Ring a;
+    a.init(4 * HEAP_ALIGN, /*timeout_ms=*/5000);
+
+    auto r0 = a.alloc(HEAP_ALIGN, 0);
+    auto r1 = a.alloc(HEAP_ALIGN, 0);
+    auto r2 = a.alloc(HEAP_ALIGN, 0);
+
+    std::atomic<bool> reserved{false};
+    std::thread t([&] {
+        a.scope_reserve(0, /*task_slots=*/2, 2 * HEAP_ALIGN);  // 3 + 2 > 4: waits
+        reserved.store(true);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_FALSE(reserved.load());
+    a.release(r0.slot);  // FIFO head — tail advances, 2 + 2 fits
+    t.join();
+    EXPECT_TRUE(reserved.load());
+    EXPECT_EQ(a.reserved_bytes(0), 2 * HEAP_ALIGN);
+
+    EXPECT_EQ(a.scope_unreserve(0), 2 * HEAP_ALIGN);  // nothing drawn — full refund
+    a.release(r1.slot);
+    a.release(r2.slot);
+    a.shutdown();
+}
+
+TEST(Ring, DoubleScopeReserveSameRingThrows) {
+    Ring a;
+    a.init(kSmallHeap, kQuickTimeoutMs);
+    a.scope_reserve(0, 1, HEAP_ALIGN);
+    EXPECT_THROW(a.scope_reserve(0, 1, HEAP_ALIGN), std::logic_error);
+    // A different ring is fine, and unreserving frees ring 0 for reuse.
+    a.scope_reserve(1, 1, HEAP_ALIGN);
+    EXPECT_EQ(a.scope_unreserve(0), HEAP_ALIGN);
+    a.scope_reserve(0, 1, HEAP_ALIGN);
+    (void)a.scope_unreserve(0);
+    (void)a.scope_unreserve(1);
+}
@@ -125,9 +125,15 @@ struct SchedulerFixture : public ::testing::Test {
         orch.init(&tm, &allocator, &scope, &rq_next_level, &rq_sub);
 
         manager.add_next_level(&mock_worker);
-        manager.start(&allocator, [this](TaskSlot slot) {
-            sched.worker_done(slot);
-        });
+        manager.start(
+            &allocator,
+            [this](TaskSlot slot) {
+                sched.worker_done(slot);
+            },
+            [this]() {
+                sched.completion_posted();
+            }
+        );
 
         Scheduler::Config c;
         c.ring = &allocator;
@@ -139,6 +145,9 @@ struct SchedulerFixture : public ::testing::Test {
             std::lock_guard<std::mutex> lk(consumed_mu);
             consumed_slots.push_back(s);
         };
+        c.on_completed_cb = [this](TaskSlot s) {
+            orch.on_completed(s);
+        };
         sched.start(c);
     }
 
@@ -204,6 +213,61 @@ TEST_F(SchedulerFixture, DependentTaskDispatchedAfterProducerCompletes) {
     (void)a;
 }
 
+TEST_F(SchedulerFixture, WaitWatermarkUnblocksBeforeLaterTasksFinish) {
+    // Two independent tasks on one worker: a watermark on the first must
+    // release as soon as it completes, while the second is still in flight —
+    // no drain() barrier.
+    auto a = orch.submit_next_level(0x1, single_tensor_args(0xA, TensorArgType::OUTPUT), cfg);
+    auto b = orch.submit_next_level(0x2, single_tensor_args(0xB, TensorArgType::OUTPUT), cfg);
+
+    std::atomic<bool> passed{false};
+    std::thread waiter([&] {
+        orch.wait_watermark(a.task_slot);
+        passed.store(true, std::memory_order_release);
+    });
+
+    mock_worker.wait_running();
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    EXPECT_FALSE(passed.load(std::memory_order_acquire));
+
+    mock_worker.complete();  // A finishes; B may start but stays incomplete
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+    while (!passed.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    EXPECT_TRUE(passed.load(std::memory_order_acquire));
+    waiter.join();
+
+    mock_worker.wait_running();
+    mock_worker.complete();
+    wait_consumed(b.task_slot);
+}
+
+TEST_F(SchedulerFixture, CompletionRingWrapsAcrossManyTasks) {
+    // More completions than one worker's SPSC completion ring holds
+    // (capacity 256) — the cursors must wrap without losing or duplicating
+    // a completion.
+    constexpr int kTasks = 300;
+    TaskSlot last = INVALID_SLOT;
+    for (int i = 0; i < kTasks; i++) {
+        auto res = orch.submit_next_level(
+            0x1000u + static_cast<uint64_t>(i),
+            single_tensor_args(0x90000u + static_cast<uint64_t>(i), TensorArgType::OUTPUT), cfg
+        );
+        last = res.task_slot;
+
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+        while (mock_worker.dispatched_count() < i + 1 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ASSERT_EQ(mock_worker.dispatched_count(), i + 1);
+        mock_worker.complete();
+    }
+    wait_consumed(last);
+    EXPECT_EQ(mock_worker.dispatched_count(), kTasks);
+}
+
 // ===========================================================================
 // Group task tests — fixture with 2 MockWorkers
 // ===========================================================================
@@ -233,9 +297,15 @@ struct GroupSchedulerFixture : public ::testing::Test {
 
         manager.add_next_level(&worker_a);
         manager.add_next_level(&worker_b);
-        manager.start(&allocator, [this](TaskSlot slot) {
-            sched.worker_done(slot);
-        });
+        manager.start(
+            &allocator,
+            [this](TaskSlot slot) {
+                sched.worker_done(slot);
+            },
+            [this]() {
+                sched.completion_posted();
+            }
+        );
 
         Scheduler::Config c;
         c.ring = &allocator;
@@ -344,9 +414,15 @@ struct MixedTypeSchedulerFixture : public ::testing::Test {
 
         manager.add_next_level(&next_level_worker);
         manager.add_sub(&sub_worker);
-        manager.start(&allocator, [this](TaskSlot slot) {
-            sched.worker_done(slot);
-        });
+        manager.start(
+            &allocator,
+            [this](TaskSlot slot) {
+                sched.worker_done(slot);
+            },
+            [this]() {
+                sched.completion_posted();
+            }
+        );
 
         Scheduler::Config c;
         c.ring = &allocator;
@@ -414,6 +490,72 @@ TEST_F(MixedTypeSchedulerFixture, SubTaskDispatchesWhileNextLevelPoolSaturated)
     wait_consumed(chip.task_slot);
 }
 
+// ===========================================================================
+// Load-aware placement (pick_for_dispatch): an unhinted consumer inherits
+// its producer's worker as a soft preference; the balancer overrides the
+// preference when that worker is markedly slower than the best idle one.
+// ===========================================================================
+
+TEST_F(GroupSchedulerFixture, ConsumerFollowsProducerWorker) {
+    // Producer pinned to worker 1 (worker_b); first-fit would send the
+    // unconstrained consumer to worker 0, but the locality hint keeps the
+    // chain on worker_b.
+    auto args_p = single_tensor_args(0xF00D, TensorArgType::OUTPUT);
+    auto p = orch.submit_next_level(0x11, args_p, cfg, /*worker=*/1);
+    worker_b.wait_running();
+
+    auto args_c = single_tensor_args(0xF00D, TensorArgType::INPUT);
+    auto c = orch.submit_next_level(0x22, args_c, cfg);
+    EXPECT_EQ(S(c.task_slot).state.load(), TaskState::PENDING);
+
+    worker_b.complete();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+    while (worker_b.dispatched_count() < 2 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_EQ(worker_b.dispatched_count(), 2);
+    EXPECT_EQ(worker_a.dispatched_count(), 0);
+    EXPECT_EQ(worker_b.dispatched[1].callable, 0x22u);
+
+    worker_b.complete();
+    wait_consumed(c.task_slot);
+    (void)p;
+}
+
+TEST_F(GroupSchedulerFixture, BalancerOverridesSlowPreferredWorker) {
+    // Warm worker_a with one quick task so it has duration history (a
+    // history-free candidate deliberately never overrides a hint).
+    auto args_w = single_tensor_args(0xAB0, TensorArgType::OUTPUT);
+    auto w = orch.submit_next_level(0x33, args_w, cfg, /*worker=*/0);
+    worker_a.wait_running();
+    worker_a.complete();
+    wait_consumed(w.task_slot);
+
+    // Producer pinned to worker_b, held long enough that worker_b's avg
+    // duration dwarfs worker_a's.
+    auto args_p = single_tensor_args(0xF00D, TensorArgType::OUTPUT);
+    auto p = orch.submit_next_level(0x44, args_p, cfg, /*worker=*/1);
+    worker_b.wait_running();
+
+    auto args_c = single_tensor_args(0xF00D, TensorArgType::INPUT);
+    auto c = orch.submit_next_level(0x55, args_c, cfg);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(80));
+    worker_b.complete();
+
+    // The consumer prefers worker_b (its producer's worker) but worker_b is
+    // now far slower than worker_a, so the balancer routes it to worker_a.
+    worker_a.wait_running();
+    EXPECT_EQ(worker_a.dispatched_count(), 2);
+    EXPECT_EQ(worker_a.dispatched[1].callable, 0x55u);
+    EXPECT_EQ(worker_b.dispatched_count(), 1);
+
+    worker_a.complete();
+    wait_consumed(c.task_slot);
+    (void)p;
+}
+
 TEST_F(GroupSchedulerFixture, GroupDependencyChain) {
     // Group A (2 workers) produces an OUTPUT at key 0xCAFE.
     // Task B reads INPUT at the same key — depends on group A.
@@ -443,3 +585,117 @@ TEST_F(GroupSchedulerFixture, GroupDependencyChain) {
     wait_consumed(b.task_slot);
     (void)a;  // suppress unused
 }
+
+// ---------------------------------------------------------------------------
+// Single-child pass-through fixture — mirrors Worker::init wiring: the
+// Orchestrator knows the manager and, after manager.start(), collapses
+// dispatch for the one-worker pool to a direct WorkerThread handoff.
+// ---------------------------------------------------------------------------
+
+struct PassThroughFixture : public ::testing::Test {
+    TensorMap tm;
+    Ring allocator;
+    Scope scope;
+    ReadyQueue rq_next_level;
+    ReadyQueue rq_sub;
+    Orchestrator orch;
+    MockWorker mock_worker;
+    WorkerManager manager;
+    Scheduler sched;
+    ChipCallConfig cfg;
+
+    std::vector<TaskSlot> consumed_slots;
+    std::mutex consumed_mu;
+
+    TaskSlotState &S(TaskSlot id) { return *allocator.slot_state(id); }
+
+    void SetUp() override {
+        allocator.init(/*heap_bytes=*/1ULL << 20);
+        orch.init(&tm, &allocator, &scope, &rq_next_level, &rq_sub, &manager);
+
+        manager.add_next_level(&mock_worker);
+        manager.start(
+            &allocator,
+            [this](TaskSlot slot) {
+                sched.worker_done(slot);
+            },
+            [this]() {
+                sched.completion_posted();
+            }
+        );
+        orch.init_direct_dispatch();
+
+        Scheduler::Config c;
+        c.ring = &allocator;
+        c.ready_next_level_queue = &rq_next_level;
+        c.ready_sub_queue = &rq_sub;
+        c.manager = &manager;
+        c.on_consumed_cb = [this](TaskSlot s) {
+            orch.on_consumed(s);
+            std::lock_guard<std::mutex> lk(consumed_mu);
+            consumed_slots.push_back(s);
+        };
+        c.on_completed_cb = [this](TaskSlot s) {
+            orch.on_completed(s);
+        };
+        sched.start(c);
+    }
+
+    void TearDown() override {
+        sched.stop();
+        manager.stop();
+        allocator.shutdown();
+    }
+
+    void wait_consumed(TaskSlot slot, int timeout_ms = 500) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+        while (std::chrono::steady_clock::now() < deadline) {
+            {
+                std::lock_guard<std::mutex> lk(consumed_mu);
+                for (TaskSlot s : consumed_slots)
+                    if (s == slot) return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        FAIL() << "Timed out waiting for slot " << slot << " to be consumed";
+    }
+};
+
+TEST_F(PassThroughFixture, SubmitBypassesReadyQueueForSingleWorker) {
+    auto a = orch.submit_next_level(0xAA, single_tensor_args(0xD100, TensorArgType::OUTPUT), cfg);
+    mock_worker.wait_running();
+
+    // Second independent task while the worker is busy: the pass-through
+    // queues it on the worker directly — the ready queue never sees it and
+    // the slot goes straight to RUNNING.
+    auto b = orch.submit_next_level(0xBB, single_tensor_args(0xD200, TensorArgType::OUTPUT), cfg);
+    EXPECT_EQ(S(b.task_slot).state.load(), TaskState::RUNNING);
+    TaskSlot q_slot;
+    EXPECT_FALSE(rq_next_level.try_pop(q_slot));
+
+    mock_worker.complete();  // A finishes; B runs next, FIFO
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+    while (mock_worker.dispatched_count() < 2 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ASSERT_GE(mock_worker.dispatched_count(), 2);
+    EXPECT_EQ(mock_worker.dispatched[1].callable, 0xBBu);
+
+    mock_worker.wait_running();
+    mock_worker.complete();
+    wait_consumed(a.task_slot);
+    wait_consumed(b.task_slot);
+}
+
+TEST_F(PassThroughFixture, PinnedAffinityStillUsesSchedulerPath) {
+    auto a = orch.submit_next_level(0xAA, single_tensor_args(0xD300, TensorArgType::OUTPUT), cfg);
+    mock_worker.wait_running();
+
+    // A pin to worker 1 is never direct-dispatch eligible; the task takes
+    // the ready-queue path and, with no such worker, stays there.
+    auto b = orch.submit_next_level(0xBB, single_tensor_args(0xD400, TensorArgType::OUTPUT), cfg, /*worker=*/1);
+    EXPECT_EQ(S(b.task_slot).state.load(), TaskState::READY);
+
+    mock_worker.complete();
+    wait_consumed(a.task_slot);
+}
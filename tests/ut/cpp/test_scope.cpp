@@ -72,6 +72,81 @@ TEST(Scope, NestedScopes) {
     EXPECT_EQ(outer_released[0], 1);
 }
 
+TEST(Scope, LargeScopeReleasesAllTasksInOrder) {
+    // Thousands of registrations force several arena-backed list growths
+    // (and more than one arena chunk); release order must stay FIFO.
+    Scope sc;
+    sc.scope_begin();
+    constexpr int32_t kTasks = 10000;
+    for (int32_t i = 0; i < kTasks; ++i)
+        sc.register_task(i);
+
+    std::vector<TaskSlot> released;
+    released.reserve(kTasks);
+    sc.scope_end([&](TaskSlot s) {
+        released.push_back(s);
+    });
+
+    ASSERT_EQ(released.size(), static_cast<size_t>(kTasks));
+    for (int32_t i = 0; i < kTasks; ++i)
+        EXPECT_EQ(released[static_cast<size_t>(i)], i);
+}
+
+TEST(Scope, ArenaRewindsAcrossRepeatedAndNestedScopes) {
+    // Repeated scopes reuse the rewound arena; an outer frame that keeps
+    // growing after an inner scope closed must survive the inner rewind.
+    Scope sc;
+    for (int round = 0; round < 50; ++round) {
+        sc.scope_begin();
+        for (int32_t i = 0; i < 100; ++i)
+            sc.register_task(i);
+
+        sc.scope_begin();
+        for (int32_t i = 1000; i < 1200; ++i)
+            sc.register_task(i);
+        std::vector<TaskSlot> inner;
+        sc.scope_end([&](TaskSlot s) {
+            inner.push_back(s);
+        });
+        ASSERT_EQ(inner.size(), 200u);
+        EXPECT_EQ(inner.front(), 1000);
+
+        for (int32_t i = 100; i < 300; ++i)
+            sc.register_task(i);
+
+        std::vector<TaskSlot> outer;
+        sc.scope_end([&](TaskSlot s) {
+            outer.push_back(s);
+        });
+        ASSERT_EQ(outer.size(), 300u);
+        for (int32_t i = 0; i < 300; ++i)
+            EXPECT_EQ(outer[static_cast<size_t>(i)], i);
+    }
+}
+
+TEST(Scope, PreallocatedFrameKeepsTasksInPlace) {
+    // scope_begin(reserve_tasks) carves the frame's task list up front, so
+    // registrations within the reservation never move the array — and the
+    // preallocation rewinds with the frame like any other arena block.
+    Scope sc;
+    for (int round = 0; round < 3; ++round) {
+        sc.scope_begin(/*reserve_tasks=*/256);
+        for (int32_t i = 0; i < 256; ++i)
+            sc.register_task(i);
+        // Spilling past the reservation still works via the doubling path.
+        for (int32_t i = 256; i < 300; ++i)
+            sc.register_task(i);
+
+        std::vector<TaskSlot> released;
+        sc.scope_end([&](TaskSlot s) {
+            released.push_back(s);
+        });
+        ASSERT_EQ(released.size(), 300u);
+        for (int32_t i = 0; i < 300; ++i)
+            EXPECT_EQ(released[static_cast<size_t>(i)], i);
+    }
+}
+
 TEST(Scope, EmptyScopeReleasesNothing) {
     Scope sc;
     sc.scope_begin();
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Step-graph runner bookkeeping: step/patch validation and per-iteration
+// patch application. Device-free — run() needs a set device, so execution
+// itself is covered by scene tests.
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+#include "chip_worker.h"
+#include "step_graph_runner.h"
+
+namespace {
+
+ContinuousTensor make_tensor(uint64_t data, uint32_t n) {
+    ContinuousTensor t{};
+    t.data = data;
+    t.shapes[0] = n;
+    t.ndims = 1;
+    t.dtype = DataType::FLOAT32;
+    return t;
+}
+
+TEST(StepGraphRunner, PatchRulesRewriteSchemasPerIteration) {
+    ChipWorker worker;
+    StepGraphRunner runner(&worker);
+
+    TaskArgs proto;
+    proto.add_tensor(make_tensor(0, 64), TensorArgType::INPUT);
+    proto.add_tensor(make_tensor(0, 64), TensorArgType::OUTPUT);
+    proto.add_scalar(0);
+    TaskArgsSchema schema(proto);
+
+    uint8_t callable[64] = {};
+    int32_t step = runner.add_step(callable, &schema, ChipCallConfig{});
+    EXPECT_EQ(step, 0);
+    EXPECT_EQ(runner.step_count(), 1);
+
+    runner.add_tensor_patch(step, 0, 0x10000, 256);  // Walks a batched input
+    runner.add_tensor_patch(step, 1, 0x20000, 0);    // Bind once
+    runner.add_scalar_patch(step, 0, 5, 1);          // Iteration counter
+
+    runner.patch_for_iteration(0);
+    EXPECT_EQ(schema.args().tensor(0).data, 0x10000u);
+    EXPECT_EQ(schema.args().tensor(1).data, 0x20000u);
+    EXPECT_EQ(schema.args().scalar(0), 5u);
+
+    runner.patch_for_iteration(3);
+    EXPECT_EQ(schema.args().tensor(0).data, 0x10000u + 3 * 256);
+    EXPECT_EQ(schema.args().tensor(1).data, 0x20000u);
+    EXPECT_EQ(schema.chip_storage().scalar(0), 8u);
+}
+
+TEST(StepGraphRunner, RejectsInvalidStepsAndIndices) {
+    ChipWorker worker;
+    StepGraphRunner runner(&worker);
+
+    TaskArgs proto;
+    proto.add_tensor(make_tensor(0, 8), TensorArgType::INPUT);
+    TaskArgsSchema schema(proto);
+
+    uint8_t callable[64] = {};
+    EXPECT_THROW(runner.add_step(nullptr, &schema, ChipCallConfig{}), std::invalid_argument);
+    EXPECT_THROW(runner.add_tensor_patch(0, 0, 0, 0), std::out_of_range);  // No steps yet
+
+    int32_t step = runner.add_step(callable, &schema, ChipCallConfig{});
+    EXPECT_THROW(runner.add_tensor_patch(step, 1, 0, 0), std::out_of_range);
+    EXPECT_THROW(runner.add_scalar_patch(step, 0, 0, 0), std::out_of_range);  // Schema has no scalars
+}
+
+TEST(StepGraphRunner, RunWithoutDeviceFailsWithoutExecutingSteps) {
+    ChipWorker worker;  // No device set
+    StepGraphRunner runner(&worker);
+
+    TaskArgs proto;
+    proto.add_tensor(make_tensor(0, 8), TensorArgType::INPUT);
+    TaskArgsSchema schema(proto);
+    uint8_t callable[64] = {};
+    runner.add_step(callable, &schema, ChipCallConfig{});
+
+    EXPECT_THROW(runner.run(4), std::runtime_error);
+}
+
+}  // namespace
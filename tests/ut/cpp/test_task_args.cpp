@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Typed scalar access on TaskArgsTpl: values bit-pun in/out of the inline
+// uint64_t slots on both the dynamic builder and the fixed L2 POD.
+
+#include <gtest/gtest.h>
+
+#include "task_args.h"
+
+namespace {
+
+TEST(TaskArgsTypedScalars, RoundTripThroughDynamicBuilder) {
+    TaskArgs a;
+    a.add_scalar_as(3.5f);
+    a.add_scalar_as(static_cast<int32_t>(-7));
+    a.add_scalar_as(static_cast<uint16_t>(0xBEEF));
+    a.add_scalar(42);  // Raw slots interleave freely with typed ones
+
+    ASSERT_EQ(a.scalar_count(), 4);
+    EXPECT_FLOAT_EQ(a.scalar_as<float>(0), 3.5f);
+    EXPECT_EQ(a.scalar_as<int32_t>(1), -7);
+    EXPECT_EQ(a.scalar_as<uint16_t>(2), 0xBEEF);
+    EXPECT_EQ(a.scalar(3), 42u);
+}
+
+TEST(TaskArgsTypedScalars, RoundTripThroughChipStoragePod) {
+    ChipStorageTaskArgs a;
+    a.add_scalar_as(-1.0);  // double fills the whole slot
+    a.add_scalar_as(static_cast<int64_t>(-123456789));
+
+    EXPECT_DOUBLE_EQ(a.scalar_as<double>(0), -1.0);
+    EXPECT_EQ(a.scalar_as<int64_t>(1), -123456789);
+}
+
+TEST(TaskArgsTypedScalars, NarrowValuesZeroExtendTheSlot) {
+    TaskArgs a;
+    a.add_scalar_as(static_cast<uint8_t>(0xFF));
+    // The unused high bytes of the slot are zeroed, so a raw read is the
+    // value itself — what device code reading the uint64_t expects.
+    EXPECT_EQ(a.scalar(0), 0xFFu);
+}
+
+TEST(TaskArgsTypedScalars, SurvivesTheWireFormat) {
+    TaskArgs a;
+    a.add_scalar_as(2.25f);
+
+    std::vector<uint8_t> blob(task_args_blob_size(a));
+    write_blob(blob.data(), a);
+    TaskArgsView view = read_blob(blob.data());
+
+    ChipStorageTaskArgs pod = view_to_chip_storage(view);
+    EXPECT_FLOAT_EQ(pod.scalar_as<float>(0), 2.25f);
+}
+
+}  // namespace
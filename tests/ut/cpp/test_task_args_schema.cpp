@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "task_args_schema.h"
+
+namespace {
+
+ContinuousTensor make_tensor(uint64_t data, uint32_t rows, uint32_t cols, DataType dtype) {
+    ContinuousTensor t{};
+    t.data = data;
+    t.shapes[0] = rows;
+    t.shapes[1] = cols;
+    t.ndims = 2;
+    t.dtype = dtype;
+    return t;
+}
+
+TaskArgs make_prototype() {
+    TaskArgs proto;
+    proto.add_tensor(make_tensor(0x1000, 8, 16, DataType::FLOAT16), TensorArgType::INPUT);
+    proto.add_tensor(make_tensor(0x2000, 8, 16, DataType::FLOAT32), TensorArgType::OUTPUT);
+    proto.add_scalar(7);
+    return proto;
+}
+
+TEST(TaskArgsSchema, CompileCapturesLayoutInBothMirrors) {
+    TaskArgsSchema schema(make_prototype());
+
+    EXPECT_EQ(schema.tensor_count(), 2);
+    EXPECT_EQ(schema.scalar_count(), 1);
+
+    EXPECT_EQ(schema.args().tensor(1).dtype, DataType::FLOAT32);
+    EXPECT_EQ(schema.args().tag(0), TensorArgType::INPUT);
+    EXPECT_EQ(schema.args().tag(1), TensorArgType::OUTPUT);
+    EXPECT_EQ(schema.args().scalar(0), 7u);
+
+    EXPECT_EQ(schema.chip_storage().tensor_count(), 2);
+    EXPECT_EQ(schema.chip_storage().tensor(0).shapes[1], 16u);
+    EXPECT_EQ(schema.chip_storage().scalar(0), 7u);
+}
+
+TEST(TaskArgsSchema, SetTensorDataOnlyTouchesThePointer) {
+    TaskArgsSchema schema(make_prototype());
+
+    schema.set_tensor_data(0, 0xA000);
+    schema.set_tensor_data(1, 0xB000);
+
+    EXPECT_EQ(schema.args().tensor(0).data, 0xA000u);
+    EXPECT_EQ(schema.chip_storage().tensor(0).data, 0xA000u);
+    EXPECT_EQ(schema.chip_storage().tensor(1).data, 0xB000u);
+
+    // Compiled layout is untouched
+    EXPECT_EQ(schema.args().tensor(0).dtype, DataType::FLOAT16);
+    EXPECT_EQ(schema.args().tensor(0).shapes[0], 8u);
+    EXPECT_EQ(schema.args().tag(1), TensorArgType::OUTPUT);
+}
+
+TEST(TaskArgsSchema, SetScalarUpdatesBothMirrors) {
+    TaskArgsSchema schema(make_prototype());
+
+    schema.set_scalar(0, 42);
+
+    EXPECT_EQ(schema.args().scalar(0), 42u);
+    EXPECT_EQ(schema.chip_storage().scalar(0), 42u);
+}
+
+TEST(TaskArgsSchema, OutOfRangeIndicesThrow) {
+    TaskArgsSchema schema(make_prototype());
+
+    EXPECT_THROW(schema.set_tensor_data(2, 0xC000), std::out_of_range);
+    EXPECT_THROW(schema.set_tensor_data(-1, 0xC000), std::out_of_range);
+    EXPECT_THROW(schema.set_scalar(1, 0), std::out_of_range);
+}
+
+}  // namespace
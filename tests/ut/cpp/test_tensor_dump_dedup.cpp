@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Content-hash payload deduplication (PTO2_DUMP_DEDUP): a repeat dump of
+// unchanged bytes at the same dump point skips the arena copy and ships a
+// dedup_ref record; changed bytes ship a full payload again.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "aicpu/tensor_dump_aicpu.h"
+
+// unified_log backend (normally provided by the platform library)
+extern "C" {
+void unified_log_error(const char *, const char *, ...) {}
+void unified_log_warn(const char *, const char *, ...) {}
+void unified_log_info(const char *, const char *, ...) {}
+void unified_log_debug(const char *, const char *, ...) {}
+void unified_log_always(const char *, const char *, ...) {}
+}
+
+namespace {
+
+constexpr uint64_t TEST_ARENA_SIZE = 1 << 20;
+constexpr uint32_t TEST_ELEMENTS = 16;
+
+// Single-thread dump SHM rebuilt per test so the dedup cache starts clean.
+class TensorDumpDedupTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        unsetenv("PTO2_DUMP_FILTER");
+        unsetenv("PTO2_DUMP_MAX_INFLIGHT");
+        setenv("PTO2_DUMP_DEDUP", "1", 1);
+        shm_ = aligned_alloc(64, calc_dump_data_size(1));
+        memset(shm_, 0, calc_dump_data_size(1));
+        arena_ = aligned_alloc(64, TEST_ARENA_SIZE);
+        for (uint32_t i = 0; i < TEST_ELEMENTS; i++) {
+            data_[i] = static_cast<float>(i);
+        }
+
+        DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+        state->arena_base = reinterpret_cast<uint64_t>(arena_);
+        state->arena_size = TEST_ARENA_SIZE;
+    }
+
+    void TearDown() override {
+        unsetenv("PTO2_DUMP_DEDUP");
+        set_platform_dump_base(0);
+        for (DumpMetaBuffer *buf : meta_bufs_) {
+            free(buf);
+        }
+        meta_bufs_.clear();
+        free(arena_);
+        free(shm_);
+    }
+
+    // Push num_buffers meta buffers into the free queue and initialize
+    void init_dump(int num_buffers) {
+        DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+        for (int b = 0; b < num_buffers; b++) {
+            DumpMetaBuffer *buf = static_cast<DumpMetaBuffer *>(aligned_alloc(64, sizeof(DumpMetaBuffer)));
+            buf->count = 0;
+            meta_bufs_.push_back(buf);
+            state->free_queue.buffer_ptrs[b % PLATFORM_DUMP_SLOT_COUNT] = reinterpret_cast<uint64_t>(buf);
+        }
+        state->free_queue.tail = static_cast<uint32_t>(num_buffers);
+        set_platform_dump_base(reinterpret_cast<uint64_t>(shm_));
+        dump_tensor_init(1);
+    }
+
+    // Contiguous 1-D FLOAT32 dump point at (func_id, arg_index) over data_
+    TensorDumpInfo make_info(uint32_t func_id, uint32_t arg_index) {
+        TensorDumpInfo info = {};
+        info.task_id = 0x42;
+        info.role = TensorDumpRole::OUTPUT;
+        info.stage = TensorDumpStage::AFTER_COMPLETION;
+        info.dtype = static_cast<uint8_t>(DataType::FLOAT32);
+        info.ndims = 1;
+        info.func_id = func_id;
+        info.arg_index = arg_index;
+        info.buffer_addr = reinterpret_cast<uint64_t>(data_);
+        info.shapes[0] = TEST_ELEMENTS;
+        info.raw_shapes[0] = TEST_ELEMENTS;
+        info.offsets[0] = 0;
+        return info;
+    }
+
+    const TensorDumpRecord &record(uint32_t idx) {
+        DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+        return reinterpret_cast<DumpMetaBuffer *>(state->current_buf_ptr)->records[idx];
+    }
+
+    void *shm_{nullptr};
+    void *arena_{nullptr};
+    std::vector<DumpMetaBuffer *> meta_bufs_;
+    float data_[TEST_ELEMENTS];
+};
+
+TEST_F(TensorDumpDedupTest, RepeatDumpSkipsPayloadCopy) {
+    init_dump(1);
+    DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+
+    ASSERT_EQ(dump_tensor_record(0, make_info(7, 0)), 0);
+    const TensorDumpRecord &first = record(0);
+    EXPECT_EQ(first.dedup_ref, 0u);
+    EXPECT_NE(first.content_hash, 0u);
+    EXPECT_EQ(first.payload_size, TEST_ELEMENTS * sizeof(float));
+    uint64_t offset_after_first = state->arena_write_offset;
+
+    // Same bytes again: record ships, payload does not
+    ASSERT_EQ(dump_tensor_record(0, make_info(7, 0)), 0);
+    const TensorDumpRecord &second = record(1);
+    EXPECT_EQ(second.dedup_ref, 1u);
+    EXPECT_EQ(second.content_hash, first.content_hash);
+    EXPECT_EQ(second.payload_size, 0u);
+    EXPECT_EQ(state->arena_write_offset, offset_after_first);
+}
+
+TEST_F(TensorDumpDedupTest, ChangedBytesShipFullPayload) {
+    init_dump(1);
+    DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+
+    ASSERT_EQ(dump_tensor_record(0, make_info(7, 0)), 0);
+    const TensorDumpRecord &first = record(0);
+
+    data_[3] = 99.0f;
+    ASSERT_EQ(dump_tensor_record(0, make_info(7, 0)), 0);
+    const TensorDumpRecord &second = record(1);
+    EXPECT_EQ(second.dedup_ref, 0u);
+    EXPECT_NE(second.content_hash, first.content_hash);
+    EXPECT_EQ(second.payload_size, TEST_ELEMENTS * sizeof(float));
+    EXPECT_EQ(state->arena_write_offset, 2 * TEST_ELEMENTS * sizeof(float));
+}
+
+TEST_F(TensorDumpDedupTest, DistinctDumpPointsUseSeparateCacheSlots) {
+    init_dump(1);
+
+    ASSERT_EQ(dump_tensor_record(0, make_info(7, 0)), 0);
+    ASSERT_EQ(dump_tensor_record(0, make_info(8, 1)), 0);
+    // Same bytes, but the first dump at each point is never a reference
+    EXPECT_EQ(record(1).dedup_ref, 0u);
+    EXPECT_EQ(record(1).content_hash, record(0).content_hash);
+
+    ASSERT_EQ(dump_tensor_record(0, make_info(7, 0)), 0);
+    ASSERT_EQ(dump_tensor_record(0, make_info(8, 1)), 0);
+    EXPECT_EQ(record(2).dedup_ref, 1u);
+    EXPECT_EQ(record(3).dedup_ref, 1u);
+}
+
+TEST_F(TensorDumpDedupTest, DisabledWithoutEnv) {
+    unsetenv("PTO2_DUMP_DEDUP");
+    init_dump(1);
+
+    ASSERT_EQ(dump_tensor_record(0, make_info(7, 0)), 0);
+    ASSERT_EQ(dump_tensor_record(0, make_info(7, 0)), 0);
+    EXPECT_EQ(record(0).content_hash, 0u);
+    EXPECT_EQ(record(1).dedup_ref, 0u);
+    EXPECT_EQ(record(1).payload_size, TEST_ELEMENTS * sizeof(float));
+}
+
+}  // namespace
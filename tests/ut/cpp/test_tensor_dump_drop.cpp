@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Never-block dump drop policy: when the host falls behind (free queue
+// empty or PTO2_DUMP_MAX_INFLIGHT full buffers already pending), the
+// device drops the oldest un-shipped records instead of spin-waiting,
+// and attributes every drop to its dump point in DumpDropStats.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "aicpu/tensor_dump_aicpu.h"
+
+// unified_log backend (normally provided by the platform library)
+extern "C" {
+void unified_log_error(const char *, const char *, ...) {}
+void unified_log_warn(const char *, const char *, ...) {}
+void unified_log_info(const char *, const char *, ...) {}
+void unified_log_debug(const char *, const char *, ...) {}
+void unified_log_always(const char *, const char *, ...) {}
+}
+
+namespace {
+
+constexpr uint64_t TEST_ARENA_SIZE = 1 << 20;
+
+// Single-thread dump SHM rebuilt per test so drop counters start clean.
+class TensorDumpDropTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        unsetenv("PTO2_DUMP_FILTER");
+        unsetenv("PTO2_DUMP_MAX_INFLIGHT");
+        shm_ = aligned_alloc(64, calc_dump_data_size(1));
+        memset(shm_, 0, calc_dump_data_size(1));
+        arena_ = aligned_alloc(64, TEST_ARENA_SIZE);
+
+        DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+        state->arena_base = reinterpret_cast<uint64_t>(arena_);
+        state->arena_size = TEST_ARENA_SIZE;
+    }
+
+    void TearDown() override {
+        unsetenv("PTO2_DUMP_MAX_INFLIGHT");
+        set_platform_dump_base(0);
+        for (DumpMetaBuffer *buf : meta_bufs_) {
+            free(buf);
+        }
+        meta_bufs_.clear();
+        free(arena_);
+        free(shm_);
+    }
+
+    // Push num_buffers meta buffers into the free queue and initialize
+    void init_dump(int num_buffers) {
+        DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+        for (int b = 0; b < num_buffers; b++) {
+            DumpMetaBuffer *buf = static_cast<DumpMetaBuffer *>(aligned_alloc(64, sizeof(DumpMetaBuffer)));
+            buf->count = 0;
+            meta_bufs_.push_back(buf);
+            state->free_queue.buffer_ptrs[b % PLATFORM_DUMP_SLOT_COUNT] = reinterpret_cast<uint64_t>(buf);
+        }
+        state->free_queue.tail = static_cast<uint32_t>(num_buffers);
+        set_platform_dump_base(reinterpret_cast<uint64_t>(shm_));
+        dump_tensor_init(1);
+    }
+
+    // Scalar FLOAT32 dump point at (func_id, arg_index)
+    TensorDumpInfo make_info(uint32_t func_id, uint32_t arg_index) {
+        TensorDumpInfo info = {};
+        info.task_id = 0x42;
+        info.role = TensorDumpRole::OUTPUT;
+        info.stage = TensorDumpStage::AFTER_COMPLETION;
+        info.dtype = static_cast<uint8_t>(DataType::FLOAT32);
+        info.ndims = 0;
+        info.func_id = func_id;
+        info.arg_index = arg_index;
+        info.buffer_addr = reinterpret_cast<uint64_t>(&value_);
+        return info;
+    }
+
+    uint32_t drops_for(uint32_t func_id, uint32_t arg_index) {
+        DumpDropStats *stats = get_dump_drop_stats(shm_, 1, 0);
+        for (int i = 0; i < PLATFORM_DUMP_DROP_STATS_ENTRIES; i++) {
+            if (stats->entries[i].dropped != 0 && stats->entries[i].func_id == func_id &&
+                stats->entries[i].arg_index == arg_index) {
+                return stats->entries[i].dropped;
+            }
+        }
+        return 0;
+    }
+
+    void *shm_{nullptr};
+    void *arena_{nullptr};
+    std::vector<DumpMetaBuffer *> meta_bufs_;
+    float value_{1.0f};
+};
+
+TEST_F(TensorDumpDropTest, DropsOldestRecordsWhenFreeQueueEmpty) {
+    init_dump(1);
+    DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+
+    // Fill the only buffer: 128 records for (7, 0), 128 for (8, 1)
+    for (int i = 0; i < 128; i++) {
+        ASSERT_EQ(dump_tensor_record(0, make_info(7, 0)), 0);
+    }
+    for (int i = 0; i < 128; i++) {
+        ASSERT_EQ(dump_tensor_record(0, make_info(8, 1)), 0);
+    }
+    EXPECT_EQ(state->dropped_record_count, 0u);
+
+    // Free queue is now empty — the next record must not block: the full
+    // buffer's records are dropped, the buffer is reused, and the new
+    // record still lands.
+    EXPECT_EQ(dump_tensor_record(0, make_info(7, 0)), 0);
+    EXPECT_EQ(state->dropped_record_count, 256u);
+    DumpMetaBuffer *buf = reinterpret_cast<DumpMetaBuffer *>(state->current_buf_ptr);
+    ASSERT_NE(buf, nullptr);
+    EXPECT_EQ(buf->count, 1u);
+
+    // Drops are attributed per dump point
+    EXPECT_EQ(drops_for(7, 0), 128u);
+    EXPECT_EQ(drops_for(8, 1), 128u);
+    EXPECT_EQ(get_dump_drop_stats(shm_, 1, 0)->overflow_dropped, 0u);
+}
+
+TEST_F(TensorDumpDropTest, InflightCapDropsInsteadOfEnqueue) {
+    setenv("PTO2_DUMP_MAX_INFLIGHT", "1", 1);
+    init_dump(3);
+    DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+    DumpDataHeader *header = get_dump_header(shm_);
+
+    // First buffer fills and is handed to the host (in-flight becomes 1)
+    for (int i = 0; i < 257; i++) {
+        ASSERT_EQ(dump_tensor_record(0, make_info(7, 0)), 0);
+    }
+    EXPECT_EQ(header->queue_tails[0], 1u);
+    EXPECT_EQ(state->dropped_record_count, 0u);
+
+    // Second buffer fills, but the cap is reached — drop and reuse even
+    // though the free queue still holds a spare buffer
+    for (int i = 0; i < 256; i++) {
+        ASSERT_EQ(dump_tensor_record(0, make_info(7, 0)), 0);
+    }
+    EXPECT_EQ(state->dropped_record_count, 256u);
+    EXPECT_EQ(header->queue_tails[0], 1u);
+    EXPECT_EQ(drops_for(7, 0), 256u);
+}
+
+TEST_F(TensorDumpDropTest, InvalidInflightEnvFallsBackToDefault) {
+    setenv("PTO2_DUMP_MAX_INFLIGHT", "0", 1);
+    init_dump(2);
+    DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+    DumpDataHeader *header = get_dump_header(shm_);
+
+    // Cap of 0 is rejected; the default still allows the hand-off
+    for (int i = 0; i < 257; i++) {
+        ASSERT_EQ(dump_tensor_record(0, make_info(7, 0)), 0);
+    }
+    EXPECT_EQ(header->queue_tails[0], 1u);
+    EXPECT_EQ(state->dropped_record_count, 0u);
+}
+
+}  // namespace
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// On-device tensor dump filters: PTO2_DUMP_FILTER parsing, dump-point
+// matching, and the filtered record/payload layout produced by
+// dump_tensor_record (row stride, bounding box, fp16 downcast, summary).
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "aicpu/tensor_dump_aicpu.h"
+
+// unified_log backend (normally provided by the platform library)
+extern "C" {
+void unified_log_error(const char *, const char *, ...) {}
+void unified_log_warn(const char *, const char *, ...) {}
+void unified_log_info(const char *, const char *, ...) {}
+void unified_log_debug(const char *, const char *, ...) {}
+void unified_log_always(const char *, const char *, ...) {}
+}
+
+namespace {
+
+constexpr uint64_t TEST_ARENA_SIZE = 1 << 20;
+
+// Minimal single-thread dump SHM: header + one buffer state + one meta
+// buffer in the free queue + a payload arena, all host-allocated.
+class TensorDumpFilterTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        unsetenv("PTO2_DUMP_FILTER");
+        shm_ = aligned_alloc(64, calc_dump_data_size(1));
+        memset(shm_, 0, calc_dump_data_size(1));
+        arena_ = aligned_alloc(64, TEST_ARENA_SIZE);
+        meta_buf_ = static_cast<DumpMetaBuffer *>(aligned_alloc(64, sizeof(DumpMetaBuffer)));
+        meta_buf_->count = 0;
+
+        DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+        state->arena_base = reinterpret_cast<uint64_t>(arena_);
+        state->arena_size = TEST_ARENA_SIZE;
+        state->arena_write_offset = 0;
+        state->free_queue.buffer_ptrs[0] = reinterpret_cast<uint64_t>(meta_buf_);
+        state->free_queue.tail = 1;
+
+        set_platform_dump_base(reinterpret_cast<uint64_t>(shm_));
+        dump_tensor_init(1);
+    }
+
+    static void TearDownTestSuite() {
+        dump_tensor_configure_filters(nullptr);
+        set_platform_dump_base(0);
+        free(meta_buf_);
+        free(arena_);
+        free(shm_);
+    }
+
+    void TearDown() override { dump_tensor_configure_filters(nullptr); }
+
+    // Contiguous 2-D FLOAT32 dump point (func_id 7, arg_index 0)
+    TensorDumpInfo make_info(uint32_t rows, uint32_t cols) {
+        TensorDumpInfo info = {};
+        info.task_id = 0x42;
+        info.role = TensorDumpRole::OUTPUT;
+        info.stage = TensorDumpStage::AFTER_COMPLETION;
+        info.dtype = static_cast<uint8_t>(DataType::FLOAT32);
+        info.ndims = 2;
+        info.func_id = 7;
+        info.arg_index = 0;
+        info.buffer_addr = reinterpret_cast<uint64_t>(data_.data());
+        info.shapes[0] = rows;
+        info.shapes[1] = cols;
+        info.raw_shapes[0] = rows;
+        info.raw_shapes[1] = cols;
+        return info;
+    }
+
+    // Record the tensor and return the appended record plus its arena payload
+    const TensorDumpRecord *record(const TensorDumpInfo &info, std::vector<uint8_t> *payload) {
+        EXPECT_EQ(dump_tensor_record(0, info), 0);
+        DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+        DumpMetaBuffer *buf = reinterpret_cast<DumpMetaBuffer *>(state->current_buf_ptr);
+        EXPECT_NE(buf, nullptr);
+        const TensorDumpRecord *rec = &buf->records[buf->count - 1];
+        payload->resize(rec->payload_size);
+        for (uint64_t i = 0; i < rec->payload_size; i++) {
+            (*payload)[i] = static_cast<uint8_t *>(arena_)[(rec->payload_offset + i) % TEST_ARENA_SIZE];
+        }
+        return rec;
+    }
+
+    static void *shm_;
+    static void *arena_;
+    static DumpMetaBuffer *meta_buf_;
+    std::vector<float> data_;
+};
+
+void *TensorDumpFilterTest::shm_ = nullptr;
+void *TensorDumpFilterTest::arena_ = nullptr;
+DumpMetaBuffer *TensorDumpFilterTest::meta_buf_ = nullptr;
+
+TEST_F(TensorDumpFilterTest, ParseAndMatch) {
+    EXPECT_EQ(dump_tensor_configure_filters("func:2,arg:0,mode:rows,stride:8;mode:summary"), 2);
+
+    const TensorDumpFilterSpec *spec = dump_tensor_match_filter(2, 0);
+    ASSERT_NE(spec, nullptr);
+    EXPECT_EQ(spec->mode, TensorDumpFilterMode::ROW_STRIDE);
+    EXPECT_EQ(spec->row_stride, 8u);
+
+    // Other dump points fall through to the wildcard summary entry
+    spec = dump_tensor_match_filter(2, 1);
+    ASSERT_NE(spec, nullptr);
+    EXPECT_EQ(spec->mode, TensorDumpFilterMode::SUMMARY);
+    spec = dump_tensor_match_filter(5, 0);
+    ASSERT_NE(spec, nullptr);
+    EXPECT_EQ(spec->mode, TensorDumpFilterMode::SUMMARY);
+}
+
+TEST_F(TensorDumpFilterTest, ParseRejectsInvalidSpec) {
+    EXPECT_EQ(dump_tensor_configure_filters("mode:bogus"), -1);
+    EXPECT_EQ(dump_tensor_match_filter(0, 0), nullptr);
+    EXPECT_EQ(dump_tensor_configure_filters("stride:0"), -1);
+    EXPECT_EQ(dump_tensor_configure_filters("func:1,nonsense"), -1);
+    EXPECT_EQ(dump_tensor_configure_filters(""), 0);
+}
+
+TEST_F(TensorDumpFilterTest, MatchPrefersMostSpecificEntry) {
+    EXPECT_EQ(dump_tensor_configure_filters("mode:summary;func:7,mode:box;func:7,arg:1,mode:rows,stride:2"), 3);
+    EXPECT_EQ(dump_tensor_match_filter(7, 1)->mode, TensorDumpFilterMode::ROW_STRIDE);
+    EXPECT_EQ(dump_tensor_match_filter(7, 0)->mode, TensorDumpFilterMode::BOUNDING_BOX);
+    EXPECT_EQ(dump_tensor_match_filter(9, 0)->mode, TensorDumpFilterMode::SUMMARY);
+}
+
+TEST_F(TensorDumpFilterTest, FullDumpWithoutFilter) {
+    data_ = {0.0f, 1.0f, 2.0f, 3.0f};
+    std::vector<uint8_t> payload;
+    const TensorDumpRecord *rec = record(make_info(2, 2), &payload);
+    EXPECT_EQ(rec->filter_mode, static_cast<uint8_t>(TensorDumpFilterMode::FULL));
+    EXPECT_EQ(rec->payload_dtype, rec->dtype);
+    EXPECT_EQ(rec->row_stride, 0u);
+    ASSERT_EQ(payload.size(), 4 * sizeof(float));
+    EXPECT_EQ(memcmp(payload.data(), data_.data(), payload.size()), 0);
+}
+
+TEST_F(TensorDumpFilterTest, RowStrideKeepsEveryNthRow) {
+    ASSERT_EQ(dump_tensor_configure_filters("func:7,mode:rows,stride:2"), 1);
+    data_.resize(16);
+    for (int i = 0; i < 16; i++) {
+        data_[i] = static_cast<float>(i);
+    }
+    std::vector<uint8_t> payload;
+    const TensorDumpRecord *rec = record(make_info(4, 4), &payload);
+    EXPECT_EQ(rec->filter_mode, static_cast<uint8_t>(TensorDumpFilterMode::ROW_STRIDE));
+    EXPECT_EQ(rec->row_stride, 2u);
+    EXPECT_EQ(rec->shapes[0], 2u);  // rows 0 and 2 of 4
+    EXPECT_EQ(rec->shapes[1], 4u);
+    ASSERT_EQ(payload.size(), 8 * sizeof(float));
+    const float *vals = reinterpret_cast<const float *>(payload.data());
+    const float expected[8] = {0, 1, 2, 3, 8, 9, 10, 11};
+    EXPECT_EQ(memcmp(vals, expected, sizeof(expected)), 0);
+}
+
+TEST_F(TensorDumpFilterTest, BoundingBoxFoldsWindowIntoOffsets) {
+    ASSERT_EQ(dump_tensor_configure_filters("func:7,mode:box,box:1-3/1-3"), 1);
+    data_.resize(16);
+    for (int i = 0; i < 16; i++) {
+        data_[i] = static_cast<float>(i);
+    }
+    std::vector<uint8_t> payload;
+    const TensorDumpRecord *rec = record(make_info(4, 4), &payload);
+    EXPECT_EQ(rec->filter_mode, static_cast<uint8_t>(TensorDumpFilterMode::BOUNDING_BOX));
+    EXPECT_EQ(rec->shapes[0], 2u);
+    EXPECT_EQ(rec->shapes[1], 2u);
+    EXPECT_EQ(rec->offsets[0], 1u);
+    EXPECT_EQ(rec->offsets[1], 1u);
+    ASSERT_EQ(payload.size(), 4 * sizeof(float));
+    const float *vals = reinterpret_cast<const float *>(payload.data());
+    const float expected[4] = {5, 6, 9, 10};
+    EXPECT_EQ(memcmp(vals, expected, sizeof(expected)), 0);
+}
+
+TEST_F(TensorDumpFilterTest, DowncastStoresFp16Bits) {
+    ASSERT_EQ(dump_tensor_configure_filters("func:7,cast:fp16"), 1);
+    data_ = {1.0f, -2.0f, 0.5f, 0.0f};
+    std::vector<uint8_t> payload;
+    const TensorDumpRecord *rec = record(make_info(2, 2), &payload);
+    EXPECT_EQ(rec->filter_mode, static_cast<uint8_t>(TensorDumpFilterMode::FULL));
+    EXPECT_EQ(rec->payload_dtype, static_cast<uint8_t>(DataType::FLOAT16));
+    ASSERT_EQ(payload.size(), 4 * sizeof(uint16_t));
+    const uint16_t *half = reinterpret_cast<const uint16_t *>(payload.data());
+    EXPECT_EQ(half[0], 0x3C00u);  // 1.0
+    EXPECT_EQ(half[1], 0xC000u);  // -2.0
+    EXPECT_EQ(half[2], 0x3800u);  // 0.5
+    EXPECT_EQ(half[3], 0x0000u);  // 0.0
+}
+
+TEST_F(TensorDumpFilterTest, SummaryComputesStatsAndCountsNan) {
+    ASSERT_EQ(dump_tensor_configure_filters("mode:summary"), 1);
+    data_ = {1.0f, -3.0f, 5.0f, std::nanf("")};
+    std::vector<uint8_t> payload;
+    const TensorDumpRecord *rec = record(make_info(2, 2), &payload);
+    EXPECT_EQ(rec->filter_mode, static_cast<uint8_t>(TensorDumpFilterMode::SUMMARY));
+    ASSERT_EQ(payload.size(), sizeof(TensorDumpSummary));
+    TensorDumpSummary summary;
+    memcpy(&summary, payload.data(), sizeof(summary));
+    EXPECT_FLOAT_EQ(summary.min_val, -3.0f);
+    EXPECT_FLOAT_EQ(summary.max_val, 5.0f);
+    EXPECT_FLOAT_EQ(summary.mean, 1.0f);
+    EXPECT_EQ(summary.nan_count, 1u);
+    EXPECT_EQ(summary.elements, 4u);
+}
+
+TEST_F(TensorDumpFilterTest, SummarySkipsNonContiguousGaps) {
+    ASSERT_EQ(dump_tensor_configure_filters("mode:summary"), 1);
+    // 2x2 view at offset (0, 2) of a 2x4 source: values 2, 3, 6, 7
+    data_.resize(8);
+    for (int i = 0; i < 8; i++) {
+        data_[i] = static_cast<float>(i);
+    }
+    TensorDumpInfo info = make_info(2, 2);
+    info.raw_shapes[1] = 4;
+    info.offsets[1] = 2;
+    std::vector<uint8_t> payload;
+    const TensorDumpRecord *rec = record(info, &payload);
+    ASSERT_EQ(payload.size(), sizeof(TensorDumpSummary));
+    TensorDumpSummary summary;
+    memcpy(&summary, payload.data(), sizeof(summary));
+    EXPECT_FLOAT_EQ(summary.min_val, 2.0f);
+    EXPECT_FLOAT_EQ(summary.max_val, 7.0f);
+    EXPECT_FLOAT_EQ(summary.mean, 4.5f);
+    EXPECT_EQ(summary.elements, 4u);
+    (void)rec;
+}
+
+}  // namespace
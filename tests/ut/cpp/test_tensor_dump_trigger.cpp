@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) PyPTO Contributors.
+ * This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+ * CANN Open Software License Agreement Version 2.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ * -----------------------------------------------------------------------------------------------------------
+ */
+
+// Watchpoint dump triggers: trig:nan / trig:absmax / trig:flag parsing and
+// device-side evaluation — untriggered dump points record nothing.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "aicpu/tensor_dump_aicpu.h"
+
+// unified_log backend (normally provided by the platform library)
+extern "C" {
+void unified_log_error(const char *, const char *, ...) {}
+void unified_log_warn(const char *, const char *, ...) {}
+void unified_log_info(const char *, const char *, ...) {}
+void unified_log_debug(const char *, const char *, ...) {}
+void unified_log_always(const char *, const char *, ...) {}
+}
+
+namespace {
+
+constexpr uint64_t TEST_ARENA_SIZE = 1 << 20;
+
+// Minimal single-thread dump SHM, same harness as test_tensor_dump_filter
+class TensorDumpTriggerTest : public ::testing::Test {
+protected:
+    static void SetUpTestSuite() {
+        unsetenv("PTO2_DUMP_FILTER");
+        shm_ = aligned_alloc(64, calc_dump_data_size(1));
+        memset(shm_, 0, calc_dump_data_size(1));
+        arena_ = aligned_alloc(64, TEST_ARENA_SIZE);
+        meta_buf_ = static_cast<DumpMetaBuffer *>(aligned_alloc(64, sizeof(DumpMetaBuffer)));
+        meta_buf_->count = 0;
+
+        DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+        state->arena_base = reinterpret_cast<uint64_t>(arena_);
+        state->arena_size = TEST_ARENA_SIZE;
+        state->arena_write_offset = 0;
+        state->free_queue.buffer_ptrs[0] = reinterpret_cast<uint64_t>(meta_buf_);
+        state->free_queue.tail = 1;
+
+        set_platform_dump_base(reinterpret_cast<uint64_t>(shm_));
+        dump_tensor_init(1);
+    }
+
+    static void TearDownTestSuite() {
+        dump_tensor_configure_filters(nullptr);
+        set_platform_dump_base(0);
+        free(meta_buf_);
+        free(arena_);
+        free(shm_);
+    }
+
+    void TearDown() override {
+        dump_tensor_configure_filters(nullptr);
+        get_dump_header(shm_)->user_trigger_flag = 0;
+    }
+
+    // Contiguous 2-D FLOAT32 dump point (func_id 7, arg_index 0)
+    TensorDumpInfo make_info(uint32_t rows, uint32_t cols) {
+        TensorDumpInfo info = {};
+        info.task_id = 0x42;
+        info.role = TensorDumpRole::OUTPUT;
+        info.stage = TensorDumpStage::AFTER_COMPLETION;
+        info.dtype = static_cast<uint8_t>(DataType::FLOAT32);
+        info.ndims = 2;
+        info.func_id = 7;
+        info.arg_index = 0;
+        info.buffer_addr = reinterpret_cast<uint64_t>(data_.data());
+        info.shapes[0] = rows;
+        info.shapes[1] = cols;
+        info.raw_shapes[0] = rows;
+        info.raw_shapes[1] = cols;
+        return info;
+    }
+
+    uint32_t record_count() {
+        DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+        return reinterpret_cast<DumpMetaBuffer *>(state->current_buf_ptr)->count;
+    }
+
+    static void *shm_;
+    static void *arena_;
+    static DumpMetaBuffer *meta_buf_;
+    std::vector<float> data_;
+};
+
+void *TensorDumpTriggerTest::shm_ = nullptr;
+void *TensorDumpTriggerTest::arena_ = nullptr;
+DumpMetaBuffer *TensorDumpTriggerTest::meta_buf_ = nullptr;
+
+TEST_F(TensorDumpTriggerTest, ParseTriggerKeys) {
+    EXPECT_EQ(dump_tensor_configure_filters("trig:nan;func:3,trig:absmax,bound:100.5;trig:flag"), 3);
+
+    const TensorDumpFilterSpec *spec = dump_tensor_match_filter(3, 0);
+    ASSERT_NE(spec, nullptr);
+    EXPECT_EQ(spec->trigger, TensorDumpTrigger::ABS_MAX);
+    EXPECT_FLOAT_EQ(spec->trigger_bound, 100.5f);
+
+    EXPECT_EQ(dump_tensor_configure_filters("trig:sometimes"), -1);
+    EXPECT_EQ(dump_tensor_configure_filters("trig:absmax,bound:-1"), -1);
+}
+
+TEST_F(TensorDumpTriggerTest, NanTriggerGatesTheDump) {
+    ASSERT_EQ(dump_tensor_configure_filters("func:7,trig:nan"), 1);
+
+    data_ = {1.0f, 2.0f, 3.0f, 4.0f};
+    uint32_t before = record_count();
+    EXPECT_EQ(dump_tensor_record(0, make_info(2, 2)), 0);
+    EXPECT_EQ(record_count(), before);  // Clean tensor: nothing recorded
+
+    data_[2] = std::nanf("");
+    EXPECT_EQ(dump_tensor_record(0, make_info(2, 2)), 0);
+    EXPECT_EQ(record_count(), before + 1);
+}
+
+TEST_F(TensorDumpTriggerTest, NanTriggerAlsoFiresOnInf) {
+    ASSERT_EQ(dump_tensor_configure_filters("func:7,trig:nan"), 1);
+
+    data_ = {1.0f, -std::numeric_limits<float>::infinity(), 3.0f, 4.0f};
+    uint32_t before = record_count();
+    EXPECT_EQ(dump_tensor_record(0, make_info(2, 2)), 0);
+    EXPECT_EQ(record_count(), before + 1);
+}
+
+TEST_F(TensorDumpTriggerTest, AbsMaxTriggerComparesAgainstBound) {
+    ASSERT_EQ(dump_tensor_configure_filters("func:7,trig:absmax,bound:10"), 1);
+
+    data_ = {1.0f, -9.5f, 3.0f, 4.0f};
+    uint32_t before = record_count();
+    EXPECT_EQ(dump_tensor_record(0, make_info(2, 2)), 0);
+    EXPECT_EQ(record_count(), before);  // max|x| = 9.5, below bound
+
+    data_[1] = -10.5f;  // Negative excursion counts too
+    EXPECT_EQ(dump_tensor_record(0, make_info(2, 2)), 0);
+    EXPECT_EQ(record_count(), before + 1);
+}
+
+TEST_F(TensorDumpTriggerTest, UserFlagTriggerFollowsSharedMemoryFlag) {
+    ASSERT_EQ(dump_tensor_configure_filters("func:7,trig:flag"), 1);
+
+    data_ = {1.0f, 2.0f, 3.0f, 4.0f};
+    uint32_t before = record_count();
+    EXPECT_EQ(dump_tensor_record(0, make_info(2, 2)), 0);
+    EXPECT_EQ(record_count(), before);  // Flag clear: silent
+
+    get_dump_header(shm_)->user_trigger_flag = 1;
+    EXPECT_EQ(dump_tensor_record(0, make_info(2, 2)), 0);
+    EXPECT_EQ(record_count(), before + 1);
+
+    get_dump_header(shm_)->user_trigger_flag = 0;
+    EXPECT_EQ(dump_tensor_record(0, make_info(2, 2)), 0);
+    EXPECT_EQ(record_count(), before + 1);
+}
+
+TEST_F(TensorDumpTriggerTest, TriggeredSummaryDumpReusesTheStatsPass) {
+    ASSERT_EQ(dump_tensor_configure_filters("func:7,mode:summary,trig:nan"), 1);
+
+    data_ = {1.0f, -3.0f, std::nanf(""), 5.0f};
+    uint32_t before = record_count();
+    EXPECT_EQ(dump_tensor_record(0, make_info(2, 2)), 0);
+    ASSERT_EQ(record_count(), before + 1);
+
+    DumpBufferState *state = get_dump_buffer_state(shm_, 0);
+    DumpMetaBuffer *buf = reinterpret_cast<DumpMetaBuffer *>(state->current_buf_ptr);
+    const TensorDumpRecord *rec = &buf->records[buf->count - 1];
+    EXPECT_EQ(rec->filter_mode, static_cast<uint8_t>(TensorDumpFilterMode::SUMMARY));
+    ASSERT_EQ(rec->payload_size, sizeof(TensorDumpSummary));
+    TensorDumpSummary summary;
+    for (uint64_t i = 0; i < sizeof(summary); i++) {
+        reinterpret_cast<uint8_t *>(&summary)[i] =
+            static_cast<uint8_t *>(arena_)[(rec->payload_offset + i) % TEST_ARENA_SIZE];
+    }
+    EXPECT_FLOAT_EQ(summary.min_val, -3.0f);
+    EXPECT_FLOAT_EQ(summary.max_val, 5.0f);
+    EXPECT_EQ(summary.nan_count, 1u);
+}
+
+}  // namespace
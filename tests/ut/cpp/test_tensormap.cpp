@@ -11,6 +11,10 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "tensormap.h"
 
 // Helper: host key (worker=-1)
@@ -99,3 +103,85 @@ TEST(TensorMap, EraseChildKeyLeavesHostKey) {
     EXPECT_EQ(tm.lookup(ck(0x1000, 0)), INVALID_SLOT);
     EXPECT_EQ(tm.size(), 1);
 }
+
+// --- Sharded-table tests ---
+
+TEST(TensorMap, InitOnNonEmptyMapThrows) {
+    TensorMap tm;
+    tm.insert(hk(0x1000), 1);
+    EXPECT_THROW(tm.init(128), std::logic_error);
+}
+
+TEST(TensorMap, ShardFullThrowsInsteadOfRehashing) {
+    // Tables are sized once at init (no rehash — that is what keeps lookup
+    // lock-free). Overfilling a small map must surface as an error, not a
+    // silent grow.
+    TensorMap tm;
+    tm.init(64);
+    EXPECT_THROW(
+        {
+            for (uint64_t i = 1; i <= 10000; ++i) {
+                tm.insert(hk(i * 0x1000), 0);
+            }
+        },
+        std::runtime_error
+    );
+}
+
+TEST(TensorMap, TombstoneSlotsAreReusedByInsert) {
+    // Erase + re-insert cycles at a small fixed capacity: tombstones must be
+    // reclaimed or the shard would fill despite never holding more than one
+    // live entry.
+    TensorMap tm;
+    tm.init(64);
+    for (uint64_t i = 1; i <= 10000; ++i) {
+        tm.insert(hk(i * 0x1000), static_cast<TaskSlot>(i % 97));
+        EXPECT_EQ(tm.lookup(hk(i * 0x1000)), static_cast<TaskSlot>(i % 97));
+        tm.erase_task_outputs({hk(i * 0x1000)});
+    }
+    EXPECT_EQ(tm.size(), 0);
+}
+
+TEST(TensorMap, ConcurrentLookupDuringInsertErase) {
+    // Readers run lock-free while writer threads insert and erase. Every
+    // lookup must return either the key's fixed producer or INVALID_SLOT —
+    // never a torn or mismatched value.
+    TensorMap tm;
+
+    constexpr int kKeys = 64;
+    auto key_for = [](int i) { return TensorKey{static_cast<uint64_t>(i + 1) * 0x1000, int8_t(i % 4 - 1)}; };
+    auto producer_for = [](int i) { return static_cast<TaskSlot>(i * 3 + 7); };
+
+    std::atomic<bool> stop{false};
+    std::atomic<bool> failed{false};
+
+    std::thread writer([&] {
+        for (int round = 0; round < 500; ++round) {
+            for (int i = 0; i < kKeys; ++i) tm.insert(key_for(i), producer_for(i));
+            std::vector<TensorKey> keys;
+            for (int i = 0; i < kKeys; ++i) keys.push_back(key_for(i));
+            tm.erase_task_outputs(keys);
+        }
+        stop.store(true);
+    });
+
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([&] {
+            while (!stop.load() && !failed.load()) {
+                for (int i = 0; i < kKeys; ++i) {
+                    TaskSlot got = tm.lookup(key_for(i));
+                    if (got != INVALID_SLOT && got != producer_for(i)) {
+                        failed.store(true);
+                        return;
+                    }
+                }
+            }
+        });
+    }
+
+    writer.join();
+    for (auto &r : readers) r.join();
+    EXPECT_FALSE(failed.load());
+    EXPECT_EQ(tm.size(), 0);
+}
@@ -74,6 +74,33 @@ class TestChipWorkerStateMachine:
         with pytest.raises(RuntimeError, match="device not set"):
             worker.run(callable_obj, args, config)
 
+    def test_run_async_before_set_device_raises(self):
+        from _task_interface import ChipCallable, ChipStorageTaskArgs  # noqa: PLC0415
+
+        worker = _ChipWorker()
+        config = ChipCallConfig()
+        args = ChipStorageTaskArgs()
+        callable_obj = ChipCallable.build(signature=[], func_name="test", binary=b"\x00", children=[])
+
+        with pytest.raises(RuntimeError, match="device not set"):
+            worker.run_async(callable_obj, args, config)
+
+    def test_warm_up_before_set_device_raises(self):
+        worker = _ChipWorker()
+
+        with pytest.raises(RuntimeError, match="device not set"):
+            worker.warm_up()
+
+    def test_wait_invalid_handle_raises(self):
+        worker = _ChipWorker()
+        with pytest.raises(RuntimeError, match="invalid run handle"):
+            worker.wait(1)
+
+    def test_wait_all_without_pending_runs(self):
+        worker = _ChipWorker()
+        # No submissions: wait_all() returns immediately without raising
+        worker.wait_all()
+
     def test_set_device_before_init_raises(self):
         worker = _ChipWorker()
         with pytest.raises(RuntimeError, match="not initialized"):
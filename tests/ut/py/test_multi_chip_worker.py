@@ -0,0 +1,69 @@
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+# ruff: noqa: E402
+"""Tests for the MultiChipWorker state machine."""
+
+import sys
+from pathlib import Path
+
+import pytest
+
+# Ensure python/ is on the import path so _task_interface resolves
+_python_dir = str(Path(__file__).resolve().parent.parent.parent / "python")
+if _python_dir not in sys.path:
+    sys.path.insert(0, _python_dir)
+
+from _task_interface import ChipCallConfig, _MultiChipWorker  # pyright: ignore[reportMissingImports]
+
+
+class TestMultiChipWorkerStateMachine:
+    def test_initial_state(self):
+        worker = _MultiChipWorker()
+        assert worker.initialized is False
+        assert worker.device_count == 0
+
+    def test_init_without_devices_raises(self):
+        worker = _MultiChipWorker()
+        with pytest.raises(RuntimeError, match="at least one device"):
+            worker.init("/nonexistent/libfoo.so", "/dev/null", "/dev/null", [])
+
+    def test_init_with_nonexistent_lib_raises(self):
+        worker = _MultiChipWorker()
+        with pytest.raises(RuntimeError, match="dlopen"):
+            worker.init("/nonexistent/libfoo.so", "/dev/null", "/dev/null", [0, 1])
+        # Failed init leaves no partially claimed devices behind
+        assert worker.initialized is False
+        assert worker.device_count == 0
+
+    def test_run_before_init_raises(self):
+        from _task_interface import ChipCallable, ChipStorageTaskArgs  # noqa: PLC0415
+
+        worker = _MultiChipWorker()
+        config = ChipCallConfig()
+        args = ChipStorageTaskArgs()
+        callable_obj = ChipCallable.build(signature=[], func_name="test", binary=b"\x00", children=[])
+
+        with pytest.raises(RuntimeError, match="not initialized"):
+            worker.run(callable_obj, [args], config)
+
+    def test_drain_before_init_is_noop(self):
+        worker = _MultiChipWorker()
+        worker.drain()
+
+    def test_finalize_idempotent(self):
+        worker = _MultiChipWorker()
+        worker.finalize()
+        worker.finalize()
+        assert worker.initialized is False
+
+    def test_init_after_finalize_raises(self):
+        worker = _MultiChipWorker()
+        worker.finalize()
+        with pytest.raises(RuntimeError, match="finalized"):
+            worker.init("/nonexistent/libfoo.so", "/dev/null", "/dev/null", [0])
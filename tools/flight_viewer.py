@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+# Copyright (c) PyPTO Contributors.
+# This program is free software, you can redistribute it and/or modify it under the terms and conditions of
+# CANN Open Software License Agreement Version 2.0 (the "License").
+# Please refer to the License for details. You may not use this file except in compliance with the License.
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+# INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+# See LICENSE in the root of the software repository for the full text of the License.
+# -----------------------------------------------------------------------------------------------------------
+"""Flight recorder viewer — decode the crash dump written on a PTO2 abort.
+
+When a run dies (allocator/scope deadlock, emergency shutdown), the runtime
+persists each thread's ring of recent events to pto2_flight_dump.bin (or the
+path in PTO2_FLIGHT_DUMP). This tool prints them, by default merged across
+threads in timestamp order so the cross-thread sequence leading up to the
+abort reads top to bottom.
+
+Filters (freely combinable):
+    --type    Filter by event type (submit / dispatch / complete / scope / stall / abort)
+    --task    Filter by task_id (hex, e.g. 0x0000000200000a00)
+    --thread  Show only one thread's ring (index from the dump)
+    --tail    Show only the last N merged events
+
+Usage:
+    # Merged timeline of the default dump file
+    python tools/flight_viewer.py
+
+    # Last 50 events of a specific dump
+    python tools/flight_viewer.py pto2_flight_dump.bin --tail 50
+
+    # Everything that happened to one task
+    python tools/flight_viewer.py --task 0x0000000200000a00
+
+    # Allocator stalls only
+    python tools/flight_viewer.py --type stall
+"""
+
+from __future__ import annotations
+
+import argparse
+import struct
+import sys
+from pathlib import Path
+
+MAGIC = 0x50464C54  # "PFLT"
+VERSION = 1
+
+FILE_HEADER = struct.Struct("<IHHIIQ64s")
+RING_HEADER = struct.Struct("<QII")
+EVENT = struct.Struct("<QQii1s7x")
+
+EVENT_TYPES = {
+    0: "SUBMIT",
+    1: "DISPATCH",
+    2: "COMPLETE",
+    3: "SCOPE_BEGIN",
+    4: "SCOPE_END",
+    5: "ALLOC_STALL",
+    6: "ABORT",
+}
+
+TYPE_FILTERS = {
+    "submit": {0},
+    "dispatch": {1},
+    "complete": {2},
+    "scope": {3, 4},
+    "stall": {5},
+    "abort": {6},
+}
+
+
+def describe(etype: int, task_id: int, arg0: int, arg1: int) -> str:
+    """Render the type-specific argument fields."""
+    if etype == 0:
+        kernel = "alloc_tensors" if arg0 == -1 else f"aic_kernel={arg0}"
+        return f"task=0x{task_id:016x} {kernel} tensors={arg1}"
+    if etype in (1, 2):
+        return f"task=0x{task_id:016x} core={arg0} reg_task_id={arg1}"
+    if etype == 3:
+        return f"depth={arg0}"
+    if etype == 4:
+        return f"depth={arg0} tasks_retired={arg1}"
+    if etype == 5:
+        cause = "heap" if arg1 else "task_window"
+        return f"requested={arg0}B blocked_on={cause}"
+    if etype == 6:
+        return f"error_code={arg0} detail={arg1}"
+    return f"task=0x{task_id:016x} arg0={arg0} arg1={arg1}"
+
+
+def load_dump(path: Path):
+    data = path.read_bytes()
+    if len(data) < FILE_HEADER.size:
+        sys.exit(f"error: {path} is too small to be a flight recorder dump")
+    magic, version, event_size, ring_capacity, ring_count, dump_cycle, reason = FILE_HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        sys.exit(f"error: {path} is not a flight recorder dump (bad magic 0x{magic:08x})")
+    if version != VERSION or event_size != EVENT.size:
+        sys.exit(f"error: unsupported dump (version={version}, event_size={event_size})")
+
+    rings = []
+    offset = FILE_HEADER.size
+    for ring_idx in range(ring_count):
+        total_count, emitted, _ = RING_HEADER.unpack_from(data, offset)
+        offset += RING_HEADER.size
+        events = []
+        for _ in range(emitted):
+            timestamp, task_id, arg0, arg1, etype = EVENT.unpack_from(data, offset)
+            offset += EVENT.size
+            events.append((timestamp, task_id, arg0, arg1, etype[0]))
+        rings.append({"total_count": total_count, "events": events})
+    return {
+        "ring_capacity": ring_capacity,
+        "dump_cycle": dump_cycle,
+        "reason": reason.split(b"\0", 1)[0].decode(errors="replace"),
+        "rings": rings,
+    }
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Decode a PTO2 flight recorder crash dump")
+    parser.add_argument("dump", nargs="?", default="pto2_flight_dump.bin", help="dump file path")
+    parser.add_argument("--type", choices=sorted(TYPE_FILTERS), help="filter by event type")
+    parser.add_argument("--task", type=lambda s: int(s, 0), help="filter by task_id (hex ok)")
+    parser.add_argument("--thread", type=int, help="show only one thread's ring")
+    parser.add_argument("--tail", type=int, help="show only the last N merged events")
+    args = parser.parse_args()
+
+    path = Path(args.dump)
+    if not path.is_file():
+        sys.exit(f"error: no dump file at {path} (set PTO2_FLIGHT_DUMP or pass a path)")
+    dump = load_dump(path)
+
+    print(f"reason: {dump['reason'] or '(none)'}")
+    print(f"dump cycle: {dump['dump_cycle']}")
+    print(f"threads: {len(dump['rings'])} (ring capacity {dump['ring_capacity']})")
+    for idx, ring in enumerate(dump["rings"]):
+        dropped = ring["total_count"] - len(ring["events"])
+        note = f" ({dropped} older events overwritten)" if dropped > 0 else ""
+        print(f"  thread {idx}: {ring['total_count']} events recorded{note}")
+    print()
+
+    merged = []
+    for idx, ring in enumerate(dump["rings"]):
+        if args.thread is not None and idx != args.thread:
+            continue
+        for ev in ring["events"]:
+            merged.append((ev[0], idx) + ev[1:])
+    # Per-ring order is already chronological; cross-thread merge by timestamp
+    # (all zeros — e.g. a host-only run — keeps per-ring order via stable sort)
+    merged.sort(key=lambda e: e[0])
+
+    wanted = TYPE_FILTERS[args.type] if args.type else None
+    rows = []
+    for timestamp, thread, task_id, arg0, arg1, etype in merged:
+        if wanted is not None and etype not in wanted:
+            continue
+        if args.task is not None and task_id != args.task:
+            continue
+        rows.append((timestamp, thread, etype, task_id, arg0, arg1))
+    if args.tail is not None:
+        rows = rows[-args.tail:]
+
+    for timestamp, thread, etype, task_id, arg0, arg1 in rows:
+        name = EVENT_TYPES.get(etype, f"TYPE_{etype}")
+        print(f"{timestamp:>20}  t{thread}  {name:<11}  {describe(etype, task_id, arg0, arg1)}")
+    print(f"\n{len(rows)} events shown")
+
+
+if __name__ == "__main__":
+    main()